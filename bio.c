@@ -40,7 +40,7 @@ binit(void)
 {
   struct buf *b;
 
-  initlock(&bcache.lock, "bcache");
+  initmcslock(&bcache.lock, "bcache");
 
 //PAGEBREAK!
   // Create linked list of buffers
@@ -132,6 +132,8 @@ brelse(struct buf *b)
   bcache.head.next = b;
 
   b->flags &= ~B_BUSY;
+  // Not wakeone(): bget() may have recycled b for another
+  // sector, and then the one woken might not want it.
   wakeup(b);
 
   release(&bcache.lock);
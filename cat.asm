@@ -0,0 +1,1858 @@
+
+_cat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <cat>:
+
+char buf[512];
+
+void
+cat(int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n;
+
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+   6:	eb 15                	jmp    1d <cat+0x1d>
+    write(1, buf, n);
+   8:	83 ec 04             	sub    $0x4,%esp
+   b:	ff 75 f4             	push   -0xc(%ebp)
+   e:	68 a0 12 00 00       	push   $0x12a0
+  13:	6a 01                	push   $0x1
+  15:	e8 63 07 00 00       	call   77d <write>
+  1a:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf, sizeof(buf))) > 0)
+  1d:	83 ec 04             	sub    $0x4,%esp
+  20:	68 00 02 00 00       	push   $0x200
+  25:	68 a0 12 00 00       	push   $0x12a0
+  2a:	ff 75 08             	push   0x8(%ebp)
+  2d:	e8 44 07 00 00       	call   776 <read>
+  32:	83 c4 10             	add    $0x10,%esp
+  35:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  38:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  3c:	7f ca                	jg     8 <cat+0x8>
+  if(n < 0){
+  3e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  42:	79 17                	jns    5b <cat+0x5b>
+    printf(1, "cat: read error\n");
+  44:	83 ec 08             	sub    $0x8,%esp
+  47:	68 76 0d 00 00       	push   $0xd76
+  4c:	6a 01                	push   $0x1
+  4e:	e8 e4 08 00 00       	call   937 <printf>
+  53:	83 c4 10             	add    $0x10,%esp
+    exit();
+  56:	e8 06 07 00 00       	call   761 <exit>
+  }
+}
+  5b:	90                   	nop
+  5c:	c9                   	leave
+  5d:	c3                   	ret
+
+0000005e <main>:
+
+int
+main(int argc, char *argv[])
+{
+  5e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  62:	83 e4 f0             	and    $0xfffffff0,%esp
+  65:	ff 71 fc             	push   -0x4(%ecx)
+  68:	55                   	push   %ebp
+  69:	89 e5                	mov    %esp,%ebp
+  6b:	53                   	push   %ebx
+  6c:	51                   	push   %ecx
+  6d:	83 ec 10             	sub    $0x10,%esp
+  70:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+  72:	83 3b 01             	cmpl   $0x1,(%ebx)
+  75:	7f 12                	jg     89 <main+0x2b>
+    cat(0);
+  77:	83 ec 0c             	sub    $0xc,%esp
+  7a:	6a 00                	push   $0x0
+  7c:	e8 7f ff ff ff       	call   0 <cat>
+  81:	83 c4 10             	add    $0x10,%esp
+    exit();
+  84:	e8 d8 06 00 00       	call   761 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  89:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  90:	eb 71                	jmp    103 <main+0xa5>
+    if((fd = open(argv[i], 0)) < 0){
+  92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  95:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  9c:	8b 43 04             	mov    0x4(%ebx),%eax
+  9f:	01 d0                	add    %edx,%eax
+  a1:	8b 00                	mov    (%eax),%eax
+  a3:	83 ec 08             	sub    $0x8,%esp
+  a6:	6a 00                	push   $0x0
+  a8:	50                   	push   %eax
+  a9:	e8 eb 06 00 00       	call   799 <open>
+  ae:	83 c4 10             	add    $0x10,%esp
+  b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  b4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b8:	79 29                	jns    e3 <main+0x85>
+      printf(1, "cat: cannot open %s\n", argv[i]);
+  ba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  bd:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  c4:	8b 43 04             	mov    0x4(%ebx),%eax
+  c7:	01 d0                	add    %edx,%eax
+  c9:	8b 00                	mov    (%eax),%eax
+  cb:	83 ec 04             	sub    $0x4,%esp
+  ce:	50                   	push   %eax
+  cf:	68 87 0d 00 00       	push   $0xd87
+  d4:	6a 01                	push   $0x1
+  d6:	e8 5c 08 00 00       	call   937 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+      exit();
+  de:	e8 7e 06 00 00       	call   761 <exit>
+    }
+    cat(fd);
+  e3:	83 ec 0c             	sub    $0xc,%esp
+  e6:	ff 75 f0             	push   -0x10(%ebp)
+  e9:	e8 12 ff ff ff       	call   0 <cat>
+  ee:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+  f1:	83 ec 0c             	sub    $0xc,%esp
+  f4:	ff 75 f0             	push   -0x10(%ebp)
+  f7:	e8 88 06 00 00       	call   784 <close>
+  fc:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+  ff:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 103:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 106:	3b 03                	cmp    (%ebx),%eax
+ 108:	7c 88                	jl     92 <main+0x34>
+  }
+  exit();
+ 10a:	e8 52 06 00 00       	call   761 <exit>
+
+0000010f <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 10f:	55                   	push   %ebp
+ 110:	89 e5                	mov    %esp,%ebp
+ 112:	57                   	push   %edi
+ 113:	53                   	push   %ebx
+char*
+ 114:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 117:	8b 55 10             	mov    0x10(%ebp),%edx
+ 11a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 11d:	89 cb                	mov    %ecx,%ebx
+ 11f:	89 df                	mov    %ebx,%edi
+ 121:	89 d1                	mov    %edx,%ecx
+ 123:	fc                   	cld
+ 124:	f3 aa                	rep stos %al,%es:(%edi)
+ 126:	89 ca                	mov    %ecx,%edx
+ 128:	89 fb                	mov    %edi,%ebx
+ 12a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 12d:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 130:	90                   	nop
+ 131:	5b                   	pop    %ebx
+ 132:	5f                   	pop    %edi
+ 133:	5d                   	pop    %ebp
+ 134:	c3                   	ret
+
+00000135 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 13b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 13e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 141:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 144:	f0 87 02             	lock xchg %eax,(%edx)
+ 147:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 14a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 14d:	c9                   	leave
+ 14e:	c3                   	ret
+
+0000014f <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 14f:	55                   	push   %ebp
+ 150:	89 e5                	mov    %esp,%ebp
+ 152:	53                   	push   %ebx
+ 153:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 156:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 159:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 162:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 166:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 169:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 16c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 16f:	c9                   	leave
+ 170:	c3                   	ret
+
+00000171 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 171:	55                   	push   %ebp
+ 172:	89 e5                	mov    %esp,%ebp
+ 174:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 177:	0f 31                	rdtsc
+ 179:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 17c:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 17f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 182:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 185:	c9                   	leave
+ 186:	c3                   	ret
+
+00000187 <strcpy>:
+{
+ 187:	55                   	push   %ebp
+ 188:	89 e5                	mov    %esp,%ebp
+ 18a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 18d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 190:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 193:	90                   	nop
+ 194:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 197:	8d 42 01             	lea    0x1(%edx),%eax
+ 19a:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 19d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1a3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1a6:	0f b6 12             	movzbl (%edx),%edx
+ 1a9:	88 10                	mov    %dl,(%eax)
+ 1ab:	0f b6 00             	movzbl (%eax),%eax
+ 1ae:	84 c0                	test   %al,%al
+ 1b0:	75 e2                	jne    194 <strcpy+0xd>
+  return os;
+ 1b2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1b5:	c9                   	leave
+ 1b6:	c3                   	ret
+
+000001b7 <strcmp>:
+{
+ 1b7:	55                   	push   %ebp
+ 1b8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ba:	eb 08                	jmp    1c4 <strcmp+0xd>
+    p++, q++;
+ 1bc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1c0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c7:	0f b6 00             	movzbl (%eax),%eax
+ 1ca:	84 c0                	test   %al,%al
+ 1cc:	74 10                	je     1de <strcmp+0x27>
+ 1ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d1:	0f b6 10             	movzbl (%eax),%edx
+ 1d4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d7:	0f b6 00             	movzbl (%eax),%eax
+ 1da:	38 c2                	cmp    %al,%dl
+ 1dc:	74 de                	je     1bc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e1:	0f b6 00             	movzbl (%eax),%eax
+ 1e4:	0f b6 d0             	movzbl %al,%edx
+ 1e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ea:	0f b6 00             	movzbl (%eax),%eax
+ 1ed:	0f b6 c0             	movzbl %al,%eax
+ 1f0:	29 c2                	sub    %eax,%edx
+ 1f2:	89 d0                	mov    %edx,%eax
+}
+ 1f4:	5d                   	pop    %ebp
+ 1f5:	c3                   	ret
+
+000001f6 <strlen>:
+{
+ 1f6:	55                   	push   %ebp
+ 1f7:	89 e5                	mov    %esp,%ebp
+ 1f9:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1fc:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 203:	eb 04                	jmp    209 <strlen+0x13>
+ 205:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 209:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 20c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20f:	01 d0                	add    %edx,%eax
+ 211:	0f b6 00             	movzbl (%eax),%eax
+ 214:	84 c0                	test   %al,%al
+ 216:	75 ed                	jne    205 <strlen+0xf>
+  return n;
+ 218:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 21b:	c9                   	leave
+ 21c:	c3                   	ret
+
+0000021d <memset>:
+{
+ 21d:	55                   	push   %ebp
+ 21e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 220:	8b 45 10             	mov    0x10(%ebp),%eax
+ 223:	50                   	push   %eax
+ 224:	ff 75 0c             	push   0xc(%ebp)
+ 227:	ff 75 08             	push   0x8(%ebp)
+ 22a:	e8 e0 fe ff ff       	call   10f <stosb>
+ 22f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 235:	c9                   	leave
+ 236:	c3                   	ret
+
+00000237 <strchr>:
+{
+ 237:	55                   	push   %ebp
+ 238:	89 e5                	mov    %esp,%ebp
+ 23a:	83 ec 04             	sub    $0x4,%esp
+ 23d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 240:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 243:	eb 14                	jmp    259 <strchr+0x22>
+    if(*s == c)
+ 245:	8b 45 08             	mov    0x8(%ebp),%eax
+ 248:	0f b6 00             	movzbl (%eax),%eax
+ 24b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 24e:	75 05                	jne    255 <strchr+0x1e>
+      return (char*)s;
+ 250:	8b 45 08             	mov    0x8(%ebp),%eax
+ 253:	eb 13                	jmp    268 <strchr+0x31>
+  for(; *s; s++)
+ 255:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 259:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25c:	0f b6 00             	movzbl (%eax),%eax
+ 25f:	84 c0                	test   %al,%al
+ 261:	75 e2                	jne    245 <strchr+0xe>
+  return 0;
+ 263:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 268:	c9                   	leave
+ 269:	c3                   	ret
+
+0000026a <gets>:
+{
+ 26a:	55                   	push   %ebp
+ 26b:	89 e5                	mov    %esp,%ebp
+ 26d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 270:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 277:	eb 42                	jmp    2bb <gets+0x51>
+    cc = read(0, &c, 1);
+ 279:	83 ec 04             	sub    $0x4,%esp
+ 27c:	6a 01                	push   $0x1
+ 27e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 281:	50                   	push   %eax
+ 282:	6a 00                	push   $0x0
+ 284:	e8 ed 04 00 00       	call   776 <read>
+ 289:	83 c4 10             	add    $0x10,%esp
+ 28c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 28f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 293:	7e 33                	jle    2c8 <gets+0x5e>
+    buf[i++] = c;
+ 295:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 298:	8d 50 01             	lea    0x1(%eax),%edx
+ 29b:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 29e:	89 c2                	mov    %eax,%edx
+ 2a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a3:	01 c2                	add    %eax,%edx
+ 2a5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2ab:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2af:	3c 0a                	cmp    $0xa,%al
+ 2b1:	74 16                	je     2c9 <gets+0x5f>
+ 2b3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2b7:	3c 0d                	cmp    $0xd,%al
+ 2b9:	74 0e                	je     2c9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2be:	83 c0 01             	add    $0x1,%eax
+ 2c1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2c4:	7f b3                	jg     279 <gets+0xf>
+ 2c6:	eb 01                	jmp    2c9 <gets+0x5f>
+      break;
+ 2c8:	90                   	nop
+  buf[i] = '\0';
+ 2c9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cf:	01 d0                	add    %edx,%eax
+ 2d1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2d4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2d7:	c9                   	leave
+ 2d8:	c3                   	ret
+
+000002d9 <stat>:
+{
+ 2d9:	55                   	push   %ebp
+ 2da:	89 e5                	mov    %esp,%ebp
+ 2dc:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2df:	83 ec 08             	sub    $0x8,%esp
+ 2e2:	6a 00                	push   $0x0
+ 2e4:	ff 75 08             	push   0x8(%ebp)
+ 2e7:	e8 ad 04 00 00       	call   799 <open>
+ 2ec:	83 c4 10             	add    $0x10,%esp
+ 2ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2f2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2f6:	79 07                	jns    2ff <stat+0x26>
+    return -1;
+ 2f8:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2fd:	eb 25                	jmp    324 <stat+0x4b>
+  r = fstat(fd, st);
+ 2ff:	83 ec 08             	sub    $0x8,%esp
+ 302:	ff 75 0c             	push   0xc(%ebp)
+ 305:	ff 75 f4             	push   -0xc(%ebp)
+ 308:	e8 a1 04 00 00       	call   7ae <fstat>
+ 30d:	83 c4 10             	add    $0x10,%esp
+ 310:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 313:	83 ec 0c             	sub    $0xc,%esp
+ 316:	ff 75 f4             	push   -0xc(%ebp)
+ 319:	e8 66 04 00 00       	call   784 <close>
+ 31e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 321:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 324:	c9                   	leave
+ 325:	c3                   	ret
+
+00000326 <atoi>:
+{
+ 326:	55                   	push   %ebp
+ 327:	89 e5                	mov    %esp,%ebp
+ 329:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 32c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 333:	eb 25                	jmp    35a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 335:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 338:	89 d0                	mov    %edx,%eax
+ 33a:	c1 e0 02             	shl    $0x2,%eax
+ 33d:	01 d0                	add    %edx,%eax
+ 33f:	01 c0                	add    %eax,%eax
+ 341:	89 c1                	mov    %eax,%ecx
+ 343:	8b 45 08             	mov    0x8(%ebp),%eax
+ 346:	8d 50 01             	lea    0x1(%eax),%edx
+ 349:	89 55 08             	mov    %edx,0x8(%ebp)
+ 34c:	0f b6 00             	movzbl (%eax),%eax
+ 34f:	0f be c0             	movsbl %al,%eax
+ 352:	01 c8                	add    %ecx,%eax
+ 354:	83 e8 30             	sub    $0x30,%eax
+ 357:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 35a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35d:	0f b6 00             	movzbl (%eax),%eax
+ 360:	3c 2f                	cmp    $0x2f,%al
+ 362:	7e 0a                	jle    36e <atoi+0x48>
+ 364:	8b 45 08             	mov    0x8(%ebp),%eax
+ 367:	0f b6 00             	movzbl (%eax),%eax
+ 36a:	3c 39                	cmp    $0x39,%al
+ 36c:	7e c7                	jle    335 <atoi+0xf>
+  return n;
+ 36e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 371:	c9                   	leave
+ 372:	c3                   	ret
+
+00000373 <memmove>:
+{
+ 373:	55                   	push   %ebp
+ 374:	89 e5                	mov    %esp,%ebp
+ 376:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 379:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 37f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 382:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 385:	eb 17                	jmp    39e <memmove+0x2b>
+    *dst++ = *src++;
+ 387:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 38a:	8d 42 01             	lea    0x1(%edx),%eax
+ 38d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 390:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 393:	8d 48 01             	lea    0x1(%eax),%ecx
+ 396:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 399:	0f b6 12             	movzbl (%edx),%edx
+ 39c:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 39e:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3a4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3a7:	85 c0                	test   %eax,%eax
+ 3a9:	7f dc                	jg     387 <memmove+0x14>
+  return vdst;
+ 3ab:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3ae:	c9                   	leave
+ 3af:	c3                   	ret
+
+000003b0 <mutex_init>:
+{
+ 3b0:	55                   	push   %ebp
+ 3b1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3bc:	90                   	nop
+ 3bd:	5d                   	pop    %ebp
+ 3be:	c3                   	ret
+
+000003bf <mutex_lock>:
+{
+ 3bf:	55                   	push   %ebp
+ 3c0:	89 e5                	mov    %esp,%ebp
+ 3c2:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c8:	6a 01                	push   $0x1
+ 3ca:	6a 00                	push   $0x0
+ 3cc:	50                   	push   %eax
+ 3cd:	e8 7d fd ff ff       	call   14f <cmpxchg>
+ 3d2:	83 c4 0c             	add    $0xc,%esp
+ 3d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3dc:	74 46                	je     424 <mutex_lock+0x65>
+  if(c != 2)
+ 3de:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 3e2:	74 38                	je     41c <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 3e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e7:	6a 02                	push   $0x2
+ 3e9:	50                   	push   %eax
+ 3ea:	e8 46 fd ff ff       	call   135 <xchg>
+ 3ef:	83 c4 08             	add    $0x8,%esp
+ 3f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 3f5:	eb 25                	jmp    41c <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 3f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fa:	83 ec 08             	sub    $0x8,%esp
+ 3fd:	6a 02                	push   $0x2
+ 3ff:	50                   	push   %eax
+ 400:	e8 22 04 00 00       	call   827 <futex_wait>
+ 405:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 408:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40b:	83 ec 08             	sub    $0x8,%esp
+ 40e:	6a 02                	push   $0x2
+ 410:	50                   	push   %eax
+ 411:	e8 1f fd ff ff       	call   135 <xchg>
+ 416:	83 c4 10             	add    $0x10,%esp
+ 419:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 41c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 420:	75 d5                	jne    3f7 <mutex_lock+0x38>
+ 422:	eb 01                	jmp    425 <mutex_lock+0x66>
+    return;
+ 424:	90                   	nop
+}
+ 425:	c9                   	leave
+ 426:	c3                   	ret
+
+00000427 <mutex_unlock>:
+{
+ 427:	55                   	push   %ebp
+ 428:	89 e5                	mov    %esp,%ebp
+ 42a:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 42d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 430:	6a 00                	push   $0x0
+ 432:	50                   	push   %eax
+ 433:	e8 fd fc ff ff       	call   135 <xchg>
+ 438:	83 c4 08             	add    $0x8,%esp
+ 43b:	83 f8 02             	cmp    $0x2,%eax
+ 43e:	75 11                	jne    451 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 440:	8b 45 08             	mov    0x8(%ebp),%eax
+ 443:	83 ec 08             	sub    $0x8,%esp
+ 446:	6a 01                	push   $0x1
+ 448:	50                   	push   %eax
+ 449:	e8 e3 03 00 00       	call   831 <futex_wake>
+ 44e:	83 c4 10             	add    $0x10,%esp
+}
+ 451:	90                   	nop
+ 452:	c9                   	leave
+ 453:	c3                   	ret
+
+00000454 <cond_init>:
+{
+ 454:	55                   	push   %ebp
+ 455:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 457:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 460:	90                   	nop
+ 461:	5d                   	pop    %ebp
+ 462:	c3                   	ret
+
+00000463 <cond_wait>:
+{
+ 463:	55                   	push   %ebp
+ 464:	89 e5                	mov    %esp,%ebp
+ 466:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 469:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46c:	8b 00                	mov    (%eax),%eax
+ 46e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 471:	83 ec 0c             	sub    $0xc,%esp
+ 474:	ff 75 0c             	push   0xc(%ebp)
+ 477:	e8 ab ff ff ff       	call   427 <mutex_unlock>
+ 47c:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 47f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 482:	83 ec 08             	sub    $0x8,%esp
+ 485:	ff 75 f4             	push   -0xc(%ebp)
+ 488:	50                   	push   %eax
+ 489:	e8 99 03 00 00       	call   827 <futex_wait>
+ 48e:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 491:	eb 11                	jmp    4a4 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 493:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 496:	83 ec 08             	sub    $0x8,%esp
+ 499:	6a 02                	push   $0x2
+ 49b:	50                   	push   %eax
+ 49c:	e8 86 03 00 00       	call   827 <futex_wait>
+ 4a1:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a7:	83 ec 08             	sub    $0x8,%esp
+ 4aa:	6a 02                	push   $0x2
+ 4ac:	50                   	push   %eax
+ 4ad:	e8 83 fc ff ff       	call   135 <xchg>
+ 4b2:	83 c4 10             	add    $0x10,%esp
+ 4b5:	85 c0                	test   %eax,%eax
+ 4b7:	75 da                	jne    493 <cond_wait+0x30>
+}
+ 4b9:	90                   	nop
+ 4ba:	90                   	nop
+ 4bb:	c9                   	leave
+ 4bc:	c3                   	ret
+
+000004bd <condbump>:
+{
+ 4bd:	55                   	push   %ebp
+ 4be:	89 e5                	mov    %esp,%ebp
+ 4c0:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	8b 00                	mov    (%eax),%eax
+ 4c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4ce:	8d 50 01             	lea    0x1(%eax),%edx
+ 4d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d4:	52                   	push   %edx
+ 4d5:	ff 75 fc             	push   -0x4(%ebp)
+ 4d8:	50                   	push   %eax
+ 4d9:	e8 71 fc ff ff       	call   14f <cmpxchg>
+ 4de:	83 c4 0c             	add    $0xc,%esp
+ 4e1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 4e4:	75 dd                	jne    4c3 <condbump+0x6>
+}
+ 4e6:	90                   	nop
+ 4e7:	90                   	nop
+ 4e8:	c9                   	leave
+ 4e9:	c3                   	ret
+
+000004ea <cond_signal>:
+{
+ 4ea:	55                   	push   %ebp
+ 4eb:	89 e5                	mov    %esp,%ebp
+ 4ed:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 4f0:	ff 75 08             	push   0x8(%ebp)
+ 4f3:	e8 c5 ff ff ff       	call   4bd <condbump>
+ 4f8:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 4fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fe:	83 ec 08             	sub    $0x8,%esp
+ 501:	6a 01                	push   $0x1
+ 503:	50                   	push   %eax
+ 504:	e8 28 03 00 00       	call   831 <futex_wake>
+ 509:	83 c4 10             	add    $0x10,%esp
+}
+ 50c:	90                   	nop
+ 50d:	c9                   	leave
+ 50e:	c3                   	ret
+
+0000050f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 50f:	55                   	push   %ebp
+ 510:	89 e5                	mov    %esp,%ebp
+ 512:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 515:	ff 75 08             	push   0x8(%ebp)
+ 518:	e8 a0 ff ff ff       	call   4bd <condbump>
+ 51d:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 520:	8b 45 08             	mov    0x8(%ebp),%eax
+ 523:	83 ec 08             	sub    $0x8,%esp
+ 526:	68 ff ff ff 7f       	push   $0x7fffffff
+ 52b:	50                   	push   %eax
+ 52c:	e8 00 03 00 00       	call   831 <futex_wake>
+ 531:	83 c4 10             	add    $0x10,%esp
+}
+ 534:	90                   	nop
+ 535:	c9                   	leave
+ 536:	c3                   	ret
+
+00000537 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 537:	55                   	push   %ebp
+ 538:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 53a:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 53f:	8b 00                	mov    (%eax),%eax
+}
+ 541:	5d                   	pop    %ebp
+ 542:	c3                   	ret
+
+00000543 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 543:	55                   	push   %ebp
+ 544:	89 e5                	mov    %esp,%ebp
+ 546:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 549:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 54e:	8b 00                	mov    (%eax),%eax
+ 550:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 553:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 557:	74 05                	je     55e <vgetpid+0x1b>
+    return pid;
+ 559:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 55c:	eb 05                	jmp    563 <vgetpid+0x20>
+  return getpid();
+ 55e:	e8 74 02 00 00       	call   7d7 <getpid>
+}
+ 563:	c9                   	leave
+ 564:	c3                   	ret
+
+00000565 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 565:	55                   	push   %ebp
+ 566:	89 e5                	mov    %esp,%ebp
+ 568:	57                   	push   %edi
+ 569:	56                   	push   %esi
+ 56a:	53                   	push   %ebx
+ 56b:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 56e:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 575:	e8 f7 fb ff ff       	call   171 <rdtsc>
+ 57a:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 57d:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 580:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 583:	29 c8                	sub    %ecx,%eax
+ 585:	19 da                	sbb    %ebx,%edx
+ 587:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 58a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 58d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 590:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 593:	89 d0                	mov    %edx,%eax
+ 595:	31 d2                	xor    %edx,%edx
+ 597:	89 c1                	mov    %eax,%ecx
+ 599:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 59e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5a1:	8b 40 04             	mov    0x4(%eax),%eax
+ 5a4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5a9:	89 df                	mov    %ebx,%edi
+ 5ab:	0f af f8             	imul   %eax,%edi
+ 5ae:	89 d6                	mov    %edx,%esi
+ 5b0:	0f af f1             	imul   %ecx,%esi
+ 5b3:	01 f7                	add    %esi,%edi
+ 5b5:	f7 e1                	mul    %ecx
+ 5b7:	89 c1                	mov    %eax,%ecx
+ 5b9:	89 d3                	mov    %edx,%ebx
+ 5bb:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 5be:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 5c0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5c3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5c6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5c9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 5d0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5d3:	8b 40 04             	mov    0x4(%eax),%eax
+ 5d6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5d9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5e0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 5e3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 5e6:	89 d7                	mov    %edx,%edi
+ 5e8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5eb:	0f af fe             	imul   %esi,%edi
+ 5ee:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5f1:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5f4:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 5f7:	0f af f0             	imul   %eax,%esi
+ 5fa:	01 f7                	add    %esi,%edi
+ 5fc:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5ff:	f7 65 d8             	mull   -0x28(%ebp)
+ 602:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 605:	89 f2                	mov    %esi,%edx
+ 607:	89 d0                	mov    %edx,%eax
+ 609:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 60b:	01 c8                	add    %ecx,%eax
+ 60d:	11 da                	adc    %ebx,%edx
+}
+ 60f:	83 c4 24             	add    $0x24,%esp
+ 612:	5b                   	pop    %ebx
+ 613:	5e                   	pop    %esi
+ 614:	5f                   	pop    %edi
+ 615:	5d                   	pop    %ebp
+ 616:	c3                   	ret
+
+00000617 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 617:	55                   	push   %ebp
+ 618:	89 e5                	mov    %esp,%ebp
+ 61a:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 61d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 620:	8b 50 04             	mov    0x4(%eax),%edx
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	8b 00                	mov    (%eax),%eax
+ 628:	29 c2                	sub    %eax,%edx
+ 62a:	83 fa 1f             	cmp    $0x1f,%edx
+ 62d:	76 07                	jbe    636 <ring_queue+0x1f>
+    return -1;
+ 62f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 634:	eb 68                	jmp    69e <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 636:	8b 45 08             	mov    0x8(%ebp),%eax
+ 639:	8b 40 04             	mov    0x4(%eax),%eax
+ 63c:	83 e0 1f             	and    $0x1f,%eax
+ 63f:	89 c2                	mov    %eax,%edx
+ 641:	89 d0                	mov    %edx,%eax
+ 643:	c1 e0 02             	shl    $0x2,%eax
+ 646:	01 d0                	add    %edx,%eax
+ 648:	c1 e0 02             	shl    $0x2,%eax
+ 64b:	8d 50 10             	lea    0x10(%eax),%edx
+ 64e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 651:	01 d0                	add    %edx,%eax
+ 653:	83 c0 04             	add    $0x4,%eax
+ 656:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 659:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 65c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 65f:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 661:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 664:	8b 55 10             	mov    0x10(%ebp),%edx
+ 667:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 66a:	8b 55 14             	mov    0x14(%ebp),%edx
+ 66d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 670:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 673:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 676:	8b 55 18             	mov    0x18(%ebp),%edx
+ 679:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 67c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 682:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 685:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 68a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68d:	8b 40 04             	mov    0x4(%eax),%eax
+ 690:	8d 50 01             	lea    0x1(%eax),%edx
+ 693:	8b 45 08             	mov    0x8(%ebp),%eax
+ 696:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 699:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 69e:	c9                   	leave
+ 69f:	c3                   	ret
+
+000006a0 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 6a0:	55                   	push   %ebp
+ 6a1:	89 e5                	mov    %esp,%ebp
+ 6a3:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 6a6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 6ab:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6af:	7f 1a                	jg     6cb <ring_submit+0x2b>
+ 6b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b4:	8b 40 10             	mov    0x10(%eax),%eax
+ 6b7:	83 e0 01             	and    $0x1,%eax
+ 6ba:	85 c0                	test   %eax,%eax
+ 6bc:	74 0d                	je     6cb <ring_submit+0x2b>
+ 6be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6c1:	8b 40 10             	mov    0x10(%eax),%eax
+ 6c4:	83 e0 02             	and    $0x2,%eax
+ 6c7:	85 c0                	test   %eax,%eax
+ 6c9:	74 10                	je     6db <ring_submit+0x3b>
+    return ring_enter(min);
+ 6cb:	83 ec 0c             	sub    $0xc,%esp
+ 6ce:	ff 75 0c             	push   0xc(%ebp)
+ 6d1:	e8 83 01 00 00       	call   859 <ring_enter>
+ 6d6:	83 c4 10             	add    $0x10,%esp
+ 6d9:	eb 10                	jmp    6eb <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 6db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6de:	8b 50 0c             	mov    0xc(%eax),%edx
+ 6e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e4:	8b 40 08             	mov    0x8(%eax),%eax
+ 6e7:	29 c2                	sub    %eax,%edx
+ 6e9:	89 d0                	mov    %edx,%eax
+}
+ 6eb:	c9                   	leave
+ 6ec:	c3                   	ret
+
+000006ed <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 6ed:	55                   	push   %ebp
+ 6ee:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 6f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f3:	8b 50 08             	mov    0x8(%eax),%edx
+ 6f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f9:	8b 40 0c             	mov    0xc(%eax),%eax
+ 6fc:	39 c2                	cmp    %eax,%edx
+ 6fe:	75 07                	jne    707 <ring_reap+0x1a>
+    return -1;
+ 700:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 705:	eb 3b                	jmp    742 <ring_reap+0x55>
+  __sync_synchronize();
+ 707:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	8b 40 08             	mov    0x8(%eax),%eax
+ 712:	83 e0 1f             	and    $0x1f,%eax
+ 715:	89 c2                	mov    %eax,%edx
+ 717:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 71a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71d:	83 c2 52             	add    $0x52,%edx
+ 720:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 724:	8b 02                	mov    (%edx),%eax
+ 726:	8b 52 04             	mov    0x4(%edx),%edx
+ 729:	89 01                	mov    %eax,(%ecx)
+ 72b:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 72e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 731:	8b 40 08             	mov    0x8(%eax),%eax
+ 734:	8d 50 01             	lea    0x1(%eax),%edx
+ 737:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73a:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 73d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 742:	5d                   	pop    %ebp
+ 743:	c3                   	ret
+
+00000744 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 744:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 74b:	74 0a                	je     757 <usyscall+0x13>
+  movl %esp, %ecx
+ 74d:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 74f:	ba 56 07 00 00       	mov    $0x756,%edx
+  sysenter
+ 754:	0f 34                	sysenter
+2:
+  ret
+ 756:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 757:	cd 40                	int    $0x40
+  ret
+ 759:	c3                   	ret
+
+0000075a <fork>:
+
+SYSCALL(fork)
+ 75a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 75f:	eb e3                	jmp    744 <usyscall>
+
+00000761 <exit>:
+SYSCALL(exit)
+ 761:	b8 02 00 00 00       	mov    $0x2,%eax
+ 766:	eb dc                	jmp    744 <usyscall>
+
+00000768 <wait>:
+SYSCALL(wait)
+ 768:	b8 03 00 00 00       	mov    $0x3,%eax
+ 76d:	eb d5                	jmp    744 <usyscall>
+
+0000076f <pipe>:
+SYSCALL(pipe)
+ 76f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 774:	eb ce                	jmp    744 <usyscall>
+
+00000776 <read>:
+SYSCALL(read)
+ 776:	b8 05 00 00 00       	mov    $0x5,%eax
+ 77b:	eb c7                	jmp    744 <usyscall>
+
+0000077d <write>:
+SYSCALL(write)
+ 77d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 782:	eb c0                	jmp    744 <usyscall>
+
+00000784 <close>:
+SYSCALL(close)
+ 784:	b8 15 00 00 00       	mov    $0x15,%eax
+ 789:	eb b9                	jmp    744 <usyscall>
+
+0000078b <kill>:
+SYSCALL(kill)
+ 78b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 790:	eb b2                	jmp    744 <usyscall>
+
+00000792 <exec>:
+SYSCALL(exec)
+ 792:	b8 07 00 00 00       	mov    $0x7,%eax
+ 797:	eb ab                	jmp    744 <usyscall>
+
+00000799 <open>:
+SYSCALL(open)
+ 799:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 79e:	eb a4                	jmp    744 <usyscall>
+
+000007a0 <mknod>:
+SYSCALL(mknod)
+ 7a0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7a5:	eb 9d                	jmp    744 <usyscall>
+
+000007a7 <unlink>:
+SYSCALL(unlink)
+ 7a7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7ac:	eb 96                	jmp    744 <usyscall>
+
+000007ae <fstat>:
+SYSCALL(fstat)
+ 7ae:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7b3:	eb 8f                	jmp    744 <usyscall>
+
+000007b5 <link>:
+SYSCALL(link)
+ 7b5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ba:	eb 88                	jmp    744 <usyscall>
+
+000007bc <mkdir>:
+SYSCALL(mkdir)
+ 7bc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7c1:	eb 81                	jmp    744 <usyscall>
+
+000007c3 <chdir>:
+SYSCALL(chdir)
+ 7c3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7c8:	e9 77 ff ff ff       	jmp    744 <usyscall>
+
+000007cd <dup>:
+SYSCALL(dup)
+ 7cd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7d2:	e9 6d ff ff ff       	jmp    744 <usyscall>
+
+000007d7 <getpid>:
+SYSCALL(getpid)
+ 7d7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7dc:	e9 63 ff ff ff       	jmp    744 <usyscall>
+
+000007e1 <sbrk>:
+SYSCALL(sbrk)
+ 7e1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7e6:	e9 59 ff ff ff       	jmp    744 <usyscall>
+
+000007eb <sleep>:
+SYSCALL(sleep)
+ 7eb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7f0:	e9 4f ff ff ff       	jmp    744 <usyscall>
+
+000007f5 <uptime>:
+SYSCALL(uptime)
+ 7f5:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7fa:	e9 45 ff ff ff       	jmp    744 <usyscall>
+
+000007ff <kmstat>:
+SYSCALL(kmstat)
+ 7ff:	b8 16 00 00 00       	mov    $0x16,%eax
+ 804:	e9 3b ff ff ff       	jmp    744 <usyscall>
+
+00000809 <setpriority>:
+SYSCALL(setpriority)
+ 809:	b8 17 00 00 00       	mov    $0x17,%eax
+ 80e:	e9 31 ff ff ff       	jmp    744 <usyscall>
+
+00000813 <clone>:
+SYSCALL(clone)
+ 813:	b8 18 00 00 00       	mov    $0x18,%eax
+ 818:	e9 27 ff ff ff       	jmp    744 <usyscall>
+
+0000081d <join>:
+SYSCALL(join)
+ 81d:	b8 19 00 00 00       	mov    $0x19,%eax
+ 822:	e9 1d ff ff ff       	jmp    744 <usyscall>
+
+00000827 <futex_wait>:
+SYSCALL(futex_wait)
+ 827:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 82c:	e9 13 ff ff ff       	jmp    744 <usyscall>
+
+00000831 <futex_wake>:
+SYSCALL(futex_wake)
+ 831:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 836:	e9 09 ff ff ff       	jmp    744 <usyscall>
+
+0000083b <lockstat>:
+SYSCALL(lockstat)
+ 83b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 840:	e9 ff fe ff ff       	jmp    744 <usyscall>
+
+00000845 <sysstat>:
+SYSCALL(sysstat)
+ 845:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 84a:	e9 f5 fe ff ff       	jmp    744 <usyscall>
+
+0000084f <ring_setup>:
+SYSCALL(ring_setup)
+ 84f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 854:	e9 eb fe ff ff       	jmp    744 <usyscall>
+
+00000859 <ring_enter>:
+SYSCALL(ring_enter)
+ 859:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 85e:	e9 e1 fe ff ff       	jmp    744 <usyscall>
+
+00000863 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 863:	55                   	push   %ebp
+ 864:	89 e5                	mov    %esp,%ebp
+ 866:	83 ec 18             	sub    $0x18,%esp
+ 869:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 86c:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 86f:	83 ec 04             	sub    $0x4,%esp
+ 872:	6a 01                	push   $0x1
+ 874:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 877:	50                   	push   %eax
+ 878:	ff 75 08             	push   0x8(%ebp)
+ 87b:	e8 fd fe ff ff       	call   77d <write>
+ 880:	83 c4 10             	add    $0x10,%esp
+}
+ 883:	90                   	nop
+ 884:	c9                   	leave
+ 885:	c3                   	ret
+
+00000886 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 886:	55                   	push   %ebp
+ 887:	89 e5                	mov    %esp,%ebp
+ 889:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 88c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 893:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 897:	74 17                	je     8b0 <printint+0x2a>
+ 899:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 89d:	79 11                	jns    8b0 <printint+0x2a>
+    neg = 1;
+ 89f:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8a9:	f7 d8                	neg    %eax
+ 8ab:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8ae:	eb 06                	jmp    8b6 <printint+0x30>
+  } else {
+    x = xx;
+ 8b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8b3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8b6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8bd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8c0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8c3:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8c8:	f7 f1                	div    %ecx
+ 8ca:	89 d1                	mov    %edx,%ecx
+ 8cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8cf:	8d 50 01             	lea    0x1(%eax),%edx
+ 8d2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8d5:	0f b6 91 7c 12 00 00 	movzbl 0x127c(%ecx),%edx
+ 8dc:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8e0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8e6:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8eb:	f7 f1                	div    %ecx
+ 8ed:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8f4:	75 c7                	jne    8bd <printint+0x37>
+  if(neg)
+ 8f6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8fa:	74 2d                	je     929 <printint+0xa3>
+    buf[i++] = '-';
+ 8fc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8ff:	8d 50 01             	lea    0x1(%eax),%edx
+ 902:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 905:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 90a:	eb 1d                	jmp    929 <printint+0xa3>
+    putc(fd, buf[i]);
+ 90c:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 90f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 912:	01 d0                	add    %edx,%eax
+ 914:	0f b6 00             	movzbl (%eax),%eax
+ 917:	0f be c0             	movsbl %al,%eax
+ 91a:	83 ec 08             	sub    $0x8,%esp
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 3d ff ff ff       	call   863 <putc>
+ 926:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 929:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 92d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 931:	79 d9                	jns    90c <printint+0x86>
+}
+ 933:	90                   	nop
+ 934:	90                   	nop
+ 935:	c9                   	leave
+ 936:	c3                   	ret
+
+00000937 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 937:	55                   	push   %ebp
+ 938:	89 e5                	mov    %esp,%ebp
+ 93a:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 93d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 944:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 947:	83 c0 04             	add    $0x4,%eax
+ 94a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 94d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 954:	e9 59 01 00 00       	jmp    ab2 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 959:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 95c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 95f:	01 d0                	add    %edx,%eax
+ 961:	0f b6 00             	movzbl (%eax),%eax
+ 964:	0f be c0             	movsbl %al,%eax
+ 967:	25 ff 00 00 00       	and    $0xff,%eax
+ 96c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 96f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 973:	75 2c                	jne    9a1 <printf+0x6a>
+      if(c == '%'){
+ 975:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 979:	75 0c                	jne    987 <printf+0x50>
+        state = '%';
+ 97b:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 982:	e9 27 01 00 00       	jmp    aae <printf+0x177>
+      } else {
+        putc(fd, c);
+ 987:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 98a:	0f be c0             	movsbl %al,%eax
+ 98d:	83 ec 08             	sub    $0x8,%esp
+ 990:	50                   	push   %eax
+ 991:	ff 75 08             	push   0x8(%ebp)
+ 994:	e8 ca fe ff ff       	call   863 <putc>
+ 999:	83 c4 10             	add    $0x10,%esp
+ 99c:	e9 0d 01 00 00       	jmp    aae <printf+0x177>
+      }
+    } else if(state == '%'){
+ 9a1:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9a5:	0f 85 03 01 00 00    	jne    aae <printf+0x177>
+      if(c == 'd'){
+ 9ab:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9af:	75 1e                	jne    9cf <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b4:	8b 00                	mov    (%eax),%eax
+ 9b6:	6a 01                	push   $0x1
+ 9b8:	6a 0a                	push   $0xa
+ 9ba:	50                   	push   %eax
+ 9bb:	ff 75 08             	push   0x8(%ebp)
+ 9be:	e8 c3 fe ff ff       	call   886 <printint>
+ 9c3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9c6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9ca:	e9 d8 00 00 00       	jmp    aa7 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 9cf:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9d3:	74 06                	je     9db <printf+0xa4>
+ 9d5:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9d9:	75 1e                	jne    9f9 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 9db:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9de:	8b 00                	mov    (%eax),%eax
+ 9e0:	6a 00                	push   $0x0
+ 9e2:	6a 10                	push   $0x10
+ 9e4:	50                   	push   %eax
+ 9e5:	ff 75 08             	push   0x8(%ebp)
+ 9e8:	e8 99 fe ff ff       	call   886 <printint>
+ 9ed:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9f0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9f4:	e9 ae 00 00 00       	jmp    aa7 <printf+0x170>
+      } else if(c == 's'){
+ 9f9:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9fd:	75 43                	jne    a42 <printf+0x10b>
+        s = (char*)*ap;
+ 9ff:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a02:	8b 00                	mov    (%eax),%eax
+ a04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a07:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a0b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a0f:	75 25                	jne    a36 <printf+0xff>
+          s = "(null)";
+ a11:	c7 45 f4 9c 0d 00 00 	movl   $0xd9c,-0xc(%ebp)
+        while(*s != 0){
+ a18:	eb 1c                	jmp    a36 <printf+0xff>
+          putc(fd, *s);
+ a1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a1d:	0f b6 00             	movzbl (%eax),%eax
+ a20:	0f be c0             	movsbl %al,%eax
+ a23:	83 ec 08             	sub    $0x8,%esp
+ a26:	50                   	push   %eax
+ a27:	ff 75 08             	push   0x8(%ebp)
+ a2a:	e8 34 fe ff ff       	call   863 <putc>
+ a2f:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a32:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a39:	0f b6 00             	movzbl (%eax),%eax
+ a3c:	84 c0                	test   %al,%al
+ a3e:	75 da                	jne    a1a <printf+0xe3>
+ a40:	eb 65                	jmp    aa7 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a42:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a46:	75 1d                	jne    a65 <printf+0x12e>
+        putc(fd, *ap);
+ a48:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a4b:	8b 00                	mov    (%eax),%eax
+ a4d:	0f be c0             	movsbl %al,%eax
+ a50:	83 ec 08             	sub    $0x8,%esp
+ a53:	50                   	push   %eax
+ a54:	ff 75 08             	push   0x8(%ebp)
+ a57:	e8 07 fe ff ff       	call   863 <putc>
+ a5c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a5f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a63:	eb 42                	jmp    aa7 <printf+0x170>
+      } else if(c == '%'){
+ a65:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a69:	75 17                	jne    a82 <printf+0x14b>
+        putc(fd, c);
+ a6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a6e:	0f be c0             	movsbl %al,%eax
+ a71:	83 ec 08             	sub    $0x8,%esp
+ a74:	50                   	push   %eax
+ a75:	ff 75 08             	push   0x8(%ebp)
+ a78:	e8 e6 fd ff ff       	call   863 <putc>
+ a7d:	83 c4 10             	add    $0x10,%esp
+ a80:	eb 25                	jmp    aa7 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a82:	83 ec 08             	sub    $0x8,%esp
+ a85:	6a 25                	push   $0x25
+ a87:	ff 75 08             	push   0x8(%ebp)
+ a8a:	e8 d4 fd ff ff       	call   863 <putc>
+ a8f:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a92:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a95:	0f be c0             	movsbl %al,%eax
+ a98:	83 ec 08             	sub    $0x8,%esp
+ a9b:	50                   	push   %eax
+ a9c:	ff 75 08             	push   0x8(%ebp)
+ a9f:	e8 bf fd ff ff       	call   863 <putc>
+ aa4:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ aa7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ aae:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ab2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ab5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ab8:	01 d0                	add    %edx,%eax
+ aba:	0f b6 00             	movzbl (%eax),%eax
+ abd:	84 c0                	test   %al,%al
+ abf:	0f 85 94 fe ff ff    	jne    959 <printf+0x22>
+    }
+  }
+}
+ ac5:	90                   	nop
+ ac6:	90                   	nop
+ ac7:	c9                   	leave
+ ac8:	c3                   	ret
+
+00000ac9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ac9:	55                   	push   %ebp
+ aca:	89 e5                	mov    %esp,%ebp
+ acc:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ acf:	8b 45 08             	mov    0x8(%ebp),%eax
+ ad2:	83 e8 08             	sub    $0x8,%eax
+ ad5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ad8:	a1 a8 14 00 00       	mov    0x14a8,%eax
+ add:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ae0:	eb 24                	jmp    b06 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ae2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae5:	8b 00                	mov    (%eax),%eax
+ ae7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ aea:	72 12                	jb     afe <free+0x35>
+ aec:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aef:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ af2:	72 24                	jb     b18 <free+0x4f>
+ af4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af7:	8b 00                	mov    (%eax),%eax
+ af9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ afc:	72 1a                	jb     b18 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ afe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b01:	8b 00                	mov    (%eax),%eax
+ b03:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b06:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b09:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b0c:	73 d4                	jae    ae2 <free+0x19>
+ b0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b11:	8b 00                	mov    (%eax),%eax
+ b13:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b16:	73 ca                	jae    ae2 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b18:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b1b:	8b 40 04             	mov    0x4(%eax),%eax
+ b1e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b25:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b28:	01 c2                	add    %eax,%edx
+ b2a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2d:	8b 00                	mov    (%eax),%eax
+ b2f:	39 c2                	cmp    %eax,%edx
+ b31:	75 24                	jne    b57 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b33:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b36:	8b 50 04             	mov    0x4(%eax),%edx
+ b39:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3c:	8b 00                	mov    (%eax),%eax
+ b3e:	8b 40 04             	mov    0x4(%eax),%eax
+ b41:	01 c2                	add    %eax,%edx
+ b43:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b46:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4c:	8b 00                	mov    (%eax),%eax
+ b4e:	8b 10                	mov    (%eax),%edx
+ b50:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b53:	89 10                	mov    %edx,(%eax)
+ b55:	eb 0a                	jmp    b61 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b5a:	8b 10                	mov    (%eax),%edx
+ b5c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5f:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b64:	8b 40 04             	mov    0x4(%eax),%eax
+ b67:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b6e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b71:	01 d0                	add    %edx,%eax
+ b73:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b76:	75 20                	jne    b98 <free+0xcf>
+    p->s.size += bp->s.size;
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7b:	8b 50 04             	mov    0x4(%eax),%edx
+ b7e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b81:	8b 40 04             	mov    0x4(%eax),%eax
+ b84:	01 c2                	add    %eax,%edx
+ b86:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b89:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b8c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b8f:	8b 10                	mov    (%eax),%edx
+ b91:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b94:	89 10                	mov    %edx,(%eax)
+ b96:	eb 08                	jmp    ba0 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b98:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b9e:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ ba0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba3:	a3 a8 14 00 00       	mov    %eax,0x14a8
+}
+ ba8:	90                   	nop
+ ba9:	c9                   	leave
+ baa:	c3                   	ret
+
+00000bab <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ bab:	55                   	push   %ebp
+ bac:	89 e5                	mov    %esp,%ebp
+ bae:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ bb1:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bb8:	77 07                	ja     bc1 <morecore+0x16>
+    nu = 4096;
+ bba:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bc1:	8b 45 08             	mov    0x8(%ebp),%eax
+ bc4:	c1 e0 03             	shl    $0x3,%eax
+ bc7:	83 ec 0c             	sub    $0xc,%esp
+ bca:	50                   	push   %eax
+ bcb:	e8 11 fc ff ff       	call   7e1 <sbrk>
+ bd0:	83 c4 10             	add    $0x10,%esp
+ bd3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ bd6:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bda:	75 07                	jne    be3 <morecore+0x38>
+    return 0;
+ bdc:	b8 00 00 00 00       	mov    $0x0,%eax
+ be1:	eb 26                	jmp    c09 <morecore+0x5e>
+  hp = (Header*)p;
+ be3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ be9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bec:	8b 55 08             	mov    0x8(%ebp),%edx
+ bef:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ bf2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf5:	83 c0 08             	add    $0x8,%eax
+ bf8:	83 ec 0c             	sub    $0xc,%esp
+ bfb:	50                   	push   %eax
+ bfc:	e8 c8 fe ff ff       	call   ac9 <free>
+ c01:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c04:	a1 a8 14 00 00       	mov    0x14a8,%eax
+}
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
+
+00000c0b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c0b:	55                   	push   %ebp
+ c0c:	89 e5                	mov    %esp,%ebp
+ c0e:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c11:	8b 45 08             	mov    0x8(%ebp),%eax
+ c14:	83 c0 07             	add    $0x7,%eax
+ c17:	c1 e8 03             	shr    $0x3,%eax
+ c1a:	83 c0 01             	add    $0x1,%eax
+ c1d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c20:	a1 a8 14 00 00       	mov    0x14a8,%eax
+ c25:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c28:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c2c:	75 23                	jne    c51 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c2e:	c7 45 f0 a0 14 00 00 	movl   $0x14a0,-0x10(%ebp)
+ c35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c38:	a3 a8 14 00 00       	mov    %eax,0x14a8
+ c3d:	a1 a8 14 00 00       	mov    0x14a8,%eax
+ c42:	a3 a0 14 00 00       	mov    %eax,0x14a0
+    base.s.size = 0;
+ c47:	c7 05 a4 14 00 00 00 	movl   $0x0,0x14a4
+ c4e:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c51:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c54:	8b 00                	mov    (%eax),%eax
+ c56:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5c:	8b 40 04             	mov    0x4(%eax),%eax
+ c5f:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c62:	72 4d                	jb     cb1 <malloc+0xa6>
+      if(p->s.size == nunits)
+ c64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c67:	8b 40 04             	mov    0x4(%eax),%eax
+ c6a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c6d:	75 0c                	jne    c7b <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c6f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c72:	8b 10                	mov    (%eax),%edx
+ c74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c77:	89 10                	mov    %edx,(%eax)
+ c79:	eb 26                	jmp    ca1 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7e:	8b 40 04             	mov    0x4(%eax),%eax
+ c81:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c84:	89 c2                	mov    %eax,%edx
+ c86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c89:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8f:	8b 40 04             	mov    0x4(%eax),%eax
+ c92:	c1 e0 03             	shl    $0x3,%eax
+ c95:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9b:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c9e:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ca1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca4:	a3 a8 14 00 00       	mov    %eax,0x14a8
+      return (void*)(p + 1);
+ ca9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cac:	83 c0 08             	add    $0x8,%eax
+ caf:	eb 3b                	jmp    cec <malloc+0xe1>
+    }
+    if(p == freep)
+ cb1:	a1 a8 14 00 00       	mov    0x14a8,%eax
+ cb6:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cb9:	75 1e                	jne    cd9 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ cbb:	83 ec 0c             	sub    $0xc,%esp
+ cbe:	ff 75 ec             	push   -0x14(%ebp)
+ cc1:	e8 e5 fe ff ff       	call   bab <morecore>
+ cc6:	83 c4 10             	add    $0x10,%esp
+ cc9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ccc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cd0:	75 07                	jne    cd9 <malloc+0xce>
+        return 0;
+ cd2:	b8 00 00 00 00       	mov    $0x0,%eax
+ cd7:	eb 13                	jmp    cec <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdc:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cdf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce2:	8b 00                	mov    (%eax),%eax
+ ce4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ce7:	e9 6d ff ff ff       	jmp    c59 <malloc+0x4e>
+  }
+}
+ cec:	c9                   	leave
+ ced:	c3                   	ret
+
+00000cee <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ cee:	55                   	push   %ebp
+ cef:	89 e5                	mov    %esp,%ebp
+ cf1:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ cf4:	83 ec 0c             	sub    $0xc,%esp
+ cf7:	68 00 10 00 00       	push   $0x1000
+ cfc:	e8 0a ff ff ff       	call   c0b <malloc>
+ d01:	83 c4 10             	add    $0x10,%esp
+ d04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d07:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d0b:	75 07                	jne    d14 <thread_create+0x26>
+    return -1;
+ d0d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d12:	eb 2e                	jmp    d42 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d14:	83 ec 04             	sub    $0x4,%esp
+ d17:	ff 75 f4             	push   -0xc(%ebp)
+ d1a:	ff 75 0c             	push   0xc(%ebp)
+ d1d:	ff 75 08             	push   0x8(%ebp)
+ d20:	e8 ee fa ff ff       	call   813 <clone>
+ d25:	83 c4 10             	add    $0x10,%esp
+ d28:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d2b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d2f:	79 0e                	jns    d3f <thread_create+0x51>
+    free(stack);
+ d31:	83 ec 0c             	sub    $0xc,%esp
+ d34:	ff 75 f4             	push   -0xc(%ebp)
+ d37:	e8 8d fd ff ff       	call   ac9 <free>
+ d3c:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ d42:	c9                   	leave
+ d43:	c3                   	ret
+
+00000d44 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ d44:	55                   	push   %ebp
+ d45:	89 e5                	mov    %esp,%ebp
+ d47:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d4a:	83 ec 0c             	sub    $0xc,%esp
+ d4d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ d50:	50                   	push   %eax
+ d51:	e8 c7 fa ff ff       	call   81d <join>
+ d56:	83 c4 10             	add    $0x10,%esp
+ d59:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d5c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d60:	78 0f                	js     d71 <thread_join+0x2d>
+    free(stack);
+ d62:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d65:	83 ec 0c             	sub    $0xc,%esp
+ d68:	50                   	push   %eax
+ d69:	e8 5b fd ff ff       	call   ac9 <free>
+ d6e:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d71:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d74:	c9                   	leave
+ d75:	c3                   	ret
@@ -0,0 +1,2118 @@
+
+_copybench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <report>:
+
+char buf[MAXBUF];
+
+void
+report(char *what, uint bytes, uint64 t0)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+   6:	8b 45 10             	mov    0x10(%ebp),%eax
+   9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+   c:	8b 45 14             	mov    0x14(%ebp),%eax
+   f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  uint us;
+
+  us = vclock() - t0;
+  12:	e8 bf 07 00 00       	call   7d6 <vclock>
+  17:	89 c2                	mov    %eax,%edx
+  19:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  1c:	29 c2                	sub    %eax,%edx
+  1e:	89 55 f4             	mov    %edx,-0xc(%ebp)
+  if(us == 0)
+  21:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  25:	75 07                	jne    2e <report+0x2e>
+    us = 1;
+  27:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  printf(1, "copybench: %s: %d KB in %d us, %d MB/s\n",
+  2e:	8b 45 0c             	mov    0xc(%ebp),%eax
+  31:	ba 00 00 00 00       	mov    $0x0,%edx
+  36:	f7 75 f4             	divl   -0xc(%ebp)
+  39:	89 c2                	mov    %eax,%edx
+  3b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3e:	c1 e8 0a             	shr    $0xa,%eax
+  41:	83 ec 08             	sub    $0x8,%esp
+  44:	52                   	push   %edx
+  45:	ff 75 f4             	push   -0xc(%ebp)
+  48:	50                   	push   %eax
+  49:	ff 75 08             	push   0x8(%ebp)
+  4c:	68 e8 0f 00 00       	push   $0xfe8
+  51:	6a 01                	push   $0x1
+  53:	e8 50 0b 00 00       	call   ba8 <printf>
+  58:	83 c4 20             	add    $0x20,%esp
+         what, bytes >> 10, us, bytes / us);
+}
+  5b:	90                   	nop
+  5c:	c9                   	leave
+  5d:	c3                   	ret
+
+0000005e <pipebench>:
+
+void
+pipebench(uint total, int bufsize)
+{
+  5e:	55                   	push   %ebp
+  5f:	89 e5                	mov    %esp,%ebp
+  61:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], n, pid;
+  uint done;
+  uint64 t0;
+
+  if(pipe(fds) < 0){
+  64:	83 ec 0c             	sub    $0xc,%esp
+  67:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  6a:	50                   	push   %eax
+  6b:	e8 70 09 00 00       	call   9e0 <pipe>
+  70:	83 c4 10             	add    $0x10,%esp
+  73:	85 c0                	test   %eax,%eax
+  75:	79 17                	jns    8e <pipebench+0x30>
+    printf(2, "copybench: pipe failed\n");
+  77:	83 ec 08             	sub    $0x8,%esp
+  7a:	68 10 10 00 00       	push   $0x1010
+  7f:	6a 02                	push   $0x2
+  81:	e8 22 0b 00 00       	call   ba8 <printf>
+  86:	83 c4 10             	add    $0x10,%esp
+    exit();
+  89:	e8 44 09 00 00       	call   9d2 <exit>
+  }
+  pid = fork();
+  8e:	e8 38 09 00 00       	call   9cb <fork>
+  93:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+  96:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  9a:	79 17                	jns    b3 <pipebench+0x55>
+    printf(2, "copybench: fork failed\n");
+  9c:	83 ec 08             	sub    $0x8,%esp
+  9f:	68 28 10 00 00       	push   $0x1028
+  a4:	6a 02                	push   $0x2
+  a6:	e8 fd 0a 00 00       	call   ba8 <printf>
+  ab:	83 c4 10             	add    $0x10,%esp
+    exit();
+  ae:	e8 1f 09 00 00       	call   9d2 <exit>
+  }
+  if(pid == 0){
+  b3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  b7:	75 5e                	jne    117 <pipebench+0xb9>
+    close(fds[0]);
+  b9:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  bc:	83 ec 0c             	sub    $0xc,%esp
+  bf:	50                   	push   %eax
+  c0:	e8 30 09 00 00       	call   9f5 <close>
+  c5:	83 c4 10             	add    $0x10,%esp
+    for(done = 0; done < total; done += bufsize)
+  c8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  cf:	eb 39                	jmp    10a <pipebench+0xac>
+      if(write(fds[1], buf, bufsize) != bufsize){
+  d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  d4:	83 ec 04             	sub    $0x4,%esp
+  d7:	ff 75 0c             	push   0xc(%ebp)
+  da:	68 20 16 00 00       	push   $0x1620
+  df:	50                   	push   %eax
+  e0:	e8 09 09 00 00       	call   9ee <write>
+  e5:	83 c4 10             	add    $0x10,%esp
+  e8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  eb:	74 17                	je     104 <pipebench+0xa6>
+        printf(2, "copybench: write failed\n");
+  ed:	83 ec 08             	sub    $0x8,%esp
+  f0:	68 40 10 00 00       	push   $0x1040
+  f5:	6a 02                	push   $0x2
+  f7:	e8 ac 0a 00 00       	call   ba8 <printf>
+  fc:	83 c4 10             	add    $0x10,%esp
+        exit();
+  ff:	e8 ce 08 00 00       	call   9d2 <exit>
+    for(done = 0; done < total; done += bufsize)
+ 104:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 107:	01 45 f4             	add    %eax,-0xc(%ebp)
+ 10a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 10d:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 110:	72 bf                	jb     d1 <pipebench+0x73>
+      }
+    exit();
+ 112:	e8 bb 08 00 00       	call   9d2 <exit>
+  }
+  close(fds[1]);
+ 117:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 11a:	83 ec 0c             	sub    $0xc,%esp
+ 11d:	50                   	push   %eax
+ 11e:	e8 d2 08 00 00       	call   9f5 <close>
+ 123:	83 c4 10             	add    $0x10,%esp
+  t0 = vclock();
+ 126:	e8 ab 06 00 00       	call   7d6 <vclock>
+ 12b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 12e:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  done = 0;
+ 131:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fds[0], buf, bufsize)) > 0)
+ 138:	eb 06                	jmp    140 <pipebench+0xe2>
+    done += n;
+ 13a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 13d:	01 45 f4             	add    %eax,-0xc(%ebp)
+  while((n = read(fds[0], buf, bufsize)) > 0)
+ 140:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 143:	83 ec 04             	sub    $0x4,%esp
+ 146:	ff 75 0c             	push   0xc(%ebp)
+ 149:	68 20 16 00 00       	push   $0x1620
+ 14e:	50                   	push   %eax
+ 14f:	e8 93 08 00 00       	call   9e7 <read>
+ 154:	83 c4 10             	add    $0x10,%esp
+ 157:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 15a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 15e:	7f da                	jg     13a <pipebench+0xdc>
+  report("pipe", done, t0);
+ 160:	ff 75 ec             	push   -0x14(%ebp)
+ 163:	ff 75 e8             	push   -0x18(%ebp)
+ 166:	ff 75 f4             	push   -0xc(%ebp)
+ 169:	68 59 10 00 00       	push   $0x1059
+ 16e:	e8 8d fe ff ff       	call   0 <report>
+ 173:	83 c4 10             	add    $0x10,%esp
+  close(fds[0]);
+ 176:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 179:	83 ec 0c             	sub    $0xc,%esp
+ 17c:	50                   	push   %eax
+ 17d:	e8 73 08 00 00       	call   9f5 <close>
+ 182:	83 c4 10             	add    $0x10,%esp
+  wait();
+ 185:	e8 4f 08 00 00       	call   9d9 <wait>
+}
+ 18a:	90                   	nop
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+
+0000018d <filebench>:
+
+void
+filebench(uint total, int bufsize)
+{
+ 18d:	55                   	push   %ebp
+ 18e:	89 e5                	mov    %esp,%ebp
+ 190:	83 ec 28             	sub    $0x28,%esp
+  int fd, n;
+  uint done;
+  uint64 t0;
+
+  if(bufsize > FILESIZE)
+ 193:	81 7d 0c 00 08 00 00 	cmpl   $0x800,0xc(%ebp)
+ 19a:	7e 07                	jle    1a3 <filebench+0x16>
+    bufsize = FILESIZE;
+ 19c:	c7 45 0c 00 08 00 00 	movl   $0x800,0xc(%ebp)
+  if((fd = open("copybench.tmp", O_CREATE|O_RDWR)) < 0 ||
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 02 02 00 00       	push   $0x202
+ 1ab:	68 5e 10 00 00       	push   $0x105e
+ 1b0:	e8 55 08 00 00       	call   a0a <open>
+ 1b5:	83 c4 10             	add    $0x10,%esp
+ 1b8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 1bb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1bf:	78 1f                	js     1e0 <filebench+0x53>
+     write(fd, buf, FILESIZE) != FILESIZE){
+ 1c1:	83 ec 04             	sub    $0x4,%esp
+ 1c4:	68 00 08 00 00       	push   $0x800
+ 1c9:	68 20 16 00 00       	push   $0x1620
+ 1ce:	ff 75 f0             	push   -0x10(%ebp)
+ 1d1:	e8 18 08 00 00       	call   9ee <write>
+ 1d6:	83 c4 10             	add    $0x10,%esp
+  if((fd = open("copybench.tmp", O_CREATE|O_RDWR)) < 0 ||
+ 1d9:	3d 00 08 00 00       	cmp    $0x800,%eax
+ 1de:	74 17                	je     1f7 <filebench+0x6a>
+    printf(2, "copybench: cannot write copybench.tmp\n");
+ 1e0:	83 ec 08             	sub    $0x8,%esp
+ 1e3:	68 6c 10 00 00       	push   $0x106c
+ 1e8:	6a 02                	push   $0x2
+ 1ea:	e8 b9 09 00 00       	call   ba8 <printf>
+ 1ef:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 1f2:	e8 db 07 00 00       	call   9d2 <exit>
+  }
+  close(fd);
+ 1f7:	83 ec 0c             	sub    $0xc,%esp
+ 1fa:	ff 75 f0             	push   -0x10(%ebp)
+ 1fd:	e8 f3 07 00 00       	call   9f5 <close>
+ 202:	83 c4 10             	add    $0x10,%esp
+
+  t0 = vclock();
+ 205:	e8 cc 05 00 00       	call   7d6 <vclock>
+ 20a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+ 20d:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  done = 0;
+ 210:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while(done < total){
+ 217:	eb 65                	jmp    27e <filebench+0xf1>
+    if((fd = open("copybench.tmp", O_RDONLY)) < 0){
+ 219:	83 ec 08             	sub    $0x8,%esp
+ 21c:	6a 00                	push   $0x0
+ 21e:	68 5e 10 00 00       	push   $0x105e
+ 223:	e8 e2 07 00 00       	call   a0a <open>
+ 228:	83 c4 10             	add    $0x10,%esp
+ 22b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 22e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 232:	79 1d                	jns    251 <filebench+0xc4>
+      printf(2, "copybench: open failed\n");
+ 234:	83 ec 08             	sub    $0x8,%esp
+ 237:	68 93 10 00 00       	push   $0x1093
+ 23c:	6a 02                	push   $0x2
+ 23e:	e8 65 09 00 00       	call   ba8 <printf>
+ 243:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 246:	e8 87 07 00 00       	call   9d2 <exit>
+    }
+    while((n = read(fd, buf, bufsize)) > 0)
+      done += n;
+ 24b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 24e:	01 45 f4             	add    %eax,-0xc(%ebp)
+    while((n = read(fd, buf, bufsize)) > 0)
+ 251:	83 ec 04             	sub    $0x4,%esp
+ 254:	ff 75 0c             	push   0xc(%ebp)
+ 257:	68 20 16 00 00       	push   $0x1620
+ 25c:	ff 75 f0             	push   -0x10(%ebp)
+ 25f:	e8 83 07 00 00       	call   9e7 <read>
+ 264:	83 c4 10             	add    $0x10,%esp
+ 267:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+ 26a:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+ 26e:	7f db                	jg     24b <filebench+0xbe>
+    close(fd);
+ 270:	83 ec 0c             	sub    $0xc,%esp
+ 273:	ff 75 f0             	push   -0x10(%ebp)
+ 276:	e8 7a 07 00 00       	call   9f5 <close>
+ 27b:	83 c4 10             	add    $0x10,%esp
+  while(done < total){
+ 27e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 281:	3b 45 08             	cmp    0x8(%ebp),%eax
+ 284:	72 93                	jb     219 <filebench+0x8c>
+  }
+  report("cached file", done, t0);
+ 286:	ff 75 ec             	push   -0x14(%ebp)
+ 289:	ff 75 e8             	push   -0x18(%ebp)
+ 28c:	ff 75 f4             	push   -0xc(%ebp)
+ 28f:	68 ab 10 00 00       	push   $0x10ab
+ 294:	e8 67 fd ff ff       	call   0 <report>
+ 299:	83 c4 10             	add    $0x10,%esp
+  unlink("copybench.tmp");
+ 29c:	83 ec 0c             	sub    $0xc,%esp
+ 29f:	68 5e 10 00 00       	push   $0x105e
+ 2a4:	e8 6f 07 00 00       	call   a18 <unlink>
+ 2a9:	83 c4 10             	add    $0x10,%esp
+}
+ 2ac:	90                   	nop
+ 2ad:	c9                   	leave
+ 2ae:	c3                   	ret
+
+000002af <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2af:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2b3:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2b6:	ff 71 fc             	push   -0x4(%ecx)
+ 2b9:	55                   	push   %ebp
+ 2ba:	89 e5                	mov    %esp,%ebp
+ 2bc:	53                   	push   %ebx
+ 2bd:	51                   	push   %ecx
+ 2be:	83 ec 10             	sub    $0x10,%esp
+ 2c1:	89 cb                	mov    %ecx,%ebx
+  uint total;
+  int bufsize;
+
+  total = 16;
+ 2c3:	c7 45 f4 10 00 00 00 	movl   $0x10,-0xc(%ebp)
+  bufsize = 4096;
+ 2ca:	c7 45 f0 00 10 00 00 	movl   $0x1000,-0x10(%ebp)
+  if(argc > 1)
+ 2d1:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2d4:	7e 17                	jle    2ed <main+0x3e>
+    total = atoi(argv[1]);
+ 2d6:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2d9:	83 c0 04             	add    $0x4,%eax
+ 2dc:	8b 00                	mov    (%eax),%eax
+ 2de:	83 ec 0c             	sub    $0xc,%esp
+ 2e1:	50                   	push   %eax
+ 2e2:	e8 b0 02 00 00       	call   597 <atoi>
+ 2e7:	83 c4 10             	add    $0x10,%esp
+ 2ea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(argc > 2)
+ 2ed:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 2f0:	7e 17                	jle    309 <main+0x5a>
+    bufsize = atoi(argv[2]);
+ 2f2:	8b 43 04             	mov    0x4(%ebx),%eax
+ 2f5:	83 c0 08             	add    $0x8,%eax
+ 2f8:	8b 00                	mov    (%eax),%eax
+ 2fa:	83 ec 0c             	sub    $0xc,%esp
+ 2fd:	50                   	push   %eax
+ 2fe:	e8 94 02 00 00       	call   597 <atoi>
+ 303:	83 c4 10             	add    $0x10,%esp
+ 306:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(total == 0 || total > 1024 || bufsize <= 0 || bufsize > MAXBUF){
+ 309:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 30d:	74 18                	je     327 <main+0x78>
+ 30f:	81 7d f4 00 04 00 00 	cmpl   $0x400,-0xc(%ebp)
+ 316:	77 0f                	ja     327 <main+0x78>
+ 318:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 31c:	7e 09                	jle    327 <main+0x78>
+ 31e:	81 7d f0 00 20 00 00 	cmpl   $0x2000,-0x10(%ebp)
+ 325:	7e 17                	jle    33e <main+0x8f>
+    printf(2, "usage: copybench [megabytes [bufsize]]\n");
+ 327:	83 ec 08             	sub    $0x8,%esp
+ 32a:	68 b8 10 00 00       	push   $0x10b8
+ 32f:	6a 02                	push   $0x2
+ 331:	e8 72 08 00 00       	call   ba8 <printf>
+ 336:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 339:	e8 94 06 00 00       	call   9d2 <exit>
+  }
+  total <<= 20;
+ 33e:	c1 65 f4 14          	shll   $0x14,-0xc(%ebp)
+
+  memset(buf, 'x', sizeof(buf));
+ 342:	83 ec 04             	sub    $0x4,%esp
+ 345:	68 00 20 00 00       	push   $0x2000
+ 34a:	6a 78                	push   $0x78
+ 34c:	68 20 16 00 00       	push   $0x1620
+ 351:	e8 38 01 00 00       	call   48e <memset>
+ 356:	83 c4 10             	add    $0x10,%esp
+  pipebench(total, bufsize);
+ 359:	83 ec 08             	sub    $0x8,%esp
+ 35c:	ff 75 f0             	push   -0x10(%ebp)
+ 35f:	ff 75 f4             	push   -0xc(%ebp)
+ 362:	e8 f7 fc ff ff       	call   5e <pipebench>
+ 367:	83 c4 10             	add    $0x10,%esp
+  filebench(total, bufsize);
+ 36a:	83 ec 08             	sub    $0x8,%esp
+ 36d:	ff 75 f0             	push   -0x10(%ebp)
+ 370:	ff 75 f4             	push   -0xc(%ebp)
+ 373:	e8 15 fe ff ff       	call   18d <filebench>
+ 378:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 37b:	e8 52 06 00 00       	call   9d2 <exit>
+
+00000380 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	57                   	push   %edi
+ 384:	53                   	push   %ebx
+char*
+ 385:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 388:	8b 55 10             	mov    0x10(%ebp),%edx
+ 38b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 38e:	89 cb                	mov    %ecx,%ebx
+ 390:	89 df                	mov    %ebx,%edi
+ 392:	89 d1                	mov    %edx,%ecx
+ 394:	fc                   	cld
+ 395:	f3 aa                	rep stos %al,%es:(%edi)
+ 397:	89 ca                	mov    %ecx,%edx
+ 399:	89 fb                	mov    %edi,%ebx
+ 39b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 39e:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 3a1:	90                   	nop
+ 3a2:	5b                   	pop    %ebx
+ 3a3:	5f                   	pop    %edi
+ 3a4:	5d                   	pop    %ebp
+ 3a5:	c3                   	ret
+
+000003a6 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 3a6:	55                   	push   %ebp
+ 3a7:	89 e5                	mov    %esp,%ebp
+ 3a9:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 3ac:	8b 55 08             	mov    0x8(%ebp),%edx
+ 3af:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3b5:	f0 87 02             	lock xchg %eax,(%edx)
+ 3b8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 3bb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 3be:	c9                   	leave
+ 3bf:	c3                   	ret
+
+000003c0 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 3c0:	55                   	push   %ebp
+ 3c1:	89 e5                	mov    %esp,%ebp
+ 3c3:	53                   	push   %ebx
+ 3c4:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 3c7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 3ca:	8b 55 10             	mov    0x10(%ebp),%edx
+ 3cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3d0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 3d3:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 3d7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 3da:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 3dd:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3e0:	c9                   	leave
+ 3e1:	c3                   	ret
+
+000003e2 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 3e2:	55                   	push   %ebp
+ 3e3:	89 e5                	mov    %esp,%ebp
+ 3e5:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 3e8:	0f 31                	rdtsc
+ 3ea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3ed:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 3f0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 3f3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 3f6:	c9                   	leave
+ 3f7:	c3                   	ret
+
+000003f8 <strcpy>:
+{
+ 3f8:	55                   	push   %ebp
+ 3f9:	89 e5                	mov    %esp,%ebp
+ 3fb:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 3fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 401:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 404:	90                   	nop
+ 405:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 408:	8d 42 01             	lea    0x1(%edx),%eax
+ 40b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 40e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 411:	8d 48 01             	lea    0x1(%eax),%ecx
+ 414:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 417:	0f b6 12             	movzbl (%edx),%edx
+ 41a:	88 10                	mov    %dl,(%eax)
+ 41c:	0f b6 00             	movzbl (%eax),%eax
+ 41f:	84 c0                	test   %al,%al
+ 421:	75 e2                	jne    405 <strcpy+0xd>
+  return os;
+ 423:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 426:	c9                   	leave
+ 427:	c3                   	ret
+
+00000428 <strcmp>:
+{
+ 428:	55                   	push   %ebp
+ 429:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 42b:	eb 08                	jmp    435 <strcmp+0xd>
+    p++, q++;
+ 42d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 431:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 435:	8b 45 08             	mov    0x8(%ebp),%eax
+ 438:	0f b6 00             	movzbl (%eax),%eax
+ 43b:	84 c0                	test   %al,%al
+ 43d:	74 10                	je     44f <strcmp+0x27>
+ 43f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 442:	0f b6 10             	movzbl (%eax),%edx
+ 445:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 448:	0f b6 00             	movzbl (%eax),%eax
+ 44b:	38 c2                	cmp    %al,%dl
+ 44d:	74 de                	je     42d <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 44f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 452:	0f b6 00             	movzbl (%eax),%eax
+ 455:	0f b6 d0             	movzbl %al,%edx
+ 458:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 45b:	0f b6 00             	movzbl (%eax),%eax
+ 45e:	0f b6 c0             	movzbl %al,%eax
+ 461:	29 c2                	sub    %eax,%edx
+ 463:	89 d0                	mov    %edx,%eax
+}
+ 465:	5d                   	pop    %ebp
+ 466:	c3                   	ret
+
+00000467 <strlen>:
+{
+ 467:	55                   	push   %ebp
+ 468:	89 e5                	mov    %esp,%ebp
+ 46a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 46d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 474:	eb 04                	jmp    47a <strlen+0x13>
+ 476:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 47a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 47d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 480:	01 d0                	add    %edx,%eax
+ 482:	0f b6 00             	movzbl (%eax),%eax
+ 485:	84 c0                	test   %al,%al
+ 487:	75 ed                	jne    476 <strlen+0xf>
+  return n;
+ 489:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 48c:	c9                   	leave
+ 48d:	c3                   	ret
+
+0000048e <memset>:
+{
+ 48e:	55                   	push   %ebp
+ 48f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 491:	8b 45 10             	mov    0x10(%ebp),%eax
+ 494:	50                   	push   %eax
+ 495:	ff 75 0c             	push   0xc(%ebp)
+ 498:	ff 75 08             	push   0x8(%ebp)
+ 49b:	e8 e0 fe ff ff       	call   380 <stosb>
+ 4a0:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 4a3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4a6:	c9                   	leave
+ 4a7:	c3                   	ret
+
+000004a8 <strchr>:
+{
+ 4a8:	55                   	push   %ebp
+ 4a9:	89 e5                	mov    %esp,%ebp
+ 4ab:	83 ec 04             	sub    $0x4,%esp
+ 4ae:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4b1:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 4b4:	eb 14                	jmp    4ca <strchr+0x22>
+    if(*s == c)
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b9:	0f b6 00             	movzbl (%eax),%eax
+ 4bc:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 4bf:	75 05                	jne    4c6 <strchr+0x1e>
+      return (char*)s;
+ 4c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c4:	eb 13                	jmp    4d9 <strchr+0x31>
+  for(; *s; s++)
+ 4c6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 4ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cd:	0f b6 00             	movzbl (%eax),%eax
+ 4d0:	84 c0                	test   %al,%al
+ 4d2:	75 e2                	jne    4b6 <strchr+0xe>
+  return 0;
+ 4d4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 4d9:	c9                   	leave
+ 4da:	c3                   	ret
+
+000004db <gets>:
+{
+ 4db:	55                   	push   %ebp
+ 4dc:	89 e5                	mov    %esp,%ebp
+ 4de:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 4e1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 4e8:	eb 42                	jmp    52c <gets+0x51>
+    cc = read(0, &c, 1);
+ 4ea:	83 ec 04             	sub    $0x4,%esp
+ 4ed:	6a 01                	push   $0x1
+ 4ef:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 4f2:	50                   	push   %eax
+ 4f3:	6a 00                	push   $0x0
+ 4f5:	e8 ed 04 00 00       	call   9e7 <read>
+ 4fa:	83 c4 10             	add    $0x10,%esp
+ 4fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 500:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 504:	7e 33                	jle    539 <gets+0x5e>
+    buf[i++] = c;
+ 506:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 509:	8d 50 01             	lea    0x1(%eax),%edx
+ 50c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 50f:	89 c2                	mov    %eax,%edx
+ 511:	8b 45 08             	mov    0x8(%ebp),%eax
+ 514:	01 c2                	add    %eax,%edx
+ 516:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 51a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 51c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 520:	3c 0a                	cmp    $0xa,%al
+ 522:	74 16                	je     53a <gets+0x5f>
+ 524:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 528:	3c 0d                	cmp    $0xd,%al
+ 52a:	74 0e                	je     53a <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 52c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 52f:	83 c0 01             	add    $0x1,%eax
+ 532:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 535:	7f b3                	jg     4ea <gets+0xf>
+ 537:	eb 01                	jmp    53a <gets+0x5f>
+      break;
+ 539:	90                   	nop
+  buf[i] = '\0';
+ 53a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 53d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 540:	01 d0                	add    %edx,%eax
+ 542:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 545:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 548:	c9                   	leave
+ 549:	c3                   	ret
+
+0000054a <stat>:
+{
+ 54a:	55                   	push   %ebp
+ 54b:	89 e5                	mov    %esp,%ebp
+ 54d:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 550:	83 ec 08             	sub    $0x8,%esp
+ 553:	6a 00                	push   $0x0
+ 555:	ff 75 08             	push   0x8(%ebp)
+ 558:	e8 ad 04 00 00       	call   a0a <open>
+ 55d:	83 c4 10             	add    $0x10,%esp
+ 560:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 563:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 567:	79 07                	jns    570 <stat+0x26>
+    return -1;
+ 569:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 56e:	eb 25                	jmp    595 <stat+0x4b>
+  r = fstat(fd, st);
+ 570:	83 ec 08             	sub    $0x8,%esp
+ 573:	ff 75 0c             	push   0xc(%ebp)
+ 576:	ff 75 f4             	push   -0xc(%ebp)
+ 579:	e8 a1 04 00 00       	call   a1f <fstat>
+ 57e:	83 c4 10             	add    $0x10,%esp
+ 581:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 584:	83 ec 0c             	sub    $0xc,%esp
+ 587:	ff 75 f4             	push   -0xc(%ebp)
+ 58a:	e8 66 04 00 00       	call   9f5 <close>
+ 58f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 592:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 595:	c9                   	leave
+ 596:	c3                   	ret
+
+00000597 <atoi>:
+{
+ 597:	55                   	push   %ebp
+ 598:	89 e5                	mov    %esp,%ebp
+ 59a:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 59d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 5a4:	eb 25                	jmp    5cb <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 5a6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 5a9:	89 d0                	mov    %edx,%eax
+ 5ab:	c1 e0 02             	shl    $0x2,%eax
+ 5ae:	01 d0                	add    %edx,%eax
+ 5b0:	01 c0                	add    %eax,%eax
+ 5b2:	89 c1                	mov    %eax,%ecx
+ 5b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b7:	8d 50 01             	lea    0x1(%eax),%edx
+ 5ba:	89 55 08             	mov    %edx,0x8(%ebp)
+ 5bd:	0f b6 00             	movzbl (%eax),%eax
+ 5c0:	0f be c0             	movsbl %al,%eax
+ 5c3:	01 c8                	add    %ecx,%eax
+ 5c5:	83 e8 30             	sub    $0x30,%eax
+ 5c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 5cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ce:	0f b6 00             	movzbl (%eax),%eax
+ 5d1:	3c 2f                	cmp    $0x2f,%al
+ 5d3:	7e 0a                	jle    5df <atoi+0x48>
+ 5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d8:	0f b6 00             	movzbl (%eax),%eax
+ 5db:	3c 39                	cmp    $0x39,%al
+ 5dd:	7e c7                	jle    5a6 <atoi+0xf>
+  return n;
+ 5df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5e2:	c9                   	leave
+ 5e3:	c3                   	ret
+
+000005e4 <memmove>:
+{
+ 5e4:	55                   	push   %ebp
+ 5e5:	89 e5                	mov    %esp,%ebp
+ 5e7:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 5ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ed:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 5f0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5f3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 5f6:	eb 17                	jmp    60f <memmove+0x2b>
+    *dst++ = *src++;
+ 5f8:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 5fb:	8d 42 01             	lea    0x1(%edx),%eax
+ 5fe:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 601:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 604:	8d 48 01             	lea    0x1(%eax),%ecx
+ 607:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 60a:	0f b6 12             	movzbl (%edx),%edx
+ 60d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 60f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 612:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 615:	89 55 10             	mov    %edx,0x10(%ebp)
+ 618:	85 c0                	test   %eax,%eax
+ 61a:	7f dc                	jg     5f8 <memmove+0x14>
+  return vdst;
+ 61c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+
+00000621 <mutex_init>:
+{
+ 621:	55                   	push   %ebp
+ 622:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 624:	8b 45 08             	mov    0x8(%ebp),%eax
+ 627:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 62d:	90                   	nop
+ 62e:	5d                   	pop    %ebp
+ 62f:	c3                   	ret
+
+00000630 <mutex_lock>:
+{
+ 630:	55                   	push   %ebp
+ 631:	89 e5                	mov    %esp,%ebp
+ 633:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 636:	8b 45 08             	mov    0x8(%ebp),%eax
+ 639:	6a 01                	push   $0x1
+ 63b:	6a 00                	push   $0x0
+ 63d:	50                   	push   %eax
+ 63e:	e8 7d fd ff ff       	call   3c0 <cmpxchg>
+ 643:	83 c4 0c             	add    $0xc,%esp
+ 646:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 649:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 64d:	74 46                	je     695 <mutex_lock+0x65>
+  if(c != 2)
+ 64f:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 653:	74 38                	je     68d <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 655:	8b 45 08             	mov    0x8(%ebp),%eax
+ 658:	6a 02                	push   $0x2
+ 65a:	50                   	push   %eax
+ 65b:	e8 46 fd ff ff       	call   3a6 <xchg>
+ 660:	83 c4 08             	add    $0x8,%esp
+ 663:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 666:	eb 25                	jmp    68d <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 668:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66b:	83 ec 08             	sub    $0x8,%esp
+ 66e:	6a 02                	push   $0x2
+ 670:	50                   	push   %eax
+ 671:	e8 22 04 00 00       	call   a98 <futex_wait>
+ 676:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 679:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67c:	83 ec 08             	sub    $0x8,%esp
+ 67f:	6a 02                	push   $0x2
+ 681:	50                   	push   %eax
+ 682:	e8 1f fd ff ff       	call   3a6 <xchg>
+ 687:	83 c4 10             	add    $0x10,%esp
+ 68a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 68d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 691:	75 d5                	jne    668 <mutex_lock+0x38>
+ 693:	eb 01                	jmp    696 <mutex_lock+0x66>
+    return;
+ 695:	90                   	nop
+}
+ 696:	c9                   	leave
+ 697:	c3                   	ret
+
+00000698 <mutex_unlock>:
+{
+ 698:	55                   	push   %ebp
+ 699:	89 e5                	mov    %esp,%ebp
+ 69b:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 69e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a1:	6a 00                	push   $0x0
+ 6a3:	50                   	push   %eax
+ 6a4:	e8 fd fc ff ff       	call   3a6 <xchg>
+ 6a9:	83 c4 08             	add    $0x8,%esp
+ 6ac:	83 f8 02             	cmp    $0x2,%eax
+ 6af:	75 11                	jne    6c2 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 6b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b4:	83 ec 08             	sub    $0x8,%esp
+ 6b7:	6a 01                	push   $0x1
+ 6b9:	50                   	push   %eax
+ 6ba:	e8 e3 03 00 00       	call   aa2 <futex_wake>
+ 6bf:	83 c4 10             	add    $0x10,%esp
+}
+ 6c2:	90                   	nop
+ 6c3:	c9                   	leave
+ 6c4:	c3                   	ret
+
+000006c5 <cond_init>:
+{
+ 6c5:	55                   	push   %ebp
+ 6c6:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 6d1:	90                   	nop
+ 6d2:	5d                   	pop    %ebp
+ 6d3:	c3                   	ret
+
+000006d4 <cond_wait>:
+{
+ 6d4:	55                   	push   %ebp
+ 6d5:	89 e5                	mov    %esp,%ebp
+ 6d7:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 6da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6dd:	8b 00                	mov    (%eax),%eax
+ 6df:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 6e2:	83 ec 0c             	sub    $0xc,%esp
+ 6e5:	ff 75 0c             	push   0xc(%ebp)
+ 6e8:	e8 ab ff ff ff       	call   698 <mutex_unlock>
+ 6ed:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 6f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f3:	83 ec 08             	sub    $0x8,%esp
+ 6f6:	ff 75 f4             	push   -0xc(%ebp)
+ 6f9:	50                   	push   %eax
+ 6fa:	e8 99 03 00 00       	call   a98 <futex_wait>
+ 6ff:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 702:	eb 11                	jmp    715 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 704:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 707:	83 ec 08             	sub    $0x8,%esp
+ 70a:	6a 02                	push   $0x2
+ 70c:	50                   	push   %eax
+ 70d:	e8 86 03 00 00       	call   a98 <futex_wait>
+ 712:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 715:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 718:	83 ec 08             	sub    $0x8,%esp
+ 71b:	6a 02                	push   $0x2
+ 71d:	50                   	push   %eax
+ 71e:	e8 83 fc ff ff       	call   3a6 <xchg>
+ 723:	83 c4 10             	add    $0x10,%esp
+ 726:	85 c0                	test   %eax,%eax
+ 728:	75 da                	jne    704 <cond_wait+0x30>
+}
+ 72a:	90                   	nop
+ 72b:	90                   	nop
+ 72c:	c9                   	leave
+ 72d:	c3                   	ret
+
+0000072e <condbump>:
+{
+ 72e:	55                   	push   %ebp
+ 72f:	89 e5                	mov    %esp,%ebp
+ 731:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 734:	8b 45 08             	mov    0x8(%ebp),%eax
+ 737:	8b 00                	mov    (%eax),%eax
+ 739:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 73c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 73f:	8d 50 01             	lea    0x1(%eax),%edx
+ 742:	8b 45 08             	mov    0x8(%ebp),%eax
+ 745:	52                   	push   %edx
+ 746:	ff 75 fc             	push   -0x4(%ebp)
+ 749:	50                   	push   %eax
+ 74a:	e8 71 fc ff ff       	call   3c0 <cmpxchg>
+ 74f:	83 c4 0c             	add    $0xc,%esp
+ 752:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 755:	75 dd                	jne    734 <condbump+0x6>
+}
+ 757:	90                   	nop
+ 758:	90                   	nop
+ 759:	c9                   	leave
+ 75a:	c3                   	ret
+
+0000075b <cond_signal>:
+{
+ 75b:	55                   	push   %ebp
+ 75c:	89 e5                	mov    %esp,%ebp
+ 75e:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 761:	ff 75 08             	push   0x8(%ebp)
+ 764:	e8 c5 ff ff ff       	call   72e <condbump>
+ 769:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 76c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76f:	83 ec 08             	sub    $0x8,%esp
+ 772:	6a 01                	push   $0x1
+ 774:	50                   	push   %eax
+ 775:	e8 28 03 00 00       	call   aa2 <futex_wake>
+ 77a:	83 c4 10             	add    $0x10,%esp
+}
+ 77d:	90                   	nop
+ 77e:	c9                   	leave
+ 77f:	c3                   	ret
+
+00000780 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 786:	ff 75 08             	push   0x8(%ebp)
+ 789:	e8 a0 ff ff ff       	call   72e <condbump>
+ 78e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 791:	8b 45 08             	mov    0x8(%ebp),%eax
+ 794:	83 ec 08             	sub    $0x8,%esp
+ 797:	68 ff ff ff 7f       	push   $0x7fffffff
+ 79c:	50                   	push   %eax
+ 79d:	e8 00 03 00 00       	call   aa2 <futex_wake>
+ 7a2:	83 c4 10             	add    $0x10,%esp
+}
+ 7a5:	90                   	nop
+ 7a6:	c9                   	leave
+ 7a7:	c3                   	ret
+
+000007a8 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 7a8:	55                   	push   %ebp
+ 7a9:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 7ab:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 7b0:	8b 00                	mov    (%eax),%eax
+}
+ 7b2:	5d                   	pop    %ebp
+ 7b3:	c3                   	ret
+
+000007b4 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 7b4:	55                   	push   %ebp
+ 7b5:	89 e5                	mov    %esp,%ebp
+ 7b7:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 7ba:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 7bf:	8b 00                	mov    (%eax),%eax
+ 7c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 7c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 7c8:	74 05                	je     7cf <vgetpid+0x1b>
+    return pid;
+ 7ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7cd:	eb 05                	jmp    7d4 <vgetpid+0x20>
+  return getpid();
+ 7cf:	e8 74 02 00 00       	call   a48 <getpid>
+}
+ 7d4:	c9                   	leave
+ 7d5:	c3                   	ret
+
+000007d6 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 7d6:	55                   	push   %ebp
+ 7d7:	89 e5                	mov    %esp,%ebp
+ 7d9:	57                   	push   %edi
+ 7da:	56                   	push   %esi
+ 7db:	53                   	push   %ebx
+ 7dc:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 7df:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 7e6:	e8 f7 fb ff ff       	call   3e2 <rdtsc>
+ 7eb:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 7ee:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 7f1:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 7f4:	29 c8                	sub    %ecx,%eax
+ 7f6:	19 da                	sbb    %ebx,%edx
+ 7f8:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 7fb:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 7fe:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 801:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 804:	89 d0                	mov    %edx,%eax
+ 806:	31 d2                	xor    %edx,%edx
+ 808:	89 c1                	mov    %eax,%ecx
+ 80a:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 80f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 812:	8b 40 04             	mov    0x4(%eax),%eax
+ 815:	ba 00 00 00 00       	mov    $0x0,%edx
+ 81a:	89 df                	mov    %ebx,%edi
+ 81c:	0f af f8             	imul   %eax,%edi
+ 81f:	89 d6                	mov    %edx,%esi
+ 821:	0f af f1             	imul   %ecx,%esi
+ 824:	01 f7                	add    %esi,%edi
+ 826:	f7 e1                	mul    %ecx
+ 828:	89 c1                	mov    %eax,%ecx
+ 82a:	89 d3                	mov    %edx,%ebx
+ 82c:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 82f:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 831:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 834:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 837:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 83a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 841:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 844:	8b 40 04             	mov    0x4(%eax),%eax
+ 847:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 84a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 851:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 854:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 857:	89 d7                	mov    %edx,%edi
+ 859:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 85c:	0f af fe             	imul   %esi,%edi
+ 85f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 862:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 865:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 868:	0f af f0             	imul   %eax,%esi
+ 86b:	01 f7                	add    %esi,%edi
+ 86d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 870:	f7 65 d8             	mull   -0x28(%ebp)
+ 873:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 876:	89 f2                	mov    %esi,%edx
+ 878:	89 d0                	mov    %edx,%eax
+ 87a:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 87c:	01 c8                	add    %ecx,%eax
+ 87e:	11 da                	adc    %ebx,%edx
+}
+ 880:	83 c4 24             	add    $0x24,%esp
+ 883:	5b                   	pop    %ebx
+ 884:	5e                   	pop    %esi
+ 885:	5f                   	pop    %edi
+ 886:	5d                   	pop    %ebp
+ 887:	c3                   	ret
+
+00000888 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 888:	55                   	push   %ebp
+ 889:	89 e5                	mov    %esp,%ebp
+ 88b:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 88e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 891:	8b 50 04             	mov    0x4(%eax),%edx
+ 894:	8b 45 08             	mov    0x8(%ebp),%eax
+ 897:	8b 00                	mov    (%eax),%eax
+ 899:	29 c2                	sub    %eax,%edx
+ 89b:	83 fa 1f             	cmp    $0x1f,%edx
+ 89e:	76 07                	jbe    8a7 <ring_queue+0x1f>
+    return -1;
+ 8a0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 8a5:	eb 68                	jmp    90f <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 8a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8aa:	8b 40 04             	mov    0x4(%eax),%eax
+ 8ad:	83 e0 1f             	and    $0x1f,%eax
+ 8b0:	89 c2                	mov    %eax,%edx
+ 8b2:	89 d0                	mov    %edx,%eax
+ 8b4:	c1 e0 02             	shl    $0x2,%eax
+ 8b7:	01 d0                	add    %edx,%eax
+ 8b9:	c1 e0 02             	shl    $0x2,%eax
+ 8bc:	8d 50 10             	lea    0x10(%eax),%edx
+ 8bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c2:	01 d0                	add    %edx,%eax
+ 8c4:	83 c0 04             	add    $0x4,%eax
+ 8c7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 8ca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8cd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8d0:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 8d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8d5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 8d8:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 8db:	8b 55 14             	mov    0x14(%ebp),%edx
+ 8de:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e1:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 8e4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8e7:	8b 55 18             	mov    0x18(%ebp),%edx
+ 8ea:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 8ed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8f0:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 8f3:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 8f6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 8fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8fe:	8b 40 04             	mov    0x4(%eax),%eax
+ 901:	8d 50 01             	lea    0x1(%eax),%edx
+ 904:	8b 45 08             	mov    0x8(%ebp),%eax
+ 907:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 90a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 90f:	c9                   	leave
+ 910:	c3                   	ret
+
+00000911 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 911:	55                   	push   %ebp
+ 912:	89 e5                	mov    %esp,%ebp
+ 914:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 917:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 91c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 920:	7f 1a                	jg     93c <ring_submit+0x2b>
+ 922:	8b 45 08             	mov    0x8(%ebp),%eax
+ 925:	8b 40 10             	mov    0x10(%eax),%eax
+ 928:	83 e0 01             	and    $0x1,%eax
+ 92b:	85 c0                	test   %eax,%eax
+ 92d:	74 0d                	je     93c <ring_submit+0x2b>
+ 92f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 932:	8b 40 10             	mov    0x10(%eax),%eax
+ 935:	83 e0 02             	and    $0x2,%eax
+ 938:	85 c0                	test   %eax,%eax
+ 93a:	74 10                	je     94c <ring_submit+0x3b>
+    return ring_enter(min);
+ 93c:	83 ec 0c             	sub    $0xc,%esp
+ 93f:	ff 75 0c             	push   0xc(%ebp)
+ 942:	e8 83 01 00 00       	call   aca <ring_enter>
+ 947:	83 c4 10             	add    $0x10,%esp
+ 94a:	eb 10                	jmp    95c <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 94c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94f:	8b 50 0c             	mov    0xc(%eax),%edx
+ 952:	8b 45 08             	mov    0x8(%ebp),%eax
+ 955:	8b 40 08             	mov    0x8(%eax),%eax
+ 958:	29 c2                	sub    %eax,%edx
+ 95a:	89 d0                	mov    %edx,%eax
+}
+ 95c:	c9                   	leave
+ 95d:	c3                   	ret
+
+0000095e <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 95e:	55                   	push   %ebp
+ 95f:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 961:	8b 45 08             	mov    0x8(%ebp),%eax
+ 964:	8b 50 08             	mov    0x8(%eax),%edx
+ 967:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96a:	8b 40 0c             	mov    0xc(%eax),%eax
+ 96d:	39 c2                	cmp    %eax,%edx
+ 96f:	75 07                	jne    978 <ring_reap+0x1a>
+    return -1;
+ 971:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 976:	eb 3b                	jmp    9b3 <ring_reap+0x55>
+  __sync_synchronize();
+ 978:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 97d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 980:	8b 40 08             	mov    0x8(%eax),%eax
+ 983:	83 e0 1f             	and    $0x1f,%eax
+ 986:	89 c2                	mov    %eax,%edx
+ 988:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 98b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 98e:	83 c2 52             	add    $0x52,%edx
+ 991:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 995:	8b 02                	mov    (%edx),%eax
+ 997:	8b 52 04             	mov    0x4(%edx),%edx
+ 99a:	89 01                	mov    %eax,(%ecx)
+ 99c:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 99f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9a2:	8b 40 08             	mov    0x8(%eax),%eax
+ 9a5:	8d 50 01             	lea    0x1(%eax),%edx
+ 9a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ab:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 9ae:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 9b3:	5d                   	pop    %ebp
+ 9b4:	c3                   	ret
+
+000009b5 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 9b5:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 9bc:	74 0a                	je     9c8 <usyscall+0x13>
+  movl %esp, %ecx
+ 9be:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 9c0:	ba c7 09 00 00       	mov    $0x9c7,%edx
+  sysenter
+ 9c5:	0f 34                	sysenter
+2:
+  ret
+ 9c7:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 9c8:	cd 40                	int    $0x40
+  ret
+ 9ca:	c3                   	ret
+
+000009cb <fork>:
+
+SYSCALL(fork)
+ 9cb:	b8 01 00 00 00       	mov    $0x1,%eax
+ 9d0:	eb e3                	jmp    9b5 <usyscall>
+
+000009d2 <exit>:
+SYSCALL(exit)
+ 9d2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 9d7:	eb dc                	jmp    9b5 <usyscall>
+
+000009d9 <wait>:
+SYSCALL(wait)
+ 9d9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 9de:	eb d5                	jmp    9b5 <usyscall>
+
+000009e0 <pipe>:
+SYSCALL(pipe)
+ 9e0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 9e5:	eb ce                	jmp    9b5 <usyscall>
+
+000009e7 <read>:
+SYSCALL(read)
+ 9e7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 9ec:	eb c7                	jmp    9b5 <usyscall>
+
+000009ee <write>:
+SYSCALL(write)
+ 9ee:	b8 10 00 00 00       	mov    $0x10,%eax
+ 9f3:	eb c0                	jmp    9b5 <usyscall>
+
+000009f5 <close>:
+SYSCALL(close)
+ 9f5:	b8 15 00 00 00       	mov    $0x15,%eax
+ 9fa:	eb b9                	jmp    9b5 <usyscall>
+
+000009fc <kill>:
+SYSCALL(kill)
+ 9fc:	b8 06 00 00 00       	mov    $0x6,%eax
+ a01:	eb b2                	jmp    9b5 <usyscall>
+
+00000a03 <exec>:
+SYSCALL(exec)
+ a03:	b8 07 00 00 00       	mov    $0x7,%eax
+ a08:	eb ab                	jmp    9b5 <usyscall>
+
+00000a0a <open>:
+SYSCALL(open)
+ a0a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ a0f:	eb a4                	jmp    9b5 <usyscall>
+
+00000a11 <mknod>:
+SYSCALL(mknod)
+ a11:	b8 11 00 00 00       	mov    $0x11,%eax
+ a16:	eb 9d                	jmp    9b5 <usyscall>
+
+00000a18 <unlink>:
+SYSCALL(unlink)
+ a18:	b8 12 00 00 00       	mov    $0x12,%eax
+ a1d:	eb 96                	jmp    9b5 <usyscall>
+
+00000a1f <fstat>:
+SYSCALL(fstat)
+ a1f:	b8 08 00 00 00       	mov    $0x8,%eax
+ a24:	eb 8f                	jmp    9b5 <usyscall>
+
+00000a26 <link>:
+SYSCALL(link)
+ a26:	b8 13 00 00 00       	mov    $0x13,%eax
+ a2b:	eb 88                	jmp    9b5 <usyscall>
+
+00000a2d <mkdir>:
+SYSCALL(mkdir)
+ a2d:	b8 14 00 00 00       	mov    $0x14,%eax
+ a32:	eb 81                	jmp    9b5 <usyscall>
+
+00000a34 <chdir>:
+SYSCALL(chdir)
+ a34:	b8 09 00 00 00       	mov    $0x9,%eax
+ a39:	e9 77 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a3e <dup>:
+SYSCALL(dup)
+ a3e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ a43:	e9 6d ff ff ff       	jmp    9b5 <usyscall>
+
+00000a48 <getpid>:
+SYSCALL(getpid)
+ a48:	b8 0b 00 00 00       	mov    $0xb,%eax
+ a4d:	e9 63 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a52 <sbrk>:
+SYSCALL(sbrk)
+ a52:	b8 0c 00 00 00       	mov    $0xc,%eax
+ a57:	e9 59 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a5c <sleep>:
+SYSCALL(sleep)
+ a5c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ a61:	e9 4f ff ff ff       	jmp    9b5 <usyscall>
+
+00000a66 <uptime>:
+SYSCALL(uptime)
+ a66:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a6b:	e9 45 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a70 <kmstat>:
+SYSCALL(kmstat)
+ a70:	b8 16 00 00 00       	mov    $0x16,%eax
+ a75:	e9 3b ff ff ff       	jmp    9b5 <usyscall>
+
+00000a7a <setpriority>:
+SYSCALL(setpriority)
+ a7a:	b8 17 00 00 00       	mov    $0x17,%eax
+ a7f:	e9 31 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a84 <clone>:
+SYSCALL(clone)
+ a84:	b8 18 00 00 00       	mov    $0x18,%eax
+ a89:	e9 27 ff ff ff       	jmp    9b5 <usyscall>
+
+00000a8e <join>:
+SYSCALL(join)
+ a8e:	b8 19 00 00 00       	mov    $0x19,%eax
+ a93:	e9 1d ff ff ff       	jmp    9b5 <usyscall>
+
+00000a98 <futex_wait>:
+SYSCALL(futex_wait)
+ a98:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a9d:	e9 13 ff ff ff       	jmp    9b5 <usyscall>
+
+00000aa2 <futex_wake>:
+SYSCALL(futex_wake)
+ aa2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ aa7:	e9 09 ff ff ff       	jmp    9b5 <usyscall>
+
+00000aac <lockstat>:
+SYSCALL(lockstat)
+ aac:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ ab1:	e9 ff fe ff ff       	jmp    9b5 <usyscall>
+
+00000ab6 <sysstat>:
+SYSCALL(sysstat)
+ ab6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ abb:	e9 f5 fe ff ff       	jmp    9b5 <usyscall>
+
+00000ac0 <ring_setup>:
+SYSCALL(ring_setup)
+ ac0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ ac5:	e9 eb fe ff ff       	jmp    9b5 <usyscall>
+
+00000aca <ring_enter>:
+SYSCALL(ring_enter)
+ aca:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ acf:	e9 e1 fe ff ff       	jmp    9b5 <usyscall>
+
+00000ad4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ ad4:	55                   	push   %ebp
+ ad5:	89 e5                	mov    %esp,%ebp
+ ad7:	83 ec 18             	sub    $0x18,%esp
+ ada:	8b 45 0c             	mov    0xc(%ebp),%eax
+ add:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ ae0:	83 ec 04             	sub    $0x4,%esp
+ ae3:	6a 01                	push   $0x1
+ ae5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ ae8:	50                   	push   %eax
+ ae9:	ff 75 08             	push   0x8(%ebp)
+ aec:	e8 fd fe ff ff       	call   9ee <write>
+ af1:	83 c4 10             	add    $0x10,%esp
+}
+ af4:	90                   	nop
+ af5:	c9                   	leave
+ af6:	c3                   	ret
+
+00000af7 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ af7:	55                   	push   %ebp
+ af8:	89 e5                	mov    %esp,%ebp
+ afa:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ afd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ b04:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ b08:	74 17                	je     b21 <printint+0x2a>
+ b0a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ b0e:	79 11                	jns    b21 <printint+0x2a>
+    neg = 1;
+ b10:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ b17:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b1a:	f7 d8                	neg    %eax
+ b1c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b1f:	eb 06                	jmp    b27 <printint+0x30>
+  } else {
+    x = xx;
+ b21:	8b 45 0c             	mov    0xc(%ebp),%eax
+ b24:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ b27:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ b2e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ b31:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b34:	ba 00 00 00 00       	mov    $0x0,%edx
+ b39:	f7 f1                	div    %ecx
+ b3b:	89 d1                	mov    %edx,%ecx
+ b3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b40:	8d 50 01             	lea    0x1(%eax),%edx
+ b43:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b46:	0f b6 91 00 16 00 00 	movzbl 0x1600(%ecx),%edx
+ b4d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ b51:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ b54:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b57:	ba 00 00 00 00       	mov    $0x0,%edx
+ b5c:	f7 f1                	div    %ecx
+ b5e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b61:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b65:	75 c7                	jne    b2e <printint+0x37>
+  if(neg)
+ b67:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b6b:	74 2d                	je     b9a <printint+0xa3>
+    buf[i++] = '-';
+ b6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b70:	8d 50 01             	lea    0x1(%eax),%edx
+ b73:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b76:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ b7b:	eb 1d                	jmp    b9a <printint+0xa3>
+    putc(fd, buf[i]);
+ b7d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ b80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b83:	01 d0                	add    %edx,%eax
+ b85:	0f b6 00             	movzbl (%eax),%eax
+ b88:	0f be c0             	movsbl %al,%eax
+ b8b:	83 ec 08             	sub    $0x8,%esp
+ b8e:	50                   	push   %eax
+ b8f:	ff 75 08             	push   0x8(%ebp)
+ b92:	e8 3d ff ff ff       	call   ad4 <putc>
+ b97:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ b9a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ b9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ba2:	79 d9                	jns    b7d <printint+0x86>
+}
+ ba4:	90                   	nop
+ ba5:	90                   	nop
+ ba6:	c9                   	leave
+ ba7:	c3                   	ret
+
+00000ba8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ ba8:	55                   	push   %ebp
+ ba9:	89 e5                	mov    %esp,%ebp
+ bab:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ bae:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ bb5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ bb8:	83 c0 04             	add    $0x4,%eax
+ bbb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ bbe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ bc5:	e9 59 01 00 00       	jmp    d23 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ bca:	8b 55 0c             	mov    0xc(%ebp),%edx
+ bcd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bd0:	01 d0                	add    %edx,%eax
+ bd2:	0f b6 00             	movzbl (%eax),%eax
+ bd5:	0f be c0             	movsbl %al,%eax
+ bd8:	25 ff 00 00 00       	and    $0xff,%eax
+ bdd:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ be0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ be4:	75 2c                	jne    c12 <printf+0x6a>
+      if(c == '%'){
+ be6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ bea:	75 0c                	jne    bf8 <printf+0x50>
+        state = '%';
+ bec:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ bf3:	e9 27 01 00 00       	jmp    d1f <printf+0x177>
+      } else {
+        putc(fd, c);
+ bf8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bfb:	0f be c0             	movsbl %al,%eax
+ bfe:	83 ec 08             	sub    $0x8,%esp
+ c01:	50                   	push   %eax
+ c02:	ff 75 08             	push   0x8(%ebp)
+ c05:	e8 ca fe ff ff       	call   ad4 <putc>
+ c0a:	83 c4 10             	add    $0x10,%esp
+ c0d:	e9 0d 01 00 00       	jmp    d1f <printf+0x177>
+      }
+    } else if(state == '%'){
+ c12:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ c16:	0f 85 03 01 00 00    	jne    d1f <printf+0x177>
+      if(c == 'd'){
+ c1c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ c20:	75 1e                	jne    c40 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ c22:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c25:	8b 00                	mov    (%eax),%eax
+ c27:	6a 01                	push   $0x1
+ c29:	6a 0a                	push   $0xa
+ c2b:	50                   	push   %eax
+ c2c:	ff 75 08             	push   0x8(%ebp)
+ c2f:	e8 c3 fe ff ff       	call   af7 <printint>
+ c34:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c37:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c3b:	e9 d8 00 00 00       	jmp    d18 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ c40:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ c44:	74 06                	je     c4c <printf+0xa4>
+ c46:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ c4a:	75 1e                	jne    c6a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ c4c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c4f:	8b 00                	mov    (%eax),%eax
+ c51:	6a 00                	push   $0x0
+ c53:	6a 10                	push   $0x10
+ c55:	50                   	push   %eax
+ c56:	ff 75 08             	push   0x8(%ebp)
+ c59:	e8 99 fe ff ff       	call   af7 <printint>
+ c5e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c61:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c65:	e9 ae 00 00 00       	jmp    d18 <printf+0x170>
+      } else if(c == 's'){
+ c6a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ c6e:	75 43                	jne    cb3 <printf+0x10b>
+        s = (char*)*ap;
+ c70:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c73:	8b 00                	mov    (%eax),%eax
+ c75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ c78:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ c7c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c80:	75 25                	jne    ca7 <printf+0xff>
+          s = "(null)";
+ c82:	c7 45 f4 e0 10 00 00 	movl   $0x10e0,-0xc(%ebp)
+        while(*s != 0){
+ c89:	eb 1c                	jmp    ca7 <printf+0xff>
+          putc(fd, *s);
+ c8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8e:	0f b6 00             	movzbl (%eax),%eax
+ c91:	0f be c0             	movsbl %al,%eax
+ c94:	83 ec 08             	sub    $0x8,%esp
+ c97:	50                   	push   %eax
+ c98:	ff 75 08             	push   0x8(%ebp)
+ c9b:	e8 34 fe ff ff       	call   ad4 <putc>
+ ca0:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ca3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ ca7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ caa:	0f b6 00             	movzbl (%eax),%eax
+ cad:	84 c0                	test   %al,%al
+ caf:	75 da                	jne    c8b <printf+0xe3>
+ cb1:	eb 65                	jmp    d18 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ cb3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ cb7:	75 1d                	jne    cd6 <printf+0x12e>
+        putc(fd, *ap);
+ cb9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ cbc:	8b 00                	mov    (%eax),%eax
+ cbe:	0f be c0             	movsbl %al,%eax
+ cc1:	83 ec 08             	sub    $0x8,%esp
+ cc4:	50                   	push   %eax
+ cc5:	ff 75 08             	push   0x8(%ebp)
+ cc8:	e8 07 fe ff ff       	call   ad4 <putc>
+ ccd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ cd0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ cd4:	eb 42                	jmp    d18 <printf+0x170>
+      } else if(c == '%'){
+ cd6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ cda:	75 17                	jne    cf3 <printf+0x14b>
+        putc(fd, c);
+ cdc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ cdf:	0f be c0             	movsbl %al,%eax
+ ce2:	83 ec 08             	sub    $0x8,%esp
+ ce5:	50                   	push   %eax
+ ce6:	ff 75 08             	push   0x8(%ebp)
+ ce9:	e8 e6 fd ff ff       	call   ad4 <putc>
+ cee:	83 c4 10             	add    $0x10,%esp
+ cf1:	eb 25                	jmp    d18 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ cf3:	83 ec 08             	sub    $0x8,%esp
+ cf6:	6a 25                	push   $0x25
+ cf8:	ff 75 08             	push   0x8(%ebp)
+ cfb:	e8 d4 fd ff ff       	call   ad4 <putc>
+ d00:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ d03:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ d06:	0f be c0             	movsbl %al,%eax
+ d09:	83 ec 08             	sub    $0x8,%esp
+ d0c:	50                   	push   %eax
+ d0d:	ff 75 08             	push   0x8(%ebp)
+ d10:	e8 bf fd ff ff       	call   ad4 <putc>
+ d15:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ d18:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ d1f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ d23:	8b 55 0c             	mov    0xc(%ebp),%edx
+ d26:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d29:	01 d0                	add    %edx,%eax
+ d2b:	0f b6 00             	movzbl (%eax),%eax
+ d2e:	84 c0                	test   %al,%al
+ d30:	0f 85 94 fe ff ff    	jne    bca <printf+0x22>
+    }
+  }
+}
+ d36:	90                   	nop
+ d37:	90                   	nop
+ d38:	c9                   	leave
+ d39:	c3                   	ret
+
+00000d3a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ d3a:	55                   	push   %ebp
+ d3b:	89 e5                	mov    %esp,%ebp
+ d3d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ d40:	8b 45 08             	mov    0x8(%ebp),%eax
+ d43:	83 e8 08             	sub    $0x8,%eax
+ d46:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d49:	a1 28 36 00 00       	mov    0x3628,%eax
+ d4e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d51:	eb 24                	jmp    d77 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d56:	8b 00                	mov    (%eax),%eax
+ d58:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d5b:	72 12                	jb     d6f <free+0x35>
+ d5d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d60:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d63:	72 24                	jb     d89 <free+0x4f>
+ d65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d68:	8b 00                	mov    (%eax),%eax
+ d6a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d6d:	72 1a                	jb     d89 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d72:	8b 00                	mov    (%eax),%eax
+ d74:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d77:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d7a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d7d:	73 d4                	jae    d53 <free+0x19>
+ d7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d82:	8b 00                	mov    (%eax),%eax
+ d84:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d87:	73 ca                	jae    d53 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d89:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d8c:	8b 40 04             	mov    0x4(%eax),%eax
+ d8f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d96:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d99:	01 c2                	add    %eax,%edx
+ d9b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d9e:	8b 00                	mov    (%eax),%eax
+ da0:	39 c2                	cmp    %eax,%edx
+ da2:	75 24                	jne    dc8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ da4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ da7:	8b 50 04             	mov    0x4(%eax),%edx
+ daa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dad:	8b 00                	mov    (%eax),%eax
+ daf:	8b 40 04             	mov    0x4(%eax),%eax
+ db2:	01 c2                	add    %eax,%edx
+ db4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ db7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ dba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dbd:	8b 00                	mov    (%eax),%eax
+ dbf:	8b 10                	mov    (%eax),%edx
+ dc1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dc4:	89 10                	mov    %edx,(%eax)
+ dc6:	eb 0a                	jmp    dd2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ dc8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dcb:	8b 10                	mov    (%eax),%edx
+ dcd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dd0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ dd2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dd5:	8b 40 04             	mov    0x4(%eax),%eax
+ dd8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ddf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ de2:	01 d0                	add    %edx,%eax
+ de4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ de7:	75 20                	jne    e09 <free+0xcf>
+    p->s.size += bp->s.size;
+ de9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dec:	8b 50 04             	mov    0x4(%eax),%edx
+ def:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ df2:	8b 40 04             	mov    0x4(%eax),%eax
+ df5:	01 c2                	add    %eax,%edx
+ df7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dfa:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ dfd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ e00:	8b 10                	mov    (%eax),%edx
+ e02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e05:	89 10                	mov    %edx,(%eax)
+ e07:	eb 08                	jmp    e11 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ e09:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e0c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ e0f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ e11:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ e14:	a3 28 36 00 00       	mov    %eax,0x3628
+}
+ e19:	90                   	nop
+ e1a:	c9                   	leave
+ e1b:	c3                   	ret
+
+00000e1c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ e1c:	55                   	push   %ebp
+ e1d:	89 e5                	mov    %esp,%ebp
+ e1f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ e22:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ e29:	77 07                	ja     e32 <morecore+0x16>
+    nu = 4096;
+ e2b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ e32:	8b 45 08             	mov    0x8(%ebp),%eax
+ e35:	c1 e0 03             	shl    $0x3,%eax
+ e38:	83 ec 0c             	sub    $0xc,%esp
+ e3b:	50                   	push   %eax
+ e3c:	e8 11 fc ff ff       	call   a52 <sbrk>
+ e41:	83 c4 10             	add    $0x10,%esp
+ e44:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ e47:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ e4b:	75 07                	jne    e54 <morecore+0x38>
+    return 0;
+ e4d:	b8 00 00 00 00       	mov    $0x0,%eax
+ e52:	eb 26                	jmp    e7a <morecore+0x5e>
+  hp = (Header*)p;
+ e54:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e57:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ e5a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e5d:	8b 55 08             	mov    0x8(%ebp),%edx
+ e60:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ e63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e66:	83 c0 08             	add    $0x8,%eax
+ e69:	83 ec 0c             	sub    $0xc,%esp
+ e6c:	50                   	push   %eax
+ e6d:	e8 c8 fe ff ff       	call   d3a <free>
+ e72:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ e75:	a1 28 36 00 00       	mov    0x3628,%eax
+}
+ e7a:	c9                   	leave
+ e7b:	c3                   	ret
+
+00000e7c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e7c:	55                   	push   %ebp
+ e7d:	89 e5                	mov    %esp,%ebp
+ e7f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e82:	8b 45 08             	mov    0x8(%ebp),%eax
+ e85:	83 c0 07             	add    $0x7,%eax
+ e88:	c1 e8 03             	shr    $0x3,%eax
+ e8b:	83 c0 01             	add    $0x1,%eax
+ e8e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ e91:	a1 28 36 00 00       	mov    0x3628,%eax
+ e96:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e99:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e9d:	75 23                	jne    ec2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ e9f:	c7 45 f0 20 36 00 00 	movl   $0x3620,-0x10(%ebp)
+ ea6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ea9:	a3 28 36 00 00       	mov    %eax,0x3628
+ eae:	a1 28 36 00 00       	mov    0x3628,%eax
+ eb3:	a3 20 36 00 00       	mov    %eax,0x3620
+    base.s.size = 0;
+ eb8:	c7 05 24 36 00 00 00 	movl   $0x0,0x3624
+ ebf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ec2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ec5:	8b 00                	mov    (%eax),%eax
+ ec7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ eca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ecd:	8b 40 04             	mov    0x4(%eax),%eax
+ ed0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ed3:	72 4d                	jb     f22 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ed5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ed8:	8b 40 04             	mov    0x4(%eax),%eax
+ edb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ede:	75 0c                	jne    eec <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ee0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ee3:	8b 10                	mov    (%eax),%edx
+ ee5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ee8:	89 10                	mov    %edx,(%eax)
+ eea:	eb 26                	jmp    f12 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ eec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eef:	8b 40 04             	mov    0x4(%eax),%eax
+ ef2:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ef5:	89 c2                	mov    %eax,%edx
+ ef7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ efa:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ efd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f00:	8b 40 04             	mov    0x4(%eax),%eax
+ f03:	c1 e0 03             	shl    $0x3,%eax
+ f06:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ f09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f0c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ f0f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ f12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f15:	a3 28 36 00 00       	mov    %eax,0x3628
+      return (void*)(p + 1);
+ f1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f1d:	83 c0 08             	add    $0x8,%eax
+ f20:	eb 3b                	jmp    f5d <malloc+0xe1>
+    }
+    if(p == freep)
+ f22:	a1 28 36 00 00       	mov    0x3628,%eax
+ f27:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ f2a:	75 1e                	jne    f4a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ f2c:	83 ec 0c             	sub    $0xc,%esp
+ f2f:	ff 75 ec             	push   -0x14(%ebp)
+ f32:	e8 e5 fe ff ff       	call   e1c <morecore>
+ f37:	83 c4 10             	add    $0x10,%esp
+ f3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f3d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f41:	75 07                	jne    f4a <malloc+0xce>
+        return 0;
+ f43:	b8 00 00 00 00       	mov    $0x0,%eax
+ f48:	eb 13                	jmp    f5d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f4a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f4d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f53:	8b 00                	mov    (%eax),%eax
+ f55:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ f58:	e9 6d ff ff ff       	jmp    eca <malloc+0x4e>
+  }
+}
+ f5d:	c9                   	leave
+ f5e:	c3                   	ret
+
+00000f5f <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f5f:	55                   	push   %ebp
+ f60:	89 e5                	mov    %esp,%ebp
+ f62:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ f65:	83 ec 0c             	sub    $0xc,%esp
+ f68:	68 00 10 00 00       	push   $0x1000
+ f6d:	e8 0a ff ff ff       	call   e7c <malloc>
+ f72:	83 c4 10             	add    $0x10,%esp
+ f75:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f78:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f7c:	75 07                	jne    f85 <thread_create+0x26>
+    return -1;
+ f7e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f83:	eb 2e                	jmp    fb3 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ f85:	83 ec 04             	sub    $0x4,%esp
+ f88:	ff 75 f4             	push   -0xc(%ebp)
+ f8b:	ff 75 0c             	push   0xc(%ebp)
+ f8e:	ff 75 08             	push   0x8(%ebp)
+ f91:	e8 ee fa ff ff       	call   a84 <clone>
+ f96:	83 c4 10             	add    $0x10,%esp
+ f99:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f9c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ fa0:	79 0e                	jns    fb0 <thread_create+0x51>
+    free(stack);
+ fa2:	83 ec 0c             	sub    $0xc,%esp
+ fa5:	ff 75 f4             	push   -0xc(%ebp)
+ fa8:	e8 8d fd ff ff       	call   d3a <free>
+ fad:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ fb0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ fb3:	c9                   	leave
+ fb4:	c3                   	ret
+
+00000fb5 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ fb5:	55                   	push   %ebp
+ fb6:	89 e5                	mov    %esp,%ebp
+ fb8:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ fbb:	83 ec 0c             	sub    $0xc,%esp
+ fbe:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ fc1:	50                   	push   %eax
+ fc2:	e8 c7 fa ff ff       	call   a8e <join>
+ fc7:	83 c4 10             	add    $0x10,%esp
+ fca:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ fcd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ fd1:	78 0f                	js     fe2 <thread_join+0x2d>
+    free(stack);
+ fd3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ fd6:	83 ec 0c             	sub    $0xc,%esp
+ fd9:	50                   	push   %eax
+ fda:	e8 5b fd ff ff       	call   d3a <free>
+ fdf:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ fe2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ fe5:	c9                   	leave
+ fe6:	c3                   	ret
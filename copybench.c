@@ -0,0 +1,119 @@
+// Kernel copy bandwidth benchmark: moves data through a pipe,
+// which the kernel copies in from the writer and out to the
+// reader, and reads a small file that stays in the buffer
+// cache, which the kernel copies out of its buffers.  Prints
+// megabytes per second by vclock().
+//
+//   copybench [megabytes [bufsize]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "fcntl.h"
+
+#define MAXBUF   8192
+#define FILESIZE 2048  // few enough blocks to stay cached
+
+char buf[MAXBUF];
+
+void
+report(char *what, uint bytes, uint64 t0)
+{
+  uint us;
+
+  us = vclock() - t0;
+  if(us == 0)
+    us = 1;
+  printf(1, "copybench: %s: %d KB in %d us, %d MB/s\n",
+         what, bytes >> 10, us, bytes / us);
+}
+
+void
+pipebench(uint total, int bufsize)
+{
+  int fds[2], n, pid;
+  uint done;
+  uint64 t0;
+
+  if(pipe(fds) < 0){
+    printf(2, "copybench: pipe failed\n");
+    exit();
+  }
+  pid = fork();
+  if(pid < 0){
+    printf(2, "copybench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    close(fds[0]);
+    for(done = 0; done < total; done += bufsize)
+      if(write(fds[1], buf, bufsize) != bufsize){
+        printf(2, "copybench: write failed\n");
+        exit();
+      }
+    exit();
+  }
+  close(fds[1]);
+  t0 = vclock();
+  done = 0;
+  while((n = read(fds[0], buf, bufsize)) > 0)
+    done += n;
+  report("pipe", done, t0);
+  close(fds[0]);
+  wait();
+}
+
+void
+filebench(uint total, int bufsize)
+{
+  int fd, n;
+  uint done;
+  uint64 t0;
+
+  if(bufsize > FILESIZE)
+    bufsize = FILESIZE;
+  if((fd = open("copybench.tmp", O_CREATE|O_RDWR)) < 0 ||
+     write(fd, buf, FILESIZE) != FILESIZE){
+    printf(2, "copybench: cannot write copybench.tmp\n");
+    exit();
+  }
+  close(fd);
+
+  t0 = vclock();
+  done = 0;
+  while(done < total){
+    if((fd = open("copybench.tmp", O_RDONLY)) < 0){
+      printf(2, "copybench: open failed\n");
+      exit();
+    }
+    while((n = read(fd, buf, bufsize)) > 0)
+      done += n;
+    close(fd);
+  }
+  report("cached file", done, t0);
+  unlink("copybench.tmp");
+}
+
+int
+main(int argc, char *argv[])
+{
+  uint total;
+  int bufsize;
+
+  total = 16;
+  bufsize = 4096;
+  if(argc > 1)
+    total = atoi(argv[1]);
+  if(argc > 2)
+    bufsize = atoi(argv[2]);
+  if(total == 0 || total > 1024 || bufsize <= 0 || bufsize > MAXBUF){
+    printf(2, "usage: copybench [megabytes [bufsize]]\n");
+    exit();
+  }
+  total <<= 20;
+
+  memset(buf, 'x', sizeof(buf));
+  pipebench(total, bufsize);
+  filebench(total, bufsize);
+  exit();
+}
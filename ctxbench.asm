@@ -0,0 +1,1904 @@
+
+_ctxbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 34             	sub    $0x34,%esp
+  11:	89 c8                	mov    %ecx,%eax
+  int n, i, pid, ping[2], pong[2];
+  uint t0, t1;
+  char c;
+
+  n = 10000;
+  13:	c7 45 f4 10 27 00 00 	movl   $0x2710,-0xc(%ebp)
+  if(argc > 1)
+  1a:	83 38 01             	cmpl   $0x1,(%eax)
+  1d:	7e 17                	jle    36 <main+0x36>
+    n = atoi(argv[1]);
+  1f:	8b 40 04             	mov    0x4(%eax),%eax
+  22:	83 c0 04             	add    $0x4,%eax
+  25:	8b 00                	mov    (%eax),%eax
+  27:	83 ec 0c             	sub    $0xc,%esp
+  2a:	50                   	push   %eax
+  2b:	e8 60 03 00 00       	call   390 <atoi>
+  30:	83 c4 10             	add    $0x10,%esp
+  33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+  36:	83 ec 0c             	sub    $0xc,%esp
+  39:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  3c:	50                   	push   %eax
+  3d:	e8 97 07 00 00       	call   7d9 <pipe>
+  42:	83 c4 10             	add    $0x10,%esp
+  45:	85 c0                	test   %eax,%eax
+  47:	78 13                	js     5c <main+0x5c>
+  49:	83 ec 0c             	sub    $0xc,%esp
+  4c:	8d 45 d4             	lea    -0x2c(%ebp),%eax
+  4f:	50                   	push   %eax
+  50:	e8 84 07 00 00       	call   7d9 <pipe>
+  55:	83 c4 10             	add    $0x10,%esp
+  58:	85 c0                	test   %eax,%eax
+  5a:	79 17                	jns    73 <main+0x73>
+    printf(2, "ctxbench: pipe failed\n");
+  5c:	83 ec 08             	sub    $0x8,%esp
+  5f:	68 e0 0d 00 00       	push   $0xde0
+  64:	6a 02                	push   $0x2
+  66:	e8 36 09 00 00       	call   9a1 <printf>
+  6b:	83 c4 10             	add    $0x10,%esp
+    exit();
+  6e:	e8 58 07 00 00       	call   7cb <exit>
+  }
+
+  t0 = uptime();
+  73:	e8 e7 07 00 00       	call   85f <uptime>
+  78:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  pid = fork();
+  7b:	e8 44 07 00 00       	call   7c4 <fork>
+  80:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+  83:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  87:	79 17                	jns    a0 <main+0xa0>
+    printf(2, "ctxbench: fork failed\n");
+  89:	83 ec 08             	sub    $0x8,%esp
+  8c:	68 f7 0d 00 00       	push   $0xdf7
+  91:	6a 02                	push   $0x2
+  93:	e8 09 09 00 00       	call   9a1 <printf>
+  98:	83 c4 10             	add    $0x10,%esp
+    exit();
+  9b:	e8 2b 07 00 00       	call   7cb <exit>
+  }
+  if(pid == 0){
+  a0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  a4:	75 4c                	jne    f2 <main+0xf2>
+    for(i = 0; i < n; i++){
+  a6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  ad:	eb 33                	jmp    e2 <main+0xe2>
+      if(read(ping[0], &c, 1) != 1)
+  af:	8b 45 dc             	mov    -0x24(%ebp),%eax
+  b2:	83 ec 04             	sub    $0x4,%esp
+  b5:	6a 01                	push   $0x1
+  b7:	8d 55 d3             	lea    -0x2d(%ebp),%edx
+  ba:	52                   	push   %edx
+  bb:	50                   	push   %eax
+  bc:	e8 1f 07 00 00       	call   7e0 <read>
+  c1:	83 c4 10             	add    $0x10,%esp
+  c4:	83 f8 01             	cmp    $0x1,%eax
+  c7:	75 23                	jne    ec <main+0xec>
+        break;
+      write(pong[1], &c, 1);
+  c9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+  cc:	83 ec 04             	sub    $0x4,%esp
+  cf:	6a 01                	push   $0x1
+  d1:	8d 55 d3             	lea    -0x2d(%ebp),%edx
+  d4:	52                   	push   %edx
+  d5:	50                   	push   %eax
+  d6:	e8 0c 07 00 00       	call   7e7 <write>
+  db:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < n; i++){
+  de:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  e2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  e5:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  e8:	7c c5                	jl     af <main+0xaf>
+  ea:	eb 01                	jmp    ed <main+0xed>
+        break;
+  ec:	90                   	nop
+    }
+    exit();
+  ed:	e8 d9 06 00 00       	call   7cb <exit>
+  }
+  c = 'x';
+  f2:	c6 45 d3 78          	movb   $0x78,-0x2d(%ebp)
+  for(i = 0; i < n; i++){
+  f6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  fd:	eb 47                	jmp    146 <main+0x146>
+    write(ping[1], &c, 1);
+  ff:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 102:	83 ec 04             	sub    $0x4,%esp
+ 105:	6a 01                	push   $0x1
+ 107:	8d 55 d3             	lea    -0x2d(%ebp),%edx
+ 10a:	52                   	push   %edx
+ 10b:	50                   	push   %eax
+ 10c:	e8 d6 06 00 00       	call   7e7 <write>
+ 111:	83 c4 10             	add    $0x10,%esp
+    if(read(pong[0], &c, 1) != 1){
+ 114:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+ 117:	83 ec 04             	sub    $0x4,%esp
+ 11a:	6a 01                	push   $0x1
+ 11c:	8d 55 d3             	lea    -0x2d(%ebp),%edx
+ 11f:	52                   	push   %edx
+ 120:	50                   	push   %eax
+ 121:	e8 ba 06 00 00       	call   7e0 <read>
+ 126:	83 c4 10             	add    $0x10,%esp
+ 129:	83 f8 01             	cmp    $0x1,%eax
+ 12c:	74 14                	je     142 <main+0x142>
+      printf(2, "ctxbench: short read\n");
+ 12e:	83 ec 08             	sub    $0x8,%esp
+ 131:	68 0e 0e 00 00       	push   $0xe0e
+ 136:	6a 02                	push   $0x2
+ 138:	e8 64 08 00 00       	call   9a1 <printf>
+ 13d:	83 c4 10             	add    $0x10,%esp
+      break;
+ 140:	eb 0c                	jmp    14e <main+0x14e>
+  for(i = 0; i < n; i++){
+ 142:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 146:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 149:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 14c:	7c b1                	jl     ff <main+0xff>
+    }
+  }
+  t1 = uptime();
+ 14e:	e8 0c 07 00 00       	call   85f <uptime>
+ 153:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  wait();
+ 156:	e8 77 06 00 00       	call   7d2 <wait>
+
+  printf(1, "ctxbench: %d round trips in %d ticks\n", i, t1 - t0);
+ 15b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 15e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ 161:	50                   	push   %eax
+ 162:	ff 75 f0             	push   -0x10(%ebp)
+ 165:	68 24 0e 00 00       	push   $0xe24
+ 16a:	6a 01                	push   $0x1
+ 16c:	e8 30 08 00 00       	call   9a1 <printf>
+ 171:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 174:	e8 52 06 00 00       	call   7cb <exit>
+
+00000179 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 179:	55                   	push   %ebp
+ 17a:	89 e5                	mov    %esp,%ebp
+ 17c:	57                   	push   %edi
+ 17d:	53                   	push   %ebx
+char*
+ 17e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 181:	8b 55 10             	mov    0x10(%ebp),%edx
+ 184:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 187:	89 cb                	mov    %ecx,%ebx
+ 189:	89 df                	mov    %ebx,%edi
+ 18b:	89 d1                	mov    %edx,%ecx
+ 18d:	fc                   	cld
+ 18e:	f3 aa                	rep stos %al,%es:(%edi)
+ 190:	89 ca                	mov    %ecx,%edx
+ 192:	89 fb                	mov    %edi,%ebx
+ 194:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 197:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 19a:	90                   	nop
+ 19b:	5b                   	pop    %ebx
+ 19c:	5f                   	pop    %edi
+ 19d:	5d                   	pop    %ebp
+ 19e:	c3                   	ret
+
+0000019f <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 19f:	55                   	push   %ebp
+ 1a0:	89 e5                	mov    %esp,%ebp
+ 1a2:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 1a5:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1a8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ab:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1ae:	f0 87 02             	lock xchg %eax,(%edx)
+ 1b1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 1b4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 1b7:	c9                   	leave
+ 1b8:	c3                   	ret
+
+000001b9 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 1b9:	55                   	push   %ebp
+ 1ba:	89 e5                	mov    %esp,%ebp
+ 1bc:	53                   	push   %ebx
+ 1bd:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 1c0:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 1c3:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1cc:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 1d0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 1d3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 1d6:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1d9:	c9                   	leave
+ 1da:	c3                   	ret
+
+000001db <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 1db:	55                   	push   %ebp
+ 1dc:	89 e5                	mov    %esp,%ebp
+ 1de:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 1e1:	0f 31                	rdtsc
+ 1e3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 1e6:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 1e9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 1ec:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 1ef:	c9                   	leave
+ 1f0:	c3                   	ret
+
+000001f1 <strcpy>:
+{
+ 1f1:	55                   	push   %ebp
+ 1f2:	89 e5                	mov    %esp,%ebp
+ 1f4:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1fa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1fd:	90                   	nop
+ 1fe:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 201:	8d 42 01             	lea    0x1(%edx),%eax
+ 204:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20a:	8d 48 01             	lea    0x1(%eax),%ecx
+ 20d:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 210:	0f b6 12             	movzbl (%edx),%edx
+ 213:	88 10                	mov    %dl,(%eax)
+ 215:	0f b6 00             	movzbl (%eax),%eax
+ 218:	84 c0                	test   %al,%al
+ 21a:	75 e2                	jne    1fe <strcpy+0xd>
+  return os;
+ 21c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 21f:	c9                   	leave
+ 220:	c3                   	ret
+
+00000221 <strcmp>:
+{
+ 221:	55                   	push   %ebp
+ 222:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 224:	eb 08                	jmp    22e <strcmp+0xd>
+    p++, q++;
+ 226:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 22a:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 22e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 231:	0f b6 00             	movzbl (%eax),%eax
+ 234:	84 c0                	test   %al,%al
+ 236:	74 10                	je     248 <strcmp+0x27>
+ 238:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23b:	0f b6 10             	movzbl (%eax),%edx
+ 23e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 241:	0f b6 00             	movzbl (%eax),%eax
+ 244:	38 c2                	cmp    %al,%dl
+ 246:	74 de                	je     226 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 248:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24b:	0f b6 00             	movzbl (%eax),%eax
+ 24e:	0f b6 d0             	movzbl %al,%edx
+ 251:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 254:	0f b6 00             	movzbl (%eax),%eax
+ 257:	0f b6 c0             	movzbl %al,%eax
+ 25a:	29 c2                	sub    %eax,%edx
+ 25c:	89 d0                	mov    %edx,%eax
+}
+ 25e:	5d                   	pop    %ebp
+ 25f:	c3                   	ret
+
+00000260 <strlen>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+ 263:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 266:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 26d:	eb 04                	jmp    273 <strlen+0x13>
+ 26f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 273:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+ 279:	01 d0                	add    %edx,%eax
+ 27b:	0f b6 00             	movzbl (%eax),%eax
+ 27e:	84 c0                	test   %al,%al
+ 280:	75 ed                	jne    26f <strlen+0xf>
+  return n;
+ 282:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 285:	c9                   	leave
+ 286:	c3                   	ret
+
+00000287 <memset>:
+{
+ 287:	55                   	push   %ebp
+ 288:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 28a:	8b 45 10             	mov    0x10(%ebp),%eax
+ 28d:	50                   	push   %eax
+ 28e:	ff 75 0c             	push   0xc(%ebp)
+ 291:	ff 75 08             	push   0x8(%ebp)
+ 294:	e8 e0 fe ff ff       	call   179 <stosb>
+ 299:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 29c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 29f:	c9                   	leave
+ 2a0:	c3                   	ret
+
+000002a1 <strchr>:
+{
+ 2a1:	55                   	push   %ebp
+ 2a2:	89 e5                	mov    %esp,%ebp
+ 2a4:	83 ec 04             	sub    $0x4,%esp
+ 2a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2aa:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2ad:	eb 14                	jmp    2c3 <strchr+0x22>
+    if(*s == c)
+ 2af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b2:	0f b6 00             	movzbl (%eax),%eax
+ 2b5:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2b8:	75 05                	jne    2bf <strchr+0x1e>
+      return (char*)s;
+ 2ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bd:	eb 13                	jmp    2d2 <strchr+0x31>
+  for(; *s; s++)
+ 2bf:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 2c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c6:	0f b6 00             	movzbl (%eax),%eax
+ 2c9:	84 c0                	test   %al,%al
+ 2cb:	75 e2                	jne    2af <strchr+0xe>
+  return 0;
+ 2cd:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2d2:	c9                   	leave
+ 2d3:	c3                   	ret
+
+000002d4 <gets>:
+{
+ 2d4:	55                   	push   %ebp
+ 2d5:	89 e5                	mov    %esp,%ebp
+ 2d7:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2da:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2e1:	eb 42                	jmp    325 <gets+0x51>
+    cc = read(0, &c, 1);
+ 2e3:	83 ec 04             	sub    $0x4,%esp
+ 2e6:	6a 01                	push   $0x1
+ 2e8:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2eb:	50                   	push   %eax
+ 2ec:	6a 00                	push   $0x0
+ 2ee:	e8 ed 04 00 00       	call   7e0 <read>
+ 2f3:	83 c4 10             	add    $0x10,%esp
+ 2f6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2f9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2fd:	7e 33                	jle    332 <gets+0x5e>
+    buf[i++] = c;
+ 2ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 302:	8d 50 01             	lea    0x1(%eax),%edx
+ 305:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 308:	89 c2                	mov    %eax,%edx
+ 30a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30d:	01 c2                	add    %eax,%edx
+ 30f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 313:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 315:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 319:	3c 0a                	cmp    $0xa,%al
+ 31b:	74 16                	je     333 <gets+0x5f>
+ 31d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 321:	3c 0d                	cmp    $0xd,%al
+ 323:	74 0e                	je     333 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 325:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 328:	83 c0 01             	add    $0x1,%eax
+ 32b:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 32e:	7f b3                	jg     2e3 <gets+0xf>
+ 330:	eb 01                	jmp    333 <gets+0x5f>
+      break;
+ 332:	90                   	nop
+  buf[i] = '\0';
+ 333:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 336:	8b 45 08             	mov    0x8(%ebp),%eax
+ 339:	01 d0                	add    %edx,%eax
+ 33b:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 33e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 341:	c9                   	leave
+ 342:	c3                   	ret
+
+00000343 <stat>:
+{
+ 343:	55                   	push   %ebp
+ 344:	89 e5                	mov    %esp,%ebp
+ 346:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 349:	83 ec 08             	sub    $0x8,%esp
+ 34c:	6a 00                	push   $0x0
+ 34e:	ff 75 08             	push   0x8(%ebp)
+ 351:	e8 ad 04 00 00       	call   803 <open>
+ 356:	83 c4 10             	add    $0x10,%esp
+ 359:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 35c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 360:	79 07                	jns    369 <stat+0x26>
+    return -1;
+ 362:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 367:	eb 25                	jmp    38e <stat+0x4b>
+  r = fstat(fd, st);
+ 369:	83 ec 08             	sub    $0x8,%esp
+ 36c:	ff 75 0c             	push   0xc(%ebp)
+ 36f:	ff 75 f4             	push   -0xc(%ebp)
+ 372:	e8 a1 04 00 00       	call   818 <fstat>
+ 377:	83 c4 10             	add    $0x10,%esp
+ 37a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 37d:	83 ec 0c             	sub    $0xc,%esp
+ 380:	ff 75 f4             	push   -0xc(%ebp)
+ 383:	e8 66 04 00 00       	call   7ee <close>
+ 388:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 38b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 38e:	c9                   	leave
+ 38f:	c3                   	ret
+
+00000390 <atoi>:
+{
+ 390:	55                   	push   %ebp
+ 391:	89 e5                	mov    %esp,%ebp
+ 393:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 396:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 39d:	eb 25                	jmp    3c4 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 39f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3a2:	89 d0                	mov    %edx,%eax
+ 3a4:	c1 e0 02             	shl    $0x2,%eax
+ 3a7:	01 d0                	add    %edx,%eax
+ 3a9:	01 c0                	add    %eax,%eax
+ 3ab:	89 c1                	mov    %eax,%ecx
+ 3ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b0:	8d 50 01             	lea    0x1(%eax),%edx
+ 3b3:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3b6:	0f b6 00             	movzbl (%eax),%eax
+ 3b9:	0f be c0             	movsbl %al,%eax
+ 3bc:	01 c8                	add    %ecx,%eax
+ 3be:	83 e8 30             	sub    $0x30,%eax
+ 3c1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c7:	0f b6 00             	movzbl (%eax),%eax
+ 3ca:	3c 2f                	cmp    $0x2f,%al
+ 3cc:	7e 0a                	jle    3d8 <atoi+0x48>
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d1:	0f b6 00             	movzbl (%eax),%eax
+ 3d4:	3c 39                	cmp    $0x39,%al
+ 3d6:	7e c7                	jle    39f <atoi+0xf>
+  return n;
+ 3d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3db:	c9                   	leave
+ 3dc:	c3                   	ret
+
+000003dd <memmove>:
+{
+ 3dd:	55                   	push   %ebp
+ 3de:	89 e5                	mov    %esp,%ebp
+ 3e0:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 3e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ec:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3ef:	eb 17                	jmp    408 <memmove+0x2b>
+    *dst++ = *src++;
+ 3f1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3f4:	8d 42 01             	lea    0x1(%edx),%eax
+ 3f7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3fa:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3fd:	8d 48 01             	lea    0x1(%eax),%ecx
+ 400:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 403:	0f b6 12             	movzbl (%edx),%edx
+ 406:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 408:	8b 45 10             	mov    0x10(%ebp),%eax
+ 40b:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 40e:	89 55 10             	mov    %edx,0x10(%ebp)
+ 411:	85 c0                	test   %eax,%eax
+ 413:	7f dc                	jg     3f1 <memmove+0x14>
+  return vdst;
+ 415:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 418:	c9                   	leave
+ 419:	c3                   	ret
+
+0000041a <mutex_init>:
+{
+ 41a:	55                   	push   %ebp
+ 41b:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 41d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 420:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 426:	90                   	nop
+ 427:	5d                   	pop    %ebp
+ 428:	c3                   	ret
+
+00000429 <mutex_lock>:
+{
+ 429:	55                   	push   %ebp
+ 42a:	89 e5                	mov    %esp,%ebp
+ 42c:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 42f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 432:	6a 01                	push   $0x1
+ 434:	6a 00                	push   $0x0
+ 436:	50                   	push   %eax
+ 437:	e8 7d fd ff ff       	call   1b9 <cmpxchg>
+ 43c:	83 c4 0c             	add    $0xc,%esp
+ 43f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 442:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 446:	74 46                	je     48e <mutex_lock+0x65>
+  if(c != 2)
+ 448:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 44c:	74 38                	je     486 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 44e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 451:	6a 02                	push   $0x2
+ 453:	50                   	push   %eax
+ 454:	e8 46 fd ff ff       	call   19f <xchg>
+ 459:	83 c4 08             	add    $0x8,%esp
+ 45c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 45f:	eb 25                	jmp    486 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 461:	8b 45 08             	mov    0x8(%ebp),%eax
+ 464:	83 ec 08             	sub    $0x8,%esp
+ 467:	6a 02                	push   $0x2
+ 469:	50                   	push   %eax
+ 46a:	e8 22 04 00 00       	call   891 <futex_wait>
+ 46f:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 472:	8b 45 08             	mov    0x8(%ebp),%eax
+ 475:	83 ec 08             	sub    $0x8,%esp
+ 478:	6a 02                	push   $0x2
+ 47a:	50                   	push   %eax
+ 47b:	e8 1f fd ff ff       	call   19f <xchg>
+ 480:	83 c4 10             	add    $0x10,%esp
+ 483:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 486:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 48a:	75 d5                	jne    461 <mutex_lock+0x38>
+ 48c:	eb 01                	jmp    48f <mutex_lock+0x66>
+    return;
+ 48e:	90                   	nop
+}
+ 48f:	c9                   	leave
+ 490:	c3                   	ret
+
+00000491 <mutex_unlock>:
+{
+ 491:	55                   	push   %ebp
+ 492:	89 e5                	mov    %esp,%ebp
+ 494:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 497:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49a:	6a 00                	push   $0x0
+ 49c:	50                   	push   %eax
+ 49d:	e8 fd fc ff ff       	call   19f <xchg>
+ 4a2:	83 c4 08             	add    $0x8,%esp
+ 4a5:	83 f8 02             	cmp    $0x2,%eax
+ 4a8:	75 11                	jne    4bb <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 4aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ad:	83 ec 08             	sub    $0x8,%esp
+ 4b0:	6a 01                	push   $0x1
+ 4b2:	50                   	push   %eax
+ 4b3:	e8 e3 03 00 00       	call   89b <futex_wake>
+ 4b8:	83 c4 10             	add    $0x10,%esp
+}
+ 4bb:	90                   	nop
+ 4bc:	c9                   	leave
+ 4bd:	c3                   	ret
+
+000004be <cond_init>:
+{
+ 4be:	55                   	push   %ebp
+ 4bf:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 4c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c4:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4ca:	90                   	nop
+ 4cb:	5d                   	pop    %ebp
+ 4cc:	c3                   	ret
+
+000004cd <cond_wait>:
+{
+ 4cd:	55                   	push   %ebp
+ 4ce:	89 e5                	mov    %esp,%ebp
+ 4d0:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 4d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d6:	8b 00                	mov    (%eax),%eax
+ 4d8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 4db:	83 ec 0c             	sub    $0xc,%esp
+ 4de:	ff 75 0c             	push   0xc(%ebp)
+ 4e1:	e8 ab ff ff ff       	call   491 <mutex_unlock>
+ 4e6:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 4e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ec:	83 ec 08             	sub    $0x8,%esp
+ 4ef:	ff 75 f4             	push   -0xc(%ebp)
+ 4f2:	50                   	push   %eax
+ 4f3:	e8 99 03 00 00       	call   891 <futex_wait>
+ 4f8:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4fb:	eb 11                	jmp    50e <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 4fd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 500:	83 ec 08             	sub    $0x8,%esp
+ 503:	6a 02                	push   $0x2
+ 505:	50                   	push   %eax
+ 506:	e8 86 03 00 00       	call   891 <futex_wait>
+ 50b:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 50e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 511:	83 ec 08             	sub    $0x8,%esp
+ 514:	6a 02                	push   $0x2
+ 516:	50                   	push   %eax
+ 517:	e8 83 fc ff ff       	call   19f <xchg>
+ 51c:	83 c4 10             	add    $0x10,%esp
+ 51f:	85 c0                	test   %eax,%eax
+ 521:	75 da                	jne    4fd <cond_wait+0x30>
+}
+ 523:	90                   	nop
+ 524:	90                   	nop
+ 525:	c9                   	leave
+ 526:	c3                   	ret
+
+00000527 <condbump>:
+{
+ 527:	55                   	push   %ebp
+ 528:	89 e5                	mov    %esp,%ebp
+ 52a:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 52d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 530:	8b 00                	mov    (%eax),%eax
+ 532:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 535:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 538:	8d 50 01             	lea    0x1(%eax),%edx
+ 53b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53e:	52                   	push   %edx
+ 53f:	ff 75 fc             	push   -0x4(%ebp)
+ 542:	50                   	push   %eax
+ 543:	e8 71 fc ff ff       	call   1b9 <cmpxchg>
+ 548:	83 c4 0c             	add    $0xc,%esp
+ 54b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 54e:	75 dd                	jne    52d <condbump+0x6>
+}
+ 550:	90                   	nop
+ 551:	90                   	nop
+ 552:	c9                   	leave
+ 553:	c3                   	ret
+
+00000554 <cond_signal>:
+{
+ 554:	55                   	push   %ebp
+ 555:	89 e5                	mov    %esp,%ebp
+ 557:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 55a:	ff 75 08             	push   0x8(%ebp)
+ 55d:	e8 c5 ff ff ff       	call   527 <condbump>
+ 562:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 565:	8b 45 08             	mov    0x8(%ebp),%eax
+ 568:	83 ec 08             	sub    $0x8,%esp
+ 56b:	6a 01                	push   $0x1
+ 56d:	50                   	push   %eax
+ 56e:	e8 28 03 00 00       	call   89b <futex_wake>
+ 573:	83 c4 10             	add    $0x10,%esp
+}
+ 576:	90                   	nop
+ 577:	c9                   	leave
+ 578:	c3                   	ret
+
+00000579 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 579:	55                   	push   %ebp
+ 57a:	89 e5                	mov    %esp,%ebp
+ 57c:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 57f:	ff 75 08             	push   0x8(%ebp)
+ 582:	e8 a0 ff ff ff       	call   527 <condbump>
+ 587:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	83 ec 08             	sub    $0x8,%esp
+ 590:	68 ff ff ff 7f       	push   $0x7fffffff
+ 595:	50                   	push   %eax
+ 596:	e8 00 03 00 00       	call   89b <futex_wake>
+ 59b:	83 c4 10             	add    $0x10,%esp
+}
+ 59e:	90                   	nop
+ 59f:	c9                   	leave
+ 5a0:	c3                   	ret
+
+000005a1 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 5a1:	55                   	push   %ebp
+ 5a2:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 5a4:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 5a9:	8b 00                	mov    (%eax),%eax
+}
+ 5ab:	5d                   	pop    %ebp
+ 5ac:	c3                   	ret
+
+000005ad <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 5ad:	55                   	push   %ebp
+ 5ae:	89 e5                	mov    %esp,%ebp
+ 5b0:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 5b3:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 5b8:	8b 00                	mov    (%eax),%eax
+ 5ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 5bd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5c1:	74 05                	je     5c8 <vgetpid+0x1b>
+    return pid;
+ 5c3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 5c6:	eb 05                	jmp    5cd <vgetpid+0x20>
+  return getpid();
+ 5c8:	e8 74 02 00 00       	call   841 <getpid>
+}
+ 5cd:	c9                   	leave
+ 5ce:	c3                   	ret
+
+000005cf <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 5cf:	55                   	push   %ebp
+ 5d0:	89 e5                	mov    %esp,%ebp
+ 5d2:	57                   	push   %edi
+ 5d3:	56                   	push   %esi
+ 5d4:	53                   	push   %ebx
+ 5d5:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 5d8:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 5df:	e8 f7 fb ff ff       	call   1db <rdtsc>
+ 5e4:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 5e7:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 5ea:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 5ed:	29 c8                	sub    %ecx,%eax
+ 5ef:	19 da                	sbb    %ebx,%edx
+ 5f1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5f4:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 5f7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5fa:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5fd:	89 d0                	mov    %edx,%eax
+ 5ff:	31 d2                	xor    %edx,%edx
+ 601:	89 c1                	mov    %eax,%ecx
+ 603:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 608:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 60b:	8b 40 04             	mov    0x4(%eax),%eax
+ 60e:	ba 00 00 00 00       	mov    $0x0,%edx
+ 613:	89 df                	mov    %ebx,%edi
+ 615:	0f af f8             	imul   %eax,%edi
+ 618:	89 d6                	mov    %edx,%esi
+ 61a:	0f af f1             	imul   %ecx,%esi
+ 61d:	01 f7                	add    %esi,%edi
+ 61f:	f7 e1                	mul    %ecx
+ 621:	89 c1                	mov    %eax,%ecx
+ 623:	89 d3                	mov    %edx,%ebx
+ 625:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 628:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 62a:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 62d:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 630:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 633:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 63a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 63d:	8b 40 04             	mov    0x4(%eax),%eax
+ 640:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 643:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 64a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 64d:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 650:	89 d7                	mov    %edx,%edi
+ 652:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 655:	0f af fe             	imul   %esi,%edi
+ 658:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 65b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 65e:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 661:	0f af f0             	imul   %eax,%esi
+ 664:	01 f7                	add    %esi,%edi
+ 666:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 669:	f7 65 d8             	mull   -0x28(%ebp)
+ 66c:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 66f:	89 f2                	mov    %esi,%edx
+ 671:	89 d0                	mov    %edx,%eax
+ 673:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 675:	01 c8                	add    %ecx,%eax
+ 677:	11 da                	adc    %ebx,%edx
+}
+ 679:	83 c4 24             	add    $0x24,%esp
+ 67c:	5b                   	pop    %ebx
+ 67d:	5e                   	pop    %esi
+ 67e:	5f                   	pop    %edi
+ 67f:	5d                   	pop    %ebp
+ 680:	c3                   	ret
+
+00000681 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 681:	55                   	push   %ebp
+ 682:	89 e5                	mov    %esp,%ebp
+ 684:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 687:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68a:	8b 50 04             	mov    0x4(%eax),%edx
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	8b 00                	mov    (%eax),%eax
+ 692:	29 c2                	sub    %eax,%edx
+ 694:	83 fa 1f             	cmp    $0x1f,%edx
+ 697:	76 07                	jbe    6a0 <ring_queue+0x1f>
+    return -1;
+ 699:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 69e:	eb 68                	jmp    708 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 6a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a6:	83 e0 1f             	and    $0x1f,%eax
+ 6a9:	89 c2                	mov    %eax,%edx
+ 6ab:	89 d0                	mov    %edx,%eax
+ 6ad:	c1 e0 02             	shl    $0x2,%eax
+ 6b0:	01 d0                	add    %edx,%eax
+ 6b2:	c1 e0 02             	shl    $0x2,%eax
+ 6b5:	8d 50 10             	lea    0x10(%eax),%edx
+ 6b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bb:	01 d0                	add    %edx,%eax
+ 6bd:	83 c0 04             	add    $0x4,%eax
+ 6c0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 6c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c6:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6c9:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 6cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6ce:	8b 55 10             	mov    0x10(%ebp),%edx
+ 6d1:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 6d4:	8b 55 14             	mov    0x14(%ebp),%edx
+ 6d7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6da:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 6dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e0:	8b 55 18             	mov    0x18(%ebp),%edx
+ 6e3:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 6e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6e9:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 6ec:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 6ef:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 6f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6fa:	8d 50 01             	lea    0x1(%eax),%edx
+ 6fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 700:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 703:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 708:	c9                   	leave
+ 709:	c3                   	ret
+
+0000070a <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 70a:	55                   	push   %ebp
+ 70b:	89 e5                	mov    %esp,%ebp
+ 70d:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 710:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 715:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 719:	7f 1a                	jg     735 <ring_submit+0x2b>
+ 71b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71e:	8b 40 10             	mov    0x10(%eax),%eax
+ 721:	83 e0 01             	and    $0x1,%eax
+ 724:	85 c0                	test   %eax,%eax
+ 726:	74 0d                	je     735 <ring_submit+0x2b>
+ 728:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72b:	8b 40 10             	mov    0x10(%eax),%eax
+ 72e:	83 e0 02             	and    $0x2,%eax
+ 731:	85 c0                	test   %eax,%eax
+ 733:	74 10                	je     745 <ring_submit+0x3b>
+    return ring_enter(min);
+ 735:	83 ec 0c             	sub    $0xc,%esp
+ 738:	ff 75 0c             	push   0xc(%ebp)
+ 73b:	e8 83 01 00 00       	call   8c3 <ring_enter>
+ 740:	83 c4 10             	add    $0x10,%esp
+ 743:	eb 10                	jmp    755 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 745:	8b 45 08             	mov    0x8(%ebp),%eax
+ 748:	8b 50 0c             	mov    0xc(%eax),%edx
+ 74b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 74e:	8b 40 08             	mov    0x8(%eax),%eax
+ 751:	29 c2                	sub    %eax,%edx
+ 753:	89 d0                	mov    %edx,%eax
+}
+ 755:	c9                   	leave
+ 756:	c3                   	ret
+
+00000757 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 757:	55                   	push   %ebp
+ 758:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 75a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75d:	8b 50 08             	mov    0x8(%eax),%edx
+ 760:	8b 45 08             	mov    0x8(%ebp),%eax
+ 763:	8b 40 0c             	mov    0xc(%eax),%eax
+ 766:	39 c2                	cmp    %eax,%edx
+ 768:	75 07                	jne    771 <ring_reap+0x1a>
+    return -1;
+ 76a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 76f:	eb 3b                	jmp    7ac <ring_reap+0x55>
+  __sync_synchronize();
+ 771:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 776:	8b 45 08             	mov    0x8(%ebp),%eax
+ 779:	8b 40 08             	mov    0x8(%eax),%eax
+ 77c:	83 e0 1f             	and    $0x1f,%eax
+ 77f:	89 c2                	mov    %eax,%edx
+ 781:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 784:	8b 45 08             	mov    0x8(%ebp),%eax
+ 787:	83 c2 52             	add    $0x52,%edx
+ 78a:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 78e:	8b 02                	mov    (%edx),%eax
+ 790:	8b 52 04             	mov    0x4(%edx),%edx
+ 793:	89 01                	mov    %eax,(%ecx)
+ 795:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 798:	8b 45 08             	mov    0x8(%ebp),%eax
+ 79b:	8b 40 08             	mov    0x8(%eax),%eax
+ 79e:	8d 50 01             	lea    0x1(%eax),%edx
+ 7a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a4:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 7a7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 7ac:	5d                   	pop    %ebp
+ 7ad:	c3                   	ret
+
+000007ae <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 7ae:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 7b5:	74 0a                	je     7c1 <usyscall+0x13>
+  movl %esp, %ecx
+ 7b7:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 7b9:	ba c0 07 00 00       	mov    $0x7c0,%edx
+  sysenter
+ 7be:	0f 34                	sysenter
+2:
+  ret
+ 7c0:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 7c1:	cd 40                	int    $0x40
+  ret
+ 7c3:	c3                   	ret
+
+000007c4 <fork>:
+
+SYSCALL(fork)
+ 7c4:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7c9:	eb e3                	jmp    7ae <usyscall>
+
+000007cb <exit>:
+SYSCALL(exit)
+ 7cb:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7d0:	eb dc                	jmp    7ae <usyscall>
+
+000007d2 <wait>:
+SYSCALL(wait)
+ 7d2:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7d7:	eb d5                	jmp    7ae <usyscall>
+
+000007d9 <pipe>:
+SYSCALL(pipe)
+ 7d9:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7de:	eb ce                	jmp    7ae <usyscall>
+
+000007e0 <read>:
+SYSCALL(read)
+ 7e0:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7e5:	eb c7                	jmp    7ae <usyscall>
+
+000007e7 <write>:
+SYSCALL(write)
+ 7e7:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7ec:	eb c0                	jmp    7ae <usyscall>
+
+000007ee <close>:
+SYSCALL(close)
+ 7ee:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7f3:	eb b9                	jmp    7ae <usyscall>
+
+000007f5 <kill>:
+SYSCALL(kill)
+ 7f5:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7fa:	eb b2                	jmp    7ae <usyscall>
+
+000007fc <exec>:
+SYSCALL(exec)
+ 7fc:	b8 07 00 00 00       	mov    $0x7,%eax
+ 801:	eb ab                	jmp    7ae <usyscall>
+
+00000803 <open>:
+SYSCALL(open)
+ 803:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 808:	eb a4                	jmp    7ae <usyscall>
+
+0000080a <mknod>:
+SYSCALL(mknod)
+ 80a:	b8 11 00 00 00       	mov    $0x11,%eax
+ 80f:	eb 9d                	jmp    7ae <usyscall>
+
+00000811 <unlink>:
+SYSCALL(unlink)
+ 811:	b8 12 00 00 00       	mov    $0x12,%eax
+ 816:	eb 96                	jmp    7ae <usyscall>
+
+00000818 <fstat>:
+SYSCALL(fstat)
+ 818:	b8 08 00 00 00       	mov    $0x8,%eax
+ 81d:	eb 8f                	jmp    7ae <usyscall>
+
+0000081f <link>:
+SYSCALL(link)
+ 81f:	b8 13 00 00 00       	mov    $0x13,%eax
+ 824:	eb 88                	jmp    7ae <usyscall>
+
+00000826 <mkdir>:
+SYSCALL(mkdir)
+ 826:	b8 14 00 00 00       	mov    $0x14,%eax
+ 82b:	eb 81                	jmp    7ae <usyscall>
+
+0000082d <chdir>:
+SYSCALL(chdir)
+ 82d:	b8 09 00 00 00       	mov    $0x9,%eax
+ 832:	e9 77 ff ff ff       	jmp    7ae <usyscall>
+
+00000837 <dup>:
+SYSCALL(dup)
+ 837:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 83c:	e9 6d ff ff ff       	jmp    7ae <usyscall>
+
+00000841 <getpid>:
+SYSCALL(getpid)
+ 841:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 846:	e9 63 ff ff ff       	jmp    7ae <usyscall>
+
+0000084b <sbrk>:
+SYSCALL(sbrk)
+ 84b:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 850:	e9 59 ff ff ff       	jmp    7ae <usyscall>
+
+00000855 <sleep>:
+SYSCALL(sleep)
+ 855:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 85a:	e9 4f ff ff ff       	jmp    7ae <usyscall>
+
+0000085f <uptime>:
+SYSCALL(uptime)
+ 85f:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 864:	e9 45 ff ff ff       	jmp    7ae <usyscall>
+
+00000869 <kmstat>:
+SYSCALL(kmstat)
+ 869:	b8 16 00 00 00       	mov    $0x16,%eax
+ 86e:	e9 3b ff ff ff       	jmp    7ae <usyscall>
+
+00000873 <setpriority>:
+SYSCALL(setpriority)
+ 873:	b8 17 00 00 00       	mov    $0x17,%eax
+ 878:	e9 31 ff ff ff       	jmp    7ae <usyscall>
+
+0000087d <clone>:
+SYSCALL(clone)
+ 87d:	b8 18 00 00 00       	mov    $0x18,%eax
+ 882:	e9 27 ff ff ff       	jmp    7ae <usyscall>
+
+00000887 <join>:
+SYSCALL(join)
+ 887:	b8 19 00 00 00       	mov    $0x19,%eax
+ 88c:	e9 1d ff ff ff       	jmp    7ae <usyscall>
+
+00000891 <futex_wait>:
+SYSCALL(futex_wait)
+ 891:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 896:	e9 13 ff ff ff       	jmp    7ae <usyscall>
+
+0000089b <futex_wake>:
+SYSCALL(futex_wake)
+ 89b:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8a0:	e9 09 ff ff ff       	jmp    7ae <usyscall>
+
+000008a5 <lockstat>:
+SYSCALL(lockstat)
+ 8a5:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8aa:	e9 ff fe ff ff       	jmp    7ae <usyscall>
+
+000008af <sysstat>:
+SYSCALL(sysstat)
+ 8af:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8b4:	e9 f5 fe ff ff       	jmp    7ae <usyscall>
+
+000008b9 <ring_setup>:
+SYSCALL(ring_setup)
+ 8b9:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 8be:	e9 eb fe ff ff       	jmp    7ae <usyscall>
+
+000008c3 <ring_enter>:
+SYSCALL(ring_enter)
+ 8c3:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8c8:	e9 e1 fe ff ff       	jmp    7ae <usyscall>
+
+000008cd <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8cd:	55                   	push   %ebp
+ 8ce:	89 e5                	mov    %esp,%ebp
+ 8d0:	83 ec 18             	sub    $0x18,%esp
+ 8d3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8d6:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8d9:	83 ec 04             	sub    $0x4,%esp
+ 8dc:	6a 01                	push   $0x1
+ 8de:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8e1:	50                   	push   %eax
+ 8e2:	ff 75 08             	push   0x8(%ebp)
+ 8e5:	e8 fd fe ff ff       	call   7e7 <write>
+ 8ea:	83 c4 10             	add    $0x10,%esp
+}
+ 8ed:	90                   	nop
+ 8ee:	c9                   	leave
+ 8ef:	c3                   	ret
+
+000008f0 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8f0:	55                   	push   %ebp
+ 8f1:	89 e5                	mov    %esp,%ebp
+ 8f3:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8f6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8fd:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 901:	74 17                	je     91a <printint+0x2a>
+ 903:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 907:	79 11                	jns    91a <printint+0x2a>
+    neg = 1;
+ 909:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 910:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 913:	f7 d8                	neg    %eax
+ 915:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 918:	eb 06                	jmp    920 <printint+0x30>
+  } else {
+    x = xx;
+ 91a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 91d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 920:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 927:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 92a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 92d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 932:	f7 f1                	div    %ecx
+ 934:	89 d1                	mov    %edx,%ecx
+ 936:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 939:	8d 50 01             	lea    0x1(%eax),%edx
+ 93c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 93f:	0f b6 91 08 13 00 00 	movzbl 0x1308(%ecx),%edx
+ 946:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 94a:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 94d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 950:	ba 00 00 00 00       	mov    $0x0,%edx
+ 955:	f7 f1                	div    %ecx
+ 957:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 95a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 95e:	75 c7                	jne    927 <printint+0x37>
+  if(neg)
+ 960:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 964:	74 2d                	je     993 <printint+0xa3>
+    buf[i++] = '-';
+ 966:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 969:	8d 50 01             	lea    0x1(%eax),%edx
+ 96c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 96f:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 974:	eb 1d                	jmp    993 <printint+0xa3>
+    putc(fd, buf[i]);
+ 976:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 979:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97c:	01 d0                	add    %edx,%eax
+ 97e:	0f b6 00             	movzbl (%eax),%eax
+ 981:	0f be c0             	movsbl %al,%eax
+ 984:	83 ec 08             	sub    $0x8,%esp
+ 987:	50                   	push   %eax
+ 988:	ff 75 08             	push   0x8(%ebp)
+ 98b:	e8 3d ff ff ff       	call   8cd <putc>
+ 990:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 993:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 997:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 99b:	79 d9                	jns    976 <printint+0x86>
+}
+ 99d:	90                   	nop
+ 99e:	90                   	nop
+ 99f:	c9                   	leave
+ 9a0:	c3                   	ret
+
+000009a1 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 9a1:	55                   	push   %ebp
+ 9a2:	89 e5                	mov    %esp,%ebp
+ 9a4:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9a7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9ae:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9b1:	83 c0 04             	add    $0x4,%eax
+ 9b4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9b7:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 9be:	e9 59 01 00 00       	jmp    b1c <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 9c3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9c9:	01 d0                	add    %edx,%eax
+ 9cb:	0f b6 00             	movzbl (%eax),%eax
+ 9ce:	0f be c0             	movsbl %al,%eax
+ 9d1:	25 ff 00 00 00       	and    $0xff,%eax
+ 9d6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9d9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9dd:	75 2c                	jne    a0b <printf+0x6a>
+      if(c == '%'){
+ 9df:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9e3:	75 0c                	jne    9f1 <printf+0x50>
+        state = '%';
+ 9e5:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9ec:	e9 27 01 00 00       	jmp    b18 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 9f1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f4:	0f be c0             	movsbl %al,%eax
+ 9f7:	83 ec 08             	sub    $0x8,%esp
+ 9fa:	50                   	push   %eax
+ 9fb:	ff 75 08             	push   0x8(%ebp)
+ 9fe:	e8 ca fe ff ff       	call   8cd <putc>
+ a03:	83 c4 10             	add    $0x10,%esp
+ a06:	e9 0d 01 00 00       	jmp    b18 <printf+0x177>
+      }
+    } else if(state == '%'){
+ a0b:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a0f:	0f 85 03 01 00 00    	jne    b18 <printf+0x177>
+      if(c == 'd'){
+ a15:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a19:	75 1e                	jne    a39 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a1e:	8b 00                	mov    (%eax),%eax
+ a20:	6a 01                	push   $0x1
+ a22:	6a 0a                	push   $0xa
+ a24:	50                   	push   %eax
+ a25:	ff 75 08             	push   0x8(%ebp)
+ a28:	e8 c3 fe ff ff       	call   8f0 <printint>
+ a2d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a30:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a34:	e9 d8 00 00 00       	jmp    b11 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a39:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a3d:	74 06                	je     a45 <printf+0xa4>
+ a3f:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a43:	75 1e                	jne    a63 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a45:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	6a 00                	push   $0x0
+ a4c:	6a 10                	push   $0x10
+ a4e:	50                   	push   %eax
+ a4f:	ff 75 08             	push   0x8(%ebp)
+ a52:	e8 99 fe ff ff       	call   8f0 <printint>
+ a57:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a5a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a5e:	e9 ae 00 00 00       	jmp    b11 <printf+0x170>
+      } else if(c == 's'){
+ a63:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a67:	75 43                	jne    aac <printf+0x10b>
+        s = (char*)*ap;
+ a69:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a6c:	8b 00                	mov    (%eax),%eax
+ a6e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a71:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a75:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a79:	75 25                	jne    aa0 <printf+0xff>
+          s = "(null)";
+ a7b:	c7 45 f4 4a 0e 00 00 	movl   $0xe4a,-0xc(%ebp)
+        while(*s != 0){
+ a82:	eb 1c                	jmp    aa0 <printf+0xff>
+          putc(fd, *s);
+ a84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a87:	0f b6 00             	movzbl (%eax),%eax
+ a8a:	0f be c0             	movsbl %al,%eax
+ a8d:	83 ec 08             	sub    $0x8,%esp
+ a90:	50                   	push   %eax
+ a91:	ff 75 08             	push   0x8(%ebp)
+ a94:	e8 34 fe ff ff       	call   8cd <putc>
+ a99:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a9c:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ aa0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aa3:	0f b6 00             	movzbl (%eax),%eax
+ aa6:	84 c0                	test   %al,%al
+ aa8:	75 da                	jne    a84 <printf+0xe3>
+ aaa:	eb 65                	jmp    b11 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ aac:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ ab0:	75 1d                	jne    acf <printf+0x12e>
+        putc(fd, *ap);
+ ab2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ab5:	8b 00                	mov    (%eax),%eax
+ ab7:	0f be c0             	movsbl %al,%eax
+ aba:	83 ec 08             	sub    $0x8,%esp
+ abd:	50                   	push   %eax
+ abe:	ff 75 08             	push   0x8(%ebp)
+ ac1:	e8 07 fe ff ff       	call   8cd <putc>
+ ac6:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ac9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ acd:	eb 42                	jmp    b11 <printf+0x170>
+      } else if(c == '%'){
+ acf:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ ad3:	75 17                	jne    aec <printf+0x14b>
+        putc(fd, c);
+ ad5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ad8:	0f be c0             	movsbl %al,%eax
+ adb:	83 ec 08             	sub    $0x8,%esp
+ ade:	50                   	push   %eax
+ adf:	ff 75 08             	push   0x8(%ebp)
+ ae2:	e8 e6 fd ff ff       	call   8cd <putc>
+ ae7:	83 c4 10             	add    $0x10,%esp
+ aea:	eb 25                	jmp    b11 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ aec:	83 ec 08             	sub    $0x8,%esp
+ aef:	6a 25                	push   $0x25
+ af1:	ff 75 08             	push   0x8(%ebp)
+ af4:	e8 d4 fd ff ff       	call   8cd <putc>
+ af9:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ afc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aff:	0f be c0             	movsbl %al,%eax
+ b02:	83 ec 08             	sub    $0x8,%esp
+ b05:	50                   	push   %eax
+ b06:	ff 75 08             	push   0x8(%ebp)
+ b09:	e8 bf fd ff ff       	call   8cd <putc>
+ b0e:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b11:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b18:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b1c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b1f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b22:	01 d0                	add    %edx,%eax
+ b24:	0f b6 00             	movzbl (%eax),%eax
+ b27:	84 c0                	test   %al,%al
+ b29:	0f 85 94 fe ff ff    	jne    9c3 <printf+0x22>
+    }
+  }
+}
+ b2f:	90                   	nop
+ b30:	90                   	nop
+ b31:	c9                   	leave
+ b32:	c3                   	ret
+
+00000b33 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b33:	55                   	push   %ebp
+ b34:	89 e5                	mov    %esp,%ebp
+ b36:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b39:	8b 45 08             	mov    0x8(%ebp),%eax
+ b3c:	83 e8 08             	sub    $0x8,%eax
+ b3f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b42:	a1 24 13 00 00       	mov    0x1324,%eax
+ b47:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b4a:	eb 24                	jmp    b70 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b4c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4f:	8b 00                	mov    (%eax),%eax
+ b51:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b54:	72 12                	jb     b68 <free+0x35>
+ b56:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b59:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b5c:	72 24                	jb     b82 <free+0x4f>
+ b5e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b61:	8b 00                	mov    (%eax),%eax
+ b63:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b66:	72 1a                	jb     b82 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6b:	8b 00                	mov    (%eax),%eax
+ b6d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b73:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b76:	73 d4                	jae    b4c <free+0x19>
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7b:	8b 00                	mov    (%eax),%eax
+ b7d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b80:	73 ca                	jae    b4c <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b82:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b85:	8b 40 04             	mov    0x4(%eax),%eax
+ b88:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b8f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b92:	01 c2                	add    %eax,%edx
+ b94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b97:	8b 00                	mov    (%eax),%eax
+ b99:	39 c2                	cmp    %eax,%edx
+ b9b:	75 24                	jne    bc1 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b9d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba0:	8b 50 04             	mov    0x4(%eax),%edx
+ ba3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba6:	8b 00                	mov    (%eax),%eax
+ ba8:	8b 40 04             	mov    0x4(%eax),%eax
+ bab:	01 c2                	add    %eax,%edx
+ bad:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb0:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bb3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb6:	8b 00                	mov    (%eax),%eax
+ bb8:	8b 10                	mov    (%eax),%edx
+ bba:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bbd:	89 10                	mov    %edx,(%eax)
+ bbf:	eb 0a                	jmp    bcb <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ bc1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc4:	8b 10                	mov    (%eax),%edx
+ bc6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc9:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ bcb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bce:	8b 40 04             	mov    0x4(%eax),%eax
+ bd1:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bdb:	01 d0                	add    %edx,%eax
+ bdd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ be0:	75 20                	jne    c02 <free+0xcf>
+    p->s.size += bp->s.size;
+ be2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be5:	8b 50 04             	mov    0x4(%eax),%edx
+ be8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ beb:	8b 40 04             	mov    0x4(%eax),%eax
+ bee:	01 c2                	add    %eax,%edx
+ bf0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bf3:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bf6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bf9:	8b 10                	mov    (%eax),%edx
+ bfb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfe:	89 10                	mov    %edx,(%eax)
+ c00:	eb 08                	jmp    c0a <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c02:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c05:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c08:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0d:	a3 24 13 00 00       	mov    %eax,0x1324
+}
+ c12:	90                   	nop
+ c13:	c9                   	leave
+ c14:	c3                   	ret
+
+00000c15 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c15:	55                   	push   %ebp
+ c16:	89 e5                	mov    %esp,%ebp
+ c18:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c1b:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c22:	77 07                	ja     c2b <morecore+0x16>
+    nu = 4096;
+ c24:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c2b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2e:	c1 e0 03             	shl    $0x3,%eax
+ c31:	83 ec 0c             	sub    $0xc,%esp
+ c34:	50                   	push   %eax
+ c35:	e8 11 fc ff ff       	call   84b <sbrk>
+ c3a:	83 c4 10             	add    $0x10,%esp
+ c3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c40:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c44:	75 07                	jne    c4d <morecore+0x38>
+    return 0;
+ c46:	b8 00 00 00 00       	mov    $0x0,%eax
+ c4b:	eb 26                	jmp    c73 <morecore+0x5e>
+  hp = (Header*)p;
+ c4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c50:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c53:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c56:	8b 55 08             	mov    0x8(%ebp),%edx
+ c59:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c5c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c5f:	83 c0 08             	add    $0x8,%eax
+ c62:	83 ec 0c             	sub    $0xc,%esp
+ c65:	50                   	push   %eax
+ c66:	e8 c8 fe ff ff       	call   b33 <free>
+ c6b:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c6e:	a1 24 13 00 00       	mov    0x1324,%eax
+}
+ c73:	c9                   	leave
+ c74:	c3                   	ret
+
+00000c75 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c75:	55                   	push   %ebp
+ c76:	89 e5                	mov    %esp,%ebp
+ c78:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c7b:	8b 45 08             	mov    0x8(%ebp),%eax
+ c7e:	83 c0 07             	add    $0x7,%eax
+ c81:	c1 e8 03             	shr    $0x3,%eax
+ c84:	83 c0 01             	add    $0x1,%eax
+ c87:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c8a:	a1 24 13 00 00       	mov    0x1324,%eax
+ c8f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c92:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c96:	75 23                	jne    cbb <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c98:	c7 45 f0 1c 13 00 00 	movl   $0x131c,-0x10(%ebp)
+ c9f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca2:	a3 24 13 00 00       	mov    %eax,0x1324
+ ca7:	a1 24 13 00 00       	mov    0x1324,%eax
+ cac:	a3 1c 13 00 00       	mov    %eax,0x131c
+    base.s.size = 0;
+ cb1:	c7 05 20 13 00 00 00 	movl   $0x0,0x1320
+ cb8:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cbe:	8b 00                	mov    (%eax),%eax
+ cc0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc6:	8b 40 04             	mov    0x4(%eax),%eax
+ cc9:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ccc:	72 4d                	jb     d1b <malloc+0xa6>
+      if(p->s.size == nunits)
+ cce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd1:	8b 40 04             	mov    0x4(%eax),%eax
+ cd4:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cd7:	75 0c                	jne    ce5 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cd9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cdc:	8b 10                	mov    (%eax),%edx
+ cde:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce1:	89 10                	mov    %edx,(%eax)
+ ce3:	eb 26                	jmp    d0b <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ ce5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ce8:	8b 40 04             	mov    0x4(%eax),%eax
+ ceb:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ cee:	89 c2                	mov    %eax,%edx
+ cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf3:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf9:	8b 40 04             	mov    0x4(%eax),%eax
+ cfc:	c1 e0 03             	shl    $0x3,%eax
+ cff:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d02:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d05:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d08:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d0b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d0e:	a3 24 13 00 00       	mov    %eax,0x1324
+      return (void*)(p + 1);
+ d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d16:	83 c0 08             	add    $0x8,%eax
+ d19:	eb 3b                	jmp    d56 <malloc+0xe1>
+    }
+    if(p == freep)
+ d1b:	a1 24 13 00 00       	mov    0x1324,%eax
+ d20:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d23:	75 1e                	jne    d43 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d25:	83 ec 0c             	sub    $0xc,%esp
+ d28:	ff 75 ec             	push   -0x14(%ebp)
+ d2b:	e8 e5 fe ff ff       	call   c15 <morecore>
+ d30:	83 c4 10             	add    $0x10,%esp
+ d33:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d36:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d3a:	75 07                	jne    d43 <malloc+0xce>
+        return 0;
+ d3c:	b8 00 00 00 00       	mov    $0x0,%eax
+ d41:	eb 13                	jmp    d56 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d46:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d49:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d4c:	8b 00                	mov    (%eax),%eax
+ d4e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d51:	e9 6d ff ff ff       	jmp    cc3 <malloc+0x4e>
+  }
+}
+ d56:	c9                   	leave
+ d57:	c3                   	ret
+
+00000d58 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d58:	55                   	push   %ebp
+ d59:	89 e5                	mov    %esp,%ebp
+ d5b:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ d5e:	83 ec 0c             	sub    $0xc,%esp
+ d61:	68 00 10 00 00       	push   $0x1000
+ d66:	e8 0a ff ff ff       	call   c75 <malloc>
+ d6b:	83 c4 10             	add    $0x10,%esp
+ d6e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d71:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d75:	75 07                	jne    d7e <thread_create+0x26>
+    return -1;
+ d77:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d7c:	eb 2e                	jmp    dac <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d7e:	83 ec 04             	sub    $0x4,%esp
+ d81:	ff 75 f4             	push   -0xc(%ebp)
+ d84:	ff 75 0c             	push   0xc(%ebp)
+ d87:	ff 75 08             	push   0x8(%ebp)
+ d8a:	e8 ee fa ff ff       	call   87d <clone>
+ d8f:	83 c4 10             	add    $0x10,%esp
+ d92:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d95:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d99:	79 0e                	jns    da9 <thread_create+0x51>
+    free(stack);
+ d9b:	83 ec 0c             	sub    $0xc,%esp
+ d9e:	ff 75 f4             	push   -0xc(%ebp)
+ da1:	e8 8d fd ff ff       	call   b33 <free>
+ da6:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ da9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ dac:	c9                   	leave
+ dad:	c3                   	ret
+
+00000dae <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ dae:	55                   	push   %ebp
+ daf:	89 e5                	mov    %esp,%ebp
+ db1:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ db4:	83 ec 0c             	sub    $0xc,%esp
+ db7:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ dba:	50                   	push   %eax
+ dbb:	e8 c7 fa ff ff       	call   887 <join>
+ dc0:	83 c4 10             	add    $0x10,%esp
+ dc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dc6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ dca:	78 0f                	js     ddb <thread_join+0x2d>
+    free(stack);
+ dcc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dcf:	83 ec 0c             	sub    $0xc,%esp
+ dd2:	50                   	push   %eax
+ dd3:	e8 5b fd ff ff       	call   b33 <free>
+ dd8:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ddb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ dde:	c9                   	leave
+ ddf:	c3                   	ret
@@ -0,0 +1,51 @@
+// Context-switch benchmark: two processes bounce a byte
+// back and forth over a pair of pipes, so every round trip
+// is two sleep/wakeup context switches.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+  int n, i, pid, ping[2], pong[2];
+  uint t0, t1;
+  char c;
+
+  n = 10000;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "ctxbench: pipe failed\n");
+    exit();
+  }
+
+  t0 = uptime();
+  pid = fork();
+  if(pid < 0){
+    printf(2, "ctxbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(i = 0; i < n; i++){
+      if(read(ping[0], &c, 1) != 1)
+        break;
+      write(pong[1], &c, 1);
+    }
+    exit();
+  }
+  c = 'x';
+  for(i = 0; i < n; i++){
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "ctxbench: short read\n");
+      break;
+    }
+  }
+  t1 = uptime();
+  wait();
+
+  printf(1, "ctxbench: %d round trips in %d ticks\n", i, t1 - t0);
+  exit();
+}
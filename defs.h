@@ -2,11 +2,16 @@ struct buf;
 struct context;
 struct file;
 struct inode;
+struct kmcache;
+struct kmstat;
+struct lockstat;
 struct pipe;
 struct proc;
+struct sleeplock;
 struct spinlock;
 struct stat;
 struct superblock;
+struct sysstat;
 
 // bio.c
 void            binit(void);
@@ -40,6 +45,7 @@ struct inode*   ialloc(uint, short);
 struct inode*   idup(struct inode*);
 void            iinit(void);
 void            ilock(struct inode*);
+void            ilockshared(struct inode*);
 void            iput(struct inode*);
 void            iunlock(struct inode*);
 void            iunlockput(struct inode*);
@@ -47,10 +53,23 @@ void            iupdate(struct inode*);
 int             namecmp(const char*, const char*);
 struct inode*   namei(char*);
 struct inode*   nameiparent(char*, char*);
+void            nameforget(struct inode*, char*);
 int             readi(struct inode*, char*, uint, uint);
 void            stati(struct inode*, struct stat*);
 int             writei(struct inode*, char*, uint, uint);
 
+// futex.c
+void            futexinit(void);
+int             futexwait(uint, uint);
+int             futexwake(uint, int);
+
+// fpu.c
+void            fpuexec(void);
+int             fpufork(struct proc*);
+void            fpuinit(void);
+void            fpusave(void);
+int             fputrap(void);
+
 // ide.c
 void            ideinit(void);
 void            ideintr(void);
@@ -63,9 +82,13 @@ void            ioapicinit(void);
 
 // kalloc.c
 char*           kalloc(void);
+char*           kallocpages(int);
 void            kfree(char*);
+void            kfreepages(char*, int);
 void            kinit1(void*, void*);
 void            kinit2(void*, void*);
+char*           ksuperalloc(void);
+void            ksuperfree(char*);
 
 // kbd.c
 void            kbdintr(void);
@@ -75,6 +98,7 @@ int             cpunum(void);
 extern volatile uint*    lapic;
 void            lapiceoi(void);
 void            lapicinit(void);
+void            lapicipi(uchar, int);
 void            lapicstartap(uchar, uint);
 void            microdelay(int);
 
@@ -84,6 +108,11 @@ void            log_write(struct buf*);
 void            begin_trans();
 void            commit_trans();
 
+// memmap.c
+void            meminit(void);
+int             memrange(int, uint*, uint*);
+extern uint     phystop;
+
 // mp.c
 extern int      ismp;
 int             mpbcpu(void);
@@ -96,35 +125,66 @@ void            picinit(void);
 
 // pipe.c
 int             pipealloc(struct file**, struct file**);
+void            pipeinit(void);
 void            pipeclose(struct pipe*, int);
 int             piperead(struct pipe*, char*, int);
 int             pipewrite(struct pipe*, char*, int);
 
 //PAGEBREAK: 16
 // proc.c
+int             clone(void(*)(void*), void*, void*);
 struct proc*    copyproc(struct proc*);
+struct proc*    kclone(void(*)(void));
 void            exit(void);
 int             fork(void);
 int             growproc(int);
+int             join(void**);
 int             kill(int);
+void            killthreads(void);
 void            pinit(void);
 void            procdump(void);
 void            scheduler(void) __attribute__((noreturn));
 void            sched(void);
+int             schedtick(void);
+int             setpriority(int, int);
 void            sleep(void*, struct spinlock*);
 void            userinit(void);
 int             wait(void);
 void            wakeup(void*);
+int             wakeupn(void*, int);
+void            wakeone(void*);
 void            yield(void);
 
 // swtch.S
 void            swtch(struct context**, struct context*);
 
+// ring.c
+int             ringenter(int);
+int             ringsetup(uint, int);
+void            ringstop(void);
+
+// slab.c
+void*           kmalloc(uint);
+void*           kmcachealloc(struct kmcache*);
+struct kmcache* kmcreate(char*, uint);
+void            kmfree(void*);
+void            kminit(void);
+int             kmstat(struct kmstat*, int);
+
+// sleeplock.c
+void            acquiresleep(struct sleeplock*);
+void            acquiresleepshared(struct sleeplock*);
+int             holdingsleep(struct sleeplock*);
+void            initsleeplock(struct sleeplock*, char*);
+void            releasesleep(struct sleeplock*);
+
 // spinlock.c
 void            acquire(struct spinlock*);
 void            getcallerpcs(void*, uint*);
 int             holding(struct spinlock*);
 void            initlock(struct spinlock*, char*);
+void            initmcslock(struct spinlock*, char*);
+int             lockstat(struct lockstat*, int, int);
 void            release(struct spinlock*);
 void            pushcli(void);
 void            popcli(void);
@@ -145,8 +205,16 @@ int             argstr(int, char**);
 int             fetchint(uint, int*);
 int             fetchstr(uint, char**);
 void            syscall(void);
+int             sysstat(struct sysstat*, int, int);
+
+// sysfile.c
+int             fdclose(int);
+int             fdread(int, char*, int);
+int             fdwrite(int, char*, int);
+int             openpath(char*, int);
 
 // timer.c
+uint            tsccalibrate(void);
 void            timerinit(void);
 
 // trap.c
@@ -176,6 +244,9 @@ void            switchuvm(struct proc*);
 void            switchkvm(void);
 int             copyout(pde_t*, uint, void*, uint);
 void            clearpteu(pde_t *pgdir, char *uva);
+void            vdsoinit(void);
+int             mapvdso(pde_t*, int);
+void            vdsotick(uint);
 
 // number of elements in fixed-size array
 #define NELEM(x) (sizeof(x)/sizeof((x)[0]))
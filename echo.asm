@@ -0,0 +1,1779 @@
+
+_echo:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  for(i = 1; i < argc; i++)
+  14:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  1b:	eb 3c                	jmp    59 <main+0x59>
+    printf(1, "%s%s", argv[i], i+1 < argc ? " " : "\n");
+  1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  20:	83 c0 01             	add    $0x1,%eax
+  23:	39 03                	cmp    %eax,(%ebx)
+  25:	7e 07                	jle    2e <main+0x2e>
+  27:	b9 cc 0c 00 00       	mov    $0xccc,%ecx
+  2c:	eb 05                	jmp    33 <main+0x33>
+  2e:	b9 ce 0c 00 00       	mov    $0xcce,%ecx
+  33:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  36:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  3d:	8b 43 04             	mov    0x4(%ebx),%eax
+  40:	01 d0                	add    %edx,%eax
+  42:	8b 00                	mov    (%eax),%eax
+  44:	51                   	push   %ecx
+  45:	50                   	push   %eax
+  46:	68 d0 0c 00 00       	push   $0xcd0
+  4b:	6a 01                	push   $0x1
+  4d:	e8 3b 08 00 00       	call   88d <printf>
+  52:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++)
+  55:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  59:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5c:	3b 03                	cmp    (%ebx),%eax
+  5e:	7c bd                	jl     1d <main+0x1d>
+  exit();
+  60:	e8 52 06 00 00       	call   6b7 <exit>
+
+00000065 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+  65:	55                   	push   %ebp
+  66:	89 e5                	mov    %esp,%ebp
+  68:	57                   	push   %edi
+  69:	53                   	push   %ebx
+char*
+  6a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  6d:	8b 55 10             	mov    0x10(%ebp),%edx
+  70:	8b 45 0c             	mov    0xc(%ebp),%eax
+  73:	89 cb                	mov    %ecx,%ebx
+  75:	89 df                	mov    %ebx,%edi
+  77:	89 d1                	mov    %edx,%ecx
+  79:	fc                   	cld
+  7a:	f3 aa                	rep stos %al,%es:(%edi)
+  7c:	89 ca                	mov    %ecx,%edx
+  7e:	89 fb                	mov    %edi,%ebx
+  80:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  83:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+  86:	90                   	nop
+  87:	5b                   	pop    %ebx
+  88:	5f                   	pop    %edi
+  89:	5d                   	pop    %ebp
+  8a:	c3                   	ret
+
+0000008b <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+  8b:	55                   	push   %ebp
+  8c:	89 e5                	mov    %esp,%ebp
+  8e:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+  91:	8b 55 08             	mov    0x8(%ebp),%edx
+  94:	8b 45 0c             	mov    0xc(%ebp),%eax
+  97:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  9a:	f0 87 02             	lock xchg %eax,(%edx)
+  9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+  a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+  a3:	c9                   	leave
+  a4:	c3                   	ret
+
+000000a5 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+  a5:	55                   	push   %ebp
+  a6:	89 e5                	mov    %esp,%ebp
+  a8:	53                   	push   %ebx
+  a9:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+  ac:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  af:	8b 55 10             	mov    0x10(%ebp),%edx
+  b2:	8b 45 0c             	mov    0xc(%ebp),%eax
+  b5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  b8:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  bf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+  c2:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  c5:	c9                   	leave
+  c6:	c3                   	ret
+
+000000c7 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+  c7:	55                   	push   %ebp
+  c8:	89 e5                	mov    %esp,%ebp
+  ca:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+  cd:	0f 31                	rdtsc
+  cf:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  d2:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+  d5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  d8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+  db:	c9                   	leave
+  dc:	c3                   	ret
+
+000000dd <strcpy>:
+{
+  dd:	55                   	push   %ebp
+  de:	89 e5                	mov    %esp,%ebp
+  e0:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  e3:	8b 45 08             	mov    0x8(%ebp),%eax
+  e6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  e9:	90                   	nop
+  ea:	8b 55 0c             	mov    0xc(%ebp),%edx
+  ed:	8d 42 01             	lea    0x1(%edx),%eax
+  f0:	89 45 0c             	mov    %eax,0xc(%ebp)
+  f3:	8b 45 08             	mov    0x8(%ebp),%eax
+  f6:	8d 48 01             	lea    0x1(%eax),%ecx
+  f9:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  fc:	0f b6 12             	movzbl (%edx),%edx
+  ff:	88 10                	mov    %dl,(%eax)
+ 101:	0f b6 00             	movzbl (%eax),%eax
+ 104:	84 c0                	test   %al,%al
+ 106:	75 e2                	jne    ea <strcpy+0xd>
+  return os;
+ 108:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 10b:	c9                   	leave
+ 10c:	c3                   	ret
+
+0000010d <strcmp>:
+{
+ 10d:	55                   	push   %ebp
+ 10e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 110:	eb 08                	jmp    11a <strcmp+0xd>
+    p++, q++;
+ 112:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 116:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 11a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 11d:	0f b6 00             	movzbl (%eax),%eax
+ 120:	84 c0                	test   %al,%al
+ 122:	74 10                	je     134 <strcmp+0x27>
+ 124:	8b 45 08             	mov    0x8(%ebp),%eax
+ 127:	0f b6 10             	movzbl (%eax),%edx
+ 12a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 12d:	0f b6 00             	movzbl (%eax),%eax
+ 130:	38 c2                	cmp    %al,%dl
+ 132:	74 de                	je     112 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 134:	8b 45 08             	mov    0x8(%ebp),%eax
+ 137:	0f b6 00             	movzbl (%eax),%eax
+ 13a:	0f b6 d0             	movzbl %al,%edx
+ 13d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 140:	0f b6 00             	movzbl (%eax),%eax
+ 143:	0f b6 c0             	movzbl %al,%eax
+ 146:	29 c2                	sub    %eax,%edx
+ 148:	89 d0                	mov    %edx,%eax
+}
+ 14a:	5d                   	pop    %ebp
+ 14b:	c3                   	ret
+
+0000014c <strlen>:
+{
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+ 14f:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 152:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 159:	eb 04                	jmp    15f <strlen+0x13>
+ 15b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 15f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 162:	8b 45 08             	mov    0x8(%ebp),%eax
+ 165:	01 d0                	add    %edx,%eax
+ 167:	0f b6 00             	movzbl (%eax),%eax
+ 16a:	84 c0                	test   %al,%al
+ 16c:	75 ed                	jne    15b <strlen+0xf>
+  return n;
+ 16e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 171:	c9                   	leave
+ 172:	c3                   	ret
+
+00000173 <memset>:
+{
+ 173:	55                   	push   %ebp
+ 174:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 176:	8b 45 10             	mov    0x10(%ebp),%eax
+ 179:	50                   	push   %eax
+ 17a:	ff 75 0c             	push   0xc(%ebp)
+ 17d:	ff 75 08             	push   0x8(%ebp)
+ 180:	e8 e0 fe ff ff       	call   65 <stosb>
+ 185:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 188:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 18b:	c9                   	leave
+ 18c:	c3                   	ret
+
+0000018d <strchr>:
+{
+ 18d:	55                   	push   %ebp
+ 18e:	89 e5                	mov    %esp,%ebp
+ 190:	83 ec 04             	sub    $0x4,%esp
+ 193:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 196:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 199:	eb 14                	jmp    1af <strchr+0x22>
+    if(*s == c)
+ 19b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 19e:	0f b6 00             	movzbl (%eax),%eax
+ 1a1:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1a4:	75 05                	jne    1ab <strchr+0x1e>
+      return (char*)s;
+ 1a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a9:	eb 13                	jmp    1be <strchr+0x31>
+  for(; *s; s++)
+ 1ab:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b2:	0f b6 00             	movzbl (%eax),%eax
+ 1b5:	84 c0                	test   %al,%al
+ 1b7:	75 e2                	jne    19b <strchr+0xe>
+  return 0;
+ 1b9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1be:	c9                   	leave
+ 1bf:	c3                   	ret
+
+000001c0 <gets>:
+{
+ 1c0:	55                   	push   %ebp
+ 1c1:	89 e5                	mov    %esp,%ebp
+ 1c3:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1c6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1cd:	eb 42                	jmp    211 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1cf:	83 ec 04             	sub    $0x4,%esp
+ 1d2:	6a 01                	push   $0x1
+ 1d4:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1d7:	50                   	push   %eax
+ 1d8:	6a 00                	push   $0x0
+ 1da:	e8 ed 04 00 00       	call   6cc <read>
+ 1df:	83 c4 10             	add    $0x10,%esp
+ 1e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1e5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1e9:	7e 33                	jle    21e <gets+0x5e>
+    buf[i++] = c;
+ 1eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ee:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1f4:	89 c2                	mov    %eax,%edx
+ 1f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f9:	01 c2                	add    %eax,%edx
+ 1fb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1ff:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 201:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 205:	3c 0a                	cmp    $0xa,%al
+ 207:	74 16                	je     21f <gets+0x5f>
+ 209:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 20d:	3c 0d                	cmp    $0xd,%al
+ 20f:	74 0e                	je     21f <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 211:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 214:	83 c0 01             	add    $0x1,%eax
+ 217:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 21a:	7f b3                	jg     1cf <gets+0xf>
+ 21c:	eb 01                	jmp    21f <gets+0x5f>
+      break;
+ 21e:	90                   	nop
+  buf[i] = '\0';
+ 21f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 222:	8b 45 08             	mov    0x8(%ebp),%eax
+ 225:	01 d0                	add    %edx,%eax
+ 227:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 22a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 22d:	c9                   	leave
+ 22e:	c3                   	ret
+
+0000022f <stat>:
+{
+ 22f:	55                   	push   %ebp
+ 230:	89 e5                	mov    %esp,%ebp
+ 232:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 235:	83 ec 08             	sub    $0x8,%esp
+ 238:	6a 00                	push   $0x0
+ 23a:	ff 75 08             	push   0x8(%ebp)
+ 23d:	e8 ad 04 00 00       	call   6ef <open>
+ 242:	83 c4 10             	add    $0x10,%esp
+ 245:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 248:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 24c:	79 07                	jns    255 <stat+0x26>
+    return -1;
+ 24e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 253:	eb 25                	jmp    27a <stat+0x4b>
+  r = fstat(fd, st);
+ 255:	83 ec 08             	sub    $0x8,%esp
+ 258:	ff 75 0c             	push   0xc(%ebp)
+ 25b:	ff 75 f4             	push   -0xc(%ebp)
+ 25e:	e8 a1 04 00 00       	call   704 <fstat>
+ 263:	83 c4 10             	add    $0x10,%esp
+ 266:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 269:	83 ec 0c             	sub    $0xc,%esp
+ 26c:	ff 75 f4             	push   -0xc(%ebp)
+ 26f:	e8 66 04 00 00       	call   6da <close>
+ 274:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 277:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 27a:	c9                   	leave
+ 27b:	c3                   	ret
+
+0000027c <atoi>:
+{
+ 27c:	55                   	push   %ebp
+ 27d:	89 e5                	mov    %esp,%ebp
+ 27f:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 282:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 289:	eb 25                	jmp    2b0 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 28b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 28e:	89 d0                	mov    %edx,%eax
+ 290:	c1 e0 02             	shl    $0x2,%eax
+ 293:	01 d0                	add    %edx,%eax
+ 295:	01 c0                	add    %eax,%eax
+ 297:	89 c1                	mov    %eax,%ecx
+ 299:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29c:	8d 50 01             	lea    0x1(%eax),%edx
+ 29f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2a2:	0f b6 00             	movzbl (%eax),%eax
+ 2a5:	0f be c0             	movsbl %al,%eax
+ 2a8:	01 c8                	add    %ecx,%eax
+ 2aa:	83 e8 30             	sub    $0x30,%eax
+ 2ad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b3:	0f b6 00             	movzbl (%eax),%eax
+ 2b6:	3c 2f                	cmp    $0x2f,%al
+ 2b8:	7e 0a                	jle    2c4 <atoi+0x48>
+ 2ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bd:	0f b6 00             	movzbl (%eax),%eax
+ 2c0:	3c 39                	cmp    $0x39,%al
+ 2c2:	7e c7                	jle    28b <atoi+0xf>
+  return n;
+ 2c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c7:	c9                   	leave
+ 2c8:	c3                   	ret
+
+000002c9 <memmove>:
+{
+ 2c9:	55                   	push   %ebp
+ 2ca:	89 e5                	mov    %esp,%ebp
+ 2cc:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 2cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2d5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2d8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2db:	eb 17                	jmp    2f4 <memmove+0x2b>
+    *dst++ = *src++;
+ 2dd:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2e0:	8d 42 01             	lea    0x1(%edx),%eax
+ 2e3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2e6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2e9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2ec:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2ef:	0f b6 12             	movzbl (%edx),%edx
+ 2f2:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2f4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f7:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2fa:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2fd:	85 c0                	test   %eax,%eax
+ 2ff:	7f dc                	jg     2dd <memmove+0x14>
+  return vdst;
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 304:	c9                   	leave
+ 305:	c3                   	ret
+
+00000306 <mutex_init>:
+{
+ 306:	55                   	push   %ebp
+ 307:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 309:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 312:	90                   	nop
+ 313:	5d                   	pop    %ebp
+ 314:	c3                   	ret
+
+00000315 <mutex_lock>:
+{
+ 315:	55                   	push   %ebp
+ 316:	89 e5                	mov    %esp,%ebp
+ 318:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 31b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31e:	6a 01                	push   $0x1
+ 320:	6a 00                	push   $0x0
+ 322:	50                   	push   %eax
+ 323:	e8 7d fd ff ff       	call   a5 <cmpxchg>
+ 328:	83 c4 0c             	add    $0xc,%esp
+ 32b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 32e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 332:	74 46                	je     37a <mutex_lock+0x65>
+  if(c != 2)
+ 334:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 338:	74 38                	je     372 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 33a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33d:	6a 02                	push   $0x2
+ 33f:	50                   	push   %eax
+ 340:	e8 46 fd ff ff       	call   8b <xchg>
+ 345:	83 c4 08             	add    $0x8,%esp
+ 348:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 34b:	eb 25                	jmp    372 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 34d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 350:	83 ec 08             	sub    $0x8,%esp
+ 353:	6a 02                	push   $0x2
+ 355:	50                   	push   %eax
+ 356:	e8 22 04 00 00       	call   77d <futex_wait>
+ 35b:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 35e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 361:	83 ec 08             	sub    $0x8,%esp
+ 364:	6a 02                	push   $0x2
+ 366:	50                   	push   %eax
+ 367:	e8 1f fd ff ff       	call   8b <xchg>
+ 36c:	83 c4 10             	add    $0x10,%esp
+ 36f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 372:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 376:	75 d5                	jne    34d <mutex_lock+0x38>
+ 378:	eb 01                	jmp    37b <mutex_lock+0x66>
+    return;
+ 37a:	90                   	nop
+}
+ 37b:	c9                   	leave
+ 37c:	c3                   	ret
+
+0000037d <mutex_unlock>:
+{
+ 37d:	55                   	push   %ebp
+ 37e:	89 e5                	mov    %esp,%ebp
+ 380:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 383:	8b 45 08             	mov    0x8(%ebp),%eax
+ 386:	6a 00                	push   $0x0
+ 388:	50                   	push   %eax
+ 389:	e8 fd fc ff ff       	call   8b <xchg>
+ 38e:	83 c4 08             	add    $0x8,%esp
+ 391:	83 f8 02             	cmp    $0x2,%eax
+ 394:	75 11                	jne    3a7 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 396:	8b 45 08             	mov    0x8(%ebp),%eax
+ 399:	83 ec 08             	sub    $0x8,%esp
+ 39c:	6a 01                	push   $0x1
+ 39e:	50                   	push   %eax
+ 39f:	e8 e3 03 00 00       	call   787 <futex_wake>
+ 3a4:	83 c4 10             	add    $0x10,%esp
+}
+ 3a7:	90                   	nop
+ 3a8:	c9                   	leave
+ 3a9:	c3                   	ret
+
+000003aa <cond_init>:
+{
+ 3aa:	55                   	push   %ebp
+ 3ab:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b0:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3b6:	90                   	nop
+ 3b7:	5d                   	pop    %ebp
+ 3b8:	c3                   	ret
+
+000003b9 <cond_wait>:
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+ 3bc:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 3bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c2:	8b 00                	mov    (%eax),%eax
+ 3c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 3c7:	83 ec 0c             	sub    $0xc,%esp
+ 3ca:	ff 75 0c             	push   0xc(%ebp)
+ 3cd:	e8 ab ff ff ff       	call   37d <mutex_unlock>
+ 3d2:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	83 ec 08             	sub    $0x8,%esp
+ 3db:	ff 75 f4             	push   -0xc(%ebp)
+ 3de:	50                   	push   %eax
+ 3df:	e8 99 03 00 00       	call   77d <futex_wait>
+ 3e4:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3e7:	eb 11                	jmp    3fa <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 3e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3ec:	83 ec 08             	sub    $0x8,%esp
+ 3ef:	6a 02                	push   $0x2
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 86 03 00 00       	call   77d <futex_wait>
+ 3f7:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fd:	83 ec 08             	sub    $0x8,%esp
+ 400:	6a 02                	push   $0x2
+ 402:	50                   	push   %eax
+ 403:	e8 83 fc ff ff       	call   8b <xchg>
+ 408:	83 c4 10             	add    $0x10,%esp
+ 40b:	85 c0                	test   %eax,%eax
+ 40d:	75 da                	jne    3e9 <cond_wait+0x30>
+}
+ 40f:	90                   	nop
+ 410:	90                   	nop
+ 411:	c9                   	leave
+ 412:	c3                   	ret
+
+00000413 <condbump>:
+{
+ 413:	55                   	push   %ebp
+ 414:	89 e5                	mov    %esp,%ebp
+ 416:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 419:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41c:	8b 00                	mov    (%eax),%eax
+ 41e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 421:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 424:	8d 50 01             	lea    0x1(%eax),%edx
+ 427:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42a:	52                   	push   %edx
+ 42b:	ff 75 fc             	push   -0x4(%ebp)
+ 42e:	50                   	push   %eax
+ 42f:	e8 71 fc ff ff       	call   a5 <cmpxchg>
+ 434:	83 c4 0c             	add    $0xc,%esp
+ 437:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 43a:	75 dd                	jne    419 <condbump+0x6>
+}
+ 43c:	90                   	nop
+ 43d:	90                   	nop
+ 43e:	c9                   	leave
+ 43f:	c3                   	ret
+
+00000440 <cond_signal>:
+{
+ 440:	55                   	push   %ebp
+ 441:	89 e5                	mov    %esp,%ebp
+ 443:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 446:	ff 75 08             	push   0x8(%ebp)
+ 449:	e8 c5 ff ff ff       	call   413 <condbump>
+ 44e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 451:	8b 45 08             	mov    0x8(%ebp),%eax
+ 454:	83 ec 08             	sub    $0x8,%esp
+ 457:	6a 01                	push   $0x1
+ 459:	50                   	push   %eax
+ 45a:	e8 28 03 00 00       	call   787 <futex_wake>
+ 45f:	83 c4 10             	add    $0x10,%esp
+}
+ 462:	90                   	nop
+ 463:	c9                   	leave
+ 464:	c3                   	ret
+
+00000465 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 465:	55                   	push   %ebp
+ 466:	89 e5                	mov    %esp,%ebp
+ 468:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 46b:	ff 75 08             	push   0x8(%ebp)
+ 46e:	e8 a0 ff ff ff       	call   413 <condbump>
+ 473:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 476:	8b 45 08             	mov    0x8(%ebp),%eax
+ 479:	83 ec 08             	sub    $0x8,%esp
+ 47c:	68 ff ff ff 7f       	push   $0x7fffffff
+ 481:	50                   	push   %eax
+ 482:	e8 00 03 00 00       	call   787 <futex_wake>
+ 487:	83 c4 10             	add    $0x10,%esp
+}
+ 48a:	90                   	nop
+ 48b:	c9                   	leave
+ 48c:	c3                   	ret
+
+0000048d <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 48d:	55                   	push   %ebp
+ 48e:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 490:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 495:	8b 00                	mov    (%eax),%eax
+}
+ 497:	5d                   	pop    %ebp
+ 498:	c3                   	ret
+
+00000499 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 499:	55                   	push   %ebp
+ 49a:	89 e5                	mov    %esp,%ebp
+ 49c:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 49f:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 4a4:	8b 00                	mov    (%eax),%eax
+ 4a6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 4a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ad:	74 05                	je     4b4 <vgetpid+0x1b>
+    return pid;
+ 4af:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4b2:	eb 05                	jmp    4b9 <vgetpid+0x20>
+  return getpid();
+ 4b4:	e8 74 02 00 00       	call   72d <getpid>
+}
+ 4b9:	c9                   	leave
+ 4ba:	c3                   	ret
+
+000004bb <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 4bb:	55                   	push   %ebp
+ 4bc:	89 e5                	mov    %esp,%ebp
+ 4be:	57                   	push   %edi
+ 4bf:	56                   	push   %esi
+ 4c0:	53                   	push   %ebx
+ 4c1:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 4c4:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 4cb:	e8 f7 fb ff ff       	call   c7 <rdtsc>
+ 4d0:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4d3:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 4d6:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 4d9:	29 c8                	sub    %ecx,%eax
+ 4db:	19 da                	sbb    %ebx,%edx
+ 4dd:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4e0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 4e3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 4e6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 4e9:	89 d0                	mov    %edx,%eax
+ 4eb:	31 d2                	xor    %edx,%edx
+ 4ed:	89 c1                	mov    %eax,%ecx
+ 4ef:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f7:	8b 40 04             	mov    0x4(%eax),%eax
+ 4fa:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4ff:	89 df                	mov    %ebx,%edi
+ 501:	0f af f8             	imul   %eax,%edi
+ 504:	89 d6                	mov    %edx,%esi
+ 506:	0f af f1             	imul   %ecx,%esi
+ 509:	01 f7                	add    %esi,%edi
+ 50b:	f7 e1                	mul    %ecx
+ 50d:	89 c1                	mov    %eax,%ecx
+ 50f:	89 d3                	mov    %edx,%ebx
+ 511:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 514:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 516:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 519:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 51c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 51f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 526:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 529:	8b 40 04             	mov    0x4(%eax),%eax
+ 52c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 52f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 536:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 539:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 53c:	89 d7                	mov    %edx,%edi
+ 53e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 541:	0f af fe             	imul   %esi,%edi
+ 544:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 54a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 54d:	0f af f0             	imul   %eax,%esi
+ 550:	01 f7                	add    %esi,%edi
+ 552:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 555:	f7 65 d8             	mull   -0x28(%ebp)
+ 558:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 55b:	89 f2                	mov    %esi,%edx
+ 55d:	89 d0                	mov    %edx,%eax
+ 55f:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 561:	01 c8                	add    %ecx,%eax
+ 563:	11 da                	adc    %ebx,%edx
+}
+ 565:	83 c4 24             	add    $0x24,%esp
+ 568:	5b                   	pop    %ebx
+ 569:	5e                   	pop    %esi
+ 56a:	5f                   	pop    %edi
+ 56b:	5d                   	pop    %ebp
+ 56c:	c3                   	ret
+
+0000056d <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 56d:	55                   	push   %ebp
+ 56e:	89 e5                	mov    %esp,%ebp
+ 570:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 573:	8b 45 08             	mov    0x8(%ebp),%eax
+ 576:	8b 50 04             	mov    0x4(%eax),%edx
+ 579:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57c:	8b 00                	mov    (%eax),%eax
+ 57e:	29 c2                	sub    %eax,%edx
+ 580:	83 fa 1f             	cmp    $0x1f,%edx
+ 583:	76 07                	jbe    58c <ring_queue+0x1f>
+    return -1;
+ 585:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 58a:	eb 68                	jmp    5f4 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 58c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58f:	8b 40 04             	mov    0x4(%eax),%eax
+ 592:	83 e0 1f             	and    $0x1f,%eax
+ 595:	89 c2                	mov    %eax,%edx
+ 597:	89 d0                	mov    %edx,%eax
+ 599:	c1 e0 02             	shl    $0x2,%eax
+ 59c:	01 d0                	add    %edx,%eax
+ 59e:	c1 e0 02             	shl    $0x2,%eax
+ 5a1:	8d 50 10             	lea    0x10(%eax),%edx
+ 5a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a7:	01 d0                	add    %edx,%eax
+ 5a9:	83 c0 04             	add    $0x4,%eax
+ 5ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 5af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5b2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5b5:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 5b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5ba:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5bd:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 5c0:	8b 55 14             	mov    0x14(%ebp),%edx
+ 5c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c6:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 5c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5cc:	8b 55 18             	mov    0x18(%ebp),%edx
+ 5cf:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 5d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5d5:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 5d8:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 5db:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 5e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5e3:	8b 40 04             	mov    0x4(%eax),%eax
+ 5e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 5e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ec:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 5ef:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5f4:	c9                   	leave
+ 5f5:	c3                   	ret
+
+000005f6 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 5f6:	55                   	push   %ebp
+ 5f7:	89 e5                	mov    %esp,%ebp
+ 5f9:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 5fc:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 601:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 605:	7f 1a                	jg     621 <ring_submit+0x2b>
+ 607:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60a:	8b 40 10             	mov    0x10(%eax),%eax
+ 60d:	83 e0 01             	and    $0x1,%eax
+ 610:	85 c0                	test   %eax,%eax
+ 612:	74 0d                	je     621 <ring_submit+0x2b>
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	8b 40 10             	mov    0x10(%eax),%eax
+ 61a:	83 e0 02             	and    $0x2,%eax
+ 61d:	85 c0                	test   %eax,%eax
+ 61f:	74 10                	je     631 <ring_submit+0x3b>
+    return ring_enter(min);
+ 621:	83 ec 0c             	sub    $0xc,%esp
+ 624:	ff 75 0c             	push   0xc(%ebp)
+ 627:	e8 83 01 00 00       	call   7af <ring_enter>
+ 62c:	83 c4 10             	add    $0x10,%esp
+ 62f:	eb 10                	jmp    641 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 631:	8b 45 08             	mov    0x8(%ebp),%eax
+ 634:	8b 50 0c             	mov    0xc(%eax),%edx
+ 637:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63a:	8b 40 08             	mov    0x8(%eax),%eax
+ 63d:	29 c2                	sub    %eax,%edx
+ 63f:	89 d0                	mov    %edx,%eax
+}
+ 641:	c9                   	leave
+ 642:	c3                   	ret
+
+00000643 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 643:	55                   	push   %ebp
+ 644:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+ 649:	8b 50 08             	mov    0x8(%eax),%edx
+ 64c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64f:	8b 40 0c             	mov    0xc(%eax),%eax
+ 652:	39 c2                	cmp    %eax,%edx
+ 654:	75 07                	jne    65d <ring_reap+0x1a>
+    return -1;
+ 656:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 65b:	eb 3b                	jmp    698 <ring_reap+0x55>
+  __sync_synchronize();
+ 65d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 662:	8b 45 08             	mov    0x8(%ebp),%eax
+ 665:	8b 40 08             	mov    0x8(%eax),%eax
+ 668:	83 e0 1f             	and    $0x1f,%eax
+ 66b:	89 c2                	mov    %eax,%edx
+ 66d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 670:	8b 45 08             	mov    0x8(%ebp),%eax
+ 673:	83 c2 52             	add    $0x52,%edx
+ 676:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 67a:	8b 02                	mov    (%edx),%eax
+ 67c:	8b 52 04             	mov    0x4(%edx),%edx
+ 67f:	89 01                	mov    %eax,(%ecx)
+ 681:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 684:	8b 45 08             	mov    0x8(%ebp),%eax
+ 687:	8b 40 08             	mov    0x8(%eax),%eax
+ 68a:	8d 50 01             	lea    0x1(%eax),%edx
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 693:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 698:	5d                   	pop    %ebp
+ 699:	c3                   	ret
+
+0000069a <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 69a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 6a1:	74 0a                	je     6ad <usyscall+0x13>
+  movl %esp, %ecx
+ 6a3:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6a5:	ba ac 06 00 00       	mov    $0x6ac,%edx
+  sysenter
+ 6aa:	0f 34                	sysenter
+2:
+  ret
+ 6ac:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 6ad:	cd 40                	int    $0x40
+  ret
+ 6af:	c3                   	ret
+
+000006b0 <fork>:
+
+SYSCALL(fork)
+ 6b0:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6b5:	eb e3                	jmp    69a <usyscall>
+
+000006b7 <exit>:
+SYSCALL(exit)
+ 6b7:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6bc:	eb dc                	jmp    69a <usyscall>
+
+000006be <wait>:
+SYSCALL(wait)
+ 6be:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6c3:	eb d5                	jmp    69a <usyscall>
+
+000006c5 <pipe>:
+SYSCALL(pipe)
+ 6c5:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6ca:	eb ce                	jmp    69a <usyscall>
+
+000006cc <read>:
+SYSCALL(read)
+ 6cc:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6d1:	eb c7                	jmp    69a <usyscall>
+
+000006d3 <write>:
+SYSCALL(write)
+ 6d3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6d8:	eb c0                	jmp    69a <usyscall>
+
+000006da <close>:
+SYSCALL(close)
+ 6da:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6df:	eb b9                	jmp    69a <usyscall>
+
+000006e1 <kill>:
+SYSCALL(kill)
+ 6e1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6e6:	eb b2                	jmp    69a <usyscall>
+
+000006e8 <exec>:
+SYSCALL(exec)
+ 6e8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6ed:	eb ab                	jmp    69a <usyscall>
+
+000006ef <open>:
+SYSCALL(open)
+ 6ef:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6f4:	eb a4                	jmp    69a <usyscall>
+
+000006f6 <mknod>:
+SYSCALL(mknod)
+ 6f6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6fb:	eb 9d                	jmp    69a <usyscall>
+
+000006fd <unlink>:
+SYSCALL(unlink)
+ 6fd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 702:	eb 96                	jmp    69a <usyscall>
+
+00000704 <fstat>:
+SYSCALL(fstat)
+ 704:	b8 08 00 00 00       	mov    $0x8,%eax
+ 709:	eb 8f                	jmp    69a <usyscall>
+
+0000070b <link>:
+SYSCALL(link)
+ 70b:	b8 13 00 00 00       	mov    $0x13,%eax
+ 710:	eb 88                	jmp    69a <usyscall>
+
+00000712 <mkdir>:
+SYSCALL(mkdir)
+ 712:	b8 14 00 00 00       	mov    $0x14,%eax
+ 717:	eb 81                	jmp    69a <usyscall>
+
+00000719 <chdir>:
+SYSCALL(chdir)
+ 719:	b8 09 00 00 00       	mov    $0x9,%eax
+ 71e:	e9 77 ff ff ff       	jmp    69a <usyscall>
+
+00000723 <dup>:
+SYSCALL(dup)
+ 723:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 728:	e9 6d ff ff ff       	jmp    69a <usyscall>
+
+0000072d <getpid>:
+SYSCALL(getpid)
+ 72d:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 732:	e9 63 ff ff ff       	jmp    69a <usyscall>
+
+00000737 <sbrk>:
+SYSCALL(sbrk)
+ 737:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 73c:	e9 59 ff ff ff       	jmp    69a <usyscall>
+
+00000741 <sleep>:
+SYSCALL(sleep)
+ 741:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 746:	e9 4f ff ff ff       	jmp    69a <usyscall>
+
+0000074b <uptime>:
+SYSCALL(uptime)
+ 74b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 750:	e9 45 ff ff ff       	jmp    69a <usyscall>
+
+00000755 <kmstat>:
+SYSCALL(kmstat)
+ 755:	b8 16 00 00 00       	mov    $0x16,%eax
+ 75a:	e9 3b ff ff ff       	jmp    69a <usyscall>
+
+0000075f <setpriority>:
+SYSCALL(setpriority)
+ 75f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 764:	e9 31 ff ff ff       	jmp    69a <usyscall>
+
+00000769 <clone>:
+SYSCALL(clone)
+ 769:	b8 18 00 00 00       	mov    $0x18,%eax
+ 76e:	e9 27 ff ff ff       	jmp    69a <usyscall>
+
+00000773 <join>:
+SYSCALL(join)
+ 773:	b8 19 00 00 00       	mov    $0x19,%eax
+ 778:	e9 1d ff ff ff       	jmp    69a <usyscall>
+
+0000077d <futex_wait>:
+SYSCALL(futex_wait)
+ 77d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 782:	e9 13 ff ff ff       	jmp    69a <usyscall>
+
+00000787 <futex_wake>:
+SYSCALL(futex_wake)
+ 787:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 78c:	e9 09 ff ff ff       	jmp    69a <usyscall>
+
+00000791 <lockstat>:
+SYSCALL(lockstat)
+ 791:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 796:	e9 ff fe ff ff       	jmp    69a <usyscall>
+
+0000079b <sysstat>:
+SYSCALL(sysstat)
+ 79b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7a0:	e9 f5 fe ff ff       	jmp    69a <usyscall>
+
+000007a5 <ring_setup>:
+SYSCALL(ring_setup)
+ 7a5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7aa:	e9 eb fe ff ff       	jmp    69a <usyscall>
+
+000007af <ring_enter>:
+SYSCALL(ring_enter)
+ 7af:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7b4:	e9 e1 fe ff ff       	jmp    69a <usyscall>
+
+000007b9 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7b9:	55                   	push   %ebp
+ 7ba:	89 e5                	mov    %esp,%ebp
+ 7bc:	83 ec 18             	sub    $0x18,%esp
+ 7bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c2:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7c5:	83 ec 04             	sub    $0x4,%esp
+ 7c8:	6a 01                	push   $0x1
+ 7ca:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7cd:	50                   	push   %eax
+ 7ce:	ff 75 08             	push   0x8(%ebp)
+ 7d1:	e8 fd fe ff ff       	call   6d3 <write>
+ 7d6:	83 c4 10             	add    $0x10,%esp
+}
+ 7d9:	90                   	nop
+ 7da:	c9                   	leave
+ 7db:	c3                   	ret
+
+000007dc <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7dc:	55                   	push   %ebp
+ 7dd:	89 e5                	mov    %esp,%ebp
+ 7df:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7e2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7e9:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7ed:	74 17                	je     806 <printint+0x2a>
+ 7ef:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7f3:	79 11                	jns    806 <printint+0x2a>
+    neg = 1;
+ 7f5:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7fc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ff:	f7 d8                	neg    %eax
+ 801:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 804:	eb 06                	jmp    80c <printint+0x30>
+  } else {
+    x = xx;
+ 806:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 809:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 80c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 813:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 816:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 819:	ba 00 00 00 00       	mov    $0x0,%edx
+ 81e:	f7 f1                	div    %ecx
+ 820:	89 d1                	mov    %edx,%ecx
+ 822:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 825:	8d 50 01             	lea    0x1(%eax),%edx
+ 828:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 82b:	0f b6 91 94 11 00 00 	movzbl 0x1194(%ecx),%edx
+ 832:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 836:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 839:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 83c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 841:	f7 f1                	div    %ecx
+ 843:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 846:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 84a:	75 c7                	jne    813 <printint+0x37>
+  if(neg)
+ 84c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 850:	74 2d                	je     87f <printint+0xa3>
+    buf[i++] = '-';
+ 852:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 855:	8d 50 01             	lea    0x1(%eax),%edx
+ 858:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 85b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 860:	eb 1d                	jmp    87f <printint+0xa3>
+    putc(fd, buf[i]);
+ 862:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 865:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 868:	01 d0                	add    %edx,%eax
+ 86a:	0f b6 00             	movzbl (%eax),%eax
+ 86d:	0f be c0             	movsbl %al,%eax
+ 870:	83 ec 08             	sub    $0x8,%esp
+ 873:	50                   	push   %eax
+ 874:	ff 75 08             	push   0x8(%ebp)
+ 877:	e8 3d ff ff ff       	call   7b9 <putc>
+ 87c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 87f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 883:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 887:	79 d9                	jns    862 <printint+0x86>
+}
+ 889:	90                   	nop
+ 88a:	90                   	nop
+ 88b:	c9                   	leave
+ 88c:	c3                   	ret
+
+0000088d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 88d:	55                   	push   %ebp
+ 88e:	89 e5                	mov    %esp,%ebp
+ 890:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 893:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 89a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 89d:	83 c0 04             	add    $0x4,%eax
+ 8a0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8a3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8aa:	e9 59 01 00 00       	jmp    a08 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8af:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8b2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8b5:	01 d0                	add    %edx,%eax
+ 8b7:	0f b6 00             	movzbl (%eax),%eax
+ 8ba:	0f be c0             	movsbl %al,%eax
+ 8bd:	25 ff 00 00 00       	and    $0xff,%eax
+ 8c2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8c9:	75 2c                	jne    8f7 <printf+0x6a>
+      if(c == '%'){
+ 8cb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8cf:	75 0c                	jne    8dd <printf+0x50>
+        state = '%';
+ 8d1:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8d8:	e9 27 01 00 00       	jmp    a04 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8dd:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8e0:	0f be c0             	movsbl %al,%eax
+ 8e3:	83 ec 08             	sub    $0x8,%esp
+ 8e6:	50                   	push   %eax
+ 8e7:	ff 75 08             	push   0x8(%ebp)
+ 8ea:	e8 ca fe ff ff       	call   7b9 <putc>
+ 8ef:	83 c4 10             	add    $0x10,%esp
+ 8f2:	e9 0d 01 00 00       	jmp    a04 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8f7:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8fb:	0f 85 03 01 00 00    	jne    a04 <printf+0x177>
+      if(c == 'd'){
+ 901:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 905:	75 1e                	jne    925 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 907:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 90a:	8b 00                	mov    (%eax),%eax
+ 90c:	6a 01                	push   $0x1
+ 90e:	6a 0a                	push   $0xa
+ 910:	50                   	push   %eax
+ 911:	ff 75 08             	push   0x8(%ebp)
+ 914:	e8 c3 fe ff ff       	call   7dc <printint>
+ 919:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 91c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 920:	e9 d8 00 00 00       	jmp    9fd <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 925:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 929:	74 06                	je     931 <printf+0xa4>
+ 92b:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 92f:	75 1e                	jne    94f <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 931:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 934:	8b 00                	mov    (%eax),%eax
+ 936:	6a 00                	push   $0x0
+ 938:	6a 10                	push   $0x10
+ 93a:	50                   	push   %eax
+ 93b:	ff 75 08             	push   0x8(%ebp)
+ 93e:	e8 99 fe ff ff       	call   7dc <printint>
+ 943:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 946:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 94a:	e9 ae 00 00 00       	jmp    9fd <printf+0x170>
+      } else if(c == 's'){
+ 94f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 953:	75 43                	jne    998 <printf+0x10b>
+        s = (char*)*ap;
+ 955:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 958:	8b 00                	mov    (%eax),%eax
+ 95a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 95d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 961:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 965:	75 25                	jne    98c <printf+0xff>
+          s = "(null)";
+ 967:	c7 45 f4 d5 0c 00 00 	movl   $0xcd5,-0xc(%ebp)
+        while(*s != 0){
+ 96e:	eb 1c                	jmp    98c <printf+0xff>
+          putc(fd, *s);
+ 970:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 973:	0f b6 00             	movzbl (%eax),%eax
+ 976:	0f be c0             	movsbl %al,%eax
+ 979:	83 ec 08             	sub    $0x8,%esp
+ 97c:	50                   	push   %eax
+ 97d:	ff 75 08             	push   0x8(%ebp)
+ 980:	e8 34 fe ff ff       	call   7b9 <putc>
+ 985:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 988:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 98c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 98f:	0f b6 00             	movzbl (%eax),%eax
+ 992:	84 c0                	test   %al,%al
+ 994:	75 da                	jne    970 <printf+0xe3>
+ 996:	eb 65                	jmp    9fd <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 998:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 99c:	75 1d                	jne    9bb <printf+0x12e>
+        putc(fd, *ap);
+ 99e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9a1:	8b 00                	mov    (%eax),%eax
+ 9a3:	0f be c0             	movsbl %al,%eax
+ 9a6:	83 ec 08             	sub    $0x8,%esp
+ 9a9:	50                   	push   %eax
+ 9aa:	ff 75 08             	push   0x8(%ebp)
+ 9ad:	e8 07 fe ff ff       	call   7b9 <putc>
+ 9b2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9b5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9b9:	eb 42                	jmp    9fd <printf+0x170>
+      } else if(c == '%'){
+ 9bb:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9bf:	75 17                	jne    9d8 <printf+0x14b>
+        putc(fd, c);
+ 9c1:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9c4:	0f be c0             	movsbl %al,%eax
+ 9c7:	83 ec 08             	sub    $0x8,%esp
+ 9ca:	50                   	push   %eax
+ 9cb:	ff 75 08             	push   0x8(%ebp)
+ 9ce:	e8 e6 fd ff ff       	call   7b9 <putc>
+ 9d3:	83 c4 10             	add    $0x10,%esp
+ 9d6:	eb 25                	jmp    9fd <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9d8:	83 ec 08             	sub    $0x8,%esp
+ 9db:	6a 25                	push   $0x25
+ 9dd:	ff 75 08             	push   0x8(%ebp)
+ 9e0:	e8 d4 fd ff ff       	call   7b9 <putc>
+ 9e5:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9e8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9eb:	0f be c0             	movsbl %al,%eax
+ 9ee:	83 ec 08             	sub    $0x8,%esp
+ 9f1:	50                   	push   %eax
+ 9f2:	ff 75 08             	push   0x8(%ebp)
+ 9f5:	e8 bf fd ff ff       	call   7b9 <putc>
+ 9fa:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9fd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a04:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a08:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a0b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0e:	01 d0                	add    %edx,%eax
+ a10:	0f b6 00             	movzbl (%eax),%eax
+ a13:	84 c0                	test   %al,%al
+ a15:	0f 85 94 fe ff ff    	jne    8af <printf+0x22>
+    }
+  }
+}
+ a1b:	90                   	nop
+ a1c:	90                   	nop
+ a1d:	c9                   	leave
+ a1e:	c3                   	ret
+
+00000a1f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a1f:	55                   	push   %ebp
+ a20:	89 e5                	mov    %esp,%ebp
+ a22:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a25:	8b 45 08             	mov    0x8(%ebp),%eax
+ a28:	83 e8 08             	sub    $0x8,%eax
+ a2b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a2e:	a1 b0 11 00 00       	mov    0x11b0,%eax
+ a33:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a36:	eb 24                	jmp    a5c <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a38:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a3b:	8b 00                	mov    (%eax),%eax
+ a3d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a40:	72 12                	jb     a54 <free+0x35>
+ a42:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a45:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a48:	72 24                	jb     a6e <free+0x4f>
+ a4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4d:	8b 00                	mov    (%eax),%eax
+ a4f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a52:	72 1a                	jb     a6e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a54:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a57:	8b 00                	mov    (%eax),%eax
+ a59:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a5c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a5f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a62:	73 d4                	jae    a38 <free+0x19>
+ a64:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a67:	8b 00                	mov    (%eax),%eax
+ a69:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a6c:	73 ca                	jae    a38 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a6e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a71:	8b 40 04             	mov    0x4(%eax),%eax
+ a74:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a7b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a7e:	01 c2                	add    %eax,%edx
+ a80:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a83:	8b 00                	mov    (%eax),%eax
+ a85:	39 c2                	cmp    %eax,%edx
+ a87:	75 24                	jne    aad <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a89:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8c:	8b 50 04             	mov    0x4(%eax),%edx
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	8b 00                	mov    (%eax),%eax
+ a94:	8b 40 04             	mov    0x4(%eax),%eax
+ a97:	01 c2                	add    %eax,%edx
+ a99:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a9f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa2:	8b 00                	mov    (%eax),%eax
+ aa4:	8b 10                	mov    (%eax),%edx
+ aa6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa9:	89 10                	mov    %edx,(%eax)
+ aab:	eb 0a                	jmp    ab7 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ aad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab0:	8b 10                	mov    (%eax),%edx
+ ab2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab5:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ab7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aba:	8b 40 04             	mov    0x4(%eax),%eax
+ abd:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ac4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac7:	01 d0                	add    %edx,%eax
+ ac9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ acc:	75 20                	jne    aee <free+0xcf>
+    p->s.size += bp->s.size;
+ ace:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad1:	8b 50 04             	mov    0x4(%eax),%edx
+ ad4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad7:	8b 40 04             	mov    0x4(%eax),%eax
+ ada:	01 c2                	add    %eax,%edx
+ adc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ adf:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ ae2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae5:	8b 10                	mov    (%eax),%edx
+ ae7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aea:	89 10                	mov    %edx,(%eax)
+ aec:	eb 08                	jmp    af6 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ aee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ af4:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ af6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af9:	a3 b0 11 00 00       	mov    %eax,0x11b0
+}
+ afe:	90                   	nop
+ aff:	c9                   	leave
+ b00:	c3                   	ret
+
+00000b01 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b01:	55                   	push   %ebp
+ b02:	89 e5                	mov    %esp,%ebp
+ b04:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b07:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b0e:	77 07                	ja     b17 <morecore+0x16>
+    nu = 4096;
+ b10:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b17:	8b 45 08             	mov    0x8(%ebp),%eax
+ b1a:	c1 e0 03             	shl    $0x3,%eax
+ b1d:	83 ec 0c             	sub    $0xc,%esp
+ b20:	50                   	push   %eax
+ b21:	e8 11 fc ff ff       	call   737 <sbrk>
+ b26:	83 c4 10             	add    $0x10,%esp
+ b29:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b2c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b30:	75 07                	jne    b39 <morecore+0x38>
+    return 0;
+ b32:	b8 00 00 00 00       	mov    $0x0,%eax
+ b37:	eb 26                	jmp    b5f <morecore+0x5e>
+  hp = (Header*)p;
+ b39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b3c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b3f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b42:	8b 55 08             	mov    0x8(%ebp),%edx
+ b45:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b48:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4b:	83 c0 08             	add    $0x8,%eax
+ b4e:	83 ec 0c             	sub    $0xc,%esp
+ b51:	50                   	push   %eax
+ b52:	e8 c8 fe ff ff       	call   a1f <free>
+ b57:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b5a:	a1 b0 11 00 00       	mov    0x11b0,%eax
+}
+ b5f:	c9                   	leave
+ b60:	c3                   	ret
+
+00000b61 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b61:	55                   	push   %ebp
+ b62:	89 e5                	mov    %esp,%ebp
+ b64:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b67:	8b 45 08             	mov    0x8(%ebp),%eax
+ b6a:	83 c0 07             	add    $0x7,%eax
+ b6d:	c1 e8 03             	shr    $0x3,%eax
+ b70:	83 c0 01             	add    $0x1,%eax
+ b73:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b76:	a1 b0 11 00 00       	mov    0x11b0,%eax
+ b7b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b7e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b82:	75 23                	jne    ba7 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b84:	c7 45 f0 a8 11 00 00 	movl   $0x11a8,-0x10(%ebp)
+ b8b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b8e:	a3 b0 11 00 00       	mov    %eax,0x11b0
+ b93:	a1 b0 11 00 00       	mov    0x11b0,%eax
+ b98:	a3 a8 11 00 00       	mov    %eax,0x11a8
+    base.s.size = 0;
+ b9d:	c7 05 ac 11 00 00 00 	movl   $0x0,0x11ac
+ ba4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ba7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ baa:	8b 00                	mov    (%eax),%eax
+ bac:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ baf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb2:	8b 40 04             	mov    0x4(%eax),%eax
+ bb5:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bb8:	72 4d                	jb     c07 <malloc+0xa6>
+      if(p->s.size == nunits)
+ bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bbd:	8b 40 04             	mov    0x4(%eax),%eax
+ bc0:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bc3:	75 0c                	jne    bd1 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc8:	8b 10                	mov    (%eax),%edx
+ bca:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bcd:	89 10                	mov    %edx,(%eax)
+ bcf:	eb 26                	jmp    bf7 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ bd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd4:	8b 40 04             	mov    0x4(%eax),%eax
+ bd7:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ bda:	89 c2                	mov    %eax,%edx
+ bdc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdf:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ be2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be5:	8b 40 04             	mov    0x4(%eax),%eax
+ be8:	c1 e0 03             	shl    $0x3,%eax
+ beb:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bf4:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ bf7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bfa:	a3 b0 11 00 00       	mov    %eax,0x11b0
+      return (void*)(p + 1);
+ bff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c02:	83 c0 08             	add    $0x8,%eax
+ c05:	eb 3b                	jmp    c42 <malloc+0xe1>
+    }
+    if(p == freep)
+ c07:	a1 b0 11 00 00       	mov    0x11b0,%eax
+ c0c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c0f:	75 1e                	jne    c2f <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c11:	83 ec 0c             	sub    $0xc,%esp
+ c14:	ff 75 ec             	push   -0x14(%ebp)
+ c17:	e8 e5 fe ff ff       	call   b01 <morecore>
+ c1c:	83 c4 10             	add    $0x10,%esp
+ c1f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c22:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c26:	75 07                	jne    c2f <malloc+0xce>
+        return 0;
+ c28:	b8 00 00 00 00       	mov    $0x0,%eax
+ c2d:	eb 13                	jmp    c42 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c32:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c35:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c38:	8b 00                	mov    (%eax),%eax
+ c3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c3d:	e9 6d ff ff ff       	jmp    baf <malloc+0x4e>
+  }
+}
+ c42:	c9                   	leave
+ c43:	c3                   	ret
+
+00000c44 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c44:	55                   	push   %ebp
+ c45:	89 e5                	mov    %esp,%ebp
+ c47:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ c4a:	83 ec 0c             	sub    $0xc,%esp
+ c4d:	68 00 10 00 00       	push   $0x1000
+ c52:	e8 0a ff ff ff       	call   b61 <malloc>
+ c57:	83 c4 10             	add    $0x10,%esp
+ c5a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c5d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c61:	75 07                	jne    c6a <thread_create+0x26>
+    return -1;
+ c63:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c68:	eb 2e                	jmp    c98 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ c6a:	83 ec 04             	sub    $0x4,%esp
+ c6d:	ff 75 f4             	push   -0xc(%ebp)
+ c70:	ff 75 0c             	push   0xc(%ebp)
+ c73:	ff 75 08             	push   0x8(%ebp)
+ c76:	e8 ee fa ff ff       	call   769 <clone>
+ c7b:	83 c4 10             	add    $0x10,%esp
+ c7e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c81:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c85:	79 0e                	jns    c95 <thread_create+0x51>
+    free(stack);
+ c87:	83 ec 0c             	sub    $0xc,%esp
+ c8a:	ff 75 f4             	push   -0xc(%ebp)
+ c8d:	e8 8d fd ff ff       	call   a1f <free>
+ c92:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ c95:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ c98:	c9                   	leave
+ c99:	c3                   	ret
+
+00000c9a <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ c9a:	55                   	push   %ebp
+ c9b:	89 e5                	mov    %esp,%ebp
+ c9d:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ca0:	83 ec 0c             	sub    $0xc,%esp
+ ca3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ca6:	50                   	push   %eax
+ ca7:	e8 c7 fa ff ff       	call   773 <join>
+ cac:	83 c4 10             	add    $0x10,%esp
+ caf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cb2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cb6:	78 0f                	js     cc7 <thread_join+0x2d>
+    free(stack);
+ cb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cbb:	83 ec 0c             	sub    $0xc,%esp
+ cbe:	50                   	push   %eax
+ cbf:	e8 5b fd ff ff       	call   a1f <free>
+ cc4:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ cc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ cca:	c9                   	leave
+ ccb:	c3                   	ret
@@ -2,6 +2,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "defs.h"
 #include "x86.h"
@@ -18,9 +19,14 @@ exec(char *path, char **argv)
   struct proghdr ph;
   pde_t *pgdir, *oldpgdir;
 
+  // The other threads would be left running in the old image.
+  // A ring's poller is stopped below instead.
+  if(proc->leader->nthreads > 1 + (proc->leader->ringpoll != 0))
+    return -1;
+
   if((ip = namei(path)) == 0)
     return -1;
-  ilock(ip);
+  ilockshared(ip);
   pgdir = 0;
 
   // Check ELF header
@@ -31,6 +37,8 @@ exec(char *path, char **argv)
 
   if((pgdir = setupkvm()) == 0)
     goto bad;
+  if(mapvdso(pgdir, proc->pid) < 0)
+    goto bad;
 
   // Load program into memory.
   sz = 0;
@@ -83,9 +91,11 @@ exec(char *path, char **argv)
   safestrcpy(proc->name, last, sizeof(proc->name));
 
   // Commit to the user image.
+  ringstop();
   oldpgdir = proc->pgdir;
   proc->pgdir = pgdir;
   proc->sz = sz;
+  fpuexec();
   proc->tf->eip = elf.entry;  // main
   proc->tf->esp = sp;
   switchuvm(proc);
@@ -14,7 +14,9 @@ struct inode {
   uint dev;           // Device number
   uint inum;          // Inode number
   int ref;            // Reference count
-  int flags;          // I_BUSY, I_VALID
+  struct inode *next; // on icache list
+  struct sleeplock lock;  // protects everything below here
+  int flags;          // I_VALID
 
   short type;         // copy of disk inode
   short major;
@@ -23,7 +25,6 @@ struct inode {
   uint size;
   uint addrs[NDIRECT+1];
 };
-#define I_BUSY 0x1
 #define I_VALID 0x2
 
 // table mapping major device number to
@@ -0,0 +1,1231 @@
+
+_forktest:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printf>:
+
+#define N  1000
+
+void
+printf(int fd, char *s, ...)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  write(fd, s, strlen(s));
+   6:	83 ec 0c             	sub    $0xc,%esp
+   9:	ff 75 0c             	push   0xc(%ebp)
+   c:	e8 de 01 00 00       	call   1ef <strlen>
+  11:	83 c4 10             	add    $0x10,%esp
+  14:	83 ec 04             	sub    $0x4,%esp
+  17:	50                   	push   %eax
+  18:	ff 75 0c             	push   0xc(%ebp)
+  1b:	ff 75 08             	push   0x8(%ebp)
+  1e:	e8 53 07 00 00       	call   776 <write>
+  23:	83 c4 10             	add    $0x10,%esp
+}
+  26:	90                   	nop
+  27:	c9                   	leave
+  28:	c3                   	ret
+
+00000029 <forktest>:
+
+void
+forktest(void)
+{
+  29:	55                   	push   %ebp
+  2a:	89 e5                	mov    %esp,%ebp
+  2c:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 5c 08 00 00       	push   $0x85c
+  37:	6a 01                	push   $0x1
+  39:	e8 c2 ff ff ff       	call   0 <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<N; n++){
+  41:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  48:	eb 1d                	jmp    67 <forktest+0x3e>
+    pid = fork();
+  4a:	e8 04 07 00 00       	call   753 <fork>
+  4f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+  52:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  56:	78 1a                	js     72 <forktest+0x49>
+      break;
+    if(pid == 0)
+  58:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  5c:	75 05                	jne    63 <forktest+0x3a>
+      exit();
+  5e:	e8 f7 06 00 00       	call   75a <exit>
+  for(n=0; n<N; n++){
+  63:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  67:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+  6e:	7e da                	jle    4a <forktest+0x21>
+  70:	eb 01                	jmp    73 <forktest+0x4a>
+      break;
+  72:	90                   	nop
+  }
+  
+  if(n == N){
+  73:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+  7a:	75 40                	jne    bc <forktest+0x93>
+    printf(1, "fork claimed to work N times!\n", N);
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	68 e8 03 00 00       	push   $0x3e8
+  84:	68 68 08 00 00       	push   $0x868
+  89:	6a 01                	push   $0x1
+  8b:	e8 70 ff ff ff       	call   0 <printf>
+  90:	83 c4 10             	add    $0x10,%esp
+    exit();
+  93:	e8 c2 06 00 00       	call   75a <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+  98:	e8 c4 06 00 00       	call   761 <wait>
+  9d:	85 c0                	test   %eax,%eax
+  9f:	79 17                	jns    b8 <forktest+0x8f>
+      printf(1, "wait stopped early\n");
+  a1:	83 ec 08             	sub    $0x8,%esp
+  a4:	68 87 08 00 00       	push   $0x887
+  a9:	6a 01                	push   $0x1
+  ab:	e8 50 ff ff ff       	call   0 <printf>
+  b0:	83 c4 10             	add    $0x10,%esp
+      exit();
+  b3:	e8 a2 06 00 00       	call   75a <exit>
+  for(; n > 0; n--){
+  b8:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  c0:	7f d6                	jg     98 <forktest+0x6f>
+    }
+  }
+  
+  if(wait() != -1){
+  c2:	e8 9a 06 00 00       	call   761 <wait>
+  c7:	83 f8 ff             	cmp    $0xffffffff,%eax
+  ca:	74 17                	je     e3 <forktest+0xba>
+    printf(1, "wait got too many\n");
+  cc:	83 ec 08             	sub    $0x8,%esp
+  cf:	68 9b 08 00 00       	push   $0x89b
+  d4:	6a 01                	push   $0x1
+  d6:	e8 25 ff ff ff       	call   0 <printf>
+  db:	83 c4 10             	add    $0x10,%esp
+    exit();
+  de:	e8 77 06 00 00       	call   75a <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+  e3:	83 ec 08             	sub    $0x8,%esp
+  e6:	68 ae 08 00 00       	push   $0x8ae
+  eb:	6a 01                	push   $0x1
+  ed:	e8 0e ff ff ff       	call   0 <printf>
+  f2:	83 c4 10             	add    $0x10,%esp
+}
+  f5:	90                   	nop
+  f6:	c9                   	leave
+  f7:	c3                   	ret
+
+000000f8 <main>:
+
+int
+main(void)
+{
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	83 e4 f0             	and    $0xfffffff0,%esp
+  forktest();
+  fe:	e8 26 ff ff ff       	call   29 <forktest>
+  exit();
+ 103:	e8 52 06 00 00       	call   75a <exit>
+
+00000108 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	57                   	push   %edi
+ 10c:	53                   	push   %ebx
+char*
+ 10d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 110:	8b 55 10             	mov    0x10(%ebp),%edx
+ 113:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 116:	89 cb                	mov    %ecx,%ebx
+ 118:	89 df                	mov    %ebx,%edi
+ 11a:	89 d1                	mov    %edx,%ecx
+ 11c:	fc                   	cld
+ 11d:	f3 aa                	rep stos %al,%es:(%edi)
+ 11f:	89 ca                	mov    %ecx,%edx
+ 121:	89 fb                	mov    %edi,%ebx
+ 123:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 126:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 129:	90                   	nop
+ 12a:	5b                   	pop    %ebx
+ 12b:	5f                   	pop    %edi
+ 12c:	5d                   	pop    %ebp
+ 12d:	c3                   	ret
+
+0000012e <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 12e:	55                   	push   %ebp
+ 12f:	89 e5                	mov    %esp,%ebp
+ 131:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 134:	8b 55 08             	mov    0x8(%ebp),%edx
+ 137:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13d:	f0 87 02             	lock xchg %eax,(%edx)
+ 140:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 143:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 146:	c9                   	leave
+ 147:	c3                   	ret
+
+00000148 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 148:	55                   	push   %ebp
+ 149:	89 e5                	mov    %esp,%ebp
+ 14b:	53                   	push   %ebx
+ 14c:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 14f:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 152:	8b 55 10             	mov    0x10(%ebp),%edx
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15b:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 15f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 162:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 165:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 168:	c9                   	leave
+ 169:	c3                   	ret
+
+0000016a <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 16a:	55                   	push   %ebp
+ 16b:	89 e5                	mov    %esp,%ebp
+ 16d:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 170:	0f 31                	rdtsc
+ 172:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 175:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 178:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 17b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 17e:	c9                   	leave
+ 17f:	c3                   	ret
+
+00000180 <strcpy>:
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+ 183:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 186:	8b 45 08             	mov    0x8(%ebp),%eax
+ 189:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 18c:	90                   	nop
+ 18d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 190:	8d 42 01             	lea    0x1(%edx),%eax
+ 193:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 196:	8b 45 08             	mov    0x8(%ebp),%eax
+ 199:	8d 48 01             	lea    0x1(%eax),%ecx
+ 19c:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 19f:	0f b6 12             	movzbl (%edx),%edx
+ 1a2:	88 10                	mov    %dl,(%eax)
+ 1a4:	0f b6 00             	movzbl (%eax),%eax
+ 1a7:	84 c0                	test   %al,%al
+ 1a9:	75 e2                	jne    18d <strcpy+0xd>
+  return os;
+ 1ab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1ae:	c9                   	leave
+ 1af:	c3                   	ret
+
+000001b0 <strcmp>:
+{
+ 1b0:	55                   	push   %ebp
+ 1b1:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1b3:	eb 08                	jmp    1bd <strcmp+0xd>
+    p++, q++;
+ 1b5:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b9:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c0:	0f b6 00             	movzbl (%eax),%eax
+ 1c3:	84 c0                	test   %al,%al
+ 1c5:	74 10                	je     1d7 <strcmp+0x27>
+ 1c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ca:	0f b6 10             	movzbl (%eax),%edx
+ 1cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1d0:	0f b6 00             	movzbl (%eax),%eax
+ 1d3:	38 c2                	cmp    %al,%dl
+ 1d5:	74 de                	je     1b5 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1da:	0f b6 00             	movzbl (%eax),%eax
+ 1dd:	0f b6 d0             	movzbl %al,%edx
+ 1e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1e3:	0f b6 00             	movzbl (%eax),%eax
+ 1e6:	0f b6 c0             	movzbl %al,%eax
+ 1e9:	29 c2                	sub    %eax,%edx
+ 1eb:	89 d0                	mov    %edx,%eax
+}
+ 1ed:	5d                   	pop    %ebp
+ 1ee:	c3                   	ret
+
+000001ef <strlen>:
+{
+ 1ef:	55                   	push   %ebp
+ 1f0:	89 e5                	mov    %esp,%ebp
+ 1f2:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1f5:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1fc:	eb 04                	jmp    202 <strlen+0x13>
+ 1fe:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 202:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 205:	8b 45 08             	mov    0x8(%ebp),%eax
+ 208:	01 d0                	add    %edx,%eax
+ 20a:	0f b6 00             	movzbl (%eax),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	75 ed                	jne    1fe <strlen+0xf>
+  return n;
+ 211:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 214:	c9                   	leave
+ 215:	c3                   	ret
+
+00000216 <memset>:
+{
+ 216:	55                   	push   %ebp
+ 217:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 219:	8b 45 10             	mov    0x10(%ebp),%eax
+ 21c:	50                   	push   %eax
+ 21d:	ff 75 0c             	push   0xc(%ebp)
+ 220:	ff 75 08             	push   0x8(%ebp)
+ 223:	e8 e0 fe ff ff       	call   108 <stosb>
+ 228:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 22b:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 22e:	c9                   	leave
+ 22f:	c3                   	ret
+
+00000230 <strchr>:
+{
+ 230:	55                   	push   %ebp
+ 231:	89 e5                	mov    %esp,%ebp
+ 233:	83 ec 04             	sub    $0x4,%esp
+ 236:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 239:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 23c:	eb 14                	jmp    252 <strchr+0x22>
+    if(*s == c)
+ 23e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 241:	0f b6 00             	movzbl (%eax),%eax
+ 244:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 247:	75 05                	jne    24e <strchr+0x1e>
+      return (char*)s;
+ 249:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24c:	eb 13                	jmp    261 <strchr+0x31>
+  for(; *s; s++)
+ 24e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 252:	8b 45 08             	mov    0x8(%ebp),%eax
+ 255:	0f b6 00             	movzbl (%eax),%eax
+ 258:	84 c0                	test   %al,%al
+ 25a:	75 e2                	jne    23e <strchr+0xe>
+  return 0;
+ 25c:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 261:	c9                   	leave
+ 262:	c3                   	ret
+
+00000263 <gets>:
+{
+ 263:	55                   	push   %ebp
+ 264:	89 e5                	mov    %esp,%ebp
+ 266:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 269:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 270:	eb 42                	jmp    2b4 <gets+0x51>
+    cc = read(0, &c, 1);
+ 272:	83 ec 04             	sub    $0x4,%esp
+ 275:	6a 01                	push   $0x1
+ 277:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 27a:	50                   	push   %eax
+ 27b:	6a 00                	push   $0x0
+ 27d:	e8 ed 04 00 00       	call   76f <read>
+ 282:	83 c4 10             	add    $0x10,%esp
+ 285:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 288:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 28c:	7e 33                	jle    2c1 <gets+0x5e>
+    buf[i++] = c;
+ 28e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 291:	8d 50 01             	lea    0x1(%eax),%edx
+ 294:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 297:	89 c2                	mov    %eax,%edx
+ 299:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29c:	01 c2                	add    %eax,%edx
+ 29e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a2:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2a4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a8:	3c 0a                	cmp    $0xa,%al
+ 2aa:	74 16                	je     2c2 <gets+0x5f>
+ 2ac:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2b0:	3c 0d                	cmp    $0xd,%al
+ 2b2:	74 0e                	je     2c2 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b7:	83 c0 01             	add    $0x1,%eax
+ 2ba:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2bd:	7f b3                	jg     272 <gets+0xf>
+ 2bf:	eb 01                	jmp    2c2 <gets+0x5f>
+      break;
+ 2c1:	90                   	nop
+  buf[i] = '\0';
+ 2c2:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2c5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c8:	01 d0                	add    %edx,%eax
+ 2ca:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2cd:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2d0:	c9                   	leave
+ 2d1:	c3                   	ret
+
+000002d2 <stat>:
+{
+ 2d2:	55                   	push   %ebp
+ 2d3:	89 e5                	mov    %esp,%ebp
+ 2d5:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2d8:	83 ec 08             	sub    $0x8,%esp
+ 2db:	6a 00                	push   $0x0
+ 2dd:	ff 75 08             	push   0x8(%ebp)
+ 2e0:	e8 ad 04 00 00       	call   792 <open>
+ 2e5:	83 c4 10             	add    $0x10,%esp
+ 2e8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2eb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2ef:	79 07                	jns    2f8 <stat+0x26>
+    return -1;
+ 2f1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2f6:	eb 25                	jmp    31d <stat+0x4b>
+  r = fstat(fd, st);
+ 2f8:	83 ec 08             	sub    $0x8,%esp
+ 2fb:	ff 75 0c             	push   0xc(%ebp)
+ 2fe:	ff 75 f4             	push   -0xc(%ebp)
+ 301:	e8 a1 04 00 00       	call   7a7 <fstat>
+ 306:	83 c4 10             	add    $0x10,%esp
+ 309:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 30c:	83 ec 0c             	sub    $0xc,%esp
+ 30f:	ff 75 f4             	push   -0xc(%ebp)
+ 312:	e8 66 04 00 00       	call   77d <close>
+ 317:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 31a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 31d:	c9                   	leave
+ 31e:	c3                   	ret
+
+0000031f <atoi>:
+{
+ 31f:	55                   	push   %ebp
+ 320:	89 e5                	mov    %esp,%ebp
+ 322:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 325:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 32c:	eb 25                	jmp    353 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 32e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 331:	89 d0                	mov    %edx,%eax
+ 333:	c1 e0 02             	shl    $0x2,%eax
+ 336:	01 d0                	add    %edx,%eax
+ 338:	01 c0                	add    %eax,%eax
+ 33a:	89 c1                	mov    %eax,%ecx
+ 33c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 33f:	8d 50 01             	lea    0x1(%eax),%edx
+ 342:	89 55 08             	mov    %edx,0x8(%ebp)
+ 345:	0f b6 00             	movzbl (%eax),%eax
+ 348:	0f be c0             	movsbl %al,%eax
+ 34b:	01 c8                	add    %ecx,%eax
+ 34d:	83 e8 30             	sub    $0x30,%eax
+ 350:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 353:	8b 45 08             	mov    0x8(%ebp),%eax
+ 356:	0f b6 00             	movzbl (%eax),%eax
+ 359:	3c 2f                	cmp    $0x2f,%al
+ 35b:	7e 0a                	jle    367 <atoi+0x48>
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 360:	0f b6 00             	movzbl (%eax),%eax
+ 363:	3c 39                	cmp    $0x39,%al
+ 365:	7e c7                	jle    32e <atoi+0xf>
+  return n;
+ 367:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 36a:	c9                   	leave
+ 36b:	c3                   	ret
+
+0000036c <memmove>:
+{
+ 36c:	55                   	push   %ebp
+ 36d:	89 e5                	mov    %esp,%ebp
+ 36f:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+ 375:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 378:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 37b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 37e:	eb 17                	jmp    397 <memmove+0x2b>
+    *dst++ = *src++;
+ 380:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 383:	8d 42 01             	lea    0x1(%edx),%eax
+ 386:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 389:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 38c:	8d 48 01             	lea    0x1(%eax),%ecx
+ 38f:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 392:	0f b6 12             	movzbl (%edx),%edx
+ 395:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 397:	8b 45 10             	mov    0x10(%ebp),%eax
+ 39a:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 39d:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3a0:	85 c0                	test   %eax,%eax
+ 3a2:	7f dc                	jg     380 <memmove+0x14>
+  return vdst;
+ 3a4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a7:	c9                   	leave
+ 3a8:	c3                   	ret
+
+000003a9 <mutex_init>:
+{
+ 3a9:	55                   	push   %ebp
+ 3aa:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3af:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3b5:	90                   	nop
+ 3b6:	5d                   	pop    %ebp
+ 3b7:	c3                   	ret
+
+000003b8 <mutex_lock>:
+{
+ 3b8:	55                   	push   %ebp
+ 3b9:	89 e5                	mov    %esp,%ebp
+ 3bb:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c1:	6a 01                	push   $0x1
+ 3c3:	6a 00                	push   $0x0
+ 3c5:	50                   	push   %eax
+ 3c6:	e8 7d fd ff ff       	call   148 <cmpxchg>
+ 3cb:	83 c4 0c             	add    $0xc,%esp
+ 3ce:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3d1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3d5:	74 46                	je     41d <mutex_lock+0x65>
+  if(c != 2)
+ 3d7:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 3db:	74 38                	je     415 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e0:	6a 02                	push   $0x2
+ 3e2:	50                   	push   %eax
+ 3e3:	e8 46 fd ff ff       	call   12e <xchg>
+ 3e8:	83 c4 08             	add    $0x8,%esp
+ 3eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 3ee:	eb 25                	jmp    415 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 3f0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f3:	83 ec 08             	sub    $0x8,%esp
+ 3f6:	6a 02                	push   $0x2
+ 3f8:	50                   	push   %eax
+ 3f9:	e8 22 04 00 00       	call   820 <futex_wait>
+ 3fe:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 401:	8b 45 08             	mov    0x8(%ebp),%eax
+ 404:	83 ec 08             	sub    $0x8,%esp
+ 407:	6a 02                	push   $0x2
+ 409:	50                   	push   %eax
+ 40a:	e8 1f fd ff ff       	call   12e <xchg>
+ 40f:	83 c4 10             	add    $0x10,%esp
+ 412:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 415:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 419:	75 d5                	jne    3f0 <mutex_lock+0x38>
+ 41b:	eb 01                	jmp    41e <mutex_lock+0x66>
+    return;
+ 41d:	90                   	nop
+}
+ 41e:	c9                   	leave
+ 41f:	c3                   	ret
+
+00000420 <mutex_unlock>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+ 429:	6a 00                	push   $0x0
+ 42b:	50                   	push   %eax
+ 42c:	e8 fd fc ff ff       	call   12e <xchg>
+ 431:	83 c4 08             	add    $0x8,%esp
+ 434:	83 f8 02             	cmp    $0x2,%eax
+ 437:	75 11                	jne    44a <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 439:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43c:	83 ec 08             	sub    $0x8,%esp
+ 43f:	6a 01                	push   $0x1
+ 441:	50                   	push   %eax
+ 442:	e8 e3 03 00 00       	call   82a <futex_wake>
+ 447:	83 c4 10             	add    $0x10,%esp
+}
+ 44a:	90                   	nop
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <cond_init>:
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 450:	8b 45 08             	mov    0x8(%ebp),%eax
+ 453:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 459:	90                   	nop
+ 45a:	5d                   	pop    %ebp
+ 45b:	c3                   	ret
+
+0000045c <cond_wait>:
+{
+ 45c:	55                   	push   %ebp
+ 45d:	89 e5                	mov    %esp,%ebp
+ 45f:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 462:	8b 45 08             	mov    0x8(%ebp),%eax
+ 465:	8b 00                	mov    (%eax),%eax
+ 467:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 46a:	83 ec 0c             	sub    $0xc,%esp
+ 46d:	ff 75 0c             	push   0xc(%ebp)
+ 470:	e8 ab ff ff ff       	call   420 <mutex_unlock>
+ 475:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 478:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47b:	83 ec 08             	sub    $0x8,%esp
+ 47e:	ff 75 f4             	push   -0xc(%ebp)
+ 481:	50                   	push   %eax
+ 482:	e8 99 03 00 00       	call   820 <futex_wait>
+ 487:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 48a:	eb 11                	jmp    49d <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 48c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 48f:	83 ec 08             	sub    $0x8,%esp
+ 492:	6a 02                	push   $0x2
+ 494:	50                   	push   %eax
+ 495:	e8 86 03 00 00       	call   820 <futex_wait>
+ 49a:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 49d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4a0:	83 ec 08             	sub    $0x8,%esp
+ 4a3:	6a 02                	push   $0x2
+ 4a5:	50                   	push   %eax
+ 4a6:	e8 83 fc ff ff       	call   12e <xchg>
+ 4ab:	83 c4 10             	add    $0x10,%esp
+ 4ae:	85 c0                	test   %eax,%eax
+ 4b0:	75 da                	jne    48c <cond_wait+0x30>
+}
+ 4b2:	90                   	nop
+ 4b3:	90                   	nop
+ 4b4:	c9                   	leave
+ 4b5:	c3                   	ret
+
+000004b6 <condbump>:
+{
+ 4b6:	55                   	push   %ebp
+ 4b7:	89 e5                	mov    %esp,%ebp
+ 4b9:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 4bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4bf:	8b 00                	mov    (%eax),%eax
+ 4c1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cd:	52                   	push   %edx
+ 4ce:	ff 75 fc             	push   -0x4(%ebp)
+ 4d1:	50                   	push   %eax
+ 4d2:	e8 71 fc ff ff       	call   148 <cmpxchg>
+ 4d7:	83 c4 0c             	add    $0xc,%esp
+ 4da:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 4dd:	75 dd                	jne    4bc <condbump+0x6>
+}
+ 4df:	90                   	nop
+ 4e0:	90                   	nop
+ 4e1:	c9                   	leave
+ 4e2:	c3                   	ret
+
+000004e3 <cond_signal>:
+{
+ 4e3:	55                   	push   %ebp
+ 4e4:	89 e5                	mov    %esp,%ebp
+ 4e6:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 4e9:	ff 75 08             	push   0x8(%ebp)
+ 4ec:	e8 c5 ff ff ff       	call   4b6 <condbump>
+ 4f1:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 4f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f7:	83 ec 08             	sub    $0x8,%esp
+ 4fa:	6a 01                	push   $0x1
+ 4fc:	50                   	push   %eax
+ 4fd:	e8 28 03 00 00       	call   82a <futex_wake>
+ 502:	83 c4 10             	add    $0x10,%esp
+}
+ 505:	90                   	nop
+ 506:	c9                   	leave
+ 507:	c3                   	ret
+
+00000508 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 508:	55                   	push   %ebp
+ 509:	89 e5                	mov    %esp,%ebp
+ 50b:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 50e:	ff 75 08             	push   0x8(%ebp)
+ 511:	e8 a0 ff ff ff       	call   4b6 <condbump>
+ 516:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 519:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51c:	83 ec 08             	sub    $0x8,%esp
+ 51f:	68 ff ff ff 7f       	push   $0x7fffffff
+ 524:	50                   	push   %eax
+ 525:	e8 00 03 00 00       	call   82a <futex_wake>
+ 52a:	83 c4 10             	add    $0x10,%esp
+}
+ 52d:	90                   	nop
+ 52e:	c9                   	leave
+ 52f:	c3                   	ret
+
+00000530 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 530:	55                   	push   %ebp
+ 531:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 533:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 538:	8b 00                	mov    (%eax),%eax
+}
+ 53a:	5d                   	pop    %ebp
+ 53b:	c3                   	ret
+
+0000053c <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 53c:	55                   	push   %ebp
+ 53d:	89 e5                	mov    %esp,%ebp
+ 53f:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 542:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 547:	8b 00                	mov    (%eax),%eax
+ 549:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 54c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 550:	74 05                	je     557 <vgetpid+0x1b>
+    return pid;
+ 552:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 555:	eb 05                	jmp    55c <vgetpid+0x20>
+  return getpid();
+ 557:	e8 74 02 00 00       	call   7d0 <getpid>
+}
+ 55c:	c9                   	leave
+ 55d:	c3                   	ret
+
+0000055e <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 55e:	55                   	push   %ebp
+ 55f:	89 e5                	mov    %esp,%ebp
+ 561:	57                   	push   %edi
+ 562:	56                   	push   %esi
+ 563:	53                   	push   %ebx
+ 564:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 567:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 56e:	e8 f7 fb ff ff       	call   16a <rdtsc>
+ 573:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 576:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 579:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 57c:	29 c8                	sub    %ecx,%eax
+ 57e:	19 da                	sbb    %ebx,%edx
+ 580:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 583:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 586:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 589:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 58c:	89 d0                	mov    %edx,%eax
+ 58e:	31 d2                	xor    %edx,%edx
+ 590:	89 c1                	mov    %eax,%ecx
+ 592:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 597:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 59a:	8b 40 04             	mov    0x4(%eax),%eax
+ 59d:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5a2:	89 df                	mov    %ebx,%edi
+ 5a4:	0f af f8             	imul   %eax,%edi
+ 5a7:	89 d6                	mov    %edx,%esi
+ 5a9:	0f af f1             	imul   %ecx,%esi
+ 5ac:	01 f7                	add    %esi,%edi
+ 5ae:	f7 e1                	mul    %ecx
+ 5b0:	89 c1                	mov    %eax,%ecx
+ 5b2:	89 d3                	mov    %edx,%ebx
+ 5b4:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 5b7:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 5b9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5bc:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5bf:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5c2:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 5c9:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5cc:	8b 40 04             	mov    0x4(%eax),%eax
+ 5cf:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5d2:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5d9:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 5dc:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 5df:	89 d7                	mov    %edx,%edi
+ 5e1:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5e4:	0f af fe             	imul   %esi,%edi
+ 5e7:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5ea:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5ed:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 5f0:	0f af f0             	imul   %eax,%esi
+ 5f3:	01 f7                	add    %esi,%edi
+ 5f5:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5f8:	f7 65 d8             	mull   -0x28(%ebp)
+ 5fb:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 5fe:	89 f2                	mov    %esi,%edx
+ 600:	89 d0                	mov    %edx,%eax
+ 602:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 604:	01 c8                	add    %ecx,%eax
+ 606:	11 da                	adc    %ebx,%edx
+}
+ 608:	83 c4 24             	add    $0x24,%esp
+ 60b:	5b                   	pop    %ebx
+ 60c:	5e                   	pop    %esi
+ 60d:	5f                   	pop    %edi
+ 60e:	5d                   	pop    %ebp
+ 60f:	c3                   	ret
+
+00000610 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 610:	55                   	push   %ebp
+ 611:	89 e5                	mov    %esp,%ebp
+ 613:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+ 619:	8b 50 04             	mov    0x4(%eax),%edx
+ 61c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61f:	8b 00                	mov    (%eax),%eax
+ 621:	29 c2                	sub    %eax,%edx
+ 623:	83 fa 1f             	cmp    $0x1f,%edx
+ 626:	76 07                	jbe    62f <ring_queue+0x1f>
+    return -1;
+ 628:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 62d:	eb 68                	jmp    697 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 62f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 632:	8b 40 04             	mov    0x4(%eax),%eax
+ 635:	83 e0 1f             	and    $0x1f,%eax
+ 638:	89 c2                	mov    %eax,%edx
+ 63a:	89 d0                	mov    %edx,%eax
+ 63c:	c1 e0 02             	shl    $0x2,%eax
+ 63f:	01 d0                	add    %edx,%eax
+ 641:	c1 e0 02             	shl    $0x2,%eax
+ 644:	8d 50 10             	lea    0x10(%eax),%edx
+ 647:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64a:	01 d0                	add    %edx,%eax
+ 64c:	83 c0 04             	add    $0x4,%eax
+ 64f:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 652:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 655:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 658:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 65a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 65d:	8b 55 10             	mov    0x10(%ebp),%edx
+ 660:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 663:	8b 55 14             	mov    0x14(%ebp),%edx
+ 666:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 669:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 66c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 66f:	8b 55 18             	mov    0x18(%ebp),%edx
+ 672:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 675:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 678:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 67b:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 67e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 683:	8b 45 08             	mov    0x8(%ebp),%eax
+ 686:	8b 40 04             	mov    0x4(%eax),%eax
+ 689:	8d 50 01             	lea    0x1(%eax),%edx
+ 68c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68f:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 692:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 697:	c9                   	leave
+ 698:	c3                   	ret
+
+00000699 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 699:	55                   	push   %ebp
+ 69a:	89 e5                	mov    %esp,%ebp
+ 69c:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 69f:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 6a4:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6a8:	7f 1a                	jg     6c4 <ring_submit+0x2b>
+ 6aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ad:	8b 40 10             	mov    0x10(%eax),%eax
+ 6b0:	83 e0 01             	and    $0x1,%eax
+ 6b3:	85 c0                	test   %eax,%eax
+ 6b5:	74 0d                	je     6c4 <ring_submit+0x2b>
+ 6b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ba:	8b 40 10             	mov    0x10(%eax),%eax
+ 6bd:	83 e0 02             	and    $0x2,%eax
+ 6c0:	85 c0                	test   %eax,%eax
+ 6c2:	74 10                	je     6d4 <ring_submit+0x3b>
+    return ring_enter(min);
+ 6c4:	83 ec 0c             	sub    $0xc,%esp
+ 6c7:	ff 75 0c             	push   0xc(%ebp)
+ 6ca:	e8 83 01 00 00       	call   852 <ring_enter>
+ 6cf:	83 c4 10             	add    $0x10,%esp
+ 6d2:	eb 10                	jmp    6e4 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 6d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d7:	8b 50 0c             	mov    0xc(%eax),%edx
+ 6da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6dd:	8b 40 08             	mov    0x8(%eax),%eax
+ 6e0:	29 c2                	sub    %eax,%edx
+ 6e2:	89 d0                	mov    %edx,%eax
+}
+ 6e4:	c9                   	leave
+ 6e5:	c3                   	ret
+
+000006e6 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 6e6:	55                   	push   %ebp
+ 6e7:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ec:	8b 50 08             	mov    0x8(%eax),%edx
+ 6ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f2:	8b 40 0c             	mov    0xc(%eax),%eax
+ 6f5:	39 c2                	cmp    %eax,%edx
+ 6f7:	75 07                	jne    700 <ring_reap+0x1a>
+    return -1;
+ 6f9:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6fe:	eb 3b                	jmp    73b <ring_reap+0x55>
+  __sync_synchronize();
+ 700:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 705:	8b 45 08             	mov    0x8(%ebp),%eax
+ 708:	8b 40 08             	mov    0x8(%eax),%eax
+ 70b:	83 e0 1f             	and    $0x1f,%eax
+ 70e:	89 c2                	mov    %eax,%edx
+ 710:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 713:	8b 45 08             	mov    0x8(%ebp),%eax
+ 716:	83 c2 52             	add    $0x52,%edx
+ 719:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 71d:	8b 02                	mov    (%edx),%eax
+ 71f:	8b 52 04             	mov    0x4(%edx),%edx
+ 722:	89 01                	mov    %eax,(%ecx)
+ 724:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 727:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72a:	8b 40 08             	mov    0x8(%eax),%eax
+ 72d:	8d 50 01             	lea    0x1(%eax),%edx
+ 730:	8b 45 08             	mov    0x8(%ebp),%eax
+ 733:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 736:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 73b:	5d                   	pop    %ebp
+ 73c:	c3                   	ret
+
+0000073d <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 73d:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 744:	74 0a                	je     750 <usyscall+0x13>
+  movl %esp, %ecx
+ 746:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 748:	ba 4f 07 00 00       	mov    $0x74f,%edx
+  sysenter
+ 74d:	0f 34                	sysenter
+2:
+  ret
+ 74f:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 750:	cd 40                	int    $0x40
+  ret
+ 752:	c3                   	ret
+
+00000753 <fork>:
+
+SYSCALL(fork)
+ 753:	b8 01 00 00 00       	mov    $0x1,%eax
+ 758:	eb e3                	jmp    73d <usyscall>
+
+0000075a <exit>:
+SYSCALL(exit)
+ 75a:	b8 02 00 00 00       	mov    $0x2,%eax
+ 75f:	eb dc                	jmp    73d <usyscall>
+
+00000761 <wait>:
+SYSCALL(wait)
+ 761:	b8 03 00 00 00       	mov    $0x3,%eax
+ 766:	eb d5                	jmp    73d <usyscall>
+
+00000768 <pipe>:
+SYSCALL(pipe)
+ 768:	b8 04 00 00 00       	mov    $0x4,%eax
+ 76d:	eb ce                	jmp    73d <usyscall>
+
+0000076f <read>:
+SYSCALL(read)
+ 76f:	b8 05 00 00 00       	mov    $0x5,%eax
+ 774:	eb c7                	jmp    73d <usyscall>
+
+00000776 <write>:
+SYSCALL(write)
+ 776:	b8 10 00 00 00       	mov    $0x10,%eax
+ 77b:	eb c0                	jmp    73d <usyscall>
+
+0000077d <close>:
+SYSCALL(close)
+ 77d:	b8 15 00 00 00       	mov    $0x15,%eax
+ 782:	eb b9                	jmp    73d <usyscall>
+
+00000784 <kill>:
+SYSCALL(kill)
+ 784:	b8 06 00 00 00       	mov    $0x6,%eax
+ 789:	eb b2                	jmp    73d <usyscall>
+
+0000078b <exec>:
+SYSCALL(exec)
+ 78b:	b8 07 00 00 00       	mov    $0x7,%eax
+ 790:	eb ab                	jmp    73d <usyscall>
+
+00000792 <open>:
+SYSCALL(open)
+ 792:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 797:	eb a4                	jmp    73d <usyscall>
+
+00000799 <mknod>:
+SYSCALL(mknod)
+ 799:	b8 11 00 00 00       	mov    $0x11,%eax
+ 79e:	eb 9d                	jmp    73d <usyscall>
+
+000007a0 <unlink>:
+SYSCALL(unlink)
+ 7a0:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7a5:	eb 96                	jmp    73d <usyscall>
+
+000007a7 <fstat>:
+SYSCALL(fstat)
+ 7a7:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ac:	eb 8f                	jmp    73d <usyscall>
+
+000007ae <link>:
+SYSCALL(link)
+ 7ae:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7b3:	eb 88                	jmp    73d <usyscall>
+
+000007b5 <mkdir>:
+SYSCALL(mkdir)
+ 7b5:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7ba:	eb 81                	jmp    73d <usyscall>
+
+000007bc <chdir>:
+SYSCALL(chdir)
+ 7bc:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7c1:	e9 77 ff ff ff       	jmp    73d <usyscall>
+
+000007c6 <dup>:
+SYSCALL(dup)
+ 7c6:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7cb:	e9 6d ff ff ff       	jmp    73d <usyscall>
+
+000007d0 <getpid>:
+SYSCALL(getpid)
+ 7d0:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7d5:	e9 63 ff ff ff       	jmp    73d <usyscall>
+
+000007da <sbrk>:
+SYSCALL(sbrk)
+ 7da:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7df:	e9 59 ff ff ff       	jmp    73d <usyscall>
+
+000007e4 <sleep>:
+SYSCALL(sleep)
+ 7e4:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e9:	e9 4f ff ff ff       	jmp    73d <usyscall>
+
+000007ee <uptime>:
+SYSCALL(uptime)
+ 7ee:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7f3:	e9 45 ff ff ff       	jmp    73d <usyscall>
+
+000007f8 <kmstat>:
+SYSCALL(kmstat)
+ 7f8:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7fd:	e9 3b ff ff ff       	jmp    73d <usyscall>
+
+00000802 <setpriority>:
+SYSCALL(setpriority)
+ 802:	b8 17 00 00 00       	mov    $0x17,%eax
+ 807:	e9 31 ff ff ff       	jmp    73d <usyscall>
+
+0000080c <clone>:
+SYSCALL(clone)
+ 80c:	b8 18 00 00 00       	mov    $0x18,%eax
+ 811:	e9 27 ff ff ff       	jmp    73d <usyscall>
+
+00000816 <join>:
+SYSCALL(join)
+ 816:	b8 19 00 00 00       	mov    $0x19,%eax
+ 81b:	e9 1d ff ff ff       	jmp    73d <usyscall>
+
+00000820 <futex_wait>:
+SYSCALL(futex_wait)
+ 820:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 825:	e9 13 ff ff ff       	jmp    73d <usyscall>
+
+0000082a <futex_wake>:
+SYSCALL(futex_wake)
+ 82a:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 82f:	e9 09 ff ff ff       	jmp    73d <usyscall>
+
+00000834 <lockstat>:
+SYSCALL(lockstat)
+ 834:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 839:	e9 ff fe ff ff       	jmp    73d <usyscall>
+
+0000083e <sysstat>:
+SYSCALL(sysstat)
+ 83e:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 843:	e9 f5 fe ff ff       	jmp    73d <usyscall>
+
+00000848 <ring_setup>:
+SYSCALL(ring_setup)
+ 848:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 84d:	e9 eb fe ff ff       	jmp    73d <usyscall>
+
+00000852 <ring_enter>:
+SYSCALL(ring_enter)
+ 852:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 857:	e9 e1 fe ff ff       	jmp    73d <usyscall>
@@ -0,0 +1,123 @@
+// x87, MMX and SSE register state for user processes.
+//
+// Every CPU runs with CR0_TS set until the process it is
+// running touches the FPU, which traps with T_DEVICE.  Only
+// then does fputrap() give the process a save area, load its
+// registers and clear CR0_TS, so a process that never uses the
+// FPU costs nothing.  A process that did use it has its state
+// saved when it gives up the CPU, since it may next run on
+// another CPU; if it comes back here before anyone else uses
+// this CPU's FPU, the registers still hold its state and need
+// not be reloaded.  The kernel itself never uses the FPU.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "x86.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define FPUSIZE 512  // FXSAVE area, from kmalloc(), so 16-byte aligned
+
+static int havefpu;
+static char fpuinitstate[FPUSIZE] __attribute__((aligned(16)));
+
+// Enable FXSAVE and SSE on this CPU, and make the FPU trap.
+// The first CPU also records the state new processes start in.
+void
+fpuinit(void)
+{
+  uint d, mxcsr;
+
+  mxcsr = 0x1f80;  // all SSE exceptions masked
+  d = cpuid(1);
+  if(!(d & CPUID_FXSR) || !(d & CPUID_SSE)){
+    lcr0(rcr0() | CR0_EM);  // x87 instructions trap; SSE ones fault
+    return;
+  }
+  lcr4(rcr4() | CR4_OSFXSR | CR4_OSXMMEXCPT);
+  lcr0((rcr0() & ~CR0_EM) | CR0_MP | CR0_NE);
+  if(!havefpu){
+    // CPUs start one at a time, so this runs once.
+    asm volatile("fninit; ldmxcsr %0" : : "m" (mxcsr));
+    fxsave(fpuinitstate);
+    havefpu = 1;
+  }
+  lcr0(rcr0() | CR0_TS);
+  cpu->fpuproc = 0;
+  cpu->fpuused = 0;
+}
+
+// Handle T_DEVICE: the current process wants the FPU.
+// Returns -1 if it can't have it.
+int
+fputrap(void)
+{
+  if(!havefpu)
+    return -1;
+  if(proc->fpu == 0){
+    if((proc->fpu = kmalloc(FPUSIZE)) == 0)
+      return -1;
+    memmove(proc->fpu, fpuinitstate, FPUSIZE);
+    proc->fpucpu = -1;
+  }
+  clts();
+  if(cpu->fpuproc != proc || proc->fpucpu != cpu->id)
+    fxrstor(proc->fpu);
+  cpu->fpuproc = proc;
+  proc->fpucpu = cpu->id;
+  cpu->fpuused = 1;
+  return 0;
+}
+
+// Save the current process's FPU state, if it used the FPU
+// since it last got this CPU, and make the FPU trap again.
+// Caller must have interrupts off.
+void
+fpusave(void)
+{
+  if(!cpu->fpuused)
+    return;
+  if(proc->state != ZOMBIE)
+    fxsave(proc->fpu);
+  lcr0(rcr0() | CR0_TS);
+  cpu->fpuused = 0;
+}
+
+// Give np, made by fork(), a copy of the current process's
+// FPU state.  Returns -1 if out of memory.
+int
+fpufork(struct proc *np)
+{
+  if(proc->fpu == 0)
+    return 0;
+  if((np->fpu = kmalloc(FPUSIZE)) == 0)
+    return -1;
+  pushcli();
+  if(cpu->fpuused)
+    fxsave(proc->fpu);
+  memmove(np->fpu, proc->fpu, FPUSIZE);
+  popcli();
+  np->fpucpu = -1;
+  return 0;
+}
+
+// Forget the current process's FPU state, for exec().
+void
+fpuexec(void)
+{
+  pushcli();
+  if(cpu->fpuused){
+    lcr0(rcr0() | CR0_TS);
+    cpu->fpuused = 0;
+  }
+  if(cpu->fpuproc == proc)
+    cpu->fpuproc = 0;
+  popcli();
+  if(proc->fpu){
+    kmfree(proc->fpu);
+    proc->fpu = 0;
+  }
+}
@@ -14,10 +14,11 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
 #include "buf.h"
 #include "fs.h"
+#include "sleeplock.h"
 #include "file.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
@@ -134,9 +135,12 @@ bfree(int dev, uint b)
 //
 // * Locked: file system code may only examine and modify
 //   the information in an inode and its content if it
-//   has first locked the inode. The I_BUSY flag indicates
-//   that the inode is locked. ilock() sets I_BUSY,
-//   while iunlock clears it.
+//   has first locked the inode's sleep lock. ilock()
+//   locks it exclusive, for code that may modify the
+//   inode; ilockshared() locks it shared, for code that
+//   only reads it, so that readers of one inode (exec of
+//   a popular program, lookups in a busy directory) run
+//   in parallel.  iunlock() releases either.
 //
 // Thus a typical sequence is:
 //   ip = iget(dev, inum)
@@ -158,16 +162,41 @@ bfree(int dev, uint b)
 
 struct {
   struct spinlock lock;
-  struct inode inode[NINODE];
+  struct kmcache *cache;
+  struct inode *list;   // inodes with ref > 0
 } icache;
 
+// Name cache: directory entries that namex() has looked up,
+// so that it can walk a path without locking the directories
+// along it.  Readers take no lock; they note the sequence
+// count, which is odd while an update is in progress, and
+// check that it has not changed once done.  Direct-mapped.
+#define NNCACHE 256
+
+struct ncent {
+  uint dev;
+  uint dir;           // inum of directory; 0 if unused
+  uint inum;          // inum name refers to
+  short type;         // inum's type, or 0 if not known
+  char name[DIRSIZ];
+};
+
+struct {
+  struct spinlock lock;  // serializes updates
+  volatile uint seq;
+  struct ncent ent[NNCACHE];
+} ncache;
+
 void
 iinit(void)
 {
-  initlock(&icache.lock, "icache");
+  initmcslock(&icache.lock, "icache");
+  icache.cache = kmcreate("inode", sizeof(struct inode));
+  initlock(&ncache.lock, "ncache");
 }
 
 static struct inode* iget(uint dev, uint inum);
+static void namepurge(struct inode*);
 
 //PAGEBREAK!
 // Allocate a new inode with the given type on device dev.
@@ -222,31 +251,29 @@ iupdate(struct inode *ip)
 static struct inode*
 iget(uint dev, uint inum)
 {
-  struct inode *ip, *empty;
+  struct inode *ip;
 
   acquire(&icache.lock);
 
   // Is the inode already cached?
-  empty = 0;
-  for(ip = &icache.inode[0]; ip < &icache.inode[NINODE]; ip++){
-    if(ip->ref > 0 && ip->dev == dev && ip->inum == inum){
+  for(ip = icache.list; ip; ip = ip->next){
+    if(ip->dev == dev && ip->inum == inum){
       ip->ref++;
       release(&icache.lock);
       return ip;
     }
-    if(empty == 0 && ip->ref == 0)    // Remember empty slot.
-      empty = ip;
   }
 
-  // Recycle an inode cache entry.
-  if(empty == 0)
+  // Allocate a new inode cache entry.
+  if((ip = kmcachealloc(icache.cache)) == 0)
     panic("iget: no inodes");
-
-  ip = empty;
   ip->dev = dev;
   ip->inum = inum;
   ip->ref = 1;
+  initsleeplock(&ip->lock, "inode");
   ip->flags = 0;
+  ip->next = icache.list;
+  icache.list = ip;
   release(&icache.lock);
 
   return ip;
@@ -263,7 +290,7 @@ idup(struct inode *ip)
   return ip;
 }
 
-// Lock the given inode.
+// Lock the given inode for exclusive use.
 // Reads the inode from disk if necessary.
 void
 ilock(struct inode *ip)
@@ -274,11 +301,7 @@ ilock(struct inode *ip)
   if(ip == 0 || ip->ref < 1)
     panic("ilock");
 
-  acquire(&icache.lock);
-  while(ip->flags & I_BUSY)
-    sleep(ip, &icache.lock);
-  ip->flags |= I_BUSY;
-  release(&icache.lock);
+  acquiresleep(&ip->lock);
 
   if(!(ip->flags & I_VALID)){
     bp = bread(ip->dev, IBLOCK(ip->inum));
@@ -296,42 +319,65 @@ ilock(struct inode *ip)
   }
 }
 
-// Unlock the given inode.
+// Lock the given inode shared, for reading only.
+void
+ilockshared(struct inode *ip)
+{
+  if(ip == 0 || ip->ref < 1)
+    panic("ilockshared");
+
+  // Reading it in from disk needs it exclusive.  Once valid
+  // it stays so while we hold a reference.
+  if(!(ip->flags & I_VALID)){
+    ilock(ip);
+    iunlock(ip);
+  }
+  acquiresleepshared(&ip->lock);
+}
+
+// Unlock the given inode, locked either way.
 void
 iunlock(struct inode *ip)
 {
-  if(ip == 0 || !(ip->flags & I_BUSY) || ip->ref < 1)
+  if(ip == 0 || !holdingsleep(&ip->lock) || ip->ref < 1)
     panic("iunlock");
 
-  acquire(&icache.lock);
-  ip->flags &= ~I_BUSY;
-  wakeup(ip);
-  release(&icache.lock);
+  releasesleep(&ip->lock);
 }
 
 // Drop a reference to an in-memory inode.
-// If that was the last reference, the inode cache entry can
-// be recycled.
+// If that was the last reference, the inode cache entry is
+// freed.
 // If that was the last reference and the inode has no links
 // to it, free the inode (and its content) on disk.
 void
 iput(struct inode *ip)
 {
+  struct inode **pp;
+
   acquire(&icache.lock);
   if(ip->ref == 1 && (ip->flags & I_VALID) && ip->nlink == 0){
     // inode has no links: truncate and free inode.
-    if(ip->flags & I_BUSY)
-      panic("iput busy");
-    ip->flags |= I_BUSY;
+    // namefast() can still iget() ip through a stale name
+    // cache entry.  Purge them before letting go of icache.lock,
+    // so that from now on namefast() sees the change and gives
+    // back any reference it takes; and lock ip, in case.
+    namepurge(ip);
     release(&icache.lock);
+    acquiresleep(&ip->lock);
     itrunc(ip);
     ip->type = 0;
     iupdate(ip);
     acquire(&icache.lock);
     ip->flags = 0;
-    wakeup(ip);
+    releasesleep(&ip->lock);
+  }
+  if(--ip->ref == 0){
+    for(pp = &icache.list; *pp != ip; pp = &(*pp)->next)
+      ;
+    *pp = ip->next;
+    kmfree(ip);
   }
-  ip->ref--;
   release(&icache.lock);
 }
 
@@ -598,6 +644,155 @@ skipelem(char *path, char *name)
   return path;
 }
 
+//PAGEBREAK!
+static struct ncent*
+nameslot(uint dev, uint dir, char *name)
+{
+  uint h;
+  int i;
+
+  h = dev*31 + dir;
+  for(i = 0; i < DIRSIZ && name[i]; i++)
+    h = h*31 + (uchar)name[i];
+  return &ncache.ent[h % NNCACHE];
+}
+
+static void
+nameupdate(void)
+{
+  acquire(&ncache.lock);
+  ncache.seq++;
+  __sync_synchronize();
+}
+
+static void
+nameupdated(void)
+{
+  __sync_synchronize();
+  ncache.seq++;
+  release(&ncache.lock);
+}
+
+static int
+namematch(struct ncent *e, uint dev, uint dir, char *name, uint inum)
+{
+  return e->dir == dir && e->dev == dev && e->inum == inum &&
+    namecmp(e->name, name) == 0;
+}
+
+// Remember that name in directory dp refers to inum.
+// Caller must hold dp locked, so that the entry cannot
+// be removed before it is entered.
+static void
+nameenter(struct inode *dp, char *name, uint inum)
+{
+  struct ncent *e;
+
+  e = nameslot(dp->dev, dp->inum, name);
+  if(namematch(e, dp->dev, dp->inum, name, inum))
+    return;  // don't disturb readers
+  nameupdate();
+  e->dev = dp->dev;
+  e->dir = dp->inum;
+  e->inum = inum;
+  e->type = 0;
+  strncpy(e->name, name, DIRSIZ);
+  nameupdated();
+}
+
+// Note the type of ip, which name in directory dir refers
+// to, if that entry is still there.
+static void
+nametype(uint dir, char *name, struct inode *ip)
+{
+  struct ncent *e;
+
+  e = nameslot(ip->dev, dir, name);
+  if(!namematch(e, ip->dev, dir, name, ip->inum) || e->type == ip->type)
+    return;
+  nameupdate();
+  if(namematch(e, ip->dev, dir, name, ip->inum))
+    e->type = ip->type;
+  nameupdated();
+}
+
+// Forget name in directory dp, which is being removed.
+void
+nameforget(struct inode *dp, char *name)
+{
+  struct ncent *e;
+
+  e = nameslot(dp->dev, dp->inum, name);
+  nameupdate();
+  if(e->dir == dp->inum && e->dev == dp->dev && namecmp(e->name, name) == 0)
+    e->dir = 0;
+  nameupdated();
+}
+
+// Forget all entries in or naming ip, which is being freed.
+static void
+namepurge(struct inode *ip)
+{
+  struct ncent *e;
+
+  nameupdate();
+  for(e = ncache.ent; e < ncache.ent + NNCACHE; e++)
+    if(e->dev == ip->dev && (e->dir == ip->inum || e->inum == ip->inum))
+      e->dir = 0;
+  nameupdated();
+}
+
+// Try to look up path in the name cache alone, taking no
+// locks but icache.lock in iget() at the end.  Returns 0 if
+// any step is missing or an update got in the way; namex()
+// then walks the path the slow way.
+static struct inode*
+namefast(char *path, int nameiparent, char *name)
+{
+  struct ncent *e;
+  struct inode *ip;
+  uint seq, dev, inum;
+  short type;
+
+  if(*path == '/'){
+    dev = ROOTDEV;
+    inum = ROOTINO;
+  } else {
+    acquire(&proc->leader->glock);
+    dev = proc->leader->cwd->dev;
+    inum = proc->leader->cwd->inum;
+    release(&proc->leader->glock);
+  }
+  type = T_DIR;
+
+  if((seq = ncache.seq) & 1)
+    return 0;
+  __sync_synchronize();
+  while((path = skipelem(path, name)) != 0){
+    if(type != T_DIR)
+      return 0;
+    if(nameiparent && *path == '\0')
+      break;
+    e = nameslot(dev, inum, name);
+    if(e->dir != inum || e->dev != dev || namecmp(e->name, name) != 0)
+      return 0;
+    inum = e->inum;
+    type = e->type;
+  }
+  if(nameiparent && path == 0)
+    return 0;
+
+  // Take a reference, then make sure nothing changed
+  // while we looked: otherwise inum may have been freed.
+  ip = iget(dev, inum);
+  __sync_synchronize();
+  if(ncache.seq != seq){
+    iput(ip);
+    return 0;
+  }
+  return ip;
+}
+
 // Look up and return the inode for a path name.
 // If parent != 0, return the inode for the parent and copy the final
 // path element into name, which must have room for DIRSIZ bytes.
@@ -605,14 +800,28 @@ static struct inode*
 namex(char *path, int nameiparent, char *name)
 {
   struct inode *ip, *next;
+  char pname[DIRSIZ];
+  uint pdir;
+
+  if((ip = namefast(path, nameiparent, name)) != 0)
+    return ip;
 
   if(*path == '/')
     ip = iget(ROOTDEV, ROOTINO);
-  else
-    ip = idup(proc->cwd);
+  else {
+    acquire(&proc->leader->glock);
+    ip = idup(proc->leader->cwd);
+    release(&proc->leader->glock);
+  }
 
+  // Enter each step in the name cache, and the type of the
+  // inode it led to once that is locked.  pdir is the
+  // directory of the last step, 0 before the first.
+  pdir = 0;
   while((path = skipelem(path, name)) != 0){
-    ilock(ip);
+    ilockshared(ip);
+    if(pdir)
+      nametype(pdir, pname, ip);
     if(ip->type != T_DIR){
       iunlockput(ip);
       return 0;
@@ -626,6 +835,9 @@ namex(char *path, int nameiparent, char *name)
       iunlockput(ip);
       return 0;
     }
+    nameenter(ip, name, next->inum);
+    pdir = ip->inum;
+    memmove(pname, name, DIRSIZ);
     iunlockput(ip);
     ip = next;
   }
@@ -0,0 +1,89 @@
+// Futexes: sleeping on a word of user memory.
+//
+// futexwait() sleeps only if the word still holds the value
+// the caller last saw, and futexwake() wakes sleepers on a
+// word.  User code does its locking with atomic instructions
+// and calls these only when it has to wait or someone is
+// waiting.  Sleepers are keyed by the kernel address of the
+// word, so threads sharing a page table find each other.  A
+// hashed lock makes the check in futexwait() and the sleep
+// atomic with respect to futexwake().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+
+#define FXBITS 4
+#define NFXLOCK (1 << FXBITS)
+#define FXHASH(w) (((uint)(w) * 2654435761U) >> (32 - FXBITS))
+
+static struct spinlock fxlock[NFXLOCK];
+
+void
+futexinit(void)
+{
+  int i;
+
+  for(i = 0; i < NFXLOCK; i++)
+    initlock(&fxlock[i], "futex");
+}
+
+// Return the kernel address of the user word at addr,
+// or 0 if addr is not an aligned word of user memory.
+static uint*
+futexword(uint addr)
+{
+  char *ka;
+
+  if(addr % 4 != 0 || addr >= proc->sz || addr + 4 > proc->sz)
+    return 0;
+  if((ka = uva2ka(proc->pgdir, (char*)addr)) == 0)
+    return 0;
+  return (uint*)(ka + addr % PGSIZE);
+}
+
+// Sleep until futexwake(addr) if the word at addr holds val.
+// Returns 0 once woken or if it didn't hold val, -1 for a
+// bad address or if killed.
+int
+futexwait(uint addr, uint val)
+{
+  struct spinlock *lk;
+  uint *w;
+
+  if((w = futexword(addr)) == 0)
+    return -1;
+  lk = &fxlock[FXHASH(w)];
+  acquire(lk);
+  if(*w == val){
+    if(proc->killed){
+      release(lk);
+      return -1;
+    }
+    sleep(w, lk);
+  }
+  release(lk);
+  return 0;
+}
+
+// Wake up to n processes sleeping on the word at addr.
+// Returns the number woken, or -1 for a bad address.
+int
+futexwake(uint addr, int n)
+{
+  struct spinlock *lk;
+  uint *w;
+  int r;
+
+  if((w = futexword(addr)) == 0)
+    return -1;
+  lk = &fxlock[FXHASH(w)];
+  acquire(lk);
+  r = wakeupn(w, n);
+  release(lk);
+  return r;
+}
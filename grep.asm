@@ -0,0 +1,2108 @@
+
+_grep:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <grep>:
+char buf[1024];
+int match(char*, char*);
+
+void
+grep(char *pattern, int fd)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+  int n, m;
+  char *p, *q;
+  
+  m = 0;
+   6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+   d:	e9 a3 00 00 00       	jmp    b5 <grep+0xb5>
+    m += n;
+  12:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  15:	01 45 f4             	add    %eax,-0xc(%ebp)
+    p = buf;
+  18:	c7 45 f0 20 15 00 00 	movl   $0x1520,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  1f:	eb 44                	jmp    65 <grep+0x65>
+      *q = 0;
+  21:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  24:	c6 00 00             	movb   $0x0,(%eax)
+      if(match(pattern, p)){
+  27:	83 ec 08             	sub    $0x8,%esp
+  2a:	ff 75 f0             	push   -0x10(%ebp)
+  2d:	ff 75 08             	push   0x8(%ebp)
+  30:	e8 8f 01 00 00       	call   1c4 <match>
+  35:	83 c4 10             	add    $0x10,%esp
+  38:	85 c0                	test   %eax,%eax
+  3a:	74 20                	je     5c <grep+0x5c>
+        *q = '\n';
+  3c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  3f:	c6 00 0a             	movb   $0xa,(%eax)
+        write(1, p, q+1 - p);
+  42:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  45:	83 c0 01             	add    $0x1,%eax
+  48:	2b 45 f0             	sub    -0x10(%ebp),%eax
+  4b:	83 ec 04             	sub    $0x4,%esp
+  4e:	50                   	push   %eax
+  4f:	ff 75 f0             	push   -0x10(%ebp)
+  52:	6a 01                	push   $0x1
+  54:	e8 35 09 00 00       	call   98e <write>
+  59:	83 c4 10             	add    $0x10,%esp
+      }
+      p = q+1;
+  5c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  5f:	83 c0 01             	add    $0x1,%eax
+  62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    while((q = strchr(p, '\n')) != 0){
+  65:	83 ec 08             	sub    $0x8,%esp
+  68:	6a 0a                	push   $0xa
+  6a:	ff 75 f0             	push   -0x10(%ebp)
+  6d:	e8 d6 03 00 00       	call   448 <strchr>
+  72:	83 c4 10             	add    $0x10,%esp
+  75:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  78:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+  7c:	75 a3                	jne    21 <grep+0x21>
+    }
+    if(p == buf)
+  7e:	81 7d f0 20 15 00 00 	cmpl   $0x1520,-0x10(%ebp)
+  85:	75 07                	jne    8e <grep+0x8e>
+      m = 0;
+  87:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    if(m > 0){
+  8e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  92:	7e 21                	jle    b5 <grep+0xb5>
+      m -= p - buf;
+  94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  97:	2d 20 15 00 00       	sub    $0x1520,%eax
+  9c:	29 45 f4             	sub    %eax,-0xc(%ebp)
+      memmove(buf, p, m);
+  9f:	83 ec 04             	sub    $0x4,%esp
+  a2:	ff 75 f4             	push   -0xc(%ebp)
+  a5:	ff 75 f0             	push   -0x10(%ebp)
+  a8:	68 20 15 00 00       	push   $0x1520
+  ad:	e8 d2 04 00 00       	call   584 <memmove>
+  b2:	83 c4 10             	add    $0x10,%esp
+  while((n = read(fd, buf+m, sizeof(buf)-m)) > 0){
+  b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  b8:	ba 00 04 00 00       	mov    $0x400,%edx
+  bd:	29 c2                	sub    %eax,%edx
+  bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  c2:	05 20 15 00 00       	add    $0x1520,%eax
+  c7:	83 ec 04             	sub    $0x4,%esp
+  ca:	52                   	push   %edx
+  cb:	50                   	push   %eax
+  cc:	ff 75 0c             	push   0xc(%ebp)
+  cf:	e8 b3 08 00 00       	call   987 <read>
+  d4:	83 c4 10             	add    $0x10,%esp
+  d7:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  da:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+  de:	0f 8f 2e ff ff ff    	jg     12 <grep+0x12>
+    }
+  }
+}
+  e4:	90                   	nop
+  e5:	90                   	nop
+  e6:	c9                   	leave
+  e7:	c3                   	ret
+
+000000e8 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  e8:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  ec:	83 e4 f0             	and    $0xfffffff0,%esp
+  ef:	ff 71 fc             	push   -0x4(%ecx)
+  f2:	55                   	push   %ebp
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	53                   	push   %ebx
+  f6:	51                   	push   %ecx
+  f7:	83 ec 10             	sub    $0x10,%esp
+  fa:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+  char *pattern;
+  
+  if(argc <= 1){
+  fc:	83 3b 01             	cmpl   $0x1,(%ebx)
+  ff:	7f 17                	jg     118 <main+0x30>
+    printf(2, "usage: grep pattern [file ...]\n");
+ 101:	83 ec 08             	sub    $0x8,%esp
+ 104:	68 88 0f 00 00       	push   $0xf88
+ 109:	6a 02                	push   $0x2
+ 10b:	e8 38 0a 00 00       	call   b48 <printf>
+ 110:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 113:	e8 5a 08 00 00       	call   972 <exit>
+  }
+  pattern = argv[1];
+ 118:	8b 43 04             	mov    0x4(%ebx),%eax
+ 11b:	8b 40 04             	mov    0x4(%eax),%eax
+ 11e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  
+  if(argc <= 2){
+ 121:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 124:	7f 15                	jg     13b <main+0x53>
+    grep(pattern, 0);
+ 126:	83 ec 08             	sub    $0x8,%esp
+ 129:	6a 00                	push   $0x0
+ 12b:	ff 75 f0             	push   -0x10(%ebp)
+ 12e:	e8 cd fe ff ff       	call   0 <grep>
+ 133:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 136:	e8 37 08 00 00       	call   972 <exit>
+  }
+
+  for(i = 2; i < argc; i++){
+ 13b:	c7 45 f4 02 00 00 00 	movl   $0x2,-0xc(%ebp)
+ 142:	eb 74                	jmp    1b8 <main+0xd0>
+    if((fd = open(argv[i], 0)) < 0){
+ 144:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 147:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 14e:	8b 43 04             	mov    0x4(%ebx),%eax
+ 151:	01 d0                	add    %edx,%eax
+ 153:	8b 00                	mov    (%eax),%eax
+ 155:	83 ec 08             	sub    $0x8,%esp
+ 158:	6a 00                	push   $0x0
+ 15a:	50                   	push   %eax
+ 15b:	e8 4a 08 00 00       	call   9aa <open>
+ 160:	83 c4 10             	add    $0x10,%esp
+ 163:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 166:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 16a:	79 29                	jns    195 <main+0xad>
+      printf(1, "grep: cannot open %s\n", argv[i]);
+ 16c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 16f:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 176:	8b 43 04             	mov    0x4(%ebx),%eax
+ 179:	01 d0                	add    %edx,%eax
+ 17b:	8b 00                	mov    (%eax),%eax
+ 17d:	83 ec 04             	sub    $0x4,%esp
+ 180:	50                   	push   %eax
+ 181:	68 a8 0f 00 00       	push   $0xfa8
+ 186:	6a 01                	push   $0x1
+ 188:	e8 bb 09 00 00       	call   b48 <printf>
+ 18d:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 190:	e8 dd 07 00 00       	call   972 <exit>
+    }
+    grep(pattern, fd);
+ 195:	83 ec 08             	sub    $0x8,%esp
+ 198:	ff 75 ec             	push   -0x14(%ebp)
+ 19b:	ff 75 f0             	push   -0x10(%ebp)
+ 19e:	e8 5d fe ff ff       	call   0 <grep>
+ 1a3:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 1a6:	83 ec 0c             	sub    $0xc,%esp
+ 1a9:	ff 75 ec             	push   -0x14(%ebp)
+ 1ac:	e8 e4 07 00 00       	call   995 <close>
+ 1b1:	83 c4 10             	add    $0x10,%esp
+  for(i = 2; i < argc; i++){
+ 1b4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1bb:	3b 03                	cmp    (%ebx),%eax
+ 1bd:	7c 85                	jl     144 <main+0x5c>
+  }
+  exit();
+ 1bf:	e8 ae 07 00 00       	call   972 <exit>
+
+000001c4 <match>:
+int matchhere(char*, char*);
+int matchstar(int, char*, char*);
+
+int
+match(char *re, char *text)
+{
+ 1c4:	55                   	push   %ebp
+ 1c5:	89 e5                	mov    %esp,%ebp
+ 1c7:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '^')
+ 1ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1cd:	0f b6 00             	movzbl (%eax),%eax
+ 1d0:	3c 5e                	cmp    $0x5e,%al
+ 1d2:	75 17                	jne    1eb <match+0x27>
+    return matchhere(re+1, text);
+ 1d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d7:	83 c0 01             	add    $0x1,%eax
+ 1da:	83 ec 08             	sub    $0x8,%esp
+ 1dd:	ff 75 0c             	push   0xc(%ebp)
+ 1e0:	50                   	push   %eax
+ 1e1:	e8 38 00 00 00       	call   21e <matchhere>
+ 1e6:	83 c4 10             	add    $0x10,%esp
+ 1e9:	eb 31                	jmp    21c <match+0x58>
+  do{  // must look at empty string
+    if(matchhere(re, text))
+ 1eb:	83 ec 08             	sub    $0x8,%esp
+ 1ee:	ff 75 0c             	push   0xc(%ebp)
+ 1f1:	ff 75 08             	push   0x8(%ebp)
+ 1f4:	e8 25 00 00 00       	call   21e <matchhere>
+ 1f9:	83 c4 10             	add    $0x10,%esp
+ 1fc:	85 c0                	test   %eax,%eax
+ 1fe:	74 07                	je     207 <match+0x43>
+      return 1;
+ 200:	b8 01 00 00 00       	mov    $0x1,%eax
+ 205:	eb 15                	jmp    21c <match+0x58>
+  }while(*text++ != '\0');
+ 207:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20a:	8d 50 01             	lea    0x1(%eax),%edx
+ 20d:	89 55 0c             	mov    %edx,0xc(%ebp)
+ 210:	0f b6 00             	movzbl (%eax),%eax
+ 213:	84 c0                	test   %al,%al
+ 215:	75 d4                	jne    1eb <match+0x27>
+  return 0;
+ 217:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 21c:	c9                   	leave
+ 21d:	c3                   	ret
+
+0000021e <matchhere>:
+
+// matchhere: search for re at beginning of text
+int matchhere(char *re, char *text)
+{
+ 21e:	55                   	push   %ebp
+ 21f:	89 e5                	mov    %esp,%ebp
+ 221:	83 ec 08             	sub    $0x8,%esp
+  if(re[0] == '\0')
+ 224:	8b 45 08             	mov    0x8(%ebp),%eax
+ 227:	0f b6 00             	movzbl (%eax),%eax
+ 22a:	84 c0                	test   %al,%al
+ 22c:	75 0a                	jne    238 <matchhere+0x1a>
+    return 1;
+ 22e:	b8 01 00 00 00       	mov    $0x1,%eax
+ 233:	e9 99 00 00 00       	jmp    2d1 <matchhere+0xb3>
+  if(re[1] == '*')
+ 238:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23b:	83 c0 01             	add    $0x1,%eax
+ 23e:	0f b6 00             	movzbl (%eax),%eax
+ 241:	3c 2a                	cmp    $0x2a,%al
+ 243:	75 21                	jne    266 <matchhere+0x48>
+    return matchstar(re[0], re+2, text);
+ 245:	8b 45 08             	mov    0x8(%ebp),%eax
+ 248:	8d 50 02             	lea    0x2(%eax),%edx
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	0f b6 00             	movzbl (%eax),%eax
+ 251:	0f be c0             	movsbl %al,%eax
+ 254:	83 ec 04             	sub    $0x4,%esp
+ 257:	ff 75 0c             	push   0xc(%ebp)
+ 25a:	52                   	push   %edx
+ 25b:	50                   	push   %eax
+ 25c:	e8 72 00 00 00       	call   2d3 <matchstar>
+ 261:	83 c4 10             	add    $0x10,%esp
+ 264:	eb 6b                	jmp    2d1 <matchhere+0xb3>
+  if(re[0] == '$' && re[1] == '\0')
+ 266:	8b 45 08             	mov    0x8(%ebp),%eax
+ 269:	0f b6 00             	movzbl (%eax),%eax
+ 26c:	3c 24                	cmp    $0x24,%al
+ 26e:	75 1d                	jne    28d <matchhere+0x6f>
+ 270:	8b 45 08             	mov    0x8(%ebp),%eax
+ 273:	83 c0 01             	add    $0x1,%eax
+ 276:	0f b6 00             	movzbl (%eax),%eax
+ 279:	84 c0                	test   %al,%al
+ 27b:	75 10                	jne    28d <matchhere+0x6f>
+    return *text == '\0';
+ 27d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 280:	0f b6 00             	movzbl (%eax),%eax
+ 283:	84 c0                	test   %al,%al
+ 285:	0f 94 c0             	sete   %al
+ 288:	0f b6 c0             	movzbl %al,%eax
+ 28b:	eb 44                	jmp    2d1 <matchhere+0xb3>
+  if(*text!='\0' && (re[0]=='.' || re[0]==*text))
+ 28d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 290:	0f b6 00             	movzbl (%eax),%eax
+ 293:	84 c0                	test   %al,%al
+ 295:	74 35                	je     2cc <matchhere+0xae>
+ 297:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29a:	0f b6 00             	movzbl (%eax),%eax
+ 29d:	3c 2e                	cmp    $0x2e,%al
+ 29f:	74 10                	je     2b1 <matchhere+0x93>
+ 2a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a4:	0f b6 10             	movzbl (%eax),%edx
+ 2a7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2aa:	0f b6 00             	movzbl (%eax),%eax
+ 2ad:	38 c2                	cmp    %al,%dl
+ 2af:	75 1b                	jne    2cc <matchhere+0xae>
+    return matchhere(re+1, text+1);
+ 2b1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2b4:	8d 50 01             	lea    0x1(%eax),%edx
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	83 c0 01             	add    $0x1,%eax
+ 2bd:	83 ec 08             	sub    $0x8,%esp
+ 2c0:	52                   	push   %edx
+ 2c1:	50                   	push   %eax
+ 2c2:	e8 57 ff ff ff       	call   21e <matchhere>
+ 2c7:	83 c4 10             	add    $0x10,%esp
+ 2ca:	eb 05                	jmp    2d1 <matchhere+0xb3>
+  return 0;
+ 2cc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2d1:	c9                   	leave
+ 2d2:	c3                   	ret
+
+000002d3 <matchstar>:
+
+// matchstar: search for c*re at beginning of text
+int matchstar(int c, char *re, char *text)
+{
+ 2d3:	55                   	push   %ebp
+ 2d4:	89 e5                	mov    %esp,%ebp
+ 2d6:	83 ec 08             	sub    $0x8,%esp
+  do{  // a * matches zero or more instances
+    if(matchhere(re, text))
+ 2d9:	83 ec 08             	sub    $0x8,%esp
+ 2dc:	ff 75 10             	push   0x10(%ebp)
+ 2df:	ff 75 0c             	push   0xc(%ebp)
+ 2e2:	e8 37 ff ff ff       	call   21e <matchhere>
+ 2e7:	83 c4 10             	add    $0x10,%esp
+ 2ea:	85 c0                	test   %eax,%eax
+ 2ec:	74 07                	je     2f5 <matchstar+0x22>
+      return 1;
+ 2ee:	b8 01 00 00 00       	mov    $0x1,%eax
+ 2f3:	eb 29                	jmp    31e <matchstar+0x4b>
+  }while(*text!='\0' && (*text++==c || c=='.'));
+ 2f5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f8:	0f b6 00             	movzbl (%eax),%eax
+ 2fb:	84 c0                	test   %al,%al
+ 2fd:	74 1a                	je     319 <matchstar+0x46>
+ 2ff:	8b 45 10             	mov    0x10(%ebp),%eax
+ 302:	8d 50 01             	lea    0x1(%eax),%edx
+ 305:	89 55 10             	mov    %edx,0x10(%ebp)
+ 308:	0f b6 00             	movzbl (%eax),%eax
+ 30b:	0f be c0             	movsbl %al,%eax
+ 30e:	39 45 08             	cmp    %eax,0x8(%ebp)
+ 311:	74 c6                	je     2d9 <matchstar+0x6>
+ 313:	83 7d 08 2e          	cmpl   $0x2e,0x8(%ebp)
+ 317:	74 c0                	je     2d9 <matchstar+0x6>
+  return 0;
+ 319:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 31e:	c9                   	leave
+ 31f:	c3                   	ret
+
+00000320 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 320:	55                   	push   %ebp
+ 321:	89 e5                	mov    %esp,%ebp
+ 323:	57                   	push   %edi
+ 324:	53                   	push   %ebx
+char*
+ 325:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 328:	8b 55 10             	mov    0x10(%ebp),%edx
+ 32b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32e:	89 cb                	mov    %ecx,%ebx
+ 330:	89 df                	mov    %ebx,%edi
+ 332:	89 d1                	mov    %edx,%ecx
+ 334:	fc                   	cld
+ 335:	f3 aa                	rep stos %al,%es:(%edi)
+ 337:	89 ca                	mov    %ecx,%edx
+ 339:	89 fb                	mov    %edi,%ebx
+ 33b:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 33e:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 341:	90                   	nop
+ 342:	5b                   	pop    %ebx
+ 343:	5f                   	pop    %edi
+ 344:	5d                   	pop    %ebp
+ 345:	c3                   	ret
+
+00000346 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 346:	55                   	push   %ebp
+ 347:	89 e5                	mov    %esp,%ebp
+ 349:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 34c:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 355:	f0 87 02             	lock xchg %eax,(%edx)
+ 358:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 35b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 35e:	c9                   	leave
+ 35f:	c3                   	ret
+
+00000360 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 360:	55                   	push   %ebp
+ 361:	89 e5                	mov    %esp,%ebp
+ 363:	53                   	push   %ebx
+ 364:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 367:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 36a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 36d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 370:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 373:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 377:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 37a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 37d:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 380:	c9                   	leave
+ 381:	c3                   	ret
+
+00000382 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 382:	55                   	push   %ebp
+ 383:	89 e5                	mov    %esp,%ebp
+ 385:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 388:	0f 31                	rdtsc
+ 38a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 38d:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 390:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 393:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 396:	c9                   	leave
+ 397:	c3                   	ret
+
+00000398 <strcpy>:
+{
+ 398:	55                   	push   %ebp
+ 399:	89 e5                	mov    %esp,%ebp
+ 39b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 39e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 3a4:	90                   	nop
+ 3a5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3a8:	8d 42 01             	lea    0x1(%edx),%eax
+ 3ab:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b1:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3b4:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 3b7:	0f b6 12             	movzbl (%edx),%edx
+ 3ba:	88 10                	mov    %dl,(%eax)
+ 3bc:	0f b6 00             	movzbl (%eax),%eax
+ 3bf:	84 c0                	test   %al,%al
+ 3c1:	75 e2                	jne    3a5 <strcpy+0xd>
+  return os;
+ 3c3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3c6:	c9                   	leave
+ 3c7:	c3                   	ret
+
+000003c8 <strcmp>:
+{
+ 3c8:	55                   	push   %ebp
+ 3c9:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3cb:	eb 08                	jmp    3d5 <strcmp+0xd>
+    p++, q++;
+ 3cd:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3d1:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d8:	0f b6 00             	movzbl (%eax),%eax
+ 3db:	84 c0                	test   %al,%al
+ 3dd:	74 10                	je     3ef <strcmp+0x27>
+ 3df:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e2:	0f b6 10             	movzbl (%eax),%edx
+ 3e5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e8:	0f b6 00             	movzbl (%eax),%eax
+ 3eb:	38 c2                	cmp    %al,%dl
+ 3ed:	74 de                	je     3cd <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f2:	0f b6 00             	movzbl (%eax),%eax
+ 3f5:	0f b6 d0             	movzbl %al,%edx
+ 3f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fb:	0f b6 00             	movzbl (%eax),%eax
+ 3fe:	0f b6 c0             	movzbl %al,%eax
+ 401:	29 c2                	sub    %eax,%edx
+ 403:	89 d0                	mov    %edx,%eax
+}
+ 405:	5d                   	pop    %ebp
+ 406:	c3                   	ret
+
+00000407 <strlen>:
+{
+ 407:	55                   	push   %ebp
+ 408:	89 e5                	mov    %esp,%ebp
+ 40a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 40d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 414:	eb 04                	jmp    41a <strlen+0x13>
+ 416:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 41a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 41d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 420:	01 d0                	add    %edx,%eax
+ 422:	0f b6 00             	movzbl (%eax),%eax
+ 425:	84 c0                	test   %al,%al
+ 427:	75 ed                	jne    416 <strlen+0xf>
+  return n;
+ 429:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 42c:	c9                   	leave
+ 42d:	c3                   	ret
+
+0000042e <memset>:
+{
+ 42e:	55                   	push   %ebp
+ 42f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 431:	8b 45 10             	mov    0x10(%ebp),%eax
+ 434:	50                   	push   %eax
+ 435:	ff 75 0c             	push   0xc(%ebp)
+ 438:	ff 75 08             	push   0x8(%ebp)
+ 43b:	e8 e0 fe ff ff       	call   320 <stosb>
+ 440:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 443:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 446:	c9                   	leave
+ 447:	c3                   	ret
+
+00000448 <strchr>:
+{
+ 448:	55                   	push   %ebp
+ 449:	89 e5                	mov    %esp,%ebp
+ 44b:	83 ec 04             	sub    $0x4,%esp
+ 44e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 451:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 454:	eb 14                	jmp    46a <strchr+0x22>
+    if(*s == c)
+ 456:	8b 45 08             	mov    0x8(%ebp),%eax
+ 459:	0f b6 00             	movzbl (%eax),%eax
+ 45c:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 45f:	75 05                	jne    466 <strchr+0x1e>
+      return (char*)s;
+ 461:	8b 45 08             	mov    0x8(%ebp),%eax
+ 464:	eb 13                	jmp    479 <strchr+0x31>
+  for(; *s; s++)
+ 466:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 46a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46d:	0f b6 00             	movzbl (%eax),%eax
+ 470:	84 c0                	test   %al,%al
+ 472:	75 e2                	jne    456 <strchr+0xe>
+  return 0;
+ 474:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 479:	c9                   	leave
+ 47a:	c3                   	ret
+
+0000047b <gets>:
+{
+ 47b:	55                   	push   %ebp
+ 47c:	89 e5                	mov    %esp,%ebp
+ 47e:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 481:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 488:	eb 42                	jmp    4cc <gets+0x51>
+    cc = read(0, &c, 1);
+ 48a:	83 ec 04             	sub    $0x4,%esp
+ 48d:	6a 01                	push   $0x1
+ 48f:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 492:	50                   	push   %eax
+ 493:	6a 00                	push   $0x0
+ 495:	e8 ed 04 00 00       	call   987 <read>
+ 49a:	83 c4 10             	add    $0x10,%esp
+ 49d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 4a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4a4:	7e 33                	jle    4d9 <gets+0x5e>
+    buf[i++] = c;
+ 4a6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ac:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4af:	89 c2                	mov    %eax,%edx
+ 4b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b4:	01 c2                	add    %eax,%edx
+ 4b6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4ba:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4c0:	3c 0a                	cmp    $0xa,%al
+ 4c2:	74 16                	je     4da <gets+0x5f>
+ 4c4:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4c8:	3c 0d                	cmp    $0xd,%al
+ 4ca:	74 0e                	je     4da <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4cc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cf:	83 c0 01             	add    $0x1,%eax
+ 4d2:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4d5:	7f b3                	jg     48a <gets+0xf>
+ 4d7:	eb 01                	jmp    4da <gets+0x5f>
+      break;
+ 4d9:	90                   	nop
+  buf[i] = '\0';
+ 4da:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e0:	01 d0                	add    %edx,%eax
+ 4e2:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4e5:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4e8:	c9                   	leave
+ 4e9:	c3                   	ret
+
+000004ea <stat>:
+{
+ 4ea:	55                   	push   %ebp
+ 4eb:	89 e5                	mov    %esp,%ebp
+ 4ed:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+ 4f3:	6a 00                	push   $0x0
+ 4f5:	ff 75 08             	push   0x8(%ebp)
+ 4f8:	e8 ad 04 00 00       	call   9aa <open>
+ 4fd:	83 c4 10             	add    $0x10,%esp
+ 500:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 503:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 507:	79 07                	jns    510 <stat+0x26>
+    return -1;
+ 509:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 50e:	eb 25                	jmp    535 <stat+0x4b>
+  r = fstat(fd, st);
+ 510:	83 ec 08             	sub    $0x8,%esp
+ 513:	ff 75 0c             	push   0xc(%ebp)
+ 516:	ff 75 f4             	push   -0xc(%ebp)
+ 519:	e8 a1 04 00 00       	call   9bf <fstat>
+ 51e:	83 c4 10             	add    $0x10,%esp
+ 521:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 524:	83 ec 0c             	sub    $0xc,%esp
+ 527:	ff 75 f4             	push   -0xc(%ebp)
+ 52a:	e8 66 04 00 00       	call   995 <close>
+ 52f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 532:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 535:	c9                   	leave
+ 536:	c3                   	ret
+
+00000537 <atoi>:
+{
+ 537:	55                   	push   %ebp
+ 538:	89 e5                	mov    %esp,%ebp
+ 53a:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 53d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 544:	eb 25                	jmp    56b <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 546:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 549:	89 d0                	mov    %edx,%eax
+ 54b:	c1 e0 02             	shl    $0x2,%eax
+ 54e:	01 d0                	add    %edx,%eax
+ 550:	01 c0                	add    %eax,%eax
+ 552:	89 c1                	mov    %eax,%ecx
+ 554:	8b 45 08             	mov    0x8(%ebp),%eax
+ 557:	8d 50 01             	lea    0x1(%eax),%edx
+ 55a:	89 55 08             	mov    %edx,0x8(%ebp)
+ 55d:	0f b6 00             	movzbl (%eax),%eax
+ 560:	0f be c0             	movsbl %al,%eax
+ 563:	01 c8                	add    %ecx,%eax
+ 565:	83 e8 30             	sub    $0x30,%eax
+ 568:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	0f b6 00             	movzbl (%eax),%eax
+ 571:	3c 2f                	cmp    $0x2f,%al
+ 573:	7e 0a                	jle    57f <atoi+0x48>
+ 575:	8b 45 08             	mov    0x8(%ebp),%eax
+ 578:	0f b6 00             	movzbl (%eax),%eax
+ 57b:	3c 39                	cmp    $0x39,%al
+ 57d:	7e c7                	jle    546 <atoi+0xf>
+  return n;
+ 57f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 582:	c9                   	leave
+ 583:	c3                   	ret
+
+00000584 <memmove>:
+{
+ 584:	55                   	push   %ebp
+ 585:	89 e5                	mov    %esp,%ebp
+ 587:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 58a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 590:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 593:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 596:	eb 17                	jmp    5af <memmove+0x2b>
+    *dst++ = *src++;
+ 598:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 59b:	8d 42 01             	lea    0x1(%edx),%eax
+ 59e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 5a1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5a4:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5a7:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5aa:	0f b6 12             	movzbl (%edx),%edx
+ 5ad:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 5af:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b2:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5b5:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5b8:	85 c0                	test   %eax,%eax
+ 5ba:	7f dc                	jg     598 <memmove+0x14>
+  return vdst;
+ 5bc:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5bf:	c9                   	leave
+ 5c0:	c3                   	ret
+
+000005c1 <mutex_init>:
+{
+ 5c1:	55                   	push   %ebp
+ 5c2:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c7:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5cd:	90                   	nop
+ 5ce:	5d                   	pop    %ebp
+ 5cf:	c3                   	ret
+
+000005d0 <mutex_lock>:
+{
+ 5d0:	55                   	push   %ebp
+ 5d1:	89 e5                	mov    %esp,%ebp
+ 5d3:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 5d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d9:	6a 01                	push   $0x1
+ 5db:	6a 00                	push   $0x0
+ 5dd:	50                   	push   %eax
+ 5de:	e8 7d fd ff ff       	call   360 <cmpxchg>
+ 5e3:	83 c4 0c             	add    $0xc,%esp
+ 5e6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 5e9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ed:	74 46                	je     635 <mutex_lock+0x65>
+  if(c != 2)
+ 5ef:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 5f3:	74 38                	je     62d <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 5f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f8:	6a 02                	push   $0x2
+ 5fa:	50                   	push   %eax
+ 5fb:	e8 46 fd ff ff       	call   346 <xchg>
+ 600:	83 c4 08             	add    $0x8,%esp
+ 603:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 606:	eb 25                	jmp    62d <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 608:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60b:	83 ec 08             	sub    $0x8,%esp
+ 60e:	6a 02                	push   $0x2
+ 610:	50                   	push   %eax
+ 611:	e8 22 04 00 00       	call   a38 <futex_wait>
+ 616:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 619:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61c:	83 ec 08             	sub    $0x8,%esp
+ 61f:	6a 02                	push   $0x2
+ 621:	50                   	push   %eax
+ 622:	e8 1f fd ff ff       	call   346 <xchg>
+ 627:	83 c4 10             	add    $0x10,%esp
+ 62a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 62d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 631:	75 d5                	jne    608 <mutex_lock+0x38>
+ 633:	eb 01                	jmp    636 <mutex_lock+0x66>
+    return;
+ 635:	90                   	nop
+}
+ 636:	c9                   	leave
+ 637:	c3                   	ret
+
+00000638 <mutex_unlock>:
+{
+ 638:	55                   	push   %ebp
+ 639:	89 e5                	mov    %esp,%ebp
+ 63b:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 63e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 641:	6a 00                	push   $0x0
+ 643:	50                   	push   %eax
+ 644:	e8 fd fc ff ff       	call   346 <xchg>
+ 649:	83 c4 08             	add    $0x8,%esp
+ 64c:	83 f8 02             	cmp    $0x2,%eax
+ 64f:	75 11                	jne    662 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 651:	8b 45 08             	mov    0x8(%ebp),%eax
+ 654:	83 ec 08             	sub    $0x8,%esp
+ 657:	6a 01                	push   $0x1
+ 659:	50                   	push   %eax
+ 65a:	e8 e3 03 00 00       	call   a42 <futex_wake>
+ 65f:	83 c4 10             	add    $0x10,%esp
+}
+ 662:	90                   	nop
+ 663:	c9                   	leave
+ 664:	c3                   	ret
+
+00000665 <cond_init>:
+{
+ 665:	55                   	push   %ebp
+ 666:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 668:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 671:	90                   	nop
+ 672:	5d                   	pop    %ebp
+ 673:	c3                   	ret
+
+00000674 <cond_wait>:
+{
+ 674:	55                   	push   %ebp
+ 675:	89 e5                	mov    %esp,%ebp
+ 677:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 67a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67d:	8b 00                	mov    (%eax),%eax
+ 67f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 682:	83 ec 0c             	sub    $0xc,%esp
+ 685:	ff 75 0c             	push   0xc(%ebp)
+ 688:	e8 ab ff ff ff       	call   638 <mutex_unlock>
+ 68d:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 690:	8b 45 08             	mov    0x8(%ebp),%eax
+ 693:	83 ec 08             	sub    $0x8,%esp
+ 696:	ff 75 f4             	push   -0xc(%ebp)
+ 699:	50                   	push   %eax
+ 69a:	e8 99 03 00 00       	call   a38 <futex_wait>
+ 69f:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6a2:	eb 11                	jmp    6b5 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 6a4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	6a 02                	push   $0x2
+ 6ac:	50                   	push   %eax
+ 6ad:	e8 86 03 00 00       	call   a38 <futex_wait>
+ 6b2:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6b5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6b8:	83 ec 08             	sub    $0x8,%esp
+ 6bb:	6a 02                	push   $0x2
+ 6bd:	50                   	push   %eax
+ 6be:	e8 83 fc ff ff       	call   346 <xchg>
+ 6c3:	83 c4 10             	add    $0x10,%esp
+ 6c6:	85 c0                	test   %eax,%eax
+ 6c8:	75 da                	jne    6a4 <cond_wait+0x30>
+}
+ 6ca:	90                   	nop
+ 6cb:	90                   	nop
+ 6cc:	c9                   	leave
+ 6cd:	c3                   	ret
+
+000006ce <condbump>:
+{
+ 6ce:	55                   	push   %ebp
+ 6cf:	89 e5                	mov    %esp,%ebp
+ 6d1:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 6d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d7:	8b 00                	mov    (%eax),%eax
+ 6d9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 6dc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6df:	8d 50 01             	lea    0x1(%eax),%edx
+ 6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e5:	52                   	push   %edx
+ 6e6:	ff 75 fc             	push   -0x4(%ebp)
+ 6e9:	50                   	push   %eax
+ 6ea:	e8 71 fc ff ff       	call   360 <cmpxchg>
+ 6ef:	83 c4 0c             	add    $0xc,%esp
+ 6f2:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f5:	75 dd                	jne    6d4 <condbump+0x6>
+}
+ 6f7:	90                   	nop
+ 6f8:	90                   	nop
+ 6f9:	c9                   	leave
+ 6fa:	c3                   	ret
+
+000006fb <cond_signal>:
+{
+ 6fb:	55                   	push   %ebp
+ 6fc:	89 e5                	mov    %esp,%ebp
+ 6fe:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 701:	ff 75 08             	push   0x8(%ebp)
+ 704:	e8 c5 ff ff ff       	call   6ce <condbump>
+ 709:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	83 ec 08             	sub    $0x8,%esp
+ 712:	6a 01                	push   $0x1
+ 714:	50                   	push   %eax
+ 715:	e8 28 03 00 00       	call   a42 <futex_wake>
+ 71a:	83 c4 10             	add    $0x10,%esp
+}
+ 71d:	90                   	nop
+ 71e:	c9                   	leave
+ 71f:	c3                   	ret
+
+00000720 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 720:	55                   	push   %ebp
+ 721:	89 e5                	mov    %esp,%ebp
+ 723:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 726:	ff 75 08             	push   0x8(%ebp)
+ 729:	e8 a0 ff ff ff       	call   6ce <condbump>
+ 72e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 731:	8b 45 08             	mov    0x8(%ebp),%eax
+ 734:	83 ec 08             	sub    $0x8,%esp
+ 737:	68 ff ff ff 7f       	push   $0x7fffffff
+ 73c:	50                   	push   %eax
+ 73d:	e8 00 03 00 00       	call   a42 <futex_wake>
+ 742:	83 c4 10             	add    $0x10,%esp
+}
+ 745:	90                   	nop
+ 746:	c9                   	leave
+ 747:	c3                   	ret
+
+00000748 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 748:	55                   	push   %ebp
+ 749:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 74b:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 750:	8b 00                	mov    (%eax),%eax
+}
+ 752:	5d                   	pop    %ebp
+ 753:	c3                   	ret
+
+00000754 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 754:	55                   	push   %ebp
+ 755:	89 e5                	mov    %esp,%ebp
+ 757:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 75a:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 75f:	8b 00                	mov    (%eax),%eax
+ 761:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 764:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 768:	74 05                	je     76f <vgetpid+0x1b>
+    return pid;
+ 76a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76d:	eb 05                	jmp    774 <vgetpid+0x20>
+  return getpid();
+ 76f:	e8 74 02 00 00       	call   9e8 <getpid>
+}
+ 774:	c9                   	leave
+ 775:	c3                   	ret
+
+00000776 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 776:	55                   	push   %ebp
+ 777:	89 e5                	mov    %esp,%ebp
+ 779:	57                   	push   %edi
+ 77a:	56                   	push   %esi
+ 77b:	53                   	push   %ebx
+ 77c:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 77f:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 786:	e8 f7 fb ff ff       	call   382 <rdtsc>
+ 78b:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 78e:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 791:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 794:	29 c8                	sub    %ecx,%eax
+ 796:	19 da                	sbb    %ebx,%edx
+ 798:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 79b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 79e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7a1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7a4:	89 d0                	mov    %edx,%eax
+ 7a6:	31 d2                	xor    %edx,%edx
+ 7a8:	89 c1                	mov    %eax,%ecx
+ 7aa:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 7af:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7b2:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7ba:	89 df                	mov    %ebx,%edi
+ 7bc:	0f af f8             	imul   %eax,%edi
+ 7bf:	89 d6                	mov    %edx,%esi
+ 7c1:	0f af f1             	imul   %ecx,%esi
+ 7c4:	01 f7                	add    %esi,%edi
+ 7c6:	f7 e1                	mul    %ecx
+ 7c8:	89 c1                	mov    %eax,%ecx
+ 7ca:	89 d3                	mov    %edx,%ebx
+ 7cc:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 7cf:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 7d1:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7d4:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7d7:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 7da:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 7e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e4:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e7:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 7ea:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 7f1:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 7f4:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 7f7:	89 d7                	mov    %edx,%edi
+ 7f9:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 7fc:	0f af fe             	imul   %esi,%edi
+ 7ff:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 802:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 805:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 808:	0f af f0             	imul   %eax,%esi
+ 80b:	01 f7                	add    %esi,%edi
+ 80d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 810:	f7 65 d8             	mull   -0x28(%ebp)
+ 813:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 816:	89 f2                	mov    %esi,%edx
+ 818:	89 d0                	mov    %edx,%eax
+ 81a:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 81c:	01 c8                	add    %ecx,%eax
+ 81e:	11 da                	adc    %ebx,%edx
+}
+ 820:	83 c4 24             	add    $0x24,%esp
+ 823:	5b                   	pop    %ebx
+ 824:	5e                   	pop    %esi
+ 825:	5f                   	pop    %edi
+ 826:	5d                   	pop    %ebp
+ 827:	c3                   	ret
+
+00000828 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 828:	55                   	push   %ebp
+ 829:	89 e5                	mov    %esp,%ebp
+ 82b:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 82e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 831:	8b 50 04             	mov    0x4(%eax),%edx
+ 834:	8b 45 08             	mov    0x8(%ebp),%eax
+ 837:	8b 00                	mov    (%eax),%eax
+ 839:	29 c2                	sub    %eax,%edx
+ 83b:	83 fa 1f             	cmp    $0x1f,%edx
+ 83e:	76 07                	jbe    847 <ring_queue+0x1f>
+    return -1;
+ 840:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 845:	eb 68                	jmp    8af <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 847:	8b 45 08             	mov    0x8(%ebp),%eax
+ 84a:	8b 40 04             	mov    0x4(%eax),%eax
+ 84d:	83 e0 1f             	and    $0x1f,%eax
+ 850:	89 c2                	mov    %eax,%edx
+ 852:	89 d0                	mov    %edx,%eax
+ 854:	c1 e0 02             	shl    $0x2,%eax
+ 857:	01 d0                	add    %edx,%eax
+ 859:	c1 e0 02             	shl    $0x2,%eax
+ 85c:	8d 50 10             	lea    0x10(%eax),%edx
+ 85f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 862:	01 d0                	add    %edx,%eax
+ 864:	83 c0 04             	add    $0x4,%eax
+ 867:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 86a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86d:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 870:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 872:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 875:	8b 55 10             	mov    0x10(%ebp),%edx
+ 878:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 87b:	8b 55 14             	mov    0x14(%ebp),%edx
+ 87e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 881:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 884:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 887:	8b 55 18             	mov    0x18(%ebp),%edx
+ 88a:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 88d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 890:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 893:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 896:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 89b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89e:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 8a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a7:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 8aa:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 8af:	c9                   	leave
+ 8b0:	c3                   	ret
+
+000008b1 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 8b1:	55                   	push   %ebp
+ 8b2:	89 e5                	mov    %esp,%ebp
+ 8b4:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 8b7:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 8bc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8c0:	7f 1a                	jg     8dc <ring_submit+0x2b>
+ 8c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c5:	8b 40 10             	mov    0x10(%eax),%eax
+ 8c8:	83 e0 01             	and    $0x1,%eax
+ 8cb:	85 c0                	test   %eax,%eax
+ 8cd:	74 0d                	je     8dc <ring_submit+0x2b>
+ 8cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d2:	8b 40 10             	mov    0x10(%eax),%eax
+ 8d5:	83 e0 02             	and    $0x2,%eax
+ 8d8:	85 c0                	test   %eax,%eax
+ 8da:	74 10                	je     8ec <ring_submit+0x3b>
+    return ring_enter(min);
+ 8dc:	83 ec 0c             	sub    $0xc,%esp
+ 8df:	ff 75 0c             	push   0xc(%ebp)
+ 8e2:	e8 83 01 00 00       	call   a6a <ring_enter>
+ 8e7:	83 c4 10             	add    $0x10,%esp
+ 8ea:	eb 10                	jmp    8fc <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 8ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ef:	8b 50 0c             	mov    0xc(%eax),%edx
+ 8f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f5:	8b 40 08             	mov    0x8(%eax),%eax
+ 8f8:	29 c2                	sub    %eax,%edx
+ 8fa:	89 d0                	mov    %edx,%eax
+}
+ 8fc:	c9                   	leave
+ 8fd:	c3                   	ret
+
+000008fe <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 8fe:	55                   	push   %ebp
+ 8ff:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 901:	8b 45 08             	mov    0x8(%ebp),%eax
+ 904:	8b 50 08             	mov    0x8(%eax),%edx
+ 907:	8b 45 08             	mov    0x8(%ebp),%eax
+ 90a:	8b 40 0c             	mov    0xc(%eax),%eax
+ 90d:	39 c2                	cmp    %eax,%edx
+ 90f:	75 07                	jne    918 <ring_reap+0x1a>
+    return -1;
+ 911:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 916:	eb 3b                	jmp    953 <ring_reap+0x55>
+  __sync_synchronize();
+ 918:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 91d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 920:	8b 40 08             	mov    0x8(%eax),%eax
+ 923:	83 e0 1f             	and    $0x1f,%eax
+ 926:	89 c2                	mov    %eax,%edx
+ 928:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 92b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92e:	83 c2 52             	add    $0x52,%edx
+ 931:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 935:	8b 02                	mov    (%edx),%eax
+ 937:	8b 52 04             	mov    0x4(%edx),%edx
+ 93a:	89 01                	mov    %eax,(%ecx)
+ 93c:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 93f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 942:	8b 40 08             	mov    0x8(%eax),%eax
+ 945:	8d 50 01             	lea    0x1(%eax),%edx
+ 948:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94b:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 94e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 953:	5d                   	pop    %ebp
+ 954:	c3                   	ret
+
+00000955 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 955:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 95c:	74 0a                	je     968 <usyscall+0x13>
+  movl %esp, %ecx
+ 95e:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 960:	ba 67 09 00 00       	mov    $0x967,%edx
+  sysenter
+ 965:	0f 34                	sysenter
+2:
+  ret
+ 967:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 968:	cd 40                	int    $0x40
+  ret
+ 96a:	c3                   	ret
+
+0000096b <fork>:
+
+SYSCALL(fork)
+ 96b:	b8 01 00 00 00       	mov    $0x1,%eax
+ 970:	eb e3                	jmp    955 <usyscall>
+
+00000972 <exit>:
+SYSCALL(exit)
+ 972:	b8 02 00 00 00       	mov    $0x2,%eax
+ 977:	eb dc                	jmp    955 <usyscall>
+
+00000979 <wait>:
+SYSCALL(wait)
+ 979:	b8 03 00 00 00       	mov    $0x3,%eax
+ 97e:	eb d5                	jmp    955 <usyscall>
+
+00000980 <pipe>:
+SYSCALL(pipe)
+ 980:	b8 04 00 00 00       	mov    $0x4,%eax
+ 985:	eb ce                	jmp    955 <usyscall>
+
+00000987 <read>:
+SYSCALL(read)
+ 987:	b8 05 00 00 00       	mov    $0x5,%eax
+ 98c:	eb c7                	jmp    955 <usyscall>
+
+0000098e <write>:
+SYSCALL(write)
+ 98e:	b8 10 00 00 00       	mov    $0x10,%eax
+ 993:	eb c0                	jmp    955 <usyscall>
+
+00000995 <close>:
+SYSCALL(close)
+ 995:	b8 15 00 00 00       	mov    $0x15,%eax
+ 99a:	eb b9                	jmp    955 <usyscall>
+
+0000099c <kill>:
+SYSCALL(kill)
+ 99c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 9a1:	eb b2                	jmp    955 <usyscall>
+
+000009a3 <exec>:
+SYSCALL(exec)
+ 9a3:	b8 07 00 00 00       	mov    $0x7,%eax
+ 9a8:	eb ab                	jmp    955 <usyscall>
+
+000009aa <open>:
+SYSCALL(open)
+ 9aa:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 9af:	eb a4                	jmp    955 <usyscall>
+
+000009b1 <mknod>:
+SYSCALL(mknod)
+ 9b1:	b8 11 00 00 00       	mov    $0x11,%eax
+ 9b6:	eb 9d                	jmp    955 <usyscall>
+
+000009b8 <unlink>:
+SYSCALL(unlink)
+ 9b8:	b8 12 00 00 00       	mov    $0x12,%eax
+ 9bd:	eb 96                	jmp    955 <usyscall>
+
+000009bf <fstat>:
+SYSCALL(fstat)
+ 9bf:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9c4:	eb 8f                	jmp    955 <usyscall>
+
+000009c6 <link>:
+SYSCALL(link)
+ 9c6:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9cb:	eb 88                	jmp    955 <usyscall>
+
+000009cd <mkdir>:
+SYSCALL(mkdir)
+ 9cd:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9d2:	eb 81                	jmp    955 <usyscall>
+
+000009d4 <chdir>:
+SYSCALL(chdir)
+ 9d4:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9d9:	e9 77 ff ff ff       	jmp    955 <usyscall>
+
+000009de <dup>:
+SYSCALL(dup)
+ 9de:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9e3:	e9 6d ff ff ff       	jmp    955 <usyscall>
+
+000009e8 <getpid>:
+SYSCALL(getpid)
+ 9e8:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9ed:	e9 63 ff ff ff       	jmp    955 <usyscall>
+
+000009f2 <sbrk>:
+SYSCALL(sbrk)
+ 9f2:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9f7:	e9 59 ff ff ff       	jmp    955 <usyscall>
+
+000009fc <sleep>:
+SYSCALL(sleep)
+ 9fc:	b8 0d 00 00 00       	mov    $0xd,%eax
+ a01:	e9 4f ff ff ff       	jmp    955 <usyscall>
+
+00000a06 <uptime>:
+SYSCALL(uptime)
+ a06:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a0b:	e9 45 ff ff ff       	jmp    955 <usyscall>
+
+00000a10 <kmstat>:
+SYSCALL(kmstat)
+ a10:	b8 16 00 00 00       	mov    $0x16,%eax
+ a15:	e9 3b ff ff ff       	jmp    955 <usyscall>
+
+00000a1a <setpriority>:
+SYSCALL(setpriority)
+ a1a:	b8 17 00 00 00       	mov    $0x17,%eax
+ a1f:	e9 31 ff ff ff       	jmp    955 <usyscall>
+
+00000a24 <clone>:
+SYSCALL(clone)
+ a24:	b8 18 00 00 00       	mov    $0x18,%eax
+ a29:	e9 27 ff ff ff       	jmp    955 <usyscall>
+
+00000a2e <join>:
+SYSCALL(join)
+ a2e:	b8 19 00 00 00       	mov    $0x19,%eax
+ a33:	e9 1d ff ff ff       	jmp    955 <usyscall>
+
+00000a38 <futex_wait>:
+SYSCALL(futex_wait)
+ a38:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a3d:	e9 13 ff ff ff       	jmp    955 <usyscall>
+
+00000a42 <futex_wake>:
+SYSCALL(futex_wake)
+ a42:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a47:	e9 09 ff ff ff       	jmp    955 <usyscall>
+
+00000a4c <lockstat>:
+SYSCALL(lockstat)
+ a4c:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a51:	e9 ff fe ff ff       	jmp    955 <usyscall>
+
+00000a56 <sysstat>:
+SYSCALL(sysstat)
+ a56:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a5b:	e9 f5 fe ff ff       	jmp    955 <usyscall>
+
+00000a60 <ring_setup>:
+SYSCALL(ring_setup)
+ a60:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a65:	e9 eb fe ff ff       	jmp    955 <usyscall>
+
+00000a6a <ring_enter>:
+SYSCALL(ring_enter)
+ a6a:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a6f:	e9 e1 fe ff ff       	jmp    955 <usyscall>
+
+00000a74 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a74:	55                   	push   %ebp
+ a75:	89 e5                	mov    %esp,%ebp
+ a77:	83 ec 18             	sub    $0x18,%esp
+ a7a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a7d:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ a80:	83 ec 04             	sub    $0x4,%esp
+ a83:	6a 01                	push   $0x1
+ a85:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a88:	50                   	push   %eax
+ a89:	ff 75 08             	push   0x8(%ebp)
+ a8c:	e8 fd fe ff ff       	call   98e <write>
+ a91:	83 c4 10             	add    $0x10,%esp
+}
+ a94:	90                   	nop
+ a95:	c9                   	leave
+ a96:	c3                   	ret
+
+00000a97 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a97:	55                   	push   %ebp
+ a98:	89 e5                	mov    %esp,%ebp
+ a9a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ a9d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ aa4:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ aa8:	74 17                	je     ac1 <printint+0x2a>
+ aaa:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ aae:	79 11                	jns    ac1 <printint+0x2a>
+    neg = 1;
+ ab0:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ ab7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aba:	f7 d8                	neg    %eax
+ abc:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ abf:	eb 06                	jmp    ac7 <printint+0x30>
+  } else {
+    x = xx;
+ ac1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ac4:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ ac7:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ ace:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ ad1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ad4:	ba 00 00 00 00       	mov    $0x0,%edx
+ ad9:	f7 f1                	div    %ecx
+ adb:	89 d1                	mov    %edx,%ecx
+ add:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae0:	8d 50 01             	lea    0x1(%eax),%edx
+ ae3:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ae6:	0f b6 91 00 15 00 00 	movzbl 0x1500(%ecx),%edx
+ aed:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ af1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ af4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ af7:	ba 00 00 00 00       	mov    $0x0,%edx
+ afc:	f7 f1                	div    %ecx
+ afe:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b01:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b05:	75 c7                	jne    ace <printint+0x37>
+  if(neg)
+ b07:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b0b:	74 2d                	je     b3a <printint+0xa3>
+    buf[i++] = '-';
+ b0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b10:	8d 50 01             	lea    0x1(%eax),%edx
+ b13:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b16:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ b1b:	eb 1d                	jmp    b3a <printint+0xa3>
+    putc(fd, buf[i]);
+ b1d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ b20:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b23:	01 d0                	add    %edx,%eax
+ b25:	0f b6 00             	movzbl (%eax),%eax
+ b28:	0f be c0             	movsbl %al,%eax
+ b2b:	83 ec 08             	sub    $0x8,%esp
+ b2e:	50                   	push   %eax
+ b2f:	ff 75 08             	push   0x8(%ebp)
+ b32:	e8 3d ff ff ff       	call   a74 <putc>
+ b37:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ b3a:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ b3e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b42:	79 d9                	jns    b1d <printint+0x86>
+}
+ b44:	90                   	nop
+ b45:	90                   	nop
+ b46:	c9                   	leave
+ b47:	c3                   	ret
+
+00000b48 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ b48:	55                   	push   %ebp
+ b49:	89 e5                	mov    %esp,%ebp
+ b4b:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ b4e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ b55:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b58:	83 c0 04             	add    $0x4,%eax
+ b5b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b5e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b65:	e9 59 01 00 00       	jmp    cc3 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ b6a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b70:	01 d0                	add    %edx,%eax
+ b72:	0f b6 00             	movzbl (%eax),%eax
+ b75:	0f be c0             	movsbl %al,%eax
+ b78:	25 ff 00 00 00       	and    $0xff,%eax
+ b7d:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ b80:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b84:	75 2c                	jne    bb2 <printf+0x6a>
+      if(c == '%'){
+ b86:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b8a:	75 0c                	jne    b98 <printf+0x50>
+        state = '%';
+ b8c:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b93:	e9 27 01 00 00       	jmp    cbf <printf+0x177>
+      } else {
+        putc(fd, c);
+ b98:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b9b:	0f be c0             	movsbl %al,%eax
+ b9e:	83 ec 08             	sub    $0x8,%esp
+ ba1:	50                   	push   %eax
+ ba2:	ff 75 08             	push   0x8(%ebp)
+ ba5:	e8 ca fe ff ff       	call   a74 <putc>
+ baa:	83 c4 10             	add    $0x10,%esp
+ bad:	e9 0d 01 00 00       	jmp    cbf <printf+0x177>
+      }
+    } else if(state == '%'){
+ bb2:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ bb6:	0f 85 03 01 00 00    	jne    cbf <printf+0x177>
+      if(c == 'd'){
+ bbc:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ bc0:	75 1e                	jne    be0 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ bc2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bc5:	8b 00                	mov    (%eax),%eax
+ bc7:	6a 01                	push   $0x1
+ bc9:	6a 0a                	push   $0xa
+ bcb:	50                   	push   %eax
+ bcc:	ff 75 08             	push   0x8(%ebp)
+ bcf:	e8 c3 fe ff ff       	call   a97 <printint>
+ bd4:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ bd7:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bdb:	e9 d8 00 00 00       	jmp    cb8 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ be0:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ be4:	74 06                	je     bec <printf+0xa4>
+ be6:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ bea:	75 1e                	jne    c0a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ bec:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bef:	8b 00                	mov    (%eax),%eax
+ bf1:	6a 00                	push   $0x0
+ bf3:	6a 10                	push   $0x10
+ bf5:	50                   	push   %eax
+ bf6:	ff 75 08             	push   0x8(%ebp)
+ bf9:	e8 99 fe ff ff       	call   a97 <printint>
+ bfe:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c01:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c05:	e9 ae 00 00 00       	jmp    cb8 <printf+0x170>
+      } else if(c == 's'){
+ c0a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ c0e:	75 43                	jne    c53 <printf+0x10b>
+        s = (char*)*ap;
+ c10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c13:	8b 00                	mov    (%eax),%eax
+ c15:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ c18:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ c1c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c20:	75 25                	jne    c47 <printf+0xff>
+          s = "(null)";
+ c22:	c7 45 f4 be 0f 00 00 	movl   $0xfbe,-0xc(%ebp)
+        while(*s != 0){
+ c29:	eb 1c                	jmp    c47 <printf+0xff>
+          putc(fd, *s);
+ c2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2e:	0f b6 00             	movzbl (%eax),%eax
+ c31:	0f be c0             	movsbl %al,%eax
+ c34:	83 ec 08             	sub    $0x8,%esp
+ c37:	50                   	push   %eax
+ c38:	ff 75 08             	push   0x8(%ebp)
+ c3b:	e8 34 fe ff ff       	call   a74 <putc>
+ c40:	83 c4 10             	add    $0x10,%esp
+          s++;
+ c43:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ c47:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4a:	0f b6 00             	movzbl (%eax),%eax
+ c4d:	84 c0                	test   %al,%al
+ c4f:	75 da                	jne    c2b <printf+0xe3>
+ c51:	eb 65                	jmp    cb8 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ c53:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c57:	75 1d                	jne    c76 <printf+0x12e>
+        putc(fd, *ap);
+ c59:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c5c:	8b 00                	mov    (%eax),%eax
+ c5e:	0f be c0             	movsbl %al,%eax
+ c61:	83 ec 08             	sub    $0x8,%esp
+ c64:	50                   	push   %eax
+ c65:	ff 75 08             	push   0x8(%ebp)
+ c68:	e8 07 fe ff ff       	call   a74 <putc>
+ c6d:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c70:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c74:	eb 42                	jmp    cb8 <printf+0x170>
+      } else if(c == '%'){
+ c76:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c7a:	75 17                	jne    c93 <printf+0x14b>
+        putc(fd, c);
+ c7c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c7f:	0f be c0             	movsbl %al,%eax
+ c82:	83 ec 08             	sub    $0x8,%esp
+ c85:	50                   	push   %eax
+ c86:	ff 75 08             	push   0x8(%ebp)
+ c89:	e8 e6 fd ff ff       	call   a74 <putc>
+ c8e:	83 c4 10             	add    $0x10,%esp
+ c91:	eb 25                	jmp    cb8 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ c93:	83 ec 08             	sub    $0x8,%esp
+ c96:	6a 25                	push   $0x25
+ c98:	ff 75 08             	push   0x8(%ebp)
+ c9b:	e8 d4 fd ff ff       	call   a74 <putc>
+ ca0:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ ca3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ca6:	0f be c0             	movsbl %al,%eax
+ ca9:	83 ec 08             	sub    $0x8,%esp
+ cac:	50                   	push   %eax
+ cad:	ff 75 08             	push   0x8(%ebp)
+ cb0:	e8 bf fd ff ff       	call   a74 <putc>
+ cb5:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ cb8:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ cbf:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ cc3:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cc6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc9:	01 d0                	add    %edx,%eax
+ ccb:	0f b6 00             	movzbl (%eax),%eax
+ cce:	84 c0                	test   %al,%al
+ cd0:	0f 85 94 fe ff ff    	jne    b6a <printf+0x22>
+    }
+  }
+}
+ cd6:	90                   	nop
+ cd7:	90                   	nop
+ cd8:	c9                   	leave
+ cd9:	c3                   	ret
+
+00000cda <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cda:	55                   	push   %ebp
+ cdb:	89 e5                	mov    %esp,%ebp
+ cdd:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ ce0:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce3:	83 e8 08             	sub    $0x8,%eax
+ ce6:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ce9:	a1 28 19 00 00       	mov    0x1928,%eax
+ cee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ cf1:	eb 24                	jmp    d17 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cf3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf6:	8b 00                	mov    (%eax),%eax
+ cf8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cfb:	72 12                	jb     d0f <free+0x35>
+ cfd:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d00:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d03:	72 24                	jb     d29 <free+0x4f>
+ d05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d08:	8b 00                	mov    (%eax),%eax
+ d0a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d0d:	72 1a                	jb     d29 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d12:	8b 00                	mov    (%eax),%eax
+ d14:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d17:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d1a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d1d:	73 d4                	jae    cf3 <free+0x19>
+ d1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d22:	8b 00                	mov    (%eax),%eax
+ d24:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d27:	73 ca                	jae    cf3 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d29:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d2c:	8b 40 04             	mov    0x4(%eax),%eax
+ d2f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d36:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d39:	01 c2                	add    %eax,%edx
+ d3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d3e:	8b 00                	mov    (%eax),%eax
+ d40:	39 c2                	cmp    %eax,%edx
+ d42:	75 24                	jne    d68 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ d44:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d47:	8b 50 04             	mov    0x4(%eax),%edx
+ d4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d4d:	8b 00                	mov    (%eax),%eax
+ d4f:	8b 40 04             	mov    0x4(%eax),%eax
+ d52:	01 c2                	add    %eax,%edx
+ d54:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d57:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d5a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d5d:	8b 00                	mov    (%eax),%eax
+ d5f:	8b 10                	mov    (%eax),%edx
+ d61:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d64:	89 10                	mov    %edx,(%eax)
+ d66:	eb 0a                	jmp    d72 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d68:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d6b:	8b 10                	mov    (%eax),%edx
+ d6d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d70:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ d72:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d75:	8b 40 04             	mov    0x4(%eax),%eax
+ d78:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d82:	01 d0                	add    %edx,%eax
+ d84:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d87:	75 20                	jne    da9 <free+0xcf>
+    p->s.size += bp->s.size;
+ d89:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d8c:	8b 50 04             	mov    0x4(%eax),%edx
+ d8f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d92:	8b 40 04             	mov    0x4(%eax),%eax
+ d95:	01 c2                	add    %eax,%edx
+ d97:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d9a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ d9d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ da0:	8b 10                	mov    (%eax),%edx
+ da2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ da5:	89 10                	mov    %edx,(%eax)
+ da7:	eb 08                	jmp    db1 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ da9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dac:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ daf:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ db1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ db4:	a3 28 19 00 00       	mov    %eax,0x1928
+}
+ db9:	90                   	nop
+ dba:	c9                   	leave
+ dbb:	c3                   	ret
+
+00000dbc <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ dbc:	55                   	push   %ebp
+ dbd:	89 e5                	mov    %esp,%ebp
+ dbf:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ dc2:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ dc9:	77 07                	ja     dd2 <morecore+0x16>
+    nu = 4096;
+ dcb:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ dd2:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd5:	c1 e0 03             	shl    $0x3,%eax
+ dd8:	83 ec 0c             	sub    $0xc,%esp
+ ddb:	50                   	push   %eax
+ ddc:	e8 11 fc ff ff       	call   9f2 <sbrk>
+ de1:	83 c4 10             	add    $0x10,%esp
+ de4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ de7:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ deb:	75 07                	jne    df4 <morecore+0x38>
+    return 0;
+ ded:	b8 00 00 00 00       	mov    $0x0,%eax
+ df2:	eb 26                	jmp    e1a <morecore+0x5e>
+  hp = (Header*)p;
+ df4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ dfa:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dfd:	8b 55 08             	mov    0x8(%ebp),%edx
+ e00:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ e03:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e06:	83 c0 08             	add    $0x8,%eax
+ e09:	83 ec 0c             	sub    $0xc,%esp
+ e0c:	50                   	push   %eax
+ e0d:	e8 c8 fe ff ff       	call   cda <free>
+ e12:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ e15:	a1 28 19 00 00       	mov    0x1928,%eax
+}
+ e1a:	c9                   	leave
+ e1b:	c3                   	ret
+
+00000e1c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e1c:	55                   	push   %ebp
+ e1d:	89 e5                	mov    %esp,%ebp
+ e1f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e22:	8b 45 08             	mov    0x8(%ebp),%eax
+ e25:	83 c0 07             	add    $0x7,%eax
+ e28:	c1 e8 03             	shr    $0x3,%eax
+ e2b:	83 c0 01             	add    $0x1,%eax
+ e2e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ e31:	a1 28 19 00 00       	mov    0x1928,%eax
+ e36:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e39:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e3d:	75 23                	jne    e62 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ e3f:	c7 45 f0 20 19 00 00 	movl   $0x1920,-0x10(%ebp)
+ e46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e49:	a3 28 19 00 00       	mov    %eax,0x1928
+ e4e:	a1 28 19 00 00       	mov    0x1928,%eax
+ e53:	a3 20 19 00 00       	mov    %eax,0x1920
+    base.s.size = 0;
+ e58:	c7 05 24 19 00 00 00 	movl   $0x0,0x1924
+ e5f:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e62:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e65:	8b 00                	mov    (%eax),%eax
+ e67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e6d:	8b 40 04             	mov    0x4(%eax),%eax
+ e70:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e73:	72 4d                	jb     ec2 <malloc+0xa6>
+      if(p->s.size == nunits)
+ e75:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e78:	8b 40 04             	mov    0x4(%eax),%eax
+ e7b:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e7e:	75 0c                	jne    e8c <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ e80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e83:	8b 10                	mov    (%eax),%edx
+ e85:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e88:	89 10                	mov    %edx,(%eax)
+ e8a:	eb 26                	jmp    eb2 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ e8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8f:	8b 40 04             	mov    0x4(%eax),%eax
+ e92:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e95:	89 c2                	mov    %eax,%edx
+ e97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ea0:	8b 40 04             	mov    0x4(%eax),%eax
+ ea3:	c1 e0 03             	shl    $0x3,%eax
+ ea6:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ea9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eac:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ eaf:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ eb2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eb5:	a3 28 19 00 00       	mov    %eax,0x1928
+      return (void*)(p + 1);
+ eba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ebd:	83 c0 08             	add    $0x8,%eax
+ ec0:	eb 3b                	jmp    efd <malloc+0xe1>
+    }
+    if(p == freep)
+ ec2:	a1 28 19 00 00       	mov    0x1928,%eax
+ ec7:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ eca:	75 1e                	jne    eea <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ecc:	83 ec 0c             	sub    $0xc,%esp
+ ecf:	ff 75 ec             	push   -0x14(%ebp)
+ ed2:	e8 e5 fe ff ff       	call   dbc <morecore>
+ ed7:	83 c4 10             	add    $0x10,%esp
+ eda:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ edd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ee1:	75 07                	jne    eea <malloc+0xce>
+        return 0;
+ ee3:	b8 00 00 00 00       	mov    $0x0,%eax
+ ee8:	eb 13                	jmp    efd <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ eea:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eed:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ef0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ef3:	8b 00                	mov    (%eax),%eax
+ ef5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ef8:	e9 6d ff ff ff       	jmp    e6a <malloc+0x4e>
+  }
+}
+ efd:	c9                   	leave
+ efe:	c3                   	ret
+
+00000eff <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ eff:	55                   	push   %ebp
+ f00:	89 e5                	mov    %esp,%ebp
+ f02:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ f05:	83 ec 0c             	sub    $0xc,%esp
+ f08:	68 00 10 00 00       	push   $0x1000
+ f0d:	e8 0a ff ff ff       	call   e1c <malloc>
+ f12:	83 c4 10             	add    $0x10,%esp
+ f15:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f18:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f1c:	75 07                	jne    f25 <thread_create+0x26>
+    return -1;
+ f1e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f23:	eb 2e                	jmp    f53 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ f25:	83 ec 04             	sub    $0x4,%esp
+ f28:	ff 75 f4             	push   -0xc(%ebp)
+ f2b:	ff 75 0c             	push   0xc(%ebp)
+ f2e:	ff 75 08             	push   0x8(%ebp)
+ f31:	e8 ee fa ff ff       	call   a24 <clone>
+ f36:	83 c4 10             	add    $0x10,%esp
+ f39:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f3c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ f40:	79 0e                	jns    f50 <thread_create+0x51>
+    free(stack);
+ f42:	83 ec 0c             	sub    $0xc,%esp
+ f45:	ff 75 f4             	push   -0xc(%ebp)
+ f48:	e8 8d fd ff ff       	call   cda <free>
+ f4d:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ f50:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f53:	c9                   	leave
+ f54:	c3                   	ret
+
+00000f55 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ f55:	55                   	push   %ebp
+ f56:	89 e5                	mov    %esp,%ebp
+ f58:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f5b:	83 ec 0c             	sub    $0xc,%esp
+ f5e:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f61:	50                   	push   %eax
+ f62:	e8 c7 fa ff ff       	call   a2e <join>
+ f67:	83 c4 10             	add    $0x10,%esp
+ f6a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f6d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f71:	78 0f                	js     f82 <thread_join+0x2d>
+    free(stack);
+ f73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f76:	83 ec 0c             	sub    $0xc,%esp
+ f79:	50                   	push   %eax
+ f7a:	e8 5b fd ff ff       	call   cda <free>
+ f7f:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ f82:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f85:	c9                   	leave
+ f86:	c3                   	ret
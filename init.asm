@@ -0,0 +1,1838 @@
+
+_init:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+char *argv[] = { "sh", 0 };
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 14             	sub    $0x14,%esp
+  int pid, wpid;
+
+  if(open("console", O_RDWR) < 0){
+  11:	83 ec 08             	sub    $0x8,%esp
+  14:	6a 02                	push   $0x2
+  16:	68 6b 0d 00 00       	push   $0xd6b
+  1b:	e8 6b 07 00 00       	call   78b <open>
+  20:	83 c4 10             	add    $0x10,%esp
+  23:	85 c0                	test   %eax,%eax
+  25:	79 26                	jns    4d <main+0x4d>
+    mknod("console", 1, 1);
+  27:	83 ec 04             	sub    $0x4,%esp
+  2a:	6a 01                	push   $0x1
+  2c:	6a 01                	push   $0x1
+  2e:	68 6b 0d 00 00       	push   $0xd6b
+  33:	e8 5a 07 00 00       	call   792 <mknod>
+  38:	83 c4 10             	add    $0x10,%esp
+    open("console", O_RDWR);
+  3b:	83 ec 08             	sub    $0x8,%esp
+  3e:	6a 02                	push   $0x2
+  40:	68 6b 0d 00 00       	push   $0xd6b
+  45:	e8 41 07 00 00       	call   78b <open>
+  4a:	83 c4 10             	add    $0x10,%esp
+  }
+  dup(0);  // stdout
+  4d:	83 ec 0c             	sub    $0xc,%esp
+  50:	6a 00                	push   $0x0
+  52:	e8 68 07 00 00       	call   7bf <dup>
+  57:	83 c4 10             	add    $0x10,%esp
+  dup(0);  // stderr
+  5a:	83 ec 0c             	sub    $0xc,%esp
+  5d:	6a 00                	push   $0x0
+  5f:	e8 5b 07 00 00       	call   7bf <dup>
+  64:	83 c4 10             	add    $0x10,%esp
+
+  for(;;){
+    printf(1, "init: starting sh\n");
+  67:	83 ec 08             	sub    $0x8,%esp
+  6a:	68 73 0d 00 00       	push   $0xd73
+  6f:	6a 01                	push   $0x1
+  71:	e8 b3 08 00 00       	call   929 <printf>
+  76:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+  79:	e8 ce 06 00 00       	call   74c <fork>
+  7e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(pid < 0){
+  81:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  85:	79 17                	jns    9e <main+0x9e>
+      printf(1, "init: fork failed\n");
+  87:	83 ec 08             	sub    $0x8,%esp
+  8a:	68 86 0d 00 00       	push   $0xd86
+  8f:	6a 01                	push   $0x1
+  91:	e8 93 08 00 00       	call   929 <printf>
+  96:	83 c4 10             	add    $0x10,%esp
+      exit();
+  99:	e8 b5 06 00 00       	call   753 <exit>
+    }
+    if(pid == 0){
+  9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+  a2:	75 3e                	jne    e2 <main+0xe2>
+      exec("sh", argv);
+  a4:	83 ec 08             	sub    $0x8,%esp
+  a7:	68 74 12 00 00       	push   $0x1274
+  ac:	68 68 0d 00 00       	push   $0xd68
+  b1:	e8 ce 06 00 00       	call   784 <exec>
+  b6:	83 c4 10             	add    $0x10,%esp
+      printf(1, "init: exec sh failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 99 0d 00 00       	push   $0xd99
+  c1:	6a 01                	push   $0x1
+  c3:	e8 61 08 00 00       	call   929 <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 83 06 00 00       	call   753 <exit>
+    }
+    while((wpid=wait()) >= 0 && wpid != pid)
+      printf(1, "zombie!\n");
+  d0:	83 ec 08             	sub    $0x8,%esp
+  d3:	68 af 0d 00 00       	push   $0xdaf
+  d8:	6a 01                	push   $0x1
+  da:	e8 4a 08 00 00       	call   929 <printf>
+  df:	83 c4 10             	add    $0x10,%esp
+    while((wpid=wait()) >= 0 && wpid != pid)
+  e2:	e8 73 06 00 00       	call   75a <wait>
+  e7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  ea:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+  ee:	0f 88 73 ff ff ff    	js     67 <main+0x67>
+  f4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  f7:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  fa:	75 d4                	jne    d0 <main+0xd0>
+    printf(1, "init: starting sh\n");
+  fc:	e9 66 ff ff ff       	jmp    67 <main+0x67>
+
+00000101 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 101:	55                   	push   %ebp
+ 102:	89 e5                	mov    %esp,%ebp
+ 104:	57                   	push   %edi
+ 105:	53                   	push   %ebx
+char*
+ 106:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 109:	8b 55 10             	mov    0x10(%ebp),%edx
+ 10c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 10f:	89 cb                	mov    %ecx,%ebx
+ 111:	89 df                	mov    %ebx,%edi
+ 113:	89 d1                	mov    %edx,%ecx
+ 115:	fc                   	cld
+ 116:	f3 aa                	rep stos %al,%es:(%edi)
+ 118:	89 ca                	mov    %ecx,%edx
+ 11a:	89 fb                	mov    %edi,%ebx
+ 11c:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 11f:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 122:	90                   	nop
+ 123:	5b                   	pop    %ebx
+ 124:	5f                   	pop    %edi
+ 125:	5d                   	pop    %ebp
+ 126:	c3                   	ret
+
+00000127 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 127:	55                   	push   %ebp
+ 128:	89 e5                	mov    %esp,%ebp
+ 12a:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 12d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 130:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 133:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 136:	f0 87 02             	lock xchg %eax,(%edx)
+ 139:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 13c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 13f:	c9                   	leave
+ 140:	c3                   	ret
+
+00000141 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 141:	55                   	push   %ebp
+ 142:	89 e5                	mov    %esp,%ebp
+ 144:	53                   	push   %ebx
+ 145:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 148:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 14b:	8b 55 10             	mov    0x10(%ebp),%edx
+ 14e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 151:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 154:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 158:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 15b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 15e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 161:	c9                   	leave
+ 162:	c3                   	ret
+
+00000163 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 163:	55                   	push   %ebp
+ 164:	89 e5                	mov    %esp,%ebp
+ 166:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 169:	0f 31                	rdtsc
+ 16b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 16e:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 171:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 174:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 177:	c9                   	leave
+ 178:	c3                   	ret
+
+00000179 <strcpy>:
+{
+ 179:	55                   	push   %ebp
+ 17a:	89 e5                	mov    %esp,%ebp
+ 17c:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 17f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 182:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 185:	90                   	nop
+ 186:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 189:	8d 42 01             	lea    0x1(%edx),%eax
+ 18c:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 18f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 192:	8d 48 01             	lea    0x1(%eax),%ecx
+ 195:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 198:	0f b6 12             	movzbl (%edx),%edx
+ 19b:	88 10                	mov    %dl,(%eax)
+ 19d:	0f b6 00             	movzbl (%eax),%eax
+ 1a0:	84 c0                	test   %al,%al
+ 1a2:	75 e2                	jne    186 <strcpy+0xd>
+  return os;
+ 1a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1a7:	c9                   	leave
+ 1a8:	c3                   	ret
+
+000001a9 <strcmp>:
+{
+ 1a9:	55                   	push   %ebp
+ 1aa:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1ac:	eb 08                	jmp    1b6 <strcmp+0xd>
+    p++, q++;
+ 1ae:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1b2:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b9:	0f b6 00             	movzbl (%eax),%eax
+ 1bc:	84 c0                	test   %al,%al
+ 1be:	74 10                	je     1d0 <strcmp+0x27>
+ 1c0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c3:	0f b6 10             	movzbl (%eax),%edx
+ 1c6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c9:	0f b6 00             	movzbl (%eax),%eax
+ 1cc:	38 c2                	cmp    %al,%dl
+ 1ce:	74 de                	je     1ae <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	0f b6 00             	movzbl (%eax),%eax
+ 1d6:	0f b6 d0             	movzbl %al,%edx
+ 1d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1dc:	0f b6 00             	movzbl (%eax),%eax
+ 1df:	0f b6 c0             	movzbl %al,%eax
+ 1e2:	29 c2                	sub    %eax,%edx
+ 1e4:	89 d0                	mov    %edx,%eax
+}
+ 1e6:	5d                   	pop    %ebp
+ 1e7:	c3                   	ret
+
+000001e8 <strlen>:
+{
+ 1e8:	55                   	push   %ebp
+ 1e9:	89 e5                	mov    %esp,%ebp
+ 1eb:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 1ee:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 1f5:	eb 04                	jmp    1fb <strlen+0x13>
+ 1f7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 1fb:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 1fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 201:	01 d0                	add    %edx,%eax
+ 203:	0f b6 00             	movzbl (%eax),%eax
+ 206:	84 c0                	test   %al,%al
+ 208:	75 ed                	jne    1f7 <strlen+0xf>
+  return n;
+ 20a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 20d:	c9                   	leave
+ 20e:	c3                   	ret
+
+0000020f <memset>:
+{
+ 20f:	55                   	push   %ebp
+ 210:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 212:	8b 45 10             	mov    0x10(%ebp),%eax
+ 215:	50                   	push   %eax
+ 216:	ff 75 0c             	push   0xc(%ebp)
+ 219:	ff 75 08             	push   0x8(%ebp)
+ 21c:	e8 e0 fe ff ff       	call   101 <stosb>
+ 221:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 224:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 227:	c9                   	leave
+ 228:	c3                   	ret
+
+00000229 <strchr>:
+{
+ 229:	55                   	push   %ebp
+ 22a:	89 e5                	mov    %esp,%ebp
+ 22c:	83 ec 04             	sub    $0x4,%esp
+ 22f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 232:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 235:	eb 14                	jmp    24b <strchr+0x22>
+    if(*s == c)
+ 237:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23a:	0f b6 00             	movzbl (%eax),%eax
+ 23d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 240:	75 05                	jne    247 <strchr+0x1e>
+      return (char*)s;
+ 242:	8b 45 08             	mov    0x8(%ebp),%eax
+ 245:	eb 13                	jmp    25a <strchr+0x31>
+  for(; *s; s++)
+ 247:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	0f b6 00             	movzbl (%eax),%eax
+ 251:	84 c0                	test   %al,%al
+ 253:	75 e2                	jne    237 <strchr+0xe>
+  return 0;
+ 255:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 25a:	c9                   	leave
+ 25b:	c3                   	ret
+
+0000025c <gets>:
+{
+ 25c:	55                   	push   %ebp
+ 25d:	89 e5                	mov    %esp,%ebp
+ 25f:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 262:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 269:	eb 42                	jmp    2ad <gets+0x51>
+    cc = read(0, &c, 1);
+ 26b:	83 ec 04             	sub    $0x4,%esp
+ 26e:	6a 01                	push   $0x1
+ 270:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 273:	50                   	push   %eax
+ 274:	6a 00                	push   $0x0
+ 276:	e8 ed 04 00 00       	call   768 <read>
+ 27b:	83 c4 10             	add    $0x10,%esp
+ 27e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 281:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 285:	7e 33                	jle    2ba <gets+0x5e>
+    buf[i++] = c;
+ 287:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 28a:	8d 50 01             	lea    0x1(%eax),%edx
+ 28d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 290:	89 c2                	mov    %eax,%edx
+ 292:	8b 45 08             	mov    0x8(%ebp),%eax
+ 295:	01 c2                	add    %eax,%edx
+ 297:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 29b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 29d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a1:	3c 0a                	cmp    $0xa,%al
+ 2a3:	74 16                	je     2bb <gets+0x5f>
+ 2a5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2a9:	3c 0d                	cmp    $0xd,%al
+ 2ab:	74 0e                	je     2bb <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2b0:	83 c0 01             	add    $0x1,%eax
+ 2b3:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2b6:	7f b3                	jg     26b <gets+0xf>
+ 2b8:	eb 01                	jmp    2bb <gets+0x5f>
+      break;
+ 2ba:	90                   	nop
+  buf[i] = '\0';
+ 2bb:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c1:	01 d0                	add    %edx,%eax
+ 2c3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2c9:	c9                   	leave
+ 2ca:	c3                   	ret
+
+000002cb <stat>:
+{
+ 2cb:	55                   	push   %ebp
+ 2cc:	89 e5                	mov    %esp,%ebp
+ 2ce:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2d1:	83 ec 08             	sub    $0x8,%esp
+ 2d4:	6a 00                	push   $0x0
+ 2d6:	ff 75 08             	push   0x8(%ebp)
+ 2d9:	e8 ad 04 00 00       	call   78b <open>
+ 2de:	83 c4 10             	add    $0x10,%esp
+ 2e1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 2e4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2e8:	79 07                	jns    2f1 <stat+0x26>
+    return -1;
+ 2ea:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 2ef:	eb 25                	jmp    316 <stat+0x4b>
+  r = fstat(fd, st);
+ 2f1:	83 ec 08             	sub    $0x8,%esp
+ 2f4:	ff 75 0c             	push   0xc(%ebp)
+ 2f7:	ff 75 f4             	push   -0xc(%ebp)
+ 2fa:	e8 a1 04 00 00       	call   7a0 <fstat>
+ 2ff:	83 c4 10             	add    $0x10,%esp
+ 302:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 305:	83 ec 0c             	sub    $0xc,%esp
+ 308:	ff 75 f4             	push   -0xc(%ebp)
+ 30b:	e8 66 04 00 00       	call   776 <close>
+ 310:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 313:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 316:	c9                   	leave
+ 317:	c3                   	ret
+
+00000318 <atoi>:
+{
+ 318:	55                   	push   %ebp
+ 319:	89 e5                	mov    %esp,%ebp
+ 31b:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 31e:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 325:	eb 25                	jmp    34c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 327:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 32a:	89 d0                	mov    %edx,%eax
+ 32c:	c1 e0 02             	shl    $0x2,%eax
+ 32f:	01 d0                	add    %edx,%eax
+ 331:	01 c0                	add    %eax,%eax
+ 333:	89 c1                	mov    %eax,%ecx
+ 335:	8b 45 08             	mov    0x8(%ebp),%eax
+ 338:	8d 50 01             	lea    0x1(%eax),%edx
+ 33b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 33e:	0f b6 00             	movzbl (%eax),%eax
+ 341:	0f be c0             	movsbl %al,%eax
+ 344:	01 c8                	add    %ecx,%eax
+ 346:	83 e8 30             	sub    $0x30,%eax
+ 349:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34f:	0f b6 00             	movzbl (%eax),%eax
+ 352:	3c 2f                	cmp    $0x2f,%al
+ 354:	7e 0a                	jle    360 <atoi+0x48>
+ 356:	8b 45 08             	mov    0x8(%ebp),%eax
+ 359:	0f b6 00             	movzbl (%eax),%eax
+ 35c:	3c 39                	cmp    $0x39,%al
+ 35e:	7e c7                	jle    327 <atoi+0xf>
+  return n;
+ 360:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 363:	c9                   	leave
+ 364:	c3                   	ret
+
+00000365 <memmove>:
+{
+ 365:	55                   	push   %ebp
+ 366:	89 e5                	mov    %esp,%ebp
+ 368:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 36b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 371:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 374:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 377:	eb 17                	jmp    390 <memmove+0x2b>
+    *dst++ = *src++;
+ 379:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 37c:	8d 42 01             	lea    0x1(%edx),%eax
+ 37f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 382:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 385:	8d 48 01             	lea    0x1(%eax),%ecx
+ 388:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 38b:	0f b6 12             	movzbl (%edx),%edx
+ 38e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 390:	8b 45 10             	mov    0x10(%ebp),%eax
+ 393:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 396:	89 55 10             	mov    %edx,0x10(%ebp)
+ 399:	85 c0                	test   %eax,%eax
+ 39b:	7f dc                	jg     379 <memmove+0x14>
+  return vdst;
+ 39d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a0:	c9                   	leave
+ 3a1:	c3                   	ret
+
+000003a2 <mutex_init>:
+{
+ 3a2:	55                   	push   %ebp
+ 3a3:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ae:	90                   	nop
+ 3af:	5d                   	pop    %ebp
+ 3b0:	c3                   	ret
+
+000003b1 <mutex_lock>:
+{
+ 3b1:	55                   	push   %ebp
+ 3b2:	89 e5                	mov    %esp,%ebp
+ 3b4:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ba:	6a 01                	push   $0x1
+ 3bc:	6a 00                	push   $0x0
+ 3be:	50                   	push   %eax
+ 3bf:	e8 7d fd ff ff       	call   141 <cmpxchg>
+ 3c4:	83 c4 0c             	add    $0xc,%esp
+ 3c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3ce:	74 46                	je     416 <mutex_lock+0x65>
+  if(c != 2)
+ 3d0:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 3d4:	74 38                	je     40e <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 3d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d9:	6a 02                	push   $0x2
+ 3db:	50                   	push   %eax
+ 3dc:	e8 46 fd ff ff       	call   127 <xchg>
+ 3e1:	83 c4 08             	add    $0x8,%esp
+ 3e4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 3e7:	eb 25                	jmp    40e <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 3e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ec:	83 ec 08             	sub    $0x8,%esp
+ 3ef:	6a 02                	push   $0x2
+ 3f1:	50                   	push   %eax
+ 3f2:	e8 22 04 00 00       	call   819 <futex_wait>
+ 3f7:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 3fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fd:	83 ec 08             	sub    $0x8,%esp
+ 400:	6a 02                	push   $0x2
+ 402:	50                   	push   %eax
+ 403:	e8 1f fd ff ff       	call   127 <xchg>
+ 408:	83 c4 10             	add    $0x10,%esp
+ 40b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 40e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 412:	75 d5                	jne    3e9 <mutex_lock+0x38>
+ 414:	eb 01                	jmp    417 <mutex_lock+0x66>
+    return;
+ 416:	90                   	nop
+}
+ 417:	c9                   	leave
+ 418:	c3                   	ret
+
+00000419 <mutex_unlock>:
+{
+ 419:	55                   	push   %ebp
+ 41a:	89 e5                	mov    %esp,%ebp
+ 41c:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 41f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 422:	6a 00                	push   $0x0
+ 424:	50                   	push   %eax
+ 425:	e8 fd fc ff ff       	call   127 <xchg>
+ 42a:	83 c4 08             	add    $0x8,%esp
+ 42d:	83 f8 02             	cmp    $0x2,%eax
+ 430:	75 11                	jne    443 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 432:	8b 45 08             	mov    0x8(%ebp),%eax
+ 435:	83 ec 08             	sub    $0x8,%esp
+ 438:	6a 01                	push   $0x1
+ 43a:	50                   	push   %eax
+ 43b:	e8 e3 03 00 00       	call   823 <futex_wake>
+ 440:	83 c4 10             	add    $0x10,%esp
+}
+ 443:	90                   	nop
+ 444:	c9                   	leave
+ 445:	c3                   	ret
+
+00000446 <cond_init>:
+{
+ 446:	55                   	push   %ebp
+ 447:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 449:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 452:	90                   	nop
+ 453:	5d                   	pop    %ebp
+ 454:	c3                   	ret
+
+00000455 <cond_wait>:
+{
+ 455:	55                   	push   %ebp
+ 456:	89 e5                	mov    %esp,%ebp
+ 458:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 45b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45e:	8b 00                	mov    (%eax),%eax
+ 460:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 463:	83 ec 0c             	sub    $0xc,%esp
+ 466:	ff 75 0c             	push   0xc(%ebp)
+ 469:	e8 ab ff ff ff       	call   419 <mutex_unlock>
+ 46e:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 471:	8b 45 08             	mov    0x8(%ebp),%eax
+ 474:	83 ec 08             	sub    $0x8,%esp
+ 477:	ff 75 f4             	push   -0xc(%ebp)
+ 47a:	50                   	push   %eax
+ 47b:	e8 99 03 00 00       	call   819 <futex_wait>
+ 480:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 483:	eb 11                	jmp    496 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 485:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 488:	83 ec 08             	sub    $0x8,%esp
+ 48b:	6a 02                	push   $0x2
+ 48d:	50                   	push   %eax
+ 48e:	e8 86 03 00 00       	call   819 <futex_wait>
+ 493:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 496:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	6a 02                	push   $0x2
+ 49e:	50                   	push   %eax
+ 49f:	e8 83 fc ff ff       	call   127 <xchg>
+ 4a4:	83 c4 10             	add    $0x10,%esp
+ 4a7:	85 c0                	test   %eax,%eax
+ 4a9:	75 da                	jne    485 <cond_wait+0x30>
+}
+ 4ab:	90                   	nop
+ 4ac:	90                   	nop
+ 4ad:	c9                   	leave
+ 4ae:	c3                   	ret
+
+000004af <condbump>:
+{
+ 4af:	55                   	push   %ebp
+ 4b0:	89 e5                	mov    %esp,%ebp
+ 4b2:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 4b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b8:	8b 00                	mov    (%eax),%eax
+ 4ba:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4bd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4c0:	8d 50 01             	lea    0x1(%eax),%edx
+ 4c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c6:	52                   	push   %edx
+ 4c7:	ff 75 fc             	push   -0x4(%ebp)
+ 4ca:	50                   	push   %eax
+ 4cb:	e8 71 fc ff ff       	call   141 <cmpxchg>
+ 4d0:	83 c4 0c             	add    $0xc,%esp
+ 4d3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 4d6:	75 dd                	jne    4b5 <condbump+0x6>
+}
+ 4d8:	90                   	nop
+ 4d9:	90                   	nop
+ 4da:	c9                   	leave
+ 4db:	c3                   	ret
+
+000004dc <cond_signal>:
+{
+ 4dc:	55                   	push   %ebp
+ 4dd:	89 e5                	mov    %esp,%ebp
+ 4df:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 4e2:	ff 75 08             	push   0x8(%ebp)
+ 4e5:	e8 c5 ff ff ff       	call   4af <condbump>
+ 4ea:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 4ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f0:	83 ec 08             	sub    $0x8,%esp
+ 4f3:	6a 01                	push   $0x1
+ 4f5:	50                   	push   %eax
+ 4f6:	e8 28 03 00 00       	call   823 <futex_wake>
+ 4fb:	83 c4 10             	add    $0x10,%esp
+}
+ 4fe:	90                   	nop
+ 4ff:	c9                   	leave
+ 500:	c3                   	ret
+
+00000501 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 501:	55                   	push   %ebp
+ 502:	89 e5                	mov    %esp,%ebp
+ 504:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 507:	ff 75 08             	push   0x8(%ebp)
+ 50a:	e8 a0 ff ff ff       	call   4af <condbump>
+ 50f:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 512:	8b 45 08             	mov    0x8(%ebp),%eax
+ 515:	83 ec 08             	sub    $0x8,%esp
+ 518:	68 ff ff ff 7f       	push   $0x7fffffff
+ 51d:	50                   	push   %eax
+ 51e:	e8 00 03 00 00       	call   823 <futex_wake>
+ 523:	83 c4 10             	add    $0x10,%esp
+}
+ 526:	90                   	nop
+ 527:	c9                   	leave
+ 528:	c3                   	ret
+
+00000529 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 529:	55                   	push   %ebp
+ 52a:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 52c:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 531:	8b 00                	mov    (%eax),%eax
+}
+ 533:	5d                   	pop    %ebp
+ 534:	c3                   	ret
+
+00000535 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 535:	55                   	push   %ebp
+ 536:	89 e5                	mov    %esp,%ebp
+ 538:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 53b:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 540:	8b 00                	mov    (%eax),%eax
+ 542:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 545:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 549:	74 05                	je     550 <vgetpid+0x1b>
+    return pid;
+ 54b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 54e:	eb 05                	jmp    555 <vgetpid+0x20>
+  return getpid();
+ 550:	e8 74 02 00 00       	call   7c9 <getpid>
+}
+ 555:	c9                   	leave
+ 556:	c3                   	ret
+
+00000557 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 557:	55                   	push   %ebp
+ 558:	89 e5                	mov    %esp,%ebp
+ 55a:	57                   	push   %edi
+ 55b:	56                   	push   %esi
+ 55c:	53                   	push   %ebx
+ 55d:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 560:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 567:	e8 f7 fb ff ff       	call   163 <rdtsc>
+ 56c:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 56f:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 572:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 575:	29 c8                	sub    %ecx,%eax
+ 577:	19 da                	sbb    %ebx,%edx
+ 579:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 57c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 57f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 582:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 585:	89 d0                	mov    %edx,%eax
+ 587:	31 d2                	xor    %edx,%edx
+ 589:	89 c1                	mov    %eax,%ecx
+ 58b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 590:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 593:	8b 40 04             	mov    0x4(%eax),%eax
+ 596:	ba 00 00 00 00       	mov    $0x0,%edx
+ 59b:	89 df                	mov    %ebx,%edi
+ 59d:	0f af f8             	imul   %eax,%edi
+ 5a0:	89 d6                	mov    %edx,%esi
+ 5a2:	0f af f1             	imul   %ecx,%esi
+ 5a5:	01 f7                	add    %esi,%edi
+ 5a7:	f7 e1                	mul    %ecx
+ 5a9:	89 c1                	mov    %eax,%ecx
+ 5ab:	89 d3                	mov    %edx,%ebx
+ 5ad:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 5b0:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 5b2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5b5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5b8:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5bb:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 5c2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5c5:	8b 40 04             	mov    0x4(%eax),%eax
+ 5c8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5cb:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5d2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 5d5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 5d8:	89 d7                	mov    %edx,%edi
+ 5da:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 5dd:	0f af fe             	imul   %esi,%edi
+ 5e0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 5e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5e6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 5e9:	0f af f0             	imul   %eax,%esi
+ 5ec:	01 f7                	add    %esi,%edi
+ 5ee:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 5f1:	f7 65 d8             	mull   -0x28(%ebp)
+ 5f4:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 5f7:	89 f2                	mov    %esi,%edx
+ 5f9:	89 d0                	mov    %edx,%eax
+ 5fb:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 5fd:	01 c8                	add    %ecx,%eax
+ 5ff:	11 da                	adc    %ebx,%edx
+}
+ 601:	83 c4 24             	add    $0x24,%esp
+ 604:	5b                   	pop    %ebx
+ 605:	5e                   	pop    %esi
+ 606:	5f                   	pop    %edi
+ 607:	5d                   	pop    %ebp
+ 608:	c3                   	ret
+
+00000609 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 609:	55                   	push   %ebp
+ 60a:	89 e5                	mov    %esp,%ebp
+ 60c:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 60f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 612:	8b 50 04             	mov    0x4(%eax),%edx
+ 615:	8b 45 08             	mov    0x8(%ebp),%eax
+ 618:	8b 00                	mov    (%eax),%eax
+ 61a:	29 c2                	sub    %eax,%edx
+ 61c:	83 fa 1f             	cmp    $0x1f,%edx
+ 61f:	76 07                	jbe    628 <ring_queue+0x1f>
+    return -1;
+ 621:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 626:	eb 68                	jmp    690 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 628:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62b:	8b 40 04             	mov    0x4(%eax),%eax
+ 62e:	83 e0 1f             	and    $0x1f,%eax
+ 631:	89 c2                	mov    %eax,%edx
+ 633:	89 d0                	mov    %edx,%eax
+ 635:	c1 e0 02             	shl    $0x2,%eax
+ 638:	01 d0                	add    %edx,%eax
+ 63a:	c1 e0 02             	shl    $0x2,%eax
+ 63d:	8d 50 10             	lea    0x10(%eax),%edx
+ 640:	8b 45 08             	mov    0x8(%ebp),%eax
+ 643:	01 d0                	add    %edx,%eax
+ 645:	83 c0 04             	add    $0x4,%eax
+ 648:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 64b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 64e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 651:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 653:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 656:	8b 55 10             	mov    0x10(%ebp),%edx
+ 659:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 65c:	8b 55 14             	mov    0x14(%ebp),%edx
+ 65f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 662:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 665:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 668:	8b 55 18             	mov    0x18(%ebp),%edx
+ 66b:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 66e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 671:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 674:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 677:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 67c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67f:	8b 40 04             	mov    0x4(%eax),%eax
+ 682:	8d 50 01             	lea    0x1(%eax),%edx
+ 685:	8b 45 08             	mov    0x8(%ebp),%eax
+ 688:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 68b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 690:	c9                   	leave
+ 691:	c3                   	ret
+
+00000692 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 692:	55                   	push   %ebp
+ 693:	89 e5                	mov    %esp,%ebp
+ 695:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 698:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 69d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6a1:	7f 1a                	jg     6bd <ring_submit+0x2b>
+ 6a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a6:	8b 40 10             	mov    0x10(%eax),%eax
+ 6a9:	83 e0 01             	and    $0x1,%eax
+ 6ac:	85 c0                	test   %eax,%eax
+ 6ae:	74 0d                	je     6bd <ring_submit+0x2b>
+ 6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b3:	8b 40 10             	mov    0x10(%eax),%eax
+ 6b6:	83 e0 02             	and    $0x2,%eax
+ 6b9:	85 c0                	test   %eax,%eax
+ 6bb:	74 10                	je     6cd <ring_submit+0x3b>
+    return ring_enter(min);
+ 6bd:	83 ec 0c             	sub    $0xc,%esp
+ 6c0:	ff 75 0c             	push   0xc(%ebp)
+ 6c3:	e8 83 01 00 00       	call   84b <ring_enter>
+ 6c8:	83 c4 10             	add    $0x10,%esp
+ 6cb:	eb 10                	jmp    6dd <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 6cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d6:	8b 40 08             	mov    0x8(%eax),%eax
+ 6d9:	29 c2                	sub    %eax,%edx
+ 6db:	89 d0                	mov    %edx,%eax
+}
+ 6dd:	c9                   	leave
+ 6de:	c3                   	ret
+
+000006df <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 6df:	55                   	push   %ebp
+ 6e0:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 6e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e5:	8b 50 08             	mov    0x8(%eax),%edx
+ 6e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6eb:	8b 40 0c             	mov    0xc(%eax),%eax
+ 6ee:	39 c2                	cmp    %eax,%edx
+ 6f0:	75 07                	jne    6f9 <ring_reap+0x1a>
+    return -1;
+ 6f2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6f7:	eb 3b                	jmp    734 <ring_reap+0x55>
+  __sync_synchronize();
+ 6f9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 6fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 701:	8b 40 08             	mov    0x8(%eax),%eax
+ 704:	83 e0 1f             	and    $0x1f,%eax
+ 707:	89 c2                	mov    %eax,%edx
+ 709:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 70c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70f:	83 c2 52             	add    $0x52,%edx
+ 712:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 716:	8b 02                	mov    (%edx),%eax
+ 718:	8b 52 04             	mov    0x4(%edx),%edx
+ 71b:	89 01                	mov    %eax,(%ecx)
+ 71d:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 720:	8b 45 08             	mov    0x8(%ebp),%eax
+ 723:	8b 40 08             	mov    0x8(%eax),%eax
+ 726:	8d 50 01             	lea    0x1(%eax),%edx
+ 729:	8b 45 08             	mov    0x8(%ebp),%eax
+ 72c:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 72f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 734:	5d                   	pop    %ebp
+ 735:	c3                   	ret
+
+00000736 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 736:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 73d:	74 0a                	je     749 <usyscall+0x13>
+  movl %esp, %ecx
+ 73f:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 741:	ba 48 07 00 00       	mov    $0x748,%edx
+  sysenter
+ 746:	0f 34                	sysenter
+2:
+  ret
+ 748:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 749:	cd 40                	int    $0x40
+  ret
+ 74b:	c3                   	ret
+
+0000074c <fork>:
+
+SYSCALL(fork)
+ 74c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 751:	eb e3                	jmp    736 <usyscall>
+
+00000753 <exit>:
+SYSCALL(exit)
+ 753:	b8 02 00 00 00       	mov    $0x2,%eax
+ 758:	eb dc                	jmp    736 <usyscall>
+
+0000075a <wait>:
+SYSCALL(wait)
+ 75a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 75f:	eb d5                	jmp    736 <usyscall>
+
+00000761 <pipe>:
+SYSCALL(pipe)
+ 761:	b8 04 00 00 00       	mov    $0x4,%eax
+ 766:	eb ce                	jmp    736 <usyscall>
+
+00000768 <read>:
+SYSCALL(read)
+ 768:	b8 05 00 00 00       	mov    $0x5,%eax
+ 76d:	eb c7                	jmp    736 <usyscall>
+
+0000076f <write>:
+SYSCALL(write)
+ 76f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 774:	eb c0                	jmp    736 <usyscall>
+
+00000776 <close>:
+SYSCALL(close)
+ 776:	b8 15 00 00 00       	mov    $0x15,%eax
+ 77b:	eb b9                	jmp    736 <usyscall>
+
+0000077d <kill>:
+SYSCALL(kill)
+ 77d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 782:	eb b2                	jmp    736 <usyscall>
+
+00000784 <exec>:
+SYSCALL(exec)
+ 784:	b8 07 00 00 00       	mov    $0x7,%eax
+ 789:	eb ab                	jmp    736 <usyscall>
+
+0000078b <open>:
+SYSCALL(open)
+ 78b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 790:	eb a4                	jmp    736 <usyscall>
+
+00000792 <mknod>:
+SYSCALL(mknod)
+ 792:	b8 11 00 00 00       	mov    $0x11,%eax
+ 797:	eb 9d                	jmp    736 <usyscall>
+
+00000799 <unlink>:
+SYSCALL(unlink)
+ 799:	b8 12 00 00 00       	mov    $0x12,%eax
+ 79e:	eb 96                	jmp    736 <usyscall>
+
+000007a0 <fstat>:
+SYSCALL(fstat)
+ 7a0:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7a5:	eb 8f                	jmp    736 <usyscall>
+
+000007a7 <link>:
+SYSCALL(link)
+ 7a7:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7ac:	eb 88                	jmp    736 <usyscall>
+
+000007ae <mkdir>:
+SYSCALL(mkdir)
+ 7ae:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7b3:	eb 81                	jmp    736 <usyscall>
+
+000007b5 <chdir>:
+SYSCALL(chdir)
+ 7b5:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7ba:	e9 77 ff ff ff       	jmp    736 <usyscall>
+
+000007bf <dup>:
+SYSCALL(dup)
+ 7bf:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7c4:	e9 6d ff ff ff       	jmp    736 <usyscall>
+
+000007c9 <getpid>:
+SYSCALL(getpid)
+ 7c9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7ce:	e9 63 ff ff ff       	jmp    736 <usyscall>
+
+000007d3 <sbrk>:
+SYSCALL(sbrk)
+ 7d3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7d8:	e9 59 ff ff ff       	jmp    736 <usyscall>
+
+000007dd <sleep>:
+SYSCALL(sleep)
+ 7dd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 7e2:	e9 4f ff ff ff       	jmp    736 <usyscall>
+
+000007e7 <uptime>:
+SYSCALL(uptime)
+ 7e7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 7ec:	e9 45 ff ff ff       	jmp    736 <usyscall>
+
+000007f1 <kmstat>:
+SYSCALL(kmstat)
+ 7f1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 7f6:	e9 3b ff ff ff       	jmp    736 <usyscall>
+
+000007fb <setpriority>:
+SYSCALL(setpriority)
+ 7fb:	b8 17 00 00 00       	mov    $0x17,%eax
+ 800:	e9 31 ff ff ff       	jmp    736 <usyscall>
+
+00000805 <clone>:
+SYSCALL(clone)
+ 805:	b8 18 00 00 00       	mov    $0x18,%eax
+ 80a:	e9 27 ff ff ff       	jmp    736 <usyscall>
+
+0000080f <join>:
+SYSCALL(join)
+ 80f:	b8 19 00 00 00       	mov    $0x19,%eax
+ 814:	e9 1d ff ff ff       	jmp    736 <usyscall>
+
+00000819 <futex_wait>:
+SYSCALL(futex_wait)
+ 819:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 81e:	e9 13 ff ff ff       	jmp    736 <usyscall>
+
+00000823 <futex_wake>:
+SYSCALL(futex_wake)
+ 823:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 828:	e9 09 ff ff ff       	jmp    736 <usyscall>
+
+0000082d <lockstat>:
+SYSCALL(lockstat)
+ 82d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 832:	e9 ff fe ff ff       	jmp    736 <usyscall>
+
+00000837 <sysstat>:
+SYSCALL(sysstat)
+ 837:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 83c:	e9 f5 fe ff ff       	jmp    736 <usyscall>
+
+00000841 <ring_setup>:
+SYSCALL(ring_setup)
+ 841:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 846:	e9 eb fe ff ff       	jmp    736 <usyscall>
+
+0000084b <ring_enter>:
+SYSCALL(ring_enter)
+ 84b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 850:	e9 e1 fe ff ff       	jmp    736 <usyscall>
+
+00000855 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 855:	55                   	push   %ebp
+ 856:	89 e5                	mov    %esp,%ebp
+ 858:	83 ec 18             	sub    $0x18,%esp
+ 85b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 85e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 861:	83 ec 04             	sub    $0x4,%esp
+ 864:	6a 01                	push   $0x1
+ 866:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 869:	50                   	push   %eax
+ 86a:	ff 75 08             	push   0x8(%ebp)
+ 86d:	e8 fd fe ff ff       	call   76f <write>
+ 872:	83 c4 10             	add    $0x10,%esp
+}
+ 875:	90                   	nop
+ 876:	c9                   	leave
+ 877:	c3                   	ret
+
+00000878 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 878:	55                   	push   %ebp
+ 879:	89 e5                	mov    %esp,%ebp
+ 87b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 87e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 885:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 889:	74 17                	je     8a2 <printint+0x2a>
+ 88b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 88f:	79 11                	jns    8a2 <printint+0x2a>
+    neg = 1;
+ 891:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 898:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 89b:	f7 d8                	neg    %eax
+ 89d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8a0:	eb 06                	jmp    8a8 <printint+0x30>
+  } else {
+    x = xx;
+ 8a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8af:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8b2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8b5:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8ba:	f7 f1                	div    %ecx
+ 8bc:	89 d1                	mov    %edx,%ecx
+ 8be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8c1:	8d 50 01             	lea    0x1(%eax),%edx
+ 8c4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8c7:	0f b6 91 7c 12 00 00 	movzbl 0x127c(%ecx),%edx
+ 8ce:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8d2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8d5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8d8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8dd:	f7 f1                	div    %ecx
+ 8df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8e6:	75 c7                	jne    8af <printint+0x37>
+  if(neg)
+ 8e8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 8ec:	74 2d                	je     91b <printint+0xa3>
+    buf[i++] = '-';
+ 8ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f1:	8d 50 01             	lea    0x1(%eax),%edx
+ 8f4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8f7:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 8fc:	eb 1d                	jmp    91b <printint+0xa3>
+    putc(fd, buf[i]);
+ 8fe:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 901:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 904:	01 d0                	add    %edx,%eax
+ 906:	0f b6 00             	movzbl (%eax),%eax
+ 909:	0f be c0             	movsbl %al,%eax
+ 90c:	83 ec 08             	sub    $0x8,%esp
+ 90f:	50                   	push   %eax
+ 910:	ff 75 08             	push   0x8(%ebp)
+ 913:	e8 3d ff ff ff       	call   855 <putc>
+ 918:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 91b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 91f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 923:	79 d9                	jns    8fe <printint+0x86>
+}
+ 925:	90                   	nop
+ 926:	90                   	nop
+ 927:	c9                   	leave
+ 928:	c3                   	ret
+
+00000929 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 929:	55                   	push   %ebp
+ 92a:	89 e5                	mov    %esp,%ebp
+ 92c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 92f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 936:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 939:	83 c0 04             	add    $0x4,%eax
+ 93c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 93f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 946:	e9 59 01 00 00       	jmp    aa4 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 94b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 94e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 951:	01 d0                	add    %edx,%eax
+ 953:	0f b6 00             	movzbl (%eax),%eax
+ 956:	0f be c0             	movsbl %al,%eax
+ 959:	25 ff 00 00 00       	and    $0xff,%eax
+ 95e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 961:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 965:	75 2c                	jne    993 <printf+0x6a>
+      if(c == '%'){
+ 967:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 96b:	75 0c                	jne    979 <printf+0x50>
+        state = '%';
+ 96d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 974:	e9 27 01 00 00       	jmp    aa0 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 979:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 97c:	0f be c0             	movsbl %al,%eax
+ 97f:	83 ec 08             	sub    $0x8,%esp
+ 982:	50                   	push   %eax
+ 983:	ff 75 08             	push   0x8(%ebp)
+ 986:	e8 ca fe ff ff       	call   855 <putc>
+ 98b:	83 c4 10             	add    $0x10,%esp
+ 98e:	e9 0d 01 00 00       	jmp    aa0 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 993:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 997:	0f 85 03 01 00 00    	jne    aa0 <printf+0x177>
+      if(c == 'd'){
+ 99d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9a1:	75 1e                	jne    9c1 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9a3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9a6:	8b 00                	mov    (%eax),%eax
+ 9a8:	6a 01                	push   $0x1
+ 9aa:	6a 0a                	push   $0xa
+ 9ac:	50                   	push   %eax
+ 9ad:	ff 75 08             	push   0x8(%ebp)
+ 9b0:	e8 c3 fe ff ff       	call   878 <printint>
+ 9b5:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9b8:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9bc:	e9 d8 00 00 00       	jmp    a99 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 9c1:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9c5:	74 06                	je     9cd <printf+0xa4>
+ 9c7:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9cb:	75 1e                	jne    9eb <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 9cd:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9d0:	8b 00                	mov    (%eax),%eax
+ 9d2:	6a 00                	push   $0x0
+ 9d4:	6a 10                	push   $0x10
+ 9d6:	50                   	push   %eax
+ 9d7:	ff 75 08             	push   0x8(%ebp)
+ 9da:	e8 99 fe ff ff       	call   878 <printint>
+ 9df:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9e2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9e6:	e9 ae 00 00 00       	jmp    a99 <printf+0x170>
+      } else if(c == 's'){
+ 9eb:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 9ef:	75 43                	jne    a34 <printf+0x10b>
+        s = (char*)*ap;
+ 9f1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9f4:	8b 00                	mov    (%eax),%eax
+ 9f6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 9f9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 9fd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a01:	75 25                	jne    a28 <printf+0xff>
+          s = "(null)";
+ a03:	c7 45 f4 b8 0d 00 00 	movl   $0xdb8,-0xc(%ebp)
+        while(*s != 0){
+ a0a:	eb 1c                	jmp    a28 <printf+0xff>
+          putc(fd, *s);
+ a0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a0f:	0f b6 00             	movzbl (%eax),%eax
+ a12:	0f be c0             	movsbl %al,%eax
+ a15:	83 ec 08             	sub    $0x8,%esp
+ a18:	50                   	push   %eax
+ a19:	ff 75 08             	push   0x8(%ebp)
+ a1c:	e8 34 fe ff ff       	call   855 <putc>
+ a21:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a24:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a28:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a2b:	0f b6 00             	movzbl (%eax),%eax
+ a2e:	84 c0                	test   %al,%al
+ a30:	75 da                	jne    a0c <printf+0xe3>
+ a32:	eb 65                	jmp    a99 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a34:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a38:	75 1d                	jne    a57 <printf+0x12e>
+        putc(fd, *ap);
+ a3a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a3d:	8b 00                	mov    (%eax),%eax
+ a3f:	0f be c0             	movsbl %al,%eax
+ a42:	83 ec 08             	sub    $0x8,%esp
+ a45:	50                   	push   %eax
+ a46:	ff 75 08             	push   0x8(%ebp)
+ a49:	e8 07 fe ff ff       	call   855 <putc>
+ a4e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a51:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a55:	eb 42                	jmp    a99 <printf+0x170>
+      } else if(c == '%'){
+ a57:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a5b:	75 17                	jne    a74 <printf+0x14b>
+        putc(fd, c);
+ a5d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a60:	0f be c0             	movsbl %al,%eax
+ a63:	83 ec 08             	sub    $0x8,%esp
+ a66:	50                   	push   %eax
+ a67:	ff 75 08             	push   0x8(%ebp)
+ a6a:	e8 e6 fd ff ff       	call   855 <putc>
+ a6f:	83 c4 10             	add    $0x10,%esp
+ a72:	eb 25                	jmp    a99 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a74:	83 ec 08             	sub    $0x8,%esp
+ a77:	6a 25                	push   $0x25
+ a79:	ff 75 08             	push   0x8(%ebp)
+ a7c:	e8 d4 fd ff ff       	call   855 <putc>
+ a81:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a84:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a87:	0f be c0             	movsbl %al,%eax
+ a8a:	83 ec 08             	sub    $0x8,%esp
+ a8d:	50                   	push   %eax
+ a8e:	ff 75 08             	push   0x8(%ebp)
+ a91:	e8 bf fd ff ff       	call   855 <putc>
+ a96:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a99:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ aa0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ aa4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ aa7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ aaa:	01 d0                	add    %edx,%eax
+ aac:	0f b6 00             	movzbl (%eax),%eax
+ aaf:	84 c0                	test   %al,%al
+ ab1:	0f 85 94 fe ff ff    	jne    94b <printf+0x22>
+    }
+  }
+}
+ ab7:	90                   	nop
+ ab8:	90                   	nop
+ ab9:	c9                   	leave
+ aba:	c3                   	ret
+
+00000abb <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ abb:	55                   	push   %ebp
+ abc:	89 e5                	mov    %esp,%ebp
+ abe:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ ac1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ac4:	83 e8 08             	sub    $0x8,%eax
+ ac7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aca:	a1 98 12 00 00       	mov    0x1298,%eax
+ acf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ ad2:	eb 24                	jmp    af8 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ ad4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad7:	8b 00                	mov    (%eax),%eax
+ ad9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ adc:	72 12                	jb     af0 <free+0x35>
+ ade:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ae4:	72 24                	jb     b0a <free+0x4f>
+ ae6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae9:	8b 00                	mov    (%eax),%eax
+ aeb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ aee:	72 1a                	jb     b0a <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ af0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af3:	8b 00                	mov    (%eax),%eax
+ af5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ af8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ afb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ afe:	73 d4                	jae    ad4 <free+0x19>
+ b00:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b03:	8b 00                	mov    (%eax),%eax
+ b05:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b08:	73 ca                	jae    ad4 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b0a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b0d:	8b 40 04             	mov    0x4(%eax),%eax
+ b10:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b17:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b1a:	01 c2                	add    %eax,%edx
+ b1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1f:	8b 00                	mov    (%eax),%eax
+ b21:	39 c2                	cmp    %eax,%edx
+ b23:	75 24                	jne    b49 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b25:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b28:	8b 50 04             	mov    0x4(%eax),%edx
+ b2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b2e:	8b 00                	mov    (%eax),%eax
+ b30:	8b 40 04             	mov    0x4(%eax),%eax
+ b33:	01 c2                	add    %eax,%edx
+ b35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b38:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3e:	8b 00                	mov    (%eax),%eax
+ b40:	8b 10                	mov    (%eax),%edx
+ b42:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b45:	89 10                	mov    %edx,(%eax)
+ b47:	eb 0a                	jmp    b53 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b4c:	8b 10                	mov    (%eax),%edx
+ b4e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b51:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b53:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b56:	8b 40 04             	mov    0x4(%eax),%eax
+ b59:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b63:	01 d0                	add    %edx,%eax
+ b65:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b68:	75 20                	jne    b8a <free+0xcf>
+    p->s.size += bp->s.size;
+ b6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b6d:	8b 50 04             	mov    0x4(%eax),%edx
+ b70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b73:	8b 40 04             	mov    0x4(%eax),%eax
+ b76:	01 c2                	add    %eax,%edx
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b7e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b81:	8b 10                	mov    (%eax),%edx
+ b83:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b86:	89 10                	mov    %edx,(%eax)
+ b88:	eb 08                	jmp    b92 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b8a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b90:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b95:	a3 98 12 00 00       	mov    %eax,0x1298
+}
+ b9a:	90                   	nop
+ b9b:	c9                   	leave
+ b9c:	c3                   	ret
+
+00000b9d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b9d:	55                   	push   %ebp
+ b9e:	89 e5                	mov    %esp,%ebp
+ ba0:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ba3:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ baa:	77 07                	ja     bb3 <morecore+0x16>
+    nu = 4096;
+ bac:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+ bb6:	c1 e0 03             	shl    $0x3,%eax
+ bb9:	83 ec 0c             	sub    $0xc,%esp
+ bbc:	50                   	push   %eax
+ bbd:	e8 11 fc ff ff       	call   7d3 <sbrk>
+ bc2:	83 c4 10             	add    $0x10,%esp
+ bc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ bc8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bcc:	75 07                	jne    bd5 <morecore+0x38>
+    return 0;
+ bce:	b8 00 00 00 00       	mov    $0x0,%eax
+ bd3:	eb 26                	jmp    bfb <morecore+0x5e>
+  hp = (Header*)p;
+ bd5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ bdb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bde:	8b 55 08             	mov    0x8(%ebp),%edx
+ be1:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ be4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ be7:	83 c0 08             	add    $0x8,%eax
+ bea:	83 ec 0c             	sub    $0xc,%esp
+ bed:	50                   	push   %eax
+ bee:	e8 c8 fe ff ff       	call   abb <free>
+ bf3:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ bf6:	a1 98 12 00 00       	mov    0x1298,%eax
+}
+ bfb:	c9                   	leave
+ bfc:	c3                   	ret
+
+00000bfd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ bfd:	55                   	push   %ebp
+ bfe:	89 e5                	mov    %esp,%ebp
+ c00:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c03:	8b 45 08             	mov    0x8(%ebp),%eax
+ c06:	83 c0 07             	add    $0x7,%eax
+ c09:	c1 e8 03             	shr    $0x3,%eax
+ c0c:	83 c0 01             	add    $0x1,%eax
+ c0f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c12:	a1 98 12 00 00       	mov    0x1298,%eax
+ c17:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c1a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c1e:	75 23                	jne    c43 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c20:	c7 45 f0 90 12 00 00 	movl   $0x1290,-0x10(%ebp)
+ c27:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c2a:	a3 98 12 00 00       	mov    %eax,0x1298
+ c2f:	a1 98 12 00 00       	mov    0x1298,%eax
+ c34:	a3 90 12 00 00       	mov    %eax,0x1290
+    base.s.size = 0;
+ c39:	c7 05 94 12 00 00 00 	movl   $0x0,0x1294
+ c40:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c43:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c46:	8b 00                	mov    (%eax),%eax
+ c48:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c4b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c4e:	8b 40 04             	mov    0x4(%eax),%eax
+ c51:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c54:	72 4d                	jb     ca3 <malloc+0xa6>
+      if(p->s.size == nunits)
+ c56:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c59:	8b 40 04             	mov    0x4(%eax),%eax
+ c5c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c5f:	75 0c                	jne    c6d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c61:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c64:	8b 10                	mov    (%eax),%edx
+ c66:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c69:	89 10                	mov    %edx,(%eax)
+ c6b:	eb 26                	jmp    c93 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c6d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c70:	8b 40 04             	mov    0x4(%eax),%eax
+ c73:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c76:	89 c2                	mov    %eax,%edx
+ c78:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c7e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c81:	8b 40 04             	mov    0x4(%eax),%eax
+ c84:	c1 e0 03             	shl    $0x3,%eax
+ c87:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c90:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c93:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c96:	a3 98 12 00 00       	mov    %eax,0x1298
+      return (void*)(p + 1);
+ c9b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9e:	83 c0 08             	add    $0x8,%eax
+ ca1:	eb 3b                	jmp    cde <malloc+0xe1>
+    }
+    if(p == freep)
+ ca3:	a1 98 12 00 00       	mov    0x1298,%eax
+ ca8:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cab:	75 1e                	jne    ccb <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ cad:	83 ec 0c             	sub    $0xc,%esp
+ cb0:	ff 75 ec             	push   -0x14(%ebp)
+ cb3:	e8 e5 fe ff ff       	call   b9d <morecore>
+ cb8:	83 c4 10             	add    $0x10,%esp
+ cbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cbe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc2:	75 07                	jne    ccb <malloc+0xce>
+        return 0;
+ cc4:	b8 00 00 00 00       	mov    $0x0,%eax
+ cc9:	eb 13                	jmp    cde <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ccb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cd1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd4:	8b 00                	mov    (%eax),%eax
+ cd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cd9:	e9 6d ff ff ff       	jmp    c4b <malloc+0x4e>
+  }
+}
+ cde:	c9                   	leave
+ cdf:	c3                   	ret
+
+00000ce0 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ ce0:	55                   	push   %ebp
+ ce1:	89 e5                	mov    %esp,%ebp
+ ce3:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ ce6:	83 ec 0c             	sub    $0xc,%esp
+ ce9:	68 00 10 00 00       	push   $0x1000
+ cee:	e8 0a ff ff ff       	call   bfd <malloc>
+ cf3:	83 c4 10             	add    $0x10,%esp
+ cf6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cf9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cfd:	75 07                	jne    d06 <thread_create+0x26>
+    return -1;
+ cff:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d04:	eb 2e                	jmp    d34 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d06:	83 ec 04             	sub    $0x4,%esp
+ d09:	ff 75 f4             	push   -0xc(%ebp)
+ d0c:	ff 75 0c             	push   0xc(%ebp)
+ d0f:	ff 75 08             	push   0x8(%ebp)
+ d12:	e8 ee fa ff ff       	call   805 <clone>
+ d17:	83 c4 10             	add    $0x10,%esp
+ d1a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d1d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d21:	79 0e                	jns    d31 <thread_create+0x51>
+    free(stack);
+ d23:	83 ec 0c             	sub    $0xc,%esp
+ d26:	ff 75 f4             	push   -0xc(%ebp)
+ d29:	e8 8d fd ff ff       	call   abb <free>
+ d2e:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d31:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ d34:	c9                   	leave
+ d35:	c3                   	ret
+
+00000d36 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ d36:	55                   	push   %ebp
+ d37:	89 e5                	mov    %esp,%ebp
+ d39:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d3c:	83 ec 0c             	sub    $0xc,%esp
+ d3f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ d42:	50                   	push   %eax
+ d43:	e8 c7 fa ff ff       	call   80f <join>
+ d48:	83 c4 10             	add    $0x10,%esp
+ d4b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d52:	78 0f                	js     d63 <thread_join+0x2d>
+    free(stack);
+ d54:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d57:	83 ec 0c             	sub    $0xc,%esp
+ d5a:	50                   	push   %eax
+ d5b:	e8 5b fd ff ff       	call   abb <free>
+ d60:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d66:	c9                   	leave
+ d67:	c3                   	ret
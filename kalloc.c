@@ -1,6 +1,8 @@
 // Physical memory allocator, intended to allocate
 // memory for user processes, kernel stacks, page table pages,
-// and pipe buffers. Allocates 4096-byte pages.
+// and pipe buffers.  A binary buddy allocator hands out
+// physically contiguous blocks of 2^order 4096-byte pages;
+// kalloc() is its order-0 fast path.
 
 #include "types.h"
 #include "defs.h"
@@ -8,18 +10,47 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "spinlock.h"
+#include "proc.h"
+
+// Largest block: one superpage.
+#define KMAXORDER SUPERPGORDER
 
 void freerange(void *vstart, void *vend);
-extern char end[]; // first address after kernel loaded from ELF file
+static void freeram(void *vstart, void *vend);
 
 struct run {
   struct run *next;
+  struct run *prev;   // only used on the buddy free lists
 };
 
+// Each CPU keeps a small cache of free pages so that the common
+// kalloc() and kfree() touch neither kmem.lock nor the global lists.
+// A cache refills from, and drains to, the buddy allocator KBATCH
+// pages at a time.  Padded to a cache line so CPUs never share one.
+#define KBATCH 32
+
+struct kcache {
+  struct run *freelist;
+  int nfree;
+} __attribute__((aligned(64)));
+
+// Page state, one byte per physical page below phystop, kept just
+// past the kernel's end.  The first page of each block on a buddy
+// free list has PG_FREE set and its order in the low bits; every
+// other page has 0.
+#define PG_FREE   0x80
+#define PG_ORDER  0x7f
+
+// The fields that every kalloc() and kfree() reads come first, in
+// a cache line of their own that nothing writes after boot; the
+// lock, which acquire() writes, and the lists start a new line.
 struct {
-  struct spinlock lock;
   int use_lock;
-  struct run *freelist;
+  uchar *pg;
+  char *start;                    // first page after the kernel and pg
+  struct spinlock lock __attribute__((aligned(64)));
+  struct run free[KMAXORDER+1];   // circular list heads, one per order
+  struct kcache cache[NCPU];
 } kmem;
 
 // Initialization happens in two phases.
@@ -27,21 +58,52 @@ struct {
 // the pages mapped by entrypgdir on free list.
 // 2. main() calls kinit2() with the rest of the physical pages
 // after installing a full page table that maps them on all cores.
+// Both free only the pages that the memory map says are RAM.
 void
 kinit1(void *vstart, void *vend)
 {
-  initlock(&kmem.lock, "kmem");
+  int i;
+
+  initmcslock(&kmem.lock, "kmem");
   kmem.use_lock = 0;
-  freerange(vstart, vend);
+  for(i = 0; i <= KMAXORDER; i++)
+    kmem.free[i].next = kmem.free[i].prev = &kmem.free[i];
+  kmem.pg = (uchar*)vstart;
+  memset(kmem.pg, 0, phystop/PGSIZE);
+  kmem.start = (char*)PGROUNDUP((uint)kmem.pg + phystop/PGSIZE);
+  freeram(kmem.start, vend);
 }
 
+// Freed pages coalesce with their buddies, so every whole, aligned
+// 4MB chunk ends up as one order-KMAXORDER block that can back
+// a superpage.
 void
 kinit2(void *vstart, void *vend)
 {
-  freerange(vstart, vend);
+  freeram(vstart, vend);
+  // startothers() is done with the low memory it borrowed,
+  // so the RAM below the kernel can be handed out too.
+  freeram(P2V(PGSIZE), P2V(EXTMEM));
   kmem.use_lock = 1;
 }
 
+// Free the pages in vstart..vend that are usable RAM.
+static void
+freeram(void *vstart, void *vend)
+{
+  uint s, e;
+  int i;
+
+  for(i = 0; memrange(i, &s, &e); i++){
+    if(s < v2p(vstart))
+      s = v2p(vstart);
+    if(e > v2p(vend))
+      e = v2p(vend);
+    if(s < e)
+      freerange(p2v(s), p2v(e));
+  }
+}
+
 void
 freerange(void *vstart, void *vend)
 {
@@ -51,7 +113,111 @@ freerange(void *vstart, void *vend)
     kfree(p);
 }
 
+// May the allocator hand out the n bytes at v?  Everything
+// from page 1 to phystop except the kernel and kmem.pg.
+static int
+kvalid(char *v, uint n)
+{
+  return v2p(v) >= PGSIZE && v2p(v) + n <= phystop &&
+    (v + n <= (char*)KERNLINK || v >= kmem.start);
+}
+
+static void
+listpush(struct run *h, struct run *r)
+{
+  r->next = h->next;
+  r->prev = h;
+  h->next->prev = r;
+  h->next = r;
+}
+
+static void
+listremove(struct run *r)
+{
+  r->prev->next = r->next;
+  r->next->prev = r->prev;
+}
+
 //PAGEBREAK: 21
+// Return the block of 2^order pages at v to the free lists,
+// merging it with its buddy for as long as the buddy is free too.
+// Caller must hold kmem.lock if kmem.use_lock.
+static void
+buddyfree(char *v, int order)
+{
+  uint pa, bpa;
+
+  pa = v2p(v);
+  if(kmem.pg[pa/PGSIZE] & PG_FREE)
+    panic("buddyfree: double free");
+  for(; order < KMAXORDER; order++){
+    bpa = pa ^ (PGSIZE << order);
+    if(bpa >= phystop || kmem.pg[bpa/PGSIZE] != (PG_FREE | order))
+      break;
+    listremove((struct run*)p2v(bpa));
+    kmem.pg[bpa/PGSIZE] = 0;
+    if(bpa < pa)
+      pa = bpa;
+  }
+  kmem.pg[pa/PGSIZE] = PG_FREE | order;
+  listpush(&kmem.free[order], (struct run*)p2v(pa));
+}
+
+// Take a block of 2^order pages off the free lists, splitting a
+// larger block if needed.  Returns 0 if there is none.
+// Caller must hold kmem.lock if kmem.use_lock.
+static char*
+buddyalloc(int order)
+{
+  struct run *r, *b;
+  int k;
+
+  for(k = order; k <= KMAXORDER; k++)
+    if(kmem.free[k].next != &kmem.free[k])
+      break;
+  if(k > KMAXORDER)
+    return 0;
+  r = kmem.free[k].next;
+  listremove(r);
+  kmem.pg[v2p(r)/PGSIZE] = 0;
+  while(k > order){
+    // Give back the upper half.
+    k--;
+    b = (struct run*)((char*)r + (PGSIZE << k));
+    kmem.pg[v2p(b)/PGSIZE] = PG_FREE | k;
+    listpush(&kmem.free[k], b);
+  }
+  return (char*)r;
+}
+
+// Move up to n pages from the buddy allocator to cache c.
+// Caller must hold kmem.lock if kmem.use_lock.
+static void
+krefill(struct kcache *c, int n)
+{
+  struct run *r;
+
+  for(; n > 0 && (r = (struct run*)buddyalloc(0)) != 0; n--){
+    r->next = c->freelist;
+    c->freelist = r;
+    c->nfree++;
+  }
+}
+
+// Move n pages from cache c back to the buddy allocator.
+// Caller must hold kmem.lock.
+static void
+kdrain(struct kcache *c, int n)
+{
+  struct run *r;
+
+  for(; n > 0 && (r = c->freelist) != 0; n--){
+    c->freelist = r->next;
+    c->nfree--;
+    buddyfree((char*)r, 0);
+  }
+}
+
 // Free the page of physical memory pointed at by v,
 // which normally should have been returned by a
 // call to kalloc().  (The exception is when
@@ -59,21 +225,32 @@ freerange(void *vstart, void *vend)
 void
 kfree(char *v)
 {
+  struct kcache *c;
   struct run *r;
 
-  if((uint)v % PGSIZE || v < end || v2p(v) >= PHYSTOP)
+  if((uint)v % PGSIZE || !kvalid(v, PGSIZE))
     panic("kfree");
 
   // Fill with junk to catch dangling refs.
   memset(v, 1, PGSIZE);
 
-  if(kmem.use_lock)
-    acquire(&kmem.lock);
+  if(!kmem.use_lock){
+    // Early boot: %gs is not set up yet, so no per-CPU cache.
+    buddyfree(v, 0);
+    return;
+  }
+
   r = (struct run*)v;
-  r->next = kmem.freelist;
-  kmem.freelist = r;
-  if(kmem.use_lock)
+  pushcli();
+  c = &kmem.cache[cpu->id];
+  r->next = c->freelist;
+  c->freelist = r;
+  if(++c->nfree >= 2*KBATCH){
+    acquire(&kmem.lock);
+    kdrain(c, KBATCH);
     release(&kmem.lock);
+  }
+  popcli();
 }
 
 // Allocate one 4096-byte page of physical memory.
@@ -82,15 +259,76 @@ kfree(char *v)
 char*
 kalloc(void)
 {
+  struct kcache *c;
   struct run *r;
 
+  if(!kmem.use_lock)
+    return buddyalloc(0);
+
+  pushcli();
+  c = &kmem.cache[cpu->id];
+  if(c->freelist == 0){
+    acquire(&kmem.lock);
+    krefill(c, KBATCH);
+    release(&kmem.lock);
+  }
+  r = c->freelist;
+  if(r){
+    c->freelist = r->next;
+    c->nfree--;
+  }
+  popcli();
+  return (char*)r;
+}
+
+// Free the 2^order physically contiguous pages at v,
+// which must have been returned by kallocpages(order).
+void
+kfreepages(char *v, int order)
+{
+  if(order < 0 || order > KMAXORDER || (uint)v % (PGSIZE << order) ||
+     !kvalid(v, PGSIZE << order))
+    panic("kfreepages");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, PGSIZE << order);
+
   if(kmem.use_lock)
     acquire(&kmem.lock);
-  r = kmem.freelist;
-  if(r)
-    kmem.freelist = r->next;
+  buddyfree(v, order);
   if(kmem.use_lock)
     release(&kmem.lock);
-  return (char*)r;
 }
 
+// Allocate 2^order physically contiguous pages, aligned
+// to their size.  Returns 0 if the memory cannot be allocated.
+char*
+kallocpages(int order)
+{
+  char *v;
+
+  if(order < 0 || order > KMAXORDER)
+    return 0;
+  if(kmem.use_lock)
+    acquire(&kmem.lock);
+  v = buddyalloc(order);
+  if(kmem.use_lock)
+    release(&kmem.lock);
+  return v;
+}
+
+// Free the 4MB superpage of physical memory pointed at by v,
+// which must have been returned by ksuperalloc().
+void
+ksuperfree(char *v)
+{
+  kfreepages(v, KMAXORDER);
+}
+
+// Allocate one 4MB, 4MB-aligned superpage of physical memory.
+// Returns 0 if none is free; callers fall back to 4096-byte pages.
+char*
+ksuperalloc(void)
+{
+  return kallocpages(KMAXORDER);
+}
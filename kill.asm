@@ -0,0 +1,1786 @@
+
+_kill:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char **argv)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 1){
+  14:	83 3b 00             	cmpl   $0x0,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "usage: kill pid...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 d9 0c 00 00       	push   $0xcd9
+  21:	6a 02                	push   $0x2
+  23:	e8 72 08 00 00       	call   89a <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 94 06 00 00       	call   6c4 <exit>
+  }
+  for(i=1; i<argc; i++)
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 2d                	jmp    66 <main+0x66>
+    kill(atoi(argv[i]));
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 36 02 00 00       	call   289 <atoi>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	83 ec 0c             	sub    $0xc,%esp
+  59:	50                   	push   %eax
+  5a:	e8 8f 06 00 00       	call   6ee <kill>
+  5f:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+  62:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  69:	3b 03                	cmp    (%ebx),%eax
+  6b:	7c cc                	jl     39 <main+0x39>
+  exit();
+  6d:	e8 52 06 00 00       	call   6c4 <exit>
+
+00000072 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+  72:	55                   	push   %ebp
+  73:	89 e5                	mov    %esp,%ebp
+  75:	57                   	push   %edi
+  76:	53                   	push   %ebx
+char*
+  77:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7a:	8b 55 10             	mov    0x10(%ebp),%edx
+  7d:	8b 45 0c             	mov    0xc(%ebp),%eax
+  80:	89 cb                	mov    %ecx,%ebx
+  82:	89 df                	mov    %ebx,%edi
+  84:	89 d1                	mov    %edx,%ecx
+  86:	fc                   	cld
+  87:	f3 aa                	rep stos %al,%es:(%edi)
+  89:	89 ca                	mov    %ecx,%edx
+  8b:	89 fb                	mov    %edi,%ebx
+  8d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  90:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+  93:	90                   	nop
+  94:	5b                   	pop    %ebx
+  95:	5f                   	pop    %edi
+  96:	5d                   	pop    %ebp
+  97:	c3                   	ret
+
+00000098 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+  98:	55                   	push   %ebp
+  99:	89 e5                	mov    %esp,%ebp
+  9b:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+  9e:	8b 55 08             	mov    0x8(%ebp),%edx
+  a1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a7:	f0 87 02             	lock xchg %eax,(%edx)
+  aa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+  ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+  b0:	c9                   	leave
+  b1:	c3                   	ret
+
+000000b2 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+  b2:	55                   	push   %ebp
+  b3:	89 e5                	mov    %esp,%ebp
+  b5:	53                   	push   %ebx
+  b6:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+  b9:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  bc:	8b 55 10             	mov    0x10(%ebp),%edx
+  bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c5:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  c9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  cc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+  cf:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d2:	c9                   	leave
+  d3:	c3                   	ret
+
+000000d4 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+  d4:	55                   	push   %ebp
+  d5:	89 e5                	mov    %esp,%ebp
+  d7:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+  da:	0f 31                	rdtsc
+  dc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  df:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+  e2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  e5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+  e8:	c9                   	leave
+  e9:	c3                   	ret
+
+000000ea <strcpy>:
+{
+  ea:	55                   	push   %ebp
+  eb:	89 e5                	mov    %esp,%ebp
+  ed:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  f0:	8b 45 08             	mov    0x8(%ebp),%eax
+  f3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  f6:	90                   	nop
+  f7:	8b 55 0c             	mov    0xc(%ebp),%edx
+  fa:	8d 42 01             	lea    0x1(%edx),%eax
+  fd:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 100:	8b 45 08             	mov    0x8(%ebp),%eax
+ 103:	8d 48 01             	lea    0x1(%eax),%ecx
+ 106:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 109:	0f b6 12             	movzbl (%edx),%edx
+ 10c:	88 10                	mov    %dl,(%eax)
+ 10e:	0f b6 00             	movzbl (%eax),%eax
+ 111:	84 c0                	test   %al,%al
+ 113:	75 e2                	jne    f7 <strcpy+0xd>
+  return os;
+ 115:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 118:	c9                   	leave
+ 119:	c3                   	ret
+
+0000011a <strcmp>:
+{
+ 11a:	55                   	push   %ebp
+ 11b:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 11d:	eb 08                	jmp    127 <strcmp+0xd>
+    p++, q++;
+ 11f:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 123:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 127:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12a:	0f b6 00             	movzbl (%eax),%eax
+ 12d:	84 c0                	test   %al,%al
+ 12f:	74 10                	je     141 <strcmp+0x27>
+ 131:	8b 45 08             	mov    0x8(%ebp),%eax
+ 134:	0f b6 10             	movzbl (%eax),%edx
+ 137:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13a:	0f b6 00             	movzbl (%eax),%eax
+ 13d:	38 c2                	cmp    %al,%dl
+ 13f:	74 de                	je     11f <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 141:	8b 45 08             	mov    0x8(%ebp),%eax
+ 144:	0f b6 00             	movzbl (%eax),%eax
+ 147:	0f b6 d0             	movzbl %al,%edx
+ 14a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14d:	0f b6 00             	movzbl (%eax),%eax
+ 150:	0f b6 c0             	movzbl %al,%eax
+ 153:	29 c2                	sub    %eax,%edx
+ 155:	89 d0                	mov    %edx,%eax
+}
+ 157:	5d                   	pop    %ebp
+ 158:	c3                   	ret
+
+00000159 <strlen>:
+{
+ 159:	55                   	push   %ebp
+ 15a:	89 e5                	mov    %esp,%ebp
+ 15c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 15f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 166:	eb 04                	jmp    16c <strlen+0x13>
+ 168:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 16c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 16f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 172:	01 d0                	add    %edx,%eax
+ 174:	0f b6 00             	movzbl (%eax),%eax
+ 177:	84 c0                	test   %al,%al
+ 179:	75 ed                	jne    168 <strlen+0xf>
+  return n;
+ 17b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 17e:	c9                   	leave
+ 17f:	c3                   	ret
+
+00000180 <memset>:
+{
+ 180:	55                   	push   %ebp
+ 181:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 183:	8b 45 10             	mov    0x10(%ebp),%eax
+ 186:	50                   	push   %eax
+ 187:	ff 75 0c             	push   0xc(%ebp)
+ 18a:	ff 75 08             	push   0x8(%ebp)
+ 18d:	e8 e0 fe ff ff       	call   72 <stosb>
+ 192:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 195:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 198:	c9                   	leave
+ 199:	c3                   	ret
+
+0000019a <strchr>:
+{
+ 19a:	55                   	push   %ebp
+ 19b:	89 e5                	mov    %esp,%ebp
+ 19d:	83 ec 04             	sub    $0x4,%esp
+ 1a0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a3:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1a6:	eb 14                	jmp    1bc <strchr+0x22>
+    if(*s == c)
+ 1a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ab:	0f b6 00             	movzbl (%eax),%eax
+ 1ae:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1b1:	75 05                	jne    1b8 <strchr+0x1e>
+      return (char*)s;
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	eb 13                	jmp    1cb <strchr+0x31>
+  for(; *s; s++)
+ 1b8:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1bf:	0f b6 00             	movzbl (%eax),%eax
+ 1c2:	84 c0                	test   %al,%al
+ 1c4:	75 e2                	jne    1a8 <strchr+0xe>
+  return 0;
+ 1c6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1cb:	c9                   	leave
+ 1cc:	c3                   	ret
+
+000001cd <gets>:
+{
+ 1cd:	55                   	push   %ebp
+ 1ce:	89 e5                	mov    %esp,%ebp
+ 1d0:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1da:	eb 42                	jmp    21e <gets+0x51>
+    cc = read(0, &c, 1);
+ 1dc:	83 ec 04             	sub    $0x4,%esp
+ 1df:	6a 01                	push   $0x1
+ 1e1:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1e4:	50                   	push   %eax
+ 1e5:	6a 00                	push   $0x0
+ 1e7:	e8 ed 04 00 00       	call   6d9 <read>
+ 1ec:	83 c4 10             	add    $0x10,%esp
+ 1ef:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1f2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1f6:	7e 33                	jle    22b <gets+0x5e>
+    buf[i++] = c;
+ 1f8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1fb:	8d 50 01             	lea    0x1(%eax),%edx
+ 1fe:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 201:	89 c2                	mov    %eax,%edx
+ 203:	8b 45 08             	mov    0x8(%ebp),%eax
+ 206:	01 c2                	add    %eax,%edx
+ 208:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 20c:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 20e:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 212:	3c 0a                	cmp    $0xa,%al
+ 214:	74 16                	je     22c <gets+0x5f>
+ 216:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 21a:	3c 0d                	cmp    $0xd,%al
+ 21c:	74 0e                	je     22c <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 21e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 221:	83 c0 01             	add    $0x1,%eax
+ 224:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 227:	7f b3                	jg     1dc <gets+0xf>
+ 229:	eb 01                	jmp    22c <gets+0x5f>
+      break;
+ 22b:	90                   	nop
+  buf[i] = '\0';
+ 22c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 22f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 232:	01 d0                	add    %edx,%eax
+ 234:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 237:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 23a:	c9                   	leave
+ 23b:	c3                   	ret
+
+0000023c <stat>:
+{
+ 23c:	55                   	push   %ebp
+ 23d:	89 e5                	mov    %esp,%ebp
+ 23f:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 242:	83 ec 08             	sub    $0x8,%esp
+ 245:	6a 00                	push   $0x0
+ 247:	ff 75 08             	push   0x8(%ebp)
+ 24a:	e8 ad 04 00 00       	call   6fc <open>
+ 24f:	83 c4 10             	add    $0x10,%esp
+ 252:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 255:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 259:	79 07                	jns    262 <stat+0x26>
+    return -1;
+ 25b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 260:	eb 25                	jmp    287 <stat+0x4b>
+  r = fstat(fd, st);
+ 262:	83 ec 08             	sub    $0x8,%esp
+ 265:	ff 75 0c             	push   0xc(%ebp)
+ 268:	ff 75 f4             	push   -0xc(%ebp)
+ 26b:	e8 a1 04 00 00       	call   711 <fstat>
+ 270:	83 c4 10             	add    $0x10,%esp
+ 273:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 276:	83 ec 0c             	sub    $0xc,%esp
+ 279:	ff 75 f4             	push   -0xc(%ebp)
+ 27c:	e8 66 04 00 00       	call   6e7 <close>
+ 281:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 284:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+
+00000289 <atoi>:
+{
+ 289:	55                   	push   %ebp
+ 28a:	89 e5                	mov    %esp,%ebp
+ 28c:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 28f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 296:	eb 25                	jmp    2bd <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 298:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 29b:	89 d0                	mov    %edx,%eax
+ 29d:	c1 e0 02             	shl    $0x2,%eax
+ 2a0:	01 d0                	add    %edx,%eax
+ 2a2:	01 c0                	add    %eax,%eax
+ 2a4:	89 c1                	mov    %eax,%ecx
+ 2a6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a9:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ac:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2af:	0f b6 00             	movzbl (%eax),%eax
+ 2b2:	0f be c0             	movsbl %al,%eax
+ 2b5:	01 c8                	add    %ecx,%eax
+ 2b7:	83 e8 30             	sub    $0x30,%eax
+ 2ba:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c0:	0f b6 00             	movzbl (%eax),%eax
+ 2c3:	3c 2f                	cmp    $0x2f,%al
+ 2c5:	7e 0a                	jle    2d1 <atoi+0x48>
+ 2c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ca:	0f b6 00             	movzbl (%eax),%eax
+ 2cd:	3c 39                	cmp    $0x39,%al
+ 2cf:	7e c7                	jle    298 <atoi+0xf>
+  return n;
+ 2d1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2d4:	c9                   	leave
+ 2d5:	c3                   	ret
+
+000002d6 <memmove>:
+{
+ 2d6:	55                   	push   %ebp
+ 2d7:	89 e5                	mov    %esp,%ebp
+ 2d9:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 2dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2e2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2e8:	eb 17                	jmp    301 <memmove+0x2b>
+    *dst++ = *src++;
+ 2ea:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2ed:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2f3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2f6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2f9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2fc:	0f b6 12             	movzbl (%edx),%edx
+ 2ff:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 301:	8b 45 10             	mov    0x10(%ebp),%eax
+ 304:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 307:	89 55 10             	mov    %edx,0x10(%ebp)
+ 30a:	85 c0                	test   %eax,%eax
+ 30c:	7f dc                	jg     2ea <memmove+0x14>
+  return vdst;
+ 30e:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 311:	c9                   	leave
+ 312:	c3                   	ret
+
+00000313 <mutex_init>:
+{
+ 313:	55                   	push   %ebp
+ 314:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 316:	8b 45 08             	mov    0x8(%ebp),%eax
+ 319:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 31f:	90                   	nop
+ 320:	5d                   	pop    %ebp
+ 321:	c3                   	ret
+
+00000322 <mutex_lock>:
+{
+ 322:	55                   	push   %ebp
+ 323:	89 e5                	mov    %esp,%ebp
+ 325:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 328:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32b:	6a 01                	push   $0x1
+ 32d:	6a 00                	push   $0x0
+ 32f:	50                   	push   %eax
+ 330:	e8 7d fd ff ff       	call   b2 <cmpxchg>
+ 335:	83 c4 0c             	add    $0xc,%esp
+ 338:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 33b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 33f:	74 46                	je     387 <mutex_lock+0x65>
+  if(c != 2)
+ 341:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 345:	74 38                	je     37f <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 347:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34a:	6a 02                	push   $0x2
+ 34c:	50                   	push   %eax
+ 34d:	e8 46 fd ff ff       	call   98 <xchg>
+ 352:	83 c4 08             	add    $0x8,%esp
+ 355:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 358:	eb 25                	jmp    37f <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 35a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35d:	83 ec 08             	sub    $0x8,%esp
+ 360:	6a 02                	push   $0x2
+ 362:	50                   	push   %eax
+ 363:	e8 22 04 00 00       	call   78a <futex_wait>
+ 368:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 36b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36e:	83 ec 08             	sub    $0x8,%esp
+ 371:	6a 02                	push   $0x2
+ 373:	50                   	push   %eax
+ 374:	e8 1f fd ff ff       	call   98 <xchg>
+ 379:	83 c4 10             	add    $0x10,%esp
+ 37c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 37f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 383:	75 d5                	jne    35a <mutex_lock+0x38>
+ 385:	eb 01                	jmp    388 <mutex_lock+0x66>
+    return;
+ 387:	90                   	nop
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+
+0000038a <mutex_unlock>:
+{
+ 38a:	55                   	push   %ebp
+ 38b:	89 e5                	mov    %esp,%ebp
+ 38d:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	6a 00                	push   $0x0
+ 395:	50                   	push   %eax
+ 396:	e8 fd fc ff ff       	call   98 <xchg>
+ 39b:	83 c4 08             	add    $0x8,%esp
+ 39e:	83 f8 02             	cmp    $0x2,%eax
+ 3a1:	75 11                	jne    3b4 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 3a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a6:	83 ec 08             	sub    $0x8,%esp
+ 3a9:	6a 01                	push   $0x1
+ 3ab:	50                   	push   %eax
+ 3ac:	e8 e3 03 00 00       	call   794 <futex_wake>
+ 3b1:	83 c4 10             	add    $0x10,%esp
+}
+ 3b4:	90                   	nop
+ 3b5:	c9                   	leave
+ 3b6:	c3                   	ret
+
+000003b7 <cond_init>:
+{
+ 3b7:	55                   	push   %ebp
+ 3b8:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3c3:	90                   	nop
+ 3c4:	5d                   	pop    %ebp
+ 3c5:	c3                   	ret
+
+000003c6 <cond_wait>:
+{
+ 3c6:	55                   	push   %ebp
+ 3c7:	89 e5                	mov    %esp,%ebp
+ 3c9:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 3cc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cf:	8b 00                	mov    (%eax),%eax
+ 3d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 3d4:	83 ec 0c             	sub    $0xc,%esp
+ 3d7:	ff 75 0c             	push   0xc(%ebp)
+ 3da:	e8 ab ff ff ff       	call   38a <mutex_unlock>
+ 3df:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 3e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e5:	83 ec 08             	sub    $0x8,%esp
+ 3e8:	ff 75 f4             	push   -0xc(%ebp)
+ 3eb:	50                   	push   %eax
+ 3ec:	e8 99 03 00 00       	call   78a <futex_wait>
+ 3f1:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3f4:	eb 11                	jmp    407 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 3f6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3f9:	83 ec 08             	sub    $0x8,%esp
+ 3fc:	6a 02                	push   $0x2
+ 3fe:	50                   	push   %eax
+ 3ff:	e8 86 03 00 00       	call   78a <futex_wait>
+ 404:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 407:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40a:	83 ec 08             	sub    $0x8,%esp
+ 40d:	6a 02                	push   $0x2
+ 40f:	50                   	push   %eax
+ 410:	e8 83 fc ff ff       	call   98 <xchg>
+ 415:	83 c4 10             	add    $0x10,%esp
+ 418:	85 c0                	test   %eax,%eax
+ 41a:	75 da                	jne    3f6 <cond_wait+0x30>
+}
+ 41c:	90                   	nop
+ 41d:	90                   	nop
+ 41e:	c9                   	leave
+ 41f:	c3                   	ret
+
+00000420 <condbump>:
+{
+ 420:	55                   	push   %ebp
+ 421:	89 e5                	mov    %esp,%ebp
+ 423:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 426:	8b 45 08             	mov    0x8(%ebp),%eax
+ 429:	8b 00                	mov    (%eax),%eax
+ 42b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 42e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 431:	8d 50 01             	lea    0x1(%eax),%edx
+ 434:	8b 45 08             	mov    0x8(%ebp),%eax
+ 437:	52                   	push   %edx
+ 438:	ff 75 fc             	push   -0x4(%ebp)
+ 43b:	50                   	push   %eax
+ 43c:	e8 71 fc ff ff       	call   b2 <cmpxchg>
+ 441:	83 c4 0c             	add    $0xc,%esp
+ 444:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 447:	75 dd                	jne    426 <condbump+0x6>
+}
+ 449:	90                   	nop
+ 44a:	90                   	nop
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <cond_signal>:
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 453:	ff 75 08             	push   0x8(%ebp)
+ 456:	e8 c5 ff ff ff       	call   420 <condbump>
+ 45b:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 45e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 461:	83 ec 08             	sub    $0x8,%esp
+ 464:	6a 01                	push   $0x1
+ 466:	50                   	push   %eax
+ 467:	e8 28 03 00 00       	call   794 <futex_wake>
+ 46c:	83 c4 10             	add    $0x10,%esp
+}
+ 46f:	90                   	nop
+ 470:	c9                   	leave
+ 471:	c3                   	ret
+
+00000472 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 472:	55                   	push   %ebp
+ 473:	89 e5                	mov    %esp,%ebp
+ 475:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 478:	ff 75 08             	push   0x8(%ebp)
+ 47b:	e8 a0 ff ff ff       	call   420 <condbump>
+ 480:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	83 ec 08             	sub    $0x8,%esp
+ 489:	68 ff ff ff 7f       	push   $0x7fffffff
+ 48e:	50                   	push   %eax
+ 48f:	e8 00 03 00 00       	call   794 <futex_wake>
+ 494:	83 c4 10             	add    $0x10,%esp
+}
+ 497:	90                   	nop
+ 498:	c9                   	leave
+ 499:	c3                   	ret
+
+0000049a <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 49a:	55                   	push   %ebp
+ 49b:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 49d:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 4a2:	8b 00                	mov    (%eax),%eax
+}
+ 4a4:	5d                   	pop    %ebp
+ 4a5:	c3                   	ret
+
+000004a6 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 4a6:	55                   	push   %ebp
+ 4a7:	89 e5                	mov    %esp,%ebp
+ 4a9:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 4ac:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 4b1:	8b 00                	mov    (%eax),%eax
+ 4b3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 4b6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ba:	74 05                	je     4c1 <vgetpid+0x1b>
+    return pid;
+ 4bc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4bf:	eb 05                	jmp    4c6 <vgetpid+0x20>
+  return getpid();
+ 4c1:	e8 74 02 00 00       	call   73a <getpid>
+}
+ 4c6:	c9                   	leave
+ 4c7:	c3                   	ret
+
+000004c8 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 4c8:	55                   	push   %ebp
+ 4c9:	89 e5                	mov    %esp,%ebp
+ 4cb:	57                   	push   %edi
+ 4cc:	56                   	push   %esi
+ 4cd:	53                   	push   %ebx
+ 4ce:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 4d1:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 4d8:	e8 f7 fb ff ff       	call   d4 <rdtsc>
+ 4dd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4e0:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 4e3:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 4e6:	29 c8                	sub    %ecx,%eax
+ 4e8:	19 da                	sbb    %ebx,%edx
+ 4ea:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4ed:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 4f0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 4f3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 4f6:	89 d0                	mov    %edx,%eax
+ 4f8:	31 d2                	xor    %edx,%edx
+ 4fa:	89 c1                	mov    %eax,%ecx
+ 4fc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 501:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 504:	8b 40 04             	mov    0x4(%eax),%eax
+ 507:	ba 00 00 00 00       	mov    $0x0,%edx
+ 50c:	89 df                	mov    %ebx,%edi
+ 50e:	0f af f8             	imul   %eax,%edi
+ 511:	89 d6                	mov    %edx,%esi
+ 513:	0f af f1             	imul   %ecx,%esi
+ 516:	01 f7                	add    %esi,%edi
+ 518:	f7 e1                	mul    %ecx
+ 51a:	89 c1                	mov    %eax,%ecx
+ 51c:	89 d3                	mov    %edx,%ebx
+ 51e:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 521:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 523:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 526:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 529:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 52c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 533:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 536:	8b 40 04             	mov    0x4(%eax),%eax
+ 539:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 53c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 543:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 546:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 549:	89 d7                	mov    %edx,%edi
+ 54b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 54e:	0f af fe             	imul   %esi,%edi
+ 551:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 554:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 557:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 55a:	0f af f0             	imul   %eax,%esi
+ 55d:	01 f7                	add    %esi,%edi
+ 55f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 562:	f7 65 d8             	mull   -0x28(%ebp)
+ 565:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 568:	89 f2                	mov    %esi,%edx
+ 56a:	89 d0                	mov    %edx,%eax
+ 56c:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 56e:	01 c8                	add    %ecx,%eax
+ 570:	11 da                	adc    %ebx,%edx
+}
+ 572:	83 c4 24             	add    $0x24,%esp
+ 575:	5b                   	pop    %ebx
+ 576:	5e                   	pop    %esi
+ 577:	5f                   	pop    %edi
+ 578:	5d                   	pop    %ebp
+ 579:	c3                   	ret
+
+0000057a <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+ 57d:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 580:	8b 45 08             	mov    0x8(%ebp),%eax
+ 583:	8b 50 04             	mov    0x4(%eax),%edx
+ 586:	8b 45 08             	mov    0x8(%ebp),%eax
+ 589:	8b 00                	mov    (%eax),%eax
+ 58b:	29 c2                	sub    %eax,%edx
+ 58d:	83 fa 1f             	cmp    $0x1f,%edx
+ 590:	76 07                	jbe    599 <ring_queue+0x1f>
+    return -1;
+ 592:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 597:	eb 68                	jmp    601 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 599:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59c:	8b 40 04             	mov    0x4(%eax),%eax
+ 59f:	83 e0 1f             	and    $0x1f,%eax
+ 5a2:	89 c2                	mov    %eax,%edx
+ 5a4:	89 d0                	mov    %edx,%eax
+ 5a6:	c1 e0 02             	shl    $0x2,%eax
+ 5a9:	01 d0                	add    %edx,%eax
+ 5ab:	c1 e0 02             	shl    $0x2,%eax
+ 5ae:	8d 50 10             	lea    0x10(%eax),%edx
+ 5b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b4:	01 d0                	add    %edx,%eax
+ 5b6:	83 c0 04             	add    $0x4,%eax
+ 5b9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 5bc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5bf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5c2:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 5c4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c7:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5ca:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 5cd:	8b 55 14             	mov    0x14(%ebp),%edx
+ 5d0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5d3:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 5d6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5d9:	8b 55 18             	mov    0x18(%ebp),%edx
+ 5dc:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 5df:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5e2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 5e5:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 5e8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 5f3:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 5fc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 601:	c9                   	leave
+ 602:	c3                   	ret
+
+00000603 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 603:	55                   	push   %ebp
+ 604:	89 e5                	mov    %esp,%ebp
+ 606:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 609:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 60e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 612:	7f 1a                	jg     62e <ring_submit+0x2b>
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	8b 40 10             	mov    0x10(%eax),%eax
+ 61a:	83 e0 01             	and    $0x1,%eax
+ 61d:	85 c0                	test   %eax,%eax
+ 61f:	74 0d                	je     62e <ring_submit+0x2b>
+ 621:	8b 45 08             	mov    0x8(%ebp),%eax
+ 624:	8b 40 10             	mov    0x10(%eax),%eax
+ 627:	83 e0 02             	and    $0x2,%eax
+ 62a:	85 c0                	test   %eax,%eax
+ 62c:	74 10                	je     63e <ring_submit+0x3b>
+    return ring_enter(min);
+ 62e:	83 ec 0c             	sub    $0xc,%esp
+ 631:	ff 75 0c             	push   0xc(%ebp)
+ 634:	e8 83 01 00 00       	call   7bc <ring_enter>
+ 639:	83 c4 10             	add    $0x10,%esp
+ 63c:	eb 10                	jmp    64e <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 63e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 641:	8b 50 0c             	mov    0xc(%eax),%edx
+ 644:	8b 45 08             	mov    0x8(%ebp),%eax
+ 647:	8b 40 08             	mov    0x8(%eax),%eax
+ 64a:	29 c2                	sub    %eax,%edx
+ 64c:	89 d0                	mov    %edx,%eax
+}
+ 64e:	c9                   	leave
+ 64f:	c3                   	ret
+
+00000650 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 650:	55                   	push   %ebp
+ 651:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 653:	8b 45 08             	mov    0x8(%ebp),%eax
+ 656:	8b 50 08             	mov    0x8(%eax),%edx
+ 659:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65c:	8b 40 0c             	mov    0xc(%eax),%eax
+ 65f:	39 c2                	cmp    %eax,%edx
+ 661:	75 07                	jne    66a <ring_reap+0x1a>
+    return -1;
+ 663:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 668:	eb 3b                	jmp    6a5 <ring_reap+0x55>
+  __sync_synchronize();
+ 66a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 66f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 672:	8b 40 08             	mov    0x8(%eax),%eax
+ 675:	83 e0 1f             	and    $0x1f,%eax
+ 678:	89 c2                	mov    %eax,%edx
+ 67a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 67d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 680:	83 c2 52             	add    $0x52,%edx
+ 683:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 687:	8b 02                	mov    (%edx),%eax
+ 689:	8b 52 04             	mov    0x4(%edx),%edx
+ 68c:	89 01                	mov    %eax,(%ecx)
+ 68e:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	8b 40 08             	mov    0x8(%eax),%eax
+ 697:	8d 50 01             	lea    0x1(%eax),%edx
+ 69a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69d:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 6a0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6a5:	5d                   	pop    %ebp
+ 6a6:	c3                   	ret
+
+000006a7 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 6a7:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 6ae:	74 0a                	je     6ba <usyscall+0x13>
+  movl %esp, %ecx
+ 6b0:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6b2:	ba b9 06 00 00       	mov    $0x6b9,%edx
+  sysenter
+ 6b7:	0f 34                	sysenter
+2:
+  ret
+ 6b9:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 6ba:	cd 40                	int    $0x40
+  ret
+ 6bc:	c3                   	ret
+
+000006bd <fork>:
+
+SYSCALL(fork)
+ 6bd:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c2:	eb e3                	jmp    6a7 <usyscall>
+
+000006c4 <exit>:
+SYSCALL(exit)
+ 6c4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6c9:	eb dc                	jmp    6a7 <usyscall>
+
+000006cb <wait>:
+SYSCALL(wait)
+ 6cb:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6d0:	eb d5                	jmp    6a7 <usyscall>
+
+000006d2 <pipe>:
+SYSCALL(pipe)
+ 6d2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d7:	eb ce                	jmp    6a7 <usyscall>
+
+000006d9 <read>:
+SYSCALL(read)
+ 6d9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6de:	eb c7                	jmp    6a7 <usyscall>
+
+000006e0 <write>:
+SYSCALL(write)
+ 6e0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6e5:	eb c0                	jmp    6a7 <usyscall>
+
+000006e7 <close>:
+SYSCALL(close)
+ 6e7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ec:	eb b9                	jmp    6a7 <usyscall>
+
+000006ee <kill>:
+SYSCALL(kill)
+ 6ee:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6f3:	eb b2                	jmp    6a7 <usyscall>
+
+000006f5 <exec>:
+SYSCALL(exec)
+ 6f5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6fa:	eb ab                	jmp    6a7 <usyscall>
+
+000006fc <open>:
+SYSCALL(open)
+ 6fc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 701:	eb a4                	jmp    6a7 <usyscall>
+
+00000703 <mknod>:
+SYSCALL(mknod)
+ 703:	b8 11 00 00 00       	mov    $0x11,%eax
+ 708:	eb 9d                	jmp    6a7 <usyscall>
+
+0000070a <unlink>:
+SYSCALL(unlink)
+ 70a:	b8 12 00 00 00       	mov    $0x12,%eax
+ 70f:	eb 96                	jmp    6a7 <usyscall>
+
+00000711 <fstat>:
+SYSCALL(fstat)
+ 711:	b8 08 00 00 00       	mov    $0x8,%eax
+ 716:	eb 8f                	jmp    6a7 <usyscall>
+
+00000718 <link>:
+SYSCALL(link)
+ 718:	b8 13 00 00 00       	mov    $0x13,%eax
+ 71d:	eb 88                	jmp    6a7 <usyscall>
+
+0000071f <mkdir>:
+SYSCALL(mkdir)
+ 71f:	b8 14 00 00 00       	mov    $0x14,%eax
+ 724:	eb 81                	jmp    6a7 <usyscall>
+
+00000726 <chdir>:
+SYSCALL(chdir)
+ 726:	b8 09 00 00 00       	mov    $0x9,%eax
+ 72b:	e9 77 ff ff ff       	jmp    6a7 <usyscall>
+
+00000730 <dup>:
+SYSCALL(dup)
+ 730:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 735:	e9 6d ff ff ff       	jmp    6a7 <usyscall>
+
+0000073a <getpid>:
+SYSCALL(getpid)
+ 73a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 73f:	e9 63 ff ff ff       	jmp    6a7 <usyscall>
+
+00000744 <sbrk>:
+SYSCALL(sbrk)
+ 744:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 749:	e9 59 ff ff ff       	jmp    6a7 <usyscall>
+
+0000074e <sleep>:
+SYSCALL(sleep)
+ 74e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 753:	e9 4f ff ff ff       	jmp    6a7 <usyscall>
+
+00000758 <uptime>:
+SYSCALL(uptime)
+ 758:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 75d:	e9 45 ff ff ff       	jmp    6a7 <usyscall>
+
+00000762 <kmstat>:
+SYSCALL(kmstat)
+ 762:	b8 16 00 00 00       	mov    $0x16,%eax
+ 767:	e9 3b ff ff ff       	jmp    6a7 <usyscall>
+
+0000076c <setpriority>:
+SYSCALL(setpriority)
+ 76c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 771:	e9 31 ff ff ff       	jmp    6a7 <usyscall>
+
+00000776 <clone>:
+SYSCALL(clone)
+ 776:	b8 18 00 00 00       	mov    $0x18,%eax
+ 77b:	e9 27 ff ff ff       	jmp    6a7 <usyscall>
+
+00000780 <join>:
+SYSCALL(join)
+ 780:	b8 19 00 00 00       	mov    $0x19,%eax
+ 785:	e9 1d ff ff ff       	jmp    6a7 <usyscall>
+
+0000078a <futex_wait>:
+SYSCALL(futex_wait)
+ 78a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 78f:	e9 13 ff ff ff       	jmp    6a7 <usyscall>
+
+00000794 <futex_wake>:
+SYSCALL(futex_wake)
+ 794:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 799:	e9 09 ff ff ff       	jmp    6a7 <usyscall>
+
+0000079e <lockstat>:
+SYSCALL(lockstat)
+ 79e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7a3:	e9 ff fe ff ff       	jmp    6a7 <usyscall>
+
+000007a8 <sysstat>:
+SYSCALL(sysstat)
+ 7a8:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7ad:	e9 f5 fe ff ff       	jmp    6a7 <usyscall>
+
+000007b2 <ring_setup>:
+SYSCALL(ring_setup)
+ 7b2:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7b7:	e9 eb fe ff ff       	jmp    6a7 <usyscall>
+
+000007bc <ring_enter>:
+SYSCALL(ring_enter)
+ 7bc:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7c1:	e9 e1 fe ff ff       	jmp    6a7 <usyscall>
+
+000007c6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7c6:	55                   	push   %ebp
+ 7c7:	89 e5                	mov    %esp,%ebp
+ 7c9:	83 ec 18             	sub    $0x18,%esp
+ 7cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7cf:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7d2:	83 ec 04             	sub    $0x4,%esp
+ 7d5:	6a 01                	push   $0x1
+ 7d7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7da:	50                   	push   %eax
+ 7db:	ff 75 08             	push   0x8(%ebp)
+ 7de:	e8 fd fe ff ff       	call   6e0 <write>
+ 7e3:	83 c4 10             	add    $0x10,%esp
+}
+ 7e6:	90                   	nop
+ 7e7:	c9                   	leave
+ 7e8:	c3                   	ret
+
+000007e9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7e9:	55                   	push   %ebp
+ 7ea:	89 e5                	mov    %esp,%ebp
+ 7ec:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7ef:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7f6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7fa:	74 17                	je     813 <printint+0x2a>
+ 7fc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 800:	79 11                	jns    813 <printint+0x2a>
+    neg = 1;
+ 802:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 809:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 80c:	f7 d8                	neg    %eax
+ 80e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 811:	eb 06                	jmp    819 <printint+0x30>
+  } else {
+    x = xx;
+ 813:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 816:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 819:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 820:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 823:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 826:	ba 00 00 00 00       	mov    $0x0,%edx
+ 82b:	f7 f1                	div    %ecx
+ 82d:	89 d1                	mov    %edx,%ecx
+ 82f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 832:	8d 50 01             	lea    0x1(%eax),%edx
+ 835:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 838:	0f b6 91 ac 11 00 00 	movzbl 0x11ac(%ecx),%edx
+ 83f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 843:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 846:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 849:	ba 00 00 00 00       	mov    $0x0,%edx
+ 84e:	f7 f1                	div    %ecx
+ 850:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 853:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 857:	75 c7                	jne    820 <printint+0x37>
+  if(neg)
+ 859:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 85d:	74 2d                	je     88c <printint+0xa3>
+    buf[i++] = '-';
+ 85f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 862:	8d 50 01             	lea    0x1(%eax),%edx
+ 865:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 868:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 86d:	eb 1d                	jmp    88c <printint+0xa3>
+    putc(fd, buf[i]);
+ 86f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 872:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 875:	01 d0                	add    %edx,%eax
+ 877:	0f b6 00             	movzbl (%eax),%eax
+ 87a:	0f be c0             	movsbl %al,%eax
+ 87d:	83 ec 08             	sub    $0x8,%esp
+ 880:	50                   	push   %eax
+ 881:	ff 75 08             	push   0x8(%ebp)
+ 884:	e8 3d ff ff ff       	call   7c6 <putc>
+ 889:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 88c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 890:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 894:	79 d9                	jns    86f <printint+0x86>
+}
+ 896:	90                   	nop
+ 897:	90                   	nop
+ 898:	c9                   	leave
+ 899:	c3                   	ret
+
+0000089a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 89a:	55                   	push   %ebp
+ 89b:	89 e5                	mov    %esp,%ebp
+ 89d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8a0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8a7:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8aa:	83 c0 04             	add    $0x4,%eax
+ 8ad:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8b0:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8b7:	e9 59 01 00 00       	jmp    a15 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8bc:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8bf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c2:	01 d0                	add    %edx,%eax
+ 8c4:	0f b6 00             	movzbl (%eax),%eax
+ 8c7:	0f be c0             	movsbl %al,%eax
+ 8ca:	25 ff 00 00 00       	and    $0xff,%eax
+ 8cf:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8d2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8d6:	75 2c                	jne    904 <printf+0x6a>
+      if(c == '%'){
+ 8d8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8dc:	75 0c                	jne    8ea <printf+0x50>
+        state = '%';
+ 8de:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8e5:	e9 27 01 00 00       	jmp    a11 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8ea:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ed:	0f be c0             	movsbl %al,%eax
+ 8f0:	83 ec 08             	sub    $0x8,%esp
+ 8f3:	50                   	push   %eax
+ 8f4:	ff 75 08             	push   0x8(%ebp)
+ 8f7:	e8 ca fe ff ff       	call   7c6 <putc>
+ 8fc:	83 c4 10             	add    $0x10,%esp
+ 8ff:	e9 0d 01 00 00       	jmp    a11 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 904:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 908:	0f 85 03 01 00 00    	jne    a11 <printf+0x177>
+      if(c == 'd'){
+ 90e:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 912:	75 1e                	jne    932 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 914:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 917:	8b 00                	mov    (%eax),%eax
+ 919:	6a 01                	push   $0x1
+ 91b:	6a 0a                	push   $0xa
+ 91d:	50                   	push   %eax
+ 91e:	ff 75 08             	push   0x8(%ebp)
+ 921:	e8 c3 fe ff ff       	call   7e9 <printint>
+ 926:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 929:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 92d:	e9 d8 00 00 00       	jmp    a0a <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 932:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 936:	74 06                	je     93e <printf+0xa4>
+ 938:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 93c:	75 1e                	jne    95c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 93e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 941:	8b 00                	mov    (%eax),%eax
+ 943:	6a 00                	push   $0x0
+ 945:	6a 10                	push   $0x10
+ 947:	50                   	push   %eax
+ 948:	ff 75 08             	push   0x8(%ebp)
+ 94b:	e8 99 fe ff ff       	call   7e9 <printint>
+ 950:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 953:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 957:	e9 ae 00 00 00       	jmp    a0a <printf+0x170>
+      } else if(c == 's'){
+ 95c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 960:	75 43                	jne    9a5 <printf+0x10b>
+        s = (char*)*ap;
+ 962:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 965:	8b 00                	mov    (%eax),%eax
+ 967:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 96a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 96e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 972:	75 25                	jne    999 <printf+0xff>
+          s = "(null)";
+ 974:	c7 45 f4 ed 0c 00 00 	movl   $0xced,-0xc(%ebp)
+        while(*s != 0){
+ 97b:	eb 1c                	jmp    999 <printf+0xff>
+          putc(fd, *s);
+ 97d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 980:	0f b6 00             	movzbl (%eax),%eax
+ 983:	0f be c0             	movsbl %al,%eax
+ 986:	83 ec 08             	sub    $0x8,%esp
+ 989:	50                   	push   %eax
+ 98a:	ff 75 08             	push   0x8(%ebp)
+ 98d:	e8 34 fe ff ff       	call   7c6 <putc>
+ 992:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 995:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 999:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99c:	0f b6 00             	movzbl (%eax),%eax
+ 99f:	84 c0                	test   %al,%al
+ 9a1:	75 da                	jne    97d <printf+0xe3>
+ 9a3:	eb 65                	jmp    a0a <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9a5:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9a9:	75 1d                	jne    9c8 <printf+0x12e>
+        putc(fd, *ap);
+ 9ab:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9ae:	8b 00                	mov    (%eax),%eax
+ 9b0:	0f be c0             	movsbl %al,%eax
+ 9b3:	83 ec 08             	sub    $0x8,%esp
+ 9b6:	50                   	push   %eax
+ 9b7:	ff 75 08             	push   0x8(%ebp)
+ 9ba:	e8 07 fe ff ff       	call   7c6 <putc>
+ 9bf:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9c2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c6:	eb 42                	jmp    a0a <printf+0x170>
+      } else if(c == '%'){
+ 9c8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9cc:	75 17                	jne    9e5 <printf+0x14b>
+        putc(fd, c);
+ 9ce:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9d1:	0f be c0             	movsbl %al,%eax
+ 9d4:	83 ec 08             	sub    $0x8,%esp
+ 9d7:	50                   	push   %eax
+ 9d8:	ff 75 08             	push   0x8(%ebp)
+ 9db:	e8 e6 fd ff ff       	call   7c6 <putc>
+ 9e0:	83 c4 10             	add    $0x10,%esp
+ 9e3:	eb 25                	jmp    a0a <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9e5:	83 ec 08             	sub    $0x8,%esp
+ 9e8:	6a 25                	push   $0x25
+ 9ea:	ff 75 08             	push   0x8(%ebp)
+ 9ed:	e8 d4 fd ff ff       	call   7c6 <putc>
+ 9f2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9f5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9f8:	0f be c0             	movsbl %al,%eax
+ 9fb:	83 ec 08             	sub    $0x8,%esp
+ 9fe:	50                   	push   %eax
+ 9ff:	ff 75 08             	push   0x8(%ebp)
+ a02:	e8 bf fd ff ff       	call   7c6 <putc>
+ a07:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a0a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a11:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a15:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a18:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1b:	01 d0                	add    %edx,%eax
+ a1d:	0f b6 00             	movzbl (%eax),%eax
+ a20:	84 c0                	test   %al,%al
+ a22:	0f 85 94 fe ff ff    	jne    8bc <printf+0x22>
+    }
+  }
+}
+ a28:	90                   	nop
+ a29:	90                   	nop
+ a2a:	c9                   	leave
+ a2b:	c3                   	ret
+
+00000a2c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a2c:	55                   	push   %ebp
+ a2d:	89 e5                	mov    %esp,%ebp
+ a2f:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a32:	8b 45 08             	mov    0x8(%ebp),%eax
+ a35:	83 e8 08             	sub    $0x8,%eax
+ a38:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a3b:	a1 c8 11 00 00       	mov    0x11c8,%eax
+ a40:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a43:	eb 24                	jmp    a69 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a48:	8b 00                	mov    (%eax),%eax
+ a4a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a4d:	72 12                	jb     a61 <free+0x35>
+ a4f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a52:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a55:	72 24                	jb     a7b <free+0x4f>
+ a57:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5a:	8b 00                	mov    (%eax),%eax
+ a5c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a5f:	72 1a                	jb     a7b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a61:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a64:	8b 00                	mov    (%eax),%eax
+ a66:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a69:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a6c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a6f:	73 d4                	jae    a45 <free+0x19>
+ a71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a74:	8b 00                	mov    (%eax),%eax
+ a76:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a79:	73 ca                	jae    a45 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a7b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a7e:	8b 40 04             	mov    0x4(%eax),%eax
+ a81:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a88:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8b:	01 c2                	add    %eax,%edx
+ a8d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a90:	8b 00                	mov    (%eax),%eax
+ a92:	39 c2                	cmp    %eax,%edx
+ a94:	75 24                	jne    aba <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a96:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a99:	8b 50 04             	mov    0x4(%eax),%edx
+ a9c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a9f:	8b 00                	mov    (%eax),%eax
+ aa1:	8b 40 04             	mov    0x4(%eax),%eax
+ aa4:	01 c2                	add    %eax,%edx
+ aa6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa9:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aaf:	8b 00                	mov    (%eax),%eax
+ ab1:	8b 10                	mov    (%eax),%edx
+ ab3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab6:	89 10                	mov    %edx,(%eax)
+ ab8:	eb 0a                	jmp    ac4 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ aba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abd:	8b 10                	mov    (%eax),%edx
+ abf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac2:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ac4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac7:	8b 40 04             	mov    0x4(%eax),%eax
+ aca:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ad1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad4:	01 d0                	add    %edx,%eax
+ ad6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ ad9:	75 20                	jne    afb <free+0xcf>
+    p->s.size += bp->s.size;
+ adb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ade:	8b 50 04             	mov    0x4(%eax),%edx
+ ae1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae4:	8b 40 04             	mov    0x4(%eax),%eax
+ ae7:	01 c2                	add    %eax,%edx
+ ae9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aec:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ aef:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ af2:	8b 10                	mov    (%eax),%edx
+ af4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af7:	89 10                	mov    %edx,(%eax)
+ af9:	eb 08                	jmp    b03 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ afb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afe:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b01:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b03:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b06:	a3 c8 11 00 00       	mov    %eax,0x11c8
+}
+ b0b:	90                   	nop
+ b0c:	c9                   	leave
+ b0d:	c3                   	ret
+
+00000b0e <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b0e:	55                   	push   %ebp
+ b0f:	89 e5                	mov    %esp,%ebp
+ b11:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b14:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b1b:	77 07                	ja     b24 <morecore+0x16>
+    nu = 4096;
+ b1d:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b24:	8b 45 08             	mov    0x8(%ebp),%eax
+ b27:	c1 e0 03             	shl    $0x3,%eax
+ b2a:	83 ec 0c             	sub    $0xc,%esp
+ b2d:	50                   	push   %eax
+ b2e:	e8 11 fc ff ff       	call   744 <sbrk>
+ b33:	83 c4 10             	add    $0x10,%esp
+ b36:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b39:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b3d:	75 07                	jne    b46 <morecore+0x38>
+    return 0;
+ b3f:	b8 00 00 00 00       	mov    $0x0,%eax
+ b44:	eb 26                	jmp    b6c <morecore+0x5e>
+  hp = (Header*)p;
+ b46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b49:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b4f:	8b 55 08             	mov    0x8(%ebp),%edx
+ b52:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b55:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b58:	83 c0 08             	add    $0x8,%eax
+ b5b:	83 ec 0c             	sub    $0xc,%esp
+ b5e:	50                   	push   %eax
+ b5f:	e8 c8 fe ff ff       	call   a2c <free>
+ b64:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b67:	a1 c8 11 00 00       	mov    0x11c8,%eax
+}
+ b6c:	c9                   	leave
+ b6d:	c3                   	ret
+
+00000b6e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b6e:	55                   	push   %ebp
+ b6f:	89 e5                	mov    %esp,%ebp
+ b71:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b74:	8b 45 08             	mov    0x8(%ebp),%eax
+ b77:	83 c0 07             	add    $0x7,%eax
+ b7a:	c1 e8 03             	shr    $0x3,%eax
+ b7d:	83 c0 01             	add    $0x1,%eax
+ b80:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b83:	a1 c8 11 00 00       	mov    0x11c8,%eax
+ b88:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b8b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b8f:	75 23                	jne    bb4 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b91:	c7 45 f0 c0 11 00 00 	movl   $0x11c0,-0x10(%ebp)
+ b98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b9b:	a3 c8 11 00 00       	mov    %eax,0x11c8
+ ba0:	a1 c8 11 00 00       	mov    0x11c8,%eax
+ ba5:	a3 c0 11 00 00       	mov    %eax,0x11c0
+    base.s.size = 0;
+ baa:	c7 05 c4 11 00 00 00 	movl   $0x0,0x11c4
+ bb1:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bb7:	8b 00                	mov    (%eax),%eax
+ bb9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bbc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bbf:	8b 40 04             	mov    0x4(%eax),%eax
+ bc2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bc5:	72 4d                	jb     c14 <malloc+0xa6>
+      if(p->s.size == nunits)
+ bc7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bca:	8b 40 04             	mov    0x4(%eax),%eax
+ bcd:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bd0:	75 0c                	jne    bde <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ bd2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd5:	8b 10                	mov    (%eax),%edx
+ bd7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bda:	89 10                	mov    %edx,(%eax)
+ bdc:	eb 26                	jmp    c04 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ bde:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be1:	8b 40 04             	mov    0x4(%eax),%eax
+ be4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ be7:	89 c2                	mov    %eax,%edx
+ be9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bec:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ bef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf2:	8b 40 04             	mov    0x4(%eax),%eax
+ bf5:	c1 e0 03             	shl    $0x3,%eax
+ bf8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bfb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfe:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c01:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c04:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c07:	a3 c8 11 00 00       	mov    %eax,0x11c8
+      return (void*)(p + 1);
+ c0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0f:	83 c0 08             	add    $0x8,%eax
+ c12:	eb 3b                	jmp    c4f <malloc+0xe1>
+    }
+    if(p == freep)
+ c14:	a1 c8 11 00 00       	mov    0x11c8,%eax
+ c19:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c1c:	75 1e                	jne    c3c <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c1e:	83 ec 0c             	sub    $0xc,%esp
+ c21:	ff 75 ec             	push   -0x14(%ebp)
+ c24:	e8 e5 fe ff ff       	call   b0e <morecore>
+ c29:	83 c4 10             	add    $0x10,%esp
+ c2c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c2f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c33:	75 07                	jne    c3c <malloc+0xce>
+        return 0;
+ c35:	b8 00 00 00 00       	mov    $0x0,%eax
+ c3a:	eb 13                	jmp    c4f <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c3c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c3f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c45:	8b 00                	mov    (%eax),%eax
+ c47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c4a:	e9 6d ff ff ff       	jmp    bbc <malloc+0x4e>
+  }
+}
+ c4f:	c9                   	leave
+ c50:	c3                   	ret
+
+00000c51 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c51:	55                   	push   %ebp
+ c52:	89 e5                	mov    %esp,%ebp
+ c54:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ c57:	83 ec 0c             	sub    $0xc,%esp
+ c5a:	68 00 10 00 00       	push   $0x1000
+ c5f:	e8 0a ff ff ff       	call   b6e <malloc>
+ c64:	83 c4 10             	add    $0x10,%esp
+ c67:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c6a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c6e:	75 07                	jne    c77 <thread_create+0x26>
+    return -1;
+ c70:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c75:	eb 2e                	jmp    ca5 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ c77:	83 ec 04             	sub    $0x4,%esp
+ c7a:	ff 75 f4             	push   -0xc(%ebp)
+ c7d:	ff 75 0c             	push   0xc(%ebp)
+ c80:	ff 75 08             	push   0x8(%ebp)
+ c83:	e8 ee fa ff ff       	call   776 <clone>
+ c88:	83 c4 10             	add    $0x10,%esp
+ c8b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c8e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c92:	79 0e                	jns    ca2 <thread_create+0x51>
+    free(stack);
+ c94:	83 ec 0c             	sub    $0xc,%esp
+ c97:	ff 75 f4             	push   -0xc(%ebp)
+ c9a:	e8 8d fd ff ff       	call   a2c <free>
+ c9f:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ca2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ca5:	c9                   	leave
+ ca6:	c3                   	ret
+
+00000ca7 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ ca7:	55                   	push   %ebp
+ ca8:	89 e5                	mov    %esp,%ebp
+ caa:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ cad:	83 ec 0c             	sub    $0xc,%esp
+ cb0:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ cb3:	50                   	push   %eax
+ cb4:	e8 c7 fa ff ff       	call   780 <join>
+ cb9:	83 c4 10             	add    $0x10,%esp
+ cbc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cbf:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc3:	78 0f                	js     cd4 <thread_join+0x2d>
+    free(stack);
+ cc5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc8:	83 ec 0c             	sub    $0xc,%esp
+ ccb:	50                   	push   %eax
+ ccc:	e8 5b fd ff ff       	call   a2c <free>
+ cd1:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ cd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ cd7:	c9                   	leave
+ cd8:	c3                   	ret
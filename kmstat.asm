@@ -0,0 +1,1850 @@
+
+_kmstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+
+struct kmstat st[NCACHE];
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	57                   	push   %edi
+   e:	56                   	push   %esi
+   f:	53                   	push   %ebx
+  10:	51                   	push   %ecx
+  11:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+
+  if((n = kmstat(st, NCACHE)) < 0){
+  14:	83 ec 08             	sub    $0x8,%esp
+  17:	6a 10                	push   $0x10
+  19:	68 c0 12 00 00       	push   $0x12c0
+  1e:	e8 f3 07 00 00       	call   816 <kmstat>
+  23:	83 c4 10             	add    $0x10,%esp
+  26:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  29:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  2d:	79 17                	jns    46 <main+0x46>
+    printf(2, "kmstat: failed\n");
+  2f:	83 ec 08             	sub    $0x8,%esp
+  32:	68 90 0d 00 00       	push   $0xd90
+  37:	6a 02                	push   $0x2
+  39:	e8 10 09 00 00       	call   94e <printf>
+  3e:	83 c4 10             	add    $0x10,%esp
+    exit();
+  41:	e8 32 07 00 00       	call   778 <exit>
+  }
+  printf(1, "name size perslab slabs active cached allocs\n");
+  46:	83 ec 08             	sub    $0x8,%esp
+  49:	68 a0 0d 00 00       	push   $0xda0
+  4e:	6a 01                	push   $0x1
+  50:	e8 f9 08 00 00       	call   94e <printf>
+  55:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++)
+  58:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  5f:	e9 b1 00 00 00       	jmp    115 <main+0x115>
+    printf(1, "%s %d %d %d %d %d %d\n", st[i].name, st[i].size,
+  64:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  67:	89 d0                	mov    %edx,%eax
+  69:	c1 e0 02             	shl    $0x2,%eax
+  6c:	01 d0                	add    %edx,%eax
+  6e:	c1 e0 03             	shl    $0x3,%eax
+  71:	05 e4 12 00 00       	add    $0x12e4,%eax
+  76:	8b 00                	mov    (%eax),%eax
+  78:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  7b:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  7e:	89 d0                	mov    %edx,%eax
+  80:	c1 e0 02             	shl    $0x2,%eax
+  83:	01 d0                	add    %edx,%eax
+  85:	c1 e0 03             	shl    $0x3,%eax
+  88:	05 e0 12 00 00       	add    $0x12e0,%eax
+  8d:	8b 08                	mov    (%eax),%ecx
+  8f:	89 4d d0             	mov    %ecx,-0x30(%ebp)
+  92:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  95:	89 d0                	mov    %edx,%eax
+  97:	c1 e0 02             	shl    $0x2,%eax
+  9a:	01 d0                	add    %edx,%eax
+  9c:	c1 e0 03             	shl    $0x3,%eax
+  9f:	05 dc 12 00 00       	add    $0x12dc,%eax
+  a4:	8b 38                	mov    (%eax),%edi
+  a6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  a9:	89 d0                	mov    %edx,%eax
+  ab:	c1 e0 02             	shl    $0x2,%eax
+  ae:	01 d0                	add    %edx,%eax
+  b0:	c1 e0 03             	shl    $0x3,%eax
+  b3:	05 d8 12 00 00       	add    $0x12d8,%eax
+  b8:	8b 30                	mov    (%eax),%esi
+  ba:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  bd:	89 d0                	mov    %edx,%eax
+  bf:	c1 e0 02             	shl    $0x2,%eax
+  c2:	01 d0                	add    %edx,%eax
+  c4:	c1 e0 03             	shl    $0x3,%eax
+  c7:	05 d4 12 00 00       	add    $0x12d4,%eax
+  cc:	8b 18                	mov    (%eax),%ebx
+  ce:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  d1:	89 d0                	mov    %edx,%eax
+  d3:	c1 e0 02             	shl    $0x2,%eax
+  d6:	01 d0                	add    %edx,%eax
+  d8:	c1 e0 03             	shl    $0x3,%eax
+  db:	05 d0 12 00 00       	add    $0x12d0,%eax
+  e0:	8b 08                	mov    (%eax),%ecx
+  e2:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  e5:	89 d0                	mov    %edx,%eax
+  e7:	c1 e0 02             	shl    $0x2,%eax
+  ea:	01 d0                	add    %edx,%eax
+  ec:	c1 e0 03             	shl    $0x3,%eax
+  ef:	05 c0 12 00 00       	add    $0x12c0,%eax
+  f4:	83 ec 0c             	sub    $0xc,%esp
+  f7:	ff 75 d4             	push   -0x2c(%ebp)
+  fa:	ff 75 d0             	push   -0x30(%ebp)
+  fd:	57                   	push   %edi
+  fe:	56                   	push   %esi
+  ff:	53                   	push   %ebx
+ 100:	51                   	push   %ecx
+ 101:	50                   	push   %eax
+ 102:	68 ce 0d 00 00       	push   $0xdce
+ 107:	6a 01                	push   $0x1
+ 109:	e8 40 08 00 00       	call   94e <printf>
+ 10e:	83 c4 30             	add    $0x30,%esp
+  for(i = 0; i < n; i++)
+ 111:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 115:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 118:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+ 11b:	0f 8c 43 ff ff ff    	jl     64 <main+0x64>
+           st[i].perslab, st[i].slabs, st[i].active, st[i].cached,
+           st[i].allocs);
+  exit();
+ 121:	e8 52 06 00 00       	call   778 <exit>
+
+00000126 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 126:	55                   	push   %ebp
+ 127:	89 e5                	mov    %esp,%ebp
+ 129:	57                   	push   %edi
+ 12a:	53                   	push   %ebx
+char*
+ 12b:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 12e:	8b 55 10             	mov    0x10(%ebp),%edx
+ 131:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 134:	89 cb                	mov    %ecx,%ebx
+ 136:	89 df                	mov    %ebx,%edi
+ 138:	89 d1                	mov    %edx,%ecx
+ 13a:	fc                   	cld
+ 13b:	f3 aa                	rep stos %al,%es:(%edi)
+ 13d:	89 ca                	mov    %ecx,%edx
+ 13f:	89 fb                	mov    %edi,%ebx
+ 141:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 144:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 147:	90                   	nop
+ 148:	5b                   	pop    %ebx
+ 149:	5f                   	pop    %edi
+ 14a:	5d                   	pop    %ebp
+ 14b:	c3                   	ret
+
+0000014c <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 14c:	55                   	push   %ebp
+ 14d:	89 e5                	mov    %esp,%ebp
+ 14f:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 152:	8b 55 08             	mov    0x8(%ebp),%edx
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15b:	f0 87 02             	lock xchg %eax,(%edx)
+ 15e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 161:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 164:	c9                   	leave
+ 165:	c3                   	ret
+
+00000166 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 166:	55                   	push   %ebp
+ 167:	89 e5                	mov    %esp,%ebp
+ 169:	53                   	push   %ebx
+ 16a:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 16d:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 170:	8b 55 10             	mov    0x10(%ebp),%edx
+ 173:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 176:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 179:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 17d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 180:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 183:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 186:	c9                   	leave
+ 187:	c3                   	ret
+
+00000188 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 188:	55                   	push   %ebp
+ 189:	89 e5                	mov    %esp,%ebp
+ 18b:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 18e:	0f 31                	rdtsc
+ 190:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 193:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 196:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 199:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 19c:	c9                   	leave
+ 19d:	c3                   	ret
+
+0000019e <strcpy>:
+{
+ 19e:	55                   	push   %ebp
+ 19f:	89 e5                	mov    %esp,%ebp
+ 1a1:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1a7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1aa:	90                   	nop
+ 1ab:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1ae:	8d 42 01             	lea    0x1(%edx),%eax
+ 1b1:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b7:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1ba:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1bd:	0f b6 12             	movzbl (%edx),%edx
+ 1c0:	88 10                	mov    %dl,(%eax)
+ 1c2:	0f b6 00             	movzbl (%eax),%eax
+ 1c5:	84 c0                	test   %al,%al
+ 1c7:	75 e2                	jne    1ab <strcpy+0xd>
+  return os;
+ 1c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1cc:	c9                   	leave
+ 1cd:	c3                   	ret
+
+000001ce <strcmp>:
+{
+ 1ce:	55                   	push   %ebp
+ 1cf:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1d1:	eb 08                	jmp    1db <strcmp+0xd>
+    p++, q++;
+ 1d3:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1d7:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1de:	0f b6 00             	movzbl (%eax),%eax
+ 1e1:	84 c0                	test   %al,%al
+ 1e3:	74 10                	je     1f5 <strcmp+0x27>
+ 1e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e8:	0f b6 10             	movzbl (%eax),%edx
+ 1eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ee:	0f b6 00             	movzbl (%eax),%eax
+ 1f1:	38 c2                	cmp    %al,%dl
+ 1f3:	74 de                	je     1d3 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 1f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f8:	0f b6 00             	movzbl (%eax),%eax
+ 1fb:	0f b6 d0             	movzbl %al,%edx
+ 1fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 201:	0f b6 00             	movzbl (%eax),%eax
+ 204:	0f b6 c0             	movzbl %al,%eax
+ 207:	29 c2                	sub    %eax,%edx
+ 209:	89 d0                	mov    %edx,%eax
+}
+ 20b:	5d                   	pop    %ebp
+ 20c:	c3                   	ret
+
+0000020d <strlen>:
+{
+ 20d:	55                   	push   %ebp
+ 20e:	89 e5                	mov    %esp,%ebp
+ 210:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 213:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 21a:	eb 04                	jmp    220 <strlen+0x13>
+ 21c:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 220:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 223:	8b 45 08             	mov    0x8(%ebp),%eax
+ 226:	01 d0                	add    %edx,%eax
+ 228:	0f b6 00             	movzbl (%eax),%eax
+ 22b:	84 c0                	test   %al,%al
+ 22d:	75 ed                	jne    21c <strlen+0xf>
+  return n;
+ 22f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 232:	c9                   	leave
+ 233:	c3                   	ret
+
+00000234 <memset>:
+{
+ 234:	55                   	push   %ebp
+ 235:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 237:	8b 45 10             	mov    0x10(%ebp),%eax
+ 23a:	50                   	push   %eax
+ 23b:	ff 75 0c             	push   0xc(%ebp)
+ 23e:	ff 75 08             	push   0x8(%ebp)
+ 241:	e8 e0 fe ff ff       	call   126 <stosb>
+ 246:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 249:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 24c:	c9                   	leave
+ 24d:	c3                   	ret
+
+0000024e <strchr>:
+{
+ 24e:	55                   	push   %ebp
+ 24f:	89 e5                	mov    %esp,%ebp
+ 251:	83 ec 04             	sub    $0x4,%esp
+ 254:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 257:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 25a:	eb 14                	jmp    270 <strchr+0x22>
+    if(*s == c)
+ 25c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 25f:	0f b6 00             	movzbl (%eax),%eax
+ 262:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 265:	75 05                	jne    26c <strchr+0x1e>
+      return (char*)s;
+ 267:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26a:	eb 13                	jmp    27f <strchr+0x31>
+  for(; *s; s++)
+ 26c:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 270:	8b 45 08             	mov    0x8(%ebp),%eax
+ 273:	0f b6 00             	movzbl (%eax),%eax
+ 276:	84 c0                	test   %al,%al
+ 278:	75 e2                	jne    25c <strchr+0xe>
+  return 0;
+ 27a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 27f:	c9                   	leave
+ 280:	c3                   	ret
+
+00000281 <gets>:
+{
+ 281:	55                   	push   %ebp
+ 282:	89 e5                	mov    %esp,%ebp
+ 284:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 287:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 28e:	eb 42                	jmp    2d2 <gets+0x51>
+    cc = read(0, &c, 1);
+ 290:	83 ec 04             	sub    $0x4,%esp
+ 293:	6a 01                	push   $0x1
+ 295:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 298:	50                   	push   %eax
+ 299:	6a 00                	push   $0x0
+ 29b:	e8 ed 04 00 00       	call   78d <read>
+ 2a0:	83 c4 10             	add    $0x10,%esp
+ 2a3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2a6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2aa:	7e 33                	jle    2df <gets+0x5e>
+    buf[i++] = c;
+ 2ac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2af:	8d 50 01             	lea    0x1(%eax),%edx
+ 2b2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2b5:	89 c2                	mov    %eax,%edx
+ 2b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ba:	01 c2                	add    %eax,%edx
+ 2bc:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2c0:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2c2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2c6:	3c 0a                	cmp    $0xa,%al
+ 2c8:	74 16                	je     2e0 <gets+0x5f>
+ 2ca:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ce:	3c 0d                	cmp    $0xd,%al
+ 2d0:	74 0e                	je     2e0 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2d5:	83 c0 01             	add    $0x1,%eax
+ 2d8:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2db:	7f b3                	jg     290 <gets+0xf>
+ 2dd:	eb 01                	jmp    2e0 <gets+0x5f>
+      break;
+ 2df:	90                   	nop
+  buf[i] = '\0';
+ 2e0:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	01 d0                	add    %edx,%eax
+ 2e8:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2eb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2ee:	c9                   	leave
+ 2ef:	c3                   	ret
+
+000002f0 <stat>:
+{
+ 2f0:	55                   	push   %ebp
+ 2f1:	89 e5                	mov    %esp,%ebp
+ 2f3:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 2f6:	83 ec 08             	sub    $0x8,%esp
+ 2f9:	6a 00                	push   $0x0
+ 2fb:	ff 75 08             	push   0x8(%ebp)
+ 2fe:	e8 ad 04 00 00       	call   7b0 <open>
+ 303:	83 c4 10             	add    $0x10,%esp
+ 306:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 309:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 30d:	79 07                	jns    316 <stat+0x26>
+    return -1;
+ 30f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 314:	eb 25                	jmp    33b <stat+0x4b>
+  r = fstat(fd, st);
+ 316:	83 ec 08             	sub    $0x8,%esp
+ 319:	ff 75 0c             	push   0xc(%ebp)
+ 31c:	ff 75 f4             	push   -0xc(%ebp)
+ 31f:	e8 a1 04 00 00       	call   7c5 <fstat>
+ 324:	83 c4 10             	add    $0x10,%esp
+ 327:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 32a:	83 ec 0c             	sub    $0xc,%esp
+ 32d:	ff 75 f4             	push   -0xc(%ebp)
+ 330:	e8 66 04 00 00       	call   79b <close>
+ 335:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 338:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 33b:	c9                   	leave
+ 33c:	c3                   	ret
+
+0000033d <atoi>:
+{
+ 33d:	55                   	push   %ebp
+ 33e:	89 e5                	mov    %esp,%ebp
+ 340:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 343:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 34a:	eb 25                	jmp    371 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 34c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 34f:	89 d0                	mov    %edx,%eax
+ 351:	c1 e0 02             	shl    $0x2,%eax
+ 354:	01 d0                	add    %edx,%eax
+ 356:	01 c0                	add    %eax,%eax
+ 358:	89 c1                	mov    %eax,%ecx
+ 35a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35d:	8d 50 01             	lea    0x1(%eax),%edx
+ 360:	89 55 08             	mov    %edx,0x8(%ebp)
+ 363:	0f b6 00             	movzbl (%eax),%eax
+ 366:	0f be c0             	movsbl %al,%eax
+ 369:	01 c8                	add    %ecx,%eax
+ 36b:	83 e8 30             	sub    $0x30,%eax
+ 36e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 371:	8b 45 08             	mov    0x8(%ebp),%eax
+ 374:	0f b6 00             	movzbl (%eax),%eax
+ 377:	3c 2f                	cmp    $0x2f,%al
+ 379:	7e 0a                	jle    385 <atoi+0x48>
+ 37b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37e:	0f b6 00             	movzbl (%eax),%eax
+ 381:	3c 39                	cmp    $0x39,%al
+ 383:	7e c7                	jle    34c <atoi+0xf>
+  return n;
+ 385:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 388:	c9                   	leave
+ 389:	c3                   	ret
+
+0000038a <memmove>:
+{
+ 38a:	55                   	push   %ebp
+ 38b:	89 e5                	mov    %esp,%ebp
+ 38d:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 396:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 399:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 39c:	eb 17                	jmp    3b5 <memmove+0x2b>
+    *dst++ = *src++;
+ 39e:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3a1:	8d 42 01             	lea    0x1(%edx),%eax
+ 3a4:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3a7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3aa:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3ad:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3b0:	0f b6 12             	movzbl (%edx),%edx
+ 3b3:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3b5:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3b8:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3bb:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3be:	85 c0                	test   %eax,%eax
+ 3c0:	7f dc                	jg     39e <memmove+0x14>
+  return vdst;
+ 3c2:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3c5:	c9                   	leave
+ 3c6:	c3                   	ret
+
+000003c7 <mutex_init>:
+{
+ 3c7:	55                   	push   %ebp
+ 3c8:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3ca:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cd:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3d3:	90                   	nop
+ 3d4:	5d                   	pop    %ebp
+ 3d5:	c3                   	ret
+
+000003d6 <mutex_lock>:
+{
+ 3d6:	55                   	push   %ebp
+ 3d7:	89 e5                	mov    %esp,%ebp
+ 3d9:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3df:	6a 01                	push   $0x1
+ 3e1:	6a 00                	push   $0x0
+ 3e3:	50                   	push   %eax
+ 3e4:	e8 7d fd ff ff       	call   166 <cmpxchg>
+ 3e9:	83 c4 0c             	add    $0xc,%esp
+ 3ec:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3ef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3f3:	74 46                	je     43b <mutex_lock+0x65>
+  if(c != 2)
+ 3f5:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 3f9:	74 38                	je     433 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 3fb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fe:	6a 02                	push   $0x2
+ 400:	50                   	push   %eax
+ 401:	e8 46 fd ff ff       	call   14c <xchg>
+ 406:	83 c4 08             	add    $0x8,%esp
+ 409:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 40c:	eb 25                	jmp    433 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 40e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 411:	83 ec 08             	sub    $0x8,%esp
+ 414:	6a 02                	push   $0x2
+ 416:	50                   	push   %eax
+ 417:	e8 22 04 00 00       	call   83e <futex_wait>
+ 41c:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 41f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 422:	83 ec 08             	sub    $0x8,%esp
+ 425:	6a 02                	push   $0x2
+ 427:	50                   	push   %eax
+ 428:	e8 1f fd ff ff       	call   14c <xchg>
+ 42d:	83 c4 10             	add    $0x10,%esp
+ 430:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 433:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 437:	75 d5                	jne    40e <mutex_lock+0x38>
+ 439:	eb 01                	jmp    43c <mutex_lock+0x66>
+    return;
+ 43b:	90                   	nop
+}
+ 43c:	c9                   	leave
+ 43d:	c3                   	ret
+
+0000043e <mutex_unlock>:
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 444:	8b 45 08             	mov    0x8(%ebp),%eax
+ 447:	6a 00                	push   $0x0
+ 449:	50                   	push   %eax
+ 44a:	e8 fd fc ff ff       	call   14c <xchg>
+ 44f:	83 c4 08             	add    $0x8,%esp
+ 452:	83 f8 02             	cmp    $0x2,%eax
+ 455:	75 11                	jne    468 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 457:	8b 45 08             	mov    0x8(%ebp),%eax
+ 45a:	83 ec 08             	sub    $0x8,%esp
+ 45d:	6a 01                	push   $0x1
+ 45f:	50                   	push   %eax
+ 460:	e8 e3 03 00 00       	call   848 <futex_wake>
+ 465:	83 c4 10             	add    $0x10,%esp
+}
+ 468:	90                   	nop
+ 469:	c9                   	leave
+ 46a:	c3                   	ret
+
+0000046b <cond_init>:
+{
+ 46b:	55                   	push   %ebp
+ 46c:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 46e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 471:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 477:	90                   	nop
+ 478:	5d                   	pop    %ebp
+ 479:	c3                   	ret
+
+0000047a <cond_wait>:
+{
+ 47a:	55                   	push   %ebp
+ 47b:	89 e5                	mov    %esp,%ebp
+ 47d:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 480:	8b 45 08             	mov    0x8(%ebp),%eax
+ 483:	8b 00                	mov    (%eax),%eax
+ 485:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 488:	83 ec 0c             	sub    $0xc,%esp
+ 48b:	ff 75 0c             	push   0xc(%ebp)
+ 48e:	e8 ab ff ff ff       	call   43e <mutex_unlock>
+ 493:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 496:	8b 45 08             	mov    0x8(%ebp),%eax
+ 499:	83 ec 08             	sub    $0x8,%esp
+ 49c:	ff 75 f4             	push   -0xc(%ebp)
+ 49f:	50                   	push   %eax
+ 4a0:	e8 99 03 00 00       	call   83e <futex_wait>
+ 4a5:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4a8:	eb 11                	jmp    4bb <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 4aa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ad:	83 ec 08             	sub    $0x8,%esp
+ 4b0:	6a 02                	push   $0x2
+ 4b2:	50                   	push   %eax
+ 4b3:	e8 86 03 00 00       	call   83e <futex_wait>
+ 4b8:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4bb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4be:	83 ec 08             	sub    $0x8,%esp
+ 4c1:	6a 02                	push   $0x2
+ 4c3:	50                   	push   %eax
+ 4c4:	e8 83 fc ff ff       	call   14c <xchg>
+ 4c9:	83 c4 10             	add    $0x10,%esp
+ 4cc:	85 c0                	test   %eax,%eax
+ 4ce:	75 da                	jne    4aa <cond_wait+0x30>
+}
+ 4d0:	90                   	nop
+ 4d1:	90                   	nop
+ 4d2:	c9                   	leave
+ 4d3:	c3                   	ret
+
+000004d4 <condbump>:
+{
+ 4d4:	55                   	push   %ebp
+ 4d5:	89 e5                	mov    %esp,%ebp
+ 4d7:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 4da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4dd:	8b 00                	mov    (%eax),%eax
+ 4df:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4e5:	8d 50 01             	lea    0x1(%eax),%edx
+ 4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4eb:	52                   	push   %edx
+ 4ec:	ff 75 fc             	push   -0x4(%ebp)
+ 4ef:	50                   	push   %eax
+ 4f0:	e8 71 fc ff ff       	call   166 <cmpxchg>
+ 4f5:	83 c4 0c             	add    $0xc,%esp
+ 4f8:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 4fb:	75 dd                	jne    4da <condbump+0x6>
+}
+ 4fd:	90                   	nop
+ 4fe:	90                   	nop
+ 4ff:	c9                   	leave
+ 500:	c3                   	ret
+
+00000501 <cond_signal>:
+{
+ 501:	55                   	push   %ebp
+ 502:	89 e5                	mov    %esp,%ebp
+ 504:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 507:	ff 75 08             	push   0x8(%ebp)
+ 50a:	e8 c5 ff ff ff       	call   4d4 <condbump>
+ 50f:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 512:	8b 45 08             	mov    0x8(%ebp),%eax
+ 515:	83 ec 08             	sub    $0x8,%esp
+ 518:	6a 01                	push   $0x1
+ 51a:	50                   	push   %eax
+ 51b:	e8 28 03 00 00       	call   848 <futex_wake>
+ 520:	83 c4 10             	add    $0x10,%esp
+}
+ 523:	90                   	nop
+ 524:	c9                   	leave
+ 525:	c3                   	ret
+
+00000526 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 526:	55                   	push   %ebp
+ 527:	89 e5                	mov    %esp,%ebp
+ 529:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 52c:	ff 75 08             	push   0x8(%ebp)
+ 52f:	e8 a0 ff ff ff       	call   4d4 <condbump>
+ 534:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 537:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53a:	83 ec 08             	sub    $0x8,%esp
+ 53d:	68 ff ff ff 7f       	push   $0x7fffffff
+ 542:	50                   	push   %eax
+ 543:	e8 00 03 00 00       	call   848 <futex_wake>
+ 548:	83 c4 10             	add    $0x10,%esp
+}
+ 54b:	90                   	nop
+ 54c:	c9                   	leave
+ 54d:	c3                   	ret
+
+0000054e <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 54e:	55                   	push   %ebp
+ 54f:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 551:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 556:	8b 00                	mov    (%eax),%eax
+}
+ 558:	5d                   	pop    %ebp
+ 559:	c3                   	ret
+
+0000055a <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 55a:	55                   	push   %ebp
+ 55b:	89 e5                	mov    %esp,%ebp
+ 55d:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 560:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 565:	8b 00                	mov    (%eax),%eax
+ 567:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 56a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 56e:	74 05                	je     575 <vgetpid+0x1b>
+    return pid;
+ 570:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 573:	eb 05                	jmp    57a <vgetpid+0x20>
+  return getpid();
+ 575:	e8 74 02 00 00       	call   7ee <getpid>
+}
+ 57a:	c9                   	leave
+ 57b:	c3                   	ret
+
+0000057c <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	57                   	push   %edi
+ 580:	56                   	push   %esi
+ 581:	53                   	push   %ebx
+ 582:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 585:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 58c:	e8 f7 fb ff ff       	call   188 <rdtsc>
+ 591:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 594:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 597:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 59a:	29 c8                	sub    %ecx,%eax
+ 59c:	19 da                	sbb    %ebx,%edx
+ 59e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5a1:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 5a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5aa:	89 d0                	mov    %edx,%eax
+ 5ac:	31 d2                	xor    %edx,%edx
+ 5ae:	89 c1                	mov    %eax,%ecx
+ 5b0:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5b5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5b8:	8b 40 04             	mov    0x4(%eax),%eax
+ 5bb:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5c0:	89 df                	mov    %ebx,%edi
+ 5c2:	0f af f8             	imul   %eax,%edi
+ 5c5:	89 d6                	mov    %edx,%esi
+ 5c7:	0f af f1             	imul   %ecx,%esi
+ 5ca:	01 f7                	add    %esi,%edi
+ 5cc:	f7 e1                	mul    %ecx
+ 5ce:	89 c1                	mov    %eax,%ecx
+ 5d0:	89 d3                	mov    %edx,%ebx
+ 5d2:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 5d5:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 5d7:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5da:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5dd:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5e0:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 5e7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5ea:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ed:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5f0:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 5f7:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 5fa:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 5fd:	89 d7                	mov    %edx,%edi
+ 5ff:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 602:	0f af fe             	imul   %esi,%edi
+ 605:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 608:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 60b:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 60e:	0f af f0             	imul   %eax,%esi
+ 611:	01 f7                	add    %esi,%edi
+ 613:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 616:	f7 65 d8             	mull   -0x28(%ebp)
+ 619:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 61c:	89 f2                	mov    %esi,%edx
+ 61e:	89 d0                	mov    %edx,%eax
+ 620:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 622:	01 c8                	add    %ecx,%eax
+ 624:	11 da                	adc    %ebx,%edx
+}
+ 626:	83 c4 24             	add    $0x24,%esp
+ 629:	5b                   	pop    %ebx
+ 62a:	5e                   	pop    %esi
+ 62b:	5f                   	pop    %edi
+ 62c:	5d                   	pop    %ebp
+ 62d:	c3                   	ret
+
+0000062e <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 62e:	55                   	push   %ebp
+ 62f:	89 e5                	mov    %esp,%ebp
+ 631:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 634:	8b 45 08             	mov    0x8(%ebp),%eax
+ 637:	8b 50 04             	mov    0x4(%eax),%edx
+ 63a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63d:	8b 00                	mov    (%eax),%eax
+ 63f:	29 c2                	sub    %eax,%edx
+ 641:	83 fa 1f             	cmp    $0x1f,%edx
+ 644:	76 07                	jbe    64d <ring_queue+0x1f>
+    return -1;
+ 646:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 64b:	eb 68                	jmp    6b5 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 64d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 650:	8b 40 04             	mov    0x4(%eax),%eax
+ 653:	83 e0 1f             	and    $0x1f,%eax
+ 656:	89 c2                	mov    %eax,%edx
+ 658:	89 d0                	mov    %edx,%eax
+ 65a:	c1 e0 02             	shl    $0x2,%eax
+ 65d:	01 d0                	add    %edx,%eax
+ 65f:	c1 e0 02             	shl    $0x2,%eax
+ 662:	8d 50 10             	lea    0x10(%eax),%edx
+ 665:	8b 45 08             	mov    0x8(%ebp),%eax
+ 668:	01 d0                	add    %edx,%eax
+ 66a:	83 c0 04             	add    $0x4,%eax
+ 66d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 670:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 673:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 676:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 678:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 67b:	8b 55 10             	mov    0x10(%ebp),%edx
+ 67e:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 681:	8b 55 14             	mov    0x14(%ebp),%edx
+ 684:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 687:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 68a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68d:	8b 55 18             	mov    0x18(%ebp),%edx
+ 690:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 693:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 696:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 699:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 69c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 6a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a4:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a7:	8d 50 01             	lea    0x1(%eax),%edx
+ 6aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ad:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 6b0:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6b5:	c9                   	leave
+ 6b6:	c3                   	ret
+
+000006b7 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 6b7:	55                   	push   %ebp
+ 6b8:	89 e5                	mov    %esp,%ebp
+ 6ba:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 6bd:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 6c2:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6c6:	7f 1a                	jg     6e2 <ring_submit+0x2b>
+ 6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6cb:	8b 40 10             	mov    0x10(%eax),%eax
+ 6ce:	83 e0 01             	and    $0x1,%eax
+ 6d1:	85 c0                	test   %eax,%eax
+ 6d3:	74 0d                	je     6e2 <ring_submit+0x2b>
+ 6d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d8:	8b 40 10             	mov    0x10(%eax),%eax
+ 6db:	83 e0 02             	and    $0x2,%eax
+ 6de:	85 c0                	test   %eax,%eax
+ 6e0:	74 10                	je     6f2 <ring_submit+0x3b>
+    return ring_enter(min);
+ 6e2:	83 ec 0c             	sub    $0xc,%esp
+ 6e5:	ff 75 0c             	push   0xc(%ebp)
+ 6e8:	e8 83 01 00 00       	call   870 <ring_enter>
+ 6ed:	83 c4 10             	add    $0x10,%esp
+ 6f0:	eb 10                	jmp    702 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 6f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f5:	8b 50 0c             	mov    0xc(%eax),%edx
+ 6f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fb:	8b 40 08             	mov    0x8(%eax),%eax
+ 6fe:	29 c2                	sub    %eax,%edx
+ 700:	89 d0                	mov    %edx,%eax
+}
+ 702:	c9                   	leave
+ 703:	c3                   	ret
+
+00000704 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 704:	55                   	push   %ebp
+ 705:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 707:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70a:	8b 50 08             	mov    0x8(%eax),%edx
+ 70d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 710:	8b 40 0c             	mov    0xc(%eax),%eax
+ 713:	39 c2                	cmp    %eax,%edx
+ 715:	75 07                	jne    71e <ring_reap+0x1a>
+    return -1;
+ 717:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 71c:	eb 3b                	jmp    759 <ring_reap+0x55>
+  __sync_synchronize();
+ 71e:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 723:	8b 45 08             	mov    0x8(%ebp),%eax
+ 726:	8b 40 08             	mov    0x8(%eax),%eax
+ 729:	83 e0 1f             	and    $0x1f,%eax
+ 72c:	89 c2                	mov    %eax,%edx
+ 72e:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 731:	8b 45 08             	mov    0x8(%ebp),%eax
+ 734:	83 c2 52             	add    $0x52,%edx
+ 737:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 73b:	8b 02                	mov    (%edx),%eax
+ 73d:	8b 52 04             	mov    0x4(%edx),%edx
+ 740:	89 01                	mov    %eax,(%ecx)
+ 742:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 745:	8b 45 08             	mov    0x8(%ebp),%eax
+ 748:	8b 40 08             	mov    0x8(%eax),%eax
+ 74b:	8d 50 01             	lea    0x1(%eax),%edx
+ 74e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 751:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 754:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 759:	5d                   	pop    %ebp
+ 75a:	c3                   	ret
+
+0000075b <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 75b:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 762:	74 0a                	je     76e <usyscall+0x13>
+  movl %esp, %ecx
+ 764:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 766:	ba 6d 07 00 00       	mov    $0x76d,%edx
+  sysenter
+ 76b:	0f 34                	sysenter
+2:
+  ret
+ 76d:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 76e:	cd 40                	int    $0x40
+  ret
+ 770:	c3                   	ret
+
+00000771 <fork>:
+
+SYSCALL(fork)
+ 771:	b8 01 00 00 00       	mov    $0x1,%eax
+ 776:	eb e3                	jmp    75b <usyscall>
+
+00000778 <exit>:
+SYSCALL(exit)
+ 778:	b8 02 00 00 00       	mov    $0x2,%eax
+ 77d:	eb dc                	jmp    75b <usyscall>
+
+0000077f <wait>:
+SYSCALL(wait)
+ 77f:	b8 03 00 00 00       	mov    $0x3,%eax
+ 784:	eb d5                	jmp    75b <usyscall>
+
+00000786 <pipe>:
+SYSCALL(pipe)
+ 786:	b8 04 00 00 00       	mov    $0x4,%eax
+ 78b:	eb ce                	jmp    75b <usyscall>
+
+0000078d <read>:
+SYSCALL(read)
+ 78d:	b8 05 00 00 00       	mov    $0x5,%eax
+ 792:	eb c7                	jmp    75b <usyscall>
+
+00000794 <write>:
+SYSCALL(write)
+ 794:	b8 10 00 00 00       	mov    $0x10,%eax
+ 799:	eb c0                	jmp    75b <usyscall>
+
+0000079b <close>:
+SYSCALL(close)
+ 79b:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7a0:	eb b9                	jmp    75b <usyscall>
+
+000007a2 <kill>:
+SYSCALL(kill)
+ 7a2:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7a7:	eb b2                	jmp    75b <usyscall>
+
+000007a9 <exec>:
+SYSCALL(exec)
+ 7a9:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7ae:	eb ab                	jmp    75b <usyscall>
+
+000007b0 <open>:
+SYSCALL(open)
+ 7b0:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7b5:	eb a4                	jmp    75b <usyscall>
+
+000007b7 <mknod>:
+SYSCALL(mknod)
+ 7b7:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7bc:	eb 9d                	jmp    75b <usyscall>
+
+000007be <unlink>:
+SYSCALL(unlink)
+ 7be:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7c3:	eb 96                	jmp    75b <usyscall>
+
+000007c5 <fstat>:
+SYSCALL(fstat)
+ 7c5:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7ca:	eb 8f                	jmp    75b <usyscall>
+
+000007cc <link>:
+SYSCALL(link)
+ 7cc:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7d1:	eb 88                	jmp    75b <usyscall>
+
+000007d3 <mkdir>:
+SYSCALL(mkdir)
+ 7d3:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7d8:	eb 81                	jmp    75b <usyscall>
+
+000007da <chdir>:
+SYSCALL(chdir)
+ 7da:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7df:	e9 77 ff ff ff       	jmp    75b <usyscall>
+
+000007e4 <dup>:
+SYSCALL(dup)
+ 7e4:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7e9:	e9 6d ff ff ff       	jmp    75b <usyscall>
+
+000007ee <getpid>:
+SYSCALL(getpid)
+ 7ee:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 7f3:	e9 63 ff ff ff       	jmp    75b <usyscall>
+
+000007f8 <sbrk>:
+SYSCALL(sbrk)
+ 7f8:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 7fd:	e9 59 ff ff ff       	jmp    75b <usyscall>
+
+00000802 <sleep>:
+SYSCALL(sleep)
+ 802:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 807:	e9 4f ff ff ff       	jmp    75b <usyscall>
+
+0000080c <uptime>:
+SYSCALL(uptime)
+ 80c:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 811:	e9 45 ff ff ff       	jmp    75b <usyscall>
+
+00000816 <kmstat>:
+SYSCALL(kmstat)
+ 816:	b8 16 00 00 00       	mov    $0x16,%eax
+ 81b:	e9 3b ff ff ff       	jmp    75b <usyscall>
+
+00000820 <setpriority>:
+SYSCALL(setpriority)
+ 820:	b8 17 00 00 00       	mov    $0x17,%eax
+ 825:	e9 31 ff ff ff       	jmp    75b <usyscall>
+
+0000082a <clone>:
+SYSCALL(clone)
+ 82a:	b8 18 00 00 00       	mov    $0x18,%eax
+ 82f:	e9 27 ff ff ff       	jmp    75b <usyscall>
+
+00000834 <join>:
+SYSCALL(join)
+ 834:	b8 19 00 00 00       	mov    $0x19,%eax
+ 839:	e9 1d ff ff ff       	jmp    75b <usyscall>
+
+0000083e <futex_wait>:
+SYSCALL(futex_wait)
+ 83e:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 843:	e9 13 ff ff ff       	jmp    75b <usyscall>
+
+00000848 <futex_wake>:
+SYSCALL(futex_wake)
+ 848:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 84d:	e9 09 ff ff ff       	jmp    75b <usyscall>
+
+00000852 <lockstat>:
+SYSCALL(lockstat)
+ 852:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 857:	e9 ff fe ff ff       	jmp    75b <usyscall>
+
+0000085c <sysstat>:
+SYSCALL(sysstat)
+ 85c:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 861:	e9 f5 fe ff ff       	jmp    75b <usyscall>
+
+00000866 <ring_setup>:
+SYSCALL(ring_setup)
+ 866:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 86b:	e9 eb fe ff ff       	jmp    75b <usyscall>
+
+00000870 <ring_enter>:
+SYSCALL(ring_enter)
+ 870:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 875:	e9 e1 fe ff ff       	jmp    75b <usyscall>
+
+0000087a <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 87a:	55                   	push   %ebp
+ 87b:	89 e5                	mov    %esp,%ebp
+ 87d:	83 ec 18             	sub    $0x18,%esp
+ 880:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 883:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 886:	83 ec 04             	sub    $0x4,%esp
+ 889:	6a 01                	push   $0x1
+ 88b:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 88e:	50                   	push   %eax
+ 88f:	ff 75 08             	push   0x8(%ebp)
+ 892:	e8 fd fe ff ff       	call   794 <write>
+ 897:	83 c4 10             	add    $0x10,%esp
+}
+ 89a:	90                   	nop
+ 89b:	c9                   	leave
+ 89c:	c3                   	ret
+
+0000089d <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 89d:	55                   	push   %ebp
+ 89e:	89 e5                	mov    %esp,%ebp
+ 8a0:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8a3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8aa:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8ae:	74 17                	je     8c7 <printint+0x2a>
+ 8b0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8b4:	79 11                	jns    8c7 <printint+0x2a>
+    neg = 1;
+ 8b6:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8bd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8c0:	f7 d8                	neg    %eax
+ 8c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8c5:	eb 06                	jmp    8cd <printint+0x30>
+  } else {
+    x = xx;
+ 8c7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ca:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8cd:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8d4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8d7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8da:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8df:	f7 f1                	div    %ecx
+ 8e1:	89 d1                	mov    %edx,%ecx
+ 8e3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8e6:	8d 50 01             	lea    0x1(%eax),%edx
+ 8e9:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8ec:	0f b6 91 ac 12 00 00 	movzbl 0x12ac(%ecx),%edx
+ 8f3:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 8f7:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8fa:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8fd:	ba 00 00 00 00       	mov    $0x0,%edx
+ 902:	f7 f1                	div    %ecx
+ 904:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 907:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 90b:	75 c7                	jne    8d4 <printint+0x37>
+  if(neg)
+ 90d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 911:	74 2d                	je     940 <printint+0xa3>
+    buf[i++] = '-';
+ 913:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 916:	8d 50 01             	lea    0x1(%eax),%edx
+ 919:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 91c:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 921:	eb 1d                	jmp    940 <printint+0xa3>
+    putc(fd, buf[i]);
+ 923:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 926:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 929:	01 d0                	add    %edx,%eax
+ 92b:	0f b6 00             	movzbl (%eax),%eax
+ 92e:	0f be c0             	movsbl %al,%eax
+ 931:	83 ec 08             	sub    $0x8,%esp
+ 934:	50                   	push   %eax
+ 935:	ff 75 08             	push   0x8(%ebp)
+ 938:	e8 3d ff ff ff       	call   87a <putc>
+ 93d:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 940:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 944:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 948:	79 d9                	jns    923 <printint+0x86>
+}
+ 94a:	90                   	nop
+ 94b:	90                   	nop
+ 94c:	c9                   	leave
+ 94d:	c3                   	ret
+
+0000094e <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 94e:	55                   	push   %ebp
+ 94f:	89 e5                	mov    %esp,%ebp
+ 951:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 954:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 95b:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 95e:	83 c0 04             	add    $0x4,%eax
+ 961:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 964:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 96b:	e9 59 01 00 00       	jmp    ac9 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 970:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 973:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 976:	01 d0                	add    %edx,%eax
+ 978:	0f b6 00             	movzbl (%eax),%eax
+ 97b:	0f be c0             	movsbl %al,%eax
+ 97e:	25 ff 00 00 00       	and    $0xff,%eax
+ 983:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 986:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 98a:	75 2c                	jne    9b8 <printf+0x6a>
+      if(c == '%'){
+ 98c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 990:	75 0c                	jne    99e <printf+0x50>
+        state = '%';
+ 992:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 999:	e9 27 01 00 00       	jmp    ac5 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 99e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9a1:	0f be c0             	movsbl %al,%eax
+ 9a4:	83 ec 08             	sub    $0x8,%esp
+ 9a7:	50                   	push   %eax
+ 9a8:	ff 75 08             	push   0x8(%ebp)
+ 9ab:	e8 ca fe ff ff       	call   87a <putc>
+ 9b0:	83 c4 10             	add    $0x10,%esp
+ 9b3:	e9 0d 01 00 00       	jmp    ac5 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 9b8:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9bc:	0f 85 03 01 00 00    	jne    ac5 <printf+0x177>
+      if(c == 'd'){
+ 9c2:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9c6:	75 1e                	jne    9e6 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9c8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9cb:	8b 00                	mov    (%eax),%eax
+ 9cd:	6a 01                	push   $0x1
+ 9cf:	6a 0a                	push   $0xa
+ 9d1:	50                   	push   %eax
+ 9d2:	ff 75 08             	push   0x8(%ebp)
+ 9d5:	e8 c3 fe ff ff       	call   89d <printint>
+ 9da:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9dd:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9e1:	e9 d8 00 00 00       	jmp    abe <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 9e6:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9ea:	74 06                	je     9f2 <printf+0xa4>
+ 9ec:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9f0:	75 1e                	jne    a10 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 9f2:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9f5:	8b 00                	mov    (%eax),%eax
+ 9f7:	6a 00                	push   $0x0
+ 9f9:	6a 10                	push   $0x10
+ 9fb:	50                   	push   %eax
+ 9fc:	ff 75 08             	push   0x8(%ebp)
+ 9ff:	e8 99 fe ff ff       	call   89d <printint>
+ a04:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a07:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a0b:	e9 ae 00 00 00       	jmp    abe <printf+0x170>
+      } else if(c == 's'){
+ a10:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a14:	75 43                	jne    a59 <printf+0x10b>
+        s = (char*)*ap;
+ a16:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a19:	8b 00                	mov    (%eax),%eax
+ a1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a1e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a22:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a26:	75 25                	jne    a4d <printf+0xff>
+          s = "(null)";
+ a28:	c7 45 f4 e4 0d 00 00 	movl   $0xde4,-0xc(%ebp)
+        while(*s != 0){
+ a2f:	eb 1c                	jmp    a4d <printf+0xff>
+          putc(fd, *s);
+ a31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a34:	0f b6 00             	movzbl (%eax),%eax
+ a37:	0f be c0             	movsbl %al,%eax
+ a3a:	83 ec 08             	sub    $0x8,%esp
+ a3d:	50                   	push   %eax
+ a3e:	ff 75 08             	push   0x8(%ebp)
+ a41:	e8 34 fe ff ff       	call   87a <putc>
+ a46:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a49:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a50:	0f b6 00             	movzbl (%eax),%eax
+ a53:	84 c0                	test   %al,%al
+ a55:	75 da                	jne    a31 <printf+0xe3>
+ a57:	eb 65                	jmp    abe <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a59:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a5d:	75 1d                	jne    a7c <printf+0x12e>
+        putc(fd, *ap);
+ a5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a62:	8b 00                	mov    (%eax),%eax
+ a64:	0f be c0             	movsbl %al,%eax
+ a67:	83 ec 08             	sub    $0x8,%esp
+ a6a:	50                   	push   %eax
+ a6b:	ff 75 08             	push   0x8(%ebp)
+ a6e:	e8 07 fe ff ff       	call   87a <putc>
+ a73:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a76:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a7a:	eb 42                	jmp    abe <printf+0x170>
+      } else if(c == '%'){
+ a7c:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a80:	75 17                	jne    a99 <printf+0x14b>
+        putc(fd, c);
+ a82:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a85:	0f be c0             	movsbl %al,%eax
+ a88:	83 ec 08             	sub    $0x8,%esp
+ a8b:	50                   	push   %eax
+ a8c:	ff 75 08             	push   0x8(%ebp)
+ a8f:	e8 e6 fd ff ff       	call   87a <putc>
+ a94:	83 c4 10             	add    $0x10,%esp
+ a97:	eb 25                	jmp    abe <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a99:	83 ec 08             	sub    $0x8,%esp
+ a9c:	6a 25                	push   $0x25
+ a9e:	ff 75 08             	push   0x8(%ebp)
+ aa1:	e8 d4 fd ff ff       	call   87a <putc>
+ aa6:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ aa9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ aac:	0f be c0             	movsbl %al,%eax
+ aaf:	83 ec 08             	sub    $0x8,%esp
+ ab2:	50                   	push   %eax
+ ab3:	ff 75 08             	push   0x8(%ebp)
+ ab6:	e8 bf fd ff ff       	call   87a <putc>
+ abb:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ abe:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ac5:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ac9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ acc:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ acf:	01 d0                	add    %edx,%eax
+ ad1:	0f b6 00             	movzbl (%eax),%eax
+ ad4:	84 c0                	test   %al,%al
+ ad6:	0f 85 94 fe ff ff    	jne    970 <printf+0x22>
+    }
+  }
+}
+ adc:	90                   	nop
+ add:	90                   	nop
+ ade:	c9                   	leave
+ adf:	c3                   	ret
+
+00000ae0 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ ae0:	55                   	push   %ebp
+ ae1:	89 e5                	mov    %esp,%ebp
+ ae3:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ ae6:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae9:	83 e8 08             	sub    $0x8,%eax
+ aec:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ aef:	a1 48 15 00 00       	mov    0x1548,%eax
+ af4:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ af7:	eb 24                	jmp    b1d <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ af9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afc:	8b 00                	mov    (%eax),%eax
+ afe:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b01:	72 12                	jb     b15 <free+0x35>
+ b03:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b06:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b09:	72 24                	jb     b2f <free+0x4f>
+ b0b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0e:	8b 00                	mov    (%eax),%eax
+ b10:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b13:	72 1a                	jb     b2f <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b18:	8b 00                	mov    (%eax),%eax
+ b1a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b1d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b20:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b23:	73 d4                	jae    af9 <free+0x19>
+ b25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b2d:	73 ca                	jae    af9 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b2f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b32:	8b 40 04             	mov    0x4(%eax),%eax
+ b35:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b3c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b3f:	01 c2                	add    %eax,%edx
+ b41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b44:	8b 00                	mov    (%eax),%eax
+ b46:	39 c2                	cmp    %eax,%edx
+ b48:	75 24                	jne    b6e <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b4a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4d:	8b 50 04             	mov    0x4(%eax),%edx
+ b50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b53:	8b 00                	mov    (%eax),%eax
+ b55:	8b 40 04             	mov    0x4(%eax),%eax
+ b58:	01 c2                	add    %eax,%edx
+ b5a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5d:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b60:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b63:	8b 00                	mov    (%eax),%eax
+ b65:	8b 10                	mov    (%eax),%edx
+ b67:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b6a:	89 10                	mov    %edx,(%eax)
+ b6c:	eb 0a                	jmp    b78 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b6e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b71:	8b 10                	mov    (%eax),%edx
+ b73:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b76:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7b:	8b 40 04             	mov    0x4(%eax),%eax
+ b7e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b85:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b88:	01 d0                	add    %edx,%eax
+ b8a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b8d:	75 20                	jne    baf <free+0xcf>
+    p->s.size += bp->s.size;
+ b8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b92:	8b 50 04             	mov    0x4(%eax),%edx
+ b95:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b98:	8b 40 04             	mov    0x4(%eax),%eax
+ b9b:	01 c2                	add    %eax,%edx
+ b9d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba0:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ ba3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba6:	8b 10                	mov    (%eax),%edx
+ ba8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bab:	89 10                	mov    %edx,(%eax)
+ bad:	eb 08                	jmp    bb7 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ baf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb2:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ bb5:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ bb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bba:	a3 48 15 00 00       	mov    %eax,0x1548
+}
+ bbf:	90                   	nop
+ bc0:	c9                   	leave
+ bc1:	c3                   	ret
+
+00000bc2 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ bc2:	55                   	push   %ebp
+ bc3:	89 e5                	mov    %esp,%ebp
+ bc5:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ bc8:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bcf:	77 07                	ja     bd8 <morecore+0x16>
+    nu = 4096;
+ bd1:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ bd8:	8b 45 08             	mov    0x8(%ebp),%eax
+ bdb:	c1 e0 03             	shl    $0x3,%eax
+ bde:	83 ec 0c             	sub    $0xc,%esp
+ be1:	50                   	push   %eax
+ be2:	e8 11 fc ff ff       	call   7f8 <sbrk>
+ be7:	83 c4 10             	add    $0x10,%esp
+ bea:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ bed:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ bf1:	75 07                	jne    bfa <morecore+0x38>
+    return 0;
+ bf3:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf8:	eb 26                	jmp    c20 <morecore+0x5e>
+  hp = (Header*)p;
+ bfa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bfd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c00:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c03:	8b 55 08             	mov    0x8(%ebp),%edx
+ c06:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c09:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c0c:	83 c0 08             	add    $0x8,%eax
+ c0f:	83 ec 0c             	sub    $0xc,%esp
+ c12:	50                   	push   %eax
+ c13:	e8 c8 fe ff ff       	call   ae0 <free>
+ c18:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c1b:	a1 48 15 00 00       	mov    0x1548,%eax
+}
+ c20:	c9                   	leave
+ c21:	c3                   	ret
+
+00000c22 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c22:	55                   	push   %ebp
+ c23:	89 e5                	mov    %esp,%ebp
+ c25:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c28:	8b 45 08             	mov    0x8(%ebp),%eax
+ c2b:	83 c0 07             	add    $0x7,%eax
+ c2e:	c1 e8 03             	shr    $0x3,%eax
+ c31:	83 c0 01             	add    $0x1,%eax
+ c34:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c37:	a1 48 15 00 00       	mov    0x1548,%eax
+ c3c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c3f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c43:	75 23                	jne    c68 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c45:	c7 45 f0 40 15 00 00 	movl   $0x1540,-0x10(%ebp)
+ c4c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c4f:	a3 48 15 00 00       	mov    %eax,0x1548
+ c54:	a1 48 15 00 00       	mov    0x1548,%eax
+ c59:	a3 40 15 00 00       	mov    %eax,0x1540
+    base.s.size = 0;
+ c5e:	c7 05 44 15 00 00 00 	movl   $0x0,0x1544
+ c65:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c68:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c6b:	8b 00                	mov    (%eax),%eax
+ c6d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c73:	8b 40 04             	mov    0x4(%eax),%eax
+ c76:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c79:	72 4d                	jb     cc8 <malloc+0xa6>
+      if(p->s.size == nunits)
+ c7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c7e:	8b 40 04             	mov    0x4(%eax),%eax
+ c81:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c84:	75 0c                	jne    c92 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c86:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c89:	8b 10                	mov    (%eax),%edx
+ c8b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c8e:	89 10                	mov    %edx,(%eax)
+ c90:	eb 26                	jmp    cb8 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ c92:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c95:	8b 40 04             	mov    0x4(%eax),%eax
+ c98:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c9b:	89 c2                	mov    %eax,%edx
+ c9d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca0:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ca3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca6:	8b 40 04             	mov    0x4(%eax),%eax
+ ca9:	c1 e0 03             	shl    $0x3,%eax
+ cac:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ caf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb2:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ cb5:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ cb8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cbb:	a3 48 15 00 00       	mov    %eax,0x1548
+      return (void*)(p + 1);
+ cc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc3:	83 c0 08             	add    $0x8,%eax
+ cc6:	eb 3b                	jmp    d03 <malloc+0xe1>
+    }
+    if(p == freep)
+ cc8:	a1 48 15 00 00       	mov    0x1548,%eax
+ ccd:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cd0:	75 1e                	jne    cf0 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ cd2:	83 ec 0c             	sub    $0xc,%esp
+ cd5:	ff 75 ec             	push   -0x14(%ebp)
+ cd8:	e8 e5 fe ff ff       	call   bc2 <morecore>
+ cdd:	83 c4 10             	add    $0x10,%esp
+ ce0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ce3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ce7:	75 07                	jne    cf0 <malloc+0xce>
+        return 0;
+ ce9:	b8 00 00 00 00       	mov    $0x0,%eax
+ cee:	eb 13                	jmp    d03 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cf9:	8b 00                	mov    (%eax),%eax
+ cfb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ cfe:	e9 6d ff ff ff       	jmp    c70 <malloc+0x4e>
+  }
+}
+ d03:	c9                   	leave
+ d04:	c3                   	ret
+
+00000d05 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d05:	55                   	push   %ebp
+ d06:	89 e5                	mov    %esp,%ebp
+ d08:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ d0b:	83 ec 0c             	sub    $0xc,%esp
+ d0e:	68 00 10 00 00       	push   $0x1000
+ d13:	e8 0a ff ff ff       	call   c22 <malloc>
+ d18:	83 c4 10             	add    $0x10,%esp
+ d1b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d1e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d22:	75 07                	jne    d2b <thread_create+0x26>
+    return -1;
+ d24:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d29:	eb 2e                	jmp    d59 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d2b:	83 ec 04             	sub    $0x4,%esp
+ d2e:	ff 75 f4             	push   -0xc(%ebp)
+ d31:	ff 75 0c             	push   0xc(%ebp)
+ d34:	ff 75 08             	push   0x8(%ebp)
+ d37:	e8 ee fa ff ff       	call   82a <clone>
+ d3c:	83 c4 10             	add    $0x10,%esp
+ d3f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d42:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d46:	79 0e                	jns    d56 <thread_create+0x51>
+    free(stack);
+ d48:	83 ec 0c             	sub    $0xc,%esp
+ d4b:	ff 75 f4             	push   -0xc(%ebp)
+ d4e:	e8 8d fd ff ff       	call   ae0 <free>
+ d53:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d56:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ d59:	c9                   	leave
+ d5a:	c3                   	ret
+
+00000d5b <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ d5b:	55                   	push   %ebp
+ d5c:	89 e5                	mov    %esp,%ebp
+ d5e:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d61:	83 ec 0c             	sub    $0xc,%esp
+ d64:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ d67:	50                   	push   %eax
+ d68:	e8 c7 fa ff ff       	call   834 <join>
+ d6d:	83 c4 10             	add    $0x10,%esp
+ d70:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d73:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d77:	78 0f                	js     d88 <thread_join+0x2d>
+    free(stack);
+ d79:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d7c:	83 ec 0c             	sub    $0xc,%esp
+ d7f:	50                   	push   %eax
+ d80:	e8 5b fd ff ff       	call   ae0 <free>
+ d85:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d8b:	c9                   	leave
+ d8c:	c3                   	ret
@@ -0,0 +1,27 @@
+// Print usage of the kernel object caches.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "kmstat.h"
+
+#define NCACHE 16
+
+struct kmstat st[NCACHE];
+
+int
+main(int argc, char *argv[])
+{
+  int i, n;
+
+  if((n = kmstat(st, NCACHE)) < 0){
+    printf(2, "kmstat: failed\n");
+    exit();
+  }
+  printf(1, "name size perslab slabs active cached allocs\n");
+  for(i = 0; i < n; i++)
+    printf(1, "%s %d %d %d %d %d %d\n", st[i].name, st[i].size,
+           st[i].perslab, st[i].slabs, st[i].active, st[i].cached,
+           st[i].allocs);
+  exit();
+}
@@ -0,0 +1,10 @@
+// Usage of one kernel object cache, as reported by kmstat().
+struct kmstat {
+  char name[16];  // Cache name
+  uint size;      // Object size in bytes
+  uint perslab;   // Objects per slab page
+  uint slabs;     // Pages held by the cache
+  uint active;    // Objects currently allocated
+  uint cached;    // Free objects parked in per-CPU magazines
+  uint allocs;    // Allocations since boot
+};
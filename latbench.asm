@@ -0,0 +1,2163 @@
+
+_latbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+
+uint lat[MAXSAMPLES];
+
+static inline uint
+rdtsc(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 10             	sub    $0x10,%esp
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+       6:	0f 31                	rdtsc
+       8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+       b:	89 55 f8             	mov    %edx,-0x8(%ebp)
+  return lo;
+       e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+      11:	c9                   	leave
+      12:	c3                   	ret
+
+00000013 <hog>:
+
+void
+hog(void)
+{
+      13:	55                   	push   %ebp
+      14:	89 e5                	mov    %esp,%ebp
+      16:	83 ec 10             	sub    $0x10,%esp
+  volatile uint x;
+
+  for(x = 0;; x++)
+      19:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+      20:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      23:	83 c0 01             	add    $0x1,%eax
+      26:	89 45 fc             	mov    %eax,-0x4(%ebp)
+      29:	90                   	nop
+      2a:	eb f4                	jmp    20 <hog+0xd>
+
+0000002c <main>:
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+      2c:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      30:	83 e4 f0             	and    $0xfffffff0,%esp
+      33:	ff 71 fc             	push   -0x4(%ecx)
+      36:	55                   	push   %ebp
+      37:	89 e5                	mov    %esp,%ebp
+      39:	56                   	push   %esi
+      3a:	53                   	push   %ebx
+      3b:	51                   	push   %ecx
+      3c:	81 ec cc 00 00 00    	sub    $0xcc,%esp
+      42:	89 cb                	mov    %ecx,%ebx
+  int nhogs, n, nice, i, j, pid, ping[2], pong[2], pids[MAXHOGS];
+  uint t0, v;
+  char c;
+
+  nhogs = 4;
+      44:	c7 45 e4 04 00 00 00 	movl   $0x4,-0x1c(%ebp)
+  n = 200;
+      4b:	c7 45 e0 c8 00 00 00 	movl   $0xc8,-0x20(%ebp)
+  nice = 0;
+      52:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+  if(argc > 1)
+      59:	83 3b 01             	cmpl   $0x1,(%ebx)
+      5c:	7e 17                	jle    75 <main+0x49>
+    nhogs = atoi(argv[1]);
+      5e:	8b 43 04             	mov    0x4(%ebx),%eax
+      61:	83 c0 04             	add    $0x4,%eax
+      64:	8b 00                	mov    (%eax),%eax
+      66:	83 ec 0c             	sub    $0xc,%esp
+      69:	50                   	push   %eax
+      6a:	e8 9b 05 00 00       	call   60a <atoi>
+      6f:	83 c4 10             	add    $0x10,%esp
+      72:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(argc > 2)
+      75:	83 3b 02             	cmpl   $0x2,(%ebx)
+      78:	7e 17                	jle    91 <main+0x65>
+    n = atoi(argv[2]);
+      7a:	8b 43 04             	mov    0x4(%ebx),%eax
+      7d:	83 c0 08             	add    $0x8,%eax
+      80:	8b 00                	mov    (%eax),%eax
+      82:	83 ec 0c             	sub    $0xc,%esp
+      85:	50                   	push   %eax
+      86:	e8 7f 05 00 00       	call   60a <atoi>
+      8b:	83 c4 10             	add    $0x10,%esp
+      8e:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(argc > 3)
+      91:	83 3b 03             	cmpl   $0x3,(%ebx)
+      94:	7e 17                	jle    ad <main+0x81>
+    nice = atoi(argv[3]);
+      96:	8b 43 04             	mov    0x4(%ebx),%eax
+      99:	83 c0 0c             	add    $0xc,%eax
+      9c:	8b 00                	mov    (%eax),%eax
+      9e:	83 ec 0c             	sub    $0xc,%esp
+      a1:	50                   	push   %eax
+      a2:	e8 63 05 00 00       	call   60a <atoi>
+      a7:	83 c4 10             	add    $0x10,%esp
+      aa:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if(nhogs > MAXHOGS)
+      ad:	83 7d e4 20          	cmpl   $0x20,-0x1c(%ebp)
+      b1:	7e 07                	jle    ba <main+0x8e>
+    nhogs = MAXHOGS;
+      b3:	c7 45 e4 20 00 00 00 	movl   $0x20,-0x1c(%ebp)
+  if(n > MAXSAMPLES)
+      ba:	81 7d e0 e8 03 00 00 	cmpl   $0x3e8,-0x20(%ebp)
+      c1:	7e 07                	jle    ca <main+0x9e>
+    n = MAXSAMPLES;
+      c3:	c7 45 e0 e8 03 00 00 	movl   $0x3e8,-0x20(%ebp)
+
+  for(i = 0; i < nhogs; i++){
+      ca:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+      d1:	eb 64                	jmp    137 <main+0x10b>
+    if((pids[i] = fork()) < 0){
+      d3:	e8 66 09 00 00       	call   a3e <fork>
+      d8:	8b 55 d8             	mov    -0x28(%ebp),%edx
+      db:	89 84 95 38 ff ff ff 	mov    %eax,-0xc8(%ebp,%edx,4)
+      e2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+      e5:	8b 84 85 38 ff ff ff 	mov    -0xc8(%ebp,%eax,4),%eax
+      ec:	85 c0                	test   %eax,%eax
+      ee:	79 17                	jns    107 <main+0xdb>
+      printf(2, "latbench: fork failed\n");
+      f0:	83 ec 08             	sub    $0x8,%esp
+      f3:	68 5c 10 00 00       	push   $0x105c
+      f8:	6a 02                	push   $0x2
+      fa:	e8 1c 0b 00 00       	call   c1b <printf>
+      ff:	83 c4 10             	add    $0x10,%esp
+      exit();
+     102:	e8 3e 09 00 00       	call   a45 <exit>
+    }
+    if(pids[i] == 0)
+     107:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     10a:	8b 84 85 38 ff ff ff 	mov    -0xc8(%ebp,%eax,4),%eax
+     111:	85 c0                	test   %eax,%eax
+     113:	75 05                	jne    11a <main+0xee>
+      hog();
+     115:	e8 f9 fe ff ff       	call   13 <hog>
+    setpriority(pids[i], nice);
+     11a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     11d:	8b 84 85 38 ff ff ff 	mov    -0xc8(%ebp,%eax,4),%eax
+     124:	83 ec 08             	sub    $0x8,%esp
+     127:	ff 75 dc             	push   -0x24(%ebp)
+     12a:	50                   	push   %eax
+     12b:	e8 bd 09 00 00       	call   aed <setpriority>
+     130:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nhogs; i++){
+     133:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+     137:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     13a:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     13d:	7c 94                	jl     d3 <main+0xa7>
+  }
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+     13f:	83 ec 0c             	sub    $0xc,%esp
+     142:	8d 45 c0             	lea    -0x40(%ebp),%eax
+     145:	50                   	push   %eax
+     146:	e8 08 09 00 00       	call   a53 <pipe>
+     14b:	83 c4 10             	add    $0x10,%esp
+     14e:	85 c0                	test   %eax,%eax
+     150:	78 13                	js     165 <main+0x139>
+     152:	83 ec 0c             	sub    $0xc,%esp
+     155:	8d 45 b8             	lea    -0x48(%ebp),%eax
+     158:	50                   	push   %eax
+     159:	e8 f5 08 00 00       	call   a53 <pipe>
+     15e:	83 c4 10             	add    $0x10,%esp
+     161:	85 c0                	test   %eax,%eax
+     163:	79 17                	jns    17c <main+0x150>
+    printf(2, "latbench: pipe failed\n");
+     165:	83 ec 08             	sub    $0x8,%esp
+     168:	68 73 10 00 00       	push   $0x1073
+     16d:	6a 02                	push   $0x2
+     16f:	e8 a7 0a 00 00       	call   c1b <printf>
+     174:	83 c4 10             	add    $0x10,%esp
+    exit();
+     177:	e8 c9 08 00 00       	call   a45 <exit>
+  }
+  if((pid = fork()) < 0){
+     17c:	e8 bd 08 00 00       	call   a3e <fork>
+     181:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     184:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+     188:	79 17                	jns    1a1 <main+0x175>
+    printf(2, "latbench: fork failed\n");
+     18a:	83 ec 08             	sub    $0x8,%esp
+     18d:	68 5c 10 00 00       	push   $0x105c
+     192:	6a 02                	push   $0x2
+     194:	e8 82 0a 00 00       	call   c1b <printf>
+     199:	83 c4 10             	add    $0x10,%esp
+    exit();
+     19c:	e8 a4 08 00 00       	call   a45 <exit>
+  }
+  if(pid == 0){
+     1a1:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+     1a5:	75 5a                	jne    201 <main+0x1d5>
+    // Keep only our own ends, so read() sees EOF when the
+    // parent closes ping[1].
+    close(ping[1]);
+     1a7:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     1aa:	83 ec 0c             	sub    $0xc,%esp
+     1ad:	50                   	push   %eax
+     1ae:	e8 b5 08 00 00       	call   a68 <close>
+     1b3:	83 c4 10             	add    $0x10,%esp
+    close(pong[0]);
+     1b6:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     1b9:	83 ec 0c             	sub    $0xc,%esp
+     1bc:	50                   	push   %eax
+     1bd:	e8 a6 08 00 00       	call   a68 <close>
+     1c2:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+     1c5:	eb 18                	jmp    1df <main+0x1b3>
+      write(pong[1], &c, 1);
+     1c7:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     1ca:	83 ec 04             	sub    $0x4,%esp
+     1cd:	6a 01                	push   $0x1
+     1cf:	8d 95 37 ff ff ff    	lea    -0xc9(%ebp),%edx
+     1d5:	52                   	push   %edx
+     1d6:	50                   	push   %eax
+     1d7:	e8 85 08 00 00       	call   a61 <write>
+     1dc:	83 c4 10             	add    $0x10,%esp
+    while(read(ping[0], &c, 1) == 1)
+     1df:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     1e2:	83 ec 04             	sub    $0x4,%esp
+     1e5:	6a 01                	push   $0x1
+     1e7:	8d 95 37 ff ff ff    	lea    -0xc9(%ebp),%edx
+     1ed:	52                   	push   %edx
+     1ee:	50                   	push   %eax
+     1ef:	e8 66 08 00 00       	call   a5a <read>
+     1f4:	83 c4 10             	add    $0x10,%esp
+     1f7:	83 f8 01             	cmp    $0x1,%eax
+     1fa:	74 cb                	je     1c7 <main+0x19b>
+    exit();
+     1fc:	e8 44 08 00 00       	call   a45 <exit>
+  }
+  close(ping[0]);
+     201:	8b 45 c0             	mov    -0x40(%ebp),%eax
+     204:	83 ec 0c             	sub    $0xc,%esp
+     207:	50                   	push   %eax
+     208:	e8 5b 08 00 00       	call   a68 <close>
+     20d:	83 c4 10             	add    $0x10,%esp
+  close(pong[1]);
+     210:	8b 45 bc             	mov    -0x44(%ebp),%eax
+     213:	83 ec 0c             	sub    $0xc,%esp
+     216:	50                   	push   %eax
+     217:	e8 4c 08 00 00       	call   a68 <close>
+     21c:	83 c4 10             	add    $0x10,%esp
+
+  c = 'x';
+     21f:	c6 85 37 ff ff ff 78 	movb   $0x78,-0xc9(%ebp)
+  for(i = 0; i < n; i++){
+     226:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+     22d:	eb 76                	jmp    2a5 <main+0x279>
+    sleep(1);
+     22f:	83 ec 0c             	sub    $0xc,%esp
+     232:	6a 01                	push   $0x1
+     234:	e8 96 08 00 00       	call   acf <sleep>
+     239:	83 c4 10             	add    $0x10,%esp
+    t0 = rdtsc();
+     23c:	e8 bf fd ff ff       	call   0 <rdtsc>
+     241:	89 45 cc             	mov    %eax,-0x34(%ebp)
+    write(ping[1], &c, 1);
+     244:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     247:	83 ec 04             	sub    $0x4,%esp
+     24a:	6a 01                	push   $0x1
+     24c:	8d 95 37 ff ff ff    	lea    -0xc9(%ebp),%edx
+     252:	52                   	push   %edx
+     253:	50                   	push   %eax
+     254:	e8 08 08 00 00       	call   a61 <write>
+     259:	83 c4 10             	add    $0x10,%esp
+    if(read(pong[0], &c, 1) != 1){
+     25c:	8b 45 b8             	mov    -0x48(%ebp),%eax
+     25f:	83 ec 04             	sub    $0x4,%esp
+     262:	6a 01                	push   $0x1
+     264:	8d 95 37 ff ff ff    	lea    -0xc9(%ebp),%edx
+     26a:	52                   	push   %edx
+     26b:	50                   	push   %eax
+     26c:	e8 e9 07 00 00       	call   a5a <read>
+     271:	83 c4 10             	add    $0x10,%esp
+     274:	83 f8 01             	cmp    $0x1,%eax
+     277:	74 14                	je     28d <main+0x261>
+      printf(2, "latbench: short read\n");
+     279:	83 ec 08             	sub    $0x8,%esp
+     27c:	68 8a 10 00 00       	push   $0x108a
+     281:	6a 02                	push   $0x2
+     283:	e8 93 09 00 00       	call   c1b <printf>
+     288:	83 c4 10             	add    $0x10,%esp
+      break;
+     28b:	eb 20                	jmp    2ad <main+0x281>
+    }
+    lat[i] = rdtsc() - t0;
+     28d:	e8 6e fd ff ff       	call   0 <rdtsc>
+     292:	2b 45 cc             	sub    -0x34(%ebp),%eax
+     295:	89 c2                	mov    %eax,%edx
+     297:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     29a:	89 14 85 00 16 00 00 	mov    %edx,0x1600(,%eax,4)
+  for(i = 0; i < n; i++){
+     2a1:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+     2a5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     2a8:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+     2ab:	7c 82                	jl     22f <main+0x203>
+  }
+  n = i;
+     2ad:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     2b0:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  close(ping[1]);
+     2b3:	8b 45 c4             	mov    -0x3c(%ebp),%eax
+     2b6:	83 ec 0c             	sub    $0xc,%esp
+     2b9:	50                   	push   %eax
+     2ba:	e8 a9 07 00 00       	call   a68 <close>
+     2bf:	83 c4 10             	add    $0x10,%esp
+  wait();
+     2c2:	e8 85 07 00 00       	call   a4c <wait>
+
+  for(i = 0; i < nhogs; i++){
+     2c7:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+     2ce:	eb 1f                	jmp    2ef <main+0x2c3>
+    kill(pids[i]);
+     2d0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     2d3:	8b 84 85 38 ff ff ff 	mov    -0xc8(%ebp,%eax,4),%eax
+     2da:	83 ec 0c             	sub    $0xc,%esp
+     2dd:	50                   	push   %eax
+     2de:	e8 8c 07 00 00       	call   a6f <kill>
+     2e3:	83 c4 10             	add    $0x10,%esp
+    wait();
+     2e6:	e8 61 07 00 00       	call   a4c <wait>
+  for(i = 0; i < nhogs; i++){
+     2eb:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+     2ef:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     2f2:	3b 45 e4             	cmp    -0x1c(%ebp),%eax
+     2f5:	7c d9                	jl     2d0 <main+0x2a4>
+  }
+
+  // Insertion sort; n is small.
+  for(i = 1; i < n; i++){
+     2f7:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+     2fe:	eb 59                	jmp    359 <main+0x32d>
+    v = lat[i];
+     300:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     303:	8b 04 85 00 16 00 00 	mov    0x1600(,%eax,4),%eax
+     30a:	89 45 c8             	mov    %eax,-0x38(%ebp)
+    for(j = i; j > 0 && lat[j-1] > v; j--)
+     30d:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     310:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+     313:	eb 1b                	jmp    330 <main+0x304>
+      lat[j] = lat[j-1];
+     315:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     318:	83 e8 01             	sub    $0x1,%eax
+     31b:	8b 14 85 00 16 00 00 	mov    0x1600(,%eax,4),%edx
+     322:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     325:	89 14 85 00 16 00 00 	mov    %edx,0x1600(,%eax,4)
+    for(j = i; j > 0 && lat[j-1] > v; j--)
+     32c:	83 6d d4 01          	subl   $0x1,-0x2c(%ebp)
+     330:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     334:	7e 12                	jle    348 <main+0x31c>
+     336:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     339:	83 e8 01             	sub    $0x1,%eax
+     33c:	8b 04 85 00 16 00 00 	mov    0x1600(,%eax,4),%eax
+     343:	39 45 c8             	cmp    %eax,-0x38(%ebp)
+     346:	72 cd                	jb     315 <main+0x2e9>
+    lat[j] = v;
+     348:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+     34b:	8b 55 c8             	mov    -0x38(%ebp),%edx
+     34e:	89 14 85 00 16 00 00 	mov    %edx,0x1600(,%eax,4)
+  for(i = 1; i < n; i++){
+     355:	83 45 d8 01          	addl   $0x1,-0x28(%ebp)
+     359:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     35c:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+     35f:	7c 9f                	jl     300 <main+0x2d4>
+  }
+  if(n == 0)
+     361:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     365:	75 05                	jne    36c <main+0x340>
+    exit();
+     367:	e8 d9 06 00 00       	call   a45 <exit>
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+         "p50 %d p90 %d p99 %d max %d\n", nhogs, n,
+         lat[n/2], lat[n*9/10], lat[n*99/100], lat[n-1]);
+     36c:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     36f:	83 e8 01             	sub    $0x1,%eax
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+     372:	8b 34 85 00 16 00 00 	mov    0x1600(,%eax,4),%esi
+         lat[n/2], lat[n*9/10], lat[n*99/100], lat[n-1]);
+     379:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     37c:	6b c8 63             	imul   $0x63,%eax,%ecx
+     37f:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+     384:	89 c8                	mov    %ecx,%eax
+     386:	f7 ea                	imul   %edx
+     388:	89 d0                	mov    %edx,%eax
+     38a:	c1 f8 05             	sar    $0x5,%eax
+     38d:	c1 f9 1f             	sar    $0x1f,%ecx
+     390:	89 ca                	mov    %ecx,%edx
+     392:	29 d0                	sub    %edx,%eax
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+     394:	8b 1c 85 00 16 00 00 	mov    0x1600(,%eax,4),%ebx
+         lat[n/2], lat[n*9/10], lat[n*99/100], lat[n-1]);
+     39b:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     39e:	89 d0                	mov    %edx,%eax
+     3a0:	c1 e0 03             	shl    $0x3,%eax
+     3a3:	8d 0c 10             	lea    (%eax,%edx,1),%ecx
+     3a6:	ba 67 66 66 66       	mov    $0x66666667,%edx
+     3ab:	89 c8                	mov    %ecx,%eax
+     3ad:	f7 ea                	imul   %edx
+     3af:	89 d0                	mov    %edx,%eax
+     3b1:	c1 f8 02             	sar    $0x2,%eax
+     3b4:	c1 f9 1f             	sar    $0x1f,%ecx
+     3b7:	89 ca                	mov    %ecx,%edx
+     3b9:	29 d0                	sub    %edx,%eax
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+     3bb:	8b 14 85 00 16 00 00 	mov    0x1600(,%eax,4),%edx
+         lat[n/2], lat[n*9/10], lat[n*99/100], lat[n-1]);
+     3c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     3c5:	89 c1                	mov    %eax,%ecx
+     3c7:	c1 e9 1f             	shr    $0x1f,%ecx
+     3ca:	01 c8                	add    %ecx,%eax
+     3cc:	d1 f8                	sar    %eax
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+     3ce:	8b 04 85 00 16 00 00 	mov    0x1600(,%eax,4),%eax
+     3d5:	56                   	push   %esi
+     3d6:	53                   	push   %ebx
+     3d7:	52                   	push   %edx
+     3d8:	50                   	push   %eax
+     3d9:	ff 75 e0             	push   -0x20(%ebp)
+     3dc:	ff 75 e4             	push   -0x1c(%ebp)
+     3df:	68 a0 10 00 00       	push   $0x10a0
+     3e4:	6a 01                	push   $0x1
+     3e6:	e8 30 08 00 00       	call   c1b <printf>
+     3eb:	83 c4 20             	add    $0x20,%esp
+  exit();
+     3ee:	e8 52 06 00 00       	call   a45 <exit>
+
+000003f3 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+     3f3:	55                   	push   %ebp
+     3f4:	89 e5                	mov    %esp,%ebp
+     3f6:	57                   	push   %edi
+     3f7:	53                   	push   %ebx
+char*
+     3f8:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     3fb:	8b 55 10             	mov    0x10(%ebp),%edx
+     3fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+     401:	89 cb                	mov    %ecx,%ebx
+     403:	89 df                	mov    %ebx,%edi
+     405:	89 d1                	mov    %edx,%ecx
+     407:	fc                   	cld
+     408:	f3 aa                	rep stos %al,%es:(%edi)
+     40a:	89 ca                	mov    %ecx,%edx
+     40c:	89 fb                	mov    %edi,%ebx
+     40e:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     411:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     414:	90                   	nop
+     415:	5b                   	pop    %ebx
+     416:	5f                   	pop    %edi
+     417:	5d                   	pop    %ebp
+     418:	c3                   	ret
+
+00000419 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+     419:	55                   	push   %ebp
+     41a:	89 e5                	mov    %esp,%ebp
+     41c:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+     41f:	8b 55 08             	mov    0x8(%ebp),%edx
+     422:	8b 45 0c             	mov    0xc(%ebp),%eax
+     425:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     428:	f0 87 02             	lock xchg %eax,(%edx)
+     42b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+     42e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+     431:	c9                   	leave
+     432:	c3                   	ret
+
+00000433 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+     433:	55                   	push   %ebp
+     434:	89 e5                	mov    %esp,%ebp
+     436:	53                   	push   %ebx
+     437:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+     43a:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     43d:	8b 55 10             	mov    0x10(%ebp),%edx
+     440:	8b 45 0c             	mov    0xc(%ebp),%eax
+     443:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     446:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     44a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+     44d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+     450:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     453:	c9                   	leave
+     454:	c3                   	ret
+
+00000455 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+     455:	55                   	push   %ebp
+     456:	89 e5                	mov    %esp,%ebp
+     458:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+     45b:	0f 31                	rdtsc
+     45d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     460:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+     463:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     466:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+     469:	c9                   	leave
+     46a:	c3                   	ret
+
+0000046b <strcpy>:
+{
+     46b:	55                   	push   %ebp
+     46c:	89 e5                	mov    %esp,%ebp
+     46e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     471:	8b 45 08             	mov    0x8(%ebp),%eax
+     474:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     477:	90                   	nop
+     478:	8b 55 0c             	mov    0xc(%ebp),%edx
+     47b:	8d 42 01             	lea    0x1(%edx),%eax
+     47e:	89 45 0c             	mov    %eax,0xc(%ebp)
+     481:	8b 45 08             	mov    0x8(%ebp),%eax
+     484:	8d 48 01             	lea    0x1(%eax),%ecx
+     487:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     48a:	0f b6 12             	movzbl (%edx),%edx
+     48d:	88 10                	mov    %dl,(%eax)
+     48f:	0f b6 00             	movzbl (%eax),%eax
+     492:	84 c0                	test   %al,%al
+     494:	75 e2                	jne    478 <strcpy+0xd>
+  return os;
+     496:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     499:	c9                   	leave
+     49a:	c3                   	ret
+
+0000049b <strcmp>:
+{
+     49b:	55                   	push   %ebp
+     49c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     49e:	eb 08                	jmp    4a8 <strcmp+0xd>
+    p++, q++;
+     4a0:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     4a4:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     4a8:	8b 45 08             	mov    0x8(%ebp),%eax
+     4ab:	0f b6 00             	movzbl (%eax),%eax
+     4ae:	84 c0                	test   %al,%al
+     4b0:	74 10                	je     4c2 <strcmp+0x27>
+     4b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4b5:	0f b6 10             	movzbl (%eax),%edx
+     4b8:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4bb:	0f b6 00             	movzbl (%eax),%eax
+     4be:	38 c2                	cmp    %al,%dl
+     4c0:	74 de                	je     4a0 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     4c2:	8b 45 08             	mov    0x8(%ebp),%eax
+     4c5:	0f b6 00             	movzbl (%eax),%eax
+     4c8:	0f b6 d0             	movzbl %al,%edx
+     4cb:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4ce:	0f b6 00             	movzbl (%eax),%eax
+     4d1:	0f b6 c0             	movzbl %al,%eax
+     4d4:	29 c2                	sub    %eax,%edx
+     4d6:	89 d0                	mov    %edx,%eax
+}
+     4d8:	5d                   	pop    %ebp
+     4d9:	c3                   	ret
+
+000004da <strlen>:
+{
+     4da:	55                   	push   %ebp
+     4db:	89 e5                	mov    %esp,%ebp
+     4dd:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     4e0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     4e7:	eb 04                	jmp    4ed <strlen+0x13>
+     4e9:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     4ed:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     4f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     4f3:	01 d0                	add    %edx,%eax
+     4f5:	0f b6 00             	movzbl (%eax),%eax
+     4f8:	84 c0                	test   %al,%al
+     4fa:	75 ed                	jne    4e9 <strlen+0xf>
+  return n;
+     4fc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     4ff:	c9                   	leave
+     500:	c3                   	ret
+
+00000501 <memset>:
+{
+     501:	55                   	push   %ebp
+     502:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     504:	8b 45 10             	mov    0x10(%ebp),%eax
+     507:	50                   	push   %eax
+     508:	ff 75 0c             	push   0xc(%ebp)
+     50b:	ff 75 08             	push   0x8(%ebp)
+     50e:	e8 e0 fe ff ff       	call   3f3 <stosb>
+     513:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     516:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     519:	c9                   	leave
+     51a:	c3                   	ret
+
+0000051b <strchr>:
+{
+     51b:	55                   	push   %ebp
+     51c:	89 e5                	mov    %esp,%ebp
+     51e:	83 ec 04             	sub    $0x4,%esp
+     521:	8b 45 0c             	mov    0xc(%ebp),%eax
+     524:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     527:	eb 14                	jmp    53d <strchr+0x22>
+    if(*s == c)
+     529:	8b 45 08             	mov    0x8(%ebp),%eax
+     52c:	0f b6 00             	movzbl (%eax),%eax
+     52f:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     532:	75 05                	jne    539 <strchr+0x1e>
+      return (char*)s;
+     534:	8b 45 08             	mov    0x8(%ebp),%eax
+     537:	eb 13                	jmp    54c <strchr+0x31>
+  for(; *s; s++)
+     539:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     53d:	8b 45 08             	mov    0x8(%ebp),%eax
+     540:	0f b6 00             	movzbl (%eax),%eax
+     543:	84 c0                	test   %al,%al
+     545:	75 e2                	jne    529 <strchr+0xe>
+  return 0;
+     547:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     54c:	c9                   	leave
+     54d:	c3                   	ret
+
+0000054e <gets>:
+{
+     54e:	55                   	push   %ebp
+     54f:	89 e5                	mov    %esp,%ebp
+     551:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     554:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     55b:	eb 42                	jmp    59f <gets+0x51>
+    cc = read(0, &c, 1);
+     55d:	83 ec 04             	sub    $0x4,%esp
+     560:	6a 01                	push   $0x1
+     562:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     565:	50                   	push   %eax
+     566:	6a 00                	push   $0x0
+     568:	e8 ed 04 00 00       	call   a5a <read>
+     56d:	83 c4 10             	add    $0x10,%esp
+     570:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     573:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     577:	7e 33                	jle    5ac <gets+0x5e>
+    buf[i++] = c;
+     579:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     57c:	8d 50 01             	lea    0x1(%eax),%edx
+     57f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     582:	89 c2                	mov    %eax,%edx
+     584:	8b 45 08             	mov    0x8(%ebp),%eax
+     587:	01 c2                	add    %eax,%edx
+     589:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     58d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     58f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     593:	3c 0a                	cmp    $0xa,%al
+     595:	74 16                	je     5ad <gets+0x5f>
+     597:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     59b:	3c 0d                	cmp    $0xd,%al
+     59d:	74 0e                	je     5ad <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     59f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     5a2:	83 c0 01             	add    $0x1,%eax
+     5a5:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     5a8:	7f b3                	jg     55d <gets+0xf>
+     5aa:	eb 01                	jmp    5ad <gets+0x5f>
+      break;
+     5ac:	90                   	nop
+  buf[i] = '\0';
+     5ad:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b3:	01 d0                	add    %edx,%eax
+     5b5:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     5b8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5bb:	c9                   	leave
+     5bc:	c3                   	ret
+
+000005bd <stat>:
+{
+     5bd:	55                   	push   %ebp
+     5be:	89 e5                	mov    %esp,%ebp
+     5c0:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+     5c3:	83 ec 08             	sub    $0x8,%esp
+     5c6:	6a 00                	push   $0x0
+     5c8:	ff 75 08             	push   0x8(%ebp)
+     5cb:	e8 ad 04 00 00       	call   a7d <open>
+     5d0:	83 c4 10             	add    $0x10,%esp
+     5d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     5d6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     5da:	79 07                	jns    5e3 <stat+0x26>
+    return -1;
+     5dc:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     5e1:	eb 25                	jmp    608 <stat+0x4b>
+  r = fstat(fd, st);
+     5e3:	83 ec 08             	sub    $0x8,%esp
+     5e6:	ff 75 0c             	push   0xc(%ebp)
+     5e9:	ff 75 f4             	push   -0xc(%ebp)
+     5ec:	e8 a1 04 00 00       	call   a92 <fstat>
+     5f1:	83 c4 10             	add    $0x10,%esp
+     5f4:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     5f7:	83 ec 0c             	sub    $0xc,%esp
+     5fa:	ff 75 f4             	push   -0xc(%ebp)
+     5fd:	e8 66 04 00 00       	call   a68 <close>
+     602:	83 c4 10             	add    $0x10,%esp
+  return r;
+     605:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     608:	c9                   	leave
+     609:	c3                   	ret
+
+0000060a <atoi>:
+{
+     60a:	55                   	push   %ebp
+     60b:	89 e5                	mov    %esp,%ebp
+     60d:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+     610:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     617:	eb 25                	jmp    63e <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     619:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     61c:	89 d0                	mov    %edx,%eax
+     61e:	c1 e0 02             	shl    $0x2,%eax
+     621:	01 d0                	add    %edx,%eax
+     623:	01 c0                	add    %eax,%eax
+     625:	89 c1                	mov    %eax,%ecx
+     627:	8b 45 08             	mov    0x8(%ebp),%eax
+     62a:	8d 50 01             	lea    0x1(%eax),%edx
+     62d:	89 55 08             	mov    %edx,0x8(%ebp)
+     630:	0f b6 00             	movzbl (%eax),%eax
+     633:	0f be c0             	movsbl %al,%eax
+     636:	01 c8                	add    %ecx,%eax
+     638:	83 e8 30             	sub    $0x30,%eax
+     63b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     63e:	8b 45 08             	mov    0x8(%ebp),%eax
+     641:	0f b6 00             	movzbl (%eax),%eax
+     644:	3c 2f                	cmp    $0x2f,%al
+     646:	7e 0a                	jle    652 <atoi+0x48>
+     648:	8b 45 08             	mov    0x8(%ebp),%eax
+     64b:	0f b6 00             	movzbl (%eax),%eax
+     64e:	3c 39                	cmp    $0x39,%al
+     650:	7e c7                	jle    619 <atoi+0xf>
+  return n;
+     652:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     655:	c9                   	leave
+     656:	c3                   	ret
+
+00000657 <memmove>:
+{
+     657:	55                   	push   %ebp
+     658:	89 e5                	mov    %esp,%ebp
+     65a:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+     65d:	8b 45 08             	mov    0x8(%ebp),%eax
+     660:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     663:	8b 45 0c             	mov    0xc(%ebp),%eax
+     666:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     669:	eb 17                	jmp    682 <memmove+0x2b>
+    *dst++ = *src++;
+     66b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     66e:	8d 42 01             	lea    0x1(%edx),%eax
+     671:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     674:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     677:	8d 48 01             	lea    0x1(%eax),%ecx
+     67a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     67d:	0f b6 12             	movzbl (%edx),%edx
+     680:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     682:	8b 45 10             	mov    0x10(%ebp),%eax
+     685:	8d 50 ff             	lea    -0x1(%eax),%edx
+     688:	89 55 10             	mov    %edx,0x10(%ebp)
+     68b:	85 c0                	test   %eax,%eax
+     68d:	7f dc                	jg     66b <memmove+0x14>
+  return vdst;
+     68f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     692:	c9                   	leave
+     693:	c3                   	ret
+
+00000694 <mutex_init>:
+{
+     694:	55                   	push   %ebp
+     695:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     697:	8b 45 08             	mov    0x8(%ebp),%eax
+     69a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     6a0:	90                   	nop
+     6a1:	5d                   	pop    %ebp
+     6a2:	c3                   	ret
+
+000006a3 <mutex_lock>:
+{
+     6a3:	55                   	push   %ebp
+     6a4:	89 e5                	mov    %esp,%ebp
+     6a6:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     6a9:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ac:	6a 01                	push   $0x1
+     6ae:	6a 00                	push   $0x0
+     6b0:	50                   	push   %eax
+     6b1:	e8 7d fd ff ff       	call   433 <cmpxchg>
+     6b6:	83 c4 0c             	add    $0xc,%esp
+     6b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     6bc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     6c0:	74 46                	je     708 <mutex_lock+0x65>
+  if(c != 2)
+     6c2:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     6c6:	74 38                	je     700 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+     6c8:	8b 45 08             	mov    0x8(%ebp),%eax
+     6cb:	6a 02                	push   $0x2
+     6cd:	50                   	push   %eax
+     6ce:	e8 46 fd ff ff       	call   419 <xchg>
+     6d3:	83 c4 08             	add    $0x8,%esp
+     6d6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+     6d9:	eb 25                	jmp    700 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+     6db:	8b 45 08             	mov    0x8(%ebp),%eax
+     6de:	83 ec 08             	sub    $0x8,%esp
+     6e1:	6a 02                	push   $0x2
+     6e3:	50                   	push   %eax
+     6e4:	e8 22 04 00 00       	call   b0b <futex_wait>
+     6e9:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+     6ec:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ef:	83 ec 08             	sub    $0x8,%esp
+     6f2:	6a 02                	push   $0x2
+     6f4:	50                   	push   %eax
+     6f5:	e8 1f fd ff ff       	call   419 <xchg>
+     6fa:	83 c4 10             	add    $0x10,%esp
+     6fd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+     700:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     704:	75 d5                	jne    6db <mutex_lock+0x38>
+     706:	eb 01                	jmp    709 <mutex_lock+0x66>
+    return;
+     708:	90                   	nop
+}
+     709:	c9                   	leave
+     70a:	c3                   	ret
+
+0000070b <mutex_unlock>:
+{
+     70b:	55                   	push   %ebp
+     70c:	89 e5                	mov    %esp,%ebp
+     70e:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+     711:	8b 45 08             	mov    0x8(%ebp),%eax
+     714:	6a 00                	push   $0x0
+     716:	50                   	push   %eax
+     717:	e8 fd fc ff ff       	call   419 <xchg>
+     71c:	83 c4 08             	add    $0x8,%esp
+     71f:	83 f8 02             	cmp    $0x2,%eax
+     722:	75 11                	jne    735 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+     724:	8b 45 08             	mov    0x8(%ebp),%eax
+     727:	83 ec 08             	sub    $0x8,%esp
+     72a:	6a 01                	push   $0x1
+     72c:	50                   	push   %eax
+     72d:	e8 e3 03 00 00       	call   b15 <futex_wake>
+     732:	83 c4 10             	add    $0x10,%esp
+}
+     735:	90                   	nop
+     736:	c9                   	leave
+     737:	c3                   	ret
+
+00000738 <cond_init>:
+{
+     738:	55                   	push   %ebp
+     739:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     73b:	8b 45 08             	mov    0x8(%ebp),%eax
+     73e:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     744:	90                   	nop
+     745:	5d                   	pop    %ebp
+     746:	c3                   	ret
+
+00000747 <cond_wait>:
+{
+     747:	55                   	push   %ebp
+     748:	89 e5                	mov    %esp,%ebp
+     74a:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+     74d:	8b 45 08             	mov    0x8(%ebp),%eax
+     750:	8b 00                	mov    (%eax),%eax
+     752:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+     755:	83 ec 0c             	sub    $0xc,%esp
+     758:	ff 75 0c             	push   0xc(%ebp)
+     75b:	e8 ab ff ff ff       	call   70b <mutex_unlock>
+     760:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+     763:	8b 45 08             	mov    0x8(%ebp),%eax
+     766:	83 ec 08             	sub    $0x8,%esp
+     769:	ff 75 f4             	push   -0xc(%ebp)
+     76c:	50                   	push   %eax
+     76d:	e8 99 03 00 00       	call   b0b <futex_wait>
+     772:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+     775:	eb 11                	jmp    788 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+     777:	8b 45 0c             	mov    0xc(%ebp),%eax
+     77a:	83 ec 08             	sub    $0x8,%esp
+     77d:	6a 02                	push   $0x2
+     77f:	50                   	push   %eax
+     780:	e8 86 03 00 00       	call   b0b <futex_wait>
+     785:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+     788:	8b 45 0c             	mov    0xc(%ebp),%eax
+     78b:	83 ec 08             	sub    $0x8,%esp
+     78e:	6a 02                	push   $0x2
+     790:	50                   	push   %eax
+     791:	e8 83 fc ff ff       	call   419 <xchg>
+     796:	83 c4 10             	add    $0x10,%esp
+     799:	85 c0                	test   %eax,%eax
+     79b:	75 da                	jne    777 <cond_wait+0x30>
+}
+     79d:	90                   	nop
+     79e:	90                   	nop
+     79f:	c9                   	leave
+     7a0:	c3                   	ret
+
+000007a1 <condbump>:
+{
+     7a1:	55                   	push   %ebp
+     7a2:	89 e5                	mov    %esp,%ebp
+     7a4:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+     7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+     7aa:	8b 00                	mov    (%eax),%eax
+     7ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     7af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     7b2:	8d 50 01             	lea    0x1(%eax),%edx
+     7b5:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b8:	52                   	push   %edx
+     7b9:	ff 75 fc             	push   -0x4(%ebp)
+     7bc:	50                   	push   %eax
+     7bd:	e8 71 fc ff ff       	call   433 <cmpxchg>
+     7c2:	83 c4 0c             	add    $0xc,%esp
+     7c5:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     7c8:	75 dd                	jne    7a7 <condbump+0x6>
+}
+     7ca:	90                   	nop
+     7cb:	90                   	nop
+     7cc:	c9                   	leave
+     7cd:	c3                   	ret
+
+000007ce <cond_signal>:
+{
+     7ce:	55                   	push   %ebp
+     7cf:	89 e5                	mov    %esp,%ebp
+     7d1:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+     7d4:	ff 75 08             	push   0x8(%ebp)
+     7d7:	e8 c5 ff ff ff       	call   7a1 <condbump>
+     7dc:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+     7df:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e2:	83 ec 08             	sub    $0x8,%esp
+     7e5:	6a 01                	push   $0x1
+     7e7:	50                   	push   %eax
+     7e8:	e8 28 03 00 00       	call   b15 <futex_wake>
+     7ed:	83 c4 10             	add    $0x10,%esp
+}
+     7f0:	90                   	nop
+     7f1:	c9                   	leave
+     7f2:	c3                   	ret
+
+000007f3 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     7f3:	55                   	push   %ebp
+     7f4:	89 e5                	mov    %esp,%ebp
+     7f6:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+     7f9:	ff 75 08             	push   0x8(%ebp)
+     7fc:	e8 a0 ff ff ff       	call   7a1 <condbump>
+     801:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+     804:	8b 45 08             	mov    0x8(%ebp),%eax
+     807:	83 ec 08             	sub    $0x8,%esp
+     80a:	68 ff ff ff 7f       	push   $0x7fffffff
+     80f:	50                   	push   %eax
+     810:	e8 00 03 00 00       	call   b15 <futex_wake>
+     815:	83 c4 10             	add    $0x10,%esp
+}
+     818:	90                   	nop
+     819:	c9                   	leave
+     81a:	c3                   	ret
+
+0000081b <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+     81b:	55                   	push   %ebp
+     81c:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+     81e:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+     823:	8b 00                	mov    (%eax),%eax
+}
+     825:	5d                   	pop    %ebp
+     826:	c3                   	ret
+
+00000827 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+     827:	55                   	push   %ebp
+     828:	89 e5                	mov    %esp,%ebp
+     82a:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+     82d:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+     832:	8b 00                	mov    (%eax),%eax
+     834:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     837:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     83b:	74 05                	je     842 <vgetpid+0x1b>
+    return pid;
+     83d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     840:	eb 05                	jmp    847 <vgetpid+0x20>
+  return getpid();
+     842:	e8 74 02 00 00       	call   abb <getpid>
+}
+     847:	c9                   	leave
+     848:	c3                   	ret
+
+00000849 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+     849:	55                   	push   %ebp
+     84a:	89 e5                	mov    %esp,%ebp
+     84c:	57                   	push   %edi
+     84d:	56                   	push   %esi
+     84e:	53                   	push   %ebx
+     84f:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+     852:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+     859:	e8 f7 fb ff ff       	call   455 <rdtsc>
+     85e:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     861:	8b 59 0c             	mov    0xc(%ecx),%ebx
+     864:	8b 49 08             	mov    0x8(%ecx),%ecx
+     867:	29 c8                	sub    %ecx,%eax
+     869:	19 da                	sbb    %ebx,%edx
+     86b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     86e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+     871:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     874:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     877:	89 d0                	mov    %edx,%eax
+     879:	31 d2                	xor    %edx,%edx
+     87b:	89 c1                	mov    %eax,%ecx
+     87d:	bb 00 00 00 00       	mov    $0x0,%ebx
+     882:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     885:	8b 40 04             	mov    0x4(%eax),%eax
+     888:	ba 00 00 00 00       	mov    $0x0,%edx
+     88d:	89 df                	mov    %ebx,%edi
+     88f:	0f af f8             	imul   %eax,%edi
+     892:	89 d6                	mov    %edx,%esi
+     894:	0f af f1             	imul   %ecx,%esi
+     897:	01 f7                	add    %esi,%edi
+     899:	f7 e1                	mul    %ecx
+     89b:	89 c1                	mov    %eax,%ecx
+     89d:	89 d3                	mov    %edx,%ebx
+     89f:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+     8a2:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+     8a4:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     8a7:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     8aa:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     8ad:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+     8b4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     8b7:	8b 40 04             	mov    0x4(%eax),%eax
+     8ba:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     8bd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     8c4:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     8c7:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     8ca:	89 d7                	mov    %edx,%edi
+     8cc:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     8cf:	0f af fe             	imul   %esi,%edi
+     8d2:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     8d5:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     8d8:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     8db:	0f af f0             	imul   %eax,%esi
+     8de:	01 f7                	add    %esi,%edi
+     8e0:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     8e3:	f7 65 d8             	mull   -0x28(%ebp)
+     8e6:	8d 34 17             	lea    (%edi,%edx,1),%esi
+     8e9:	89 f2                	mov    %esi,%edx
+     8eb:	89 d0                	mov    %edx,%eax
+     8ed:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+     8ef:	01 c8                	add    %ecx,%eax
+     8f1:	11 da                	adc    %ebx,%edx
+}
+     8f3:	83 c4 24             	add    $0x24,%esp
+     8f6:	5b                   	pop    %ebx
+     8f7:	5e                   	pop    %esi
+     8f8:	5f                   	pop    %edi
+     8f9:	5d                   	pop    %ebp
+     8fa:	c3                   	ret
+
+000008fb <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+     8fb:	55                   	push   %ebp
+     8fc:	89 e5                	mov    %esp,%ebp
+     8fe:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+     901:	8b 45 08             	mov    0x8(%ebp),%eax
+     904:	8b 50 04             	mov    0x4(%eax),%edx
+     907:	8b 45 08             	mov    0x8(%ebp),%eax
+     90a:	8b 00                	mov    (%eax),%eax
+     90c:	29 c2                	sub    %eax,%edx
+     90e:	83 fa 1f             	cmp    $0x1f,%edx
+     911:	76 07                	jbe    91a <ring_queue+0x1f>
+    return -1;
+     913:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     918:	eb 68                	jmp    982 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+     91a:	8b 45 08             	mov    0x8(%ebp),%eax
+     91d:	8b 40 04             	mov    0x4(%eax),%eax
+     920:	83 e0 1f             	and    $0x1f,%eax
+     923:	89 c2                	mov    %eax,%edx
+     925:	89 d0                	mov    %edx,%eax
+     927:	c1 e0 02             	shl    $0x2,%eax
+     92a:	01 d0                	add    %edx,%eax
+     92c:	c1 e0 02             	shl    $0x2,%eax
+     92f:	8d 50 10             	lea    0x10(%eax),%edx
+     932:	8b 45 08             	mov    0x8(%ebp),%eax
+     935:	01 d0                	add    %edx,%eax
+     937:	83 c0 04             	add    $0x4,%eax
+     93a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+     93d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     940:	8b 55 0c             	mov    0xc(%ebp),%edx
+     943:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+     945:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     948:	8b 55 10             	mov    0x10(%ebp),%edx
+     94b:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+     94e:	8b 55 14             	mov    0x14(%ebp),%edx
+     951:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     954:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+     957:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     95a:	8b 55 18             	mov    0x18(%ebp),%edx
+     95d:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+     960:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     963:	8b 55 1c             	mov    0x1c(%ebp),%edx
+     966:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+     969:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+     96e:	8b 45 08             	mov    0x8(%ebp),%eax
+     971:	8b 40 04             	mov    0x4(%eax),%eax
+     974:	8d 50 01             	lea    0x1(%eax),%edx
+     977:	8b 45 08             	mov    0x8(%ebp),%eax
+     97a:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+     97d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     982:	c9                   	leave
+     983:	c3                   	ret
+
+00000984 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+     984:	55                   	push   %ebp
+     985:	89 e5                	mov    %esp,%ebp
+     987:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+     98a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+     98f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     993:	7f 1a                	jg     9af <ring_submit+0x2b>
+     995:	8b 45 08             	mov    0x8(%ebp),%eax
+     998:	8b 40 10             	mov    0x10(%eax),%eax
+     99b:	83 e0 01             	and    $0x1,%eax
+     99e:	85 c0                	test   %eax,%eax
+     9a0:	74 0d                	je     9af <ring_submit+0x2b>
+     9a2:	8b 45 08             	mov    0x8(%ebp),%eax
+     9a5:	8b 40 10             	mov    0x10(%eax),%eax
+     9a8:	83 e0 02             	and    $0x2,%eax
+     9ab:	85 c0                	test   %eax,%eax
+     9ad:	74 10                	je     9bf <ring_submit+0x3b>
+    return ring_enter(min);
+     9af:	83 ec 0c             	sub    $0xc,%esp
+     9b2:	ff 75 0c             	push   0xc(%ebp)
+     9b5:	e8 83 01 00 00       	call   b3d <ring_enter>
+     9ba:	83 c4 10             	add    $0x10,%esp
+     9bd:	eb 10                	jmp    9cf <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+     9bf:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c2:	8b 50 0c             	mov    0xc(%eax),%edx
+     9c5:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c8:	8b 40 08             	mov    0x8(%eax),%eax
+     9cb:	29 c2                	sub    %eax,%edx
+     9cd:	89 d0                	mov    %edx,%eax
+}
+     9cf:	c9                   	leave
+     9d0:	c3                   	ret
+
+000009d1 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+     9d1:	55                   	push   %ebp
+     9d2:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+     9d4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9d7:	8b 50 08             	mov    0x8(%eax),%edx
+     9da:	8b 45 08             	mov    0x8(%ebp),%eax
+     9dd:	8b 40 0c             	mov    0xc(%eax),%eax
+     9e0:	39 c2                	cmp    %eax,%edx
+     9e2:	75 07                	jne    9eb <ring_reap+0x1a>
+    return -1;
+     9e4:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9e9:	eb 3b                	jmp    a26 <ring_reap+0x55>
+  __sync_synchronize();
+     9eb:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+     9f0:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f3:	8b 40 08             	mov    0x8(%eax),%eax
+     9f6:	83 e0 1f             	and    $0x1f,%eax
+     9f9:	89 c2                	mov    %eax,%edx
+     9fb:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     9fe:	8b 45 08             	mov    0x8(%ebp),%eax
+     a01:	83 c2 52             	add    $0x52,%edx
+     a04:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+     a08:	8b 02                	mov    (%edx),%eax
+     a0a:	8b 52 04             	mov    0x4(%edx),%edx
+     a0d:	89 01                	mov    %eax,(%ecx)
+     a0f:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+     a12:	8b 45 08             	mov    0x8(%ebp),%eax
+     a15:	8b 40 08             	mov    0x8(%eax),%eax
+     a18:	8d 50 01             	lea    0x1(%eax),%edx
+     a1b:	8b 45 08             	mov    0x8(%ebp),%eax
+     a1e:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+     a21:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     a26:	5d                   	pop    %ebp
+     a27:	c3                   	ret
+
+00000a28 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+     a28:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+     a2f:	74 0a                	je     a3b <usyscall+0x13>
+  movl %esp, %ecx
+     a31:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     a33:	ba 3a 0a 00 00       	mov    $0xa3a,%edx
+  sysenter
+     a38:	0f 34                	sysenter
+2:
+  ret
+     a3a:	c3                   	ret
+1:
+  int $T_SYSCALL
+     a3b:	cd 40                	int    $0x40
+  ret
+     a3d:	c3                   	ret
+
+00000a3e <fork>:
+
+SYSCALL(fork)
+     a3e:	b8 01 00 00 00       	mov    $0x1,%eax
+     a43:	eb e3                	jmp    a28 <usyscall>
+
+00000a45 <exit>:
+SYSCALL(exit)
+     a45:	b8 02 00 00 00       	mov    $0x2,%eax
+     a4a:	eb dc                	jmp    a28 <usyscall>
+
+00000a4c <wait>:
+SYSCALL(wait)
+     a4c:	b8 03 00 00 00       	mov    $0x3,%eax
+     a51:	eb d5                	jmp    a28 <usyscall>
+
+00000a53 <pipe>:
+SYSCALL(pipe)
+     a53:	b8 04 00 00 00       	mov    $0x4,%eax
+     a58:	eb ce                	jmp    a28 <usyscall>
+
+00000a5a <read>:
+SYSCALL(read)
+     a5a:	b8 05 00 00 00       	mov    $0x5,%eax
+     a5f:	eb c7                	jmp    a28 <usyscall>
+
+00000a61 <write>:
+SYSCALL(write)
+     a61:	b8 10 00 00 00       	mov    $0x10,%eax
+     a66:	eb c0                	jmp    a28 <usyscall>
+
+00000a68 <close>:
+SYSCALL(close)
+     a68:	b8 15 00 00 00       	mov    $0x15,%eax
+     a6d:	eb b9                	jmp    a28 <usyscall>
+
+00000a6f <kill>:
+SYSCALL(kill)
+     a6f:	b8 06 00 00 00       	mov    $0x6,%eax
+     a74:	eb b2                	jmp    a28 <usyscall>
+
+00000a76 <exec>:
+SYSCALL(exec)
+     a76:	b8 07 00 00 00       	mov    $0x7,%eax
+     a7b:	eb ab                	jmp    a28 <usyscall>
+
+00000a7d <open>:
+SYSCALL(open)
+     a7d:	b8 0f 00 00 00       	mov    $0xf,%eax
+     a82:	eb a4                	jmp    a28 <usyscall>
+
+00000a84 <mknod>:
+SYSCALL(mknod)
+     a84:	b8 11 00 00 00       	mov    $0x11,%eax
+     a89:	eb 9d                	jmp    a28 <usyscall>
+
+00000a8b <unlink>:
+SYSCALL(unlink)
+     a8b:	b8 12 00 00 00       	mov    $0x12,%eax
+     a90:	eb 96                	jmp    a28 <usyscall>
+
+00000a92 <fstat>:
+SYSCALL(fstat)
+     a92:	b8 08 00 00 00       	mov    $0x8,%eax
+     a97:	eb 8f                	jmp    a28 <usyscall>
+
+00000a99 <link>:
+SYSCALL(link)
+     a99:	b8 13 00 00 00       	mov    $0x13,%eax
+     a9e:	eb 88                	jmp    a28 <usyscall>
+
+00000aa0 <mkdir>:
+SYSCALL(mkdir)
+     aa0:	b8 14 00 00 00       	mov    $0x14,%eax
+     aa5:	eb 81                	jmp    a28 <usyscall>
+
+00000aa7 <chdir>:
+SYSCALL(chdir)
+     aa7:	b8 09 00 00 00       	mov    $0x9,%eax
+     aac:	e9 77 ff ff ff       	jmp    a28 <usyscall>
+
+00000ab1 <dup>:
+SYSCALL(dup)
+     ab1:	b8 0a 00 00 00       	mov    $0xa,%eax
+     ab6:	e9 6d ff ff ff       	jmp    a28 <usyscall>
+
+00000abb <getpid>:
+SYSCALL(getpid)
+     abb:	b8 0b 00 00 00       	mov    $0xb,%eax
+     ac0:	e9 63 ff ff ff       	jmp    a28 <usyscall>
+
+00000ac5 <sbrk>:
+SYSCALL(sbrk)
+     ac5:	b8 0c 00 00 00       	mov    $0xc,%eax
+     aca:	e9 59 ff ff ff       	jmp    a28 <usyscall>
+
+00000acf <sleep>:
+SYSCALL(sleep)
+     acf:	b8 0d 00 00 00       	mov    $0xd,%eax
+     ad4:	e9 4f ff ff ff       	jmp    a28 <usyscall>
+
+00000ad9 <uptime>:
+SYSCALL(uptime)
+     ad9:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ade:	e9 45 ff ff ff       	jmp    a28 <usyscall>
+
+00000ae3 <kmstat>:
+SYSCALL(kmstat)
+     ae3:	b8 16 00 00 00       	mov    $0x16,%eax
+     ae8:	e9 3b ff ff ff       	jmp    a28 <usyscall>
+
+00000aed <setpriority>:
+SYSCALL(setpriority)
+     aed:	b8 17 00 00 00       	mov    $0x17,%eax
+     af2:	e9 31 ff ff ff       	jmp    a28 <usyscall>
+
+00000af7 <clone>:
+SYSCALL(clone)
+     af7:	b8 18 00 00 00       	mov    $0x18,%eax
+     afc:	e9 27 ff ff ff       	jmp    a28 <usyscall>
+
+00000b01 <join>:
+SYSCALL(join)
+     b01:	b8 19 00 00 00       	mov    $0x19,%eax
+     b06:	e9 1d ff ff ff       	jmp    a28 <usyscall>
+
+00000b0b <futex_wait>:
+SYSCALL(futex_wait)
+     b0b:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     b10:	e9 13 ff ff ff       	jmp    a28 <usyscall>
+
+00000b15 <futex_wake>:
+SYSCALL(futex_wake)
+     b15:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     b1a:	e9 09 ff ff ff       	jmp    a28 <usyscall>
+
+00000b1f <lockstat>:
+SYSCALL(lockstat)
+     b1f:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     b24:	e9 ff fe ff ff       	jmp    a28 <usyscall>
+
+00000b29 <sysstat>:
+SYSCALL(sysstat)
+     b29:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     b2e:	e9 f5 fe ff ff       	jmp    a28 <usyscall>
+
+00000b33 <ring_setup>:
+SYSCALL(ring_setup)
+     b33:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     b38:	e9 eb fe ff ff       	jmp    a28 <usyscall>
+
+00000b3d <ring_enter>:
+SYSCALL(ring_enter)
+     b3d:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     b42:	e9 e1 fe ff ff       	jmp    a28 <usyscall>
+
+00000b47 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     b47:	55                   	push   %ebp
+     b48:	89 e5                	mov    %esp,%ebp
+     b4a:	83 ec 18             	sub    $0x18,%esp
+     b4d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b50:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+     b53:	83 ec 04             	sub    $0x4,%esp
+     b56:	6a 01                	push   $0x1
+     b58:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     b5b:	50                   	push   %eax
+     b5c:	ff 75 08             	push   0x8(%ebp)
+     b5f:	e8 fd fe ff ff       	call   a61 <write>
+     b64:	83 c4 10             	add    $0x10,%esp
+}
+     b67:	90                   	nop
+     b68:	c9                   	leave
+     b69:	c3                   	ret
+
+00000b6a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     b6a:	55                   	push   %ebp
+     b6b:	89 e5                	mov    %esp,%ebp
+     b6d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     b70:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     b77:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     b7b:	74 17                	je     b94 <printint+0x2a>
+     b7d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     b81:	79 11                	jns    b94 <printint+0x2a>
+    neg = 1;
+     b83:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     b8a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b8d:	f7 d8                	neg    %eax
+     b8f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     b92:	eb 06                	jmp    b9a <printint+0x30>
+  } else {
+    x = xx;
+     b94:	8b 45 0c             	mov    0xc(%ebp),%eax
+     b97:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     b9a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     ba1:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     ba4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     ba7:	ba 00 00 00 00       	mov    $0x0,%edx
+     bac:	f7 f1                	div    %ecx
+     bae:	89 d1                	mov    %edx,%ecx
+     bb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bb3:	8d 50 01             	lea    0x1(%eax),%edx
+     bb6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     bb9:	0f b6 91 e8 15 00 00 	movzbl 0x15e8(%ecx),%edx
+     bc0:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     bc4:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     bc7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     bca:	ba 00 00 00 00       	mov    $0x0,%edx
+     bcf:	f7 f1                	div    %ecx
+     bd1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     bd4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     bd8:	75 c7                	jne    ba1 <printint+0x37>
+  if(neg)
+     bda:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     bde:	74 2d                	je     c0d <printint+0xa3>
+    buf[i++] = '-';
+     be0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     be3:	8d 50 01             	lea    0x1(%eax),%edx
+     be6:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     be9:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     bee:	eb 1d                	jmp    c0d <printint+0xa3>
+    putc(fd, buf[i]);
+     bf0:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     bf3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     bf6:	01 d0                	add    %edx,%eax
+     bf8:	0f b6 00             	movzbl (%eax),%eax
+     bfb:	0f be c0             	movsbl %al,%eax
+     bfe:	83 ec 08             	sub    $0x8,%esp
+     c01:	50                   	push   %eax
+     c02:	ff 75 08             	push   0x8(%ebp)
+     c05:	e8 3d ff ff ff       	call   b47 <putc>
+     c0a:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     c0d:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     c11:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     c15:	79 d9                	jns    bf0 <printint+0x86>
+}
+     c17:	90                   	nop
+     c18:	90                   	nop
+     c19:	c9                   	leave
+     c1a:	c3                   	ret
+
+00000c1b <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     c1b:	55                   	push   %ebp
+     c1c:	89 e5                	mov    %esp,%ebp
+     c1e:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     c21:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     c28:	8d 45 0c             	lea    0xc(%ebp),%eax
+     c2b:	83 c0 04             	add    $0x4,%eax
+     c2e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     c31:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     c38:	e9 59 01 00 00       	jmp    d96 <printf+0x17b>
+    c = fmt[i] & 0xff;
+     c3d:	8b 55 0c             	mov    0xc(%ebp),%edx
+     c40:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     c43:	01 d0                	add    %edx,%eax
+     c45:	0f b6 00             	movzbl (%eax),%eax
+     c48:	0f be c0             	movsbl %al,%eax
+     c4b:	25 ff 00 00 00       	and    $0xff,%eax
+     c50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     c53:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     c57:	75 2c                	jne    c85 <printf+0x6a>
+      if(c == '%'){
+     c59:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     c5d:	75 0c                	jne    c6b <printf+0x50>
+        state = '%';
+     c5f:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     c66:	e9 27 01 00 00       	jmp    d92 <printf+0x177>
+      } else {
+        putc(fd, c);
+     c6b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     c6e:	0f be c0             	movsbl %al,%eax
+     c71:	83 ec 08             	sub    $0x8,%esp
+     c74:	50                   	push   %eax
+     c75:	ff 75 08             	push   0x8(%ebp)
+     c78:	e8 ca fe ff ff       	call   b47 <putc>
+     c7d:	83 c4 10             	add    $0x10,%esp
+     c80:	e9 0d 01 00 00       	jmp    d92 <printf+0x177>
+      }
+    } else if(state == '%'){
+     c85:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     c89:	0f 85 03 01 00 00    	jne    d92 <printf+0x177>
+      if(c == 'd'){
+     c8f:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     c93:	75 1e                	jne    cb3 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+     c95:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c98:	8b 00                	mov    (%eax),%eax
+     c9a:	6a 01                	push   $0x1
+     c9c:	6a 0a                	push   $0xa
+     c9e:	50                   	push   %eax
+     c9f:	ff 75 08             	push   0x8(%ebp)
+     ca2:	e8 c3 fe ff ff       	call   b6a <printint>
+     ca7:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     caa:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     cae:	e9 d8 00 00 00       	jmp    d8b <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+     cb3:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     cb7:	74 06                	je     cbf <printf+0xa4>
+     cb9:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     cbd:	75 1e                	jne    cdd <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+     cbf:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     cc2:	8b 00                	mov    (%eax),%eax
+     cc4:	6a 00                	push   $0x0
+     cc6:	6a 10                	push   $0x10
+     cc8:	50                   	push   %eax
+     cc9:	ff 75 08             	push   0x8(%ebp)
+     ccc:	e8 99 fe ff ff       	call   b6a <printint>
+     cd1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     cd4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     cd8:	e9 ae 00 00 00       	jmp    d8b <printf+0x170>
+      } else if(c == 's'){
+     cdd:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     ce1:	75 43                	jne    d26 <printf+0x10b>
+        s = (char*)*ap;
+     ce3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     ce6:	8b 00                	mov    (%eax),%eax
+     ce8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     ceb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     cef:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     cf3:	75 25                	jne    d1a <printf+0xff>
+          s = "(null)";
+     cf5:	c7 45 f4 e8 10 00 00 	movl   $0x10e8,-0xc(%ebp)
+        while(*s != 0){
+     cfc:	eb 1c                	jmp    d1a <printf+0xff>
+          putc(fd, *s);
+     cfe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d01:	0f b6 00             	movzbl (%eax),%eax
+     d04:	0f be c0             	movsbl %al,%eax
+     d07:	83 ec 08             	sub    $0x8,%esp
+     d0a:	50                   	push   %eax
+     d0b:	ff 75 08             	push   0x8(%ebp)
+     d0e:	e8 34 fe ff ff       	call   b47 <putc>
+     d13:	83 c4 10             	add    $0x10,%esp
+          s++;
+     d16:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     d1a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d1d:	0f b6 00             	movzbl (%eax),%eax
+     d20:	84 c0                	test   %al,%al
+     d22:	75 da                	jne    cfe <printf+0xe3>
+     d24:	eb 65                	jmp    d8b <printf+0x170>
+        }
+      } else if(c == 'c'){
+     d26:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     d2a:	75 1d                	jne    d49 <printf+0x12e>
+        putc(fd, *ap);
+     d2c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d2f:	8b 00                	mov    (%eax),%eax
+     d31:	0f be c0             	movsbl %al,%eax
+     d34:	83 ec 08             	sub    $0x8,%esp
+     d37:	50                   	push   %eax
+     d38:	ff 75 08             	push   0x8(%ebp)
+     d3b:	e8 07 fe ff ff       	call   b47 <putc>
+     d40:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d43:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     d47:	eb 42                	jmp    d8b <printf+0x170>
+      } else if(c == '%'){
+     d49:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     d4d:	75 17                	jne    d66 <printf+0x14b>
+        putc(fd, c);
+     d4f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d52:	0f be c0             	movsbl %al,%eax
+     d55:	83 ec 08             	sub    $0x8,%esp
+     d58:	50                   	push   %eax
+     d59:	ff 75 08             	push   0x8(%ebp)
+     d5c:	e8 e6 fd ff ff       	call   b47 <putc>
+     d61:	83 c4 10             	add    $0x10,%esp
+     d64:	eb 25                	jmp    d8b <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     d66:	83 ec 08             	sub    $0x8,%esp
+     d69:	6a 25                	push   $0x25
+     d6b:	ff 75 08             	push   0x8(%ebp)
+     d6e:	e8 d4 fd ff ff       	call   b47 <putc>
+     d73:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+     d76:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d79:	0f be c0             	movsbl %al,%eax
+     d7c:	83 ec 08             	sub    $0x8,%esp
+     d7f:	50                   	push   %eax
+     d80:	ff 75 08             	push   0x8(%ebp)
+     d83:	e8 bf fd ff ff       	call   b47 <putc>
+     d88:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     d8b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     d92:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     d96:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d99:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d9c:	01 d0                	add    %edx,%eax
+     d9e:	0f b6 00             	movzbl (%eax),%eax
+     da1:	84 c0                	test   %al,%al
+     da3:	0f 85 94 fe ff ff    	jne    c3d <printf+0x22>
+    }
+  }
+}
+     da9:	90                   	nop
+     daa:	90                   	nop
+     dab:	c9                   	leave
+     dac:	c3                   	ret
+
+00000dad <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     dad:	55                   	push   %ebp
+     dae:	89 e5                	mov    %esp,%ebp
+     db0:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     db3:	8b 45 08             	mov    0x8(%ebp),%eax
+     db6:	83 e8 08             	sub    $0x8,%eax
+     db9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     dbc:	a1 a8 25 00 00       	mov    0x25a8,%eax
+     dc1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     dc4:	eb 24                	jmp    dea <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     dc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     dc9:	8b 00                	mov    (%eax),%eax
+     dcb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     dce:	72 12                	jb     de2 <free+0x35>
+     dd0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     dd3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     dd6:	72 24                	jb     dfc <free+0x4f>
+     dd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ddb:	8b 00                	mov    (%eax),%eax
+     ddd:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     de0:	72 1a                	jb     dfc <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     de2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     de5:	8b 00                	mov    (%eax),%eax
+     de7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     dea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ded:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     df0:	73 d4                	jae    dc6 <free+0x19>
+     df2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     df5:	8b 00                	mov    (%eax),%eax
+     df7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     dfa:	73 ca                	jae    dc6 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     dfc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     dff:	8b 40 04             	mov    0x4(%eax),%eax
+     e02:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e09:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e0c:	01 c2                	add    %eax,%edx
+     e0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e11:	8b 00                	mov    (%eax),%eax
+     e13:	39 c2                	cmp    %eax,%edx
+     e15:	75 24                	jne    e3b <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+     e17:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e1a:	8b 50 04             	mov    0x4(%eax),%edx
+     e1d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e20:	8b 00                	mov    (%eax),%eax
+     e22:	8b 40 04             	mov    0x4(%eax),%eax
+     e25:	01 c2                	add    %eax,%edx
+     e27:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e2a:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     e2d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e30:	8b 00                	mov    (%eax),%eax
+     e32:	8b 10                	mov    (%eax),%edx
+     e34:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e37:	89 10                	mov    %edx,(%eax)
+     e39:	eb 0a                	jmp    e45 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+     e3b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e3e:	8b 10                	mov    (%eax),%edx
+     e40:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e43:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     e45:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e48:	8b 40 04             	mov    0x4(%eax),%eax
+     e4b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     e52:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e55:	01 d0                	add    %edx,%eax
+     e57:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     e5a:	75 20                	jne    e7c <free+0xcf>
+    p->s.size += bp->s.size;
+     e5c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e5f:	8b 50 04             	mov    0x4(%eax),%edx
+     e62:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e65:	8b 40 04             	mov    0x4(%eax),%eax
+     e68:	01 c2                	add    %eax,%edx
+     e6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e6d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     e70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e73:	8b 10                	mov    (%eax),%edx
+     e75:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e78:	89 10                	mov    %edx,(%eax)
+     e7a:	eb 08                	jmp    e84 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+     e7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e7f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     e82:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     e84:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e87:	a3 a8 25 00 00       	mov    %eax,0x25a8
+}
+     e8c:	90                   	nop
+     e8d:	c9                   	leave
+     e8e:	c3                   	ret
+
+00000e8f <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     e8f:	55                   	push   %ebp
+     e90:	89 e5                	mov    %esp,%ebp
+     e92:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     e95:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     e9c:	77 07                	ja     ea5 <morecore+0x16>
+    nu = 4096;
+     e9e:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     ea5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ea8:	c1 e0 03             	shl    $0x3,%eax
+     eab:	83 ec 0c             	sub    $0xc,%esp
+     eae:	50                   	push   %eax
+     eaf:	e8 11 fc ff ff       	call   ac5 <sbrk>
+     eb4:	83 c4 10             	add    $0x10,%esp
+     eb7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     eba:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     ebe:	75 07                	jne    ec7 <morecore+0x38>
+    return 0;
+     ec0:	b8 00 00 00 00       	mov    $0x0,%eax
+     ec5:	eb 26                	jmp    eed <morecore+0x5e>
+  hp = (Header*)p;
+     ec7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     eca:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     ecd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed0:	8b 55 08             	mov    0x8(%ebp),%edx
+     ed3:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+     ed6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ed9:	83 c0 08             	add    $0x8,%eax
+     edc:	83 ec 0c             	sub    $0xc,%esp
+     edf:	50                   	push   %eax
+     ee0:	e8 c8 fe ff ff       	call   dad <free>
+     ee5:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     ee8:	a1 a8 25 00 00       	mov    0x25a8,%eax
+}
+     eed:	c9                   	leave
+     eee:	c3                   	ret
+
+00000eef <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     eef:	55                   	push   %ebp
+     ef0:	89 e5                	mov    %esp,%ebp
+     ef2:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+     ef8:	83 c0 07             	add    $0x7,%eax
+     efb:	c1 e8 03             	shr    $0x3,%eax
+     efe:	83 c0 01             	add    $0x1,%eax
+     f01:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+     f04:	a1 a8 25 00 00       	mov    0x25a8,%eax
+     f09:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     f0c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     f10:	75 23                	jne    f35 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+     f12:	c7 45 f0 a0 25 00 00 	movl   $0x25a0,-0x10(%ebp)
+     f19:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f1c:	a3 a8 25 00 00       	mov    %eax,0x25a8
+     f21:	a1 a8 25 00 00       	mov    0x25a8,%eax
+     f26:	a3 a0 25 00 00       	mov    %eax,0x25a0
+    base.s.size = 0;
+     f2b:	c7 05 a4 25 00 00 00 	movl   $0x0,0x25a4
+     f32:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     f35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f38:	8b 00                	mov    (%eax),%eax
+     f3a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     f3d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f40:	8b 40 04             	mov    0x4(%eax),%eax
+     f43:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     f46:	72 4d                	jb     f95 <malloc+0xa6>
+      if(p->s.size == nunits)
+     f48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f4b:	8b 40 04             	mov    0x4(%eax),%eax
+     f4e:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+     f51:	75 0c                	jne    f5f <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+     f53:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f56:	8b 10                	mov    (%eax),%edx
+     f58:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f5b:	89 10                	mov    %edx,(%eax)
+     f5d:	eb 26                	jmp    f85 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+     f5f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f62:	8b 40 04             	mov    0x4(%eax),%eax
+     f65:	2b 45 ec             	sub    -0x14(%ebp),%eax
+     f68:	89 c2                	mov    %eax,%edx
+     f6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f6d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+     f70:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f73:	8b 40 04             	mov    0x4(%eax),%eax
+     f76:	c1 e0 03             	shl    $0x3,%eax
+     f79:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+     f7c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f7f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+     f82:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+     f85:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f88:	a3 a8 25 00 00       	mov    %eax,0x25a8
+      return (void*)(p + 1);
+     f8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f90:	83 c0 08             	add    $0x8,%eax
+     f93:	eb 3b                	jmp    fd0 <malloc+0xe1>
+    }
+    if(p == freep)
+     f95:	a1 a8 25 00 00       	mov    0x25a8,%eax
+     f9a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+     f9d:	75 1e                	jne    fbd <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+     f9f:	83 ec 0c             	sub    $0xc,%esp
+     fa2:	ff 75 ec             	push   -0x14(%ebp)
+     fa5:	e8 e5 fe ff ff       	call   e8f <morecore>
+     faa:	83 c4 10             	add    $0x10,%esp
+     fad:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     fb0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     fb4:	75 07                	jne    fbd <malloc+0xce>
+        return 0;
+     fb6:	b8 00 00 00 00       	mov    $0x0,%eax
+     fbb:	eb 13                	jmp    fd0 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     fbd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fc3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     fc6:	8b 00                	mov    (%eax),%eax
+     fc8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     fcb:	e9 6d ff ff ff       	jmp    f3d <malloc+0x4e>
+  }
+}
+     fd0:	c9                   	leave
+     fd1:	c3                   	ret
+
+00000fd2 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+     fd2:	55                   	push   %ebp
+     fd3:	89 e5                	mov    %esp,%ebp
+     fd5:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+     fd8:	83 ec 0c             	sub    $0xc,%esp
+     fdb:	68 00 10 00 00       	push   $0x1000
+     fe0:	e8 0a ff ff ff       	call   eef <malloc>
+     fe5:	83 c4 10             	add    $0x10,%esp
+     fe8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     feb:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     fef:	75 07                	jne    ff8 <thread_create+0x26>
+    return -1;
+     ff1:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     ff6:	eb 2e                	jmp    1026 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+     ff8:	83 ec 04             	sub    $0x4,%esp
+     ffb:	ff 75 f4             	push   -0xc(%ebp)
+     ffe:	ff 75 0c             	push   0xc(%ebp)
+    1001:	ff 75 08             	push   0x8(%ebp)
+    1004:	e8 ee fa ff ff       	call   af7 <clone>
+    1009:	83 c4 10             	add    $0x10,%esp
+    100c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    100f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1013:	79 0e                	jns    1023 <thread_create+0x51>
+    free(stack);
+    1015:	83 ec 0c             	sub    $0xc,%esp
+    1018:	ff 75 f4             	push   -0xc(%ebp)
+    101b:	e8 8d fd ff ff       	call   dad <free>
+    1020:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1023:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    1026:	c9                   	leave
+    1027:	c3                   	ret
+
+00001028 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+    1028:	55                   	push   %ebp
+    1029:	89 e5                	mov    %esp,%ebp
+    102b:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    102e:	83 ec 0c             	sub    $0xc,%esp
+    1031:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    1034:	50                   	push   %eax
+    1035:	e8 c7 fa ff ff       	call   b01 <join>
+    103a:	83 c4 10             	add    $0x10,%esp
+    103d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1040:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1044:	78 0f                	js     1055 <thread_join+0x2d>
+    free(stack);
+    1046:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1049:	83 ec 0c             	sub    $0xc,%esp
+    104c:	50                   	push   %eax
+    104d:	e8 5b fd ff ff       	call   dad <free>
+    1052:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1055:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    1058:	c9                   	leave
+    1059:	c3                   	ret
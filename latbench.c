@@ -0,0 +1,120 @@
+// Scheduling latency benchmark: an interactive pair of processes
+// bounces a byte over pipes, pausing a tick between round trips,
+// while CPU-bound hogs compete for the CPUs.  Prints the spread
+// of round-trip times in TSC cycles; the tail shows how long an
+// interactive process waits behind the hogs.
+//
+//   latbench [nhogs [nsamples [hognice]]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+#define MAXHOGS    32
+#define MAXSAMPLES 1000
+
+uint lat[MAXSAMPLES];
+
+static inline uint
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+void
+hog(void)
+{
+  volatile uint x;
+
+  for(x = 0;; x++)
+    ;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nhogs, n, nice, i, j, pid, ping[2], pong[2], pids[MAXHOGS];
+  uint t0, v;
+  char c;
+
+  nhogs = 4;
+  n = 200;
+  nice = 0;
+  if(argc > 1)
+    nhogs = atoi(argv[1]);
+  if(argc > 2)
+    n = atoi(argv[2]);
+  if(argc > 3)
+    nice = atoi(argv[3]);
+  if(nhogs > MAXHOGS)
+    nhogs = MAXHOGS;
+  if(n > MAXSAMPLES)
+    n = MAXSAMPLES;
+
+  for(i = 0; i < nhogs; i++){
+    if((pids[i] = fork()) < 0){
+      printf(2, "latbench: fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0)
+      hog();
+    setpriority(pids[i], nice);
+  }
+
+  if(pipe(ping) < 0 || pipe(pong) < 0){
+    printf(2, "latbench: pipe failed\n");
+    exit();
+  }
+  if((pid = fork()) < 0){
+    printf(2, "latbench: fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    // Keep only our own ends, so read() sees EOF when the
+    // parent closes ping[1].
+    close(ping[1]);
+    close(pong[0]);
+    while(read(ping[0], &c, 1) == 1)
+      write(pong[1], &c, 1);
+    exit();
+  }
+  close(ping[0]);
+  close(pong[1]);
+
+  c = 'x';
+  for(i = 0; i < n; i++){
+    sleep(1);
+    t0 = rdtsc();
+    write(ping[1], &c, 1);
+    if(read(pong[0], &c, 1) != 1){
+      printf(2, "latbench: short read\n");
+      break;
+    }
+    lat[i] = rdtsc() - t0;
+  }
+  n = i;
+  close(ping[1]);
+  wait();
+
+  for(i = 0; i < nhogs; i++){
+    kill(pids[i]);
+    wait();
+  }
+
+  // Insertion sort; n is small.
+  for(i = 1; i < n; i++){
+    v = lat[i];
+    for(j = i; j > 0 && lat[j-1] > v; j--)
+      lat[j] = lat[j-1];
+    lat[j] = v;
+  }
+  if(n == 0)
+    exit();
+  printf(1, "latbench: %d hogs, %d round trips, cycles: "
+         "p50 %d p90 %d p99 %d max %d\n", nhogs, n,
+         lat[n/2], lat[n*9/10], lat[n*99/100], lat[n-1]);
+  exit();
+}
@@ -0,0 +1,1788 @@
+
+_ln:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	89 cb                	mov    %ecx,%ebx
+  if(argc != 3){
+  11:	83 3b 03             	cmpl   $0x3,(%ebx)
+  14:	74 17                	je     2d <main+0x2d>
+    printf(2, "Usage: ln old new\n");
+  16:	83 ec 08             	sub    $0x8,%esp
+  19:	68 db 0c 00 00       	push   $0xcdb
+  1e:	6a 02                	push   $0x2
+  20:	e8 77 08 00 00       	call   89c <printf>
+  25:	83 c4 10             	add    $0x10,%esp
+    exit();
+  28:	e8 99 06 00 00       	call   6c6 <exit>
+  }
+  if(link(argv[1], argv[2]) < 0)
+  2d:	8b 43 04             	mov    0x4(%ebx),%eax
+  30:	83 c0 08             	add    $0x8,%eax
+  33:	8b 10                	mov    (%eax),%edx
+  35:	8b 43 04             	mov    0x4(%ebx),%eax
+  38:	83 c0 04             	add    $0x4,%eax
+  3b:	8b 00                	mov    (%eax),%eax
+  3d:	83 ec 08             	sub    $0x8,%esp
+  40:	52                   	push   %edx
+  41:	50                   	push   %eax
+  42:	e8 d3 06 00 00       	call   71a <link>
+  47:	83 c4 10             	add    $0x10,%esp
+  4a:	85 c0                	test   %eax,%eax
+  4c:	79 21                	jns    6f <main+0x6f>
+    printf(2, "link %s %s: failed\n", argv[1], argv[2]);
+  4e:	8b 43 04             	mov    0x4(%ebx),%eax
+  51:	83 c0 08             	add    $0x8,%eax
+  54:	8b 10                	mov    (%eax),%edx
+  56:	8b 43 04             	mov    0x4(%ebx),%eax
+  59:	83 c0 04             	add    $0x4,%eax
+  5c:	8b 00                	mov    (%eax),%eax
+  5e:	52                   	push   %edx
+  5f:	50                   	push   %eax
+  60:	68 ee 0c 00 00       	push   $0xcee
+  65:	6a 02                	push   $0x2
+  67:	e8 30 08 00 00       	call   89c <printf>
+  6c:	83 c4 10             	add    $0x10,%esp
+  exit();
+  6f:	e8 52 06 00 00       	call   6c6 <exit>
+
+00000074 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+  74:	55                   	push   %ebp
+  75:	89 e5                	mov    %esp,%ebp
+  77:	57                   	push   %edi
+  78:	53                   	push   %ebx
+char*
+  79:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7c:	8b 55 10             	mov    0x10(%ebp),%edx
+  7f:	8b 45 0c             	mov    0xc(%ebp),%eax
+  82:	89 cb                	mov    %ecx,%ebx
+  84:	89 df                	mov    %ebx,%edi
+  86:	89 d1                	mov    %edx,%ecx
+  88:	fc                   	cld
+  89:	f3 aa                	rep stos %al,%es:(%edi)
+  8b:	89 ca                	mov    %ecx,%edx
+  8d:	89 fb                	mov    %edi,%ebx
+  8f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  92:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+  95:	90                   	nop
+  96:	5b                   	pop    %ebx
+  97:	5f                   	pop    %edi
+  98:	5d                   	pop    %ebp
+  99:	c3                   	ret
+
+0000009a <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+  9a:	55                   	push   %ebp
+  9b:	89 e5                	mov    %esp,%ebp
+  9d:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+  a0:	8b 55 08             	mov    0x8(%ebp),%edx
+  a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+  a6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  a9:	f0 87 02             	lock xchg %eax,(%edx)
+  ac:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+  af:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+  b2:	c9                   	leave
+  b3:	c3                   	ret
+
+000000b4 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+  b4:	55                   	push   %ebp
+  b5:	89 e5                	mov    %esp,%ebp
+  b7:	53                   	push   %ebx
+  b8:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+  bb:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  be:	8b 55 10             	mov    0x10(%ebp),%edx
+  c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c4:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c7:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  cb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  ce:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+  d1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  d4:	c9                   	leave
+  d5:	c3                   	ret
+
+000000d6 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+  d6:	55                   	push   %ebp
+  d7:	89 e5                	mov    %esp,%ebp
+  d9:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+  dc:	0f 31                	rdtsc
+  de:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  e1:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+  e4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  e7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+  ea:	c9                   	leave
+  eb:	c3                   	ret
+
+000000ec <strcpy>:
+{
+  ec:	55                   	push   %ebp
+  ed:	89 e5                	mov    %esp,%ebp
+  ef:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  f2:	8b 45 08             	mov    0x8(%ebp),%eax
+  f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  f8:	90                   	nop
+  f9:	8b 55 0c             	mov    0xc(%ebp),%edx
+  fc:	8d 42 01             	lea    0x1(%edx),%eax
+  ff:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 102:	8b 45 08             	mov    0x8(%ebp),%eax
+ 105:	8d 48 01             	lea    0x1(%eax),%ecx
+ 108:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 10b:	0f b6 12             	movzbl (%edx),%edx
+ 10e:	88 10                	mov    %dl,(%eax)
+ 110:	0f b6 00             	movzbl (%eax),%eax
+ 113:	84 c0                	test   %al,%al
+ 115:	75 e2                	jne    f9 <strcpy+0xd>
+  return os;
+ 117:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 11a:	c9                   	leave
+ 11b:	c3                   	ret
+
+0000011c <strcmp>:
+{
+ 11c:	55                   	push   %ebp
+ 11d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 11f:	eb 08                	jmp    129 <strcmp+0xd>
+    p++, q++;
+ 121:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 125:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 129:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12c:	0f b6 00             	movzbl (%eax),%eax
+ 12f:	84 c0                	test   %al,%al
+ 131:	74 10                	je     143 <strcmp+0x27>
+ 133:	8b 45 08             	mov    0x8(%ebp),%eax
+ 136:	0f b6 10             	movzbl (%eax),%edx
+ 139:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 13c:	0f b6 00             	movzbl (%eax),%eax
+ 13f:	38 c2                	cmp    %al,%dl
+ 141:	74 de                	je     121 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 143:	8b 45 08             	mov    0x8(%ebp),%eax
+ 146:	0f b6 00             	movzbl (%eax),%eax
+ 149:	0f b6 d0             	movzbl %al,%edx
+ 14c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 14f:	0f b6 00             	movzbl (%eax),%eax
+ 152:	0f b6 c0             	movzbl %al,%eax
+ 155:	29 c2                	sub    %eax,%edx
+ 157:	89 d0                	mov    %edx,%eax
+}
+ 159:	5d                   	pop    %ebp
+ 15a:	c3                   	ret
+
+0000015b <strlen>:
+{
+ 15b:	55                   	push   %ebp
+ 15c:	89 e5                	mov    %esp,%ebp
+ 15e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 161:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 168:	eb 04                	jmp    16e <strlen+0x13>
+ 16a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 16e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 171:	8b 45 08             	mov    0x8(%ebp),%eax
+ 174:	01 d0                	add    %edx,%eax
+ 176:	0f b6 00             	movzbl (%eax),%eax
+ 179:	84 c0                	test   %al,%al
+ 17b:	75 ed                	jne    16a <strlen+0xf>
+  return n;
+ 17d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 180:	c9                   	leave
+ 181:	c3                   	ret
+
+00000182 <memset>:
+{
+ 182:	55                   	push   %ebp
+ 183:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 185:	8b 45 10             	mov    0x10(%ebp),%eax
+ 188:	50                   	push   %eax
+ 189:	ff 75 0c             	push   0xc(%ebp)
+ 18c:	ff 75 08             	push   0x8(%ebp)
+ 18f:	e8 e0 fe ff ff       	call   74 <stosb>
+ 194:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 197:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 19a:	c9                   	leave
+ 19b:	c3                   	ret
+
+0000019c <strchr>:
+{
+ 19c:	55                   	push   %ebp
+ 19d:	89 e5                	mov    %esp,%ebp
+ 19f:	83 ec 04             	sub    $0x4,%esp
+ 1a2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a5:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1a8:	eb 14                	jmp    1be <strchr+0x22>
+    if(*s == c)
+ 1aa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ad:	0f b6 00             	movzbl (%eax),%eax
+ 1b0:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1b3:	75 05                	jne    1ba <strchr+0x1e>
+      return (char*)s;
+ 1b5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b8:	eb 13                	jmp    1cd <strchr+0x31>
+  for(; *s; s++)
+ 1ba:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1be:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c1:	0f b6 00             	movzbl (%eax),%eax
+ 1c4:	84 c0                	test   %al,%al
+ 1c6:	75 e2                	jne    1aa <strchr+0xe>
+  return 0;
+ 1c8:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1cd:	c9                   	leave
+ 1ce:	c3                   	ret
+
+000001cf <gets>:
+{
+ 1cf:	55                   	push   %ebp
+ 1d0:	89 e5                	mov    %esp,%ebp
+ 1d2:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1d5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1dc:	eb 42                	jmp    220 <gets+0x51>
+    cc = read(0, &c, 1);
+ 1de:	83 ec 04             	sub    $0x4,%esp
+ 1e1:	6a 01                	push   $0x1
+ 1e3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 1e6:	50                   	push   %eax
+ 1e7:	6a 00                	push   $0x0
+ 1e9:	e8 ed 04 00 00       	call   6db <read>
+ 1ee:	83 c4 10             	add    $0x10,%esp
+ 1f1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1f4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1f8:	7e 33                	jle    22d <gets+0x5e>
+    buf[i++] = c;
+ 1fa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1fd:	8d 50 01             	lea    0x1(%eax),%edx
+ 200:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 203:	89 c2                	mov    %eax,%edx
+ 205:	8b 45 08             	mov    0x8(%ebp),%eax
+ 208:	01 c2                	add    %eax,%edx
+ 20a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 20e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 210:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 214:	3c 0a                	cmp    $0xa,%al
+ 216:	74 16                	je     22e <gets+0x5f>
+ 218:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 21c:	3c 0d                	cmp    $0xd,%al
+ 21e:	74 0e                	je     22e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 220:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 223:	83 c0 01             	add    $0x1,%eax
+ 226:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 229:	7f b3                	jg     1de <gets+0xf>
+ 22b:	eb 01                	jmp    22e <gets+0x5f>
+      break;
+ 22d:	90                   	nop
+  buf[i] = '\0';
+ 22e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 231:	8b 45 08             	mov    0x8(%ebp),%eax
+ 234:	01 d0                	add    %edx,%eax
+ 236:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 239:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 23c:	c9                   	leave
+ 23d:	c3                   	ret
+
+0000023e <stat>:
+{
+ 23e:	55                   	push   %ebp
+ 23f:	89 e5                	mov    %esp,%ebp
+ 241:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 244:	83 ec 08             	sub    $0x8,%esp
+ 247:	6a 00                	push   $0x0
+ 249:	ff 75 08             	push   0x8(%ebp)
+ 24c:	e8 ad 04 00 00       	call   6fe <open>
+ 251:	83 c4 10             	add    $0x10,%esp
+ 254:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 257:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 25b:	79 07                	jns    264 <stat+0x26>
+    return -1;
+ 25d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 262:	eb 25                	jmp    289 <stat+0x4b>
+  r = fstat(fd, st);
+ 264:	83 ec 08             	sub    $0x8,%esp
+ 267:	ff 75 0c             	push   0xc(%ebp)
+ 26a:	ff 75 f4             	push   -0xc(%ebp)
+ 26d:	e8 a1 04 00 00       	call   713 <fstat>
+ 272:	83 c4 10             	add    $0x10,%esp
+ 275:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 278:	83 ec 0c             	sub    $0xc,%esp
+ 27b:	ff 75 f4             	push   -0xc(%ebp)
+ 27e:	e8 66 04 00 00       	call   6e9 <close>
+ 283:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 286:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 289:	c9                   	leave
+ 28a:	c3                   	ret
+
+0000028b <atoi>:
+{
+ 28b:	55                   	push   %ebp
+ 28c:	89 e5                	mov    %esp,%ebp
+ 28e:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 291:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 298:	eb 25                	jmp    2bf <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 29a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 29d:	89 d0                	mov    %edx,%eax
+ 29f:	c1 e0 02             	shl    $0x2,%eax
+ 2a2:	01 d0                	add    %edx,%eax
+ 2a4:	01 c0                	add    %eax,%eax
+ 2a6:	89 c1                	mov    %eax,%ecx
+ 2a8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2ab:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ae:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2b1:	0f b6 00             	movzbl (%eax),%eax
+ 2b4:	0f be c0             	movsbl %al,%eax
+ 2b7:	01 c8                	add    %ecx,%eax
+ 2b9:	83 e8 30             	sub    $0x30,%eax
+ 2bc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c2:	0f b6 00             	movzbl (%eax),%eax
+ 2c5:	3c 2f                	cmp    $0x2f,%al
+ 2c7:	7e 0a                	jle    2d3 <atoi+0x48>
+ 2c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2cc:	0f b6 00             	movzbl (%eax),%eax
+ 2cf:	3c 39                	cmp    $0x39,%al
+ 2d1:	7e c7                	jle    29a <atoi+0xf>
+  return n;
+ 2d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2d6:	c9                   	leave
+ 2d7:	c3                   	ret
+
+000002d8 <memmove>:
+{
+ 2d8:	55                   	push   %ebp
+ 2d9:	89 e5                	mov    %esp,%ebp
+ 2db:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 2de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 2e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2ea:	eb 17                	jmp    303 <memmove+0x2b>
+    *dst++ = *src++;
+ 2ec:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2ef:	8d 42 01             	lea    0x1(%edx),%eax
+ 2f2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2f8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2fb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2fe:	0f b6 12             	movzbl (%edx),%edx
+ 301:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 303:	8b 45 10             	mov    0x10(%ebp),%eax
+ 306:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 309:	89 55 10             	mov    %edx,0x10(%ebp)
+ 30c:	85 c0                	test   %eax,%eax
+ 30e:	7f dc                	jg     2ec <memmove+0x14>
+  return vdst;
+ 310:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 313:	c9                   	leave
+ 314:	c3                   	ret
+
+00000315 <mutex_init>:
+{
+ 315:	55                   	push   %ebp
+ 316:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 318:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 321:	90                   	nop
+ 322:	5d                   	pop    %ebp
+ 323:	c3                   	ret
+
+00000324 <mutex_lock>:
+{
+ 324:	55                   	push   %ebp
+ 325:	89 e5                	mov    %esp,%ebp
+ 327:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 32a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32d:	6a 01                	push   $0x1
+ 32f:	6a 00                	push   $0x0
+ 331:	50                   	push   %eax
+ 332:	e8 7d fd ff ff       	call   b4 <cmpxchg>
+ 337:	83 c4 0c             	add    $0xc,%esp
+ 33a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 33d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 341:	74 46                	je     389 <mutex_lock+0x65>
+  if(c != 2)
+ 343:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 347:	74 38                	je     381 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 349:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34c:	6a 02                	push   $0x2
+ 34e:	50                   	push   %eax
+ 34f:	e8 46 fd ff ff       	call   9a <xchg>
+ 354:	83 c4 08             	add    $0x8,%esp
+ 357:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 35a:	eb 25                	jmp    381 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 35c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 35f:	83 ec 08             	sub    $0x8,%esp
+ 362:	6a 02                	push   $0x2
+ 364:	50                   	push   %eax
+ 365:	e8 22 04 00 00       	call   78c <futex_wait>
+ 36a:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 36d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 370:	83 ec 08             	sub    $0x8,%esp
+ 373:	6a 02                	push   $0x2
+ 375:	50                   	push   %eax
+ 376:	e8 1f fd ff ff       	call   9a <xchg>
+ 37b:	83 c4 10             	add    $0x10,%esp
+ 37e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 381:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 385:	75 d5                	jne    35c <mutex_lock+0x38>
+ 387:	eb 01                	jmp    38a <mutex_lock+0x66>
+    return;
+ 389:	90                   	nop
+}
+ 38a:	c9                   	leave
+ 38b:	c3                   	ret
+
+0000038c <mutex_unlock>:
+{
+ 38c:	55                   	push   %ebp
+ 38d:	89 e5                	mov    %esp,%ebp
+ 38f:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 392:	8b 45 08             	mov    0x8(%ebp),%eax
+ 395:	6a 00                	push   $0x0
+ 397:	50                   	push   %eax
+ 398:	e8 fd fc ff ff       	call   9a <xchg>
+ 39d:	83 c4 08             	add    $0x8,%esp
+ 3a0:	83 f8 02             	cmp    $0x2,%eax
+ 3a3:	75 11                	jne    3b6 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 3a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a8:	83 ec 08             	sub    $0x8,%esp
+ 3ab:	6a 01                	push   $0x1
+ 3ad:	50                   	push   %eax
+ 3ae:	e8 e3 03 00 00       	call   796 <futex_wake>
+ 3b3:	83 c4 10             	add    $0x10,%esp
+}
+ 3b6:	90                   	nop
+ 3b7:	c9                   	leave
+ 3b8:	c3                   	ret
+
+000003b9 <cond_init>:
+{
+ 3b9:	55                   	push   %ebp
+ 3ba:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bf:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3c5:	90                   	nop
+ 3c6:	5d                   	pop    %ebp
+ 3c7:	c3                   	ret
+
+000003c8 <cond_wait>:
+{
+ 3c8:	55                   	push   %ebp
+ 3c9:	89 e5                	mov    %esp,%ebp
+ 3cb:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 3ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d1:	8b 00                	mov    (%eax),%eax
+ 3d3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 3d6:	83 ec 0c             	sub    $0xc,%esp
+ 3d9:	ff 75 0c             	push   0xc(%ebp)
+ 3dc:	e8 ab ff ff ff       	call   38c <mutex_unlock>
+ 3e1:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 3e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e7:	83 ec 08             	sub    $0x8,%esp
+ 3ea:	ff 75 f4             	push   -0xc(%ebp)
+ 3ed:	50                   	push   %eax
+ 3ee:	e8 99 03 00 00       	call   78c <futex_wait>
+ 3f3:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3f6:	eb 11                	jmp    409 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 3f8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fb:	83 ec 08             	sub    $0x8,%esp
+ 3fe:	6a 02                	push   $0x2
+ 400:	50                   	push   %eax
+ 401:	e8 86 03 00 00       	call   78c <futex_wait>
+ 406:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 409:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40c:	83 ec 08             	sub    $0x8,%esp
+ 40f:	6a 02                	push   $0x2
+ 411:	50                   	push   %eax
+ 412:	e8 83 fc ff ff       	call   9a <xchg>
+ 417:	83 c4 10             	add    $0x10,%esp
+ 41a:	85 c0                	test   %eax,%eax
+ 41c:	75 da                	jne    3f8 <cond_wait+0x30>
+}
+ 41e:	90                   	nop
+ 41f:	90                   	nop
+ 420:	c9                   	leave
+ 421:	c3                   	ret
+
+00000422 <condbump>:
+{
+ 422:	55                   	push   %ebp
+ 423:	89 e5                	mov    %esp,%ebp
+ 425:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 428:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42b:	8b 00                	mov    (%eax),%eax
+ 42d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 430:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 433:	8d 50 01             	lea    0x1(%eax),%edx
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+ 439:	52                   	push   %edx
+ 43a:	ff 75 fc             	push   -0x4(%ebp)
+ 43d:	50                   	push   %eax
+ 43e:	e8 71 fc ff ff       	call   b4 <cmpxchg>
+ 443:	83 c4 0c             	add    $0xc,%esp
+ 446:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 449:	75 dd                	jne    428 <condbump+0x6>
+}
+ 44b:	90                   	nop
+ 44c:	90                   	nop
+ 44d:	c9                   	leave
+ 44e:	c3                   	ret
+
+0000044f <cond_signal>:
+{
+ 44f:	55                   	push   %ebp
+ 450:	89 e5                	mov    %esp,%ebp
+ 452:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 455:	ff 75 08             	push   0x8(%ebp)
+ 458:	e8 c5 ff ff ff       	call   422 <condbump>
+ 45d:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 460:	8b 45 08             	mov    0x8(%ebp),%eax
+ 463:	83 ec 08             	sub    $0x8,%esp
+ 466:	6a 01                	push   $0x1
+ 468:	50                   	push   %eax
+ 469:	e8 28 03 00 00       	call   796 <futex_wake>
+ 46e:	83 c4 10             	add    $0x10,%esp
+}
+ 471:	90                   	nop
+ 472:	c9                   	leave
+ 473:	c3                   	ret
+
+00000474 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 474:	55                   	push   %ebp
+ 475:	89 e5                	mov    %esp,%ebp
+ 477:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 47a:	ff 75 08             	push   0x8(%ebp)
+ 47d:	e8 a0 ff ff ff       	call   422 <condbump>
+ 482:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+ 488:	83 ec 08             	sub    $0x8,%esp
+ 48b:	68 ff ff ff 7f       	push   $0x7fffffff
+ 490:	50                   	push   %eax
+ 491:	e8 00 03 00 00       	call   796 <futex_wake>
+ 496:	83 c4 10             	add    $0x10,%esp
+}
+ 499:	90                   	nop
+ 49a:	c9                   	leave
+ 49b:	c3                   	ret
+
+0000049c <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 49c:	55                   	push   %ebp
+ 49d:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 49f:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 4a4:	8b 00                	mov    (%eax),%eax
+}
+ 4a6:	5d                   	pop    %ebp
+ 4a7:	c3                   	ret
+
+000004a8 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 4a8:	55                   	push   %ebp
+ 4a9:	89 e5                	mov    %esp,%ebp
+ 4ab:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 4ae:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 4b3:	8b 00                	mov    (%eax),%eax
+ 4b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 4b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4bc:	74 05                	je     4c3 <vgetpid+0x1b>
+    return pid;
+ 4be:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4c1:	eb 05                	jmp    4c8 <vgetpid+0x20>
+  return getpid();
+ 4c3:	e8 74 02 00 00       	call   73c <getpid>
+}
+ 4c8:	c9                   	leave
+ 4c9:	c3                   	ret
+
+000004ca <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 4ca:	55                   	push   %ebp
+ 4cb:	89 e5                	mov    %esp,%ebp
+ 4cd:	57                   	push   %edi
+ 4ce:	56                   	push   %esi
+ 4cf:	53                   	push   %ebx
+ 4d0:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 4d3:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 4da:	e8 f7 fb ff ff       	call   d6 <rdtsc>
+ 4df:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4e2:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 4e5:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 4e8:	29 c8                	sub    %ecx,%eax
+ 4ea:	19 da                	sbb    %ebx,%edx
+ 4ec:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4ef:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 4f2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 4f5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 4f8:	89 d0                	mov    %edx,%eax
+ 4fa:	31 d2                	xor    %edx,%edx
+ 4fc:	89 c1                	mov    %eax,%ecx
+ 4fe:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 503:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 506:	8b 40 04             	mov    0x4(%eax),%eax
+ 509:	ba 00 00 00 00       	mov    $0x0,%edx
+ 50e:	89 df                	mov    %ebx,%edi
+ 510:	0f af f8             	imul   %eax,%edi
+ 513:	89 d6                	mov    %edx,%esi
+ 515:	0f af f1             	imul   %ecx,%esi
+ 518:	01 f7                	add    %esi,%edi
+ 51a:	f7 e1                	mul    %ecx
+ 51c:	89 c1                	mov    %eax,%ecx
+ 51e:	89 d3                	mov    %edx,%ebx
+ 520:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 523:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 525:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 528:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 52b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 52e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 535:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 538:	8b 40 04             	mov    0x4(%eax),%eax
+ 53b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 53e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 545:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 548:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 54b:	89 d7                	mov    %edx,%edi
+ 54d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 550:	0f af fe             	imul   %esi,%edi
+ 553:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 556:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 559:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 55c:	0f af f0             	imul   %eax,%esi
+ 55f:	01 f7                	add    %esi,%edi
+ 561:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 564:	f7 65 d8             	mull   -0x28(%ebp)
+ 567:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 56a:	89 f2                	mov    %esi,%edx
+ 56c:	89 d0                	mov    %edx,%eax
+ 56e:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 570:	01 c8                	add    %ecx,%eax
+ 572:	11 da                	adc    %ebx,%edx
+}
+ 574:	83 c4 24             	add    $0x24,%esp
+ 577:	5b                   	pop    %ebx
+ 578:	5e                   	pop    %esi
+ 579:	5f                   	pop    %edi
+ 57a:	5d                   	pop    %ebp
+ 57b:	c3                   	ret
+
+0000057c <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 57c:	55                   	push   %ebp
+ 57d:	89 e5                	mov    %esp,%ebp
+ 57f:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 582:	8b 45 08             	mov    0x8(%ebp),%eax
+ 585:	8b 50 04             	mov    0x4(%eax),%edx
+ 588:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58b:	8b 00                	mov    (%eax),%eax
+ 58d:	29 c2                	sub    %eax,%edx
+ 58f:	83 fa 1f             	cmp    $0x1f,%edx
+ 592:	76 07                	jbe    59b <ring_queue+0x1f>
+    return -1;
+ 594:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 599:	eb 68                	jmp    603 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 59b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59e:	8b 40 04             	mov    0x4(%eax),%eax
+ 5a1:	83 e0 1f             	and    $0x1f,%eax
+ 5a4:	89 c2                	mov    %eax,%edx
+ 5a6:	89 d0                	mov    %edx,%eax
+ 5a8:	c1 e0 02             	shl    $0x2,%eax
+ 5ab:	01 d0                	add    %edx,%eax
+ 5ad:	c1 e0 02             	shl    $0x2,%eax
+ 5b0:	8d 50 10             	lea    0x10(%eax),%edx
+ 5b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b6:	01 d0                	add    %edx,%eax
+ 5b8:	83 c0 04             	add    $0x4,%eax
+ 5bb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 5be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c1:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5c4:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 5c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c9:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5cc:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 5cf:	8b 55 14             	mov    0x14(%ebp),%edx
+ 5d2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5d5:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 5d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5db:	8b 55 18             	mov    0x18(%ebp),%edx
+ 5de:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 5e1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5e4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 5e7:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 5ea:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 5ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f2:	8b 40 04             	mov    0x4(%eax),%eax
+ 5f5:	8d 50 01             	lea    0x1(%eax),%edx
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fb:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 5fe:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 603:	c9                   	leave
+ 604:	c3                   	ret
+
+00000605 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 605:	55                   	push   %ebp
+ 606:	89 e5                	mov    %esp,%ebp
+ 608:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 60b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 610:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 614:	7f 1a                	jg     630 <ring_submit+0x2b>
+ 616:	8b 45 08             	mov    0x8(%ebp),%eax
+ 619:	8b 40 10             	mov    0x10(%eax),%eax
+ 61c:	83 e0 01             	and    $0x1,%eax
+ 61f:	85 c0                	test   %eax,%eax
+ 621:	74 0d                	je     630 <ring_submit+0x2b>
+ 623:	8b 45 08             	mov    0x8(%ebp),%eax
+ 626:	8b 40 10             	mov    0x10(%eax),%eax
+ 629:	83 e0 02             	and    $0x2,%eax
+ 62c:	85 c0                	test   %eax,%eax
+ 62e:	74 10                	je     640 <ring_submit+0x3b>
+    return ring_enter(min);
+ 630:	83 ec 0c             	sub    $0xc,%esp
+ 633:	ff 75 0c             	push   0xc(%ebp)
+ 636:	e8 83 01 00 00       	call   7be <ring_enter>
+ 63b:	83 c4 10             	add    $0x10,%esp
+ 63e:	eb 10                	jmp    650 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 640:	8b 45 08             	mov    0x8(%ebp),%eax
+ 643:	8b 50 0c             	mov    0xc(%eax),%edx
+ 646:	8b 45 08             	mov    0x8(%ebp),%eax
+ 649:	8b 40 08             	mov    0x8(%eax),%eax
+ 64c:	29 c2                	sub    %eax,%edx
+ 64e:	89 d0                	mov    %edx,%eax
+}
+ 650:	c9                   	leave
+ 651:	c3                   	ret
+
+00000652 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 652:	55                   	push   %ebp
+ 653:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 655:	8b 45 08             	mov    0x8(%ebp),%eax
+ 658:	8b 50 08             	mov    0x8(%eax),%edx
+ 65b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65e:	8b 40 0c             	mov    0xc(%eax),%eax
+ 661:	39 c2                	cmp    %eax,%edx
+ 663:	75 07                	jne    66c <ring_reap+0x1a>
+    return -1;
+ 665:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 66a:	eb 3b                	jmp    6a7 <ring_reap+0x55>
+  __sync_synchronize();
+ 66c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 671:	8b 45 08             	mov    0x8(%ebp),%eax
+ 674:	8b 40 08             	mov    0x8(%eax),%eax
+ 677:	83 e0 1f             	and    $0x1f,%eax
+ 67a:	89 c2                	mov    %eax,%edx
+ 67c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 67f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 682:	83 c2 52             	add    $0x52,%edx
+ 685:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 689:	8b 02                	mov    (%edx),%eax
+ 68b:	8b 52 04             	mov    0x4(%edx),%edx
+ 68e:	89 01                	mov    %eax,(%ecx)
+ 690:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 693:	8b 45 08             	mov    0x8(%ebp),%eax
+ 696:	8b 40 08             	mov    0x8(%eax),%eax
+ 699:	8d 50 01             	lea    0x1(%eax),%edx
+ 69c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69f:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 6a2:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6a7:	5d                   	pop    %ebp
+ 6a8:	c3                   	ret
+
+000006a9 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 6a9:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 6b0:	74 0a                	je     6bc <usyscall+0x13>
+  movl %esp, %ecx
+ 6b2:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6b4:	ba bb 06 00 00       	mov    $0x6bb,%edx
+  sysenter
+ 6b9:	0f 34                	sysenter
+2:
+  ret
+ 6bb:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 6bc:	cd 40                	int    $0x40
+  ret
+ 6be:	c3                   	ret
+
+000006bf <fork>:
+
+SYSCALL(fork)
+ 6bf:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6c4:	eb e3                	jmp    6a9 <usyscall>
+
+000006c6 <exit>:
+SYSCALL(exit)
+ 6c6:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6cb:	eb dc                	jmp    6a9 <usyscall>
+
+000006cd <wait>:
+SYSCALL(wait)
+ 6cd:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6d2:	eb d5                	jmp    6a9 <usyscall>
+
+000006d4 <pipe>:
+SYSCALL(pipe)
+ 6d4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6d9:	eb ce                	jmp    6a9 <usyscall>
+
+000006db <read>:
+SYSCALL(read)
+ 6db:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6e0:	eb c7                	jmp    6a9 <usyscall>
+
+000006e2 <write>:
+SYSCALL(write)
+ 6e2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 6e7:	eb c0                	jmp    6a9 <usyscall>
+
+000006e9 <close>:
+SYSCALL(close)
+ 6e9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6ee:	eb b9                	jmp    6a9 <usyscall>
+
+000006f0 <kill>:
+SYSCALL(kill)
+ 6f0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6f5:	eb b2                	jmp    6a9 <usyscall>
+
+000006f7 <exec>:
+SYSCALL(exec)
+ 6f7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6fc:	eb ab                	jmp    6a9 <usyscall>
+
+000006fe <open>:
+SYSCALL(open)
+ 6fe:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 703:	eb a4                	jmp    6a9 <usyscall>
+
+00000705 <mknod>:
+SYSCALL(mknod)
+ 705:	b8 11 00 00 00       	mov    $0x11,%eax
+ 70a:	eb 9d                	jmp    6a9 <usyscall>
+
+0000070c <unlink>:
+SYSCALL(unlink)
+ 70c:	b8 12 00 00 00       	mov    $0x12,%eax
+ 711:	eb 96                	jmp    6a9 <usyscall>
+
+00000713 <fstat>:
+SYSCALL(fstat)
+ 713:	b8 08 00 00 00       	mov    $0x8,%eax
+ 718:	eb 8f                	jmp    6a9 <usyscall>
+
+0000071a <link>:
+SYSCALL(link)
+ 71a:	b8 13 00 00 00       	mov    $0x13,%eax
+ 71f:	eb 88                	jmp    6a9 <usyscall>
+
+00000721 <mkdir>:
+SYSCALL(mkdir)
+ 721:	b8 14 00 00 00       	mov    $0x14,%eax
+ 726:	eb 81                	jmp    6a9 <usyscall>
+
+00000728 <chdir>:
+SYSCALL(chdir)
+ 728:	b8 09 00 00 00       	mov    $0x9,%eax
+ 72d:	e9 77 ff ff ff       	jmp    6a9 <usyscall>
+
+00000732 <dup>:
+SYSCALL(dup)
+ 732:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 737:	e9 6d ff ff ff       	jmp    6a9 <usyscall>
+
+0000073c <getpid>:
+SYSCALL(getpid)
+ 73c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 741:	e9 63 ff ff ff       	jmp    6a9 <usyscall>
+
+00000746 <sbrk>:
+SYSCALL(sbrk)
+ 746:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 74b:	e9 59 ff ff ff       	jmp    6a9 <usyscall>
+
+00000750 <sleep>:
+SYSCALL(sleep)
+ 750:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 755:	e9 4f ff ff ff       	jmp    6a9 <usyscall>
+
+0000075a <uptime>:
+SYSCALL(uptime)
+ 75a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 75f:	e9 45 ff ff ff       	jmp    6a9 <usyscall>
+
+00000764 <kmstat>:
+SYSCALL(kmstat)
+ 764:	b8 16 00 00 00       	mov    $0x16,%eax
+ 769:	e9 3b ff ff ff       	jmp    6a9 <usyscall>
+
+0000076e <setpriority>:
+SYSCALL(setpriority)
+ 76e:	b8 17 00 00 00       	mov    $0x17,%eax
+ 773:	e9 31 ff ff ff       	jmp    6a9 <usyscall>
+
+00000778 <clone>:
+SYSCALL(clone)
+ 778:	b8 18 00 00 00       	mov    $0x18,%eax
+ 77d:	e9 27 ff ff ff       	jmp    6a9 <usyscall>
+
+00000782 <join>:
+SYSCALL(join)
+ 782:	b8 19 00 00 00       	mov    $0x19,%eax
+ 787:	e9 1d ff ff ff       	jmp    6a9 <usyscall>
+
+0000078c <futex_wait>:
+SYSCALL(futex_wait)
+ 78c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 791:	e9 13 ff ff ff       	jmp    6a9 <usyscall>
+
+00000796 <futex_wake>:
+SYSCALL(futex_wake)
+ 796:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 79b:	e9 09 ff ff ff       	jmp    6a9 <usyscall>
+
+000007a0 <lockstat>:
+SYSCALL(lockstat)
+ 7a0:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7a5:	e9 ff fe ff ff       	jmp    6a9 <usyscall>
+
+000007aa <sysstat>:
+SYSCALL(sysstat)
+ 7aa:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7af:	e9 f5 fe ff ff       	jmp    6a9 <usyscall>
+
+000007b4 <ring_setup>:
+SYSCALL(ring_setup)
+ 7b4:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7b9:	e9 eb fe ff ff       	jmp    6a9 <usyscall>
+
+000007be <ring_enter>:
+SYSCALL(ring_enter)
+ 7be:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7c3:	e9 e1 fe ff ff       	jmp    6a9 <usyscall>
+
+000007c8 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7c8:	55                   	push   %ebp
+ 7c9:	89 e5                	mov    %esp,%ebp
+ 7cb:	83 ec 18             	sub    $0x18,%esp
+ 7ce:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d1:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7d4:	83 ec 04             	sub    $0x4,%esp
+ 7d7:	6a 01                	push   $0x1
+ 7d9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7dc:	50                   	push   %eax
+ 7dd:	ff 75 08             	push   0x8(%ebp)
+ 7e0:	e8 fd fe ff ff       	call   6e2 <write>
+ 7e5:	83 c4 10             	add    $0x10,%esp
+}
+ 7e8:	90                   	nop
+ 7e9:	c9                   	leave
+ 7ea:	c3                   	ret
+
+000007eb <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7eb:	55                   	push   %ebp
+ 7ec:	89 e5                	mov    %esp,%ebp
+ 7ee:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7f1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7f8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7fc:	74 17                	je     815 <printint+0x2a>
+ 7fe:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 802:	79 11                	jns    815 <printint+0x2a>
+    neg = 1;
+ 804:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 80b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 80e:	f7 d8                	neg    %eax
+ 810:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 813:	eb 06                	jmp    81b <printint+0x30>
+  } else {
+    x = xx;
+ 815:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 818:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 81b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 822:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 825:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 828:	ba 00 00 00 00       	mov    $0x0,%edx
+ 82d:	f7 f1                	div    %ecx
+ 82f:	89 d1                	mov    %edx,%ecx
+ 831:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 834:	8d 50 01             	lea    0x1(%eax),%edx
+ 837:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 83a:	0f b6 91 c4 11 00 00 	movzbl 0x11c4(%ecx),%edx
+ 841:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 845:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 848:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 84b:	ba 00 00 00 00       	mov    $0x0,%edx
+ 850:	f7 f1                	div    %ecx
+ 852:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 855:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 859:	75 c7                	jne    822 <printint+0x37>
+  if(neg)
+ 85b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 85f:	74 2d                	je     88e <printint+0xa3>
+    buf[i++] = '-';
+ 861:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 864:	8d 50 01             	lea    0x1(%eax),%edx
+ 867:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 86a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 86f:	eb 1d                	jmp    88e <printint+0xa3>
+    putc(fd, buf[i]);
+ 871:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 874:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 877:	01 d0                	add    %edx,%eax
+ 879:	0f b6 00             	movzbl (%eax),%eax
+ 87c:	0f be c0             	movsbl %al,%eax
+ 87f:	83 ec 08             	sub    $0x8,%esp
+ 882:	50                   	push   %eax
+ 883:	ff 75 08             	push   0x8(%ebp)
+ 886:	e8 3d ff ff ff       	call   7c8 <putc>
+ 88b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 88e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 892:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 896:	79 d9                	jns    871 <printint+0x86>
+}
+ 898:	90                   	nop
+ 899:	90                   	nop
+ 89a:	c9                   	leave
+ 89b:	c3                   	ret
+
+0000089c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 89c:	55                   	push   %ebp
+ 89d:	89 e5                	mov    %esp,%ebp
+ 89f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8a2:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8a9:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8ac:	83 c0 04             	add    $0x4,%eax
+ 8af:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8b2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8b9:	e9 59 01 00 00       	jmp    a17 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8be:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8c1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8c4:	01 d0                	add    %edx,%eax
+ 8c6:	0f b6 00             	movzbl (%eax),%eax
+ 8c9:	0f be c0             	movsbl %al,%eax
+ 8cc:	25 ff 00 00 00       	and    $0xff,%eax
+ 8d1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8d4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8d8:	75 2c                	jne    906 <printf+0x6a>
+      if(c == '%'){
+ 8da:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8de:	75 0c                	jne    8ec <printf+0x50>
+        state = '%';
+ 8e0:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 8e7:	e9 27 01 00 00       	jmp    a13 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8ef:	0f be c0             	movsbl %al,%eax
+ 8f2:	83 ec 08             	sub    $0x8,%esp
+ 8f5:	50                   	push   %eax
+ 8f6:	ff 75 08             	push   0x8(%ebp)
+ 8f9:	e8 ca fe ff ff       	call   7c8 <putc>
+ 8fe:	83 c4 10             	add    $0x10,%esp
+ 901:	e9 0d 01 00 00       	jmp    a13 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 906:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 90a:	0f 85 03 01 00 00    	jne    a13 <printf+0x177>
+      if(c == 'd'){
+ 910:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 914:	75 1e                	jne    934 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 916:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 919:	8b 00                	mov    (%eax),%eax
+ 91b:	6a 01                	push   $0x1
+ 91d:	6a 0a                	push   $0xa
+ 91f:	50                   	push   %eax
+ 920:	ff 75 08             	push   0x8(%ebp)
+ 923:	e8 c3 fe ff ff       	call   7eb <printint>
+ 928:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 92b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 92f:	e9 d8 00 00 00       	jmp    a0c <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 934:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 938:	74 06                	je     940 <printf+0xa4>
+ 93a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 93e:	75 1e                	jne    95e <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 940:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 943:	8b 00                	mov    (%eax),%eax
+ 945:	6a 00                	push   $0x0
+ 947:	6a 10                	push   $0x10
+ 949:	50                   	push   %eax
+ 94a:	ff 75 08             	push   0x8(%ebp)
+ 94d:	e8 99 fe ff ff       	call   7eb <printint>
+ 952:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 955:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 959:	e9 ae 00 00 00       	jmp    a0c <printf+0x170>
+      } else if(c == 's'){
+ 95e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 962:	75 43                	jne    9a7 <printf+0x10b>
+        s = (char*)*ap;
+ 964:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 967:	8b 00                	mov    (%eax),%eax
+ 969:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 96c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 970:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 974:	75 25                	jne    99b <printf+0xff>
+          s = "(null)";
+ 976:	c7 45 f4 02 0d 00 00 	movl   $0xd02,-0xc(%ebp)
+        while(*s != 0){
+ 97d:	eb 1c                	jmp    99b <printf+0xff>
+          putc(fd, *s);
+ 97f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 982:	0f b6 00             	movzbl (%eax),%eax
+ 985:	0f be c0             	movsbl %al,%eax
+ 988:	83 ec 08             	sub    $0x8,%esp
+ 98b:	50                   	push   %eax
+ 98c:	ff 75 08             	push   0x8(%ebp)
+ 98f:	e8 34 fe ff ff       	call   7c8 <putc>
+ 994:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 997:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 99b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99e:	0f b6 00             	movzbl (%eax),%eax
+ 9a1:	84 c0                	test   %al,%al
+ 9a3:	75 da                	jne    97f <printf+0xe3>
+ 9a5:	eb 65                	jmp    a0c <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9a7:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9ab:	75 1d                	jne    9ca <printf+0x12e>
+        putc(fd, *ap);
+ 9ad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9b0:	8b 00                	mov    (%eax),%eax
+ 9b2:	0f be c0             	movsbl %al,%eax
+ 9b5:	83 ec 08             	sub    $0x8,%esp
+ 9b8:	50                   	push   %eax
+ 9b9:	ff 75 08             	push   0x8(%ebp)
+ 9bc:	e8 07 fe ff ff       	call   7c8 <putc>
+ 9c1:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9c4:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9c8:	eb 42                	jmp    a0c <printf+0x170>
+      } else if(c == '%'){
+ 9ca:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9ce:	75 17                	jne    9e7 <printf+0x14b>
+        putc(fd, c);
+ 9d0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9d3:	0f be c0             	movsbl %al,%eax
+ 9d6:	83 ec 08             	sub    $0x8,%esp
+ 9d9:	50                   	push   %eax
+ 9da:	ff 75 08             	push   0x8(%ebp)
+ 9dd:	e8 e6 fd ff ff       	call   7c8 <putc>
+ 9e2:	83 c4 10             	add    $0x10,%esp
+ 9e5:	eb 25                	jmp    a0c <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 9e7:	83 ec 08             	sub    $0x8,%esp
+ 9ea:	6a 25                	push   $0x25
+ 9ec:	ff 75 08             	push   0x8(%ebp)
+ 9ef:	e8 d4 fd ff ff       	call   7c8 <putc>
+ 9f4:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9f7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9fa:	0f be c0             	movsbl %al,%eax
+ 9fd:	83 ec 08             	sub    $0x8,%esp
+ a00:	50                   	push   %eax
+ a01:	ff 75 08             	push   0x8(%ebp)
+ a04:	e8 bf fd ff ff       	call   7c8 <putc>
+ a09:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a0c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a13:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a17:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a1a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a1d:	01 d0                	add    %edx,%eax
+ a1f:	0f b6 00             	movzbl (%eax),%eax
+ a22:	84 c0                	test   %al,%al
+ a24:	0f 85 94 fe ff ff    	jne    8be <printf+0x22>
+    }
+  }
+}
+ a2a:	90                   	nop
+ a2b:	90                   	nop
+ a2c:	c9                   	leave
+ a2d:	c3                   	ret
+
+00000a2e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a2e:	55                   	push   %ebp
+ a2f:	89 e5                	mov    %esp,%ebp
+ a31:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a34:	8b 45 08             	mov    0x8(%ebp),%eax
+ a37:	83 e8 08             	sub    $0x8,%eax
+ a3a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a3d:	a1 e0 11 00 00       	mov    0x11e0,%eax
+ a42:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a45:	eb 24                	jmp    a6b <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4a:	8b 00                	mov    (%eax),%eax
+ a4c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a4f:	72 12                	jb     a63 <free+0x35>
+ a51:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a54:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a57:	72 24                	jb     a7d <free+0x4f>
+ a59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a5c:	8b 00                	mov    (%eax),%eax
+ a5e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a61:	72 1a                	jb     a7d <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a66:	8b 00                	mov    (%eax),%eax
+ a68:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a6b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a6e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a71:	73 d4                	jae    a47 <free+0x19>
+ a73:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a76:	8b 00                	mov    (%eax),%eax
+ a78:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a7b:	73 ca                	jae    a47 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a7d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a80:	8b 40 04             	mov    0x4(%eax),%eax
+ a83:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a8a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8d:	01 c2                	add    %eax,%edx
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	8b 00                	mov    (%eax),%eax
+ a94:	39 c2                	cmp    %eax,%edx
+ a96:	75 24                	jne    abc <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a98:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9b:	8b 50 04             	mov    0x4(%eax),%edx
+ a9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa1:	8b 00                	mov    (%eax),%eax
+ aa3:	8b 40 04             	mov    0x4(%eax),%eax
+ aa6:	01 c2                	add    %eax,%edx
+ aa8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aab:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab1:	8b 00                	mov    (%eax),%eax
+ ab3:	8b 10                	mov    (%eax),%edx
+ ab5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab8:	89 10                	mov    %edx,(%eax)
+ aba:	eb 0a                	jmp    ac6 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ abc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abf:	8b 10                	mov    (%eax),%edx
+ ac1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac4:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ac6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac9:	8b 40 04             	mov    0x4(%eax),%eax
+ acc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ad3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ad6:	01 d0                	add    %edx,%eax
+ ad8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ adb:	75 20                	jne    afd <free+0xcf>
+    p->s.size += bp->s.size;
+ add:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae0:	8b 50 04             	mov    0x4(%eax),%edx
+ ae3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae6:	8b 40 04             	mov    0x4(%eax),%eax
+ ae9:	01 c2                	add    %eax,%edx
+ aeb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aee:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ af1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ af4:	8b 10                	mov    (%eax),%edx
+ af6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af9:	89 10                	mov    %edx,(%eax)
+ afb:	eb 08                	jmp    b05 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ afd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b00:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b03:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b08:	a3 e0 11 00 00       	mov    %eax,0x11e0
+}
+ b0d:	90                   	nop
+ b0e:	c9                   	leave
+ b0f:	c3                   	ret
+
+00000b10 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b10:	55                   	push   %ebp
+ b11:	89 e5                	mov    %esp,%ebp
+ b13:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b16:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b1d:	77 07                	ja     b26 <morecore+0x16>
+    nu = 4096;
+ b1f:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b26:	8b 45 08             	mov    0x8(%ebp),%eax
+ b29:	c1 e0 03             	shl    $0x3,%eax
+ b2c:	83 ec 0c             	sub    $0xc,%esp
+ b2f:	50                   	push   %eax
+ b30:	e8 11 fc ff ff       	call   746 <sbrk>
+ b35:	83 c4 10             	add    $0x10,%esp
+ b38:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b3b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b3f:	75 07                	jne    b48 <morecore+0x38>
+    return 0;
+ b41:	b8 00 00 00 00       	mov    $0x0,%eax
+ b46:	eb 26                	jmp    b6e <morecore+0x5e>
+  hp = (Header*)p;
+ b48:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b4e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b51:	8b 55 08             	mov    0x8(%ebp),%edx
+ b54:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b57:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b5a:	83 c0 08             	add    $0x8,%eax
+ b5d:	83 ec 0c             	sub    $0xc,%esp
+ b60:	50                   	push   %eax
+ b61:	e8 c8 fe ff ff       	call   a2e <free>
+ b66:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b69:	a1 e0 11 00 00       	mov    0x11e0,%eax
+}
+ b6e:	c9                   	leave
+ b6f:	c3                   	ret
+
+00000b70 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b70:	55                   	push   %ebp
+ b71:	89 e5                	mov    %esp,%ebp
+ b73:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b76:	8b 45 08             	mov    0x8(%ebp),%eax
+ b79:	83 c0 07             	add    $0x7,%eax
+ b7c:	c1 e8 03             	shr    $0x3,%eax
+ b7f:	83 c0 01             	add    $0x1,%eax
+ b82:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b85:	a1 e0 11 00 00       	mov    0x11e0,%eax
+ b8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b8d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b91:	75 23                	jne    bb6 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b93:	c7 45 f0 d8 11 00 00 	movl   $0x11d8,-0x10(%ebp)
+ b9a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b9d:	a3 e0 11 00 00       	mov    %eax,0x11e0
+ ba2:	a1 e0 11 00 00       	mov    0x11e0,%eax
+ ba7:	a3 d8 11 00 00       	mov    %eax,0x11d8
+    base.s.size = 0;
+ bac:	c7 05 dc 11 00 00 00 	movl   $0x0,0x11dc
+ bb3:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bb9:	8b 00                	mov    (%eax),%eax
+ bbb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc1:	8b 40 04             	mov    0x4(%eax),%eax
+ bc4:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ bc7:	72 4d                	jb     c16 <malloc+0xa6>
+      if(p->s.size == nunits)
+ bc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bcc:	8b 40 04             	mov    0x4(%eax),%eax
+ bcf:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bd2:	75 0c                	jne    be0 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ bd4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bd7:	8b 10                	mov    (%eax),%edx
+ bd9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bdc:	89 10                	mov    %edx,(%eax)
+ bde:	eb 26                	jmp    c06 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ be0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be3:	8b 40 04             	mov    0x4(%eax),%eax
+ be6:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ be9:	89 c2                	mov    %eax,%edx
+ beb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bee:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ bf1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf4:	8b 40 04             	mov    0x4(%eax),%eax
+ bf7:	c1 e0 03             	shl    $0x3,%eax
+ bfa:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bfd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c00:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c03:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c09:	a3 e0 11 00 00       	mov    %eax,0x11e0
+      return (void*)(p + 1);
+ c0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c11:	83 c0 08             	add    $0x8,%eax
+ c14:	eb 3b                	jmp    c51 <malloc+0xe1>
+    }
+    if(p == freep)
+ c16:	a1 e0 11 00 00       	mov    0x11e0,%eax
+ c1b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c1e:	75 1e                	jne    c3e <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c20:	83 ec 0c             	sub    $0xc,%esp
+ c23:	ff 75 ec             	push   -0x14(%ebp)
+ c26:	e8 e5 fe ff ff       	call   b10 <morecore>
+ c2b:	83 c4 10             	add    $0x10,%esp
+ c2e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c31:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c35:	75 07                	jne    c3e <malloc+0xce>
+        return 0;
+ c37:	b8 00 00 00 00       	mov    $0x0,%eax
+ c3c:	eb 13                	jmp    c51 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c3e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c41:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c47:	8b 00                	mov    (%eax),%eax
+ c49:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c4c:	e9 6d ff ff ff       	jmp    bbe <malloc+0x4e>
+  }
+}
+ c51:	c9                   	leave
+ c52:	c3                   	ret
+
+00000c53 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c53:	55                   	push   %ebp
+ c54:	89 e5                	mov    %esp,%ebp
+ c56:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ c59:	83 ec 0c             	sub    $0xc,%esp
+ c5c:	68 00 10 00 00       	push   $0x1000
+ c61:	e8 0a ff ff ff       	call   b70 <malloc>
+ c66:	83 c4 10             	add    $0x10,%esp
+ c69:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c6c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c70:	75 07                	jne    c79 <thread_create+0x26>
+    return -1;
+ c72:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c77:	eb 2e                	jmp    ca7 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ c79:	83 ec 04             	sub    $0x4,%esp
+ c7c:	ff 75 f4             	push   -0xc(%ebp)
+ c7f:	ff 75 0c             	push   0xc(%ebp)
+ c82:	ff 75 08             	push   0x8(%ebp)
+ c85:	e8 ee fa ff ff       	call   778 <clone>
+ c8a:	83 c4 10             	add    $0x10,%esp
+ c8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c90:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c94:	79 0e                	jns    ca4 <thread_create+0x51>
+    free(stack);
+ c96:	83 ec 0c             	sub    $0xc,%esp
+ c99:	ff 75 f4             	push   -0xc(%ebp)
+ c9c:	e8 8d fd ff ff       	call   a2e <free>
+ ca1:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ca4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ca7:	c9                   	leave
+ ca8:	c3                   	ret
+
+00000ca9 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ ca9:	55                   	push   %ebp
+ caa:	89 e5                	mov    %esp,%ebp
+ cac:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ caf:	83 ec 0c             	sub    $0xc,%esp
+ cb2:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ cb5:	50                   	push   %eax
+ cb6:	e8 c7 fa ff ff       	call   782 <join>
+ cbb:	83 c4 10             	add    $0x10,%esp
+ cbe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cc1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cc5:	78 0f                	js     cd6 <thread_join+0x2d>
+    free(stack);
+ cc7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cca:	83 ec 0c             	sub    $0xc,%esp
+ ccd:	50                   	push   %eax
+ cce:	e8 5b fd ff ff       	call   a2e <free>
+ cd3:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ cd6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ cd9:	c9                   	leave
+ cda:	c3                   	ret
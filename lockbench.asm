@@ -0,0 +1,2046 @@
+
+_lockbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <op>:
+#include "stat.h"
+#include "user.h"
+
+int
+op(int which)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 08             	sub    $0x8,%esp
+  if(which == 0)
+   6:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+   a:	75 0f                	jne    1b <op+0x1b>
+    return kill(-1);
+   c:	83 ec 0c             	sub    $0xc,%esp
+   f:	6a ff                	push   $0xffffffff
+  11:	e8 f9 08 00 00       	call   90f <kill>
+  16:	83 c4 10             	add    $0x10,%esp
+  19:	eb 05                	jmp    20 <op+0x20>
+  return uptime();
+  1b:	e8 59 09 00 00       	call   979 <uptime>
+}
+  20:	c9                   	leave
+  21:	c3                   	ret
+
+00000022 <hammer>:
+
+// Count operations from start until start+dur ticks.
+int
+hammer(int which, int start, int dur)
+{
+  22:	55                   	push   %ebp
+  23:	89 e5                	mov    %esp,%ebp
+  25:	83 ec 18             	sub    $0x18,%esp
+  int n, i;
+
+  while(uptime() < start)
+  28:	90                   	nop
+  29:	e8 4b 09 00 00       	call   979 <uptime>
+  2e:	39 45 0c             	cmp    %eax,0xc(%ebp)
+  31:	7f f6                	jg     29 <hammer+0x7>
+    ;
+  n = 0;
+  33:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  while(uptime() < start + dur){
+  3a:	eb 25                	jmp    61 <hammer+0x3f>
+    for(i = 0; i < 64; i++)
+  3c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  43:	eb 12                	jmp    57 <hammer+0x35>
+      op(which);
+  45:	83 ec 0c             	sub    $0xc,%esp
+  48:	ff 75 08             	push   0x8(%ebp)
+  4b:	e8 b0 ff ff ff       	call   0 <op>
+  50:	83 c4 10             	add    $0x10,%esp
+    for(i = 0; i < 64; i++)
+  53:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  57:	83 7d f0 3f          	cmpl   $0x3f,-0x10(%ebp)
+  5b:	7e e8                	jle    45 <hammer+0x23>
+    n += 64;
+  5d:	83 45 f4 40          	addl   $0x40,-0xc(%ebp)
+  while(uptime() < start + dur){
+  61:	e8 13 09 00 00       	call   979 <uptime>
+  66:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  69:	8b 55 10             	mov    0x10(%ebp),%edx
+  6c:	01 ca                	add    %ecx,%edx
+  6e:	39 d0                	cmp    %edx,%eax
+  70:	7c ca                	jl     3c <hammer+0x1a>
+  }
+  return n;
+  72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  75:	c9                   	leave
+  76:	c3                   	ret
+
+00000077 <run>:
+
+void
+run(int which, int nproc, int dur)
+{
+  77:	55                   	push   %ebp
+  78:	89 e5                	mov    %esp,%ebp
+  7a:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], i, n, min, max, total, start;
+
+  if(pipe(fds) < 0){
+  7d:	83 ec 0c             	sub    $0xc,%esp
+  80:	8d 45 dc             	lea    -0x24(%ebp),%eax
+  83:	50                   	push   %eax
+  84:	e8 6a 08 00 00       	call   8f3 <pipe>
+  89:	83 c4 10             	add    $0x10,%esp
+  8c:	85 c0                	test   %eax,%eax
+  8e:	79 17                	jns    a7 <run+0x30>
+    printf(2, "lockbench: pipe failed\n");
+  90:	83 ec 08             	sub    $0x8,%esp
+  93:	68 fc 0e 00 00       	push   $0xefc
+  98:	6a 02                	push   $0x2
+  9a:	e8 1c 0a 00 00       	call   abb <printf>
+  9f:	83 c4 10             	add    $0x10,%esp
+    exit();
+  a2:	e8 3e 08 00 00       	call   8e5 <exit>
+  }
+  start = uptime() + 5;
+  a7:	e8 cd 08 00 00       	call   979 <uptime>
+  ac:	83 c0 05             	add    $0x5,%eax
+  af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < nproc; i++){
+  b2:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b9:	eb 5c                	jmp    117 <run+0xa0>
+    switch(fork()){
+  bb:	e8 1e 08 00 00       	call   8de <fork>
+  c0:	83 f8 ff             	cmp    $0xffffffff,%eax
+  c3:	74 06                	je     cb <run+0x54>
+  c5:	85 c0                	test   %eax,%eax
+  c7:	74 19                	je     e2 <run+0x6b>
+  c9:	eb 48                	jmp    113 <run+0x9c>
+    case -1:
+      printf(2, "lockbench: fork failed\n");
+  cb:	83 ec 08             	sub    $0x8,%esp
+  ce:	68 14 0f 00 00       	push   $0xf14
+  d3:	6a 02                	push   $0x2
+  d5:	e8 e1 09 00 00       	call   abb <printf>
+  da:	83 c4 10             	add    $0x10,%esp
+      exit();
+  dd:	e8 03 08 00 00       	call   8e5 <exit>
+    case 0:
+      n = hammer(which, start, dur);
+  e2:	83 ec 04             	sub    $0x4,%esp
+  e5:	ff 75 10             	push   0x10(%ebp)
+  e8:	ff 75 e4             	push   -0x1c(%ebp)
+  eb:	ff 75 08             	push   0x8(%ebp)
+  ee:	e8 2f ff ff ff       	call   22 <hammer>
+  f3:	83 c4 10             	add    $0x10,%esp
+  f6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+      write(fds[1], &n, sizeof(n));
+  f9:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  fc:	83 ec 04             	sub    $0x4,%esp
+  ff:	6a 04                	push   $0x4
+ 101:	8d 55 d8             	lea    -0x28(%ebp),%edx
+ 104:	52                   	push   %edx
+ 105:	50                   	push   %eax
+ 106:	e8 f6 07 00 00       	call   901 <write>
+ 10b:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 10e:	e8 d2 07 00 00       	call   8e5 <exit>
+  for(i = 0; i < nproc; i++){
+ 113:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 11a:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 11d:	7c 9c                	jl     bb <run+0x44>
+    }
+  }
+  close(fds[1]);
+ 11f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 122:	83 ec 0c             	sub    $0xc,%esp
+ 125:	50                   	push   %eax
+ 126:	e8 dd 07 00 00       	call   908 <close>
+ 12b:	83 c4 10             	add    $0x10,%esp
+  total = max = 0;
+ 12e:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+ 135:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 138:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  min = 0x7fffffff;
+ 13b:	c7 45 f0 ff ff ff 7f 	movl   $0x7fffffff,-0x10(%ebp)
+  for(i = 0; i < nproc; i++){
+ 142:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 149:	eb 57                	jmp    1a2 <run+0x12b>
+    if(read(fds[0], &n, sizeof(n)) != sizeof(n)){
+ 14b:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 14e:	83 ec 04             	sub    $0x4,%esp
+ 151:	6a 04                	push   $0x4
+ 153:	8d 55 d8             	lea    -0x28(%ebp),%edx
+ 156:	52                   	push   %edx
+ 157:	50                   	push   %eax
+ 158:	e8 9d 07 00 00       	call   8fa <read>
+ 15d:	83 c4 10             	add    $0x10,%esp
+ 160:	83 f8 04             	cmp    $0x4,%eax
+ 163:	74 17                	je     17c <run+0x105>
+      printf(2, "lockbench: read failed\n");
+ 165:	83 ec 08             	sub    $0x8,%esp
+ 168:	68 2c 0f 00 00       	push   $0xf2c
+ 16d:	6a 02                	push   $0x2
+ 16f:	e8 47 09 00 00       	call   abb <printf>
+ 174:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 177:	e8 69 07 00 00       	call   8e5 <exit>
+    }
+    total += n;
+ 17c:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 17f:	01 45 e8             	add    %eax,-0x18(%ebp)
+    if(n < min)
+ 182:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 185:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+ 188:	7e 06                	jle    190 <run+0x119>
+      min = n;
+ 18a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 18d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(n > max)
+ 190:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 193:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ 196:	7d 06                	jge    19e <run+0x127>
+      max = n;
+ 198:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 19b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  for(i = 0; i < nproc; i++){
+ 19e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1a2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1a5:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 1a8:	7c a1                	jl     14b <run+0xd4>
+  }
+  close(fds[0]);
+ 1aa:	8b 45 dc             	mov    -0x24(%ebp),%eax
+ 1ad:	83 ec 0c             	sub    $0xc,%esp
+ 1b0:	50                   	push   %eax
+ 1b1:	e8 52 07 00 00       	call   908 <close>
+ 1b6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < nproc; i++)
+ 1b9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1c0:	eb 09                	jmp    1cb <run+0x154>
+    wait();
+ 1c2:	e8 25 07 00 00       	call   8ec <wait>
+  for(i = 0; i < nproc; i++)
+ 1c7:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1ce:	3b 45 0c             	cmp    0xc(%ebp),%eax
+ 1d1:	7c ef                	jl     1c2 <run+0x14b>
+
+  printf(1, "lockbench: %s, %d procs: %d ops/tick, per proc min %d max %d\n",
+ 1d3:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 1d6:	99                   	cltd
+ 1d7:	f7 7d 10             	idivl  0x10(%ebp)
+ 1da:	89 c2                	mov    %eax,%edx
+ 1dc:	83 7d 08 00          	cmpl   $0x0,0x8(%ebp)
+ 1e0:	75 07                	jne    1e9 <run+0x172>
+ 1e2:	b8 44 0f 00 00       	mov    $0xf44,%eax
+ 1e7:	eb 05                	jmp    1ee <run+0x177>
+ 1e9:	b8 56 0f 00 00       	mov    $0xf56,%eax
+ 1ee:	83 ec 04             	sub    $0x4,%esp
+ 1f1:	ff 75 ec             	push   -0x14(%ebp)
+ 1f4:	ff 75 f0             	push   -0x10(%ebp)
+ 1f7:	52                   	push   %edx
+ 1f8:	ff 75 0c             	push   0xc(%ebp)
+ 1fb:	50                   	push   %eax
+ 1fc:	68 6c 0f 00 00       	push   $0xf6c
+ 201:	6a 01                	push   $0x1
+ 203:	e8 b3 08 00 00       	call   abb <printf>
+ 208:	83 c4 20             	add    $0x20,%esp
+         which == 0 ? "ptable.lock (mcs)" : "tickslock (ticket)",
+         nproc, total / dur, min, max);
+}
+ 20b:	90                   	nop
+ 20c:	c9                   	leave
+ 20d:	c3                   	ret
+
+0000020e <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 20e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 212:	83 e4 f0             	and    $0xfffffff0,%esp
+ 215:	ff 71 fc             	push   -0x4(%ecx)
+ 218:	55                   	push   %ebp
+ 219:	89 e5                	mov    %esp,%ebp
+ 21b:	53                   	push   %ebx
+ 21c:	51                   	push   %ecx
+ 21d:	83 ec 10             	sub    $0x10,%esp
+ 220:	89 cb                	mov    %ecx,%ebx
+  int nproc, dur;
+
+  nproc = 8;
+ 222:	c7 45 f4 08 00 00 00 	movl   $0x8,-0xc(%ebp)
+  dur = 100;
+ 229:	c7 45 f0 64 00 00 00 	movl   $0x64,-0x10(%ebp)
+  if(argc > 1)
+ 230:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 233:	7e 17                	jle    24c <main+0x3e>
+    nproc = atoi(argv[1]);
+ 235:	8b 43 04             	mov    0x4(%ebx),%eax
+ 238:	83 c0 04             	add    $0x4,%eax
+ 23b:	8b 00                	mov    (%eax),%eax
+ 23d:	83 ec 0c             	sub    $0xc,%esp
+ 240:	50                   	push   %eax
+ 241:	e8 64 02 00 00       	call   4aa <atoi>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(argc > 2)
+ 24c:	83 3b 02             	cmpl   $0x2,(%ebx)
+ 24f:	7e 17                	jle    268 <main+0x5a>
+    dur = atoi(argv[2]);
+ 251:	8b 43 04             	mov    0x4(%ebx),%eax
+ 254:	83 c0 08             	add    $0x8,%eax
+ 257:	8b 00                	mov    (%eax),%eax
+ 259:	83 ec 0c             	sub    $0xc,%esp
+ 25c:	50                   	push   %eax
+ 25d:	e8 48 02 00 00       	call   4aa <atoi>
+ 262:	83 c4 10             	add    $0x10,%esp
+ 265:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  run(0, nproc, dur);
+ 268:	83 ec 04             	sub    $0x4,%esp
+ 26b:	ff 75 f0             	push   -0x10(%ebp)
+ 26e:	ff 75 f4             	push   -0xc(%ebp)
+ 271:	6a 00                	push   $0x0
+ 273:	e8 ff fd ff ff       	call   77 <run>
+ 278:	83 c4 10             	add    $0x10,%esp
+  run(1, nproc, dur);
+ 27b:	83 ec 04             	sub    $0x4,%esp
+ 27e:	ff 75 f0             	push   -0x10(%ebp)
+ 281:	ff 75 f4             	push   -0xc(%ebp)
+ 284:	6a 01                	push   $0x1
+ 286:	e8 ec fd ff ff       	call   77 <run>
+ 28b:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 28e:	e8 52 06 00 00       	call   8e5 <exit>
+
+00000293 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 293:	55                   	push   %ebp
+ 294:	89 e5                	mov    %esp,%ebp
+ 296:	57                   	push   %edi
+ 297:	53                   	push   %ebx
+char*
+ 298:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 29b:	8b 55 10             	mov    0x10(%ebp),%edx
+ 29e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a1:	89 cb                	mov    %ecx,%ebx
+ 2a3:	89 df                	mov    %ebx,%edi
+ 2a5:	89 d1                	mov    %edx,%ecx
+ 2a7:	fc                   	cld
+ 2a8:	f3 aa                	rep stos %al,%es:(%edi)
+ 2aa:	89 ca                	mov    %ecx,%edx
+ 2ac:	89 fb                	mov    %edi,%ebx
+ 2ae:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 2b1:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 2b4:	90                   	nop
+ 2b5:	5b                   	pop    %ebx
+ 2b6:	5f                   	pop    %edi
+ 2b7:	5d                   	pop    %ebp
+ 2b8:	c3                   	ret
+
+000002b9 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 2b9:	55                   	push   %ebp
+ 2ba:	89 e5                	mov    %esp,%ebp
+ 2bc:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 2bf:	8b 55 08             	mov    0x8(%ebp),%edx
+ 2c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2c5:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2c8:	f0 87 02             	lock xchg %eax,(%edx)
+ 2cb:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 2ce:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 2d1:	c9                   	leave
+ 2d2:	c3                   	ret
+
+000002d3 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 2d3:	55                   	push   %ebp
+ 2d4:	89 e5                	mov    %esp,%ebp
+ 2d6:	53                   	push   %ebx
+ 2d7:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 2da:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 2dd:	8b 55 10             	mov    0x10(%ebp),%edx
+ 2e0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2e3:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 2e6:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 2ea:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 2ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 2f0:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 2f3:	c9                   	leave
+ 2f4:	c3                   	ret
+
+000002f5 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 2f5:	55                   	push   %ebp
+ 2f6:	89 e5                	mov    %esp,%ebp
+ 2f8:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 2fb:	0f 31                	rdtsc
+ 2fd:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 300:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 303:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 306:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 309:	c9                   	leave
+ 30a:	c3                   	ret
+
+0000030b <strcpy>:
+{
+ 30b:	55                   	push   %ebp
+ 30c:	89 e5                	mov    %esp,%ebp
+ 30e:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 311:	8b 45 08             	mov    0x8(%ebp),%eax
+ 314:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 317:	90                   	nop
+ 318:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 31b:	8d 42 01             	lea    0x1(%edx),%eax
+ 31e:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 321:	8b 45 08             	mov    0x8(%ebp),%eax
+ 324:	8d 48 01             	lea    0x1(%eax),%ecx
+ 327:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 32a:	0f b6 12             	movzbl (%edx),%edx
+ 32d:	88 10                	mov    %dl,(%eax)
+ 32f:	0f b6 00             	movzbl (%eax),%eax
+ 332:	84 c0                	test   %al,%al
+ 334:	75 e2                	jne    318 <strcpy+0xd>
+  return os;
+ 336:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 339:	c9                   	leave
+ 33a:	c3                   	ret
+
+0000033b <strcmp>:
+{
+ 33b:	55                   	push   %ebp
+ 33c:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 33e:	eb 08                	jmp    348 <strcmp+0xd>
+    p++, q++;
+ 340:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 344:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 348:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34b:	0f b6 00             	movzbl (%eax),%eax
+ 34e:	84 c0                	test   %al,%al
+ 350:	74 10                	je     362 <strcmp+0x27>
+ 352:	8b 45 08             	mov    0x8(%ebp),%eax
+ 355:	0f b6 10             	movzbl (%eax),%edx
+ 358:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 35b:	0f b6 00             	movzbl (%eax),%eax
+ 35e:	38 c2                	cmp    %al,%dl
+ 360:	74 de                	je     340 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 362:	8b 45 08             	mov    0x8(%ebp),%eax
+ 365:	0f b6 00             	movzbl (%eax),%eax
+ 368:	0f b6 d0             	movzbl %al,%edx
+ 36b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36e:	0f b6 00             	movzbl (%eax),%eax
+ 371:	0f b6 c0             	movzbl %al,%eax
+ 374:	29 c2                	sub    %eax,%edx
+ 376:	89 d0                	mov    %edx,%eax
+}
+ 378:	5d                   	pop    %ebp
+ 379:	c3                   	ret
+
+0000037a <strlen>:
+{
+ 37a:	55                   	push   %ebp
+ 37b:	89 e5                	mov    %esp,%ebp
+ 37d:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 380:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 387:	eb 04                	jmp    38d <strlen+0x13>
+ 389:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 38d:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 390:	8b 45 08             	mov    0x8(%ebp),%eax
+ 393:	01 d0                	add    %edx,%eax
+ 395:	0f b6 00             	movzbl (%eax),%eax
+ 398:	84 c0                	test   %al,%al
+ 39a:	75 ed                	jne    389 <strlen+0xf>
+  return n;
+ 39c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 39f:	c9                   	leave
+ 3a0:	c3                   	ret
+
+000003a1 <memset>:
+{
+ 3a1:	55                   	push   %ebp
+ 3a2:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 3a4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3a7:	50                   	push   %eax
+ 3a8:	ff 75 0c             	push   0xc(%ebp)
+ 3ab:	ff 75 08             	push   0x8(%ebp)
+ 3ae:	e8 e0 fe ff ff       	call   293 <stosb>
+ 3b3:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 3b6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3b9:	c9                   	leave
+ 3ba:	c3                   	ret
+
+000003bb <strchr>:
+{
+ 3bb:	55                   	push   %ebp
+ 3bc:	89 e5                	mov    %esp,%ebp
+ 3be:	83 ec 04             	sub    $0x4,%esp
+ 3c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c4:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 3c7:	eb 14                	jmp    3dd <strchr+0x22>
+    if(*s == c)
+ 3c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3cc:	0f b6 00             	movzbl (%eax),%eax
+ 3cf:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 3d2:	75 05                	jne    3d9 <strchr+0x1e>
+      return (char*)s;
+ 3d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d7:	eb 13                	jmp    3ec <strchr+0x31>
+  for(; *s; s++)
+ 3d9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3dd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e0:	0f b6 00             	movzbl (%eax),%eax
+ 3e3:	84 c0                	test   %al,%al
+ 3e5:	75 e2                	jne    3c9 <strchr+0xe>
+  return 0;
+ 3e7:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 3ec:	c9                   	leave
+ 3ed:	c3                   	ret
+
+000003ee <gets>:
+{
+ 3ee:	55                   	push   %ebp
+ 3ef:	89 e5                	mov    %esp,%ebp
+ 3f1:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 3f4:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 3fb:	eb 42                	jmp    43f <gets+0x51>
+    cc = read(0, &c, 1);
+ 3fd:	83 ec 04             	sub    $0x4,%esp
+ 400:	6a 01                	push   $0x1
+ 402:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 405:	50                   	push   %eax
+ 406:	6a 00                	push   $0x0
+ 408:	e8 ed 04 00 00       	call   8fa <read>
+ 40d:	83 c4 10             	add    $0x10,%esp
+ 410:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 413:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 417:	7e 33                	jle    44c <gets+0x5e>
+    buf[i++] = c;
+ 419:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 41c:	8d 50 01             	lea    0x1(%eax),%edx
+ 41f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 422:	89 c2                	mov    %eax,%edx
+ 424:	8b 45 08             	mov    0x8(%ebp),%eax
+ 427:	01 c2                	add    %eax,%edx
+ 429:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 42d:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 42f:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 433:	3c 0a                	cmp    $0xa,%al
+ 435:	74 16                	je     44d <gets+0x5f>
+ 437:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 43b:	3c 0d                	cmp    $0xd,%al
+ 43d:	74 0e                	je     44d <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 43f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 442:	83 c0 01             	add    $0x1,%eax
+ 445:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 448:	7f b3                	jg     3fd <gets+0xf>
+ 44a:	eb 01                	jmp    44d <gets+0x5f>
+      break;
+ 44c:	90                   	nop
+  buf[i] = '\0';
+ 44d:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 450:	8b 45 08             	mov    0x8(%ebp),%eax
+ 453:	01 d0                	add    %edx,%eax
+ 455:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 458:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 45b:	c9                   	leave
+ 45c:	c3                   	ret
+
+0000045d <stat>:
+{
+ 45d:	55                   	push   %ebp
+ 45e:	89 e5                	mov    %esp,%ebp
+ 460:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 463:	83 ec 08             	sub    $0x8,%esp
+ 466:	6a 00                	push   $0x0
+ 468:	ff 75 08             	push   0x8(%ebp)
+ 46b:	e8 ad 04 00 00       	call   91d <open>
+ 470:	83 c4 10             	add    $0x10,%esp
+ 473:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 476:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 47a:	79 07                	jns    483 <stat+0x26>
+    return -1;
+ 47c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 481:	eb 25                	jmp    4a8 <stat+0x4b>
+  r = fstat(fd, st);
+ 483:	83 ec 08             	sub    $0x8,%esp
+ 486:	ff 75 0c             	push   0xc(%ebp)
+ 489:	ff 75 f4             	push   -0xc(%ebp)
+ 48c:	e8 a1 04 00 00       	call   932 <fstat>
+ 491:	83 c4 10             	add    $0x10,%esp
+ 494:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 497:	83 ec 0c             	sub    $0xc,%esp
+ 49a:	ff 75 f4             	push   -0xc(%ebp)
+ 49d:	e8 66 04 00 00       	call   908 <close>
+ 4a2:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 4a5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 4a8:	c9                   	leave
+ 4a9:	c3                   	ret
+
+000004aa <atoi>:
+{
+ 4aa:	55                   	push   %ebp
+ 4ab:	89 e5                	mov    %esp,%ebp
+ 4ad:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 4b0:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4b7:	eb 25                	jmp    4de <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 4b9:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 4bc:	89 d0                	mov    %edx,%eax
+ 4be:	c1 e0 02             	shl    $0x2,%eax
+ 4c1:	01 d0                	add    %edx,%eax
+ 4c3:	01 c0                	add    %eax,%eax
+ 4c5:	89 c1                	mov    %eax,%ecx
+ 4c7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ca:	8d 50 01             	lea    0x1(%eax),%edx
+ 4cd:	89 55 08             	mov    %edx,0x8(%ebp)
+ 4d0:	0f b6 00             	movzbl (%eax),%eax
+ 4d3:	0f be c0             	movsbl %al,%eax
+ 4d6:	01 c8                	add    %ecx,%eax
+ 4d8:	83 e8 30             	sub    $0x30,%eax
+ 4db:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 4de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4e1:	0f b6 00             	movzbl (%eax),%eax
+ 4e4:	3c 2f                	cmp    $0x2f,%al
+ 4e6:	7e 0a                	jle    4f2 <atoi+0x48>
+ 4e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4eb:	0f b6 00             	movzbl (%eax),%eax
+ 4ee:	3c 39                	cmp    $0x39,%al
+ 4f0:	7e c7                	jle    4b9 <atoi+0xf>
+  return n;
+ 4f2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 4f5:	c9                   	leave
+ 4f6:	c3                   	ret
+
+000004f7 <memmove>:
+{
+ 4f7:	55                   	push   %ebp
+ 4f8:	89 e5                	mov    %esp,%ebp
+ 4fa:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 4fd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 500:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 503:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 506:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 509:	eb 17                	jmp    522 <memmove+0x2b>
+    *dst++ = *src++;
+ 50b:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 50e:	8d 42 01             	lea    0x1(%edx),%eax
+ 511:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 514:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 517:	8d 48 01             	lea    0x1(%eax),%ecx
+ 51a:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 51d:	0f b6 12             	movzbl (%edx),%edx
+ 520:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 522:	8b 45 10             	mov    0x10(%ebp),%eax
+ 525:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 528:	89 55 10             	mov    %edx,0x10(%ebp)
+ 52b:	85 c0                	test   %eax,%eax
+ 52d:	7f dc                	jg     50b <memmove+0x14>
+  return vdst;
+ 52f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 532:	c9                   	leave
+ 533:	c3                   	ret
+
+00000534 <mutex_init>:
+{
+ 534:	55                   	push   %ebp
+ 535:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 537:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 540:	90                   	nop
+ 541:	5d                   	pop    %ebp
+ 542:	c3                   	ret
+
+00000543 <mutex_lock>:
+{
+ 543:	55                   	push   %ebp
+ 544:	89 e5                	mov    %esp,%ebp
+ 546:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 549:	8b 45 08             	mov    0x8(%ebp),%eax
+ 54c:	6a 01                	push   $0x1
+ 54e:	6a 00                	push   $0x0
+ 550:	50                   	push   %eax
+ 551:	e8 7d fd ff ff       	call   2d3 <cmpxchg>
+ 556:	83 c4 0c             	add    $0xc,%esp
+ 559:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 55c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 560:	74 46                	je     5a8 <mutex_lock+0x65>
+  if(c != 2)
+ 562:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 566:	74 38                	je     5a0 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 568:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56b:	6a 02                	push   $0x2
+ 56d:	50                   	push   %eax
+ 56e:	e8 46 fd ff ff       	call   2b9 <xchg>
+ 573:	83 c4 08             	add    $0x8,%esp
+ 576:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 579:	eb 25                	jmp    5a0 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 57b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57e:	83 ec 08             	sub    $0x8,%esp
+ 581:	6a 02                	push   $0x2
+ 583:	50                   	push   %eax
+ 584:	e8 22 04 00 00       	call   9ab <futex_wait>
+ 589:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 58c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58f:	83 ec 08             	sub    $0x8,%esp
+ 592:	6a 02                	push   $0x2
+ 594:	50                   	push   %eax
+ 595:	e8 1f fd ff ff       	call   2b9 <xchg>
+ 59a:	83 c4 10             	add    $0x10,%esp
+ 59d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 5a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5a4:	75 d5                	jne    57b <mutex_lock+0x38>
+ 5a6:	eb 01                	jmp    5a9 <mutex_lock+0x66>
+    return;
+ 5a8:	90                   	nop
+}
+ 5a9:	c9                   	leave
+ 5aa:	c3                   	ret
+
+000005ab <mutex_unlock>:
+{
+ 5ab:	55                   	push   %ebp
+ 5ac:	89 e5                	mov    %esp,%ebp
+ 5ae:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 5b1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b4:	6a 00                	push   $0x0
+ 5b6:	50                   	push   %eax
+ 5b7:	e8 fd fc ff ff       	call   2b9 <xchg>
+ 5bc:	83 c4 08             	add    $0x8,%esp
+ 5bf:	83 f8 02             	cmp    $0x2,%eax
+ 5c2:	75 11                	jne    5d5 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 5c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c7:	83 ec 08             	sub    $0x8,%esp
+ 5ca:	6a 01                	push   $0x1
+ 5cc:	50                   	push   %eax
+ 5cd:	e8 e3 03 00 00       	call   9b5 <futex_wake>
+ 5d2:	83 c4 10             	add    $0x10,%esp
+}
+ 5d5:	90                   	nop
+ 5d6:	c9                   	leave
+ 5d7:	c3                   	ret
+
+000005d8 <cond_init>:
+{
+ 5d8:	55                   	push   %ebp
+ 5d9:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 5db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5de:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5e4:	90                   	nop
+ 5e5:	5d                   	pop    %ebp
+ 5e6:	c3                   	ret
+
+000005e7 <cond_wait>:
+{
+ 5e7:	55                   	push   %ebp
+ 5e8:	89 e5                	mov    %esp,%ebp
+ 5ea:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 5ed:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f0:	8b 00                	mov    (%eax),%eax
+ 5f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 5f5:	83 ec 0c             	sub    $0xc,%esp
+ 5f8:	ff 75 0c             	push   0xc(%ebp)
+ 5fb:	e8 ab ff ff ff       	call   5ab <mutex_unlock>
+ 600:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 603:	8b 45 08             	mov    0x8(%ebp),%eax
+ 606:	83 ec 08             	sub    $0x8,%esp
+ 609:	ff 75 f4             	push   -0xc(%ebp)
+ 60c:	50                   	push   %eax
+ 60d:	e8 99 03 00 00       	call   9ab <futex_wait>
+ 612:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 615:	eb 11                	jmp    628 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 617:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 61a:	83 ec 08             	sub    $0x8,%esp
+ 61d:	6a 02                	push   $0x2
+ 61f:	50                   	push   %eax
+ 620:	e8 86 03 00 00       	call   9ab <futex_wait>
+ 625:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 628:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 62b:	83 ec 08             	sub    $0x8,%esp
+ 62e:	6a 02                	push   $0x2
+ 630:	50                   	push   %eax
+ 631:	e8 83 fc ff ff       	call   2b9 <xchg>
+ 636:	83 c4 10             	add    $0x10,%esp
+ 639:	85 c0                	test   %eax,%eax
+ 63b:	75 da                	jne    617 <cond_wait+0x30>
+}
+ 63d:	90                   	nop
+ 63e:	90                   	nop
+ 63f:	c9                   	leave
+ 640:	c3                   	ret
+
+00000641 <condbump>:
+{
+ 641:	55                   	push   %ebp
+ 642:	89 e5                	mov    %esp,%ebp
+ 644:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 647:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64a:	8b 00                	mov    (%eax),%eax
+ 64c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 64f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 652:	8d 50 01             	lea    0x1(%eax),%edx
+ 655:	8b 45 08             	mov    0x8(%ebp),%eax
+ 658:	52                   	push   %edx
+ 659:	ff 75 fc             	push   -0x4(%ebp)
+ 65c:	50                   	push   %eax
+ 65d:	e8 71 fc ff ff       	call   2d3 <cmpxchg>
+ 662:	83 c4 0c             	add    $0xc,%esp
+ 665:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 668:	75 dd                	jne    647 <condbump+0x6>
+}
+ 66a:	90                   	nop
+ 66b:	90                   	nop
+ 66c:	c9                   	leave
+ 66d:	c3                   	ret
+
+0000066e <cond_signal>:
+{
+ 66e:	55                   	push   %ebp
+ 66f:	89 e5                	mov    %esp,%ebp
+ 671:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 674:	ff 75 08             	push   0x8(%ebp)
+ 677:	e8 c5 ff ff ff       	call   641 <condbump>
+ 67c:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 67f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 682:	83 ec 08             	sub    $0x8,%esp
+ 685:	6a 01                	push   $0x1
+ 687:	50                   	push   %eax
+ 688:	e8 28 03 00 00       	call   9b5 <futex_wake>
+ 68d:	83 c4 10             	add    $0x10,%esp
+}
+ 690:	90                   	nop
+ 691:	c9                   	leave
+ 692:	c3                   	ret
+
+00000693 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 693:	55                   	push   %ebp
+ 694:	89 e5                	mov    %esp,%ebp
+ 696:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 699:	ff 75 08             	push   0x8(%ebp)
+ 69c:	e8 a0 ff ff ff       	call   641 <condbump>
+ 6a1:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 6a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a7:	83 ec 08             	sub    $0x8,%esp
+ 6aa:	68 ff ff ff 7f       	push   $0x7fffffff
+ 6af:	50                   	push   %eax
+ 6b0:	e8 00 03 00 00       	call   9b5 <futex_wake>
+ 6b5:	83 c4 10             	add    $0x10,%esp
+}
+ 6b8:	90                   	nop
+ 6b9:	c9                   	leave
+ 6ba:	c3                   	ret
+
+000006bb <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 6bb:	55                   	push   %ebp
+ 6bc:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 6be:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 6c3:	8b 00                	mov    (%eax),%eax
+}
+ 6c5:	5d                   	pop    %ebp
+ 6c6:	c3                   	ret
+
+000006c7 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 6c7:	55                   	push   %ebp
+ 6c8:	89 e5                	mov    %esp,%ebp
+ 6ca:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 6cd:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 6d2:	8b 00                	mov    (%eax),%eax
+ 6d4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 6d7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 6db:	74 05                	je     6e2 <vgetpid+0x1b>
+    return pid;
+ 6dd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 6e0:	eb 05                	jmp    6e7 <vgetpid+0x20>
+  return getpid();
+ 6e2:	e8 74 02 00 00       	call   95b <getpid>
+}
+ 6e7:	c9                   	leave
+ 6e8:	c3                   	ret
+
+000006e9 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	57                   	push   %edi
+ 6ed:	56                   	push   %esi
+ 6ee:	53                   	push   %ebx
+ 6ef:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 6f2:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 6f9:	e8 f7 fb ff ff       	call   2f5 <rdtsc>
+ 6fe:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 701:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 704:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 707:	29 c8                	sub    %ecx,%eax
+ 709:	19 da                	sbb    %ebx,%edx
+ 70b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 70e:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 711:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 714:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 717:	89 d0                	mov    %edx,%eax
+ 719:	31 d2                	xor    %edx,%edx
+ 71b:	89 c1                	mov    %eax,%ecx
+ 71d:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 722:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 725:	8b 40 04             	mov    0x4(%eax),%eax
+ 728:	ba 00 00 00 00       	mov    $0x0,%edx
+ 72d:	89 df                	mov    %ebx,%edi
+ 72f:	0f af f8             	imul   %eax,%edi
+ 732:	89 d6                	mov    %edx,%esi
+ 734:	0f af f1             	imul   %ecx,%esi
+ 737:	01 f7                	add    %esi,%edi
+ 739:	f7 e1                	mul    %ecx
+ 73b:	89 c1                	mov    %eax,%ecx
+ 73d:	89 d3                	mov    %edx,%ebx
+ 73f:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 742:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 744:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 747:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 74a:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 74d:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 754:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 757:	8b 40 04             	mov    0x4(%eax),%eax
+ 75a:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 75d:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 764:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 767:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 76a:	89 d7                	mov    %edx,%edi
+ 76c:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 76f:	0f af fe             	imul   %esi,%edi
+ 772:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 775:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 778:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 77b:	0f af f0             	imul   %eax,%esi
+ 77e:	01 f7                	add    %esi,%edi
+ 780:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 783:	f7 65 d8             	mull   -0x28(%ebp)
+ 786:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 789:	89 f2                	mov    %esi,%edx
+ 78b:	89 d0                	mov    %edx,%eax
+ 78d:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 78f:	01 c8                	add    %ecx,%eax
+ 791:	11 da                	adc    %ebx,%edx
+}
+ 793:	83 c4 24             	add    $0x24,%esp
+ 796:	5b                   	pop    %ebx
+ 797:	5e                   	pop    %esi
+ 798:	5f                   	pop    %edi
+ 799:	5d                   	pop    %ebp
+ 79a:	c3                   	ret
+
+0000079b <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 79b:	55                   	push   %ebp
+ 79c:	89 e5                	mov    %esp,%ebp
+ 79e:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 7a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a4:	8b 50 04             	mov    0x4(%eax),%edx
+ 7a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7aa:	8b 00                	mov    (%eax),%eax
+ 7ac:	29 c2                	sub    %eax,%edx
+ 7ae:	83 fa 1f             	cmp    $0x1f,%edx
+ 7b1:	76 07                	jbe    7ba <ring_queue+0x1f>
+    return -1;
+ 7b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7b8:	eb 68                	jmp    822 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 7ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bd:	8b 40 04             	mov    0x4(%eax),%eax
+ 7c0:	83 e0 1f             	and    $0x1f,%eax
+ 7c3:	89 c2                	mov    %eax,%edx
+ 7c5:	89 d0                	mov    %edx,%eax
+ 7c7:	c1 e0 02             	shl    $0x2,%eax
+ 7ca:	01 d0                	add    %edx,%eax
+ 7cc:	c1 e0 02             	shl    $0x2,%eax
+ 7cf:	8d 50 10             	lea    0x10(%eax),%edx
+ 7d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7d5:	01 d0                	add    %edx,%eax
+ 7d7:	83 c0 04             	add    $0x4,%eax
+ 7da:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 7dd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e0:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 7e3:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 7e5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7e8:	8b 55 10             	mov    0x10(%ebp),%edx
+ 7eb:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 7ee:	8b 55 14             	mov    0x14(%ebp),%edx
+ 7f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7f4:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 7f7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 7fa:	8b 55 18             	mov    0x18(%ebp),%edx
+ 7fd:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 800:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 803:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 806:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 809:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 80e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 811:	8b 40 04             	mov    0x4(%eax),%eax
+ 814:	8d 50 01             	lea    0x1(%eax),%edx
+ 817:	8b 45 08             	mov    0x8(%ebp),%eax
+ 81a:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 81d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 822:	c9                   	leave
+ 823:	c3                   	ret
+
+00000824 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 824:	55                   	push   %ebp
+ 825:	89 e5                	mov    %esp,%ebp
+ 827:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 82a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 82f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 833:	7f 1a                	jg     84f <ring_submit+0x2b>
+ 835:	8b 45 08             	mov    0x8(%ebp),%eax
+ 838:	8b 40 10             	mov    0x10(%eax),%eax
+ 83b:	83 e0 01             	and    $0x1,%eax
+ 83e:	85 c0                	test   %eax,%eax
+ 840:	74 0d                	je     84f <ring_submit+0x2b>
+ 842:	8b 45 08             	mov    0x8(%ebp),%eax
+ 845:	8b 40 10             	mov    0x10(%eax),%eax
+ 848:	83 e0 02             	and    $0x2,%eax
+ 84b:	85 c0                	test   %eax,%eax
+ 84d:	74 10                	je     85f <ring_submit+0x3b>
+    return ring_enter(min);
+ 84f:	83 ec 0c             	sub    $0xc,%esp
+ 852:	ff 75 0c             	push   0xc(%ebp)
+ 855:	e8 83 01 00 00       	call   9dd <ring_enter>
+ 85a:	83 c4 10             	add    $0x10,%esp
+ 85d:	eb 10                	jmp    86f <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 85f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 862:	8b 50 0c             	mov    0xc(%eax),%edx
+ 865:	8b 45 08             	mov    0x8(%ebp),%eax
+ 868:	8b 40 08             	mov    0x8(%eax),%eax
+ 86b:	29 c2                	sub    %eax,%edx
+ 86d:	89 d0                	mov    %edx,%eax
+}
+ 86f:	c9                   	leave
+ 870:	c3                   	ret
+
+00000871 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 871:	55                   	push   %ebp
+ 872:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 874:	8b 45 08             	mov    0x8(%ebp),%eax
+ 877:	8b 50 08             	mov    0x8(%eax),%edx
+ 87a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 87d:	8b 40 0c             	mov    0xc(%eax),%eax
+ 880:	39 c2                	cmp    %eax,%edx
+ 882:	75 07                	jne    88b <ring_reap+0x1a>
+    return -1;
+ 884:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 889:	eb 3b                	jmp    8c6 <ring_reap+0x55>
+  __sync_synchronize();
+ 88b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 890:	8b 45 08             	mov    0x8(%ebp),%eax
+ 893:	8b 40 08             	mov    0x8(%eax),%eax
+ 896:	83 e0 1f             	and    $0x1f,%eax
+ 899:	89 c2                	mov    %eax,%edx
+ 89b:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 89e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a1:	83 c2 52             	add    $0x52,%edx
+ 8a4:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 8a8:	8b 02                	mov    (%edx),%eax
+ 8aa:	8b 52 04             	mov    0x4(%edx),%edx
+ 8ad:	89 01                	mov    %eax,(%ecx)
+ 8af:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 8b2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8b5:	8b 40 08             	mov    0x8(%eax),%eax
+ 8b8:	8d 50 01             	lea    0x1(%eax),%edx
+ 8bb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8be:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 8c1:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 8c6:	5d                   	pop    %ebp
+ 8c7:	c3                   	ret
+
+000008c8 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 8c8:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 8cf:	74 0a                	je     8db <usyscall+0x13>
+  movl %esp, %ecx
+ 8d1:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 8d3:	ba da 08 00 00       	mov    $0x8da,%edx
+  sysenter
+ 8d8:	0f 34                	sysenter
+2:
+  ret
+ 8da:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 8db:	cd 40                	int    $0x40
+  ret
+ 8dd:	c3                   	ret
+
+000008de <fork>:
+
+SYSCALL(fork)
+ 8de:	b8 01 00 00 00       	mov    $0x1,%eax
+ 8e3:	eb e3                	jmp    8c8 <usyscall>
+
+000008e5 <exit>:
+SYSCALL(exit)
+ 8e5:	b8 02 00 00 00       	mov    $0x2,%eax
+ 8ea:	eb dc                	jmp    8c8 <usyscall>
+
+000008ec <wait>:
+SYSCALL(wait)
+ 8ec:	b8 03 00 00 00       	mov    $0x3,%eax
+ 8f1:	eb d5                	jmp    8c8 <usyscall>
+
+000008f3 <pipe>:
+SYSCALL(pipe)
+ 8f3:	b8 04 00 00 00       	mov    $0x4,%eax
+ 8f8:	eb ce                	jmp    8c8 <usyscall>
+
+000008fa <read>:
+SYSCALL(read)
+ 8fa:	b8 05 00 00 00       	mov    $0x5,%eax
+ 8ff:	eb c7                	jmp    8c8 <usyscall>
+
+00000901 <write>:
+SYSCALL(write)
+ 901:	b8 10 00 00 00       	mov    $0x10,%eax
+ 906:	eb c0                	jmp    8c8 <usyscall>
+
+00000908 <close>:
+SYSCALL(close)
+ 908:	b8 15 00 00 00       	mov    $0x15,%eax
+ 90d:	eb b9                	jmp    8c8 <usyscall>
+
+0000090f <kill>:
+SYSCALL(kill)
+ 90f:	b8 06 00 00 00       	mov    $0x6,%eax
+ 914:	eb b2                	jmp    8c8 <usyscall>
+
+00000916 <exec>:
+SYSCALL(exec)
+ 916:	b8 07 00 00 00       	mov    $0x7,%eax
+ 91b:	eb ab                	jmp    8c8 <usyscall>
+
+0000091d <open>:
+SYSCALL(open)
+ 91d:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 922:	eb a4                	jmp    8c8 <usyscall>
+
+00000924 <mknod>:
+SYSCALL(mknod)
+ 924:	b8 11 00 00 00       	mov    $0x11,%eax
+ 929:	eb 9d                	jmp    8c8 <usyscall>
+
+0000092b <unlink>:
+SYSCALL(unlink)
+ 92b:	b8 12 00 00 00       	mov    $0x12,%eax
+ 930:	eb 96                	jmp    8c8 <usyscall>
+
+00000932 <fstat>:
+SYSCALL(fstat)
+ 932:	b8 08 00 00 00       	mov    $0x8,%eax
+ 937:	eb 8f                	jmp    8c8 <usyscall>
+
+00000939 <link>:
+SYSCALL(link)
+ 939:	b8 13 00 00 00       	mov    $0x13,%eax
+ 93e:	eb 88                	jmp    8c8 <usyscall>
+
+00000940 <mkdir>:
+SYSCALL(mkdir)
+ 940:	b8 14 00 00 00       	mov    $0x14,%eax
+ 945:	eb 81                	jmp    8c8 <usyscall>
+
+00000947 <chdir>:
+SYSCALL(chdir)
+ 947:	b8 09 00 00 00       	mov    $0x9,%eax
+ 94c:	e9 77 ff ff ff       	jmp    8c8 <usyscall>
+
+00000951 <dup>:
+SYSCALL(dup)
+ 951:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 956:	e9 6d ff ff ff       	jmp    8c8 <usyscall>
+
+0000095b <getpid>:
+SYSCALL(getpid)
+ 95b:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 960:	e9 63 ff ff ff       	jmp    8c8 <usyscall>
+
+00000965 <sbrk>:
+SYSCALL(sbrk)
+ 965:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 96a:	e9 59 ff ff ff       	jmp    8c8 <usyscall>
+
+0000096f <sleep>:
+SYSCALL(sleep)
+ 96f:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 974:	e9 4f ff ff ff       	jmp    8c8 <usyscall>
+
+00000979 <uptime>:
+SYSCALL(uptime)
+ 979:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 97e:	e9 45 ff ff ff       	jmp    8c8 <usyscall>
+
+00000983 <kmstat>:
+SYSCALL(kmstat)
+ 983:	b8 16 00 00 00       	mov    $0x16,%eax
+ 988:	e9 3b ff ff ff       	jmp    8c8 <usyscall>
+
+0000098d <setpriority>:
+SYSCALL(setpriority)
+ 98d:	b8 17 00 00 00       	mov    $0x17,%eax
+ 992:	e9 31 ff ff ff       	jmp    8c8 <usyscall>
+
+00000997 <clone>:
+SYSCALL(clone)
+ 997:	b8 18 00 00 00       	mov    $0x18,%eax
+ 99c:	e9 27 ff ff ff       	jmp    8c8 <usyscall>
+
+000009a1 <join>:
+SYSCALL(join)
+ 9a1:	b8 19 00 00 00       	mov    $0x19,%eax
+ 9a6:	e9 1d ff ff ff       	jmp    8c8 <usyscall>
+
+000009ab <futex_wait>:
+SYSCALL(futex_wait)
+ 9ab:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 9b0:	e9 13 ff ff ff       	jmp    8c8 <usyscall>
+
+000009b5 <futex_wake>:
+SYSCALL(futex_wake)
+ 9b5:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 9ba:	e9 09 ff ff ff       	jmp    8c8 <usyscall>
+
+000009bf <lockstat>:
+SYSCALL(lockstat)
+ 9bf:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 9c4:	e9 ff fe ff ff       	jmp    8c8 <usyscall>
+
+000009c9 <sysstat>:
+SYSCALL(sysstat)
+ 9c9:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 9ce:	e9 f5 fe ff ff       	jmp    8c8 <usyscall>
+
+000009d3 <ring_setup>:
+SYSCALL(ring_setup)
+ 9d3:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 9d8:	e9 eb fe ff ff       	jmp    8c8 <usyscall>
+
+000009dd <ring_enter>:
+SYSCALL(ring_enter)
+ 9dd:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 9e2:	e9 e1 fe ff ff       	jmp    8c8 <usyscall>
+
+000009e7 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 9e7:	55                   	push   %ebp
+ 9e8:	89 e5                	mov    %esp,%ebp
+ 9ea:	83 ec 18             	sub    $0x18,%esp
+ 9ed:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 9f0:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 9f3:	83 ec 04             	sub    $0x4,%esp
+ 9f6:	6a 01                	push   $0x1
+ 9f8:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 9fb:	50                   	push   %eax
+ 9fc:	ff 75 08             	push   0x8(%ebp)
+ 9ff:	e8 fd fe ff ff       	call   901 <write>
+ a04:	83 c4 10             	add    $0x10,%esp
+}
+ a07:	90                   	nop
+ a08:	c9                   	leave
+ a09:	c3                   	ret
+
+00000a0a <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a0a:	55                   	push   %ebp
+ a0b:	89 e5                	mov    %esp,%ebp
+ a0d:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ a10:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ a17:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ a1b:	74 17                	je     a34 <printint+0x2a>
+ a1d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ a21:	79 11                	jns    a34 <printint+0x2a>
+    neg = 1;
+ a23:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ a2a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a2d:	f7 d8                	neg    %eax
+ a2f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a32:	eb 06                	jmp    a3a <printint+0x30>
+  } else {
+    x = xx;
+ a34:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a37:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ a3a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ a41:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a44:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a47:	ba 00 00 00 00       	mov    $0x0,%edx
+ a4c:	f7 f1                	div    %ecx
+ a4e:	89 d1                	mov    %edx,%ecx
+ a50:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a53:	8d 50 01             	lea    0x1(%eax),%edx
+ a56:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ a59:	0f b6 91 cc 14 00 00 	movzbl 0x14cc(%ecx),%edx
+ a60:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ a64:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ a67:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ a6a:	ba 00 00 00 00       	mov    $0x0,%edx
+ a6f:	f7 f1                	div    %ecx
+ a71:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ a74:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a78:	75 c7                	jne    a41 <printint+0x37>
+  if(neg)
+ a7a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ a7e:	74 2d                	je     aad <printint+0xa3>
+    buf[i++] = '-';
+ a80:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a83:	8d 50 01             	lea    0x1(%eax),%edx
+ a86:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ a89:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ a8e:	eb 1d                	jmp    aad <printint+0xa3>
+    putc(fd, buf[i]);
+ a90:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ a93:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a96:	01 d0                	add    %edx,%eax
+ a98:	0f b6 00             	movzbl (%eax),%eax
+ a9b:	0f be c0             	movsbl %al,%eax
+ a9e:	83 ec 08             	sub    $0x8,%esp
+ aa1:	50                   	push   %eax
+ aa2:	ff 75 08             	push   0x8(%ebp)
+ aa5:	e8 3d ff ff ff       	call   9e7 <putc>
+ aaa:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ aad:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ ab1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ab5:	79 d9                	jns    a90 <printint+0x86>
+}
+ ab7:	90                   	nop
+ ab8:	90                   	nop
+ ab9:	c9                   	leave
+ aba:	c3                   	ret
+
+00000abb <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ abb:	55                   	push   %ebp
+ abc:	89 e5                	mov    %esp,%ebp
+ abe:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ ac1:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ ac8:	8d 45 0c             	lea    0xc(%ebp),%eax
+ acb:	83 c0 04             	add    $0x4,%eax
+ ace:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ad1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ ad8:	e9 59 01 00 00       	jmp    c36 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ add:	8b 55 0c             	mov    0xc(%ebp),%edx
+ ae0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ae3:	01 d0                	add    %edx,%eax
+ ae5:	0f b6 00             	movzbl (%eax),%eax
+ ae8:	0f be c0             	movsbl %al,%eax
+ aeb:	25 ff 00 00 00       	and    $0xff,%eax
+ af0:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ af3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ af7:	75 2c                	jne    b25 <printf+0x6a>
+      if(c == '%'){
+ af9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ afd:	75 0c                	jne    b0b <printf+0x50>
+        state = '%';
+ aff:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b06:	e9 27 01 00 00       	jmp    c32 <printf+0x177>
+      } else {
+        putc(fd, c);
+ b0b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b0e:	0f be c0             	movsbl %al,%eax
+ b11:	83 ec 08             	sub    $0x8,%esp
+ b14:	50                   	push   %eax
+ b15:	ff 75 08             	push   0x8(%ebp)
+ b18:	e8 ca fe ff ff       	call   9e7 <putc>
+ b1d:	83 c4 10             	add    $0x10,%esp
+ b20:	e9 0d 01 00 00       	jmp    c32 <printf+0x177>
+      }
+    } else if(state == '%'){
+ b25:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ b29:	0f 85 03 01 00 00    	jne    c32 <printf+0x177>
+      if(c == 'd'){
+ b2f:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ b33:	75 1e                	jne    b53 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ b35:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b38:	8b 00                	mov    (%eax),%eax
+ b3a:	6a 01                	push   $0x1
+ b3c:	6a 0a                	push   $0xa
+ b3e:	50                   	push   %eax
+ b3f:	ff 75 08             	push   0x8(%ebp)
+ b42:	e8 c3 fe ff ff       	call   a0a <printint>
+ b47:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b4a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b4e:	e9 d8 00 00 00       	jmp    c2b <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ b53:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ b57:	74 06                	je     b5f <printf+0xa4>
+ b59:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ b5d:	75 1e                	jne    b7d <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ b5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b62:	8b 00                	mov    (%eax),%eax
+ b64:	6a 00                	push   $0x0
+ b66:	6a 10                	push   $0x10
+ b68:	50                   	push   %eax
+ b69:	ff 75 08             	push   0x8(%ebp)
+ b6c:	e8 99 fe ff ff       	call   a0a <printint>
+ b71:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b74:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b78:	e9 ae 00 00 00       	jmp    c2b <printf+0x170>
+      } else if(c == 's'){
+ b7d:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ b81:	75 43                	jne    bc6 <printf+0x10b>
+        s = (char*)*ap;
+ b83:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b86:	8b 00                	mov    (%eax),%eax
+ b88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ b8b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ b8f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b93:	75 25                	jne    bba <printf+0xff>
+          s = "(null)";
+ b95:	c7 45 f4 aa 0f 00 00 	movl   $0xfaa,-0xc(%ebp)
+        while(*s != 0){
+ b9c:	eb 1c                	jmp    bba <printf+0xff>
+          putc(fd, *s);
+ b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba1:	0f b6 00             	movzbl (%eax),%eax
+ ba4:	0f be c0             	movsbl %al,%eax
+ ba7:	83 ec 08             	sub    $0x8,%esp
+ baa:	50                   	push   %eax
+ bab:	ff 75 08             	push   0x8(%ebp)
+ bae:	e8 34 fe ff ff       	call   9e7 <putc>
+ bb3:	83 c4 10             	add    $0x10,%esp
+          s++;
+ bb6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ bba:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bbd:	0f b6 00             	movzbl (%eax),%eax
+ bc0:	84 c0                	test   %al,%al
+ bc2:	75 da                	jne    b9e <printf+0xe3>
+ bc4:	eb 65                	jmp    c2b <printf+0x170>
+        }
+      } else if(c == 'c'){
+ bc6:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ bca:	75 1d                	jne    be9 <printf+0x12e>
+        putc(fd, *ap);
+ bcc:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bcf:	8b 00                	mov    (%eax),%eax
+ bd1:	0f be c0             	movsbl %al,%eax
+ bd4:	83 ec 08             	sub    $0x8,%esp
+ bd7:	50                   	push   %eax
+ bd8:	ff 75 08             	push   0x8(%ebp)
+ bdb:	e8 07 fe ff ff       	call   9e7 <putc>
+ be0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ be3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ be7:	eb 42                	jmp    c2b <printf+0x170>
+      } else if(c == '%'){
+ be9:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ bed:	75 17                	jne    c06 <printf+0x14b>
+        putc(fd, c);
+ bef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bf2:	0f be c0             	movsbl %al,%eax
+ bf5:	83 ec 08             	sub    $0x8,%esp
+ bf8:	50                   	push   %eax
+ bf9:	ff 75 08             	push   0x8(%ebp)
+ bfc:	e8 e6 fd ff ff       	call   9e7 <putc>
+ c01:	83 c4 10             	add    $0x10,%esp
+ c04:	eb 25                	jmp    c2b <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ c06:	83 ec 08             	sub    $0x8,%esp
+ c09:	6a 25                	push   $0x25
+ c0b:	ff 75 08             	push   0x8(%ebp)
+ c0e:	e8 d4 fd ff ff       	call   9e7 <putc>
+ c13:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ c16:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c19:	0f be c0             	movsbl %al,%eax
+ c1c:	83 ec 08             	sub    $0x8,%esp
+ c1f:	50                   	push   %eax
+ c20:	ff 75 08             	push   0x8(%ebp)
+ c23:	e8 bf fd ff ff       	call   9e7 <putc>
+ c28:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ c2b:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ c32:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ c36:	8b 55 0c             	mov    0xc(%ebp),%edx
+ c39:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c3c:	01 d0                	add    %edx,%eax
+ c3e:	0f b6 00             	movzbl (%eax),%eax
+ c41:	84 c0                	test   %al,%al
+ c43:	0f 85 94 fe ff ff    	jne    add <printf+0x22>
+    }
+  }
+}
+ c49:	90                   	nop
+ c4a:	90                   	nop
+ c4b:	c9                   	leave
+ c4c:	c3                   	ret
+
+00000c4d <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ c4d:	55                   	push   %ebp
+ c4e:	89 e5                	mov    %esp,%ebp
+ c50:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ c53:	8b 45 08             	mov    0x8(%ebp),%eax
+ c56:	83 e8 08             	sub    $0x8,%eax
+ c59:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c5c:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ c61:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c64:	eb 24                	jmp    c8a <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ c66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c69:	8b 00                	mov    (%eax),%eax
+ c6b:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c6e:	72 12                	jb     c82 <free+0x35>
+ c70:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c73:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c76:	72 24                	jb     c9c <free+0x4f>
+ c78:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c7b:	8b 00                	mov    (%eax),%eax
+ c7d:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c80:	72 1a                	jb     c9c <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ c82:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c85:	8b 00                	mov    (%eax),%eax
+ c87:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ c8a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c8d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ c90:	73 d4                	jae    c66 <free+0x19>
+ c92:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c95:	8b 00                	mov    (%eax),%eax
+ c97:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c9a:	73 ca                	jae    c66 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ c9c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c9f:	8b 40 04             	mov    0x4(%eax),%eax
+ ca2:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ ca9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cac:	01 c2                	add    %eax,%edx
+ cae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cb1:	8b 00                	mov    (%eax),%eax
+ cb3:	39 c2                	cmp    %eax,%edx
+ cb5:	75 24                	jne    cdb <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ cb7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cba:	8b 50 04             	mov    0x4(%eax),%edx
+ cbd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cc0:	8b 00                	mov    (%eax),%eax
+ cc2:	8b 40 04             	mov    0x4(%eax),%eax
+ cc5:	01 c2                	add    %eax,%edx
+ cc7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cca:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ ccd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cd0:	8b 00                	mov    (%eax),%eax
+ cd2:	8b 10                	mov    (%eax),%edx
+ cd4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cd7:	89 10                	mov    %edx,(%eax)
+ cd9:	eb 0a                	jmp    ce5 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ cdb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cde:	8b 10                	mov    (%eax),%edx
+ ce0:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ce3:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ce5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ce8:	8b 40 04             	mov    0x4(%eax),%eax
+ ceb:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ cf2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf5:	01 d0                	add    %edx,%eax
+ cf7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ cfa:	75 20                	jne    d1c <free+0xcf>
+    p->s.size += bp->s.size;
+ cfc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cff:	8b 50 04             	mov    0x4(%eax),%edx
+ d02:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d05:	8b 40 04             	mov    0x4(%eax),%eax
+ d08:	01 c2                	add    %eax,%edx
+ d0a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d0d:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ d10:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d13:	8b 10                	mov    (%eax),%edx
+ d15:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d18:	89 10                	mov    %edx,(%eax)
+ d1a:	eb 08                	jmp    d24 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ d1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d1f:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ d22:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ d24:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d27:	a3 e8 14 00 00       	mov    %eax,0x14e8
+}
+ d2c:	90                   	nop
+ d2d:	c9                   	leave
+ d2e:	c3                   	ret
+
+00000d2f <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ d2f:	55                   	push   %ebp
+ d30:	89 e5                	mov    %esp,%ebp
+ d32:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ d35:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ d3c:	77 07                	ja     d45 <morecore+0x16>
+    nu = 4096;
+ d3e:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ d45:	8b 45 08             	mov    0x8(%ebp),%eax
+ d48:	c1 e0 03             	shl    $0x3,%eax
+ d4b:	83 ec 0c             	sub    $0xc,%esp
+ d4e:	50                   	push   %eax
+ d4f:	e8 11 fc ff ff       	call   965 <sbrk>
+ d54:	83 c4 10             	add    $0x10,%esp
+ d57:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ d5a:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ d5e:	75 07                	jne    d67 <morecore+0x38>
+    return 0;
+ d60:	b8 00 00 00 00       	mov    $0x0,%eax
+ d65:	eb 26                	jmp    d8d <morecore+0x5e>
+  hp = (Header*)p;
+ d67:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ d6d:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d70:	8b 55 08             	mov    0x8(%ebp),%edx
+ d73:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ d76:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d79:	83 c0 08             	add    $0x8,%eax
+ d7c:	83 ec 0c             	sub    $0xc,%esp
+ d7f:	50                   	push   %eax
+ d80:	e8 c8 fe ff ff       	call   c4d <free>
+ d85:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ d88:	a1 e8 14 00 00       	mov    0x14e8,%eax
+}
+ d8d:	c9                   	leave
+ d8e:	c3                   	ret
+
+00000d8f <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ d8f:	55                   	push   %ebp
+ d90:	89 e5                	mov    %esp,%ebp
+ d92:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ d95:	8b 45 08             	mov    0x8(%ebp),%eax
+ d98:	83 c0 07             	add    $0x7,%eax
+ d9b:	c1 e8 03             	shr    $0x3,%eax
+ d9e:	83 c0 01             	add    $0x1,%eax
+ da1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ da4:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ da9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dac:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ db0:	75 23                	jne    dd5 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ db2:	c7 45 f0 e0 14 00 00 	movl   $0x14e0,-0x10(%ebp)
+ db9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dbc:	a3 e8 14 00 00       	mov    %eax,0x14e8
+ dc1:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ dc6:	a3 e0 14 00 00       	mov    %eax,0x14e0
+    base.s.size = 0;
+ dcb:	c7 05 e4 14 00 00 00 	movl   $0x0,0x14e4
+ dd2:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dd5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dd8:	8b 00                	mov    (%eax),%eax
+ dda:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ddd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ de0:	8b 40 04             	mov    0x4(%eax),%eax
+ de3:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ de6:	72 4d                	jb     e35 <malloc+0xa6>
+      if(p->s.size == nunits)
+ de8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ deb:	8b 40 04             	mov    0x4(%eax),%eax
+ dee:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ df1:	75 0c                	jne    dff <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df6:	8b 10                	mov    (%eax),%edx
+ df8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dfb:	89 10                	mov    %edx,(%eax)
+ dfd:	eb 26                	jmp    e25 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ dff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e02:	8b 40 04             	mov    0x4(%eax),%eax
+ e05:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e08:	89 c2                	mov    %eax,%edx
+ e0a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e0d:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e10:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e13:	8b 40 04             	mov    0x4(%eax),%eax
+ e16:	c1 e0 03             	shl    $0x3,%eax
+ e19:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1f:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ e22:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ e25:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e28:	a3 e8 14 00 00       	mov    %eax,0x14e8
+      return (void*)(p + 1);
+ e2d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e30:	83 c0 08             	add    $0x8,%eax
+ e33:	eb 3b                	jmp    e70 <malloc+0xe1>
+    }
+    if(p == freep)
+ e35:	a1 e8 14 00 00       	mov    0x14e8,%eax
+ e3a:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ e3d:	75 1e                	jne    e5d <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ e3f:	83 ec 0c             	sub    $0xc,%esp
+ e42:	ff 75 ec             	push   -0x14(%ebp)
+ e45:	e8 e5 fe ff ff       	call   d2f <morecore>
+ e4a:	83 c4 10             	add    $0x10,%esp
+ e4d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e50:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e54:	75 07                	jne    e5d <malloc+0xce>
+        return 0;
+ e56:	b8 00 00 00 00       	mov    $0x0,%eax
+ e5b:	eb 13                	jmp    e70 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e60:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e63:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e66:	8b 00                	mov    (%eax),%eax
+ e68:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e6b:	e9 6d ff ff ff       	jmp    ddd <malloc+0x4e>
+  }
+}
+ e70:	c9                   	leave
+ e71:	c3                   	ret
+
+00000e72 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ e72:	55                   	push   %ebp
+ e73:	89 e5                	mov    %esp,%ebp
+ e75:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ e78:	83 ec 0c             	sub    $0xc,%esp
+ e7b:	68 00 10 00 00       	push   $0x1000
+ e80:	e8 0a ff ff ff       	call   d8f <malloc>
+ e85:	83 c4 10             	add    $0x10,%esp
+ e88:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e8b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e8f:	75 07                	jne    e98 <thread_create+0x26>
+    return -1;
+ e91:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ e96:	eb 2e                	jmp    ec6 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ e98:	83 ec 04             	sub    $0x4,%esp
+ e9b:	ff 75 f4             	push   -0xc(%ebp)
+ e9e:	ff 75 0c             	push   0xc(%ebp)
+ ea1:	ff 75 08             	push   0x8(%ebp)
+ ea4:	e8 ee fa ff ff       	call   997 <clone>
+ ea9:	83 c4 10             	add    $0x10,%esp
+ eac:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ eaf:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ eb3:	79 0e                	jns    ec3 <thread_create+0x51>
+    free(stack);
+ eb5:	83 ec 0c             	sub    $0xc,%esp
+ eb8:	ff 75 f4             	push   -0xc(%ebp)
+ ebb:	e8 8d fd ff ff       	call   c4d <free>
+ ec0:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ec3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ ec6:	c9                   	leave
+ ec7:	c3                   	ret
+
+00000ec8 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ ec8:	55                   	push   %ebp
+ ec9:	89 e5                	mov    %esp,%ebp
+ ecb:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ece:	83 ec 0c             	sub    $0xc,%esp
+ ed1:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ ed4:	50                   	push   %eax
+ ed5:	e8 c7 fa ff ff       	call   9a1 <join>
+ eda:	83 c4 10             	add    $0x10,%esp
+ edd:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ ee0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ee4:	78 0f                	js     ef5 <thread_join+0x2d>
+    free(stack);
+ ee6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ee9:	83 ec 0c             	sub    $0xc,%esp
+ eec:	50                   	push   %eax
+ eed:	e8 5b fd ff ff       	call   c4d <free>
+ ef2:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ef5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ ef8:	c9                   	leave
+ ef9:	c3                   	ret
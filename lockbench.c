@@ -0,0 +1,97 @@
+// Spin lock benchmark: N processes hammer one kernel lock
+// through a system call that does little else, for a fixed
+// number of ticks.  kill(-1) takes only ptable.lock, an MCS
+// lock; uptime() takes only tickslock, a ticket lock.  Reports
+// total throughput, and the fewest and most operations any one
+// process got done: with fair locks they should be close.
+// Run with make qemu CPUS=2..8.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+int
+op(int which)
+{
+  if(which == 0)
+    return kill(-1);
+  return uptime();
+}
+
+// Count operations from start until start+dur ticks.
+int
+hammer(int which, int start, int dur)
+{
+  int n, i;
+
+  while(uptime() < start)
+    ;
+  n = 0;
+  while(uptime() < start + dur){
+    for(i = 0; i < 64; i++)
+      op(which);
+    n += 64;
+  }
+  return n;
+}
+
+void
+run(int which, int nproc, int dur)
+{
+  int fds[2], i, n, min, max, total, start;
+
+  if(pipe(fds) < 0){
+    printf(2, "lockbench: pipe failed\n");
+    exit();
+  }
+  start = uptime() + 5;
+  for(i = 0; i < nproc; i++){
+    switch(fork()){
+    case -1:
+      printf(2, "lockbench: fork failed\n");
+      exit();
+    case 0:
+      n = hammer(which, start, dur);
+      write(fds[1], &n, sizeof(n));
+      exit();
+    }
+  }
+  close(fds[1]);
+  total = max = 0;
+  min = 0x7fffffff;
+  for(i = 0; i < nproc; i++){
+    if(read(fds[0], &n, sizeof(n)) != sizeof(n)){
+      printf(2, "lockbench: read failed\n");
+      exit();
+    }
+    total += n;
+    if(n < min)
+      min = n;
+    if(n > max)
+      max = n;
+  }
+  close(fds[0]);
+  for(i = 0; i < nproc; i++)
+    wait();
+
+  printf(1, "lockbench: %s, %d procs: %d ops/tick, per proc min %d max %d\n",
+         which == 0 ? "ptable.lock (mcs)" : "tickslock (ticket)",
+         nproc, total / dur, min, max);
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc, dur;
+
+  nproc = 8;
+  dur = 100;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    dur = atoi(argv[2]);
+
+  run(0, nproc, dur);
+  run(1, nproc, dur);
+  exit();
+}
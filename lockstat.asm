@@ -0,0 +1,2051 @@
+
+_lockstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <printk>:
+struct lockstat st[NCLASS];
+
+// Print cycles in thousands, without 64-bit division.
+void
+printk(uint64 cycles)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 18             	sub    $0x18,%esp
+   6:	8b 45 08             	mov    0x8(%ebp),%eax
+   9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+   c:	8b 45 0c             	mov    0xc(%ebp),%eax
+   f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  printf(1, " %d", (uint)(cycles >> 10));
+  12:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  15:	8b 55 f4             	mov    -0xc(%ebp),%edx
+  18:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+  1c:	c1 ea 0a             	shr    $0xa,%edx
+  1f:	83 ec 04             	sub    $0x4,%esp
+  22:	50                   	push   %eax
+  23:	68 88 0f 00 00       	push   $0xf88
+  28:	6a 01                	push   $0x1
+  2a:	e8 18 0b 00 00       	call   b47 <printf>
+  2f:	83 c4 10             	add    $0x10,%esp
+}
+  32:	90                   	nop
+  33:	c9                   	leave
+  34:	c3                   	ret
+
+00000035 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  35:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  39:	83 e4 f0             	and    $0xfffffff0,%esp
+  3c:	ff 71 fc             	push   -0x4(%ecx)
+  3f:	55                   	push   %ebp
+  40:	89 e5                	mov    %esp,%ebp
+  42:	57                   	push   %edi
+  43:	56                   	push   %esi
+  44:	53                   	push   %ebx
+  45:	51                   	push   %ecx
+  46:	83 ec 68             	sub    $0x68,%esp
+  49:	89 c8                	mov    %ecx,%eax
+  int i, j, n, reset;
+  struct lockstat t;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  4b:	83 38 01             	cmpl   $0x1,(%eax)
+  4e:	7e 24                	jle    74 <main+0x3f>
+  50:	8b 40 04             	mov    0x4(%eax),%eax
+  53:	83 c0 04             	add    $0x4,%eax
+  56:	8b 00                	mov    (%eax),%eax
+  58:	83 ec 08             	sub    $0x8,%esp
+  5b:	68 8c 0f 00 00       	push   $0xf8c
+  60:	50                   	push   %eax
+  61:	e8 61 03 00 00       	call   3c7 <strcmp>
+  66:	83 c4 10             	add    $0x10,%esp
+  69:	85 c0                	test   %eax,%eax
+  6b:	75 07                	jne    74 <main+0x3f>
+  6d:	b8 01 00 00 00       	mov    $0x1,%eax
+  72:	eb 05                	jmp    79 <main+0x44>
+  74:	b8 00 00 00 00       	mov    $0x0,%eax
+  79:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if((n = lockstat(st, NCLASS, reset)) < 0){
+  7c:	83 ec 04             	sub    $0x4,%esp
+  7f:	ff 75 dc             	push   -0x24(%ebp)
+  82:	6a 40                	push   $0x40
+  84:	68 00 15 00 00       	push   $0x1500
+  89:	e8 bd 09 00 00       	call   a4b <lockstat>
+  8e:	83 c4 10             	add    $0x10,%esp
+  91:	89 45 d8             	mov    %eax,-0x28(%ebp)
+  94:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+  98:	79 17                	jns    b1 <main+0x7c>
+    printf(2, "lockstat: failed\n");
+  9a:	83 ec 08             	sub    $0x8,%esp
+  9d:	68 8f 0f 00 00       	push   $0xf8f
+  a2:	6a 02                	push   $0x2
+  a4:	e8 9e 0a 00 00       	call   b47 <printf>
+  a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+  ac:	e8 c0 08 00 00       	call   971 <exit>
+  }
+
+  // Sort by time spent waiting.
+  for(i = 1; i < n; i++){
+  b1:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+  b8:	e9 be 00 00 00       	jmp    17b <main+0x146>
+    t = st[i];
+  bd:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+  c0:	89 d0                	mov    %edx,%eax
+  c2:	c1 e0 02             	shl    $0x2,%eax
+  c5:	01 d0                	add    %edx,%eax
+  c7:	c1 e0 04             	shl    $0x4,%eax
+  ca:	8d 90 00 15 00 00    	lea    0x1500(%eax),%edx
+  d0:	8d 45 88             	lea    -0x78(%ebp),%eax
+  d3:	89 d3                	mov    %edx,%ebx
+  d5:	ba 14 00 00 00       	mov    $0x14,%edx
+  da:	89 c7                	mov    %eax,%edi
+  dc:	89 de                	mov    %ebx,%esi
+  de:	89 d1                	mov    %edx,%ecx
+  e0:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+  e2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  e5:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  e8:	eb 3b                	jmp    125 <main+0xf0>
+      st[j] = st[j-1];
+  ea:	8b 45 e0             	mov    -0x20(%ebp),%eax
+  ed:	8d 48 ff             	lea    -0x1(%eax),%ecx
+  f0:	8b 55 e0             	mov    -0x20(%ebp),%edx
+  f3:	89 d0                	mov    %edx,%eax
+  f5:	c1 e0 02             	shl    $0x2,%eax
+  f8:	01 d0                	add    %edx,%eax
+  fa:	c1 e0 04             	shl    $0x4,%eax
+  fd:	8d 90 00 15 00 00    	lea    0x1500(%eax),%edx
+ 103:	89 c8                	mov    %ecx,%eax
+ 105:	c1 e0 02             	shl    $0x2,%eax
+ 108:	01 c8                	add    %ecx,%eax
+ 10a:	c1 e0 04             	shl    $0x4,%eax
+ 10d:	05 00 15 00 00       	add    $0x1500,%eax
+ 112:	89 c3                	mov    %eax,%ebx
+ 114:	b8 14 00 00 00       	mov    $0x14,%eax
+ 119:	89 d7                	mov    %edx,%edi
+ 11b:	89 de                	mov    %ebx,%esi
+ 11d:	89 c1                	mov    %eax,%ecx
+ 11f:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+ 121:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+ 125:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+ 129:	7e 28                	jle    153 <main+0x11e>
+ 12b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 12e:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 131:	89 d0                	mov    %edx,%eax
+ 133:	c1 e0 02             	shl    $0x2,%eax
+ 136:	01 d0                	add    %edx,%eax
+ 138:	c1 e0 04             	shl    $0x4,%eax
+ 13b:	05 18 15 00 00       	add    $0x1518,%eax
+ 140:	8b 08                	mov    (%eax),%ecx
+ 142:	8b 58 04             	mov    0x4(%eax),%ebx
+ 145:	8b 45 a0             	mov    -0x60(%ebp),%eax
+ 148:	8b 55 a4             	mov    -0x5c(%ebp),%edx
+ 14b:	39 c1                	cmp    %eax,%ecx
+ 14d:	89 de                	mov    %ebx,%esi
+ 14f:	19 d6                	sbb    %edx,%esi
+ 151:	72 97                	jb     ea <main+0xb5>
+    st[j] = t;
+ 153:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 156:	89 d0                	mov    %edx,%eax
+ 158:	c1 e0 02             	shl    $0x2,%eax
+ 15b:	01 d0                	add    %edx,%eax
+ 15d:	c1 e0 04             	shl    $0x4,%eax
+ 160:	05 00 15 00 00       	add    $0x1500,%eax
+ 165:	89 c3                	mov    %eax,%ebx
+ 167:	8d 45 88             	lea    -0x78(%ebp),%eax
+ 16a:	ba 14 00 00 00       	mov    $0x14,%edx
+ 16f:	89 df                	mov    %ebx,%edi
+ 171:	89 c6                	mov    %eax,%esi
+ 173:	89 d1                	mov    %edx,%ecx
+ 175:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 1; i < n; i++){
+ 177:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 17b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 17e:	3b 45 d8             	cmp    -0x28(%ebp),%eax
+ 181:	0f 8c 36 ff ff ff    	jl     bd <main+0x88>
+  }
+
+  printf(1, "name acquires contended spin-kcyc hold-kcyc holdmax-kcyc sites\n");
+ 187:	83 ec 08             	sub    $0x8,%esp
+ 18a:	68 a4 0f 00 00       	push   $0xfa4
+ 18f:	6a 01                	push   $0x1
+ 191:	e8 b1 09 00 00       	call   b47 <printf>
+ 196:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+ 199:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+ 1a0:	e9 69 01 00 00       	jmp    30e <main+0x2d9>
+    if(st[i].acquires == 0)
+ 1a5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1a8:	89 d0                	mov    %edx,%eax
+ 1aa:	c1 e0 02             	shl    $0x2,%eax
+ 1ad:	01 d0                	add    %edx,%eax
+ 1af:	c1 e0 04             	shl    $0x4,%eax
+ 1b2:	05 10 15 00 00       	add    $0x1510,%eax
+ 1b7:	8b 00                	mov    (%eax),%eax
+ 1b9:	85 c0                	test   %eax,%eax
+ 1bb:	0f 84 48 01 00 00    	je     309 <main+0x2d4>
+      continue;
+    printf(1, "%s %d %d", st[i].name, st[i].acquires, st[i].contended);
+ 1c1:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1c4:	89 d0                	mov    %edx,%eax
+ 1c6:	c1 e0 02             	shl    $0x2,%eax
+ 1c9:	01 d0                	add    %edx,%eax
+ 1cb:	c1 e0 04             	shl    $0x4,%eax
+ 1ce:	05 14 15 00 00       	add    $0x1514,%eax
+ 1d3:	8b 18                	mov    (%eax),%ebx
+ 1d5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1d8:	89 d0                	mov    %edx,%eax
+ 1da:	c1 e0 02             	shl    $0x2,%eax
+ 1dd:	01 d0                	add    %edx,%eax
+ 1df:	c1 e0 04             	shl    $0x4,%eax
+ 1e2:	05 10 15 00 00       	add    $0x1510,%eax
+ 1e7:	8b 08                	mov    (%eax),%ecx
+ 1e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 1ec:	89 d0                	mov    %edx,%eax
+ 1ee:	c1 e0 02             	shl    $0x2,%eax
+ 1f1:	01 d0                	add    %edx,%eax
+ 1f3:	c1 e0 04             	shl    $0x4,%eax
+ 1f6:	05 00 15 00 00       	add    $0x1500,%eax
+ 1fb:	83 ec 0c             	sub    $0xc,%esp
+ 1fe:	53                   	push   %ebx
+ 1ff:	51                   	push   %ecx
+ 200:	50                   	push   %eax
+ 201:	68 e4 0f 00 00       	push   $0xfe4
+ 206:	6a 01                	push   $0x1
+ 208:	e8 3a 09 00 00       	call   b47 <printf>
+ 20d:	83 c4 20             	add    $0x20,%esp
+    printk(st[i].spin);
+ 210:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 213:	89 d0                	mov    %edx,%eax
+ 215:	c1 e0 02             	shl    $0x2,%eax
+ 218:	01 d0                	add    %edx,%eax
+ 21a:	c1 e0 04             	shl    $0x4,%eax
+ 21d:	05 18 15 00 00       	add    $0x1518,%eax
+ 222:	8b 50 04             	mov    0x4(%eax),%edx
+ 225:	8b 00                	mov    (%eax),%eax
+ 227:	83 ec 08             	sub    $0x8,%esp
+ 22a:	52                   	push   %edx
+ 22b:	50                   	push   %eax
+ 22c:	e8 cf fd ff ff       	call   0 <printk>
+ 231:	83 c4 10             	add    $0x10,%esp
+    printk(st[i].hold);
+ 234:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 237:	89 d0                	mov    %edx,%eax
+ 239:	c1 e0 02             	shl    $0x2,%eax
+ 23c:	01 d0                	add    %edx,%eax
+ 23e:	c1 e0 04             	shl    $0x4,%eax
+ 241:	05 20 15 00 00       	add    $0x1520,%eax
+ 246:	8b 50 04             	mov    0x4(%eax),%edx
+ 249:	8b 00                	mov    (%eax),%eax
+ 24b:	83 ec 08             	sub    $0x8,%esp
+ 24e:	52                   	push   %edx
+ 24f:	50                   	push   %eax
+ 250:	e8 ab fd ff ff       	call   0 <printk>
+ 255:	83 c4 10             	add    $0x10,%esp
+    printk(st[i].holdmax);
+ 258:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 25b:	89 d0                	mov    %edx,%eax
+ 25d:	c1 e0 02             	shl    $0x2,%eax
+ 260:	01 d0                	add    %edx,%eax
+ 262:	c1 e0 04             	shl    $0x4,%eax
+ 265:	05 28 15 00 00       	add    $0x1528,%eax
+ 26a:	8b 50 04             	mov    0x4(%eax),%edx
+ 26d:	8b 00                	mov    (%eax),%eax
+ 26f:	83 ec 08             	sub    $0x8,%esp
+ 272:	52                   	push   %edx
+ 273:	50                   	push   %eax
+ 274:	e8 87 fd ff ff       	call   0 <printk>
+ 279:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < NLOCKSITE && st[i].site[j].count; j++)
+ 27c:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+ 283:	eb 4b                	jmp    2d0 <main+0x29b>
+      printf(1, " %x:%d", st[i].site[j].pc, st[i].site[j].count);
+ 285:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 288:	89 d0                	mov    %edx,%eax
+ 28a:	c1 e0 02             	shl    $0x2,%eax
+ 28d:	01 d0                	add    %edx,%eax
+ 28f:	01 c0                	add    %eax,%eax
+ 291:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 294:	01 d0                	add    %edx,%eax
+ 296:	83 c0 06             	add    $0x6,%eax
+ 299:	8b 0c c5 04 15 00 00 	mov    0x1504(,%eax,8),%ecx
+ 2a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2a3:	89 d0                	mov    %edx,%eax
+ 2a5:	c1 e0 02             	shl    $0x2,%eax
+ 2a8:	01 d0                	add    %edx,%eax
+ 2aa:	01 c0                	add    %eax,%eax
+ 2ac:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2af:	01 d0                	add    %edx,%eax
+ 2b1:	83 c0 06             	add    $0x6,%eax
+ 2b4:	8b 04 c5 00 15 00 00 	mov    0x1500(,%eax,8),%eax
+ 2bb:	51                   	push   %ecx
+ 2bc:	50                   	push   %eax
+ 2bd:	68 ed 0f 00 00       	push   $0xfed
+ 2c2:	6a 01                	push   $0x1
+ 2c4:	e8 7e 08 00 00       	call   b47 <printf>
+ 2c9:	83 c4 10             	add    $0x10,%esp
+    for(j = 0; j < NLOCKSITE && st[i].site[j].count; j++)
+ 2cc:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+ 2d0:	83 7d e0 03          	cmpl   $0x3,-0x20(%ebp)
+ 2d4:	7f 1f                	jg     2f5 <main+0x2c0>
+ 2d6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 2d9:	89 d0                	mov    %edx,%eax
+ 2db:	c1 e0 02             	shl    $0x2,%eax
+ 2de:	01 d0                	add    %edx,%eax
+ 2e0:	01 c0                	add    %eax,%eax
+ 2e2:	8b 55 e0             	mov    -0x20(%ebp),%edx
+ 2e5:	01 d0                	add    %edx,%eax
+ 2e7:	83 c0 06             	add    $0x6,%eax
+ 2ea:	8b 04 c5 04 15 00 00 	mov    0x1504(,%eax,8),%eax
+ 2f1:	85 c0                	test   %eax,%eax
+ 2f3:	75 90                	jne    285 <main+0x250>
+    printf(1, "\n");
+ 2f5:	83 ec 08             	sub    $0x8,%esp
+ 2f8:	68 f4 0f 00 00       	push   $0xff4
+ 2fd:	6a 01                	push   $0x1
+ 2ff:	e8 43 08 00 00       	call   b47 <printf>
+ 304:	83 c4 10             	add    $0x10,%esp
+ 307:	eb 01                	jmp    30a <main+0x2d5>
+      continue;
+ 309:	90                   	nop
+  for(i = 0; i < n; i++){
+ 30a:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+ 30e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 311:	3b 45 d8             	cmp    -0x28(%ebp),%eax
+ 314:	0f 8c 8b fe ff ff    	jl     1a5 <main+0x170>
+  }
+  exit();
+ 31a:	e8 52 06 00 00       	call   971 <exit>
+
+0000031f <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 31f:	55                   	push   %ebp
+ 320:	89 e5                	mov    %esp,%ebp
+ 322:	57                   	push   %edi
+ 323:	53                   	push   %ebx
+char*
+ 324:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 327:	8b 55 10             	mov    0x10(%ebp),%edx
+ 32a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 32d:	89 cb                	mov    %ecx,%ebx
+ 32f:	89 df                	mov    %ebx,%edi
+ 331:	89 d1                	mov    %edx,%ecx
+ 333:	fc                   	cld
+ 334:	f3 aa                	rep stos %al,%es:(%edi)
+ 336:	89 ca                	mov    %ecx,%edx
+ 338:	89 fb                	mov    %edi,%ebx
+ 33a:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 33d:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 340:	90                   	nop
+ 341:	5b                   	pop    %ebx
+ 342:	5f                   	pop    %edi
+ 343:	5d                   	pop    %ebp
+ 344:	c3                   	ret
+
+00000345 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 345:	55                   	push   %ebp
+ 346:	89 e5                	mov    %esp,%ebp
+ 348:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 34b:	8b 55 08             	mov    0x8(%ebp),%edx
+ 34e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 351:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 354:	f0 87 02             	lock xchg %eax,(%edx)
+ 357:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 35a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 35d:	c9                   	leave
+ 35e:	c3                   	ret
+
+0000035f <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 35f:	55                   	push   %ebp
+ 360:	89 e5                	mov    %esp,%ebp
+ 362:	53                   	push   %ebx
+ 363:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 366:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 369:	8b 55 10             	mov    0x10(%ebp),%edx
+ 36c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 36f:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 372:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 376:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 379:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 37c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 37f:	c9                   	leave
+ 380:	c3                   	ret
+
+00000381 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 381:	55                   	push   %ebp
+ 382:	89 e5                	mov    %esp,%ebp
+ 384:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 387:	0f 31                	rdtsc
+ 389:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 38c:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 38f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 392:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 395:	c9                   	leave
+ 396:	c3                   	ret
+
+00000397 <strcpy>:
+{
+ 397:	55                   	push   %ebp
+ 398:	89 e5                	mov    %esp,%ebp
+ 39a:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 39d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a0:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 3a3:	90                   	nop
+ 3a4:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3a7:	8d 42 01             	lea    0x1(%edx),%eax
+ 3aa:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3b3:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 3b6:	0f b6 12             	movzbl (%edx),%edx
+ 3b9:	88 10                	mov    %dl,(%eax)
+ 3bb:	0f b6 00             	movzbl (%eax),%eax
+ 3be:	84 c0                	test   %al,%al
+ 3c0:	75 e2                	jne    3a4 <strcpy+0xd>
+  return os;
+ 3c2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3c5:	c9                   	leave
+ 3c6:	c3                   	ret
+
+000003c7 <strcmp>:
+{
+ 3c7:	55                   	push   %ebp
+ 3c8:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3ca:	eb 08                	jmp    3d4 <strcmp+0xd>
+    p++, q++;
+ 3cc:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3d0:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3d4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d7:	0f b6 00             	movzbl (%eax),%eax
+ 3da:	84 c0                	test   %al,%al
+ 3dc:	74 10                	je     3ee <strcmp+0x27>
+ 3de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e1:	0f b6 10             	movzbl (%eax),%edx
+ 3e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3e7:	0f b6 00             	movzbl (%eax),%eax
+ 3ea:	38 c2                	cmp    %al,%dl
+ 3ec:	74 de                	je     3cc <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f1:	0f b6 00             	movzbl (%eax),%eax
+ 3f4:	0f b6 d0             	movzbl %al,%edx
+ 3f7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3fa:	0f b6 00             	movzbl (%eax),%eax
+ 3fd:	0f b6 c0             	movzbl %al,%eax
+ 400:	29 c2                	sub    %eax,%edx
+ 402:	89 d0                	mov    %edx,%eax
+}
+ 404:	5d                   	pop    %ebp
+ 405:	c3                   	ret
+
+00000406 <strlen>:
+{
+ 406:	55                   	push   %ebp
+ 407:	89 e5                	mov    %esp,%ebp
+ 409:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 40c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 413:	eb 04                	jmp    419 <strlen+0x13>
+ 415:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 419:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 41c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41f:	01 d0                	add    %edx,%eax
+ 421:	0f b6 00             	movzbl (%eax),%eax
+ 424:	84 c0                	test   %al,%al
+ 426:	75 ed                	jne    415 <strlen+0xf>
+  return n;
+ 428:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 42b:	c9                   	leave
+ 42c:	c3                   	ret
+
+0000042d <memset>:
+{
+ 42d:	55                   	push   %ebp
+ 42e:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 430:	8b 45 10             	mov    0x10(%ebp),%eax
+ 433:	50                   	push   %eax
+ 434:	ff 75 0c             	push   0xc(%ebp)
+ 437:	ff 75 08             	push   0x8(%ebp)
+ 43a:	e8 e0 fe ff ff       	call   31f <stosb>
+ 43f:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 442:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 445:	c9                   	leave
+ 446:	c3                   	ret
+
+00000447 <strchr>:
+{
+ 447:	55                   	push   %ebp
+ 448:	89 e5                	mov    %esp,%ebp
+ 44a:	83 ec 04             	sub    $0x4,%esp
+ 44d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 450:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 453:	eb 14                	jmp    469 <strchr+0x22>
+    if(*s == c)
+ 455:	8b 45 08             	mov    0x8(%ebp),%eax
+ 458:	0f b6 00             	movzbl (%eax),%eax
+ 45b:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 45e:	75 05                	jne    465 <strchr+0x1e>
+      return (char*)s;
+ 460:	8b 45 08             	mov    0x8(%ebp),%eax
+ 463:	eb 13                	jmp    478 <strchr+0x31>
+  for(; *s; s++)
+ 465:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 469:	8b 45 08             	mov    0x8(%ebp),%eax
+ 46c:	0f b6 00             	movzbl (%eax),%eax
+ 46f:	84 c0                	test   %al,%al
+ 471:	75 e2                	jne    455 <strchr+0xe>
+  return 0;
+ 473:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 478:	c9                   	leave
+ 479:	c3                   	ret
+
+0000047a <gets>:
+{
+ 47a:	55                   	push   %ebp
+ 47b:	89 e5                	mov    %esp,%ebp
+ 47d:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 480:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 487:	eb 42                	jmp    4cb <gets+0x51>
+    cc = read(0, &c, 1);
+ 489:	83 ec 04             	sub    $0x4,%esp
+ 48c:	6a 01                	push   $0x1
+ 48e:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 491:	50                   	push   %eax
+ 492:	6a 00                	push   $0x0
+ 494:	e8 ed 04 00 00       	call   986 <read>
+ 499:	83 c4 10             	add    $0x10,%esp
+ 49c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 49f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4a3:	7e 33                	jle    4d8 <gets+0x5e>
+    buf[i++] = c;
+ 4a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4a8:	8d 50 01             	lea    0x1(%eax),%edx
+ 4ab:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4ae:	89 c2                	mov    %eax,%edx
+ 4b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b3:	01 c2                	add    %eax,%edx
+ 4b5:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4b9:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4bb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4bf:	3c 0a                	cmp    $0xa,%al
+ 4c1:	74 16                	je     4d9 <gets+0x5f>
+ 4c3:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4c7:	3c 0d                	cmp    $0xd,%al
+ 4c9:	74 0e                	je     4d9 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4cb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4ce:	83 c0 01             	add    $0x1,%eax
+ 4d1:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4d4:	7f b3                	jg     489 <gets+0xf>
+ 4d6:	eb 01                	jmp    4d9 <gets+0x5f>
+      break;
+ 4d8:	90                   	nop
+  buf[i] = '\0';
+ 4d9:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 4dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4df:	01 d0                	add    %edx,%eax
+ 4e1:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 4e4:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 4e7:	c9                   	leave
+ 4e8:	c3                   	ret
+
+000004e9 <stat>:
+{
+ 4e9:	55                   	push   %ebp
+ 4ea:	89 e5                	mov    %esp,%ebp
+ 4ec:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 4ef:	83 ec 08             	sub    $0x8,%esp
+ 4f2:	6a 00                	push   $0x0
+ 4f4:	ff 75 08             	push   0x8(%ebp)
+ 4f7:	e8 ad 04 00 00       	call   9a9 <open>
+ 4fc:	83 c4 10             	add    $0x10,%esp
+ 4ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 502:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 506:	79 07                	jns    50f <stat+0x26>
+    return -1;
+ 508:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 50d:	eb 25                	jmp    534 <stat+0x4b>
+  r = fstat(fd, st);
+ 50f:	83 ec 08             	sub    $0x8,%esp
+ 512:	ff 75 0c             	push   0xc(%ebp)
+ 515:	ff 75 f4             	push   -0xc(%ebp)
+ 518:	e8 a1 04 00 00       	call   9be <fstat>
+ 51d:	83 c4 10             	add    $0x10,%esp
+ 520:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 523:	83 ec 0c             	sub    $0xc,%esp
+ 526:	ff 75 f4             	push   -0xc(%ebp)
+ 529:	e8 66 04 00 00       	call   994 <close>
+ 52e:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 531:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 534:	c9                   	leave
+ 535:	c3                   	ret
+
+00000536 <atoi>:
+{
+ 536:	55                   	push   %ebp
+ 537:	89 e5                	mov    %esp,%ebp
+ 539:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 53c:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 543:	eb 25                	jmp    56a <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 545:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 548:	89 d0                	mov    %edx,%eax
+ 54a:	c1 e0 02             	shl    $0x2,%eax
+ 54d:	01 d0                	add    %edx,%eax
+ 54f:	01 c0                	add    %eax,%eax
+ 551:	89 c1                	mov    %eax,%ecx
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	8d 50 01             	lea    0x1(%eax),%edx
+ 559:	89 55 08             	mov    %edx,0x8(%ebp)
+ 55c:	0f b6 00             	movzbl (%eax),%eax
+ 55f:	0f be c0             	movsbl %al,%eax
+ 562:	01 c8                	add    %ecx,%eax
+ 564:	83 e8 30             	sub    $0x30,%eax
+ 567:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 56a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56d:	0f b6 00             	movzbl (%eax),%eax
+ 570:	3c 2f                	cmp    $0x2f,%al
+ 572:	7e 0a                	jle    57e <atoi+0x48>
+ 574:	8b 45 08             	mov    0x8(%ebp),%eax
+ 577:	0f b6 00             	movzbl (%eax),%eax
+ 57a:	3c 39                	cmp    $0x39,%al
+ 57c:	7e c7                	jle    545 <atoi+0xf>
+  return n;
+ 57e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 581:	c9                   	leave
+ 582:	c3                   	ret
+
+00000583 <memmove>:
+{
+ 583:	55                   	push   %ebp
+ 584:	89 e5                	mov    %esp,%ebp
+ 586:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 589:	8b 45 08             	mov    0x8(%ebp),%eax
+ 58c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 58f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 592:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 595:	eb 17                	jmp    5ae <memmove+0x2b>
+    *dst++ = *src++;
+ 597:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 59a:	8d 42 01             	lea    0x1(%edx),%eax
+ 59d:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 5a0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5a3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5a6:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5a9:	0f b6 12             	movzbl (%edx),%edx
+ 5ac:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 5ae:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5b1:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5b4:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5b7:	85 c0                	test   %eax,%eax
+ 5b9:	7f dc                	jg     597 <memmove+0x14>
+  return vdst;
+ 5bb:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5be:	c9                   	leave
+ 5bf:	c3                   	ret
+
+000005c0 <mutex_init>:
+{
+ 5c0:	55                   	push   %ebp
+ 5c1:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5c6:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5cc:	90                   	nop
+ 5cd:	5d                   	pop    %ebp
+ 5ce:	c3                   	ret
+
+000005cf <mutex_lock>:
+{
+ 5cf:	55                   	push   %ebp
+ 5d0:	89 e5                	mov    %esp,%ebp
+ 5d2:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 5d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d8:	6a 01                	push   $0x1
+ 5da:	6a 00                	push   $0x0
+ 5dc:	50                   	push   %eax
+ 5dd:	e8 7d fd ff ff       	call   35f <cmpxchg>
+ 5e2:	83 c4 0c             	add    $0xc,%esp
+ 5e5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 5e8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 5ec:	74 46                	je     634 <mutex_lock+0x65>
+  if(c != 2)
+ 5ee:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 5f2:	74 38                	je     62c <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 5f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f7:	6a 02                	push   $0x2
+ 5f9:	50                   	push   %eax
+ 5fa:	e8 46 fd ff ff       	call   345 <xchg>
+ 5ff:	83 c4 08             	add    $0x8,%esp
+ 602:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 605:	eb 25                	jmp    62c <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 607:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60a:	83 ec 08             	sub    $0x8,%esp
+ 60d:	6a 02                	push   $0x2
+ 60f:	50                   	push   %eax
+ 610:	e8 22 04 00 00       	call   a37 <futex_wait>
+ 615:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 618:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61b:	83 ec 08             	sub    $0x8,%esp
+ 61e:	6a 02                	push   $0x2
+ 620:	50                   	push   %eax
+ 621:	e8 1f fd ff ff       	call   345 <xchg>
+ 626:	83 c4 10             	add    $0x10,%esp
+ 629:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 62c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 630:	75 d5                	jne    607 <mutex_lock+0x38>
+ 632:	eb 01                	jmp    635 <mutex_lock+0x66>
+    return;
+ 634:	90                   	nop
+}
+ 635:	c9                   	leave
+ 636:	c3                   	ret
+
+00000637 <mutex_unlock>:
+{
+ 637:	55                   	push   %ebp
+ 638:	89 e5                	mov    %esp,%ebp
+ 63a:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 63d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 640:	6a 00                	push   $0x0
+ 642:	50                   	push   %eax
+ 643:	e8 fd fc ff ff       	call   345 <xchg>
+ 648:	83 c4 08             	add    $0x8,%esp
+ 64b:	83 f8 02             	cmp    $0x2,%eax
+ 64e:	75 11                	jne    661 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 650:	8b 45 08             	mov    0x8(%ebp),%eax
+ 653:	83 ec 08             	sub    $0x8,%esp
+ 656:	6a 01                	push   $0x1
+ 658:	50                   	push   %eax
+ 659:	e8 e3 03 00 00       	call   a41 <futex_wake>
+ 65e:	83 c4 10             	add    $0x10,%esp
+}
+ 661:	90                   	nop
+ 662:	c9                   	leave
+ 663:	c3                   	ret
+
+00000664 <cond_init>:
+{
+ 664:	55                   	push   %ebp
+ 665:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 667:	8b 45 08             	mov    0x8(%ebp),%eax
+ 66a:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 670:	90                   	nop
+ 671:	5d                   	pop    %ebp
+ 672:	c3                   	ret
+
+00000673 <cond_wait>:
+{
+ 673:	55                   	push   %ebp
+ 674:	89 e5                	mov    %esp,%ebp
+ 676:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 679:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67c:	8b 00                	mov    (%eax),%eax
+ 67e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 681:	83 ec 0c             	sub    $0xc,%esp
+ 684:	ff 75 0c             	push   0xc(%ebp)
+ 687:	e8 ab ff ff ff       	call   637 <mutex_unlock>
+ 68c:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 68f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 692:	83 ec 08             	sub    $0x8,%esp
+ 695:	ff 75 f4             	push   -0xc(%ebp)
+ 698:	50                   	push   %eax
+ 699:	e8 99 03 00 00       	call   a37 <futex_wait>
+ 69e:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6a1:	eb 11                	jmp    6b4 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 6a3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6a6:	83 ec 08             	sub    $0x8,%esp
+ 6a9:	6a 02                	push   $0x2
+ 6ab:	50                   	push   %eax
+ 6ac:	e8 86 03 00 00       	call   a37 <futex_wait>
+ 6b1:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6b7:	83 ec 08             	sub    $0x8,%esp
+ 6ba:	6a 02                	push   $0x2
+ 6bc:	50                   	push   %eax
+ 6bd:	e8 83 fc ff ff       	call   345 <xchg>
+ 6c2:	83 c4 10             	add    $0x10,%esp
+ 6c5:	85 c0                	test   %eax,%eax
+ 6c7:	75 da                	jne    6a3 <cond_wait+0x30>
+}
+ 6c9:	90                   	nop
+ 6ca:	90                   	nop
+ 6cb:	c9                   	leave
+ 6cc:	c3                   	ret
+
+000006cd <condbump>:
+{
+ 6cd:	55                   	push   %ebp
+ 6ce:	89 e5                	mov    %esp,%ebp
+ 6d0:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 6d3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d6:	8b 00                	mov    (%eax),%eax
+ 6d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 6db:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6de:	8d 50 01             	lea    0x1(%eax),%edx
+ 6e1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e4:	52                   	push   %edx
+ 6e5:	ff 75 fc             	push   -0x4(%ebp)
+ 6e8:	50                   	push   %eax
+ 6e9:	e8 71 fc ff ff       	call   35f <cmpxchg>
+ 6ee:	83 c4 0c             	add    $0xc,%esp
+ 6f1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 6f4:	75 dd                	jne    6d3 <condbump+0x6>
+}
+ 6f6:	90                   	nop
+ 6f7:	90                   	nop
+ 6f8:	c9                   	leave
+ 6f9:	c3                   	ret
+
+000006fa <cond_signal>:
+{
+ 6fa:	55                   	push   %ebp
+ 6fb:	89 e5                	mov    %esp,%ebp
+ 6fd:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 700:	ff 75 08             	push   0x8(%ebp)
+ 703:	e8 c5 ff ff ff       	call   6cd <condbump>
+ 708:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 70b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70e:	83 ec 08             	sub    $0x8,%esp
+ 711:	6a 01                	push   $0x1
+ 713:	50                   	push   %eax
+ 714:	e8 28 03 00 00       	call   a41 <futex_wake>
+ 719:	83 c4 10             	add    $0x10,%esp
+}
+ 71c:	90                   	nop
+ 71d:	c9                   	leave
+ 71e:	c3                   	ret
+
+0000071f <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 71f:	55                   	push   %ebp
+ 720:	89 e5                	mov    %esp,%ebp
+ 722:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 725:	ff 75 08             	push   0x8(%ebp)
+ 728:	e8 a0 ff ff ff       	call   6cd <condbump>
+ 72d:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 730:	8b 45 08             	mov    0x8(%ebp),%eax
+ 733:	83 ec 08             	sub    $0x8,%esp
+ 736:	68 ff ff ff 7f       	push   $0x7fffffff
+ 73b:	50                   	push   %eax
+ 73c:	e8 00 03 00 00       	call   a41 <futex_wake>
+ 741:	83 c4 10             	add    $0x10,%esp
+}
+ 744:	90                   	nop
+ 745:	c9                   	leave
+ 746:	c3                   	ret
+
+00000747 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 747:	55                   	push   %ebp
+ 748:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 74a:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 74f:	8b 00                	mov    (%eax),%eax
+}
+ 751:	5d                   	pop    %ebp
+ 752:	c3                   	ret
+
+00000753 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 753:	55                   	push   %ebp
+ 754:	89 e5                	mov    %esp,%ebp
+ 756:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 759:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 75e:	8b 00                	mov    (%eax),%eax
+ 760:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 763:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 767:	74 05                	je     76e <vgetpid+0x1b>
+    return pid;
+ 769:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 76c:	eb 05                	jmp    773 <vgetpid+0x20>
+  return getpid();
+ 76e:	e8 74 02 00 00       	call   9e7 <getpid>
+}
+ 773:	c9                   	leave
+ 774:	c3                   	ret
+
+00000775 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 775:	55                   	push   %ebp
+ 776:	89 e5                	mov    %esp,%ebp
+ 778:	57                   	push   %edi
+ 779:	56                   	push   %esi
+ 77a:	53                   	push   %ebx
+ 77b:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 77e:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 785:	e8 f7 fb ff ff       	call   381 <rdtsc>
+ 78a:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 78d:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 790:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 793:	29 c8                	sub    %ecx,%eax
+ 795:	19 da                	sbb    %ebx,%edx
+ 797:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 79a:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 79d:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7a0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7a3:	89 d0                	mov    %edx,%eax
+ 7a5:	31 d2                	xor    %edx,%edx
+ 7a7:	89 c1                	mov    %eax,%ecx
+ 7a9:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 7ae:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7b1:	8b 40 04             	mov    0x4(%eax),%eax
+ 7b4:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7b9:	89 df                	mov    %ebx,%edi
+ 7bb:	0f af f8             	imul   %eax,%edi
+ 7be:	89 d6                	mov    %edx,%esi
+ 7c0:	0f af f1             	imul   %ecx,%esi
+ 7c3:	01 f7                	add    %esi,%edi
+ 7c5:	f7 e1                	mul    %ecx
+ 7c7:	89 c1                	mov    %eax,%ecx
+ 7c9:	89 d3                	mov    %edx,%ebx
+ 7cb:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 7ce:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 7d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7d3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7d6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 7d9:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 7e0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e3:	8b 40 04             	mov    0x4(%eax),%eax
+ 7e6:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 7e9:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 7f0:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 7f3:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 7f6:	89 d7                	mov    %edx,%edi
+ 7f8:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 7fb:	0f af fe             	imul   %esi,%edi
+ 7fe:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 801:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 804:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 807:	0f af f0             	imul   %eax,%esi
+ 80a:	01 f7                	add    %esi,%edi
+ 80c:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 80f:	f7 65 d8             	mull   -0x28(%ebp)
+ 812:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 815:	89 f2                	mov    %esi,%edx
+ 817:	89 d0                	mov    %edx,%eax
+ 819:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 81b:	01 c8                	add    %ecx,%eax
+ 81d:	11 da                	adc    %ebx,%edx
+}
+ 81f:	83 c4 24             	add    $0x24,%esp
+ 822:	5b                   	pop    %ebx
+ 823:	5e                   	pop    %esi
+ 824:	5f                   	pop    %edi
+ 825:	5d                   	pop    %ebp
+ 826:	c3                   	ret
+
+00000827 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 827:	55                   	push   %ebp
+ 828:	89 e5                	mov    %esp,%ebp
+ 82a:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 82d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 830:	8b 50 04             	mov    0x4(%eax),%edx
+ 833:	8b 45 08             	mov    0x8(%ebp),%eax
+ 836:	8b 00                	mov    (%eax),%eax
+ 838:	29 c2                	sub    %eax,%edx
+ 83a:	83 fa 1f             	cmp    $0x1f,%edx
+ 83d:	76 07                	jbe    846 <ring_queue+0x1f>
+    return -1;
+ 83f:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 844:	eb 68                	jmp    8ae <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 846:	8b 45 08             	mov    0x8(%ebp),%eax
+ 849:	8b 40 04             	mov    0x4(%eax),%eax
+ 84c:	83 e0 1f             	and    $0x1f,%eax
+ 84f:	89 c2                	mov    %eax,%edx
+ 851:	89 d0                	mov    %edx,%eax
+ 853:	c1 e0 02             	shl    $0x2,%eax
+ 856:	01 d0                	add    %edx,%eax
+ 858:	c1 e0 02             	shl    $0x2,%eax
+ 85b:	8d 50 10             	lea    0x10(%eax),%edx
+ 85e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 861:	01 d0                	add    %edx,%eax
+ 863:	83 c0 04             	add    $0x4,%eax
+ 866:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 869:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 86c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 86f:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 871:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 874:	8b 55 10             	mov    0x10(%ebp),%edx
+ 877:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 87a:	8b 55 14             	mov    0x14(%ebp),%edx
+ 87d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 880:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 883:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 886:	8b 55 18             	mov    0x18(%ebp),%edx
+ 889:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 88c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 88f:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 892:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 895:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 89a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 89d:	8b 40 04             	mov    0x4(%eax),%eax
+ 8a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 8a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8a6:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 8a9:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 8ae:	c9                   	leave
+ 8af:	c3                   	ret
+
+000008b0 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 8b0:	55                   	push   %ebp
+ 8b1:	89 e5                	mov    %esp,%ebp
+ 8b3:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 8b6:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 8bb:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8bf:	7f 1a                	jg     8db <ring_submit+0x2b>
+ 8c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c4:	8b 40 10             	mov    0x10(%eax),%eax
+ 8c7:	83 e0 01             	and    $0x1,%eax
+ 8ca:	85 c0                	test   %eax,%eax
+ 8cc:	74 0d                	je     8db <ring_submit+0x2b>
+ 8ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8d1:	8b 40 10             	mov    0x10(%eax),%eax
+ 8d4:	83 e0 02             	and    $0x2,%eax
+ 8d7:	85 c0                	test   %eax,%eax
+ 8d9:	74 10                	je     8eb <ring_submit+0x3b>
+    return ring_enter(min);
+ 8db:	83 ec 0c             	sub    $0xc,%esp
+ 8de:	ff 75 0c             	push   0xc(%ebp)
+ 8e1:	e8 83 01 00 00       	call   a69 <ring_enter>
+ 8e6:	83 c4 10             	add    $0x10,%esp
+ 8e9:	eb 10                	jmp    8fb <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 8eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8ee:	8b 50 0c             	mov    0xc(%eax),%edx
+ 8f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f4:	8b 40 08             	mov    0x8(%eax),%eax
+ 8f7:	29 c2                	sub    %eax,%edx
+ 8f9:	89 d0                	mov    %edx,%eax
+}
+ 8fb:	c9                   	leave
+ 8fc:	c3                   	ret
+
+000008fd <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 8fd:	55                   	push   %ebp
+ 8fe:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 900:	8b 45 08             	mov    0x8(%ebp),%eax
+ 903:	8b 50 08             	mov    0x8(%eax),%edx
+ 906:	8b 45 08             	mov    0x8(%ebp),%eax
+ 909:	8b 40 0c             	mov    0xc(%eax),%eax
+ 90c:	39 c2                	cmp    %eax,%edx
+ 90e:	75 07                	jne    917 <ring_reap+0x1a>
+    return -1;
+ 910:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 915:	eb 3b                	jmp    952 <ring_reap+0x55>
+  __sync_synchronize();
+ 917:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 91c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 91f:	8b 40 08             	mov    0x8(%eax),%eax
+ 922:	83 e0 1f             	and    $0x1f,%eax
+ 925:	89 c2                	mov    %eax,%edx
+ 927:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 92a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92d:	83 c2 52             	add    $0x52,%edx
+ 930:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 934:	8b 02                	mov    (%edx),%eax
+ 936:	8b 52 04             	mov    0x4(%edx),%edx
+ 939:	89 01                	mov    %eax,(%ecx)
+ 93b:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 93e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 941:	8b 40 08             	mov    0x8(%eax),%eax
+ 944:	8d 50 01             	lea    0x1(%eax),%edx
+ 947:	8b 45 08             	mov    0x8(%ebp),%eax
+ 94a:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 94d:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 952:	5d                   	pop    %ebp
+ 953:	c3                   	ret
+
+00000954 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 954:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 95b:	74 0a                	je     967 <usyscall+0x13>
+  movl %esp, %ecx
+ 95d:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 95f:	ba 66 09 00 00       	mov    $0x966,%edx
+  sysenter
+ 964:	0f 34                	sysenter
+2:
+  ret
+ 966:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 967:	cd 40                	int    $0x40
+  ret
+ 969:	c3                   	ret
+
+0000096a <fork>:
+
+SYSCALL(fork)
+ 96a:	b8 01 00 00 00       	mov    $0x1,%eax
+ 96f:	eb e3                	jmp    954 <usyscall>
+
+00000971 <exit>:
+SYSCALL(exit)
+ 971:	b8 02 00 00 00       	mov    $0x2,%eax
+ 976:	eb dc                	jmp    954 <usyscall>
+
+00000978 <wait>:
+SYSCALL(wait)
+ 978:	b8 03 00 00 00       	mov    $0x3,%eax
+ 97d:	eb d5                	jmp    954 <usyscall>
+
+0000097f <pipe>:
+SYSCALL(pipe)
+ 97f:	b8 04 00 00 00       	mov    $0x4,%eax
+ 984:	eb ce                	jmp    954 <usyscall>
+
+00000986 <read>:
+SYSCALL(read)
+ 986:	b8 05 00 00 00       	mov    $0x5,%eax
+ 98b:	eb c7                	jmp    954 <usyscall>
+
+0000098d <write>:
+SYSCALL(write)
+ 98d:	b8 10 00 00 00       	mov    $0x10,%eax
+ 992:	eb c0                	jmp    954 <usyscall>
+
+00000994 <close>:
+SYSCALL(close)
+ 994:	b8 15 00 00 00       	mov    $0x15,%eax
+ 999:	eb b9                	jmp    954 <usyscall>
+
+0000099b <kill>:
+SYSCALL(kill)
+ 99b:	b8 06 00 00 00       	mov    $0x6,%eax
+ 9a0:	eb b2                	jmp    954 <usyscall>
+
+000009a2 <exec>:
+SYSCALL(exec)
+ 9a2:	b8 07 00 00 00       	mov    $0x7,%eax
+ 9a7:	eb ab                	jmp    954 <usyscall>
+
+000009a9 <open>:
+SYSCALL(open)
+ 9a9:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 9ae:	eb a4                	jmp    954 <usyscall>
+
+000009b0 <mknod>:
+SYSCALL(mknod)
+ 9b0:	b8 11 00 00 00       	mov    $0x11,%eax
+ 9b5:	eb 9d                	jmp    954 <usyscall>
+
+000009b7 <unlink>:
+SYSCALL(unlink)
+ 9b7:	b8 12 00 00 00       	mov    $0x12,%eax
+ 9bc:	eb 96                	jmp    954 <usyscall>
+
+000009be <fstat>:
+SYSCALL(fstat)
+ 9be:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9c3:	eb 8f                	jmp    954 <usyscall>
+
+000009c5 <link>:
+SYSCALL(link)
+ 9c5:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9ca:	eb 88                	jmp    954 <usyscall>
+
+000009cc <mkdir>:
+SYSCALL(mkdir)
+ 9cc:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9d1:	eb 81                	jmp    954 <usyscall>
+
+000009d3 <chdir>:
+SYSCALL(chdir)
+ 9d3:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9d8:	e9 77 ff ff ff       	jmp    954 <usyscall>
+
+000009dd <dup>:
+SYSCALL(dup)
+ 9dd:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 9e2:	e9 6d ff ff ff       	jmp    954 <usyscall>
+
+000009e7 <getpid>:
+SYSCALL(getpid)
+ 9e7:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 9ec:	e9 63 ff ff ff       	jmp    954 <usyscall>
+
+000009f1 <sbrk>:
+SYSCALL(sbrk)
+ 9f1:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 9f6:	e9 59 ff ff ff       	jmp    954 <usyscall>
+
+000009fb <sleep>:
+SYSCALL(sleep)
+ 9fb:	b8 0d 00 00 00       	mov    $0xd,%eax
+ a00:	e9 4f ff ff ff       	jmp    954 <usyscall>
+
+00000a05 <uptime>:
+SYSCALL(uptime)
+ a05:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a0a:	e9 45 ff ff ff       	jmp    954 <usyscall>
+
+00000a0f <kmstat>:
+SYSCALL(kmstat)
+ a0f:	b8 16 00 00 00       	mov    $0x16,%eax
+ a14:	e9 3b ff ff ff       	jmp    954 <usyscall>
+
+00000a19 <setpriority>:
+SYSCALL(setpriority)
+ a19:	b8 17 00 00 00       	mov    $0x17,%eax
+ a1e:	e9 31 ff ff ff       	jmp    954 <usyscall>
+
+00000a23 <clone>:
+SYSCALL(clone)
+ a23:	b8 18 00 00 00       	mov    $0x18,%eax
+ a28:	e9 27 ff ff ff       	jmp    954 <usyscall>
+
+00000a2d <join>:
+SYSCALL(join)
+ a2d:	b8 19 00 00 00       	mov    $0x19,%eax
+ a32:	e9 1d ff ff ff       	jmp    954 <usyscall>
+
+00000a37 <futex_wait>:
+SYSCALL(futex_wait)
+ a37:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a3c:	e9 13 ff ff ff       	jmp    954 <usyscall>
+
+00000a41 <futex_wake>:
+SYSCALL(futex_wake)
+ a41:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a46:	e9 09 ff ff ff       	jmp    954 <usyscall>
+
+00000a4b <lockstat>:
+SYSCALL(lockstat)
+ a4b:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a50:	e9 ff fe ff ff       	jmp    954 <usyscall>
+
+00000a55 <sysstat>:
+SYSCALL(sysstat)
+ a55:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a5a:	e9 f5 fe ff ff       	jmp    954 <usyscall>
+
+00000a5f <ring_setup>:
+SYSCALL(ring_setup)
+ a5f:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a64:	e9 eb fe ff ff       	jmp    954 <usyscall>
+
+00000a69 <ring_enter>:
+SYSCALL(ring_enter)
+ a69:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a6e:	e9 e1 fe ff ff       	jmp    954 <usyscall>
+
+00000a73 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a73:	55                   	push   %ebp
+ a74:	89 e5                	mov    %esp,%ebp
+ a76:	83 ec 18             	sub    $0x18,%esp
+ a79:	8b 45 0c             	mov    0xc(%ebp),%eax
+ a7c:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ a7f:	83 ec 04             	sub    $0x4,%esp
+ a82:	6a 01                	push   $0x1
+ a84:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ a87:	50                   	push   %eax
+ a88:	ff 75 08             	push   0x8(%ebp)
+ a8b:	e8 fd fe ff ff       	call   98d <write>
+ a90:	83 c4 10             	add    $0x10,%esp
+}
+ a93:	90                   	nop
+ a94:	c9                   	leave
+ a95:	c3                   	ret
+
+00000a96 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ a96:	55                   	push   %ebp
+ a97:	89 e5                	mov    %esp,%ebp
+ a99:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ a9c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ aa3:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ aa7:	74 17                	je     ac0 <printint+0x2a>
+ aa9:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ aad:	79 11                	jns    ac0 <printint+0x2a>
+    neg = 1;
+ aaf:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ ab6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ab9:	f7 d8                	neg    %eax
+ abb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ abe:	eb 06                	jmp    ac6 <printint+0x30>
+  } else {
+    x = xx;
+ ac0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ac3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ ac6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ acd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ ad0:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ ad3:	ba 00 00 00 00       	mov    $0x0,%edx
+ ad8:	f7 f1                	div    %ecx
+ ada:	89 d1                	mov    %edx,%ecx
+ adc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ adf:	8d 50 01             	lea    0x1(%eax),%edx
+ ae2:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ ae5:	0f b6 91 e0 14 00 00 	movzbl 0x14e0(%ecx),%edx
+ aec:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ af0:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ af3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ af6:	ba 00 00 00 00       	mov    $0x0,%edx
+ afb:	f7 f1                	div    %ecx
+ afd:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b00:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b04:	75 c7                	jne    acd <printint+0x37>
+  if(neg)
+ b06:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b0a:	74 2d                	je     b39 <printint+0xa3>
+    buf[i++] = '-';
+ b0c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0f:	8d 50 01             	lea    0x1(%eax),%edx
+ b12:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b15:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ b1a:	eb 1d                	jmp    b39 <printint+0xa3>
+    putc(fd, buf[i]);
+ b1c:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ b1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b22:	01 d0                	add    %edx,%eax
+ b24:	0f b6 00             	movzbl (%eax),%eax
+ b27:	0f be c0             	movsbl %al,%eax
+ b2a:	83 ec 08             	sub    $0x8,%esp
+ b2d:	50                   	push   %eax
+ b2e:	ff 75 08             	push   0x8(%ebp)
+ b31:	e8 3d ff ff ff       	call   a73 <putc>
+ b36:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ b39:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ b3d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b41:	79 d9                	jns    b1c <printint+0x86>
+}
+ b43:	90                   	nop
+ b44:	90                   	nop
+ b45:	c9                   	leave
+ b46:	c3                   	ret
+
+00000b47 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ b47:	55                   	push   %ebp
+ b48:	89 e5                	mov    %esp,%ebp
+ b4a:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ b4d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ b54:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b57:	83 c0 04             	add    $0x4,%eax
+ b5a:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b5d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b64:	e9 59 01 00 00       	jmp    cc2 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ b69:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b6c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b6f:	01 d0                	add    %edx,%eax
+ b71:	0f b6 00             	movzbl (%eax),%eax
+ b74:	0f be c0             	movsbl %al,%eax
+ b77:	25 ff 00 00 00       	and    $0xff,%eax
+ b7c:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ b7f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b83:	75 2c                	jne    bb1 <printf+0x6a>
+      if(c == '%'){
+ b85:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b89:	75 0c                	jne    b97 <printf+0x50>
+        state = '%';
+ b8b:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ b92:	e9 27 01 00 00       	jmp    cbe <printf+0x177>
+      } else {
+        putc(fd, c);
+ b97:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b9a:	0f be c0             	movsbl %al,%eax
+ b9d:	83 ec 08             	sub    $0x8,%esp
+ ba0:	50                   	push   %eax
+ ba1:	ff 75 08             	push   0x8(%ebp)
+ ba4:	e8 ca fe ff ff       	call   a73 <putc>
+ ba9:	83 c4 10             	add    $0x10,%esp
+ bac:	e9 0d 01 00 00       	jmp    cbe <printf+0x177>
+      }
+    } else if(state == '%'){
+ bb1:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ bb5:	0f 85 03 01 00 00    	jne    cbe <printf+0x177>
+      if(c == 'd'){
+ bbb:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ bbf:	75 1e                	jne    bdf <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ bc1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bc4:	8b 00                	mov    (%eax),%eax
+ bc6:	6a 01                	push   $0x1
+ bc8:	6a 0a                	push   $0xa
+ bca:	50                   	push   %eax
+ bcb:	ff 75 08             	push   0x8(%ebp)
+ bce:	e8 c3 fe ff ff       	call   a96 <printint>
+ bd3:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ bd6:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bda:	e9 d8 00 00 00       	jmp    cb7 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ bdf:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ be3:	74 06                	je     beb <printf+0xa4>
+ be5:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ be9:	75 1e                	jne    c09 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ beb:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ bee:	8b 00                	mov    (%eax),%eax
+ bf0:	6a 00                	push   $0x0
+ bf2:	6a 10                	push   $0x10
+ bf4:	50                   	push   %eax
+ bf5:	ff 75 08             	push   0x8(%ebp)
+ bf8:	e8 99 fe ff ff       	call   a96 <printint>
+ bfd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c00:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c04:	e9 ae 00 00 00       	jmp    cb7 <printf+0x170>
+      } else if(c == 's'){
+ c09:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ c0d:	75 43                	jne    c52 <printf+0x10b>
+        s = (char*)*ap;
+ c0f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c12:	8b 00                	mov    (%eax),%eax
+ c14:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ c17:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ c1b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c1f:	75 25                	jne    c46 <printf+0xff>
+          s = "(null)";
+ c21:	c7 45 f4 f6 0f 00 00 	movl   $0xff6,-0xc(%ebp)
+        while(*s != 0){
+ c28:	eb 1c                	jmp    c46 <printf+0xff>
+          putc(fd, *s);
+ c2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2d:	0f b6 00             	movzbl (%eax),%eax
+ c30:	0f be c0             	movsbl %al,%eax
+ c33:	83 ec 08             	sub    $0x8,%esp
+ c36:	50                   	push   %eax
+ c37:	ff 75 08             	push   0x8(%ebp)
+ c3a:	e8 34 fe ff ff       	call   a73 <putc>
+ c3f:	83 c4 10             	add    $0x10,%esp
+          s++;
+ c42:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ c46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c49:	0f b6 00             	movzbl (%eax),%eax
+ c4c:	84 c0                	test   %al,%al
+ c4e:	75 da                	jne    c2a <printf+0xe3>
+ c50:	eb 65                	jmp    cb7 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ c52:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c56:	75 1d                	jne    c75 <printf+0x12e>
+        putc(fd, *ap);
+ c58:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c5b:	8b 00                	mov    (%eax),%eax
+ c5d:	0f be c0             	movsbl %al,%eax
+ c60:	83 ec 08             	sub    $0x8,%esp
+ c63:	50                   	push   %eax
+ c64:	ff 75 08             	push   0x8(%ebp)
+ c67:	e8 07 fe ff ff       	call   a73 <putc>
+ c6c:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c6f:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c73:	eb 42                	jmp    cb7 <printf+0x170>
+      } else if(c == '%'){
+ c75:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c79:	75 17                	jne    c92 <printf+0x14b>
+        putc(fd, c);
+ c7b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ c7e:	0f be c0             	movsbl %al,%eax
+ c81:	83 ec 08             	sub    $0x8,%esp
+ c84:	50                   	push   %eax
+ c85:	ff 75 08             	push   0x8(%ebp)
+ c88:	e8 e6 fd ff ff       	call   a73 <putc>
+ c8d:	83 c4 10             	add    $0x10,%esp
+ c90:	eb 25                	jmp    cb7 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ c92:	83 ec 08             	sub    $0x8,%esp
+ c95:	6a 25                	push   $0x25
+ c97:	ff 75 08             	push   0x8(%ebp)
+ c9a:	e8 d4 fd ff ff       	call   a73 <putc>
+ c9f:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ ca2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ca5:	0f be c0             	movsbl %al,%eax
+ ca8:	83 ec 08             	sub    $0x8,%esp
+ cab:	50                   	push   %eax
+ cac:	ff 75 08             	push   0x8(%ebp)
+ caf:	e8 bf fd ff ff       	call   a73 <putc>
+ cb4:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ cb7:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ cbe:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ cc2:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cc5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc8:	01 d0                	add    %edx,%eax
+ cca:	0f b6 00             	movzbl (%eax),%eax
+ ccd:	84 c0                	test   %al,%al
+ ccf:	0f 85 94 fe ff ff    	jne    b69 <printf+0x22>
+    }
+  }
+}
+ cd5:	90                   	nop
+ cd6:	90                   	nop
+ cd7:	c9                   	leave
+ cd8:	c3                   	ret
+
+00000cd9 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cd9:	55                   	push   %ebp
+ cda:	89 e5                	mov    %esp,%ebp
+ cdc:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ cdf:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce2:	83 e8 08             	sub    $0x8,%eax
+ ce5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ ce8:	a1 08 29 00 00       	mov    0x2908,%eax
+ ced:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ cf0:	eb 24                	jmp    d16 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ cf2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ cf5:	8b 00                	mov    (%eax),%eax
+ cf7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ cfa:	72 12                	jb     d0e <free+0x35>
+ cfc:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ cff:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d02:	72 24                	jb     d28 <free+0x4f>
+ d04:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d07:	8b 00                	mov    (%eax),%eax
+ d09:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d0c:	72 1a                	jb     d28 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d0e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d11:	8b 00                	mov    (%eax),%eax
+ d13:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d16:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d19:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d1c:	73 d4                	jae    cf2 <free+0x19>
+ d1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d21:	8b 00                	mov    (%eax),%eax
+ d23:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d26:	73 ca                	jae    cf2 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d28:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d2b:	8b 40 04             	mov    0x4(%eax),%eax
+ d2e:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d38:	01 c2                	add    %eax,%edx
+ d3a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d3d:	8b 00                	mov    (%eax),%eax
+ d3f:	39 c2                	cmp    %eax,%edx
+ d41:	75 24                	jne    d67 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ d43:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d46:	8b 50 04             	mov    0x4(%eax),%edx
+ d49:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d4c:	8b 00                	mov    (%eax),%eax
+ d4e:	8b 40 04             	mov    0x4(%eax),%eax
+ d51:	01 c2                	add    %eax,%edx
+ d53:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d56:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d59:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d5c:	8b 00                	mov    (%eax),%eax
+ d5e:	8b 10                	mov    (%eax),%edx
+ d60:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d63:	89 10                	mov    %edx,(%eax)
+ d65:	eb 0a                	jmp    d71 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d67:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d6a:	8b 10                	mov    (%eax),%edx
+ d6c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d6f:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ d71:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d74:	8b 40 04             	mov    0x4(%eax),%eax
+ d77:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d81:	01 d0                	add    %edx,%eax
+ d83:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d86:	75 20                	jne    da8 <free+0xcf>
+    p->s.size += bp->s.size;
+ d88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d8b:	8b 50 04             	mov    0x4(%eax),%edx
+ d8e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d91:	8b 40 04             	mov    0x4(%eax),%eax
+ d94:	01 c2                	add    %eax,%edx
+ d96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d99:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ d9c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d9f:	8b 10                	mov    (%eax),%edx
+ da1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ da4:	89 10                	mov    %edx,(%eax)
+ da6:	eb 08                	jmp    db0 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ da8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dab:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ dae:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ db0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ db3:	a3 08 29 00 00       	mov    %eax,0x2908
+}
+ db8:	90                   	nop
+ db9:	c9                   	leave
+ dba:	c3                   	ret
+
+00000dbb <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ dbb:	55                   	push   %ebp
+ dbc:	89 e5                	mov    %esp,%ebp
+ dbe:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ dc1:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ dc8:	77 07                	ja     dd1 <morecore+0x16>
+    nu = 4096;
+ dca:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ dd1:	8b 45 08             	mov    0x8(%ebp),%eax
+ dd4:	c1 e0 03             	shl    $0x3,%eax
+ dd7:	83 ec 0c             	sub    $0xc,%esp
+ dda:	50                   	push   %eax
+ ddb:	e8 11 fc ff ff       	call   9f1 <sbrk>
+ de0:	83 c4 10             	add    $0x10,%esp
+ de3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ de6:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ dea:	75 07                	jne    df3 <morecore+0x38>
+    return 0;
+ dec:	b8 00 00 00 00       	mov    $0x0,%eax
+ df1:	eb 26                	jmp    e19 <morecore+0x5e>
+  hp = (Header*)p;
+ df3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ df6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ df9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ dfc:	8b 55 08             	mov    0x8(%ebp),%edx
+ dff:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ e02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e05:	83 c0 08             	add    $0x8,%eax
+ e08:	83 ec 0c             	sub    $0xc,%esp
+ e0b:	50                   	push   %eax
+ e0c:	e8 c8 fe ff ff       	call   cd9 <free>
+ e11:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ e14:	a1 08 29 00 00       	mov    0x2908,%eax
+}
+ e19:	c9                   	leave
+ e1a:	c3                   	ret
+
+00000e1b <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e1b:	55                   	push   %ebp
+ e1c:	89 e5                	mov    %esp,%ebp
+ e1e:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e21:	8b 45 08             	mov    0x8(%ebp),%eax
+ e24:	83 c0 07             	add    $0x7,%eax
+ e27:	c1 e8 03             	shr    $0x3,%eax
+ e2a:	83 c0 01             	add    $0x1,%eax
+ e2d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ e30:	a1 08 29 00 00       	mov    0x2908,%eax
+ e35:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e38:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e3c:	75 23                	jne    e61 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ e3e:	c7 45 f0 00 29 00 00 	movl   $0x2900,-0x10(%ebp)
+ e45:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e48:	a3 08 29 00 00       	mov    %eax,0x2908
+ e4d:	a1 08 29 00 00       	mov    0x2908,%eax
+ e52:	a3 00 29 00 00       	mov    %eax,0x2900
+    base.s.size = 0;
+ e57:	c7 05 04 29 00 00 00 	movl   $0x0,0x2904
+ e5e:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e61:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e64:	8b 00                	mov    (%eax),%eax
+ e66:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e69:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e6c:	8b 40 04             	mov    0x4(%eax),%eax
+ e6f:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e72:	72 4d                	jb     ec1 <malloc+0xa6>
+      if(p->s.size == nunits)
+ e74:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e77:	8b 40 04             	mov    0x4(%eax),%eax
+ e7a:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ e7d:	75 0c                	jne    e8b <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ e7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e82:	8b 10                	mov    (%eax),%edx
+ e84:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e87:	89 10                	mov    %edx,(%eax)
+ e89:	eb 26                	jmp    eb1 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ e8b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e8e:	8b 40 04             	mov    0x4(%eax),%eax
+ e91:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ e94:	89 c2                	mov    %eax,%edx
+ e96:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e99:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ e9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9f:	8b 40 04             	mov    0x4(%eax),%eax
+ ea2:	c1 e0 03             	shl    $0x3,%eax
+ ea5:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ea8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eab:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ eae:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ eb1:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eb4:	a3 08 29 00 00       	mov    %eax,0x2908
+      return (void*)(p + 1);
+ eb9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ebc:	83 c0 08             	add    $0x8,%eax
+ ebf:	eb 3b                	jmp    efc <malloc+0xe1>
+    }
+    if(p == freep)
+ ec1:	a1 08 29 00 00       	mov    0x2908,%eax
+ ec6:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ ec9:	75 1e                	jne    ee9 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ecb:	83 ec 0c             	sub    $0xc,%esp
+ ece:	ff 75 ec             	push   -0x14(%ebp)
+ ed1:	e8 e5 fe ff ff       	call   dbb <morecore>
+ ed6:	83 c4 10             	add    $0x10,%esp
+ ed9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ edc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ee0:	75 07                	jne    ee9 <malloc+0xce>
+        return 0;
+ ee2:	b8 00 00 00 00       	mov    $0x0,%eax
+ ee7:	eb 13                	jmp    efc <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ ee9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eec:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ eef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ef2:	8b 00                	mov    (%eax),%eax
+ ef4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ ef7:	e9 6d ff ff ff       	jmp    e69 <malloc+0x4e>
+  }
+}
+ efc:	c9                   	leave
+ efd:	c3                   	ret
+
+00000efe <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ efe:	55                   	push   %ebp
+ eff:	89 e5                	mov    %esp,%ebp
+ f01:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ f04:	83 ec 0c             	sub    $0xc,%esp
+ f07:	68 00 10 00 00       	push   $0x1000
+ f0c:	e8 0a ff ff ff       	call   e1b <malloc>
+ f11:	83 c4 10             	add    $0x10,%esp
+ f14:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f17:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f1b:	75 07                	jne    f24 <thread_create+0x26>
+    return -1;
+ f1d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f22:	eb 2e                	jmp    f52 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ f24:	83 ec 04             	sub    $0x4,%esp
+ f27:	ff 75 f4             	push   -0xc(%ebp)
+ f2a:	ff 75 0c             	push   0xc(%ebp)
+ f2d:	ff 75 08             	push   0x8(%ebp)
+ f30:	e8 ee fa ff ff       	call   a23 <clone>
+ f35:	83 c4 10             	add    $0x10,%esp
+ f38:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f3b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ f3f:	79 0e                	jns    f4f <thread_create+0x51>
+    free(stack);
+ f41:	83 ec 0c             	sub    $0xc,%esp
+ f44:	ff 75 f4             	push   -0xc(%ebp)
+ f47:	e8 8d fd ff ff       	call   cd9 <free>
+ f4c:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ f4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f52:	c9                   	leave
+ f53:	c3                   	ret
+
+00000f54 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ f54:	55                   	push   %ebp
+ f55:	89 e5                	mov    %esp,%ebp
+ f57:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f5a:	83 ec 0c             	sub    $0xc,%esp
+ f5d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f60:	50                   	push   %eax
+ f61:	e8 c7 fa ff ff       	call   a2d <join>
+ f66:	83 c4 10             	add    $0x10,%esp
+ f69:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f6c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f70:	78 0f                	js     f81 <thread_join+0x2d>
+    free(stack);
+ f72:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f75:	83 ec 0c             	sub    $0xc,%esp
+ f78:	50                   	push   %eax
+ f79:	e8 5b fd ff ff       	call   cd9 <free>
+ f7e:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ f81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ f84:	c9                   	leave
+ f85:	c3                   	ret
@@ -0,0 +1,55 @@
+// Print spin lock contention statistics, most waited-for
+// lock classes first.  lockstat -r also zeroes them, so the
+// next run shows only what happened in between.  Call sites
+// are kernel addresses; look them up in kernel.asm.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "lockstat.h"
+
+#define NCLASS 64
+
+struct lockstat st[NCLASS];
+
+// Print cycles in thousands, without 64-bit division.
+void
+printk(uint64 cycles)
+{
+  printf(1, " %d", (uint)(cycles >> 10));
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, reset;
+  struct lockstat t;
+
+  reset = argc > 1 && strcmp(argv[1], "-r") == 0;
+  if((n = lockstat(st, NCLASS, reset)) < 0){
+    printf(2, "lockstat: failed\n");
+    exit();
+  }
+
+  // Sort by time spent waiting.
+  for(i = 1; i < n; i++){
+    t = st[i];
+    for(j = i; j > 0 && st[j-1].spin < t.spin; j--)
+      st[j] = st[j-1];
+    st[j] = t;
+  }
+
+  printf(1, "name acquires contended spin-kcyc hold-kcyc holdmax-kcyc sites\n");
+  for(i = 0; i < n; i++){
+    if(st[i].acquires == 0)
+      continue;
+    printf(1, "%s %d %d", st[i].name, st[i].acquires, st[i].contended);
+    printk(st[i].spin);
+    printk(st[i].hold);
+    printk(st[i].holdmax);
+    for(j = 0; j < NLOCKSITE && st[i].site[j].count; j++)
+      printf(1, " %x:%d", st[i].site[j].pc, st[i].site[j].count);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,17 @@
+// Contention statistics for one class of spin locks (all the
+// locks initialized with the same name), as reported by
+// lockstat().  Times are in CPU cycles.
+#define NLOCKSITE 4
+
+struct lockstat {
+  char name[16];    // Lock name
+  uint acquires;    // Acquisitions
+  uint contended;   // Acquisitions that had to wait
+  uint64 spin;      // Cycles spent waiting
+  uint64 hold;      // Cycles held in all
+  uint64 holdmax;   // Longest hold
+  struct {
+    uint pc;        // Caller of acquire()
+    uint count;     // Contended acquisitions from there
+  } site[NLOCKSITE];  // Most contended call sites, most first
+};
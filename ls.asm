@@ -0,0 +1,2082 @@
+
+_ls:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <fmtname>:
+#include "user.h"
+#include "fs.h"
+
+char*
+fmtname(char *path)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	53                   	push   %ebx
+   4:	83 ec 14             	sub    $0x14,%esp
+  static char buf[DIRSIZ+1];
+  char *p;
+  
+  // Find first character after last slash.
+  for(p=path+strlen(path); p >= path && *p != '/'; p--)
+   7:	83 ec 0c             	sub    $0xc,%esp
+   a:	ff 75 08             	push   0x8(%ebp)
+   d:	e8 19 04 00 00       	call   42b <strlen>
+  12:	83 c4 10             	add    $0x10,%esp
+  15:	8b 55 08             	mov    0x8(%ebp),%edx
+  18:	01 d0                	add    %edx,%eax
+  1a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  1d:	eb 04                	jmp    23 <fmtname+0x23>
+  1f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  23:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  26:	3b 45 08             	cmp    0x8(%ebp),%eax
+  29:	72 0a                	jb     35 <fmtname+0x35>
+  2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  2e:	0f b6 00             	movzbl (%eax),%eax
+  31:	3c 2f                	cmp    $0x2f,%al
+  33:	75 ea                	jne    1f <fmtname+0x1f>
+    ;
+  p++;
+  35:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  
+  // Return blank-padded name.
+  if(strlen(p) >= DIRSIZ)
+  39:	83 ec 0c             	sub    $0xc,%esp
+  3c:	ff 75 f4             	push   -0xc(%ebp)
+  3f:	e8 e7 03 00 00       	call   42b <strlen>
+  44:	83 c4 10             	add    $0x10,%esp
+  47:	83 f8 0d             	cmp    $0xd,%eax
+  4a:	76 05                	jbe    51 <fmtname+0x51>
+    return p;
+  4c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  4f:	eb 60                	jmp    b1 <fmtname+0xb1>
+  memmove(buf, p, strlen(p));
+  51:	83 ec 0c             	sub    $0xc,%esp
+  54:	ff 75 f4             	push   -0xc(%ebp)
+  57:	e8 cf 03 00 00       	call   42b <strlen>
+  5c:	83 c4 10             	add    $0x10,%esp
+  5f:	83 ec 04             	sub    $0x4,%esp
+  62:	50                   	push   %eax
+  63:	ff 75 f4             	push   -0xc(%ebp)
+  66:	68 1c 15 00 00       	push   $0x151c
+  6b:	e8 38 05 00 00       	call   5a8 <memmove>
+  70:	83 c4 10             	add    $0x10,%esp
+  memset(buf+strlen(p), ' ', DIRSIZ-strlen(p));
+  73:	83 ec 0c             	sub    $0xc,%esp
+  76:	ff 75 f4             	push   -0xc(%ebp)
+  79:	e8 ad 03 00 00       	call   42b <strlen>
+  7e:	83 c4 10             	add    $0x10,%esp
+  81:	ba 0e 00 00 00       	mov    $0xe,%edx
+  86:	89 d3                	mov    %edx,%ebx
+  88:	29 c3                	sub    %eax,%ebx
+  8a:	83 ec 0c             	sub    $0xc,%esp
+  8d:	ff 75 f4             	push   -0xc(%ebp)
+  90:	e8 96 03 00 00       	call   42b <strlen>
+  95:	83 c4 10             	add    $0x10,%esp
+  98:	05 1c 15 00 00       	add    $0x151c,%eax
+  9d:	83 ec 04             	sub    $0x4,%esp
+  a0:	53                   	push   %ebx
+  a1:	6a 20                	push   $0x20
+  a3:	50                   	push   %eax
+  a4:	e8 a9 03 00 00       	call   452 <memset>
+  a9:	83 c4 10             	add    $0x10,%esp
+  return buf;
+  ac:	b8 1c 15 00 00       	mov    $0x151c,%eax
+}
+  b1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  b4:	c9                   	leave
+  b5:	c3                   	ret
+
+000000b6 <ls>:
+
+void
+ls(char *path)
+{
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	57                   	push   %edi
+  ba:	56                   	push   %esi
+  bb:	53                   	push   %ebx
+  bc:	81 ec 3c 02 00 00    	sub    $0x23c,%esp
+  char buf[512], *p;
+  int fd;
+  struct dirent de;
+  struct stat st;
+  
+  if((fd = open(path, 0)) < 0){
+  c2:	83 ec 08             	sub    $0x8,%esp
+  c5:	6a 00                	push   $0x0
+  c7:	ff 75 08             	push   0x8(%ebp)
+  ca:	e8 ff 08 00 00       	call   9ce <open>
+  cf:	83 c4 10             	add    $0x10,%esp
+  d2:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  d5:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  d9:	79 1a                	jns    f5 <ls+0x3f>
+    printf(2, "ls: cannot open %s\n", path);
+  db:	83 ec 04             	sub    $0x4,%esp
+  de:	ff 75 08             	push   0x8(%ebp)
+  e1:	68 ab 0f 00 00       	push   $0xfab
+  e6:	6a 02                	push   $0x2
+  e8:	e8 7f 0a 00 00       	call   b6c <printf>
+  ed:	83 c4 10             	add    $0x10,%esp
+    return;
+  f0:	e9 e3 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  if(fstat(fd, &st) < 0){
+  f5:	83 ec 08             	sub    $0x8,%esp
+  f8:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+  fe:	50                   	push   %eax
+  ff:	ff 75 e4             	push   -0x1c(%ebp)
+ 102:	e8 dc 08 00 00       	call   9e3 <fstat>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	85 c0                	test   %eax,%eax
+ 10c:	79 28                	jns    136 <ls+0x80>
+    printf(2, "ls: cannot stat %s\n", path);
+ 10e:	83 ec 04             	sub    $0x4,%esp
+ 111:	ff 75 08             	push   0x8(%ebp)
+ 114:	68 bf 0f 00 00       	push   $0xfbf
+ 119:	6a 02                	push   $0x2
+ 11b:	e8 4c 0a 00 00       	call   b6c <printf>
+ 120:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 123:	83 ec 0c             	sub    $0xc,%esp
+ 126:	ff 75 e4             	push   -0x1c(%ebp)
+ 129:	e8 8b 08 00 00       	call   9b9 <close>
+ 12e:	83 c4 10             	add    $0x10,%esp
+    return;
+ 131:	e9 a2 01 00 00       	jmp    2d8 <ls+0x222>
+  }
+  
+  switch(st.type){
+ 136:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 13d:	98                   	cwtl
+ 13e:	83 f8 01             	cmp    $0x1,%eax
+ 141:	74 48                	je     18b <ls+0xd5>
+ 143:	83 f8 02             	cmp    $0x2,%eax
+ 146:	0f 85 7e 01 00 00    	jne    2ca <ls+0x214>
+  case T_FILE:
+    printf(1, "%s %d %d %d\n", fmtname(path), st.type, st.ino, st.size);
+ 14c:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 152:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 158:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 15f:	0f bf d8             	movswl %ax,%ebx
+ 162:	83 ec 0c             	sub    $0xc,%esp
+ 165:	ff 75 08             	push   0x8(%ebp)
+ 168:	e8 93 fe ff ff       	call   0 <fmtname>
+ 16d:	83 c4 10             	add    $0x10,%esp
+ 170:	83 ec 08             	sub    $0x8,%esp
+ 173:	57                   	push   %edi
+ 174:	56                   	push   %esi
+ 175:	53                   	push   %ebx
+ 176:	50                   	push   %eax
+ 177:	68 d3 0f 00 00       	push   $0xfd3
+ 17c:	6a 01                	push   $0x1
+ 17e:	e8 e9 09 00 00       	call   b6c <printf>
+ 183:	83 c4 20             	add    $0x20,%esp
+    break;
+ 186:	e9 3f 01 00 00       	jmp    2ca <ls+0x214>
+  
+  case T_DIR:
+    if(strlen(path) + 1 + DIRSIZ + 1 > sizeof buf){
+ 18b:	83 ec 0c             	sub    $0xc,%esp
+ 18e:	ff 75 08             	push   0x8(%ebp)
+ 191:	e8 95 02 00 00       	call   42b <strlen>
+ 196:	83 c4 10             	add    $0x10,%esp
+ 199:	83 c0 10             	add    $0x10,%eax
+ 19c:	3d 00 02 00 00       	cmp    $0x200,%eax
+ 1a1:	76 17                	jbe    1ba <ls+0x104>
+      printf(1, "ls: path too long\n");
+ 1a3:	83 ec 08             	sub    $0x8,%esp
+ 1a6:	68 e0 0f 00 00       	push   $0xfe0
+ 1ab:	6a 01                	push   $0x1
+ 1ad:	e8 ba 09 00 00       	call   b6c <printf>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+      break;
+ 1b5:	e9 10 01 00 00       	jmp    2ca <ls+0x214>
+    }
+    strcpy(buf, path);
+ 1ba:	83 ec 08             	sub    $0x8,%esp
+ 1bd:	ff 75 08             	push   0x8(%ebp)
+ 1c0:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1c6:	50                   	push   %eax
+ 1c7:	e8 f0 01 00 00       	call   3bc <strcpy>
+ 1cc:	83 c4 10             	add    $0x10,%esp
+    p = buf+strlen(buf);
+ 1cf:	83 ec 0c             	sub    $0xc,%esp
+ 1d2:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 1d8:	50                   	push   %eax
+ 1d9:	e8 4d 02 00 00       	call   42b <strlen>
+ 1de:	83 c4 10             	add    $0x10,%esp
+ 1e1:	8d 95 e0 fd ff ff    	lea    -0x220(%ebp),%edx
+ 1e7:	01 d0                	add    %edx,%eax
+ 1e9:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    *p++ = '/';
+ 1ec:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 1ef:	8d 50 01             	lea    0x1(%eax),%edx
+ 1f2:	89 55 e0             	mov    %edx,-0x20(%ebp)
+ 1f5:	c6 00 2f             	movb   $0x2f,(%eax)
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 1f8:	e9 ac 00 00 00       	jmp    2a9 <ls+0x1f3>
+      if(de.inum == 0)
+ 1fd:	0f b7 85 d0 fd ff ff 	movzwl -0x230(%ebp),%eax
+ 204:	66 85 c0             	test   %ax,%ax
+ 207:	0f 84 9b 00 00 00    	je     2a8 <ls+0x1f2>
+        continue;
+      memmove(p, de.name, DIRSIZ);
+ 20d:	83 ec 04             	sub    $0x4,%esp
+ 210:	6a 0e                	push   $0xe
+ 212:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 218:	83 c0 02             	add    $0x2,%eax
+ 21b:	50                   	push   %eax
+ 21c:	ff 75 e0             	push   -0x20(%ebp)
+ 21f:	e8 84 03 00 00       	call   5a8 <memmove>
+ 224:	83 c4 10             	add    $0x10,%esp
+      p[DIRSIZ] = 0;
+ 227:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 22a:	83 c0 0e             	add    $0xe,%eax
+ 22d:	c6 00 00             	movb   $0x0,(%eax)
+      if(stat(buf, &st) < 0){
+ 230:	83 ec 08             	sub    $0x8,%esp
+ 233:	8d 85 bc fd ff ff    	lea    -0x244(%ebp),%eax
+ 239:	50                   	push   %eax
+ 23a:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 240:	50                   	push   %eax
+ 241:	e8 c8 02 00 00       	call   50e <stat>
+ 246:	83 c4 10             	add    $0x10,%esp
+ 249:	85 c0                	test   %eax,%eax
+ 24b:	79 1b                	jns    268 <ls+0x1b2>
+        printf(1, "ls: cannot stat %s\n", buf);
+ 24d:	83 ec 04             	sub    $0x4,%esp
+ 250:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 256:	50                   	push   %eax
+ 257:	68 bf 0f 00 00       	push   $0xfbf
+ 25c:	6a 01                	push   $0x1
+ 25e:	e8 09 09 00 00       	call   b6c <printf>
+ 263:	83 c4 10             	add    $0x10,%esp
+        continue;
+ 266:	eb 41                	jmp    2a9 <ls+0x1f3>
+      }
+      printf(1, "%s %d %d %d\n", fmtname(buf), st.type, st.ino, st.size);
+ 268:	8b bd cc fd ff ff    	mov    -0x234(%ebp),%edi
+ 26e:	8b b5 c4 fd ff ff    	mov    -0x23c(%ebp),%esi
+ 274:	0f b7 85 bc fd ff ff 	movzwl -0x244(%ebp),%eax
+ 27b:	0f bf d8             	movswl %ax,%ebx
+ 27e:	83 ec 0c             	sub    $0xc,%esp
+ 281:	8d 85 e0 fd ff ff    	lea    -0x220(%ebp),%eax
+ 287:	50                   	push   %eax
+ 288:	e8 73 fd ff ff       	call   0 <fmtname>
+ 28d:	83 c4 10             	add    $0x10,%esp
+ 290:	83 ec 08             	sub    $0x8,%esp
+ 293:	57                   	push   %edi
+ 294:	56                   	push   %esi
+ 295:	53                   	push   %ebx
+ 296:	50                   	push   %eax
+ 297:	68 d3 0f 00 00       	push   $0xfd3
+ 29c:	6a 01                	push   $0x1
+ 29e:	e8 c9 08 00 00       	call   b6c <printf>
+ 2a3:	83 c4 20             	add    $0x20,%esp
+ 2a6:	eb 01                	jmp    2a9 <ls+0x1f3>
+        continue;
+ 2a8:	90                   	nop
+    while(read(fd, &de, sizeof(de)) == sizeof(de)){
+ 2a9:	83 ec 04             	sub    $0x4,%esp
+ 2ac:	6a 10                	push   $0x10
+ 2ae:	8d 85 d0 fd ff ff    	lea    -0x230(%ebp),%eax
+ 2b4:	50                   	push   %eax
+ 2b5:	ff 75 e4             	push   -0x1c(%ebp)
+ 2b8:	e8 ee 06 00 00       	call   9ab <read>
+ 2bd:	83 c4 10             	add    $0x10,%esp
+ 2c0:	83 f8 10             	cmp    $0x10,%eax
+ 2c3:	0f 84 34 ff ff ff    	je     1fd <ls+0x147>
+    }
+    break;
+ 2c9:	90                   	nop
+  }
+  close(fd);
+ 2ca:	83 ec 0c             	sub    $0xc,%esp
+ 2cd:	ff 75 e4             	push   -0x1c(%ebp)
+ 2d0:	e8 e4 06 00 00       	call   9b9 <close>
+ 2d5:	83 c4 10             	add    $0x10,%esp
+}
+ 2d8:	8d 65 f4             	lea    -0xc(%ebp),%esp
+ 2db:	5b                   	pop    %ebx
+ 2dc:	5e                   	pop    %esi
+ 2dd:	5f                   	pop    %edi
+ 2de:	5d                   	pop    %ebp
+ 2df:	c3                   	ret
+
+000002e0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+ 2e0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+ 2e4:	83 e4 f0             	and    $0xfffffff0,%esp
+ 2e7:	ff 71 fc             	push   -0x4(%ecx)
+ 2ea:	55                   	push   %ebp
+ 2eb:	89 e5                	mov    %esp,%ebp
+ 2ed:	53                   	push   %ebx
+ 2ee:	51                   	push   %ecx
+ 2ef:	83 ec 10             	sub    $0x10,%esp
+ 2f2:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+ 2f4:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 2f7:	7f 15                	jg     30e <main+0x2e>
+    ls(".");
+ 2f9:	83 ec 0c             	sub    $0xc,%esp
+ 2fc:	68 f3 0f 00 00       	push   $0xff3
+ 301:	e8 b0 fd ff ff       	call   b6 <ls>
+ 306:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 309:	e8 88 06 00 00       	call   996 <exit>
+  }
+  for(i=1; i<argc; i++)
+ 30e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 315:	eb 21                	jmp    338 <main+0x58>
+    ls(argv[i]);
+ 317:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 31a:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 321:	8b 43 04             	mov    0x4(%ebx),%eax
+ 324:	01 d0                	add    %edx,%eax
+ 326:	8b 00                	mov    (%eax),%eax
+ 328:	83 ec 0c             	sub    $0xc,%esp
+ 32b:	50                   	push   %eax
+ 32c:	e8 85 fd ff ff       	call   b6 <ls>
+ 331:	83 c4 10             	add    $0x10,%esp
+  for(i=1; i<argc; i++)
+ 334:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 338:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 33b:	3b 03                	cmp    (%ebx),%eax
+ 33d:	7c d8                	jl     317 <main+0x37>
+  exit();
+ 33f:	e8 52 06 00 00       	call   996 <exit>
+
+00000344 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	57                   	push   %edi
+ 348:	53                   	push   %ebx
+char*
+ 349:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 34c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 34f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 352:	89 cb                	mov    %ecx,%ebx
+ 354:	89 df                	mov    %ebx,%edi
+ 356:	89 d1                	mov    %edx,%ecx
+ 358:	fc                   	cld
+ 359:	f3 aa                	rep stos %al,%es:(%edi)
+ 35b:	89 ca                	mov    %ecx,%edx
+ 35d:	89 fb                	mov    %edi,%ebx
+ 35f:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 362:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 365:	90                   	nop
+ 366:	5b                   	pop    %ebx
+ 367:	5f                   	pop    %edi
+ 368:	5d                   	pop    %ebp
+ 369:	c3                   	ret
+
+0000036a <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 36a:	55                   	push   %ebp
+ 36b:	89 e5                	mov    %esp,%ebp
+ 36d:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 370:	8b 55 08             	mov    0x8(%ebp),%edx
+ 373:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 376:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 379:	f0 87 02             	lock xchg %eax,(%edx)
+ 37c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 37f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 382:	c9                   	leave
+ 383:	c3                   	ret
+
+00000384 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 384:	55                   	push   %ebp
+ 385:	89 e5                	mov    %esp,%ebp
+ 387:	53                   	push   %ebx
+ 388:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 38b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 38e:	8b 55 10             	mov    0x10(%ebp),%edx
+ 391:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 394:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 397:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 39b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 39e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 3a1:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 3a4:	c9                   	leave
+ 3a5:	c3                   	ret
+
+000003a6 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 3a6:	55                   	push   %ebp
+ 3a7:	89 e5                	mov    %esp,%ebp
+ 3a9:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 3ac:	0f 31                	rdtsc
+ 3ae:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3b1:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 3b4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 3b7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 3ba:	c9                   	leave
+ 3bb:	c3                   	ret
+
+000003bc <strcpy>:
+{
+ 3bc:	55                   	push   %ebp
+ 3bd:	89 e5                	mov    %esp,%ebp
+ 3bf:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 3c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 3c8:	90                   	nop
+ 3c9:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 3cc:	8d 42 01             	lea    0x1(%edx),%eax
+ 3cf:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 3d2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3d5:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3d8:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 3db:	0f b6 12             	movzbl (%edx),%edx
+ 3de:	88 10                	mov    %dl,(%eax)
+ 3e0:	0f b6 00             	movzbl (%eax),%eax
+ 3e3:	84 c0                	test   %al,%al
+ 3e5:	75 e2                	jne    3c9 <strcpy+0xd>
+  return os;
+ 3e7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3ea:	c9                   	leave
+ 3eb:	c3                   	ret
+
+000003ec <strcmp>:
+{
+ 3ec:	55                   	push   %ebp
+ 3ed:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 3ef:	eb 08                	jmp    3f9 <strcmp+0xd>
+    p++, q++;
+ 3f1:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 3f5:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 3f9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3fc:	0f b6 00             	movzbl (%eax),%eax
+ 3ff:	84 c0                	test   %al,%al
+ 401:	74 10                	je     413 <strcmp+0x27>
+ 403:	8b 45 08             	mov    0x8(%ebp),%eax
+ 406:	0f b6 10             	movzbl (%eax),%edx
+ 409:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 40c:	0f b6 00             	movzbl (%eax),%eax
+ 40f:	38 c2                	cmp    %al,%dl
+ 411:	74 de                	je     3f1 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 413:	8b 45 08             	mov    0x8(%ebp),%eax
+ 416:	0f b6 00             	movzbl (%eax),%eax
+ 419:	0f b6 d0             	movzbl %al,%edx
+ 41c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 41f:	0f b6 00             	movzbl (%eax),%eax
+ 422:	0f b6 c0             	movzbl %al,%eax
+ 425:	29 c2                	sub    %eax,%edx
+ 427:	89 d0                	mov    %edx,%eax
+}
+ 429:	5d                   	pop    %ebp
+ 42a:	c3                   	ret
+
+0000042b <strlen>:
+{
+ 42b:	55                   	push   %ebp
+ 42c:	89 e5                	mov    %esp,%ebp
+ 42e:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 431:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 438:	eb 04                	jmp    43e <strlen+0x13>
+ 43a:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 43e:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 441:	8b 45 08             	mov    0x8(%ebp),%eax
+ 444:	01 d0                	add    %edx,%eax
+ 446:	0f b6 00             	movzbl (%eax),%eax
+ 449:	84 c0                	test   %al,%al
+ 44b:	75 ed                	jne    43a <strlen+0xf>
+  return n;
+ 44d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 450:	c9                   	leave
+ 451:	c3                   	ret
+
+00000452 <memset>:
+{
+ 452:	55                   	push   %ebp
+ 453:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 455:	8b 45 10             	mov    0x10(%ebp),%eax
+ 458:	50                   	push   %eax
+ 459:	ff 75 0c             	push   0xc(%ebp)
+ 45c:	ff 75 08             	push   0x8(%ebp)
+ 45f:	e8 e0 fe ff ff       	call   344 <stosb>
+ 464:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 467:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 46a:	c9                   	leave
+ 46b:	c3                   	ret
+
+0000046c <strchr>:
+{
+ 46c:	55                   	push   %ebp
+ 46d:	89 e5                	mov    %esp,%ebp
+ 46f:	83 ec 04             	sub    $0x4,%esp
+ 472:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 475:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 478:	eb 14                	jmp    48e <strchr+0x22>
+    if(*s == c)
+ 47a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47d:	0f b6 00             	movzbl (%eax),%eax
+ 480:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 483:	75 05                	jne    48a <strchr+0x1e>
+      return (char*)s;
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+ 488:	eb 13                	jmp    49d <strchr+0x31>
+  for(; *s; s++)
+ 48a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 48e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 491:	0f b6 00             	movzbl (%eax),%eax
+ 494:	84 c0                	test   %al,%al
+ 496:	75 e2                	jne    47a <strchr+0xe>
+  return 0;
+ 498:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 49d:	c9                   	leave
+ 49e:	c3                   	ret
+
+0000049f <gets>:
+{
+ 49f:	55                   	push   %ebp
+ 4a0:	89 e5                	mov    %esp,%ebp
+ 4a2:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 4a5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 4ac:	eb 42                	jmp    4f0 <gets+0x51>
+    cc = read(0, &c, 1);
+ 4ae:	83 ec 04             	sub    $0x4,%esp
+ 4b1:	6a 01                	push   $0x1
+ 4b3:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 4b6:	50                   	push   %eax
+ 4b7:	6a 00                	push   $0x0
+ 4b9:	e8 ed 04 00 00       	call   9ab <read>
+ 4be:	83 c4 10             	add    $0x10,%esp
+ 4c1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 4c4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 4c8:	7e 33                	jle    4fd <gets+0x5e>
+    buf[i++] = c;
+ 4ca:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4cd:	8d 50 01             	lea    0x1(%eax),%edx
+ 4d0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 4d3:	89 c2                	mov    %eax,%edx
+ 4d5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4d8:	01 c2                	add    %eax,%edx
+ 4da:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4de:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 4e0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4e4:	3c 0a                	cmp    $0xa,%al
+ 4e6:	74 16                	je     4fe <gets+0x5f>
+ 4e8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 4ec:	3c 0d                	cmp    $0xd,%al
+ 4ee:	74 0e                	je     4fe <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 4f0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4f3:	83 c0 01             	add    $0x1,%eax
+ 4f6:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 4f9:	7f b3                	jg     4ae <gets+0xf>
+ 4fb:	eb 01                	jmp    4fe <gets+0x5f>
+      break;
+ 4fd:	90                   	nop
+  buf[i] = '\0';
+ 4fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 501:	8b 45 08             	mov    0x8(%ebp),%eax
+ 504:	01 d0                	add    %edx,%eax
+ 506:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 509:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 50c:	c9                   	leave
+ 50d:	c3                   	ret
+
+0000050e <stat>:
+{
+ 50e:	55                   	push   %ebp
+ 50f:	89 e5                	mov    %esp,%ebp
+ 511:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 514:	83 ec 08             	sub    $0x8,%esp
+ 517:	6a 00                	push   $0x0
+ 519:	ff 75 08             	push   0x8(%ebp)
+ 51c:	e8 ad 04 00 00       	call   9ce <open>
+ 521:	83 c4 10             	add    $0x10,%esp
+ 524:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 527:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 52b:	79 07                	jns    534 <stat+0x26>
+    return -1;
+ 52d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 532:	eb 25                	jmp    559 <stat+0x4b>
+  r = fstat(fd, st);
+ 534:	83 ec 08             	sub    $0x8,%esp
+ 537:	ff 75 0c             	push   0xc(%ebp)
+ 53a:	ff 75 f4             	push   -0xc(%ebp)
+ 53d:	e8 a1 04 00 00       	call   9e3 <fstat>
+ 542:	83 c4 10             	add    $0x10,%esp
+ 545:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 548:	83 ec 0c             	sub    $0xc,%esp
+ 54b:	ff 75 f4             	push   -0xc(%ebp)
+ 54e:	e8 66 04 00 00       	call   9b9 <close>
+ 553:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 556:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 559:	c9                   	leave
+ 55a:	c3                   	ret
+
+0000055b <atoi>:
+{
+ 55b:	55                   	push   %ebp
+ 55c:	89 e5                	mov    %esp,%ebp
+ 55e:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 561:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 568:	eb 25                	jmp    58f <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 56a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 56d:	89 d0                	mov    %edx,%eax
+ 56f:	c1 e0 02             	shl    $0x2,%eax
+ 572:	01 d0                	add    %edx,%eax
+ 574:	01 c0                	add    %eax,%eax
+ 576:	89 c1                	mov    %eax,%ecx
+ 578:	8b 45 08             	mov    0x8(%ebp),%eax
+ 57b:	8d 50 01             	lea    0x1(%eax),%edx
+ 57e:	89 55 08             	mov    %edx,0x8(%ebp)
+ 581:	0f b6 00             	movzbl (%eax),%eax
+ 584:	0f be c0             	movsbl %al,%eax
+ 587:	01 c8                	add    %ecx,%eax
+ 589:	83 e8 30             	sub    $0x30,%eax
+ 58c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 58f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 592:	0f b6 00             	movzbl (%eax),%eax
+ 595:	3c 2f                	cmp    $0x2f,%al
+ 597:	7e 0a                	jle    5a3 <atoi+0x48>
+ 599:	8b 45 08             	mov    0x8(%ebp),%eax
+ 59c:	0f b6 00             	movzbl (%eax),%eax
+ 59f:	3c 39                	cmp    $0x39,%al
+ 5a1:	7e c7                	jle    56a <atoi+0xf>
+  return n;
+ 5a3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 5a6:	c9                   	leave
+ 5a7:	c3                   	ret
+
+000005a8 <memmove>:
+{
+ 5a8:	55                   	push   %ebp
+ 5a9:	89 e5                	mov    %esp,%ebp
+ 5ab:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 5ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 5b4:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 5b7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 5ba:	eb 17                	jmp    5d3 <memmove+0x2b>
+    *dst++ = *src++;
+ 5bc:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 5bf:	8d 42 01             	lea    0x1(%edx),%eax
+ 5c2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 5c5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5c8:	8d 48 01             	lea    0x1(%eax),%ecx
+ 5cb:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 5ce:	0f b6 12             	movzbl (%edx),%edx
+ 5d1:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 5d3:	8b 45 10             	mov    0x10(%ebp),%eax
+ 5d6:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 5d9:	89 55 10             	mov    %edx,0x10(%ebp)
+ 5dc:	85 c0                	test   %eax,%eax
+ 5de:	7f dc                	jg     5bc <memmove+0x14>
+  return vdst;
+ 5e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 5e3:	c9                   	leave
+ 5e4:	c3                   	ret
+
+000005e5 <mutex_init>:
+{
+ 5e5:	55                   	push   %ebp
+ 5e6:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 5e8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5eb:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 5f1:	90                   	nop
+ 5f2:	5d                   	pop    %ebp
+ 5f3:	c3                   	ret
+
+000005f4 <mutex_lock>:
+{
+ 5f4:	55                   	push   %ebp
+ 5f5:	89 e5                	mov    %esp,%ebp
+ 5f7:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 5fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fd:	6a 01                	push   $0x1
+ 5ff:	6a 00                	push   $0x0
+ 601:	50                   	push   %eax
+ 602:	e8 7d fd ff ff       	call   384 <cmpxchg>
+ 607:	83 c4 0c             	add    $0xc,%esp
+ 60a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 60d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 611:	74 46                	je     659 <mutex_lock+0x65>
+  if(c != 2)
+ 613:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 617:	74 38                	je     651 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 619:	8b 45 08             	mov    0x8(%ebp),%eax
+ 61c:	6a 02                	push   $0x2
+ 61e:	50                   	push   %eax
+ 61f:	e8 46 fd ff ff       	call   36a <xchg>
+ 624:	83 c4 08             	add    $0x8,%esp
+ 627:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 62a:	eb 25                	jmp    651 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 62c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62f:	83 ec 08             	sub    $0x8,%esp
+ 632:	6a 02                	push   $0x2
+ 634:	50                   	push   %eax
+ 635:	e8 22 04 00 00       	call   a5c <futex_wait>
+ 63a:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 63d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 640:	83 ec 08             	sub    $0x8,%esp
+ 643:	6a 02                	push   $0x2
+ 645:	50                   	push   %eax
+ 646:	e8 1f fd ff ff       	call   36a <xchg>
+ 64b:	83 c4 10             	add    $0x10,%esp
+ 64e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 651:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 655:	75 d5                	jne    62c <mutex_lock+0x38>
+ 657:	eb 01                	jmp    65a <mutex_lock+0x66>
+    return;
+ 659:	90                   	nop
+}
+ 65a:	c9                   	leave
+ 65b:	c3                   	ret
+
+0000065c <mutex_unlock>:
+{
+ 65c:	55                   	push   %ebp
+ 65d:	89 e5                	mov    %esp,%ebp
+ 65f:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 662:	8b 45 08             	mov    0x8(%ebp),%eax
+ 665:	6a 00                	push   $0x0
+ 667:	50                   	push   %eax
+ 668:	e8 fd fc ff ff       	call   36a <xchg>
+ 66d:	83 c4 08             	add    $0x8,%esp
+ 670:	83 f8 02             	cmp    $0x2,%eax
+ 673:	75 11                	jne    686 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 675:	8b 45 08             	mov    0x8(%ebp),%eax
+ 678:	83 ec 08             	sub    $0x8,%esp
+ 67b:	6a 01                	push   $0x1
+ 67d:	50                   	push   %eax
+ 67e:	e8 e3 03 00 00       	call   a66 <futex_wake>
+ 683:	83 c4 10             	add    $0x10,%esp
+}
+ 686:	90                   	nop
+ 687:	c9                   	leave
+ 688:	c3                   	ret
+
+00000689 <cond_init>:
+{
+ 689:	55                   	push   %ebp
+ 68a:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 68c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 68f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 695:	90                   	nop
+ 696:	5d                   	pop    %ebp
+ 697:	c3                   	ret
+
+00000698 <cond_wait>:
+{
+ 698:	55                   	push   %ebp
+ 699:	89 e5                	mov    %esp,%ebp
+ 69b:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 69e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6a1:	8b 00                	mov    (%eax),%eax
+ 6a3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 6a6:	83 ec 0c             	sub    $0xc,%esp
+ 6a9:	ff 75 0c             	push   0xc(%ebp)
+ 6ac:	e8 ab ff ff ff       	call   65c <mutex_unlock>
+ 6b1:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 6b4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b7:	83 ec 08             	sub    $0x8,%esp
+ 6ba:	ff 75 f4             	push   -0xc(%ebp)
+ 6bd:	50                   	push   %eax
+ 6be:	e8 99 03 00 00       	call   a5c <futex_wait>
+ 6c3:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6c6:	eb 11                	jmp    6d9 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 6c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6cb:	83 ec 08             	sub    $0x8,%esp
+ 6ce:	6a 02                	push   $0x2
+ 6d0:	50                   	push   %eax
+ 6d1:	e8 86 03 00 00       	call   a5c <futex_wait>
+ 6d6:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 6d9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 6dc:	83 ec 08             	sub    $0x8,%esp
+ 6df:	6a 02                	push   $0x2
+ 6e1:	50                   	push   %eax
+ 6e2:	e8 83 fc ff ff       	call   36a <xchg>
+ 6e7:	83 c4 10             	add    $0x10,%esp
+ 6ea:	85 c0                	test   %eax,%eax
+ 6ec:	75 da                	jne    6c8 <cond_wait+0x30>
+}
+ 6ee:	90                   	nop
+ 6ef:	90                   	nop
+ 6f0:	c9                   	leave
+ 6f1:	c3                   	ret
+
+000006f2 <condbump>:
+{
+ 6f2:	55                   	push   %ebp
+ 6f3:	89 e5                	mov    %esp,%ebp
+ 6f5:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 6f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6fb:	8b 00                	mov    (%eax),%eax
+ 6fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 700:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 703:	8d 50 01             	lea    0x1(%eax),%edx
+ 706:	8b 45 08             	mov    0x8(%ebp),%eax
+ 709:	52                   	push   %edx
+ 70a:	ff 75 fc             	push   -0x4(%ebp)
+ 70d:	50                   	push   %eax
+ 70e:	e8 71 fc ff ff       	call   384 <cmpxchg>
+ 713:	83 c4 0c             	add    $0xc,%esp
+ 716:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 719:	75 dd                	jne    6f8 <condbump+0x6>
+}
+ 71b:	90                   	nop
+ 71c:	90                   	nop
+ 71d:	c9                   	leave
+ 71e:	c3                   	ret
+
+0000071f <cond_signal>:
+{
+ 71f:	55                   	push   %ebp
+ 720:	89 e5                	mov    %esp,%ebp
+ 722:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 725:	ff 75 08             	push   0x8(%ebp)
+ 728:	e8 c5 ff ff ff       	call   6f2 <condbump>
+ 72d:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 730:	8b 45 08             	mov    0x8(%ebp),%eax
+ 733:	83 ec 08             	sub    $0x8,%esp
+ 736:	6a 01                	push   $0x1
+ 738:	50                   	push   %eax
+ 739:	e8 28 03 00 00       	call   a66 <futex_wake>
+ 73e:	83 c4 10             	add    $0x10,%esp
+}
+ 741:	90                   	nop
+ 742:	c9                   	leave
+ 743:	c3                   	ret
+
+00000744 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 744:	55                   	push   %ebp
+ 745:	89 e5                	mov    %esp,%ebp
+ 747:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 74a:	ff 75 08             	push   0x8(%ebp)
+ 74d:	e8 a0 ff ff ff       	call   6f2 <condbump>
+ 752:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 755:	8b 45 08             	mov    0x8(%ebp),%eax
+ 758:	83 ec 08             	sub    $0x8,%esp
+ 75b:	68 ff ff ff 7f       	push   $0x7fffffff
+ 760:	50                   	push   %eax
+ 761:	e8 00 03 00 00       	call   a66 <futex_wake>
+ 766:	83 c4 10             	add    $0x10,%esp
+}
+ 769:	90                   	nop
+ 76a:	c9                   	leave
+ 76b:	c3                   	ret
+
+0000076c <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 76c:	55                   	push   %ebp
+ 76d:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 76f:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 774:	8b 00                	mov    (%eax),%eax
+}
+ 776:	5d                   	pop    %ebp
+ 777:	c3                   	ret
+
+00000778 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 778:	55                   	push   %ebp
+ 779:	89 e5                	mov    %esp,%ebp
+ 77b:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 77e:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 783:	8b 00                	mov    (%eax),%eax
+ 785:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 788:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 78c:	74 05                	je     793 <vgetpid+0x1b>
+    return pid;
+ 78e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 791:	eb 05                	jmp    798 <vgetpid+0x20>
+  return getpid();
+ 793:	e8 74 02 00 00       	call   a0c <getpid>
+}
+ 798:	c9                   	leave
+ 799:	c3                   	ret
+
+0000079a <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 79a:	55                   	push   %ebp
+ 79b:	89 e5                	mov    %esp,%ebp
+ 79d:	57                   	push   %edi
+ 79e:	56                   	push   %esi
+ 79f:	53                   	push   %ebx
+ 7a0:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 7a3:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 7aa:	e8 f7 fb ff ff       	call   3a6 <rdtsc>
+ 7af:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 7b2:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 7b5:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 7b8:	29 c8                	sub    %ecx,%eax
+ 7ba:	19 da                	sbb    %ebx,%edx
+ 7bc:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 7bf:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 7c2:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7c5:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7c8:	89 d0                	mov    %edx,%eax
+ 7ca:	31 d2                	xor    %edx,%edx
+ 7cc:	89 c1                	mov    %eax,%ecx
+ 7ce:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 7d3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7d6:	8b 40 04             	mov    0x4(%eax),%eax
+ 7d9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7de:	89 df                	mov    %ebx,%edi
+ 7e0:	0f af f8             	imul   %eax,%edi
+ 7e3:	89 d6                	mov    %edx,%esi
+ 7e5:	0f af f1             	imul   %ecx,%esi
+ 7e8:	01 f7                	add    %esi,%edi
+ 7ea:	f7 e1                	mul    %ecx
+ 7ec:	89 c1                	mov    %eax,%ecx
+ 7ee:	89 d3                	mov    %edx,%ebx
+ 7f0:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 7f3:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 7f5:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 7f8:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 7fb:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 7fe:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 805:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 808:	8b 40 04             	mov    0x4(%eax),%eax
+ 80b:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 80e:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 815:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 818:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 81b:	89 d7                	mov    %edx,%edi
+ 81d:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 820:	0f af fe             	imul   %esi,%edi
+ 823:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 826:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 829:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 82c:	0f af f0             	imul   %eax,%esi
+ 82f:	01 f7                	add    %esi,%edi
+ 831:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 834:	f7 65 d8             	mull   -0x28(%ebp)
+ 837:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 83a:	89 f2                	mov    %esi,%edx
+ 83c:	89 d0                	mov    %edx,%eax
+ 83e:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 840:	01 c8                	add    %ecx,%eax
+ 842:	11 da                	adc    %ebx,%edx
+}
+ 844:	83 c4 24             	add    $0x24,%esp
+ 847:	5b                   	pop    %ebx
+ 848:	5e                   	pop    %esi
+ 849:	5f                   	pop    %edi
+ 84a:	5d                   	pop    %ebp
+ 84b:	c3                   	ret
+
+0000084c <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 84c:	55                   	push   %ebp
+ 84d:	89 e5                	mov    %esp,%ebp
+ 84f:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 852:	8b 45 08             	mov    0x8(%ebp),%eax
+ 855:	8b 50 04             	mov    0x4(%eax),%edx
+ 858:	8b 45 08             	mov    0x8(%ebp),%eax
+ 85b:	8b 00                	mov    (%eax),%eax
+ 85d:	29 c2                	sub    %eax,%edx
+ 85f:	83 fa 1f             	cmp    $0x1f,%edx
+ 862:	76 07                	jbe    86b <ring_queue+0x1f>
+    return -1;
+ 864:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 869:	eb 68                	jmp    8d3 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 86b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 86e:	8b 40 04             	mov    0x4(%eax),%eax
+ 871:	83 e0 1f             	and    $0x1f,%eax
+ 874:	89 c2                	mov    %eax,%edx
+ 876:	89 d0                	mov    %edx,%eax
+ 878:	c1 e0 02             	shl    $0x2,%eax
+ 87b:	01 d0                	add    %edx,%eax
+ 87d:	c1 e0 02             	shl    $0x2,%eax
+ 880:	8d 50 10             	lea    0x10(%eax),%edx
+ 883:	8b 45 08             	mov    0x8(%ebp),%eax
+ 886:	01 d0                	add    %edx,%eax
+ 888:	83 c0 04             	add    $0x4,%eax
+ 88b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 88e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 891:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 894:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 896:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 899:	8b 55 10             	mov    0x10(%ebp),%edx
+ 89c:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 89f:	8b 55 14             	mov    0x14(%ebp),%edx
+ 8a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8a5:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 8a8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8ab:	8b 55 18             	mov    0x18(%ebp),%edx
+ 8ae:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 8b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 8b4:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 8b7:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 8ba:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 8bf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8c2:	8b 40 04             	mov    0x4(%eax),%eax
+ 8c5:	8d 50 01             	lea    0x1(%eax),%edx
+ 8c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8cb:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 8ce:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 8d3:	c9                   	leave
+ 8d4:	c3                   	ret
+
+000008d5 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 8d5:	55                   	push   %ebp
+ 8d6:	89 e5                	mov    %esp,%ebp
+ 8d8:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 8db:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 8e0:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8e4:	7f 1a                	jg     900 <ring_submit+0x2b>
+ 8e6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8e9:	8b 40 10             	mov    0x10(%eax),%eax
+ 8ec:	83 e0 01             	and    $0x1,%eax
+ 8ef:	85 c0                	test   %eax,%eax
+ 8f1:	74 0d                	je     900 <ring_submit+0x2b>
+ 8f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 8f6:	8b 40 10             	mov    0x10(%eax),%eax
+ 8f9:	83 e0 02             	and    $0x2,%eax
+ 8fc:	85 c0                	test   %eax,%eax
+ 8fe:	74 10                	je     910 <ring_submit+0x3b>
+    return ring_enter(min);
+ 900:	83 ec 0c             	sub    $0xc,%esp
+ 903:	ff 75 0c             	push   0xc(%ebp)
+ 906:	e8 83 01 00 00       	call   a8e <ring_enter>
+ 90b:	83 c4 10             	add    $0x10,%esp
+ 90e:	eb 10                	jmp    920 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 910:	8b 45 08             	mov    0x8(%ebp),%eax
+ 913:	8b 50 0c             	mov    0xc(%eax),%edx
+ 916:	8b 45 08             	mov    0x8(%ebp),%eax
+ 919:	8b 40 08             	mov    0x8(%eax),%eax
+ 91c:	29 c2                	sub    %eax,%edx
+ 91e:	89 d0                	mov    %edx,%eax
+}
+ 920:	c9                   	leave
+ 921:	c3                   	ret
+
+00000922 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 922:	55                   	push   %ebp
+ 923:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 925:	8b 45 08             	mov    0x8(%ebp),%eax
+ 928:	8b 50 08             	mov    0x8(%eax),%edx
+ 92b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 92e:	8b 40 0c             	mov    0xc(%eax),%eax
+ 931:	39 c2                	cmp    %eax,%edx
+ 933:	75 07                	jne    93c <ring_reap+0x1a>
+    return -1;
+ 935:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 93a:	eb 3b                	jmp    977 <ring_reap+0x55>
+  __sync_synchronize();
+ 93c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 941:	8b 45 08             	mov    0x8(%ebp),%eax
+ 944:	8b 40 08             	mov    0x8(%eax),%eax
+ 947:	83 e0 1f             	and    $0x1f,%eax
+ 94a:	89 c2                	mov    %eax,%edx
+ 94c:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 94f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 952:	83 c2 52             	add    $0x52,%edx
+ 955:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 959:	8b 02                	mov    (%edx),%eax
+ 95b:	8b 52 04             	mov    0x4(%edx),%edx
+ 95e:	89 01                	mov    %eax,(%ecx)
+ 960:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 963:	8b 45 08             	mov    0x8(%ebp),%eax
+ 966:	8b 40 08             	mov    0x8(%eax),%eax
+ 969:	8d 50 01             	lea    0x1(%eax),%edx
+ 96c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 96f:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 972:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 977:	5d                   	pop    %ebp
+ 978:	c3                   	ret
+
+00000979 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 979:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 980:	74 0a                	je     98c <usyscall+0x13>
+  movl %esp, %ecx
+ 982:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 984:	ba 8b 09 00 00       	mov    $0x98b,%edx
+  sysenter
+ 989:	0f 34                	sysenter
+2:
+  ret
+ 98b:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 98c:	cd 40                	int    $0x40
+  ret
+ 98e:	c3                   	ret
+
+0000098f <fork>:
+
+SYSCALL(fork)
+ 98f:	b8 01 00 00 00       	mov    $0x1,%eax
+ 994:	eb e3                	jmp    979 <usyscall>
+
+00000996 <exit>:
+SYSCALL(exit)
+ 996:	b8 02 00 00 00       	mov    $0x2,%eax
+ 99b:	eb dc                	jmp    979 <usyscall>
+
+0000099d <wait>:
+SYSCALL(wait)
+ 99d:	b8 03 00 00 00       	mov    $0x3,%eax
+ 9a2:	eb d5                	jmp    979 <usyscall>
+
+000009a4 <pipe>:
+SYSCALL(pipe)
+ 9a4:	b8 04 00 00 00       	mov    $0x4,%eax
+ 9a9:	eb ce                	jmp    979 <usyscall>
+
+000009ab <read>:
+SYSCALL(read)
+ 9ab:	b8 05 00 00 00       	mov    $0x5,%eax
+ 9b0:	eb c7                	jmp    979 <usyscall>
+
+000009b2 <write>:
+SYSCALL(write)
+ 9b2:	b8 10 00 00 00       	mov    $0x10,%eax
+ 9b7:	eb c0                	jmp    979 <usyscall>
+
+000009b9 <close>:
+SYSCALL(close)
+ 9b9:	b8 15 00 00 00       	mov    $0x15,%eax
+ 9be:	eb b9                	jmp    979 <usyscall>
+
+000009c0 <kill>:
+SYSCALL(kill)
+ 9c0:	b8 06 00 00 00       	mov    $0x6,%eax
+ 9c5:	eb b2                	jmp    979 <usyscall>
+
+000009c7 <exec>:
+SYSCALL(exec)
+ 9c7:	b8 07 00 00 00       	mov    $0x7,%eax
+ 9cc:	eb ab                	jmp    979 <usyscall>
+
+000009ce <open>:
+SYSCALL(open)
+ 9ce:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 9d3:	eb a4                	jmp    979 <usyscall>
+
+000009d5 <mknod>:
+SYSCALL(mknod)
+ 9d5:	b8 11 00 00 00       	mov    $0x11,%eax
+ 9da:	eb 9d                	jmp    979 <usyscall>
+
+000009dc <unlink>:
+SYSCALL(unlink)
+ 9dc:	b8 12 00 00 00       	mov    $0x12,%eax
+ 9e1:	eb 96                	jmp    979 <usyscall>
+
+000009e3 <fstat>:
+SYSCALL(fstat)
+ 9e3:	b8 08 00 00 00       	mov    $0x8,%eax
+ 9e8:	eb 8f                	jmp    979 <usyscall>
+
+000009ea <link>:
+SYSCALL(link)
+ 9ea:	b8 13 00 00 00       	mov    $0x13,%eax
+ 9ef:	eb 88                	jmp    979 <usyscall>
+
+000009f1 <mkdir>:
+SYSCALL(mkdir)
+ 9f1:	b8 14 00 00 00       	mov    $0x14,%eax
+ 9f6:	eb 81                	jmp    979 <usyscall>
+
+000009f8 <chdir>:
+SYSCALL(chdir)
+ 9f8:	b8 09 00 00 00       	mov    $0x9,%eax
+ 9fd:	e9 77 ff ff ff       	jmp    979 <usyscall>
+
+00000a02 <dup>:
+SYSCALL(dup)
+ a02:	b8 0a 00 00 00       	mov    $0xa,%eax
+ a07:	e9 6d ff ff ff       	jmp    979 <usyscall>
+
+00000a0c <getpid>:
+SYSCALL(getpid)
+ a0c:	b8 0b 00 00 00       	mov    $0xb,%eax
+ a11:	e9 63 ff ff ff       	jmp    979 <usyscall>
+
+00000a16 <sbrk>:
+SYSCALL(sbrk)
+ a16:	b8 0c 00 00 00       	mov    $0xc,%eax
+ a1b:	e9 59 ff ff ff       	jmp    979 <usyscall>
+
+00000a20 <sleep>:
+SYSCALL(sleep)
+ a20:	b8 0d 00 00 00       	mov    $0xd,%eax
+ a25:	e9 4f ff ff ff       	jmp    979 <usyscall>
+
+00000a2a <uptime>:
+SYSCALL(uptime)
+ a2a:	b8 0e 00 00 00       	mov    $0xe,%eax
+ a2f:	e9 45 ff ff ff       	jmp    979 <usyscall>
+
+00000a34 <kmstat>:
+SYSCALL(kmstat)
+ a34:	b8 16 00 00 00       	mov    $0x16,%eax
+ a39:	e9 3b ff ff ff       	jmp    979 <usyscall>
+
+00000a3e <setpriority>:
+SYSCALL(setpriority)
+ a3e:	b8 17 00 00 00       	mov    $0x17,%eax
+ a43:	e9 31 ff ff ff       	jmp    979 <usyscall>
+
+00000a48 <clone>:
+SYSCALL(clone)
+ a48:	b8 18 00 00 00       	mov    $0x18,%eax
+ a4d:	e9 27 ff ff ff       	jmp    979 <usyscall>
+
+00000a52 <join>:
+SYSCALL(join)
+ a52:	b8 19 00 00 00       	mov    $0x19,%eax
+ a57:	e9 1d ff ff ff       	jmp    979 <usyscall>
+
+00000a5c <futex_wait>:
+SYSCALL(futex_wait)
+ a5c:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ a61:	e9 13 ff ff ff       	jmp    979 <usyscall>
+
+00000a66 <futex_wake>:
+SYSCALL(futex_wake)
+ a66:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ a6b:	e9 09 ff ff ff       	jmp    979 <usyscall>
+
+00000a70 <lockstat>:
+SYSCALL(lockstat)
+ a70:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ a75:	e9 ff fe ff ff       	jmp    979 <usyscall>
+
+00000a7a <sysstat>:
+SYSCALL(sysstat)
+ a7a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ a7f:	e9 f5 fe ff ff       	jmp    979 <usyscall>
+
+00000a84 <ring_setup>:
+SYSCALL(ring_setup)
+ a84:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ a89:	e9 eb fe ff ff       	jmp    979 <usyscall>
+
+00000a8e <ring_enter>:
+SYSCALL(ring_enter)
+ a8e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ a93:	e9 e1 fe ff ff       	jmp    979 <usyscall>
+
+00000a98 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ a98:	55                   	push   %ebp
+ a99:	89 e5                	mov    %esp,%ebp
+ a9b:	83 ec 18             	sub    $0x18,%esp
+ a9e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ aa1:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ aa4:	83 ec 04             	sub    $0x4,%esp
+ aa7:	6a 01                	push   $0x1
+ aa9:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ aac:	50                   	push   %eax
+ aad:	ff 75 08             	push   0x8(%ebp)
+ ab0:	e8 fd fe ff ff       	call   9b2 <write>
+ ab5:	83 c4 10             	add    $0x10,%esp
+}
+ ab8:	90                   	nop
+ ab9:	c9                   	leave
+ aba:	c3                   	ret
+
+00000abb <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ abb:	55                   	push   %ebp
+ abc:	89 e5                	mov    %esp,%ebp
+ abe:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ ac1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ ac8:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ acc:	74 17                	je     ae5 <printint+0x2a>
+ ace:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ ad2:	79 11                	jns    ae5 <printint+0x2a>
+    neg = 1;
+ ad4:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ adb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ade:	f7 d8                	neg    %eax
+ ae0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ ae3:	eb 06                	jmp    aeb <printint+0x30>
+  } else {
+    x = xx;
+ ae5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ ae8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ aeb:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ af2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ af5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ af8:	ba 00 00 00 00       	mov    $0x0,%edx
+ afd:	f7 f1                	div    %ecx
+ aff:	89 d1                	mov    %edx,%ecx
+ b01:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b04:	8d 50 01             	lea    0x1(%eax),%edx
+ b07:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b0a:	0f b6 91 08 15 00 00 	movzbl 0x1508(%ecx),%edx
+ b11:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ b15:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ b18:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ b1b:	ba 00 00 00 00       	mov    $0x0,%edx
+ b20:	f7 f1                	div    %ecx
+ b22:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ b25:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ b29:	75 c7                	jne    af2 <printint+0x37>
+  if(neg)
+ b2b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b2f:	74 2d                	je     b5e <printint+0xa3>
+    buf[i++] = '-';
+ b31:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b34:	8d 50 01             	lea    0x1(%eax),%edx
+ b37:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ b3a:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ b3f:	eb 1d                	jmp    b5e <printint+0xa3>
+    putc(fd, buf[i]);
+ b41:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ b44:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b47:	01 d0                	add    %edx,%eax
+ b49:	0f b6 00             	movzbl (%eax),%eax
+ b4c:	0f be c0             	movsbl %al,%eax
+ b4f:	83 ec 08             	sub    $0x8,%esp
+ b52:	50                   	push   %eax
+ b53:	ff 75 08             	push   0x8(%ebp)
+ b56:	e8 3d ff ff ff       	call   a98 <putc>
+ b5b:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ b5e:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ b62:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ b66:	79 d9                	jns    b41 <printint+0x86>
+}
+ b68:	90                   	nop
+ b69:	90                   	nop
+ b6a:	c9                   	leave
+ b6b:	c3                   	ret
+
+00000b6c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ b6c:	55                   	push   %ebp
+ b6d:	89 e5                	mov    %esp,%ebp
+ b6f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ b72:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ b79:	8d 45 0c             	lea    0xc(%ebp),%eax
+ b7c:	83 c0 04             	add    $0x4,%eax
+ b7f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b82:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ b89:	e9 59 01 00 00       	jmp    ce7 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ b8e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b94:	01 d0                	add    %edx,%eax
+ b96:	0f b6 00             	movzbl (%eax),%eax
+ b99:	0f be c0             	movsbl %al,%eax
+ b9c:	25 ff 00 00 00       	and    $0xff,%eax
+ ba1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ ba4:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ ba8:	75 2c                	jne    bd6 <printf+0x6a>
+      if(c == '%'){
+ baa:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ bae:	75 0c                	jne    bbc <printf+0x50>
+        state = '%';
+ bb0:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ bb7:	e9 27 01 00 00       	jmp    ce3 <printf+0x177>
+      } else {
+        putc(fd, c);
+ bbc:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ bbf:	0f be c0             	movsbl %al,%eax
+ bc2:	83 ec 08             	sub    $0x8,%esp
+ bc5:	50                   	push   %eax
+ bc6:	ff 75 08             	push   0x8(%ebp)
+ bc9:	e8 ca fe ff ff       	call   a98 <putc>
+ bce:	83 c4 10             	add    $0x10,%esp
+ bd1:	e9 0d 01 00 00       	jmp    ce3 <printf+0x177>
+      }
+    } else if(state == '%'){
+ bd6:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ bda:	0f 85 03 01 00 00    	jne    ce3 <printf+0x177>
+      if(c == 'd'){
+ be0:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ be4:	75 1e                	jne    c04 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ be6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ be9:	8b 00                	mov    (%eax),%eax
+ beb:	6a 01                	push   $0x1
+ bed:	6a 0a                	push   $0xa
+ bef:	50                   	push   %eax
+ bf0:	ff 75 08             	push   0x8(%ebp)
+ bf3:	e8 c3 fe ff ff       	call   abb <printint>
+ bf8:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ bfb:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ bff:	e9 d8 00 00 00       	jmp    cdc <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ c04:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ c08:	74 06                	je     c10 <printf+0xa4>
+ c0a:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ c0e:	75 1e                	jne    c2e <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ c10:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c13:	8b 00                	mov    (%eax),%eax
+ c15:	6a 00                	push   $0x0
+ c17:	6a 10                	push   $0x10
+ c19:	50                   	push   %eax
+ c1a:	ff 75 08             	push   0x8(%ebp)
+ c1d:	e8 99 fe ff ff       	call   abb <printint>
+ c22:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c25:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c29:	e9 ae 00 00 00       	jmp    cdc <printf+0x170>
+      } else if(c == 's'){
+ c2e:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ c32:	75 43                	jne    c77 <printf+0x10b>
+        s = (char*)*ap;
+ c34:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c37:	8b 00                	mov    (%eax),%eax
+ c39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ c3c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ c40:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c44:	75 25                	jne    c6b <printf+0xff>
+          s = "(null)";
+ c46:	c7 45 f4 f5 0f 00 00 	movl   $0xff5,-0xc(%ebp)
+        while(*s != 0){
+ c4d:	eb 1c                	jmp    c6b <printf+0xff>
+          putc(fd, *s);
+ c4f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c52:	0f b6 00             	movzbl (%eax),%eax
+ c55:	0f be c0             	movsbl %al,%eax
+ c58:	83 ec 08             	sub    $0x8,%esp
+ c5b:	50                   	push   %eax
+ c5c:	ff 75 08             	push   0x8(%ebp)
+ c5f:	e8 34 fe ff ff       	call   a98 <putc>
+ c64:	83 c4 10             	add    $0x10,%esp
+          s++;
+ c67:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ c6b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c6e:	0f b6 00             	movzbl (%eax),%eax
+ c71:	84 c0                	test   %al,%al
+ c73:	75 da                	jne    c4f <printf+0xe3>
+ c75:	eb 65                	jmp    cdc <printf+0x170>
+        }
+      } else if(c == 'c'){
+ c77:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ c7b:	75 1d                	jne    c9a <printf+0x12e>
+        putc(fd, *ap);
+ c7d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ c80:	8b 00                	mov    (%eax),%eax
+ c82:	0f be c0             	movsbl %al,%eax
+ c85:	83 ec 08             	sub    $0x8,%esp
+ c88:	50                   	push   %eax
+ c89:	ff 75 08             	push   0x8(%ebp)
+ c8c:	e8 07 fe ff ff       	call   a98 <putc>
+ c91:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ c94:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ c98:	eb 42                	jmp    cdc <printf+0x170>
+      } else if(c == '%'){
+ c9a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ c9e:	75 17                	jne    cb7 <printf+0x14b>
+        putc(fd, c);
+ ca0:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ca3:	0f be c0             	movsbl %al,%eax
+ ca6:	83 ec 08             	sub    $0x8,%esp
+ ca9:	50                   	push   %eax
+ caa:	ff 75 08             	push   0x8(%ebp)
+ cad:	e8 e6 fd ff ff       	call   a98 <putc>
+ cb2:	83 c4 10             	add    $0x10,%esp
+ cb5:	eb 25                	jmp    cdc <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ cb7:	83 ec 08             	sub    $0x8,%esp
+ cba:	6a 25                	push   $0x25
+ cbc:	ff 75 08             	push   0x8(%ebp)
+ cbf:	e8 d4 fd ff ff       	call   a98 <putc>
+ cc4:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ cc7:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ cca:	0f be c0             	movsbl %al,%eax
+ ccd:	83 ec 08             	sub    $0x8,%esp
+ cd0:	50                   	push   %eax
+ cd1:	ff 75 08             	push   0x8(%ebp)
+ cd4:	e8 bf fd ff ff       	call   a98 <putc>
+ cd9:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ cdc:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ce3:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ce7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ cea:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ced:	01 d0                	add    %edx,%eax
+ cef:	0f b6 00             	movzbl (%eax),%eax
+ cf2:	84 c0                	test   %al,%al
+ cf4:	0f 85 94 fe ff ff    	jne    b8e <printf+0x22>
+    }
+  }
+}
+ cfa:	90                   	nop
+ cfb:	90                   	nop
+ cfc:	c9                   	leave
+ cfd:	c3                   	ret
+
+00000cfe <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ cfe:	55                   	push   %ebp
+ cff:	89 e5                	mov    %esp,%ebp
+ d01:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ d04:	8b 45 08             	mov    0x8(%ebp),%eax
+ d07:	83 e8 08             	sub    $0x8,%eax
+ d0a:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d0d:	a1 34 15 00 00       	mov    0x1534,%eax
+ d12:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d15:	eb 24                	jmp    d3b <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ d17:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d1a:	8b 00                	mov    (%eax),%eax
+ d1c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d1f:	72 12                	jb     d33 <free+0x35>
+ d21:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d24:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d27:	72 24                	jb     d4d <free+0x4f>
+ d29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d2c:	8b 00                	mov    (%eax),%eax
+ d2e:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d31:	72 1a                	jb     d4d <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ d33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d36:	8b 00                	mov    (%eax),%eax
+ d38:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ d3b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d3e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ d41:	73 d4                	jae    d17 <free+0x19>
+ d43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d46:	8b 00                	mov    (%eax),%eax
+ d48:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ d4b:	73 ca                	jae    d17 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ d4d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d50:	8b 40 04             	mov    0x4(%eax),%eax
+ d53:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ d5a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d5d:	01 c2                	add    %eax,%edx
+ d5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d62:	8b 00                	mov    (%eax),%eax
+ d64:	39 c2                	cmp    %eax,%edx
+ d66:	75 24                	jne    d8c <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ d68:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d6b:	8b 50 04             	mov    0x4(%eax),%edx
+ d6e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d71:	8b 00                	mov    (%eax),%eax
+ d73:	8b 40 04             	mov    0x4(%eax),%eax
+ d76:	01 c2                	add    %eax,%edx
+ d78:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d7b:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ d7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d81:	8b 00                	mov    (%eax),%eax
+ d83:	8b 10                	mov    (%eax),%edx
+ d85:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d88:	89 10                	mov    %edx,(%eax)
+ d8a:	eb 0a                	jmp    d96 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ d8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d8f:	8b 10                	mov    (%eax),%edx
+ d91:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ d94:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ d96:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ d99:	8b 40 04             	mov    0x4(%eax),%eax
+ d9c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ da3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ da6:	01 d0                	add    %edx,%eax
+ da8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ dab:	75 20                	jne    dcd <free+0xcf>
+    p->s.size += bp->s.size;
+ dad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ db0:	8b 50 04             	mov    0x4(%eax),%edx
+ db3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ db6:	8b 40 04             	mov    0x4(%eax),%eax
+ db9:	01 c2                	add    %eax,%edx
+ dbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dbe:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ dc1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ dc4:	8b 10                	mov    (%eax),%edx
+ dc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dc9:	89 10                	mov    %edx,(%eax)
+ dcb:	eb 08                	jmp    dd5 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ dcd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dd0:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ dd3:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ dd5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ dd8:	a3 34 15 00 00       	mov    %eax,0x1534
+}
+ ddd:	90                   	nop
+ dde:	c9                   	leave
+ ddf:	c3                   	ret
+
+00000de0 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ de0:	55                   	push   %ebp
+ de1:	89 e5                	mov    %esp,%ebp
+ de3:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ de6:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ded:	77 07                	ja     df6 <morecore+0x16>
+    nu = 4096;
+ def:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ df6:	8b 45 08             	mov    0x8(%ebp),%eax
+ df9:	c1 e0 03             	shl    $0x3,%eax
+ dfc:	83 ec 0c             	sub    $0xc,%esp
+ dff:	50                   	push   %eax
+ e00:	e8 11 fc ff ff       	call   a16 <sbrk>
+ e05:	83 c4 10             	add    $0x10,%esp
+ e08:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ e0b:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ e0f:	75 07                	jne    e18 <morecore+0x38>
+    return 0;
+ e11:	b8 00 00 00 00       	mov    $0x0,%eax
+ e16:	eb 26                	jmp    e3e <morecore+0x5e>
+  hp = (Header*)p;
+ e18:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e1b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ e1e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e21:	8b 55 08             	mov    0x8(%ebp),%edx
+ e24:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ e27:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e2a:	83 c0 08             	add    $0x8,%eax
+ e2d:	83 ec 0c             	sub    $0xc,%esp
+ e30:	50                   	push   %eax
+ e31:	e8 c8 fe ff ff       	call   cfe <free>
+ e36:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ e39:	a1 34 15 00 00       	mov    0x1534,%eax
+}
+ e3e:	c9                   	leave
+ e3f:	c3                   	ret
+
+00000e40 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ e40:	55                   	push   %ebp
+ e41:	89 e5                	mov    %esp,%ebp
+ e43:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ e46:	8b 45 08             	mov    0x8(%ebp),%eax
+ e49:	83 c0 07             	add    $0x7,%eax
+ e4c:	c1 e8 03             	shr    $0x3,%eax
+ e4f:	83 c0 01             	add    $0x1,%eax
+ e52:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ e55:	a1 34 15 00 00       	mov    0x1534,%eax
+ e5a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ e5d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e61:	75 23                	jne    e86 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ e63:	c7 45 f0 2c 15 00 00 	movl   $0x152c,-0x10(%ebp)
+ e6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e6d:	a3 34 15 00 00       	mov    %eax,0x1534
+ e72:	a1 34 15 00 00       	mov    0x1534,%eax
+ e77:	a3 2c 15 00 00       	mov    %eax,0x152c
+    base.s.size = 0;
+ e7c:	c7 05 30 15 00 00 00 	movl   $0x0,0x1530
+ e83:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ e86:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e89:	8b 00                	mov    (%eax),%eax
+ e8b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ e8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e91:	8b 40 04             	mov    0x4(%eax),%eax
+ e94:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ e97:	72 4d                	jb     ee6 <malloc+0xa6>
+      if(p->s.size == nunits)
+ e99:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ e9c:	8b 40 04             	mov    0x4(%eax),%eax
+ e9f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ ea2:	75 0c                	jne    eb0 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ ea4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ea7:	8b 10                	mov    (%eax),%edx
+ ea9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ eac:	89 10                	mov    %edx,(%eax)
+ eae:	eb 26                	jmp    ed6 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ eb0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ eb3:	8b 40 04             	mov    0x4(%eax),%eax
+ eb6:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ eb9:	89 c2                	mov    %eax,%edx
+ ebb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ebe:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ec1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ec4:	8b 40 04             	mov    0x4(%eax),%eax
+ ec7:	c1 e0 03             	shl    $0x3,%eax
+ eca:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ ecd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ed0:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ed3:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ed6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ed9:	a3 34 15 00 00       	mov    %eax,0x1534
+      return (void*)(p + 1);
+ ede:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ee1:	83 c0 08             	add    $0x8,%eax
+ ee4:	eb 3b                	jmp    f21 <malloc+0xe1>
+    }
+    if(p == freep)
+ ee6:	a1 34 15 00 00       	mov    0x1534,%eax
+ eeb:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ eee:	75 1e                	jne    f0e <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ef0:	83 ec 0c             	sub    $0xc,%esp
+ ef3:	ff 75 ec             	push   -0x14(%ebp)
+ ef6:	e8 e5 fe ff ff       	call   de0 <morecore>
+ efb:	83 c4 10             	add    $0x10,%esp
+ efe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f01:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f05:	75 07                	jne    f0e <malloc+0xce>
+        return 0;
+ f07:	b8 00 00 00 00       	mov    $0x0,%eax
+ f0c:	eb 13                	jmp    f21 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ f0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f11:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f14:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ f17:	8b 00                	mov    (%eax),%eax
+ f19:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ f1c:	e9 6d ff ff ff       	jmp    e8e <malloc+0x4e>
+  }
+}
+ f21:	c9                   	leave
+ f22:	c3                   	ret
+
+00000f23 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ f23:	55                   	push   %ebp
+ f24:	89 e5                	mov    %esp,%ebp
+ f26:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ f29:	83 ec 0c             	sub    $0xc,%esp
+ f2c:	68 00 10 00 00       	push   $0x1000
+ f31:	e8 0a ff ff ff       	call   e40 <malloc>
+ f36:	83 c4 10             	add    $0x10,%esp
+ f39:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f3c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f40:	75 07                	jne    f49 <thread_create+0x26>
+    return -1;
+ f42:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ f47:	eb 2e                	jmp    f77 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ f49:	83 ec 04             	sub    $0x4,%esp
+ f4c:	ff 75 f4             	push   -0xc(%ebp)
+ f4f:	ff 75 0c             	push   0xc(%ebp)
+ f52:	ff 75 08             	push   0x8(%ebp)
+ f55:	e8 ee fa ff ff       	call   a48 <clone>
+ f5a:	83 c4 10             	add    $0x10,%esp
+ f5d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ f60:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ f64:	79 0e                	jns    f74 <thread_create+0x51>
+    free(stack);
+ f66:	83 ec 0c             	sub    $0xc,%esp
+ f69:	ff 75 f4             	push   -0xc(%ebp)
+ f6c:	e8 8d fd ff ff       	call   cfe <free>
+ f71:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ f74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ f77:	c9                   	leave
+ f78:	c3                   	ret
+
+00000f79 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ f79:	55                   	push   %ebp
+ f7a:	89 e5                	mov    %esp,%ebp
+ f7c:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ f7f:	83 ec 0c             	sub    $0xc,%esp
+ f82:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ f85:	50                   	push   %eax
+ f86:	e8 c7 fa ff ff       	call   a52 <join>
+ f8b:	83 c4 10             	add    $0x10,%esp
+ f8e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ f91:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ f95:	78 0f                	js     fa6 <thread_join+0x2d>
+    free(stack);
+ f97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ f9a:	83 ec 0c             	sub    $0xc,%esp
+ f9d:	50                   	push   %eax
+ f9e:	e8 5b fd ff ff       	call   cfe <free>
+ fa3:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ fa6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ fa9:	c9                   	leave
+ faa:	c3                   	ret
@@ -3,6 +3,7 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 
@@ -17,6 +18,7 @@ extern char end[]; // first address after kernel loaded from ELF file
 int
 main(void)
 {
+  meminit();       // detect physical memory
   kinit1(end, P2V(4*1024*1024)); // phys page allocator
   kvmalloc();      // kernel page table
   mpinit();        // collect info about this machine
@@ -27,16 +29,20 @@ main(void)
   ioapicinit();    // another interrupt controller
   consoleinit();   // I/O devices & their interrupts
   uartinit();      // serial port
+  kminit();        // kernel object allocator
   pinit();         // process table
+  futexinit();     // futex locks
   tvinit();        // trap vectors
+  vdsoinit();      // page shared with user code
   binit();         // buffer cache
   fileinit();      // file table
+  pipeinit();      // pipes
   iinit();         // inode cache
   ideinit();       // disk
   if(!ismp)
     timerinit();   // uniprocessor timer
   startothers();   // start other processors
-  kinit2(P2V(4*1024*1024), P2V(PHYSTOP)); // must come after startothers()
+  kinit2(P2V(4*1024*1024), P2V(phystop)); // must come after startothers()
   userinit();      // first user process
   // Finish setting up this processor in mpmain.
   mpmain();
@@ -58,6 +64,7 @@ mpmain(void)
 {
   cprintf("cpu%d: starting\n", cpu->id);
   idtinit();       // load idt register
+  fpuinit();       // FPU and SSE
   xchg(&cpu->started, 1); // tell startothers() we're up
   scheduler();     // start running processes
 }
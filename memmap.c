@@ -0,0 +1,128 @@
+// Physical memory detection.
+//
+// bootasm.S asks the BIOS for its E820 memory map and leaves it at
+// E820MAP.  A multiboot loader skips bootasm.S and instead passes a
+// pointer to its own copy of the map, which entry.S saves in mbinfo.
+// meminit() reads whichever is there, keeps the usable RAM ranges,
+// and sets phystop to the top of the RAM the kernel can map.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+
+#define NRAM      32          // most usable ranges kept
+#define E820_RAM  1           // usable memory
+#define MBMAGIC   0x2badb002  // in %eax from a multiboot loader
+#define MB_MEM    (1<<0)      // mem_lower and mem_upper are valid
+#define MB_MMAP   (1<<6)      // mmap_length and mmap_addr are valid
+
+// Memory map entry.
+struct e820 {
+  uint addrlo, addrhi;
+  uint lenlo, lenhi;
+  uint type;
+};
+
+// Multiboot information structure (the parts we use).
+struct mbinfo {
+  uint flags;
+  uint mem_lower;     // KB of RAM from 0
+  uint mem_upper;     // KB of RAM from 1MB
+  uint unused[8];
+  uint mmap_length;
+  uint mmap_addr;     // e820 entries, each preceded by its size
+};
+
+uint mbmagic;  // set by entry.S
+uint mbinfo;
+uint phystop;  // top of usable physical memory
+
+static struct {
+  uint start;
+  uint end;
+} ram[NRAM];
+static int nram;
+
+// Record that len bytes of RAM start at addr, clipped to
+// whole pages below PHYSLIMIT.
+static void
+addram(uint addrlo, uint addrhi, uint lenlo, uint lenhi)
+{
+  uint start, end;
+
+  if(addrhi != 0 || addrlo >= PHYSLIMIT || nram == NRAM)
+    return;
+  start = PGROUNDUP(addrlo);
+  if(lenhi != 0 || addrlo + lenlo < addrlo || addrlo + lenlo > PHYSLIMIT)
+    end = PHYSLIMIT;
+  else
+    end = PGROUNDDOWN(addrlo + lenlo);
+  if(start >= end)
+    return;
+  ram[nram].start = start;
+  ram[nram].end = end;
+  nram++;
+  if(end > phystop)
+    phystop = end;
+}
+
+static void
+adde820(struct e820 *e)
+{
+  if(e->type == E820_RAM)
+    addram(e->addrlo, e->addrhi, e->lenlo, e->lenhi);
+}
+
+// Only the first 4MB are mapped this early.
+static int
+lowmem(uint pa, uint n)
+{
+  return pa < 4*1024*1024 && n <= 4*1024*1024 - pa;
+}
+
+void
+meminit(void)
+{
+  struct mbinfo *mb;
+  struct e820 *e, *ee;
+  uint *p, *ep;
+
+  if(mbmagic == MBMAGIC && lowmem(mbinfo, sizeof(*mb))){
+    mb = p2v(mbinfo);
+    if((mb->flags & MB_MMAP) && lowmem(mb->mmap_addr, mb->mmap_length)){
+      p = p2v(mb->mmap_addr);
+      ep = (uint*)((char*)p + mb->mmap_length);
+      for(; p < ep && p[0] >= sizeof(*e); p = (uint*)((char*)p + p[0] + 4))
+        adde820((struct e820*)(p + 1));
+    } else if(mb->flags & MB_MEM){
+      addram(0, 0, mb->mem_lower*1024, 0);
+      addram(EXTMEM, 0, mb->mem_upper*1024, 0);
+    }
+  } else {
+    e = p2v(E820MAP+4);
+    ee = p2v(*(ushort*)p2v(E820MAP));
+    if(ee >= e && ee <= e + 128 && ((char*)ee - (char*)e) % sizeof(*e) == 0)
+      for(; e < ee; e++)
+        adde820(e);
+  }
+
+  if(nram == 0){
+    // Nobody told us: assume the traditional PC layout.
+    addram(0, 0, 640*1024, 0);
+    addram(EXTMEM, 0, PHYSTOP - EXTMEM, 0);
+  }
+}
+
+// Fetch the i'th range of usable RAM.
+// Returns 0 if there are no more.
+int
+memrange(int i, uint *start, uint *end)
+{
+  if(i < 0 || i >= nram)
+    return 0;
+  *start = ram[i].start;
+  *end = ram[i].end;
+  return 1;
+}
@@ -0,0 +1,1802 @@
+
+_mkdir:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	53                   	push   %ebx
+   e:	51                   	push   %ecx
+   f:	83 ec 10             	sub    $0x10,%esp
+  12:	89 cb                	mov    %ecx,%ebx
+  int i;
+
+  if(argc < 2){
+  14:	83 3b 01             	cmpl   $0x1,(%ebx)
+  17:	7f 17                	jg     30 <main+0x30>
+    printf(2, "Usage: mkdir files...\n");
+  19:	83 ec 08             	sub    $0x8,%esp
+  1c:	68 f7 0c 00 00       	push   $0xcf7
+  21:	6a 02                	push   $0x2
+  23:	e8 90 08 00 00       	call   8b8 <printf>
+  28:	83 c4 10             	add    $0x10,%esp
+    exit();
+  2b:	e8 b2 06 00 00       	call   6e2 <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+  30:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+  37:	eb 4b                	jmp    84 <main+0x84>
+    if(mkdir(argv[i]) < 0){
+  39:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  3c:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  43:	8b 43 04             	mov    0x4(%ebx),%eax
+  46:	01 d0                	add    %edx,%eax
+  48:	8b 00                	mov    (%eax),%eax
+  4a:	83 ec 0c             	sub    $0xc,%esp
+  4d:	50                   	push   %eax
+  4e:	e8 ea 06 00 00       	call   73d <mkdir>
+  53:	83 c4 10             	add    $0x10,%esp
+  56:	85 c0                	test   %eax,%eax
+  58:	79 26                	jns    80 <main+0x80>
+      printf(2, "mkdir: %s failed to create\n", argv[i]);
+  5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  5d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+  64:	8b 43 04             	mov    0x4(%ebx),%eax
+  67:	01 d0                	add    %edx,%eax
+  69:	8b 00                	mov    (%eax),%eax
+  6b:	83 ec 04             	sub    $0x4,%esp
+  6e:	50                   	push   %eax
+  6f:	68 0e 0d 00 00       	push   $0xd0e
+  74:	6a 02                	push   $0x2
+  76:	e8 3d 08 00 00       	call   8b8 <printf>
+  7b:	83 c4 10             	add    $0x10,%esp
+      break;
+  7e:	eb 0b                	jmp    8b <main+0x8b>
+  for(i = 1; i < argc; i++){
+  80:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  84:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  87:	3b 03                	cmp    (%ebx),%eax
+  89:	7c ae                	jl     39 <main+0x39>
+    }
+  }
+
+  exit();
+  8b:	e8 52 06 00 00       	call   6e2 <exit>
+
+00000090 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+  90:	55                   	push   %ebp
+  91:	89 e5                	mov    %esp,%ebp
+  93:	57                   	push   %edi
+  94:	53                   	push   %ebx
+char*
+  95:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  98:	8b 55 10             	mov    0x10(%ebp),%edx
+  9b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  9e:	89 cb                	mov    %ecx,%ebx
+  a0:	89 df                	mov    %ebx,%edi
+  a2:	89 d1                	mov    %edx,%ecx
+  a4:	fc                   	cld
+  a5:	f3 aa                	rep stos %al,%es:(%edi)
+  a7:	89 ca                	mov    %ecx,%edx
+  a9:	89 fb                	mov    %edi,%ebx
+  ab:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  ae:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+  b1:	90                   	nop
+  b2:	5b                   	pop    %ebx
+  b3:	5f                   	pop    %edi
+  b4:	5d                   	pop    %ebp
+  b5:	c3                   	ret
+
+000000b6 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+  b6:	55                   	push   %ebp
+  b7:	89 e5                	mov    %esp,%ebp
+  b9:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+  bc:	8b 55 08             	mov    0x8(%ebp),%edx
+  bf:	8b 45 0c             	mov    0xc(%ebp),%eax
+  c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  c5:	f0 87 02             	lock xchg %eax,(%edx)
+  c8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+  cb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+  ce:	c9                   	leave
+  cf:	c3                   	ret
+
+000000d0 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+  d0:	55                   	push   %ebp
+  d1:	89 e5                	mov    %esp,%ebp
+  d3:	53                   	push   %ebx
+  d4:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+  d7:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  da:	8b 55 10             	mov    0x10(%ebp),%edx
+  dd:	8b 45 0c             	mov    0xc(%ebp),%eax
+  e0:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  e3:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  e7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  ea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+  ed:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  f0:	c9                   	leave
+  f1:	c3                   	ret
+
+000000f2 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+  f2:	55                   	push   %ebp
+  f3:	89 e5                	mov    %esp,%ebp
+  f5:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+  f8:	0f 31                	rdtsc
+  fa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  fd:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 100:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 103:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 106:	c9                   	leave
+ 107:	c3                   	ret
+
+00000108 <strcpy>:
+{
+ 108:	55                   	push   %ebp
+ 109:	89 e5                	mov    %esp,%ebp
+ 10b:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 10e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 111:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 114:	90                   	nop
+ 115:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 118:	8d 42 01             	lea    0x1(%edx),%eax
+ 11b:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 11e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 121:	8d 48 01             	lea    0x1(%eax),%ecx
+ 124:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 127:	0f b6 12             	movzbl (%edx),%edx
+ 12a:	88 10                	mov    %dl,(%eax)
+ 12c:	0f b6 00             	movzbl (%eax),%eax
+ 12f:	84 c0                	test   %al,%al
+ 131:	75 e2                	jne    115 <strcpy+0xd>
+  return os;
+ 133:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 136:	c9                   	leave
+ 137:	c3                   	ret
+
+00000138 <strcmp>:
+{
+ 138:	55                   	push   %ebp
+ 139:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 13b:	eb 08                	jmp    145 <strcmp+0xd>
+    p++, q++;
+ 13d:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 141:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 145:	8b 45 08             	mov    0x8(%ebp),%eax
+ 148:	0f b6 00             	movzbl (%eax),%eax
+ 14b:	84 c0                	test   %al,%al
+ 14d:	74 10                	je     15f <strcmp+0x27>
+ 14f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 152:	0f b6 10             	movzbl (%eax),%edx
+ 155:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 158:	0f b6 00             	movzbl (%eax),%eax
+ 15b:	38 c2                	cmp    %al,%dl
+ 15d:	74 de                	je     13d <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 15f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 162:	0f b6 00             	movzbl (%eax),%eax
+ 165:	0f b6 d0             	movzbl %al,%edx
+ 168:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 16b:	0f b6 00             	movzbl (%eax),%eax
+ 16e:	0f b6 c0             	movzbl %al,%eax
+ 171:	29 c2                	sub    %eax,%edx
+ 173:	89 d0                	mov    %edx,%eax
+}
+ 175:	5d                   	pop    %ebp
+ 176:	c3                   	ret
+
+00000177 <strlen>:
+{
+ 177:	55                   	push   %ebp
+ 178:	89 e5                	mov    %esp,%ebp
+ 17a:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 17d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 184:	eb 04                	jmp    18a <strlen+0x13>
+ 186:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 18a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 18d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 190:	01 d0                	add    %edx,%eax
+ 192:	0f b6 00             	movzbl (%eax),%eax
+ 195:	84 c0                	test   %al,%al
+ 197:	75 ed                	jne    186 <strlen+0xf>
+  return n;
+ 199:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 19c:	c9                   	leave
+ 19d:	c3                   	ret
+
+0000019e <memset>:
+{
+ 19e:	55                   	push   %ebp
+ 19f:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 1a1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 1a4:	50                   	push   %eax
+ 1a5:	ff 75 0c             	push   0xc(%ebp)
+ 1a8:	ff 75 08             	push   0x8(%ebp)
+ 1ab:	e8 e0 fe ff ff       	call   90 <stosb>
+ 1b0:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1b6:	c9                   	leave
+ 1b7:	c3                   	ret
+
+000001b8 <strchr>:
+{
+ 1b8:	55                   	push   %ebp
+ 1b9:	89 e5                	mov    %esp,%ebp
+ 1bb:	83 ec 04             	sub    $0x4,%esp
+ 1be:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1c1:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 1c4:	eb 14                	jmp    1da <strchr+0x22>
+    if(*s == c)
+ 1c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c9:	0f b6 00             	movzbl (%eax),%eax
+ 1cc:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 1cf:	75 05                	jne    1d6 <strchr+0x1e>
+      return (char*)s;
+ 1d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d4:	eb 13                	jmp    1e9 <strchr+0x31>
+  for(; *s; s++)
+ 1d6:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1dd:	0f b6 00             	movzbl (%eax),%eax
+ 1e0:	84 c0                	test   %al,%al
+ 1e2:	75 e2                	jne    1c6 <strchr+0xe>
+  return 0;
+ 1e4:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 1e9:	c9                   	leave
+ 1ea:	c3                   	ret
+
+000001eb <gets>:
+{
+ 1eb:	55                   	push   %ebp
+ 1ec:	89 e5                	mov    %esp,%ebp
+ 1ee:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 1f1:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 1f8:	eb 42                	jmp    23c <gets+0x51>
+    cc = read(0, &c, 1);
+ 1fa:	83 ec 04             	sub    $0x4,%esp
+ 1fd:	6a 01                	push   $0x1
+ 1ff:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 202:	50                   	push   %eax
+ 203:	6a 00                	push   $0x0
+ 205:	e8 ed 04 00 00       	call   6f7 <read>
+ 20a:	83 c4 10             	add    $0x10,%esp
+ 20d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 210:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 214:	7e 33                	jle    249 <gets+0x5e>
+    buf[i++] = c;
+ 216:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 219:	8d 50 01             	lea    0x1(%eax),%edx
+ 21c:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 21f:	89 c2                	mov    %eax,%edx
+ 221:	8b 45 08             	mov    0x8(%ebp),%eax
+ 224:	01 c2                	add    %eax,%edx
+ 226:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 22a:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 22c:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 230:	3c 0a                	cmp    $0xa,%al
+ 232:	74 16                	je     24a <gets+0x5f>
+ 234:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 238:	3c 0d                	cmp    $0xd,%al
+ 23a:	74 0e                	je     24a <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 23c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 23f:	83 c0 01             	add    $0x1,%eax
+ 242:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 245:	7f b3                	jg     1fa <gets+0xf>
+ 247:	eb 01                	jmp    24a <gets+0x5f>
+      break;
+ 249:	90                   	nop
+  buf[i] = '\0';
+ 24a:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 24d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 250:	01 d0                	add    %edx,%eax
+ 252:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 255:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 258:	c9                   	leave
+ 259:	c3                   	ret
+
+0000025a <stat>:
+{
+ 25a:	55                   	push   %ebp
+ 25b:	89 e5                	mov    %esp,%ebp
+ 25d:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 260:	83 ec 08             	sub    $0x8,%esp
+ 263:	6a 00                	push   $0x0
+ 265:	ff 75 08             	push   0x8(%ebp)
+ 268:	e8 ad 04 00 00       	call   71a <open>
+ 26d:	83 c4 10             	add    $0x10,%esp
+ 270:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 273:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 277:	79 07                	jns    280 <stat+0x26>
+    return -1;
+ 279:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 27e:	eb 25                	jmp    2a5 <stat+0x4b>
+  r = fstat(fd, st);
+ 280:	83 ec 08             	sub    $0x8,%esp
+ 283:	ff 75 0c             	push   0xc(%ebp)
+ 286:	ff 75 f4             	push   -0xc(%ebp)
+ 289:	e8 a1 04 00 00       	call   72f <fstat>
+ 28e:	83 c4 10             	add    $0x10,%esp
+ 291:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 294:	83 ec 0c             	sub    $0xc,%esp
+ 297:	ff 75 f4             	push   -0xc(%ebp)
+ 29a:	e8 66 04 00 00       	call   705 <close>
+ 29f:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 2a2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 2a5:	c9                   	leave
+ 2a6:	c3                   	ret
+
+000002a7 <atoi>:
+{
+ 2a7:	55                   	push   %ebp
+ 2a8:	89 e5                	mov    %esp,%ebp
+ 2aa:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 2ad:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2b4:	eb 25                	jmp    2db <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 2b6:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2b9:	89 d0                	mov    %edx,%eax
+ 2bb:	c1 e0 02             	shl    $0x2,%eax
+ 2be:	01 d0                	add    %edx,%eax
+ 2c0:	01 c0                	add    %eax,%eax
+ 2c2:	89 c1                	mov    %eax,%ecx
+ 2c4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c7:	8d 50 01             	lea    0x1(%eax),%edx
+ 2ca:	89 55 08             	mov    %edx,0x8(%ebp)
+ 2cd:	0f b6 00             	movzbl (%eax),%eax
+ 2d0:	0f be c0             	movsbl %al,%eax
+ 2d3:	01 c8                	add    %ecx,%eax
+ 2d5:	83 e8 30             	sub    $0x30,%eax
+ 2d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 2db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2de:	0f b6 00             	movzbl (%eax),%eax
+ 2e1:	3c 2f                	cmp    $0x2f,%al
+ 2e3:	7e 0a                	jle    2ef <atoi+0x48>
+ 2e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e8:	0f b6 00             	movzbl (%eax),%eax
+ 2eb:	3c 39                	cmp    $0x39,%al
+ 2ed:	7e c7                	jle    2b6 <atoi+0xf>
+  return n;
+ 2ef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2f2:	c9                   	leave
+ 2f3:	c3                   	ret
+
+000002f4 <memmove>:
+{
+ 2f4:	55                   	push   %ebp
+ 2f5:	89 e5                	mov    %esp,%ebp
+ 2f7:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 300:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 303:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 306:	eb 17                	jmp    31f <memmove+0x2b>
+    *dst++ = *src++;
+ 308:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 30b:	8d 42 01             	lea    0x1(%edx),%eax
+ 30e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 311:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 314:	8d 48 01             	lea    0x1(%eax),%ecx
+ 317:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 31a:	0f b6 12             	movzbl (%edx),%edx
+ 31d:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 31f:	8b 45 10             	mov    0x10(%ebp),%eax
+ 322:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 325:	89 55 10             	mov    %edx,0x10(%ebp)
+ 328:	85 c0                	test   %eax,%eax
+ 32a:	7f dc                	jg     308 <memmove+0x14>
+  return vdst;
+ 32c:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 32f:	c9                   	leave
+ 330:	c3                   	ret
+
+00000331 <mutex_init>:
+{
+ 331:	55                   	push   %ebp
+ 332:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 334:	8b 45 08             	mov    0x8(%ebp),%eax
+ 337:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 33d:	90                   	nop
+ 33e:	5d                   	pop    %ebp
+ 33f:	c3                   	ret
+
+00000340 <mutex_lock>:
+{
+ 340:	55                   	push   %ebp
+ 341:	89 e5                	mov    %esp,%ebp
+ 343:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 346:	8b 45 08             	mov    0x8(%ebp),%eax
+ 349:	6a 01                	push   $0x1
+ 34b:	6a 00                	push   $0x0
+ 34d:	50                   	push   %eax
+ 34e:	e8 7d fd ff ff       	call   d0 <cmpxchg>
+ 353:	83 c4 0c             	add    $0xc,%esp
+ 356:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 359:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 35d:	74 46                	je     3a5 <mutex_lock+0x65>
+  if(c != 2)
+ 35f:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 363:	74 38                	je     39d <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 365:	8b 45 08             	mov    0x8(%ebp),%eax
+ 368:	6a 02                	push   $0x2
+ 36a:	50                   	push   %eax
+ 36b:	e8 46 fd ff ff       	call   b6 <xchg>
+ 370:	83 c4 08             	add    $0x8,%esp
+ 373:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 376:	eb 25                	jmp    39d <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 378:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37b:	83 ec 08             	sub    $0x8,%esp
+ 37e:	6a 02                	push   $0x2
+ 380:	50                   	push   %eax
+ 381:	e8 22 04 00 00       	call   7a8 <futex_wait>
+ 386:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 389:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38c:	83 ec 08             	sub    $0x8,%esp
+ 38f:	6a 02                	push   $0x2
+ 391:	50                   	push   %eax
+ 392:	e8 1f fd ff ff       	call   b6 <xchg>
+ 397:	83 c4 10             	add    $0x10,%esp
+ 39a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 39d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3a1:	75 d5                	jne    378 <mutex_lock+0x38>
+ 3a3:	eb 01                	jmp    3a6 <mutex_lock+0x66>
+    return;
+ 3a5:	90                   	nop
+}
+ 3a6:	c9                   	leave
+ 3a7:	c3                   	ret
+
+000003a8 <mutex_unlock>:
+{
+ 3a8:	55                   	push   %ebp
+ 3a9:	89 e5                	mov    %esp,%ebp
+ 3ab:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 3ae:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3b1:	6a 00                	push   $0x0
+ 3b3:	50                   	push   %eax
+ 3b4:	e8 fd fc ff ff       	call   b6 <xchg>
+ 3b9:	83 c4 08             	add    $0x8,%esp
+ 3bc:	83 f8 02             	cmp    $0x2,%eax
+ 3bf:	75 11                	jne    3d2 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 3c1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3c4:	83 ec 08             	sub    $0x8,%esp
+ 3c7:	6a 01                	push   $0x1
+ 3c9:	50                   	push   %eax
+ 3ca:	e8 e3 03 00 00       	call   7b2 <futex_wake>
+ 3cf:	83 c4 10             	add    $0x10,%esp
+}
+ 3d2:	90                   	nop
+ 3d3:	c9                   	leave
+ 3d4:	c3                   	ret
+
+000003d5 <cond_init>:
+{
+ 3d5:	55                   	push   %ebp
+ 3d6:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 3d8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3db:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3e1:	90                   	nop
+ 3e2:	5d                   	pop    %ebp
+ 3e3:	c3                   	ret
+
+000003e4 <cond_wait>:
+{
+ 3e4:	55                   	push   %ebp
+ 3e5:	89 e5                	mov    %esp,%ebp
+ 3e7:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 3ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ed:	8b 00                	mov    (%eax),%eax
+ 3ef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 3f2:	83 ec 0c             	sub    $0xc,%esp
+ 3f5:	ff 75 0c             	push   0xc(%ebp)
+ 3f8:	e8 ab ff ff ff       	call   3a8 <mutex_unlock>
+ 3fd:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 400:	8b 45 08             	mov    0x8(%ebp),%eax
+ 403:	83 ec 08             	sub    $0x8,%esp
+ 406:	ff 75 f4             	push   -0xc(%ebp)
+ 409:	50                   	push   %eax
+ 40a:	e8 99 03 00 00       	call   7a8 <futex_wait>
+ 40f:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 412:	eb 11                	jmp    425 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 414:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 417:	83 ec 08             	sub    $0x8,%esp
+ 41a:	6a 02                	push   $0x2
+ 41c:	50                   	push   %eax
+ 41d:	e8 86 03 00 00       	call   7a8 <futex_wait>
+ 422:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 425:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 428:	83 ec 08             	sub    $0x8,%esp
+ 42b:	6a 02                	push   $0x2
+ 42d:	50                   	push   %eax
+ 42e:	e8 83 fc ff ff       	call   b6 <xchg>
+ 433:	83 c4 10             	add    $0x10,%esp
+ 436:	85 c0                	test   %eax,%eax
+ 438:	75 da                	jne    414 <cond_wait+0x30>
+}
+ 43a:	90                   	nop
+ 43b:	90                   	nop
+ 43c:	c9                   	leave
+ 43d:	c3                   	ret
+
+0000043e <condbump>:
+{
+ 43e:	55                   	push   %ebp
+ 43f:	89 e5                	mov    %esp,%ebp
+ 441:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 444:	8b 45 08             	mov    0x8(%ebp),%eax
+ 447:	8b 00                	mov    (%eax),%eax
+ 449:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 44c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 44f:	8d 50 01             	lea    0x1(%eax),%edx
+ 452:	8b 45 08             	mov    0x8(%ebp),%eax
+ 455:	52                   	push   %edx
+ 456:	ff 75 fc             	push   -0x4(%ebp)
+ 459:	50                   	push   %eax
+ 45a:	e8 71 fc ff ff       	call   d0 <cmpxchg>
+ 45f:	83 c4 0c             	add    $0xc,%esp
+ 462:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 465:	75 dd                	jne    444 <condbump+0x6>
+}
+ 467:	90                   	nop
+ 468:	90                   	nop
+ 469:	c9                   	leave
+ 46a:	c3                   	ret
+
+0000046b <cond_signal>:
+{
+ 46b:	55                   	push   %ebp
+ 46c:	89 e5                	mov    %esp,%ebp
+ 46e:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 471:	ff 75 08             	push   0x8(%ebp)
+ 474:	e8 c5 ff ff ff       	call   43e <condbump>
+ 479:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 47c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 47f:	83 ec 08             	sub    $0x8,%esp
+ 482:	6a 01                	push   $0x1
+ 484:	50                   	push   %eax
+ 485:	e8 28 03 00 00       	call   7b2 <futex_wake>
+ 48a:	83 c4 10             	add    $0x10,%esp
+}
+ 48d:	90                   	nop
+ 48e:	c9                   	leave
+ 48f:	c3                   	ret
+
+00000490 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 490:	55                   	push   %ebp
+ 491:	89 e5                	mov    %esp,%ebp
+ 493:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 496:	ff 75 08             	push   0x8(%ebp)
+ 499:	e8 a0 ff ff ff       	call   43e <condbump>
+ 49e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 4a1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a4:	83 ec 08             	sub    $0x8,%esp
+ 4a7:	68 ff ff ff 7f       	push   $0x7fffffff
+ 4ac:	50                   	push   %eax
+ 4ad:	e8 00 03 00 00       	call   7b2 <futex_wake>
+ 4b2:	83 c4 10             	add    $0x10,%esp
+}
+ 4b5:	90                   	nop
+ 4b6:	c9                   	leave
+ 4b7:	c3                   	ret
+
+000004b8 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 4b8:	55                   	push   %ebp
+ 4b9:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 4bb:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 4c0:	8b 00                	mov    (%eax),%eax
+}
+ 4c2:	5d                   	pop    %ebp
+ 4c3:	c3                   	ret
+
+000004c4 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 4c4:	55                   	push   %ebp
+ 4c5:	89 e5                	mov    %esp,%ebp
+ 4c7:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 4ca:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 4cf:	8b 00                	mov    (%eax),%eax
+ 4d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 4d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4d8:	74 05                	je     4df <vgetpid+0x1b>
+    return pid;
+ 4da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 4dd:	eb 05                	jmp    4e4 <vgetpid+0x20>
+  return getpid();
+ 4df:	e8 74 02 00 00       	call   758 <getpid>
+}
+ 4e4:	c9                   	leave
+ 4e5:	c3                   	ret
+
+000004e6 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 4e6:	55                   	push   %ebp
+ 4e7:	89 e5                	mov    %esp,%ebp
+ 4e9:	57                   	push   %edi
+ 4ea:	56                   	push   %esi
+ 4eb:	53                   	push   %ebx
+ 4ec:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 4ef:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 4f6:	e8 f7 fb ff ff       	call   f2 <rdtsc>
+ 4fb:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 4fe:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 501:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 504:	29 c8                	sub    %ecx,%eax
+ 506:	19 da                	sbb    %ebx,%edx
+ 508:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 50b:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 50e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 511:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 514:	89 d0                	mov    %edx,%eax
+ 516:	31 d2                	xor    %edx,%edx
+ 518:	89 c1                	mov    %eax,%ecx
+ 51a:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 51f:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 522:	8b 40 04             	mov    0x4(%eax),%eax
+ 525:	ba 00 00 00 00       	mov    $0x0,%edx
+ 52a:	89 df                	mov    %ebx,%edi
+ 52c:	0f af f8             	imul   %eax,%edi
+ 52f:	89 d6                	mov    %edx,%esi
+ 531:	0f af f1             	imul   %ecx,%esi
+ 534:	01 f7                	add    %esi,%edi
+ 536:	f7 e1                	mul    %ecx
+ 538:	89 c1                	mov    %eax,%ecx
+ 53a:	89 d3                	mov    %edx,%ebx
+ 53c:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 53f:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 541:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 544:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 547:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 54a:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 551:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 554:	8b 40 04             	mov    0x4(%eax),%eax
+ 557:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 55a:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 561:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 564:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 567:	89 d7                	mov    %edx,%edi
+ 569:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 56c:	0f af fe             	imul   %esi,%edi
+ 56f:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 572:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 575:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 578:	0f af f0             	imul   %eax,%esi
+ 57b:	01 f7                	add    %esi,%edi
+ 57d:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 580:	f7 65 d8             	mull   -0x28(%ebp)
+ 583:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 586:	89 f2                	mov    %esi,%edx
+ 588:	89 d0                	mov    %edx,%eax
+ 58a:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 58c:	01 c8                	add    %ecx,%eax
+ 58e:	11 da                	adc    %ebx,%edx
+}
+ 590:	83 c4 24             	add    $0x24,%esp
+ 593:	5b                   	pop    %ebx
+ 594:	5e                   	pop    %esi
+ 595:	5f                   	pop    %edi
+ 596:	5d                   	pop    %ebp
+ 597:	c3                   	ret
+
+00000598 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 598:	55                   	push   %ebp
+ 599:	89 e5                	mov    %esp,%ebp
+ 59b:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 59e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a1:	8b 50 04             	mov    0x4(%eax),%edx
+ 5a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a7:	8b 00                	mov    (%eax),%eax
+ 5a9:	29 c2                	sub    %eax,%edx
+ 5ab:	83 fa 1f             	cmp    $0x1f,%edx
+ 5ae:	76 07                	jbe    5b7 <ring_queue+0x1f>
+    return -1;
+ 5b0:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 5b5:	eb 68                	jmp    61f <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 5b7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ba:	8b 40 04             	mov    0x4(%eax),%eax
+ 5bd:	83 e0 1f             	and    $0x1f,%eax
+ 5c0:	89 c2                	mov    %eax,%edx
+ 5c2:	89 d0                	mov    %edx,%eax
+ 5c4:	c1 e0 02             	shl    $0x2,%eax
+ 5c7:	01 d0                	add    %edx,%eax
+ 5c9:	c1 e0 02             	shl    $0x2,%eax
+ 5cc:	8d 50 10             	lea    0x10(%eax),%edx
+ 5cf:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d2:	01 d0                	add    %edx,%eax
+ 5d4:	83 c0 04             	add    $0x4,%eax
+ 5d7:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 5da:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5dd:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 5e0:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 5e2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5e5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 5e8:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 5eb:	8b 55 14             	mov    0x14(%ebp),%edx
+ 5ee:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5f1:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 5f4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5f7:	8b 55 18             	mov    0x18(%ebp),%edx
+ 5fa:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 5fd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 600:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 603:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 606:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 60b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 60e:	8b 40 04             	mov    0x4(%eax),%eax
+ 611:	8d 50 01             	lea    0x1(%eax),%edx
+ 614:	8b 45 08             	mov    0x8(%ebp),%eax
+ 617:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 61a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 61f:	c9                   	leave
+ 620:	c3                   	ret
+
+00000621 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 621:	55                   	push   %ebp
+ 622:	89 e5                	mov    %esp,%ebp
+ 624:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 627:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 62c:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 630:	7f 1a                	jg     64c <ring_submit+0x2b>
+ 632:	8b 45 08             	mov    0x8(%ebp),%eax
+ 635:	8b 40 10             	mov    0x10(%eax),%eax
+ 638:	83 e0 01             	and    $0x1,%eax
+ 63b:	85 c0                	test   %eax,%eax
+ 63d:	74 0d                	je     64c <ring_submit+0x2b>
+ 63f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 642:	8b 40 10             	mov    0x10(%eax),%eax
+ 645:	83 e0 02             	and    $0x2,%eax
+ 648:	85 c0                	test   %eax,%eax
+ 64a:	74 10                	je     65c <ring_submit+0x3b>
+    return ring_enter(min);
+ 64c:	83 ec 0c             	sub    $0xc,%esp
+ 64f:	ff 75 0c             	push   0xc(%ebp)
+ 652:	e8 83 01 00 00       	call   7da <ring_enter>
+ 657:	83 c4 10             	add    $0x10,%esp
+ 65a:	eb 10                	jmp    66c <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 65c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65f:	8b 50 0c             	mov    0xc(%eax),%edx
+ 662:	8b 45 08             	mov    0x8(%ebp),%eax
+ 665:	8b 40 08             	mov    0x8(%eax),%eax
+ 668:	29 c2                	sub    %eax,%edx
+ 66a:	89 d0                	mov    %edx,%eax
+}
+ 66c:	c9                   	leave
+ 66d:	c3                   	ret
+
+0000066e <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 66e:	55                   	push   %ebp
+ 66f:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 671:	8b 45 08             	mov    0x8(%ebp),%eax
+ 674:	8b 50 08             	mov    0x8(%eax),%edx
+ 677:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67a:	8b 40 0c             	mov    0xc(%eax),%eax
+ 67d:	39 c2                	cmp    %eax,%edx
+ 67f:	75 07                	jne    688 <ring_reap+0x1a>
+    return -1;
+ 681:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 686:	eb 3b                	jmp    6c3 <ring_reap+0x55>
+  __sync_synchronize();
+ 688:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 68d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 690:	8b 40 08             	mov    0x8(%eax),%eax
+ 693:	83 e0 1f             	and    $0x1f,%eax
+ 696:	89 c2                	mov    %eax,%edx
+ 698:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 69b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 69e:	83 c2 52             	add    $0x52,%edx
+ 6a1:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 6a5:	8b 02                	mov    (%edx),%eax
+ 6a7:	8b 52 04             	mov    0x4(%edx),%edx
+ 6aa:	89 01                	mov    %eax,(%ecx)
+ 6ac:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 6af:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b2:	8b 40 08             	mov    0x8(%eax),%eax
+ 6b5:	8d 50 01             	lea    0x1(%eax),%edx
+ 6b8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bb:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 6be:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6c3:	5d                   	pop    %ebp
+ 6c4:	c3                   	ret
+
+000006c5 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 6c5:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 6cc:	74 0a                	je     6d8 <usyscall+0x13>
+  movl %esp, %ecx
+ 6ce:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 6d0:	ba d7 06 00 00       	mov    $0x6d7,%edx
+  sysenter
+ 6d5:	0f 34                	sysenter
+2:
+  ret
+ 6d7:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 6d8:	cd 40                	int    $0x40
+  ret
+ 6da:	c3                   	ret
+
+000006db <fork>:
+
+SYSCALL(fork)
+ 6db:	b8 01 00 00 00       	mov    $0x1,%eax
+ 6e0:	eb e3                	jmp    6c5 <usyscall>
+
+000006e2 <exit>:
+SYSCALL(exit)
+ 6e2:	b8 02 00 00 00       	mov    $0x2,%eax
+ 6e7:	eb dc                	jmp    6c5 <usyscall>
+
+000006e9 <wait>:
+SYSCALL(wait)
+ 6e9:	b8 03 00 00 00       	mov    $0x3,%eax
+ 6ee:	eb d5                	jmp    6c5 <usyscall>
+
+000006f0 <pipe>:
+SYSCALL(pipe)
+ 6f0:	b8 04 00 00 00       	mov    $0x4,%eax
+ 6f5:	eb ce                	jmp    6c5 <usyscall>
+
+000006f7 <read>:
+SYSCALL(read)
+ 6f7:	b8 05 00 00 00       	mov    $0x5,%eax
+ 6fc:	eb c7                	jmp    6c5 <usyscall>
+
+000006fe <write>:
+SYSCALL(write)
+ 6fe:	b8 10 00 00 00       	mov    $0x10,%eax
+ 703:	eb c0                	jmp    6c5 <usyscall>
+
+00000705 <close>:
+SYSCALL(close)
+ 705:	b8 15 00 00 00       	mov    $0x15,%eax
+ 70a:	eb b9                	jmp    6c5 <usyscall>
+
+0000070c <kill>:
+SYSCALL(kill)
+ 70c:	b8 06 00 00 00       	mov    $0x6,%eax
+ 711:	eb b2                	jmp    6c5 <usyscall>
+
+00000713 <exec>:
+SYSCALL(exec)
+ 713:	b8 07 00 00 00       	mov    $0x7,%eax
+ 718:	eb ab                	jmp    6c5 <usyscall>
+
+0000071a <open>:
+SYSCALL(open)
+ 71a:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 71f:	eb a4                	jmp    6c5 <usyscall>
+
+00000721 <mknod>:
+SYSCALL(mknod)
+ 721:	b8 11 00 00 00       	mov    $0x11,%eax
+ 726:	eb 9d                	jmp    6c5 <usyscall>
+
+00000728 <unlink>:
+SYSCALL(unlink)
+ 728:	b8 12 00 00 00       	mov    $0x12,%eax
+ 72d:	eb 96                	jmp    6c5 <usyscall>
+
+0000072f <fstat>:
+SYSCALL(fstat)
+ 72f:	b8 08 00 00 00       	mov    $0x8,%eax
+ 734:	eb 8f                	jmp    6c5 <usyscall>
+
+00000736 <link>:
+SYSCALL(link)
+ 736:	b8 13 00 00 00       	mov    $0x13,%eax
+ 73b:	eb 88                	jmp    6c5 <usyscall>
+
+0000073d <mkdir>:
+SYSCALL(mkdir)
+ 73d:	b8 14 00 00 00       	mov    $0x14,%eax
+ 742:	eb 81                	jmp    6c5 <usyscall>
+
+00000744 <chdir>:
+SYSCALL(chdir)
+ 744:	b8 09 00 00 00       	mov    $0x9,%eax
+ 749:	e9 77 ff ff ff       	jmp    6c5 <usyscall>
+
+0000074e <dup>:
+SYSCALL(dup)
+ 74e:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 753:	e9 6d ff ff ff       	jmp    6c5 <usyscall>
+
+00000758 <getpid>:
+SYSCALL(getpid)
+ 758:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 75d:	e9 63 ff ff ff       	jmp    6c5 <usyscall>
+
+00000762 <sbrk>:
+SYSCALL(sbrk)
+ 762:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 767:	e9 59 ff ff ff       	jmp    6c5 <usyscall>
+
+0000076c <sleep>:
+SYSCALL(sleep)
+ 76c:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 771:	e9 4f ff ff ff       	jmp    6c5 <usyscall>
+
+00000776 <uptime>:
+SYSCALL(uptime)
+ 776:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 77b:	e9 45 ff ff ff       	jmp    6c5 <usyscall>
+
+00000780 <kmstat>:
+SYSCALL(kmstat)
+ 780:	b8 16 00 00 00       	mov    $0x16,%eax
+ 785:	e9 3b ff ff ff       	jmp    6c5 <usyscall>
+
+0000078a <setpriority>:
+SYSCALL(setpriority)
+ 78a:	b8 17 00 00 00       	mov    $0x17,%eax
+ 78f:	e9 31 ff ff ff       	jmp    6c5 <usyscall>
+
+00000794 <clone>:
+SYSCALL(clone)
+ 794:	b8 18 00 00 00       	mov    $0x18,%eax
+ 799:	e9 27 ff ff ff       	jmp    6c5 <usyscall>
+
+0000079e <join>:
+SYSCALL(join)
+ 79e:	b8 19 00 00 00       	mov    $0x19,%eax
+ 7a3:	e9 1d ff ff ff       	jmp    6c5 <usyscall>
+
+000007a8 <futex_wait>:
+SYSCALL(futex_wait)
+ 7a8:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 7ad:	e9 13 ff ff ff       	jmp    6c5 <usyscall>
+
+000007b2 <futex_wake>:
+SYSCALL(futex_wake)
+ 7b2:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 7b7:	e9 09 ff ff ff       	jmp    6c5 <usyscall>
+
+000007bc <lockstat>:
+SYSCALL(lockstat)
+ 7bc:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 7c1:	e9 ff fe ff ff       	jmp    6c5 <usyscall>
+
+000007c6 <sysstat>:
+SYSCALL(sysstat)
+ 7c6:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 7cb:	e9 f5 fe ff ff       	jmp    6c5 <usyscall>
+
+000007d0 <ring_setup>:
+SYSCALL(ring_setup)
+ 7d0:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 7d5:	e9 eb fe ff ff       	jmp    6c5 <usyscall>
+
+000007da <ring_enter>:
+SYSCALL(ring_enter)
+ 7da:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 7df:	e9 e1 fe ff ff       	jmp    6c5 <usyscall>
+
+000007e4 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 7e4:	55                   	push   %ebp
+ 7e5:	89 e5                	mov    %esp,%ebp
+ 7e7:	83 ec 18             	sub    $0x18,%esp
+ 7ea:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7ed:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 7f0:	83 ec 04             	sub    $0x4,%esp
+ 7f3:	6a 01                	push   $0x1
+ 7f5:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 7f8:	50                   	push   %eax
+ 7f9:	ff 75 08             	push   0x8(%ebp)
+ 7fc:	e8 fd fe ff ff       	call   6fe <write>
+ 801:	83 c4 10             	add    $0x10,%esp
+}
+ 804:	90                   	nop
+ 805:	c9                   	leave
+ 806:	c3                   	ret
+
+00000807 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 807:	55                   	push   %ebp
+ 808:	89 e5                	mov    %esp,%ebp
+ 80a:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 80d:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 814:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 818:	74 17                	je     831 <printint+0x2a>
+ 81a:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 81e:	79 11                	jns    831 <printint+0x2a>
+    neg = 1;
+ 820:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 827:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 82a:	f7 d8                	neg    %eax
+ 82c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 82f:	eb 06                	jmp    837 <printint+0x30>
+  } else {
+    x = xx;
+ 831:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 834:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 837:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 83e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 841:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 844:	ba 00 00 00 00       	mov    $0x0,%edx
+ 849:	f7 f1                	div    %ecx
+ 84b:	89 d1                	mov    %edx,%ecx
+ 84d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 850:	8d 50 01             	lea    0x1(%eax),%edx
+ 853:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 856:	0f b6 91 ec 11 00 00 	movzbl 0x11ec(%ecx),%edx
+ 85d:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 861:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 864:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 867:	ba 00 00 00 00       	mov    $0x0,%edx
+ 86c:	f7 f1                	div    %ecx
+ 86e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 871:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 875:	75 c7                	jne    83e <printint+0x37>
+  if(neg)
+ 877:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 87b:	74 2d                	je     8aa <printint+0xa3>
+    buf[i++] = '-';
+ 87d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 880:	8d 50 01             	lea    0x1(%eax),%edx
+ 883:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 886:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 88b:	eb 1d                	jmp    8aa <printint+0xa3>
+    putc(fd, buf[i]);
+ 88d:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 890:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 893:	01 d0                	add    %edx,%eax
+ 895:	0f b6 00             	movzbl (%eax),%eax
+ 898:	0f be c0             	movsbl %al,%eax
+ 89b:	83 ec 08             	sub    $0x8,%esp
+ 89e:	50                   	push   %eax
+ 89f:	ff 75 08             	push   0x8(%ebp)
+ 8a2:	e8 3d ff ff ff       	call   7e4 <putc>
+ 8a7:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 8aa:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 8ae:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 8b2:	79 d9                	jns    88d <printint+0x86>
+}
+ 8b4:	90                   	nop
+ 8b5:	90                   	nop
+ 8b6:	c9                   	leave
+ 8b7:	c3                   	ret
+
+000008b8 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 8b8:	55                   	push   %ebp
+ 8b9:	89 e5                	mov    %esp,%ebp
+ 8bb:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 8be:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 8c5:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 8c8:	83 c0 04             	add    $0x4,%eax
+ 8cb:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 8ce:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 8d5:	e9 59 01 00 00       	jmp    a33 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 8da:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 8dd:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 8e0:	01 d0                	add    %edx,%eax
+ 8e2:	0f b6 00             	movzbl (%eax),%eax
+ 8e5:	0f be c0             	movsbl %al,%eax
+ 8e8:	25 ff 00 00 00       	and    $0xff,%eax
+ 8ed:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 8f0:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 8f4:	75 2c                	jne    922 <printf+0x6a>
+      if(c == '%'){
+ 8f6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 8fa:	75 0c                	jne    908 <printf+0x50>
+        state = '%';
+ 8fc:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 903:	e9 27 01 00 00       	jmp    a2f <printf+0x177>
+      } else {
+        putc(fd, c);
+ 908:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 90b:	0f be c0             	movsbl %al,%eax
+ 90e:	83 ec 08             	sub    $0x8,%esp
+ 911:	50                   	push   %eax
+ 912:	ff 75 08             	push   0x8(%ebp)
+ 915:	e8 ca fe ff ff       	call   7e4 <putc>
+ 91a:	83 c4 10             	add    $0x10,%esp
+ 91d:	e9 0d 01 00 00       	jmp    a2f <printf+0x177>
+      }
+    } else if(state == '%'){
+ 922:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 926:	0f 85 03 01 00 00    	jne    a2f <printf+0x177>
+      if(c == 'd'){
+ 92c:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 930:	75 1e                	jne    950 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 932:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 935:	8b 00                	mov    (%eax),%eax
+ 937:	6a 01                	push   $0x1
+ 939:	6a 0a                	push   $0xa
+ 93b:	50                   	push   %eax
+ 93c:	ff 75 08             	push   0x8(%ebp)
+ 93f:	e8 c3 fe ff ff       	call   807 <printint>
+ 944:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 947:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 94b:	e9 d8 00 00 00       	jmp    a28 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 950:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 954:	74 06                	je     95c <printf+0xa4>
+ 956:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 95a:	75 1e                	jne    97a <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 95c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 95f:	8b 00                	mov    (%eax),%eax
+ 961:	6a 00                	push   $0x0
+ 963:	6a 10                	push   $0x10
+ 965:	50                   	push   %eax
+ 966:	ff 75 08             	push   0x8(%ebp)
+ 969:	e8 99 fe ff ff       	call   807 <printint>
+ 96e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 971:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 975:	e9 ae 00 00 00       	jmp    a28 <printf+0x170>
+      } else if(c == 's'){
+ 97a:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 97e:	75 43                	jne    9c3 <printf+0x10b>
+        s = (char*)*ap;
+ 980:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 983:	8b 00                	mov    (%eax),%eax
+ 985:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 988:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 98c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 990:	75 25                	jne    9b7 <printf+0xff>
+          s = "(null)";
+ 992:	c7 45 f4 2a 0d 00 00 	movl   $0xd2a,-0xc(%ebp)
+        while(*s != 0){
+ 999:	eb 1c                	jmp    9b7 <printf+0xff>
+          putc(fd, *s);
+ 99b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 99e:	0f b6 00             	movzbl (%eax),%eax
+ 9a1:	0f be c0             	movsbl %al,%eax
+ 9a4:	83 ec 08             	sub    $0x8,%esp
+ 9a7:	50                   	push   %eax
+ 9a8:	ff 75 08             	push   0x8(%ebp)
+ 9ab:	e8 34 fe ff ff       	call   7e4 <putc>
+ 9b0:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 9b3:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 9b7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ba:	0f b6 00             	movzbl (%eax),%eax
+ 9bd:	84 c0                	test   %al,%al
+ 9bf:	75 da                	jne    99b <printf+0xe3>
+ 9c1:	eb 65                	jmp    a28 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 9c3:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 9c7:	75 1d                	jne    9e6 <printf+0x12e>
+        putc(fd, *ap);
+ 9c9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9cc:	8b 00                	mov    (%eax),%eax
+ 9ce:	0f be c0             	movsbl %al,%eax
+ 9d1:	83 ec 08             	sub    $0x8,%esp
+ 9d4:	50                   	push   %eax
+ 9d5:	ff 75 08             	push   0x8(%ebp)
+ 9d8:	e8 07 fe ff ff       	call   7e4 <putc>
+ 9dd:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9e0:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9e4:	eb 42                	jmp    a28 <printf+0x170>
+      } else if(c == '%'){
+ 9e6:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9ea:	75 17                	jne    a03 <printf+0x14b>
+        putc(fd, c);
+ 9ec:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9ef:	0f be c0             	movsbl %al,%eax
+ 9f2:	83 ec 08             	sub    $0x8,%esp
+ 9f5:	50                   	push   %eax
+ 9f6:	ff 75 08             	push   0x8(%ebp)
+ 9f9:	e8 e6 fd ff ff       	call   7e4 <putc>
+ 9fe:	83 c4 10             	add    $0x10,%esp
+ a01:	eb 25                	jmp    a28 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ a03:	83 ec 08             	sub    $0x8,%esp
+ a06:	6a 25                	push   $0x25
+ a08:	ff 75 08             	push   0x8(%ebp)
+ a0b:	e8 d4 fd ff ff       	call   7e4 <putc>
+ a10:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ a13:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a16:	0f be c0             	movsbl %al,%eax
+ a19:	83 ec 08             	sub    $0x8,%esp
+ a1c:	50                   	push   %eax
+ a1d:	ff 75 08             	push   0x8(%ebp)
+ a20:	e8 bf fd ff ff       	call   7e4 <putc>
+ a25:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ a28:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a2f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ a33:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a36:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a39:	01 d0                	add    %edx,%eax
+ a3b:	0f b6 00             	movzbl (%eax),%eax
+ a3e:	84 c0                	test   %al,%al
+ a40:	0f 85 94 fe ff ff    	jne    8da <printf+0x22>
+    }
+  }
+}
+ a46:	90                   	nop
+ a47:	90                   	nop
+ a48:	c9                   	leave
+ a49:	c3                   	ret
+
+00000a4a <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ a4a:	55                   	push   %ebp
+ a4b:	89 e5                	mov    %esp,%ebp
+ a4d:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ a50:	8b 45 08             	mov    0x8(%ebp),%eax
+ a53:	83 e8 08             	sub    $0x8,%eax
+ a56:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a59:	a1 08 12 00 00       	mov    0x1208,%eax
+ a5e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a61:	eb 24                	jmp    a87 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ a63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a66:	8b 00                	mov    (%eax),%eax
+ a68:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a6b:	72 12                	jb     a7f <free+0x35>
+ a6d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a70:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a73:	72 24                	jb     a99 <free+0x4f>
+ a75:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a78:	8b 00                	mov    (%eax),%eax
+ a7a:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a7d:	72 1a                	jb     a99 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a7f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a82:	8b 00                	mov    (%eax),%eax
+ a84:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a87:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a8a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a8d:	73 d4                	jae    a63 <free+0x19>
+ a8f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a92:	8b 00                	mov    (%eax),%eax
+ a94:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a97:	73 ca                	jae    a63 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a99:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9c:	8b 40 04             	mov    0x4(%eax),%eax
+ a9f:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ aa6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aa9:	01 c2                	add    %eax,%edx
+ aab:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aae:	8b 00                	mov    (%eax),%eax
+ ab0:	39 c2                	cmp    %eax,%edx
+ ab2:	75 24                	jne    ad8 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ ab4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ab7:	8b 50 04             	mov    0x4(%eax),%edx
+ aba:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ abd:	8b 00                	mov    (%eax),%eax
+ abf:	8b 40 04             	mov    0x4(%eax),%eax
+ ac2:	01 c2                	add    %eax,%edx
+ ac4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ac7:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ aca:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ acd:	8b 00                	mov    (%eax),%eax
+ acf:	8b 10                	mov    (%eax),%edx
+ ad1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ad4:	89 10                	mov    %edx,(%eax)
+ ad6:	eb 0a                	jmp    ae2 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ ad8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ adb:	8b 10                	mov    (%eax),%edx
+ add:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ae0:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ae2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ae5:	8b 40 04             	mov    0x4(%eax),%eax
+ ae8:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ aef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ af2:	01 d0                	add    %edx,%eax
+ af4:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ af7:	75 20                	jne    b19 <free+0xcf>
+    p->s.size += bp->s.size;
+ af9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ afc:	8b 50 04             	mov    0x4(%eax),%edx
+ aff:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b02:	8b 40 04             	mov    0x4(%eax),%eax
+ b05:	01 c2                	add    %eax,%edx
+ b07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0a:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ b0d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b10:	8b 10                	mov    (%eax),%edx
+ b12:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b15:	89 10                	mov    %edx,(%eax)
+ b17:	eb 08                	jmp    b21 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ b19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ b1f:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ b21:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b24:	a3 08 12 00 00       	mov    %eax,0x1208
+}
+ b29:	90                   	nop
+ b2a:	c9                   	leave
+ b2b:	c3                   	ret
+
+00000b2c <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ b2c:	55                   	push   %ebp
+ b2d:	89 e5                	mov    %esp,%ebp
+ b2f:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ b32:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ b39:	77 07                	ja     b42 <morecore+0x16>
+    nu = 4096;
+ b3b:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ b42:	8b 45 08             	mov    0x8(%ebp),%eax
+ b45:	c1 e0 03             	shl    $0x3,%eax
+ b48:	83 ec 0c             	sub    $0xc,%esp
+ b4b:	50                   	push   %eax
+ b4c:	e8 11 fc ff ff       	call   762 <sbrk>
+ b51:	83 c4 10             	add    $0x10,%esp
+ b54:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ b57:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ b5b:	75 07                	jne    b64 <morecore+0x38>
+    return 0;
+ b5d:	b8 00 00 00 00       	mov    $0x0,%eax
+ b62:	eb 26                	jmp    b8a <morecore+0x5e>
+  hp = (Header*)p;
+ b64:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b67:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b6a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b6d:	8b 55 08             	mov    0x8(%ebp),%edx
+ b70:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b76:	83 c0 08             	add    $0x8,%eax
+ b79:	83 ec 0c             	sub    $0xc,%esp
+ b7c:	50                   	push   %eax
+ b7d:	e8 c8 fe ff ff       	call   a4a <free>
+ b82:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b85:	a1 08 12 00 00       	mov    0x1208,%eax
+}
+ b8a:	c9                   	leave
+ b8b:	c3                   	ret
+
+00000b8c <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b8c:	55                   	push   %ebp
+ b8d:	89 e5                	mov    %esp,%ebp
+ b8f:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b92:	8b 45 08             	mov    0x8(%ebp),%eax
+ b95:	83 c0 07             	add    $0x7,%eax
+ b98:	c1 e8 03             	shr    $0x3,%eax
+ b9b:	83 c0 01             	add    $0x1,%eax
+ b9e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ ba1:	a1 08 12 00 00       	mov    0x1208,%eax
+ ba6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ ba9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ bad:	75 23                	jne    bd2 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ baf:	c7 45 f0 00 12 00 00 	movl   $0x1200,-0x10(%ebp)
+ bb6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bb9:	a3 08 12 00 00       	mov    %eax,0x1208
+ bbe:	a1 08 12 00 00       	mov    0x1208,%eax
+ bc3:	a3 00 12 00 00       	mov    %eax,0x1200
+    base.s.size = 0;
+ bc8:	c7 05 04 12 00 00 00 	movl   $0x0,0x1204
+ bcf:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bd2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bd5:	8b 00                	mov    (%eax),%eax
+ bd7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ bda:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bdd:	8b 40 04             	mov    0x4(%eax),%eax
+ be0:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ be3:	72 4d                	jb     c32 <malloc+0xa6>
+      if(p->s.size == nunits)
+ be5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ be8:	8b 40 04             	mov    0x4(%eax),%eax
+ beb:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ bee:	75 0c                	jne    bfc <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ bf0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf3:	8b 10                	mov    (%eax),%edx
+ bf5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bf8:	89 10                	mov    %edx,(%eax)
+ bfa:	eb 26                	jmp    c22 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ bfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bff:	8b 40 04             	mov    0x4(%eax),%eax
+ c02:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ c05:	89 c2                	mov    %eax,%edx
+ c07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0a:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ c0d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c10:	8b 40 04             	mov    0x4(%eax),%eax
+ c13:	c1 e0 03             	shl    $0x3,%eax
+ c16:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ c19:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c1c:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ c1f:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ c22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c25:	a3 08 12 00 00       	mov    %eax,0x1208
+      return (void*)(p + 1);
+ c2a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c2d:	83 c0 08             	add    $0x8,%eax
+ c30:	eb 3b                	jmp    c6d <malloc+0xe1>
+    }
+    if(p == freep)
+ c32:	a1 08 12 00 00       	mov    0x1208,%eax
+ c37:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ c3a:	75 1e                	jne    c5a <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ c3c:	83 ec 0c             	sub    $0xc,%esp
+ c3f:	ff 75 ec             	push   -0x14(%ebp)
+ c42:	e8 e5 fe ff ff       	call   b2c <morecore>
+ c47:	83 c4 10             	add    $0x10,%esp
+ c4a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c4d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c51:	75 07                	jne    c5a <malloc+0xce>
+        return 0;
+ c53:	b8 00 00 00 00       	mov    $0x0,%eax
+ c58:	eb 13                	jmp    c6d <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c5a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c5d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c60:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c63:	8b 00                	mov    (%eax),%eax
+ c65:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c68:	e9 6d ff ff ff       	jmp    bda <malloc+0x4e>
+  }
+}
+ c6d:	c9                   	leave
+ c6e:	c3                   	ret
+
+00000c6f <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c6f:	55                   	push   %ebp
+ c70:	89 e5                	mov    %esp,%ebp
+ c72:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ c75:	83 ec 0c             	sub    $0xc,%esp
+ c78:	68 00 10 00 00       	push   $0x1000
+ c7d:	e8 0a ff ff ff       	call   b8c <malloc>
+ c82:	83 c4 10             	add    $0x10,%esp
+ c85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c88:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c8c:	75 07                	jne    c95 <thread_create+0x26>
+    return -1;
+ c8e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c93:	eb 2e                	jmp    cc3 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ c95:	83 ec 04             	sub    $0x4,%esp
+ c98:	ff 75 f4             	push   -0xc(%ebp)
+ c9b:	ff 75 0c             	push   0xc(%ebp)
+ c9e:	ff 75 08             	push   0x8(%ebp)
+ ca1:	e8 ee fa ff ff       	call   794 <clone>
+ ca6:	83 c4 10             	add    $0x10,%esp
+ ca9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cac:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cb0:	79 0e                	jns    cc0 <thread_create+0x51>
+    free(stack);
+ cb2:	83 ec 0c             	sub    $0xc,%esp
+ cb5:	ff 75 f4             	push   -0xc(%ebp)
+ cb8:	e8 8d fd ff ff       	call   a4a <free>
+ cbd:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ cc0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ cc3:	c9                   	leave
+ cc4:	c3                   	ret
+
+00000cc5 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ cc5:	55                   	push   %ebp
+ cc6:	89 e5                	mov    %esp,%ebp
+ cc8:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ ccb:	83 ec 0c             	sub    $0xc,%esp
+ cce:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ cd1:	50                   	push   %eax
+ cd2:	e8 c7 fa ff ff       	call   79e <join>
+ cd7:	83 c4 10             	add    $0x10,%esp
+ cda:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cdd:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ce1:	78 0f                	js     cf2 <thread_join+0x2d>
+    free(stack);
+ ce3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce6:	83 ec 0c             	sub    $0xc,%esp
+ ce9:	50                   	push   %eax
+ cea:	e8 5b fd ff ff       	call   a4a <free>
+ cef:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ cf2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ cf5:	c9                   	leave
+ cf6:	c3                   	ret
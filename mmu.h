@@ -38,12 +38,27 @@
 #define CR0_PG          0x80000000      // Paging
 
 #define CR4_PSE         0x00000010      // Page size extension
-
+#define CR4_PGE         0x00000080      // Page global enable
+#define CR4_OSFXSR      0x00000200      // FXSAVE, FXRSTOR and SSE enable
+#define CR4_OSXMMEXCPT  0x00000400      // SSE exceptions as #XM
+
+// CPUID leaf 1 %edx feature flags
+#define CPUID_SEP       0x00000800      // SYSENTER and SYSEXIT
+#define CPUID_FXSR      0x01000000      // FXSAVE and FXRSTOR
+#define CPUID_SSE       0x02000000      // SSE
+
+// Model-specific registers
+#define MSR_SYSENTER_CS   0x174         // Kernel code selector
+#define MSR_SYSENTER_ESP  0x175         // Kernel stack pointer
+#define MSR_SYSENTER_EIP  0x176         // Kernel entry point
+
+// SYSENTER and SYSEXIT need kernel code, kernel data, user code
+// and user data in that order.
 #define SEG_KCODE 1  // kernel code
 #define SEG_KDATA 2  // kernel data+stack
-#define SEG_KCPU  3  // kernel per-cpu data
-#define SEG_UCODE 4  // user code
-#define SEG_UDATA 5  // user data+stack
+#define SEG_UCODE 3  // user code
+#define SEG_UDATA 4  // user data+stack
+#define SEG_KCPU  5  // kernel per-cpu data
 #define SEG_TSS   6  // this process's task state
 
 //PAGEBREAK!
@@ -129,6 +144,13 @@ struct segdesc {
 #define PGROUNDUP(sz)  (((sz)+PGSIZE-1) & ~(PGSIZE-1))
 #define PGROUNDDOWN(a) (((a)) & ~(PGSIZE-1))
 
+// A page directory entry with PTE_PS set maps a whole
+// 4Mbyte superpage instead of pointing at a page table.
+#define SUPERPGSIZE    (PGSIZE*NPTENTRIES)  // bytes mapped by a superpage
+#define SUPERPGORDER   10                   // log2(SUPERPGSIZE/PGSIZE)
+#define SUPERPGROUNDUP(sz)  (((sz)+SUPERPGSIZE-1) & ~(SUPERPGSIZE-1))
+#define SUPERPGROUNDDOWN(a) (((a)) & ~(SUPERPGSIZE-1))
+
 // Page table/directory entry flags.
 #define PTE_P           0x001   // Present
 #define PTE_W           0x002   // Writeable
@@ -138,6 +160,7 @@ struct segdesc {
 #define PTE_A           0x020   // Accessed
 #define PTE_D           0x040   // Dirty
 #define PTE_PS          0x080   // Page Size
+#define PTE_G           0x100   // Global (not flushed by %cr3 loads)
 #define PTE_MBZ         0x180   // Bits must be zero
 
 // Address in page table or page directory entry
@@ -1,10 +1,10 @@
 #define NPROC        64  // maximum number of processes
 #define KSTACKSIZE 4096  // size of per-process kernel stack
 #define NCPU          8  // maximum number of CPUs
+#define NMCS          4  // MCS locks one CPU may hold or wait for at once
+#define NPRIO         4  // scheduling priority levels
 #define NOFILE       16  // open files per process
-#define NFILE       100  // open files per system
 #define NBUF         10  // size of disk block cache
-#define NINODE       50  // maximum number of active i-nodes
 #define NDEV         10  // maximum major device number
 #define ROOTDEV       1  // device number of file system root disk
 #define MAXARG       32  // max exec arguments
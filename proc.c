@@ -4,26 +4,314 @@
 #include "memlayout.h"
 #include "mmu.h"
 #include "x86.h"
-#include "proc.h"
+#include "traps.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "vdso.h"
 
+// ptable.lock protects allocation of proc slots, pids, the pid
+// hash, and the parent, child and thread links between processes,
+// so wait(), kill() and exit() touch only the processes they
+// concern instead of scanning the table.  Each proc's own lock protects
+// its state and is held across the switch into and out of it.
+// Lock order: ptable.lock, then a wait queue's lock, then p->lock,
+// then a run queue's lock.
 struct {
   struct spinlock lock;
   struct proc proc[NPROC];
 } ptable;
 
+// Per-CPU queues of RUNNABLE processes, one list per priority
+// level.  Each CPU runs processes from its own queue and steals
+// from the others when that is empty.  Padded to a cache line
+// so CPUs never share one.
+struct runq {
+  struct spinlock lock;
+  struct proc *head[NPRIO];
+  struct proc *tail[NPRIO];
+  volatile int n;     // peeked at without the lock
+  uint epoch;         // priority boost last applied to the lists
+  volatile uint idle; // CPU is halted or about to halt
+  uint halts;         // times the CPU halted for lack of work
+  uint kicks;         // times another CPU woke it with an IPI
+} __attribute__((aligned(64)));
+
+// Multi-level feedback queue policy.  A process runs for
+// QUANTUM(prio) ticks before it drops a level, and is preempted
+// sooner if a higher level has a process waiting.  Waking from
+// sleep raises a process one level.  Every BOOSTTICKS ticks all
+// processes go back to their nice level, so none starves.
+#define QUANTUM(prio)  (1 << (prio))
+#define BOOSTTICKS     100
+
+static struct runq runq[NCPU];
+
+// Sleeping processes, on queues hashed by channel, so that
+// wakeup() looks only at processes that may be sleeping on its
+// channel.  Padded to a cache line so CPUs never share one.
+#define WQBITS 6
+#define NWAITQ (1 << WQBITS)
+#define WQHASH(chan) (((uint)(chan) * 2654435761U) >> (32 - WQBITS))
+
+struct waitq {
+  struct spinlock lock;
+  struct proc *head;  // oldest sleeper
+  struct proc *tail;
+} __attribute__((aligned(64)));
+
+static struct waitq waitq[NWAITQ];
+
+#define NPIDHASH 64
+#define PIDHASH(pid) ((uint)(pid) % NPIDHASH)
+static struct proc *pidhash[NPIDHASH];
+
 static struct proc *initproc;
 
 int nextpid = 1;
 extern void forkret(void);
 extern void trapret(void);
 
-static void wakeup1(void *chan);
-
 void
 pinit(void)
 {
-  initlock(&ptable.lock, "ptable");
+  struct proc *p;
+  int i;
+
+  initmcslock(&ptable.lock, "ptable");
+  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
+    initlock(&p->lock, "proc");
+    initlock(&p->glock, "group");
+  }
+  for(i = 0; i < NCPU; i++)
+    initlock(&runq[i].lock, "runq");
+  for(i = 0; i < NWAITQ; i++)
+    initlock(&waitq[i].lock, "waitq");
+}
+
+//PAGEBREAK: 30
+// If a boost has happened since p last looked, put p
+// back at its nice level.  Caller must hold p->lock or
+// rq->lock of the queue p is on.
+static void
+boost(struct proc *p)
+{
+  if(p->epoch != ticks / BOOSTTICKS){
+    p->epoch = ticks / BOOSTTICKS;
+    p->prio = p->nice;
+    p->ticks = 0;
+  }
+}
+
+// Append p to run queue rq at its priority level.
+// Caller must hold rq->lock.
+static void
+rqappend1(struct runq *rq, struct proc *p)
+{
+  p->rqnext = 0;
+  if(rq->tail[p->prio])
+    rq->tail[p->prio]->rqnext = p;
+  else
+    rq->head[p->prio] = p;
+  rq->tail[p->prio] = p;
+}
+
+static void
+rqappend(struct runq *rq, struct proc *p)
+{
+  acquire(&rq->lock);
+  rqappend1(rq, p);
+  rq->n++;
+  release(&rq->lock);
+}
+
+// Apply any boost that is due to the processes waiting on rq.
+static void
+rqboost(struct runq *rq)
+{
+  struct proc *p, *q;
+  int l;
+
+  if(rq->epoch == ticks / BOOSTTICKS)  // peek without the lock
+    return;
+  acquire(&rq->lock);
+  rq->epoch = ticks / BOOSTTICKS;
+  for(l = 1; l < NPRIO; l++){
+    p = rq->head[l];
+    rq->head[l] = rq->tail[l] = 0;
+    for(; p; p = q){
+      q = p->rqnext;
+      boost(p);
+      rqappend1(rq, p);
+    }
+  }
+  release(&rq->lock);
+}
+
+// Take the first process of the highest level off run queue rq.
+// Returns 0 if rq is empty.
+static struct proc*
+rqget(struct runq *rq)
+{
+  struct proc *p;
+  int l;
+
+  if(rq->n == 0)  // peek without the lock
+    return 0;
+  acquire(&rq->lock);
+  p = 0;
+  for(l = 0; l < NPRIO; l++){
+    if((p = rq->head[l]) != 0){
+      rq->head[l] = p->rqnext;
+      if(rq->head[l] == 0)
+        rq->tail[l] = 0;
+      rq->n--;
+      break;
+    }
+  }
+  release(&rq->lock);
+  return p;
+}
+
+// Take a process from some other CPU's run queue.
+static struct proc*
+steal(void)
+{
+  struct proc *p;
+  int i;
+
+  for(i = 1; i < NCPU; i++)
+    if((p = rqget(&runq[(cpu->id + i) % NCPU])) != 0)
+      return p;
+  return 0;
+}
+
+// Halt this CPU until an interrupt arrives, unless some run queue
+// has work.  A CPU that queues work sees idle set and sends an
+// IPI (see kick), so work queued after the check is not missed.
+static void
+idle(struct runq *rq)
+{
+  int i;
+
+  cli();
+  xchg(&rq->idle, 1);
+  for(i = 0; i < NCPU; i++){
+    if(runq[i].n > 0){
+      rq->idle = 0;
+      sti();
+      return;
+    }
+  }
+  rq->halts++;
+  stihlt();
+  if(xchg(&rq->idle, 0) == 0)
+    rq->kicks++;
+}
+
+// Make sure work just queued on rq gets noticed: wake rq's CPU
+// if it is halted, or else some other halted CPU to steal it.
+// (Work queued on this CPU behind nothing else will run as soon
+// as the current process gives up the CPU.)
+static void
+kick(struct runq *rq)
+{
+  struct runq *q;
+
+  if(rq->idle && xchg(&rq->idle, 0)){
+    lapicipi(cpus[rq - runq].id, T_IRQ0 + IRQ_WAKEUP);
+    return;
+  }
+  if(rq == &runq[cpu->id] && rq->n <= 1)
+    return;
+  for(q = runq; q < &runq[ncpu]; q++){
+    if(q->idle && xchg(&q->idle, 0)){
+      lapicipi(cpus[q - runq].id, T_IRQ0 + IRQ_WAKEUP);
+      return;
+    }
+  }
+}
+
+// Mark p RUNNABLE and put it on a run queue: that of the CPU it
+// last ran on, whose cache may still hold its data, unless this
+// CPU's is shorter.  New processes go on the shortest queue.
+// Caller must hold p->lock.
+static void
+setrunnable(struct proc *p)
+{
+  struct runq *rq, *q;
+
+  p->state = RUNNABLE;
+  boost(p);
+  rq = &runq[cpu->id];
+  if(p->cpu < 0){
+    for(q = runq; q < &runq[ncpu]; q++)
+      if(q->n < rq->n)
+        rq = q;
+  } else if(runq[p->cpu].n <= rq->n)
+    rq = &runq[p->cpu];
+  rqappend(rq, p);
+  kick(rq);
+}
+
+// Make p, a new process or thread, findable by its pid and
+// reachable from its parent and, if a thread, its leader.
+static void
+linkproc(struct proc *p)
+{
+  struct proc *pp, *g;
+
+  acquire(&ptable.lock);
+  p->pidnext = pidhash[PIDHASH(p->pid)];
+  pidhash[PIDHASH(p->pid)] = p;
+  if((pp = p->parent) != 0){
+    p->sibprev = 0;
+    p->sibling = pp->children;
+    if(pp->children)
+      pp->children->sibprev = p;
+    pp->children = p;
+  }
+  if((g = p->leader) != p){
+    p->tnext = g->threads;
+    g->threads = p;
+  }
+  release(&ptable.lock);
+}
+
+// Undo linkproc().  Caller must hold ptable.lock.
+static void
+unlinkproc(struct proc *p)
+{
+  struct proc **pp;
+
+  for(pp = &pidhash[PIDHASH(p->pid)]; *pp != p; pp = &(*pp)->pidnext)
+    ;
+  *pp = p->pidnext;
+  if(p->parent){
+    if(p->sibprev)
+      p->sibprev->sibling = p->sibling;
+    else
+      p->parent->children = p->sibling;
+    if(p->sibling)
+      p->sibling->sibprev = p->sibprev;
+  }
+  if(p->leader != p){
+    for(pp = &p->leader->threads; *pp != p; pp = &(*pp)->tnext)
+      ;
+    *pp = p->tnext;
+  }
+}
+
+// Return the process with the given pid, or 0.
+// Caller must hold ptable.lock.
+static struct proc*
+findpid(int pid)
+{
+  struct proc *p;
+
+  for(p = pidhash[PIDHASH(pid)]; p; p = p->pidnext)
+    if(p->pid == pid)
+      return p;
+  return 0;
 }
 
 //PAGEBREAK: 32
@@ -47,6 +335,17 @@ allocproc(void)
 found:
   p->state = EMBRYO;
   p->pid = nextpid++;
+  p->cpu = -1;
+  p->prio = p->nice = p->ticks = 0;
+  p->epoch = ticks / BOOSTTICKS;
+  p->leader = p;
+  p->nthreads = 1;
+  p->children = p->threads = 0;
+  p->ring = 0;
+  p->ringpoll = 0;
+  p->ringbusy = 0;
+  p->fpu = 0;
+  p->fpucpu = -1;
   release(&ptable.lock);
 
   // Allocate kernel stack.
@@ -86,6 +385,8 @@ userinit(void)
   if((p->pgdir = setupkvm()) == 0)
     panic("userinit: out of memory?");
   inituvm(p->pgdir, _binary_initcode_start, (int)_binary_initcode_size);
+  if(mapvdso(p->pgdir, p->pid) < 0)
+    panic("userinit: out of memory?");
   p->sz = PGSIZE;
   memset(p->tf, 0, sizeof(*p->tf));
   p->tf->cs = (SEG_UCODE << 3) | DPL_USER;
@@ -98,28 +399,49 @@ userinit(void)
 
   safestrcpy(p->name, "initcode", sizeof(p->name));
   p->cwd = namei("/");
+  linkproc(p);
 
-  p->state = RUNNABLE;
+  acquire(&p->lock);
+  setrunnable(p);
+  release(&p->lock);
 }
 
 // Grow current process's memory by n bytes.
-// Return 0 on success, -1 on failure.
+// Return its old size, or -1 on failure.
 int
 growproc(int n)
 {
-  uint sz;
-  
-  sz = proc->sz;
-  if(n > 0){
-    if((sz = allocuvm(proc->pgdir, sz, sz + n)) == 0)
-      return -1;
-  } else if(n < 0){
-    if((sz = deallocuvm(proc->pgdir, sz, sz + n)) == 0)
-      return -1;
+  struct proc *g, *p;
+  uint oldsz, sz;
+
+  g = proc->leader;
+  acquire(&g->glock);
+  oldsz = sz = proc->sz;
+  if(n > 0)
+    sz = allocuvm(proc->pgdir, sz, sz + n);
+  else if(n < 0){
+    // Other CPUs running its threads could go on using stale
+    // TLB entries for the freed pages, so only a process of
+    // one thread can shrink.
+    if(g->nthreads > 1)
+      sz = 0;
+    else
+      sz = deallocuvm(proc->pgdir, sz, sz + n);
   }
-  proc->sz = sz;
-  switchuvm(proc);
-  return 0;
+  if(sz == 0){
+    release(&g->glock);
+    return -1;
+  }
+  g->sz = sz;
+  if(g->threads){
+    acquire(&ptable.lock);
+    for(p = g->threads; p; p = p->tnext)
+      p->sz = sz;
+    release(&ptable.lock);
+  }
+  release(&g->glock);
+  lcr3(v2p(proc->pgdir));  // flush TLB entries for the old mappings
+  return oldsz;
 }
 
 // Create a new process copying p as the parent.
@@ -129,14 +451,18 @@ int
 fork(void)
 {
   int i, pid;
-  struct proc *np;
+  struct proc *np, *g;
 
   // Allocate process.
   if((np = allocproc()) == 0)
     return -1;
 
   // Copy process state from p.
-  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0){
+  if((np->pgdir = copyuvm(proc->pgdir, proc->sz)) == 0 ||
+     mapvdso(np->pgdir, np->pid) < 0 || fpufork(np) < 0){
+    if(np->pgdir)
+      freevm(np->pgdir);
+    np->pgdir = 0;
     kfree(np->kstack);
     np->kstack = 0;
     np->state = UNUSED;
@@ -144,61 +470,264 @@ fork(void)
   }
   np->sz = proc->sz;
   np->parent = proc;
+  np->prio = np->nice = proc->nice;
   *np->tf = *proc->tf;
 
   // Clear %eax so that fork returns 0 in the child.
   np->tf->eax = 0;
 
+  g = proc->leader;
+  acquire(&g->glock);
   for(i = 0; i < NOFILE; i++)
-    if(proc->ofile[i])
-      np->ofile[i] = filedup(proc->ofile[i]);
-  np->cwd = idup(proc->cwd);
+    if(g->ofile[i])
+      np->ofile[i] = filedup(g->ofile[i]);
+  np->cwd = idup(g->cwd);
+  release(&g->glock);
  
   pid = np->pid;
-  np->state = RUNNABLE;
   safestrcpy(np->name, proc->name, sizeof(proc->name));
+  linkproc(np);
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
+  return pid;
+}
+
+// Create a new thread in the current process, running
+// fn(arg) on the PGSIZE bytes of user stack at stack.
+// The thread shares the process's memory, files and
+// current directory, and must call exit() when done.
+int
+clone(void (*fn)(void*), void *arg, void *stack)
+{
+  uint sp, ustack[2];
+  int pid;
+  struct proc *np, *g;
+
+  sp = (uint)stack + PGSIZE;
+  if(sp < (uint)stack || sp > proc->sz)
+    return -1;
+  ustack[0] = 0xffffffff;  // fake return PC
+  ustack[1] = (uint)arg;
+  sp -= sizeof(ustack);
+  if(copyout(proc->pgdir, sp, ustack, sizeof(ustack)) < 0)
+    return -1;
+
+  if((np = allocproc()) == 0)
+    return -1;
+  g = proc->leader;
+  np->pgdir = proc->pgdir;
+  np->parent = proc;
+  np->leader = g;
+  np->ustack = stack;
+  np->prio = np->nice = proc->nice;
+  *np->tf = *proc->tf;
+  np->tf->eip = (uint)fn;
+  np->tf->esp = sp;
+
+  acquire(&g->glock);
+  np->sz = proc->sz;
+  g->nthreads++;
+  release(&g->glock);
+
+  // getpid() now differs between threads of the process.
+  ((struct vdsoproc*)uva2ka(proc->pgdir, (char*)VDSOPROC))->pid = 0;
+
+  pid = np->pid;
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+  linkproc(np);
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
   return pid;
 }
 
+// Create a thread in the current process that runs fn in the
+// kernel, never in user space.  fn starts out holding its
+// proc->lock, as forkret() does, and must finish with exit().
+struct proc*
+kclone(void (*fn)(void))
+{
+  struct proc *np, *g;
+
+  if((np = allocproc()) == 0)
+    return 0;
+  g = proc->leader;
+  np->pgdir = proc->pgdir;
+  np->parent = proc;
+  np->leader = g;
+  np->ustack = 0;
+  np->prio = np->nice = proc->nice;
+  np->context->eip = (uint)fn;
+
+  acquire(&g->glock);
+  np->sz = proc->sz;
+  g->nthreads++;
+  release(&g->glock);
+
+  safestrcpy(np->name, proc->name, sizeof(proc->name));
+  linkproc(np);
+  acquire(&np->lock);
+  setrunnable(np);
+  release(&np->lock);
+  return np;
+}
+
+// Memory of reaped processes, freed by reap() after the
+// reaper releases ptable.lock: freevm() takes time in
+// proportion to the size of the process, and nobody should
+// wait on the global lock meanwhile.
+struct reaped {
+  char *kstacks;  // chained through their first word
+  char *fpus;     // likewise
+  pde_t *pgdir;
+};
+
+// Return a ZOMBIE's slot to the table, moving its kernel
+// stack, and its memory unless it is a thread sharing its
+// leader's, to r.  Caller must hold ptable.lock and p->lock.
+static void
+freeproc(struct proc *p, struct reaped *r)
+{
+  unlinkproc(p);
+  *(char**)p->kstack = r->kstacks;
+  r->kstacks = p->kstack;
+  p->kstack = 0;
+  if(p->fpu){
+    *(char**)p->fpu = r->fpus;
+    r->fpus = p->fpu;
+    p->fpu = 0;
+  }
+  if(p->leader == p)
+    r->pgdir = p->pgdir;
+  p->pgdir = 0;
+  p->state = UNUSED;
+  p->pid = 0;
+  p->parent = 0;
+  p->leader = 0;
+  p->name[0] = 0;
+  p->killed = 0;
+}
+
+// Free what freeproc() collected.  Must not hold ptable.lock.
+static void
+reap(struct reaped *r)
+{
+  char *s;
+
+  while((s = r->kstacks) != 0){
+    r->kstacks = *(char**)s;
+    kfree(s);
+  }
+  while((s = r->fpus) != 0){
+    r->fpus = *(char**)s;
+    kmfree(s);
+  }
+  if(r->pgdir)
+    freevm(r->pgdir);
+}
+
+// Kill the current process's other threads and wait for
+// them to exit, so that none is left using its memory,
+// files or current directory.
+void
+killthreads(void)
+{
+  struct proc *p, *q;
+  struct reaped r;
+  int n;
+
+  r.kstacks = r.fpus = 0;
+  r.pgdir = 0;
+  acquire(&ptable.lock);
+  for(;;){
+    n = 0;
+    for(p = proc->threads; p; p = q){
+      q = p->tnext;
+      acquire(&p->lock);
+      if(p->state == ZOMBIE)
+        freeproc(p, &r);
+      else {
+        n++;
+        p->killed = 1;
+        if(p->state == SLEEPING)
+          setrunnable(p);
+      }
+      release(&p->lock);
+    }
+    if(n == 0)
+      break;
+    sleep(proc, &ptable.lock);
+  }
+  release(&ptable.lock);
+  reap(&r);
+}
+
 // Exit the current process.  Does not return.
 // An exited process remains in the zombie state
 // until its parent calls wait() to find out it exited.
+// A thread other than the leader exits alone; the leader
+// takes its other threads with it.
 void
 exit(void)
 {
-  struct proc *p;
+  struct proc *p, *q, *heir;
   int fd;
 
   if(proc == initproc)
     panic("init exiting");
 
-  // Close all open files.
-  for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd]){
-      fileclose(proc->ofile[fd]);
-      proc->ofile[fd] = 0;
+  if(proc->leader == proc){
+    killthreads();
+
+    // Close all open files.
+    for(fd = 0; fd < NOFILE; fd++){
+      if(proc->ofile[fd]){
+        fileclose(proc->ofile[fd]);
+        proc->ofile[fd] = 0;
+      }
     }
-  }
 
-  iput(proc->cwd);
-  proc->cwd = 0;
+    iput(proc->cwd);
+    proc->cwd = 0;
+    heir = initproc;
+  } else {
+    acquire(&proc->leader->glock);
+    proc->leader->nthreads--;
+    release(&proc->leader->glock);
+    heir = proc->leader;
+  }
 
   acquire(&ptable.lock);
 
-  // Parent might be sleeping in wait().
-  wakeup1(proc->parent);
+  // Parent might be sleeping in wait() or join(),
+  // and the leader in killthreads().
+  wakeup(proc->parent);
+  if(heir != initproc)
+    wakeup(heir);
 
-  // Pass abandoned children to init.
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->parent == proc){
-      p->parent = initproc;
+  // Pass abandoned children to init, or a thread's to its leader.
+  if((p = proc->children) != 0){
+    for(;; p = p->sibling){
+      p->parent = heir;
       if(p->state == ZOMBIE)
-        wakeup1(initproc);
+        wakeup(heir);
+      if(p->sibling == 0)
+        break;
     }
+    if((q = heir->children) != 0)
+      q->sibprev = p;
+    p->sibling = q;
+    heir->children = proc->children;
+    proc->children = 0;
   }
 
-  // Jump into the scheduler, never to return.
+  // Jump into the scheduler, never to return.  The parent
+  // can't look at our state until ptable.lock is released,
+  // nor free us until the scheduler releases proc->lock.
+  acquire(&proc->lock);
   proc->state = ZOMBIE;
+  release(&ptable.lock);
   sched();
   panic("zombie exit");
 }
@@ -209,30 +738,30 @@ int
 wait(void)
 {
   struct proc *p;
+  struct reaped r;
   int havekids, pid;
 
+  r.kstacks = r.fpus = 0;
+  r.pgdir = 0;
   acquire(&ptable.lock);
   for(;;){
     // Scan through table looking for zombie children.
     havekids = 0;
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->parent != proc)
+    for(p = proc->children; p; p = p->sibling){
+      if(p->leader != p)
         continue;
       havekids = 1;
+      acquire(&p->lock);
       if(p->state == ZOMBIE){
         // Found one.
         pid = p->pid;
-        kfree(p->kstack);
-        p->kstack = 0;
-        freevm(p->pgdir);
-        p->state = UNUSED;
-        p->pid = 0;
-        p->parent = 0;
-        p->name[0] = 0;
-        p->killed = 0;
+        freeproc(p, &r);
+        release(&p->lock);
         release(&ptable.lock);
+        reap(&r);
         return pid;
       }
+      release(&p->lock);
     }
 
     // No point waiting if we don't have any children.
@@ -246,56 +775,107 @@ wait(void)
   }
 }
 
+// Wait for a thread this thread created to exit, and return
+// its pid and, in *stack, the stack it was given by clone().
+// Return -1 if this thread has no such threads.
+int
+join(void **stack)
+{
+  struct proc *p;
+  struct reaped r;
+  int havethreads, pid;
+
+  r.kstacks = r.fpus = 0;
+  r.pgdir = 0;
+  acquire(&ptable.lock);
+  for(;;){
+    havethreads = 0;
+    for(p = proc->children; p; p = p->sibling){
+      if(p->leader == p || p == p->leader->ringpoll)
+        continue;
+      havethreads = 1;
+      acquire(&p->lock);
+      if(p->state == ZOMBIE){
+        pid = p->pid;
+        *stack = p->ustack;
+        freeproc(p, &r);
+        release(&p->lock);
+        release(&ptable.lock);
+        reap(&r);
+        return pid;
+      }
+      release(&p->lock);
+    }
+
+    if(!havethreads || proc->killed){
+      release(&ptable.lock);
+      return -1;
+    }
+    sleep(proc, &ptable.lock);
+  }
+}
+
 //PAGEBREAK: 42
 // Per-CPU process scheduler.
 // Each CPU calls scheduler() after setting itself up.
 // Scheduler never returns.  It loops, doing:
-//  - choose a process to run
+//  - take a process off this CPU's run queue, or steal one
 //  - swtch to start running that process
 //  - eventually that process transfers control
 //      via swtch back to the scheduler.
 void
 scheduler(void)
 {
-  struct proc *p;
+  struct proc *p, *next;
+  struct runq *rq;
 
+  rq = &runq[cpu->id];
+  next = 0;
   for(;;){
-    // Enable interrupts on this processor.
-    sti();
-
-    // Loop over process table looking for process to run.
-    acquire(&ptable.lock);
-    for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-      if(p->state != RUNNABLE)
+    if((p = next) == 0){
+      // Enable interrupts on this processor.
+      sti();
+      if((p = rqget(rq)) == 0 && (p = steal()) == 0){
+        idle(rq);
         continue;
-
-      // Switch to chosen process.  It is the process's job
-      // to release ptable.lock and then reacquire it
-      // before jumping back to us.
-      proc = p;
-      switchuvm(p);
-      p->state = RUNNING;
-      swtch(&cpu->scheduler, proc->context);
-      switchkvm();
-
-      // Process is done running for now.
-      // It should have changed its p->state before coming back.
-      proc = 0;
+      }
     }
-    release(&ptable.lock);
 
+    // Switch to chosen process.  It is the process's job
+    // to release p->lock and then reacquire it
+    // before jumping back to us.
+    acquire(&p->lock);
+    if(p->state != RUNNABLE)
+      panic("scheduler: not runnable");
+    p->state = RUNNING;
+    p->cpu = cpu->id;
+    proc = p;
+    switchuvm(p);
+    swtch(&cpu->scheduler, proc->context);
+
+    // Process is done running for now.
+    // It should have changed its p->state before coming back.
+    // Stay on its page table if the next process shares it,
+    // as threads of one process do;
+    // otherwise leave it before releasing p->lock, after which
+    // wait() may free it.
+    proc = 0;
+    next = rqget(rq);
+    if(next == 0 || next->pgdir != p->pgdir)
+      switchkvm();
+    release(&p->lock);
   }
 }
 
-// Enter scheduler.  Must hold only ptable.lock
+// Enter scheduler.  Must hold only proc->lock
 // and have changed proc->state.
 void
 sched(void)
 {
   int intena;
 
-  if(!holding(&ptable.lock))
-    panic("sched ptable.lock");
+  if(!holding(&proc->lock))
+    panic("sched proc->lock");
   if(cpu->ncli != 1)
     panic("sched locks");
   if(proc->state == RUNNING)
@@ -303,18 +883,69 @@ sched(void)
   if(readeflags()&FL_IF)
     panic("sched interruptible");
   intena = cpu->intena;
+  fpusave();
   swtch(&proc->context, cpu->scheduler);
   cpu->intena = intena;
 }
 
+// Charge the current timer tick to proc.  Returns 1 if proc
+// should give up the CPU: it has used up its quantum, and drops
+// a level, or a process of a higher level is waiting here.
+int
+schedtick(void)
+{
+  struct runq *rq;
+  int l, r;
+
+  rq = &runq[cpu->id];
+  rqboost(rq);
+  acquire(&proc->lock);
+  boost(proc);
+  r = 0;
+  if(++proc->ticks >= QUANTUM(proc->prio)){
+    if(proc->prio < NPRIO-1)
+      proc->prio++;
+    proc->ticks = 0;
+    r = 1;
+  }
+  for(l = 0; l < proc->prio; l++)
+    if(rq->head[l])
+      r = 1;
+  release(&proc->lock);
+  return r;
+}
+
+// Set the nice level of process pid: the highest priority
+// level it may reach, from 0 (highest) to NPRIO-1.
+int
+setpriority(int pid, int nice)
+{
+  struct proc *p;
+
+  if(nice < 0 || nice >= NPRIO)
+    return -1;
+  acquire(&ptable.lock);
+  if((p = findpid(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
+  }
+  acquire(&p->lock);
+  p->nice = nice;
+  if(p->prio < nice)
+    p->prio = nice;
+  release(&p->lock);
+  release(&ptable.lock);
+  return 0;
+}
+
 // Give up the CPU for one scheduling round.
 void
 yield(void)
 {
-  acquire(&ptable.lock);  //DOC: yieldlock
-  proc->state = RUNNABLE;
+  acquire(&proc->lock);  //DOC: yieldlock
+  setrunnable(proc);
   sched();
-  release(&ptable.lock);
+  release(&proc->lock);
 }
 
 // A fork child's very first scheduling by scheduler()
@@ -323,8 +954,8 @@ void
 forkret(void)
 {
   static int first = 1;
-  // Still holding ptable.lock from scheduler.
-  release(&ptable.lock);
+  // Still holding proc->lock from scheduler.
+  release(&proc->lock);
 
   if (first) {
     // Some initialization functions must be run in the context
@@ -337,63 +968,127 @@ forkret(void)
   // Return to "caller", actually trapret (see allocproc).
 }
 
+// Take p off the wait queue it is on.
+// Caller must hold p->wq->lock.
+static void
+wqremove(struct proc *p)
+{
+  if(p->wqprev)
+    p->wqprev->wqnext = p->wqnext;
+  else
+    p->wq->head = p->wqnext;
+  if(p->wqnext)
+    p->wqnext->wqprev = p->wqprev;
+  else
+    p->wq->tail = p->wqprev;
+  p->wq = 0;
+}
+
 // Atomically release lock and sleep on chan.
 // Reacquires lock when awakened.
 void
 sleep(void *chan, struct spinlock *lk)
 {
+  struct waitq *wq;
+
   if(proc == 0)
     panic("sleep");
 
   if(lk == 0)
     panic("sleep without lk");
 
-  // Must acquire ptable.lock in order to
-  // change p->state and then call sched.
-  // Once we hold ptable.lock, we can be
+  // Must acquire proc->lock in order to
+  // change proc->state and then call sched,
+  // and chan's wait queue lock to go on it.
+  // Once we hold the wait queue lock, we can be
   // guaranteed that we won't miss any wakeup
-  // (wakeup runs with ptable.lock locked),
-  // so it's okay to release lk.
-  if(lk != &ptable.lock){  //DOC: sleeplock0
-    acquire(&ptable.lock);  //DOC: sleeplock1
-    release(lk);
-  }
-
-  // Go to sleep.
+  // (wakeup runs with it locked), so it's okay
+  // to release lk.
+  wq = &waitq[WQHASH(chan)];
+  acquire(&wq->lock);  //DOC: sleeplock1
+  acquire(&proc->lock);
   proc->chan = chan;
   proc->state = SLEEPING;
+  proc->wq = wq;
+  proc->wqnext = 0;
+  proc->wqprev = wq->tail;
+  if(wq->tail)
+    wq->tail->wqnext = proc;
+  else
+    wq->head = proc;
+  wq->tail = proc;
+  release(lk);
+  release(&wq->lock);
+
+  // Go to sleep.
   sched();
 
   // Tidy up.
   proc->chan = 0;
+  release(&proc->lock);
 
-  // Reacquire original lock.
-  if(lk != &ptable.lock){  //DOC: sleeplock2
-    release(&ptable.lock);
-    acquire(lk);
+  // wakeup() took us off the wait queue, unless it was kill().
+  if(proc->wq){
+    acquire(&wq->lock);
+    if(proc->wq)
+      wqremove(proc);
+    release(&wq->lock);
   }
+
+  // Reacquire original lock.
+  acquire(lk);
 }
 
 //PAGEBREAK!
-// Wake up all processes sleeping on chan.
-// The ptable lock must be held.
-static void
-wakeup1(void *chan)
+// Wake up to n processes sleeping on chan, oldest first,
+// and return how many were woken.  The caller should hold
+// the lock that the sleepers passed to sleep().
+int
+wakeupn(void *chan, int n)
 {
-  struct proc *p;
+  struct waitq *wq;
+  struct proc *p, *q;
+  int woken;
 
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++)
-    if(p->state == SLEEPING && p->chan == chan)
-      p->state = RUNNABLE;
+  wq = &waitq[WQHASH(chan)];
+  woken = 0;
+  acquire(&wq->lock);
+  for(p = wq->head; p && woken < n; p = q){
+    q = p->wqnext;
+    if(p->chan != chan)
+      continue;
+    acquire(&p->lock);
+    if(p->state == SLEEPING && p->chan == chan){
+      wqremove(p);
+      // It waited instead of using the CPU: raise it a level.
+      if(p->prio > p->nice){
+        p->prio--;
+        p->ticks = 0;
+      }
+      setrunnable(p);
+      woken++;
+    }
+    release(&p->lock);
+  }
+  release(&wq->lock);
+  return woken;
 }
 
 // Wake up all processes sleeping on chan.
 void
 wakeup(void *chan)
 {
-  acquire(&ptable.lock);
-  wakeup1(chan);
-  release(&ptable.lock);
+  wakeupn(chan, NPROC);
+}
+
+// Wake up one process sleeping on chan, for when only one
+// of them can make progress.  Every sleeper must be waiting
+// for the same thing, or the one woken may not take it and
+// the others would sleep on.
+void
+wakeone(void *chan)
+{
+  wakeupn(chan, 1);
 }
 
 // Kill the process with the given pid.
@@ -405,18 +1100,18 @@ kill(int pid)
   struct proc *p;
 
   acquire(&ptable.lock);
-  for(p = ptable.proc; p < &ptable.proc[NPROC]; p++){
-    if(p->pid == pid){
-      p->killed = 1;
-      // Wake process from sleep if necessary.
-      if(p->state == SLEEPING)
-        p->state = RUNNABLE;
-      release(&ptable.lock);
-      return 0;
-    }
+  if((p = findpid(pid)) == 0){
+    release(&ptable.lock);
+    return -1;
   }
+  acquire(&p->lock);
+  p->killed = 1;
+  // Wake process from sleep if necessary.
+  if(p->state == SLEEPING)
+    setrunnable(p);
+  release(&p->lock);
   release(&ptable.lock);
-  return -1;
+  return 0;
 }
 
 //PAGEBREAK: 36
@@ -454,6 +1149,9 @@ procdump(void)
     }
     cprintf("\n");
   }
+  for(i = 0; i < ncpu; i++)
+    cprintf("cpu%d: %d halts, %d woken by ipi\n",
+            i, runq[i].halts, runq[i].kicks);
 }
 
 
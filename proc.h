@@ -6,6 +6,8 @@ struct cpu {
   uchar id;                    // Local APIC ID; index into cpus[] below
   struct context *scheduler;   // swtch() here to enter scheduler
   struct taskstate ts;         // Used by x86 to find stack for interrupt
+  uint sysstack[128];          // SYSENTER's stack until it loads sysesp;
+  uint sysesp;                 //   top of the current kernel stack
   struct segdesc gdt[NSEGS];   // x86 global descriptor table
   volatile uint started;       // Has the CPU started?
   int ncli;                    // Depth of pushcli nesting.
@@ -14,6 +16,12 @@ struct cpu {
   // Cpu-local storage variables; see below
   struct cpu *cpu;
   struct proc *proc;           // The currently-running process.
+
+  struct mcsnode mcs[NMCS];    // For MCS locks; see spinlock.c
+  uint mcsused;                // Bitmap of mcs[] in use
+
+  struct proc *fpuproc;        // Whose state the FPU registers hold
+  int fpuused;                 // proc has used the FPU since switching in
 };
 
 extern struct cpu cpus[NCPU];
@@ -53,6 +61,7 @@ enum procstate { UNUSED, EMBRYO, SLEEPING, RUNNABLE, RUNNING, ZOMBIE };
 
 // Per-process state
 struct proc {
+  struct spinlock lock;        // Protects state, chan, killed, cpu
   uint sz;                     // Size of process memory (bytes)
   pde_t* pgdir;                // Page table
   char *kstack;                // Bottom of kernel stack for this process
@@ -62,12 +71,40 @@ struct proc {
   struct trapframe *tf;        // Trap frame for current syscall
   struct context *context;     // swtch() here to run process
   void *chan;                  // If non-zero, sleeping on chan
+  struct waitq *wq;            // Wait queue it is on, if any
+  struct proc *wqnext;         // Links on that wait queue
+  struct proc *wqprev;
   int killed;                  // If non-zero, have been killed
-  struct file *ofile[NOFILE];  // Open files
-  struct inode *cwd;           // Current directory
+  struct file *ofile[NOFILE];  // Open files (leader only)
+  struct inode *cwd;           // Current directory (leader only)
   char name[16];               // Process name (debugging)
+  int cpu;                     // CPU it last ran on, or -1
+  struct proc *rqnext;         // Next on its run queue
+  int prio;                    // Current priority level, 0 is highest
+  int nice;                    // Highest level it may reach
+  int ticks;                   // Ticks used at its current level
+  uint epoch;                  // Priority boost it last got
+  struct proc *leader;         // Thread group leader, or itself
+  int nthreads;                // Live threads in group (leader only)
+  struct spinlock glock;       // Protects group's ofile, cwd, sz, nthreads
+  char *ustack;                // User stack given to clone()
+  struct proc *children;       // First child
+  struct proc *sibling;        // Next child of its parent
+  struct proc *sibprev;        // Previous child of its parent
+  struct proc *threads;        // Other threads in group (leader only)
+  struct proc *tnext;          // Next thread in its leader's list
+  struct proc *pidnext;        // Next in pid hash chain
+  struct ring *ring;           // Submission ring in user memory (leader only)
+  struct proc *ringpoll;       // Thread polling it, if any (leader only)
+  int ringbusy;                // A thread is taking submissions (leader only)
+  char *fpu;                   // FPU state, once it has used the FPU
+  int fpucpu;                  // CPU whose FPU last held that state
 };
 
+// Threads made by clone() share their leader's page table, open
+// files and current directory; a process is a group of one.  Each
+// thread has its own copy of sz, which growproc() keeps in step.
+
 // Process memory is laid out contiguously, low addresses first:
 //   text
 //   original data and bss
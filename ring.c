@@ -0,0 +1,230 @@
+// Batched system calls through rings in user memory.
+//
+// ring_setup() registers a struct ring (ring.h) in the
+// process's memory.  The process queues reads, writes, opens
+// and closes on the submission ring, and one ring_enter()
+// carries out all of them, posting each result on the
+// completion ring.  With RING_SQPOLL, a kernel thread in the
+// process polls the submission ring instead, so that a busy
+// process need not enter the kernel at all; the thread sleeps
+// after RINGIDLE idle ticks and sets RING_NEED_WAKEUP, and
+// then the process must call ring_enter() to wake it.
+//
+// The operations run as if the process had made the system
+// calls itself, with its page table, open files and current
+// directory.  The ring's state lives in the thread group
+// leader, under its glock.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "ring.h"
+
+#define RINGIDLE 2   // ticks the poller spins before sleeping
+
+// Check that the n bytes at addr are the process's.
+static int
+userok(uint addr, int n)
+{
+  if(n < 0 || addr >= proc->sz || addr + n > proc->sz)
+    return -1;
+  return 0;
+}
+
+static int
+ringop(struct sqe *e)
+{
+  char *path;
+
+  switch(e->op){
+  case RING_NOP:
+    return 0;
+  case RING_READ:
+    if(userok(e->addr, e->n) < 0)
+      return -1;
+    return fdread(e->fd, (char*)e->addr, e->n);
+  case RING_WRITE:
+    if(userok(e->addr, e->n) < 0)
+      return -1;
+    return fdwrite(e->fd, (char*)e->addr, e->n);
+  case RING_OPEN:
+    if(fetchstr(e->addr, &path) < 0)
+      return -1;
+    return openpath(path, e->n);
+  case RING_CLOSE:
+    return fdclose(e->fd);
+  }
+  return -1;
+}
+
+// Carry out the queued submissions, until there are no more
+// or the completion ring is full.  Returns how many.
+static int
+ringrun(struct ring *r)
+{
+  struct sqe e;
+  struct cqe *c;
+  int n;
+
+  for(n = 0; r->sqhead != r->sqtail; n++){
+    if(r->cqtail - r->cqhead >= NRING)
+      break;
+    __sync_synchronize();
+    e = r->sq[r->sqhead % NRING];  // copy: the process may change it
+    r->sqhead++;
+    c = &r->cq[r->cqtail % NRING];
+    c->data = e.data;
+    c->res = ringop(&e);
+    __sync_synchronize();
+    r->cqtail++;
+  }
+  return n;
+}
+
+// The RING_SQPOLL thread.  Started by ringsetup() through
+// kclone(), with proc->lock held like a new process.
+static void
+ringpoll(void)
+{
+  struct proc *g;
+  struct ring *r;
+  uint idle;
+
+  release(&proc->lock);
+  g = proc->leader;
+  r = g->ring;
+  idle = ticks;
+  for(;;){
+    if(proc->killed)
+      exit();
+    if(ringrun(r) > 0){
+      acquire(&g->glock);
+      wakeup(r);
+      release(&g->glock);
+      idle = ticks;
+    } else if(ticks - idle < RINGIDLE){
+      yield();
+    } else {
+      // Tell the process to wake us, then look once more
+      // in case it queued or reaped something meanwhile.
+      acquire(&g->glock);
+      r->flags |= RING_NEED_WAKEUP;
+      __sync_synchronize();
+      if((r->sqhead == r->sqtail || r->cqtail - r->cqhead >= NRING) &&
+         !proc->killed)
+        sleep(&g->ringpoll, &g->glock);
+      r->flags &= ~RING_NEED_WAKEUP;
+      release(&g->glock);
+      idle = ticks;
+    }
+  }
+}
+
+// Register the ring at addr for the current process.
+// Returns 0, or -1 if the process has a ring already.
+int
+ringsetup(uint addr, int flags)
+{
+  struct proc *g, *p;
+  struct ring *r;
+
+  if(addr % 4 != 0 || userok(addr, sizeof(*r)) < 0)
+    return -1;
+  r = (struct ring*)addr;
+  g = proc->leader;
+  acquire(&g->glock);
+  if(g->ring || g->ringbusy){
+    release(&g->glock);
+    return -1;
+  }
+  r->sqhead = r->sqtail = r->cqhead = r->cqtail = 0;
+  r->flags = flags & RING_SQPOLL;
+  g->ring = r;
+  if((flags & RING_SQPOLL) == 0){
+    release(&g->glock);
+    return 0;
+  }
+
+  // Keep ring_enter() out until the poller is there.
+  g->ringbusy = 1;
+  release(&g->glock);
+  p = kclone(ringpoll);
+  acquire(&g->glock);
+  if(p)
+    g->ringpoll = p;
+  else
+    g->ring = 0;
+  g->ringbusy = 0;
+  wakeup(&g->ringbusy);
+  release(&g->glock);
+  return p ? 0 : -1;
+}
+
+// Carry out the queued submissions, or wake the poller to,
+// and wait until at least min completions are ready.
+// Returns the number of completions ready.
+int
+ringenter(int min)
+{
+  struct proc *g;
+  struct ring *r;
+  int n;
+
+  if(min < 0)
+    min = 0;
+  if(min > NRING)
+    min = NRING;  // no more can ever be ready
+  g = proc->leader;
+  acquire(&g->glock);
+  // One thread at a time takes submissions.
+  while(g->ringbusy){
+    if(proc->killed){
+      release(&g->glock);
+      return -1;
+    }
+    sleep(&g->ringbusy, &g->glock);
+  }
+  if((r = g->ring) == 0 || userok((uint)r, sizeof(*r)) < 0){
+    release(&g->glock);
+    return -1;
+  }
+  if(g->ringpoll){
+    wakeup(&g->ringpoll);
+    while(r->cqtail - r->cqhead < min && !proc->killed)
+      sleep(r, &g->glock);
+  } else {
+    g->ringbusy = 1;
+    release(&g->glock);
+    ringrun(r);
+    acquire(&g->glock);
+    g->ringbusy = 0;
+    wakeup(&g->ringbusy);
+  }
+  n = r->cqtail - r->cqhead;
+  release(&g->glock);
+  return n;
+}
+
+// Forget the current process's ring, and stop its poller,
+// which runs in the old image, for exec().  The caller must
+// be the leader and its only other thread the poller.
+void
+ringstop(void)
+{
+  struct proc *g;
+  int poll;
+
+  g = proc->leader;
+  acquire(&g->glock);
+  g->ring = 0;
+  poll = g->ringpoll != 0;
+  release(&g->glock);
+  if(poll){
+    killthreads();
+    g->ringpoll = 0;
+  }
+}
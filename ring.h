@@ -0,0 +1,40 @@
+// Submission and completion rings, shared between a process
+// and the kernel (see ring.c).  The process queues operations
+// at sq[sqtail % NRING] and advances sqtail; the kernel takes
+// them from sqhead, and posts each result at cq[cqtail % NRING]
+// for the process to take from cqhead.
+#define NRING 32
+
+// Operations
+#define RING_NOP   0
+#define RING_READ  1  // read(fd, addr, n)
+#define RING_WRITE 2  // write(fd, addr, n)
+#define RING_OPEN  3  // open(addr, n)
+#define RING_CLOSE 4  // close(fd)
+
+// Flags
+#define RING_SQPOLL      0x1  // a kernel thread takes submissions
+#define RING_NEED_WAKEUP 0x2  // ... but it is asleep: call ring_enter()
+
+struct sqe {
+  int op;
+  int fd;
+  uint addr;          // buffer, or path for RING_OPEN
+  int n;              // byte count, or mode for RING_OPEN
+  uint data;          // passed back in the completion
+};
+
+struct cqe {
+  uint data;          // from the submission
+  int res;            // what the system call would have returned
+};
+
+struct ring {
+  volatile uint sqhead;   // written by the kernel
+  volatile uint sqtail;   // written by the process
+  volatile uint cqhead;   // written by the process
+  volatile uint cqtail;   // written by the kernel
+  volatile uint flags;    // written by the kernel
+  struct sqe sq[NRING];
+  struct cqe cq[NRING];
+};
@@ -0,0 +1,1878 @@
+
+_schedbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <work>:
+
+volatile uint sink;
+
+void
+work(int iters)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  uint i, x;
+
+  x = 1;
+   6:	c7 45 f8 01 00 00 00 	movl   $0x1,-0x8(%ebp)
+  for(i = 0; i < iters; i++)
+   d:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  14:	eb 15                	jmp    2b <work+0x2b>
+    x = x * 1103515245 + 12345;
+  16:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  19:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+  1f:	05 39 30 00 00       	add    $0x3039,%eax
+  24:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(i = 0; i < iters; i++)
+  27:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+  2b:	8b 45 08             	mov    0x8(%ebp),%eax
+  2e:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+  31:	72 e3                	jb     16 <work+0x16>
+  sink = x;
+  33:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  36:	a3 d8 12 00 00       	mov    %eax,0x12d8
+}
+  3b:	90                   	nop
+  3c:	c9                   	leave
+  3d:	c3                   	ret
+
+0000003e <main>:
+
+int
+main(int argc, char *argv[])
+{
+  3e:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  42:	83 e4 f0             	and    $0xfffffff0,%esp
+  45:	ff 71 fc             	push   -0x4(%ecx)
+  48:	55                   	push   %ebp
+  49:	89 e5                	mov    %esp,%ebp
+  4b:	53                   	push   %ebx
+  4c:	51                   	push   %ecx
+  4d:	83 ec 20             	sub    $0x20,%esp
+  50:	89 cb                	mov    %ecx,%ebx
+  int nproc, iters, i;
+  uint t0, t1;
+
+  nproc = 8;
+  52:	c7 45 f4 08 00 00 00 	movl   $0x8,-0xc(%ebp)
+  iters = 50000000;
+  59:	c7 45 f0 80 f0 fa 02 	movl   $0x2faf080,-0x10(%ebp)
+  if(argc > 1)
+  60:	83 3b 01             	cmpl   $0x1,(%ebx)
+  63:	7e 17                	jle    7c <main+0x3e>
+    nproc = atoi(argv[1]);
+  65:	8b 43 04             	mov    0x4(%ebx),%eax
+  68:	83 c0 04             	add    $0x4,%eax
+  6b:	8b 00                	mov    (%eax),%eax
+  6d:	83 ec 0c             	sub    $0xc,%esp
+  70:	50                   	push   %eax
+  71:	e8 d6 02 00 00       	call   34c <atoi>
+  76:	83 c4 10             	add    $0x10,%esp
+  79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(argc > 2)
+  7c:	83 3b 02             	cmpl   $0x2,(%ebx)
+  7f:	7e 17                	jle    98 <main+0x5a>
+    iters = atoi(argv[2]);
+  81:	8b 43 04             	mov    0x4(%ebx),%eax
+  84:	83 c0 08             	add    $0x8,%eax
+  87:	8b 00                	mov    (%eax),%eax
+  89:	83 ec 0c             	sub    $0xc,%esp
+  8c:	50                   	push   %eax
+  8d:	e8 ba 02 00 00       	call   34c <atoi>
+  92:	83 c4 10             	add    $0x10,%esp
+  95:	89 45 f0             	mov    %eax,-0x10(%ebp)
+
+  t0 = uptime();
+  98:	e8 7e 07 00 00       	call   81b <uptime>
+  9d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; i < nproc; i++){
+  a0:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  a7:	eb 3e                	jmp    e7 <main+0xa9>
+    switch(fork()){
+  a9:	e8 d2 06 00 00       	call   780 <fork>
+  ae:	83 f8 ff             	cmp    $0xffffffff,%eax
+  b1:	74 06                	je     b9 <main+0x7b>
+  b3:	85 c0                	test   %eax,%eax
+  b5:	74 19                	je     d0 <main+0x92>
+  b7:	eb 2a                	jmp    e3 <main+0xa5>
+    case -1:
+      printf(2, "schedbench: fork failed\n");
+  b9:	83 ec 08             	sub    $0x8,%esp
+  bc:	68 9c 0d 00 00       	push   $0xd9c
+  c1:	6a 02                	push   $0x2
+  c3:	e8 95 08 00 00       	call   95d <printf>
+  c8:	83 c4 10             	add    $0x10,%esp
+      exit();
+  cb:	e8 b7 06 00 00       	call   787 <exit>
+    case 0:
+      work(iters);
+  d0:	83 ec 0c             	sub    $0xc,%esp
+  d3:	ff 75 f0             	push   -0x10(%ebp)
+  d6:	e8 25 ff ff ff       	call   0 <work>
+  db:	83 c4 10             	add    $0x10,%esp
+      exit();
+  de:	e8 a4 06 00 00       	call   787 <exit>
+  for(i = 0; i < nproc; i++){
+  e3:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  e7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  ea:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  ed:	7c ba                	jl     a9 <main+0x6b>
+    }
+  }
+  for(i = 0; i < nproc; i++)
+  ef:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  f6:	eb 09                	jmp    101 <main+0xc3>
+    wait();
+  f8:	e8 91 06 00 00       	call   78e <wait>
+  for(i = 0; i < nproc; i++)
+  fd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+ 101:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 104:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+ 107:	7c ef                	jl     f8 <main+0xba>
+  t1 = uptime();
+ 109:	e8 0d 07 00 00       	call   81b <uptime>
+ 10e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+
+  printf(1, "schedbench: %d procs x %d iters in %d ticks\n",
+ 111:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 114:	2b 45 e8             	sub    -0x18(%ebp),%eax
+ 117:	83 ec 0c             	sub    $0xc,%esp
+ 11a:	50                   	push   %eax
+ 11b:	ff 75 f0             	push   -0x10(%ebp)
+ 11e:	ff 75 f4             	push   -0xc(%ebp)
+ 121:	68 b8 0d 00 00       	push   $0xdb8
+ 126:	6a 01                	push   $0x1
+ 128:	e8 30 08 00 00       	call   95d <printf>
+ 12d:	83 c4 20             	add    $0x20,%esp
+         nproc, iters, t1 - t0);
+  exit();
+ 130:	e8 52 06 00 00       	call   787 <exit>
+
+00000135 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 135:	55                   	push   %ebp
+ 136:	89 e5                	mov    %esp,%ebp
+ 138:	57                   	push   %edi
+ 139:	53                   	push   %ebx
+char*
+ 13a:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 13d:	8b 55 10             	mov    0x10(%ebp),%edx
+ 140:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 143:	89 cb                	mov    %ecx,%ebx
+ 145:	89 df                	mov    %ebx,%edi
+ 147:	89 d1                	mov    %edx,%ecx
+ 149:	fc                   	cld
+ 14a:	f3 aa                	rep stos %al,%es:(%edi)
+ 14c:	89 ca                	mov    %ecx,%edx
+ 14e:	89 fb                	mov    %edi,%ebx
+ 150:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 153:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 156:	90                   	nop
+ 157:	5b                   	pop    %ebx
+ 158:	5f                   	pop    %edi
+ 159:	5d                   	pop    %ebp
+ 15a:	c3                   	ret
+
+0000015b <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 15b:	55                   	push   %ebp
+ 15c:	89 e5                	mov    %esp,%ebp
+ 15e:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 161:	8b 55 08             	mov    0x8(%ebp),%edx
+ 164:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 167:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 16a:	f0 87 02             	lock xchg %eax,(%edx)
+ 16d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 170:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 173:	c9                   	leave
+ 174:	c3                   	ret
+
+00000175 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 175:	55                   	push   %ebp
+ 176:	89 e5                	mov    %esp,%ebp
+ 178:	53                   	push   %ebx
+ 179:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 17c:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 17f:	8b 55 10             	mov    0x10(%ebp),%edx
+ 182:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 185:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 188:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 18c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 18f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 192:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 195:	c9                   	leave
+ 196:	c3                   	ret
+
+00000197 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 197:	55                   	push   %ebp
+ 198:	89 e5                	mov    %esp,%ebp
+ 19a:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 19d:	0f 31                	rdtsc
+ 19f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 1a2:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 1a5:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 1a8:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 1ab:	c9                   	leave
+ 1ac:	c3                   	ret
+
+000001ad <strcpy>:
+{
+ 1ad:	55                   	push   %ebp
+ 1ae:	89 e5                	mov    %esp,%ebp
+ 1b0:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1b6:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1b9:	90                   	nop
+ 1ba:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1bd:	8d 42 01             	lea    0x1(%edx),%eax
+ 1c0:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1c3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1c9:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1cc:	0f b6 12             	movzbl (%edx),%edx
+ 1cf:	88 10                	mov    %dl,(%eax)
+ 1d1:	0f b6 00             	movzbl (%eax),%eax
+ 1d4:	84 c0                	test   %al,%al
+ 1d6:	75 e2                	jne    1ba <strcpy+0xd>
+  return os;
+ 1d8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1db:	c9                   	leave
+ 1dc:	c3                   	ret
+
+000001dd <strcmp>:
+{
+ 1dd:	55                   	push   %ebp
+ 1de:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1e0:	eb 08                	jmp    1ea <strcmp+0xd>
+    p++, q++;
+ 1e2:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 1e6:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 1ea:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ed:	0f b6 00             	movzbl (%eax),%eax
+ 1f0:	84 c0                	test   %al,%al
+ 1f2:	74 10                	je     204 <strcmp+0x27>
+ 1f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1f7:	0f b6 10             	movzbl (%eax),%edx
+ 1fa:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1fd:	0f b6 00             	movzbl (%eax),%eax
+ 200:	38 c2                	cmp    %al,%dl
+ 202:	74 de                	je     1e2 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 204:	8b 45 08             	mov    0x8(%ebp),%eax
+ 207:	0f b6 00             	movzbl (%eax),%eax
+ 20a:	0f b6 d0             	movzbl %al,%edx
+ 20d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 210:	0f b6 00             	movzbl (%eax),%eax
+ 213:	0f b6 c0             	movzbl %al,%eax
+ 216:	29 c2                	sub    %eax,%edx
+ 218:	89 d0                	mov    %edx,%eax
+}
+ 21a:	5d                   	pop    %ebp
+ 21b:	c3                   	ret
+
+0000021c <strlen>:
+{
+ 21c:	55                   	push   %ebp
+ 21d:	89 e5                	mov    %esp,%ebp
+ 21f:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 222:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 229:	eb 04                	jmp    22f <strlen+0x13>
+ 22b:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 22f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 232:	8b 45 08             	mov    0x8(%ebp),%eax
+ 235:	01 d0                	add    %edx,%eax
+ 237:	0f b6 00             	movzbl (%eax),%eax
+ 23a:	84 c0                	test   %al,%al
+ 23c:	75 ed                	jne    22b <strlen+0xf>
+  return n;
+ 23e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 241:	c9                   	leave
+ 242:	c3                   	ret
+
+00000243 <memset>:
+{
+ 243:	55                   	push   %ebp
+ 244:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 246:	8b 45 10             	mov    0x10(%ebp),%eax
+ 249:	50                   	push   %eax
+ 24a:	ff 75 0c             	push   0xc(%ebp)
+ 24d:	ff 75 08             	push   0x8(%ebp)
+ 250:	e8 e0 fe ff ff       	call   135 <stosb>
+ 255:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 258:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 25b:	c9                   	leave
+ 25c:	c3                   	ret
+
+0000025d <strchr>:
+{
+ 25d:	55                   	push   %ebp
+ 25e:	89 e5                	mov    %esp,%ebp
+ 260:	83 ec 04             	sub    $0x4,%esp
+ 263:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 266:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 269:	eb 14                	jmp    27f <strchr+0x22>
+    if(*s == c)
+ 26b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 26e:	0f b6 00             	movzbl (%eax),%eax
+ 271:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 274:	75 05                	jne    27b <strchr+0x1e>
+      return (char*)s;
+ 276:	8b 45 08             	mov    0x8(%ebp),%eax
+ 279:	eb 13                	jmp    28e <strchr+0x31>
+  for(; *s; s++)
+ 27b:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 27f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 282:	0f b6 00             	movzbl (%eax),%eax
+ 285:	84 c0                	test   %al,%al
+ 287:	75 e2                	jne    26b <strchr+0xe>
+  return 0;
+ 289:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 28e:	c9                   	leave
+ 28f:	c3                   	ret
+
+00000290 <gets>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 296:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 29d:	eb 42                	jmp    2e1 <gets+0x51>
+    cc = read(0, &c, 1);
+ 29f:	83 ec 04             	sub    $0x4,%esp
+ 2a2:	6a 01                	push   $0x1
+ 2a4:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2a7:	50                   	push   %eax
+ 2a8:	6a 00                	push   $0x0
+ 2aa:	e8 ed 04 00 00       	call   79c <read>
+ 2af:	83 c4 10             	add    $0x10,%esp
+ 2b2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2b5:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2b9:	7e 33                	jle    2ee <gets+0x5e>
+    buf[i++] = c;
+ 2bb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2be:	8d 50 01             	lea    0x1(%eax),%edx
+ 2c1:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2c4:	89 c2                	mov    %eax,%edx
+ 2c6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2c9:	01 c2                	add    %eax,%edx
+ 2cb:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2cf:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2d1:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2d5:	3c 0a                	cmp    $0xa,%al
+ 2d7:	74 16                	je     2ef <gets+0x5f>
+ 2d9:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2dd:	3c 0d                	cmp    $0xd,%al
+ 2df:	74 0e                	je     2ef <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2e4:	83 c0 01             	add    $0x1,%eax
+ 2e7:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 2ea:	7f b3                	jg     29f <gets+0xf>
+ 2ec:	eb 01                	jmp    2ef <gets+0x5f>
+      break;
+ 2ee:	90                   	nop
+  buf[i] = '\0';
+ 2ef:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 2f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f5:	01 d0                	add    %edx,%eax
+ 2f7:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 2fa:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2fd:	c9                   	leave
+ 2fe:	c3                   	ret
+
+000002ff <stat>:
+{
+ 2ff:	55                   	push   %ebp
+ 300:	89 e5                	mov    %esp,%ebp
+ 302:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 305:	83 ec 08             	sub    $0x8,%esp
+ 308:	6a 00                	push   $0x0
+ 30a:	ff 75 08             	push   0x8(%ebp)
+ 30d:	e8 ad 04 00 00       	call   7bf <open>
+ 312:	83 c4 10             	add    $0x10,%esp
+ 315:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 318:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 31c:	79 07                	jns    325 <stat+0x26>
+    return -1;
+ 31e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 323:	eb 25                	jmp    34a <stat+0x4b>
+  r = fstat(fd, st);
+ 325:	83 ec 08             	sub    $0x8,%esp
+ 328:	ff 75 0c             	push   0xc(%ebp)
+ 32b:	ff 75 f4             	push   -0xc(%ebp)
+ 32e:	e8 a1 04 00 00       	call   7d4 <fstat>
+ 333:	83 c4 10             	add    $0x10,%esp
+ 336:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 339:	83 ec 0c             	sub    $0xc,%esp
+ 33c:	ff 75 f4             	push   -0xc(%ebp)
+ 33f:	e8 66 04 00 00       	call   7aa <close>
+ 344:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 347:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 34a:	c9                   	leave
+ 34b:	c3                   	ret
+
+0000034c <atoi>:
+{
+ 34c:	55                   	push   %ebp
+ 34d:	89 e5                	mov    %esp,%ebp
+ 34f:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 352:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 359:	eb 25                	jmp    380 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 35b:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 35e:	89 d0                	mov    %edx,%eax
+ 360:	c1 e0 02             	shl    $0x2,%eax
+ 363:	01 d0                	add    %edx,%eax
+ 365:	01 c0                	add    %eax,%eax
+ 367:	89 c1                	mov    %eax,%ecx
+ 369:	8b 45 08             	mov    0x8(%ebp),%eax
+ 36c:	8d 50 01             	lea    0x1(%eax),%edx
+ 36f:	89 55 08             	mov    %edx,0x8(%ebp)
+ 372:	0f b6 00             	movzbl (%eax),%eax
+ 375:	0f be c0             	movsbl %al,%eax
+ 378:	01 c8                	add    %ecx,%eax
+ 37a:	83 e8 30             	sub    $0x30,%eax
+ 37d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 380:	8b 45 08             	mov    0x8(%ebp),%eax
+ 383:	0f b6 00             	movzbl (%eax),%eax
+ 386:	3c 2f                	cmp    $0x2f,%al
+ 388:	7e 0a                	jle    394 <atoi+0x48>
+ 38a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 38d:	0f b6 00             	movzbl (%eax),%eax
+ 390:	3c 39                	cmp    $0x39,%al
+ 392:	7e c7                	jle    35b <atoi+0xf>
+  return n;
+ 394:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 397:	c9                   	leave
+ 398:	c3                   	ret
+
+00000399 <memmove>:
+{
+ 399:	55                   	push   %ebp
+ 39a:	89 e5                	mov    %esp,%ebp
+ 39c:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 39f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3a5:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3a8:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3ab:	eb 17                	jmp    3c4 <memmove+0x2b>
+    *dst++ = *src++;
+ 3ad:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3b0:	8d 42 01             	lea    0x1(%edx),%eax
+ 3b3:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3b9:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3bc:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3bf:	0f b6 12             	movzbl (%edx),%edx
+ 3c2:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3c4:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3c7:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3ca:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3cd:	85 c0                	test   %eax,%eax
+ 3cf:	7f dc                	jg     3ad <memmove+0x14>
+  return vdst;
+ 3d1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3d4:	c9                   	leave
+ 3d5:	c3                   	ret
+
+000003d6 <mutex_init>:
+{
+ 3d6:	55                   	push   %ebp
+ 3d7:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3d9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3dc:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3e2:	90                   	nop
+ 3e3:	5d                   	pop    %ebp
+ 3e4:	c3                   	ret
+
+000003e5 <mutex_lock>:
+{
+ 3e5:	55                   	push   %ebp
+ 3e6:	89 e5                	mov    %esp,%ebp
+ 3e8:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 3eb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3ee:	6a 01                	push   $0x1
+ 3f0:	6a 00                	push   $0x0
+ 3f2:	50                   	push   %eax
+ 3f3:	e8 7d fd ff ff       	call   175 <cmpxchg>
+ 3f8:	83 c4 0c             	add    $0xc,%esp
+ 3fb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 3fe:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 402:	74 46                	je     44a <mutex_lock+0x65>
+  if(c != 2)
+ 404:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 408:	74 38                	je     442 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 40a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40d:	6a 02                	push   $0x2
+ 40f:	50                   	push   %eax
+ 410:	e8 46 fd ff ff       	call   15b <xchg>
+ 415:	83 c4 08             	add    $0x8,%esp
+ 418:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 41b:	eb 25                	jmp    442 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 41d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 420:	83 ec 08             	sub    $0x8,%esp
+ 423:	6a 02                	push   $0x2
+ 425:	50                   	push   %eax
+ 426:	e8 22 04 00 00       	call   84d <futex_wait>
+ 42b:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 42e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 431:	83 ec 08             	sub    $0x8,%esp
+ 434:	6a 02                	push   $0x2
+ 436:	50                   	push   %eax
+ 437:	e8 1f fd ff ff       	call   15b <xchg>
+ 43c:	83 c4 10             	add    $0x10,%esp
+ 43f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 442:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 446:	75 d5                	jne    41d <mutex_lock+0x38>
+ 448:	eb 01                	jmp    44b <mutex_lock+0x66>
+    return;
+ 44a:	90                   	nop
+}
+ 44b:	c9                   	leave
+ 44c:	c3                   	ret
+
+0000044d <mutex_unlock>:
+{
+ 44d:	55                   	push   %ebp
+ 44e:	89 e5                	mov    %esp,%ebp
+ 450:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 453:	8b 45 08             	mov    0x8(%ebp),%eax
+ 456:	6a 00                	push   $0x0
+ 458:	50                   	push   %eax
+ 459:	e8 fd fc ff ff       	call   15b <xchg>
+ 45e:	83 c4 08             	add    $0x8,%esp
+ 461:	83 f8 02             	cmp    $0x2,%eax
+ 464:	75 11                	jne    477 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 466:	8b 45 08             	mov    0x8(%ebp),%eax
+ 469:	83 ec 08             	sub    $0x8,%esp
+ 46c:	6a 01                	push   $0x1
+ 46e:	50                   	push   %eax
+ 46f:	e8 e3 03 00 00       	call   857 <futex_wake>
+ 474:	83 c4 10             	add    $0x10,%esp
+}
+ 477:	90                   	nop
+ 478:	c9                   	leave
+ 479:	c3                   	ret
+
+0000047a <cond_init>:
+{
+ 47a:	55                   	push   %ebp
+ 47b:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 47d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 480:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 486:	90                   	nop
+ 487:	5d                   	pop    %ebp
+ 488:	c3                   	ret
+
+00000489 <cond_wait>:
+{
+ 489:	55                   	push   %ebp
+ 48a:	89 e5                	mov    %esp,%ebp
+ 48c:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 48f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 492:	8b 00                	mov    (%eax),%eax
+ 494:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 497:	83 ec 0c             	sub    $0xc,%esp
+ 49a:	ff 75 0c             	push   0xc(%ebp)
+ 49d:	e8 ab ff ff ff       	call   44d <mutex_unlock>
+ 4a2:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 4a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a8:	83 ec 08             	sub    $0x8,%esp
+ 4ab:	ff 75 f4             	push   -0xc(%ebp)
+ 4ae:	50                   	push   %eax
+ 4af:	e8 99 03 00 00       	call   84d <futex_wait>
+ 4b4:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4b7:	eb 11                	jmp    4ca <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 4b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4bc:	83 ec 08             	sub    $0x8,%esp
+ 4bf:	6a 02                	push   $0x2
+ 4c1:	50                   	push   %eax
+ 4c2:	e8 86 03 00 00       	call   84d <futex_wait>
+ 4c7:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4ca:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4cd:	83 ec 08             	sub    $0x8,%esp
+ 4d0:	6a 02                	push   $0x2
+ 4d2:	50                   	push   %eax
+ 4d3:	e8 83 fc ff ff       	call   15b <xchg>
+ 4d8:	83 c4 10             	add    $0x10,%esp
+ 4db:	85 c0                	test   %eax,%eax
+ 4dd:	75 da                	jne    4b9 <cond_wait+0x30>
+}
+ 4df:	90                   	nop
+ 4e0:	90                   	nop
+ 4e1:	c9                   	leave
+ 4e2:	c3                   	ret
+
+000004e3 <condbump>:
+{
+ 4e3:	55                   	push   %ebp
+ 4e4:	89 e5                	mov    %esp,%ebp
+ 4e6:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 4e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4ec:	8b 00                	mov    (%eax),%eax
+ 4ee:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 4f1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 4f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 4f7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4fa:	52                   	push   %edx
+ 4fb:	ff 75 fc             	push   -0x4(%ebp)
+ 4fe:	50                   	push   %eax
+ 4ff:	e8 71 fc ff ff       	call   175 <cmpxchg>
+ 504:	83 c4 0c             	add    $0xc,%esp
+ 507:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 50a:	75 dd                	jne    4e9 <condbump+0x6>
+}
+ 50c:	90                   	nop
+ 50d:	90                   	nop
+ 50e:	c9                   	leave
+ 50f:	c3                   	ret
+
+00000510 <cond_signal>:
+{
+ 510:	55                   	push   %ebp
+ 511:	89 e5                	mov    %esp,%ebp
+ 513:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 516:	ff 75 08             	push   0x8(%ebp)
+ 519:	e8 c5 ff ff ff       	call   4e3 <condbump>
+ 51e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 521:	8b 45 08             	mov    0x8(%ebp),%eax
+ 524:	83 ec 08             	sub    $0x8,%esp
+ 527:	6a 01                	push   $0x1
+ 529:	50                   	push   %eax
+ 52a:	e8 28 03 00 00       	call   857 <futex_wake>
+ 52f:	83 c4 10             	add    $0x10,%esp
+}
+ 532:	90                   	nop
+ 533:	c9                   	leave
+ 534:	c3                   	ret
+
+00000535 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 535:	55                   	push   %ebp
+ 536:	89 e5                	mov    %esp,%ebp
+ 538:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 53b:	ff 75 08             	push   0x8(%ebp)
+ 53e:	e8 a0 ff ff ff       	call   4e3 <condbump>
+ 543:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 546:	8b 45 08             	mov    0x8(%ebp),%eax
+ 549:	83 ec 08             	sub    $0x8,%esp
+ 54c:	68 ff ff ff 7f       	push   $0x7fffffff
+ 551:	50                   	push   %eax
+ 552:	e8 00 03 00 00       	call   857 <futex_wake>
+ 557:	83 c4 10             	add    $0x10,%esp
+}
+ 55a:	90                   	nop
+ 55b:	c9                   	leave
+ 55c:	c3                   	ret
+
+0000055d <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 55d:	55                   	push   %ebp
+ 55e:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 560:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 565:	8b 00                	mov    (%eax),%eax
+}
+ 567:	5d                   	pop    %ebp
+ 568:	c3                   	ret
+
+00000569 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 569:	55                   	push   %ebp
+ 56a:	89 e5                	mov    %esp,%ebp
+ 56c:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 56f:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 574:	8b 00                	mov    (%eax),%eax
+ 576:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 579:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 57d:	74 05                	je     584 <vgetpid+0x1b>
+    return pid;
+ 57f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 582:	eb 05                	jmp    589 <vgetpid+0x20>
+  return getpid();
+ 584:	e8 74 02 00 00       	call   7fd <getpid>
+}
+ 589:	c9                   	leave
+ 58a:	c3                   	ret
+
+0000058b <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 58b:	55                   	push   %ebp
+ 58c:	89 e5                	mov    %esp,%ebp
+ 58e:	57                   	push   %edi
+ 58f:	56                   	push   %esi
+ 590:	53                   	push   %ebx
+ 591:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 594:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 59b:	e8 f7 fb ff ff       	call   197 <rdtsc>
+ 5a0:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 5a3:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 5a6:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 5a9:	29 c8                	sub    %ecx,%eax
+ 5ab:	19 da                	sbb    %ebx,%edx
+ 5ad:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5b0:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 5b3:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5b6:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5b9:	89 d0                	mov    %edx,%eax
+ 5bb:	31 d2                	xor    %edx,%edx
+ 5bd:	89 c1                	mov    %eax,%ecx
+ 5bf:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5c4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5c7:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ca:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5cf:	89 df                	mov    %ebx,%edi
+ 5d1:	0f af f8             	imul   %eax,%edi
+ 5d4:	89 d6                	mov    %edx,%esi
+ 5d6:	0f af f1             	imul   %ecx,%esi
+ 5d9:	01 f7                	add    %esi,%edi
+ 5db:	f7 e1                	mul    %ecx
+ 5dd:	89 c1                	mov    %eax,%ecx
+ 5df:	89 d3                	mov    %edx,%ebx
+ 5e1:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 5e4:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 5e6:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5e9:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5ec:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 5ef:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 5f6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5f9:	8b 40 04             	mov    0x4(%eax),%eax
+ 5fc:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 5ff:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 606:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 609:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 60c:	89 d7                	mov    %edx,%edi
+ 60e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 611:	0f af fe             	imul   %esi,%edi
+ 614:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 617:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 61a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 61d:	0f af f0             	imul   %eax,%esi
+ 620:	01 f7                	add    %esi,%edi
+ 622:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 625:	f7 65 d8             	mull   -0x28(%ebp)
+ 628:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 62b:	89 f2                	mov    %esi,%edx
+ 62d:	89 d0                	mov    %edx,%eax
+ 62f:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 631:	01 c8                	add    %ecx,%eax
+ 633:	11 da                	adc    %ebx,%edx
+}
+ 635:	83 c4 24             	add    $0x24,%esp
+ 638:	5b                   	pop    %ebx
+ 639:	5e                   	pop    %esi
+ 63a:	5f                   	pop    %edi
+ 63b:	5d                   	pop    %ebp
+ 63c:	c3                   	ret
+
+0000063d <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 63d:	55                   	push   %ebp
+ 63e:	89 e5                	mov    %esp,%ebp
+ 640:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 643:	8b 45 08             	mov    0x8(%ebp),%eax
+ 646:	8b 50 04             	mov    0x4(%eax),%edx
+ 649:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64c:	8b 00                	mov    (%eax),%eax
+ 64e:	29 c2                	sub    %eax,%edx
+ 650:	83 fa 1f             	cmp    $0x1f,%edx
+ 653:	76 07                	jbe    65c <ring_queue+0x1f>
+    return -1;
+ 655:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 65a:	eb 68                	jmp    6c4 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 65c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 65f:	8b 40 04             	mov    0x4(%eax),%eax
+ 662:	83 e0 1f             	and    $0x1f,%eax
+ 665:	89 c2                	mov    %eax,%edx
+ 667:	89 d0                	mov    %edx,%eax
+ 669:	c1 e0 02             	shl    $0x2,%eax
+ 66c:	01 d0                	add    %edx,%eax
+ 66e:	c1 e0 02             	shl    $0x2,%eax
+ 671:	8d 50 10             	lea    0x10(%eax),%edx
+ 674:	8b 45 08             	mov    0x8(%ebp),%eax
+ 677:	01 d0                	add    %edx,%eax
+ 679:	83 c0 04             	add    $0x4,%eax
+ 67c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 67f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 682:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 685:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 687:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 68a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 68d:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 690:	8b 55 14             	mov    0x14(%ebp),%edx
+ 693:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 696:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 699:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69c:	8b 55 18             	mov    0x18(%ebp),%edx
+ 69f:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 6a2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a5:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 6a8:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 6ab:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 6b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6b3:	8b 40 04             	mov    0x4(%eax),%eax
+ 6b6:	8d 50 01             	lea    0x1(%eax),%edx
+ 6b9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6bc:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 6bf:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6c4:	c9                   	leave
+ 6c5:	c3                   	ret
+
+000006c6 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 6c6:	55                   	push   %ebp
+ 6c7:	89 e5                	mov    %esp,%ebp
+ 6c9:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 6cc:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 6d1:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6d5:	7f 1a                	jg     6f1 <ring_submit+0x2b>
+ 6d7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6da:	8b 40 10             	mov    0x10(%eax),%eax
+ 6dd:	83 e0 01             	and    $0x1,%eax
+ 6e0:	85 c0                	test   %eax,%eax
+ 6e2:	74 0d                	je     6f1 <ring_submit+0x2b>
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	8b 40 10             	mov    0x10(%eax),%eax
+ 6ea:	83 e0 02             	and    $0x2,%eax
+ 6ed:	85 c0                	test   %eax,%eax
+ 6ef:	74 10                	je     701 <ring_submit+0x3b>
+    return ring_enter(min);
+ 6f1:	83 ec 0c             	sub    $0xc,%esp
+ 6f4:	ff 75 0c             	push   0xc(%ebp)
+ 6f7:	e8 83 01 00 00       	call   87f <ring_enter>
+ 6fc:	83 c4 10             	add    $0x10,%esp
+ 6ff:	eb 10                	jmp    711 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 701:	8b 45 08             	mov    0x8(%ebp),%eax
+ 704:	8b 50 0c             	mov    0xc(%eax),%edx
+ 707:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70a:	8b 40 08             	mov    0x8(%eax),%eax
+ 70d:	29 c2                	sub    %eax,%edx
+ 70f:	89 d0                	mov    %edx,%eax
+}
+ 711:	c9                   	leave
+ 712:	c3                   	ret
+
+00000713 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 713:	55                   	push   %ebp
+ 714:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 716:	8b 45 08             	mov    0x8(%ebp),%eax
+ 719:	8b 50 08             	mov    0x8(%eax),%edx
+ 71c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 71f:	8b 40 0c             	mov    0xc(%eax),%eax
+ 722:	39 c2                	cmp    %eax,%edx
+ 724:	75 07                	jne    72d <ring_reap+0x1a>
+    return -1;
+ 726:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 72b:	eb 3b                	jmp    768 <ring_reap+0x55>
+  __sync_synchronize();
+ 72d:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 732:	8b 45 08             	mov    0x8(%ebp),%eax
+ 735:	8b 40 08             	mov    0x8(%eax),%eax
+ 738:	83 e0 1f             	and    $0x1f,%eax
+ 73b:	89 c2                	mov    %eax,%edx
+ 73d:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 740:	8b 45 08             	mov    0x8(%ebp),%eax
+ 743:	83 c2 52             	add    $0x52,%edx
+ 746:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 74a:	8b 02                	mov    (%edx),%eax
+ 74c:	8b 52 04             	mov    0x4(%edx),%edx
+ 74f:	89 01                	mov    %eax,(%ecx)
+ 751:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 754:	8b 45 08             	mov    0x8(%ebp),%eax
+ 757:	8b 40 08             	mov    0x8(%eax),%eax
+ 75a:	8d 50 01             	lea    0x1(%eax),%edx
+ 75d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 760:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 763:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 768:	5d                   	pop    %ebp
+ 769:	c3                   	ret
+
+0000076a <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 76a:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 771:	74 0a                	je     77d <usyscall+0x13>
+  movl %esp, %ecx
+ 773:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 775:	ba 7c 07 00 00       	mov    $0x77c,%edx
+  sysenter
+ 77a:	0f 34                	sysenter
+2:
+  ret
+ 77c:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 77d:	cd 40                	int    $0x40
+  ret
+ 77f:	c3                   	ret
+
+00000780 <fork>:
+
+SYSCALL(fork)
+ 780:	b8 01 00 00 00       	mov    $0x1,%eax
+ 785:	eb e3                	jmp    76a <usyscall>
+
+00000787 <exit>:
+SYSCALL(exit)
+ 787:	b8 02 00 00 00       	mov    $0x2,%eax
+ 78c:	eb dc                	jmp    76a <usyscall>
+
+0000078e <wait>:
+SYSCALL(wait)
+ 78e:	b8 03 00 00 00       	mov    $0x3,%eax
+ 793:	eb d5                	jmp    76a <usyscall>
+
+00000795 <pipe>:
+SYSCALL(pipe)
+ 795:	b8 04 00 00 00       	mov    $0x4,%eax
+ 79a:	eb ce                	jmp    76a <usyscall>
+
+0000079c <read>:
+SYSCALL(read)
+ 79c:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7a1:	eb c7                	jmp    76a <usyscall>
+
+000007a3 <write>:
+SYSCALL(write)
+ 7a3:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7a8:	eb c0                	jmp    76a <usyscall>
+
+000007aa <close>:
+SYSCALL(close)
+ 7aa:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7af:	eb b9                	jmp    76a <usyscall>
+
+000007b1 <kill>:
+SYSCALL(kill)
+ 7b1:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7b6:	eb b2                	jmp    76a <usyscall>
+
+000007b8 <exec>:
+SYSCALL(exec)
+ 7b8:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7bd:	eb ab                	jmp    76a <usyscall>
+
+000007bf <open>:
+SYSCALL(open)
+ 7bf:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7c4:	eb a4                	jmp    76a <usyscall>
+
+000007c6 <mknod>:
+SYSCALL(mknod)
+ 7c6:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7cb:	eb 9d                	jmp    76a <usyscall>
+
+000007cd <unlink>:
+SYSCALL(unlink)
+ 7cd:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7d2:	eb 96                	jmp    76a <usyscall>
+
+000007d4 <fstat>:
+SYSCALL(fstat)
+ 7d4:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7d9:	eb 8f                	jmp    76a <usyscall>
+
+000007db <link>:
+SYSCALL(link)
+ 7db:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7e0:	eb 88                	jmp    76a <usyscall>
+
+000007e2 <mkdir>:
+SYSCALL(mkdir)
+ 7e2:	b8 14 00 00 00       	mov    $0x14,%eax
+ 7e7:	eb 81                	jmp    76a <usyscall>
+
+000007e9 <chdir>:
+SYSCALL(chdir)
+ 7e9:	b8 09 00 00 00       	mov    $0x9,%eax
+ 7ee:	e9 77 ff ff ff       	jmp    76a <usyscall>
+
+000007f3 <dup>:
+SYSCALL(dup)
+ 7f3:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 7f8:	e9 6d ff ff ff       	jmp    76a <usyscall>
+
+000007fd <getpid>:
+SYSCALL(getpid)
+ 7fd:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 802:	e9 63 ff ff ff       	jmp    76a <usyscall>
+
+00000807 <sbrk>:
+SYSCALL(sbrk)
+ 807:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 80c:	e9 59 ff ff ff       	jmp    76a <usyscall>
+
+00000811 <sleep>:
+SYSCALL(sleep)
+ 811:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 816:	e9 4f ff ff ff       	jmp    76a <usyscall>
+
+0000081b <uptime>:
+SYSCALL(uptime)
+ 81b:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 820:	e9 45 ff ff ff       	jmp    76a <usyscall>
+
+00000825 <kmstat>:
+SYSCALL(kmstat)
+ 825:	b8 16 00 00 00       	mov    $0x16,%eax
+ 82a:	e9 3b ff ff ff       	jmp    76a <usyscall>
+
+0000082f <setpriority>:
+SYSCALL(setpriority)
+ 82f:	b8 17 00 00 00       	mov    $0x17,%eax
+ 834:	e9 31 ff ff ff       	jmp    76a <usyscall>
+
+00000839 <clone>:
+SYSCALL(clone)
+ 839:	b8 18 00 00 00       	mov    $0x18,%eax
+ 83e:	e9 27 ff ff ff       	jmp    76a <usyscall>
+
+00000843 <join>:
+SYSCALL(join)
+ 843:	b8 19 00 00 00       	mov    $0x19,%eax
+ 848:	e9 1d ff ff ff       	jmp    76a <usyscall>
+
+0000084d <futex_wait>:
+SYSCALL(futex_wait)
+ 84d:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 852:	e9 13 ff ff ff       	jmp    76a <usyscall>
+
+00000857 <futex_wake>:
+SYSCALL(futex_wake)
+ 857:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 85c:	e9 09 ff ff ff       	jmp    76a <usyscall>
+
+00000861 <lockstat>:
+SYSCALL(lockstat)
+ 861:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 866:	e9 ff fe ff ff       	jmp    76a <usyscall>
+
+0000086b <sysstat>:
+SYSCALL(sysstat)
+ 86b:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 870:	e9 f5 fe ff ff       	jmp    76a <usyscall>
+
+00000875 <ring_setup>:
+SYSCALL(ring_setup)
+ 875:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 87a:	e9 eb fe ff ff       	jmp    76a <usyscall>
+
+0000087f <ring_enter>:
+SYSCALL(ring_enter)
+ 87f:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 884:	e9 e1 fe ff ff       	jmp    76a <usyscall>
+
+00000889 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 889:	55                   	push   %ebp
+ 88a:	89 e5                	mov    %esp,%ebp
+ 88c:	83 ec 18             	sub    $0x18,%esp
+ 88f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 892:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 895:	83 ec 04             	sub    $0x4,%esp
+ 898:	6a 01                	push   $0x1
+ 89a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 89d:	50                   	push   %eax
+ 89e:	ff 75 08             	push   0x8(%ebp)
+ 8a1:	e8 fd fe ff ff       	call   7a3 <write>
+ 8a6:	83 c4 10             	add    $0x10,%esp
+}
+ 8a9:	90                   	nop
+ 8aa:	c9                   	leave
+ 8ab:	c3                   	ret
+
+000008ac <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8ac:	55                   	push   %ebp
+ 8ad:	89 e5                	mov    %esp,%ebp
+ 8af:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8b2:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8b9:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8bd:	74 17                	je     8d6 <printint+0x2a>
+ 8bf:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8c3:	79 11                	jns    8d6 <printint+0x2a>
+    neg = 1;
+ 8c5:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8cc:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8cf:	f7 d8                	neg    %eax
+ 8d1:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8d4:	eb 06                	jmp    8dc <printint+0x30>
+  } else {
+    x = xx;
+ 8d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8d9:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8dc:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 8e3:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 8e6:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 8e9:	ba 00 00 00 00       	mov    $0x0,%edx
+ 8ee:	f7 f1                	div    %ecx
+ 8f0:	89 d1                	mov    %edx,%ecx
+ 8f2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 8f5:	8d 50 01             	lea    0x1(%eax),%edx
+ 8f8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 8fb:	0f b6 91 c4 12 00 00 	movzbl 0x12c4(%ecx),%edx
+ 902:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 906:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 909:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 90c:	ba 00 00 00 00       	mov    $0x0,%edx
+ 911:	f7 f1                	div    %ecx
+ 913:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 916:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 91a:	75 c7                	jne    8e3 <printint+0x37>
+  if(neg)
+ 91c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 920:	74 2d                	je     94f <printint+0xa3>
+    buf[i++] = '-';
+ 922:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 925:	8d 50 01             	lea    0x1(%eax),%edx
+ 928:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 92b:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 930:	eb 1d                	jmp    94f <printint+0xa3>
+    putc(fd, buf[i]);
+ 932:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 935:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 938:	01 d0                	add    %edx,%eax
+ 93a:	0f b6 00             	movzbl (%eax),%eax
+ 93d:	0f be c0             	movsbl %al,%eax
+ 940:	83 ec 08             	sub    $0x8,%esp
+ 943:	50                   	push   %eax
+ 944:	ff 75 08             	push   0x8(%ebp)
+ 947:	e8 3d ff ff ff       	call   889 <putc>
+ 94c:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 94f:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 953:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 957:	79 d9                	jns    932 <printint+0x86>
+}
+ 959:	90                   	nop
+ 95a:	90                   	nop
+ 95b:	c9                   	leave
+ 95c:	c3                   	ret
+
+0000095d <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 95d:	55                   	push   %ebp
+ 95e:	89 e5                	mov    %esp,%ebp
+ 960:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 963:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 96a:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 96d:	83 c0 04             	add    $0x4,%eax
+ 970:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 973:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 97a:	e9 59 01 00 00       	jmp    ad8 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 97f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 982:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 985:	01 d0                	add    %edx,%eax
+ 987:	0f b6 00             	movzbl (%eax),%eax
+ 98a:	0f be c0             	movsbl %al,%eax
+ 98d:	25 ff 00 00 00       	and    $0xff,%eax
+ 992:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 995:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 999:	75 2c                	jne    9c7 <printf+0x6a>
+      if(c == '%'){
+ 99b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 99f:	75 0c                	jne    9ad <printf+0x50>
+        state = '%';
+ 9a1:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9a8:	e9 27 01 00 00       	jmp    ad4 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 9ad:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9b0:	0f be c0             	movsbl %al,%eax
+ 9b3:	83 ec 08             	sub    $0x8,%esp
+ 9b6:	50                   	push   %eax
+ 9b7:	ff 75 08             	push   0x8(%ebp)
+ 9ba:	e8 ca fe ff ff       	call   889 <putc>
+ 9bf:	83 c4 10             	add    $0x10,%esp
+ 9c2:	e9 0d 01 00 00       	jmp    ad4 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 9c7:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9cb:	0f 85 03 01 00 00    	jne    ad4 <printf+0x177>
+      if(c == 'd'){
+ 9d1:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9d5:	75 1e                	jne    9f5 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9d7:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9da:	8b 00                	mov    (%eax),%eax
+ 9dc:	6a 01                	push   $0x1
+ 9de:	6a 0a                	push   $0xa
+ 9e0:	50                   	push   %eax
+ 9e1:	ff 75 08             	push   0x8(%ebp)
+ 9e4:	e8 c3 fe ff ff       	call   8ac <printint>
+ 9e9:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 9ec:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 9f0:	e9 d8 00 00 00       	jmp    acd <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 9f5:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 9f9:	74 06                	je     a01 <printf+0xa4>
+ 9fb:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 9ff:	75 1e                	jne    a1f <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a01:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a04:	8b 00                	mov    (%eax),%eax
+ a06:	6a 00                	push   $0x0
+ a08:	6a 10                	push   $0x10
+ a0a:	50                   	push   %eax
+ a0b:	ff 75 08             	push   0x8(%ebp)
+ a0e:	e8 99 fe ff ff       	call   8ac <printint>
+ a13:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a16:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a1a:	e9 ae 00 00 00       	jmp    acd <printf+0x170>
+      } else if(c == 's'){
+ a1f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a23:	75 43                	jne    a68 <printf+0x10b>
+        s = (char*)*ap;
+ a25:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a28:	8b 00                	mov    (%eax),%eax
+ a2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a2d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a31:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a35:	75 25                	jne    a5c <printf+0xff>
+          s = "(null)";
+ a37:	c7 45 f4 e5 0d 00 00 	movl   $0xde5,-0xc(%ebp)
+        while(*s != 0){
+ a3e:	eb 1c                	jmp    a5c <printf+0xff>
+          putc(fd, *s);
+ a40:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a43:	0f b6 00             	movzbl (%eax),%eax
+ a46:	0f be c0             	movsbl %al,%eax
+ a49:	83 ec 08             	sub    $0x8,%esp
+ a4c:	50                   	push   %eax
+ a4d:	ff 75 08             	push   0x8(%ebp)
+ a50:	e8 34 fe ff ff       	call   889 <putc>
+ a55:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a58:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a5f:	0f b6 00             	movzbl (%eax),%eax
+ a62:	84 c0                	test   %al,%al
+ a64:	75 da                	jne    a40 <printf+0xe3>
+ a66:	eb 65                	jmp    acd <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a68:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a6c:	75 1d                	jne    a8b <printf+0x12e>
+        putc(fd, *ap);
+ a6e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a71:	8b 00                	mov    (%eax),%eax
+ a73:	0f be c0             	movsbl %al,%eax
+ a76:	83 ec 08             	sub    $0x8,%esp
+ a79:	50                   	push   %eax
+ a7a:	ff 75 08             	push   0x8(%ebp)
+ a7d:	e8 07 fe ff ff       	call   889 <putc>
+ a82:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a85:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a89:	eb 42                	jmp    acd <printf+0x170>
+      } else if(c == '%'){
+ a8b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a8f:	75 17                	jne    aa8 <printf+0x14b>
+        putc(fd, c);
+ a91:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a94:	0f be c0             	movsbl %al,%eax
+ a97:	83 ec 08             	sub    $0x8,%esp
+ a9a:	50                   	push   %eax
+ a9b:	ff 75 08             	push   0x8(%ebp)
+ a9e:	e8 e6 fd ff ff       	call   889 <putc>
+ aa3:	83 c4 10             	add    $0x10,%esp
+ aa6:	eb 25                	jmp    acd <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ aa8:	83 ec 08             	sub    $0x8,%esp
+ aab:	6a 25                	push   $0x25
+ aad:	ff 75 08             	push   0x8(%ebp)
+ ab0:	e8 d4 fd ff ff       	call   889 <putc>
+ ab5:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ ab8:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ abb:	0f be c0             	movsbl %al,%eax
+ abe:	83 ec 08             	sub    $0x8,%esp
+ ac1:	50                   	push   %eax
+ ac2:	ff 75 08             	push   0x8(%ebp)
+ ac5:	e8 bf fd ff ff       	call   889 <putc>
+ aca:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ acd:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ ad4:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ ad8:	8b 55 0c             	mov    0xc(%ebp),%edx
+ adb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ade:	01 d0                	add    %edx,%eax
+ ae0:	0f b6 00             	movzbl (%eax),%eax
+ ae3:	84 c0                	test   %al,%al
+ ae5:	0f 85 94 fe ff ff    	jne    97f <printf+0x22>
+    }
+  }
+}
+ aeb:	90                   	nop
+ aec:	90                   	nop
+ aed:	c9                   	leave
+ aee:	c3                   	ret
+
+00000aef <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ aef:	55                   	push   %ebp
+ af0:	89 e5                	mov    %esp,%ebp
+ af2:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ af5:	8b 45 08             	mov    0x8(%ebp),%eax
+ af8:	83 e8 08             	sub    $0x8,%eax
+ afb:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ afe:	a1 e4 12 00 00       	mov    0x12e4,%eax
+ b03:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b06:	eb 24                	jmp    b2c <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b08:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b0b:	8b 00                	mov    (%eax),%eax
+ b0d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b10:	72 12                	jb     b24 <free+0x35>
+ b12:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b15:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b18:	72 24                	jb     b3e <free+0x4f>
+ b1a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b1d:	8b 00                	mov    (%eax),%eax
+ b1f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b22:	72 1a                	jb     b3e <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b24:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b27:	8b 00                	mov    (%eax),%eax
+ b29:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b2c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b2f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b32:	73 d4                	jae    b08 <free+0x19>
+ b34:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b37:	8b 00                	mov    (%eax),%eax
+ b39:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b3c:	73 ca                	jae    b08 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b3e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b41:	8b 40 04             	mov    0x4(%eax),%eax
+ b44:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b4b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4e:	01 c2                	add    %eax,%edx
+ b50:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b53:	8b 00                	mov    (%eax),%eax
+ b55:	39 c2                	cmp    %eax,%edx
+ b57:	75 24                	jne    b7d <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b59:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5c:	8b 50 04             	mov    0x4(%eax),%edx
+ b5f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b62:	8b 00                	mov    (%eax),%eax
+ b64:	8b 40 04             	mov    0x4(%eax),%eax
+ b67:	01 c2                	add    %eax,%edx
+ b69:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b6c:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b6f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b72:	8b 00                	mov    (%eax),%eax
+ b74:	8b 10                	mov    (%eax),%edx
+ b76:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b79:	89 10                	mov    %edx,(%eax)
+ b7b:	eb 0a                	jmp    b87 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b7d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b80:	8b 10                	mov    (%eax),%edx
+ b82:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b85:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ b87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8a:	8b 40 04             	mov    0x4(%eax),%eax
+ b8d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b94:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b97:	01 d0                	add    %edx,%eax
+ b99:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b9c:	75 20                	jne    bbe <free+0xcf>
+    p->s.size += bp->s.size;
+ b9e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba1:	8b 50 04             	mov    0x4(%eax),%edx
+ ba4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba7:	8b 40 04             	mov    0x4(%eax),%eax
+ baa:	01 c2                	add    %eax,%edx
+ bac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ baf:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bb2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb5:	8b 10                	mov    (%eax),%edx
+ bb7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bba:	89 10                	mov    %edx,(%eax)
+ bbc:	eb 08                	jmp    bc6 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ bbe:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc1:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ bc4:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ bc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc9:	a3 e4 12 00 00       	mov    %eax,0x12e4
+}
+ bce:	90                   	nop
+ bcf:	c9                   	leave
+ bd0:	c3                   	ret
+
+00000bd1 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ bd1:	55                   	push   %ebp
+ bd2:	89 e5                	mov    %esp,%ebp
+ bd4:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ bd7:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bde:	77 07                	ja     be7 <morecore+0x16>
+    nu = 4096;
+ be0:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ be7:	8b 45 08             	mov    0x8(%ebp),%eax
+ bea:	c1 e0 03             	shl    $0x3,%eax
+ bed:	83 ec 0c             	sub    $0xc,%esp
+ bf0:	50                   	push   %eax
+ bf1:	e8 11 fc ff ff       	call   807 <sbrk>
+ bf6:	83 c4 10             	add    $0x10,%esp
+ bf9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ bfc:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c00:	75 07                	jne    c09 <morecore+0x38>
+    return 0;
+ c02:	b8 00 00 00 00       	mov    $0x0,%eax
+ c07:	eb 26                	jmp    c2f <morecore+0x5e>
+  hp = (Header*)p;
+ c09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c0c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c12:	8b 55 08             	mov    0x8(%ebp),%edx
+ c15:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c18:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c1b:	83 c0 08             	add    $0x8,%eax
+ c1e:	83 ec 0c             	sub    $0xc,%esp
+ c21:	50                   	push   %eax
+ c22:	e8 c8 fe ff ff       	call   aef <free>
+ c27:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c2a:	a1 e4 12 00 00       	mov    0x12e4,%eax
+}
+ c2f:	c9                   	leave
+ c30:	c3                   	ret
+
+00000c31 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c31:	55                   	push   %ebp
+ c32:	89 e5                	mov    %esp,%ebp
+ c34:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c37:	8b 45 08             	mov    0x8(%ebp),%eax
+ c3a:	83 c0 07             	add    $0x7,%eax
+ c3d:	c1 e8 03             	shr    $0x3,%eax
+ c40:	83 c0 01             	add    $0x1,%eax
+ c43:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c46:	a1 e4 12 00 00       	mov    0x12e4,%eax
+ c4b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c4e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c52:	75 23                	jne    c77 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c54:	c7 45 f0 dc 12 00 00 	movl   $0x12dc,-0x10(%ebp)
+ c5b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c5e:	a3 e4 12 00 00       	mov    %eax,0x12e4
+ c63:	a1 e4 12 00 00       	mov    0x12e4,%eax
+ c68:	a3 dc 12 00 00       	mov    %eax,0x12dc
+    base.s.size = 0;
+ c6d:	c7 05 e0 12 00 00 00 	movl   $0x0,0x12e0
+ c74:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c77:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c7a:	8b 00                	mov    (%eax),%eax
+ c7c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c7f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c82:	8b 40 04             	mov    0x4(%eax),%eax
+ c85:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ c88:	72 4d                	jb     cd7 <malloc+0xa6>
+      if(p->s.size == nunits)
+ c8a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c8d:	8b 40 04             	mov    0x4(%eax),%eax
+ c90:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ c93:	75 0c                	jne    ca1 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ c95:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c98:	8b 10                	mov    (%eax),%edx
+ c9a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c9d:	89 10                	mov    %edx,(%eax)
+ c9f:	eb 26                	jmp    cc7 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ ca1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ca4:	8b 40 04             	mov    0x4(%eax),%eax
+ ca7:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ caa:	89 c2                	mov    %eax,%edx
+ cac:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ caf:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ cb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb5:	8b 40 04             	mov    0x4(%eax),%eax
+ cb8:	c1 e0 03             	shl    $0x3,%eax
+ cbb:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc1:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ cc4:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ cc7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cca:	a3 e4 12 00 00       	mov    %eax,0x12e4
+      return (void*)(p + 1);
+ ccf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd2:	83 c0 08             	add    $0x8,%eax
+ cd5:	eb 3b                	jmp    d12 <malloc+0xe1>
+    }
+    if(p == freep)
+ cd7:	a1 e4 12 00 00       	mov    0x12e4,%eax
+ cdc:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cdf:	75 1e                	jne    cff <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ ce1:	83 ec 0c             	sub    $0xc,%esp
+ ce4:	ff 75 ec             	push   -0x14(%ebp)
+ ce7:	e8 e5 fe ff ff       	call   bd1 <morecore>
+ cec:	83 c4 10             	add    $0x10,%esp
+ cef:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ cf2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ cf6:	75 07                	jne    cff <malloc+0xce>
+        return 0;
+ cf8:	b8 00 00 00 00       	mov    $0x0,%eax
+ cfd:	eb 13                	jmp    d12 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d02:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d08:	8b 00                	mov    (%eax),%eax
+ d0a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d0d:	e9 6d ff ff ff       	jmp    c7f <malloc+0x4e>
+  }
+}
+ d12:	c9                   	leave
+ d13:	c3                   	ret
+
+00000d14 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d14:	55                   	push   %ebp
+ d15:	89 e5                	mov    %esp,%ebp
+ d17:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ d1a:	83 ec 0c             	sub    $0xc,%esp
+ d1d:	68 00 10 00 00       	push   $0x1000
+ d22:	e8 0a ff ff ff       	call   c31 <malloc>
+ d27:	83 c4 10             	add    $0x10,%esp
+ d2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d2d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d31:	75 07                	jne    d3a <thread_create+0x26>
+    return -1;
+ d33:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d38:	eb 2e                	jmp    d68 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d3a:	83 ec 04             	sub    $0x4,%esp
+ d3d:	ff 75 f4             	push   -0xc(%ebp)
+ d40:	ff 75 0c             	push   0xc(%ebp)
+ d43:	ff 75 08             	push   0x8(%ebp)
+ d46:	e8 ee fa ff ff       	call   839 <clone>
+ d4b:	83 c4 10             	add    $0x10,%esp
+ d4e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d51:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d55:	79 0e                	jns    d65 <thread_create+0x51>
+    free(stack);
+ d57:	83 ec 0c             	sub    $0xc,%esp
+ d5a:	ff 75 f4             	push   -0xc(%ebp)
+ d5d:	e8 8d fd ff ff       	call   aef <free>
+ d62:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d65:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ d68:	c9                   	leave
+ d69:	c3                   	ret
+
+00000d6a <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ d6a:	55                   	push   %ebp
+ d6b:	89 e5                	mov    %esp,%ebp
+ d6d:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d70:	83 ec 0c             	sub    $0xc,%esp
+ d73:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ d76:	50                   	push   %eax
+ d77:	e8 c7 fa ff ff       	call   843 <join>
+ d7c:	83 c4 10             	add    $0x10,%esp
+ d7f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d82:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d86:	78 0f                	js     d97 <thread_join+0x2d>
+    free(stack);
+ d88:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d8b:	83 ec 0c             	sub    $0xc,%esp
+ d8e:	50                   	push   %eax
+ d8f:	e8 5b fd ff ff       	call   aef <free>
+ d94:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d97:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ d9a:	c9                   	leave
+ d9b:	c3                   	ret
@@ -0,0 +1,55 @@
+// Scheduler throughput benchmark: fork N processes that each
+// do the same fixed amount of CPU-bound work, and report how
+// long they take together.  Run with make qemu CPUS=1..8; with
+// per-CPU run queues the time should fall about linearly with
+// the number of CPUs, as long as N is at least that many.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+
+volatile uint sink;
+
+void
+work(int iters)
+{
+  uint i, x;
+
+  x = 1;
+  for(i = 0; i < iters; i++)
+    x = x * 1103515245 + 12345;
+  sink = x;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int nproc, iters, i;
+  uint t0, t1;
+
+  nproc = 8;
+  iters = 50000000;
+  if(argc > 1)
+    nproc = atoi(argv[1]);
+  if(argc > 2)
+    iters = atoi(argv[2]);
+
+  t0 = uptime();
+  for(i = 0; i < nproc; i++){
+    switch(fork()){
+    case -1:
+      printf(2, "schedbench: fork failed\n");
+      exit();
+    case 0:
+      work(iters);
+      exit();
+    }
+  }
+  for(i = 0; i < nproc; i++)
+    wait();
+  t1 = uptime();
+
+  printf(1, "schedbench: %d procs x %d iters in %d ticks\n",
+         nproc, iters, t1 - t0);
+  exit();
+}
@@ -0,0 +1,291 @@
+// Slab allocator for small kernel objects.
+//
+// Each cache hands out objects of one size, carved out of whole
+// pages from kalloc() ("slabs").  A slab keeps its header at the
+// start of its page, so kmfree() finds the owning cache from the
+// object's address alone.  Each CPU keeps a magazine of free
+// objects per cache, so the common kmcachealloc() and kmfree()
+// take no lock; a magazine refills from, and flushes to, the
+// slabs half a magazine at a time under the cache's lock.
+//
+// kmalloc() serves arbitrary sizes from a set of power-of-two
+// caches; subsystems with many objects of one type create a
+// named cache of their own with kmcreate().
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "kmstat.h"
+
+#define NKMCACHE 16    // maximum number of caches
+#define KMMAG    16    // objects per per-CPU magazine
+#define KMMIN    16    // smallest kmalloc() size class
+#define KMMAX    2048  // largest kmalloc() size class
+
+struct kmobj {
+  struct kmobj *next;
+};
+
+struct slab {
+  struct kmcache *cache;
+  struct slab *next;      // on cache's partial list
+  struct slab *prev;
+  struct kmobj *free;     // free objects in this slab
+  uint inuse;             // objects handed out (incl. in magazines)
+};
+
+// Objects start after the slab header, 16-byte aligned.
+#define SLABHDR  ((sizeof(struct slab) + 15) & ~15)
+
+struct kmmag {
+  int n;
+  void *obj[KMMAG];
+  uint allocs;
+  uint frees;
+} __attribute__((aligned(64)));
+
+struct kmcache {
+  struct spinlock lock;
+  char *name;
+  uint size;
+  uint perslab;
+  uint nslab;
+  struct slab *partial;   // slabs with at least one free object
+  struct kmmag mag[NCPU];
+};
+
+static struct {
+  struct spinlock lock;
+  int n;
+  struct kmcache cache[NKMCACHE];
+} kmtable;
+
+static struct kmcache *kmclass[8];   // KMMIN << i, up to KMMAX
+
+void
+kminit(void)
+{
+  static char *names[] = {
+    "kmalloc-16", "kmalloc-32", "kmalloc-64", "kmalloc-128",
+    "kmalloc-256", "kmalloc-512", "kmalloc-1024", "kmalloc-2048",
+  };
+  int i;
+
+  initlock(&kmtable.lock, "kmtable");
+  for(i = 0; (KMMIN << i) <= KMMAX; i++)
+    kmclass[i] = kmcreate(names[i], KMMIN << i);
+}
+
+// Create a cache of objects of the given size.
+// name must point to static storage.
+struct kmcache*
+kmcreate(char *name, uint size)
+{
+  struct kmcache *c;
+
+  size = (size + 7) & ~7;
+  if(size < sizeof(struct kmobj))
+    size = sizeof(struct kmobj);
+  if(size > PGSIZE - SLABHDR)
+    panic("kmcreate: too big");
+
+  acquire(&kmtable.lock);
+  if(kmtable.n == NKMCACHE)
+    panic("kmcreate: too many caches");
+  c = &kmtable.cache[kmtable.n++];
+  release(&kmtable.lock);
+
+  initlock(&c->lock, name);
+  c->name = name;
+  c->size = size;
+  c->perslab = (PGSIZE - SLABHDR) / size;
+  return c;
+}
+
+static void
+slabunlink(struct kmcache *c, struct slab *s)
+{
+  if(s->prev)
+    s->prev->next = s->next;
+  else
+    c->partial = s->next;
+  if(s->next)
+    s->next->prev = s->prev;
+}
+
+static void
+slablink(struct kmcache *c, struct slab *s)
+{
+  s->prev = 0;
+  s->next = c->partial;
+  if(c->partial)
+    c->partial->prev = s;
+  c->partial = s;
+}
+
+// Get a new slab page and put all its objects on its free list.
+// Caller must hold c->lock.
+static struct slab*
+slabgrow(struct kmcache *c)
+{
+  struct slab *s;
+  char *p;
+  uint i;
+
+  if((s = (struct slab*)kalloc()) == 0)
+    return 0;
+  s->cache = c;
+  s->free = 0;
+  s->inuse = 0;
+  p = (char*)s + SLABHDR + c->perslab*c->size;
+  for(i = 0; i < c->perslab; i++){
+    p -= c->size;
+    ((struct kmobj*)p)->next = s->free;
+    s->free = (struct kmobj*)p;
+  }
+  slablink(c, s);
+  c->nslab++;
+  return s;
+}
+
+// Take up to n objects from c's slabs into obj[].
+// Returns the number taken.  Caller must hold c->lock.
+static int
+slabtake(struct kmcache *c, void **obj, int n)
+{
+  struct slab *s;
+  int i;
+
+  for(i = 0; i < n; i++){
+    if((s = c->partial) == 0 && (s = slabgrow(c)) == 0)
+      break;
+    obj[i] = s->free;
+    s->free = s->free->next;
+    if(++s->inuse == c->perslab)
+      slabunlink(c, s);
+  }
+  return i;
+}
+
+// Return n objects from obj[] to their slabs, giving a slab's
+// page back to kalloc() once it is empty and another slab
+// still has room.  Caller must hold c->lock.
+static void
+slabput(struct kmcache *c, void **obj, int n)
+{
+  struct slab *s;
+  struct kmobj *o;
+  int i;
+
+  for(i = 0; i < n; i++){
+    o = obj[i];
+    s = (struct slab*)PGROUNDDOWN((uint)o);
+    o->next = s->free;
+    s->free = o;
+    if(s->inuse-- == c->perslab)
+      slablink(c, s);
+    if(s->inuse == 0 && (s->prev || s->next)){
+      slabunlink(c, s);
+      c->nslab--;
+      kfree((char*)s);
+    }
+  }
+}
+
+// Allocate one object from cache c.
+// Returns 0 if the memory cannot be allocated.
+void*
+kmcachealloc(struct kmcache *c)
+{
+  struct kmmag *m;
+  void *p;
+
+  pushcli();
+  m = &c->mag[cpu->id];
+  if(m->n == 0){
+    acquire(&c->lock);
+    m->n = slabtake(c, m->obj, KMMAG/2);
+    release(&c->lock);
+  }
+  p = 0;
+  if(m->n > 0){
+    p = m->obj[--m->n];
+    m->allocs++;
+  }
+  popcli();
+  return p;
+}
+
+// Allocate n bytes from the smallest size class that fits.
+// Returns 0 if n is too big or the memory cannot be allocated.
+void*
+kmalloc(uint n)
+{
+  int i;
+
+  for(i = 0; (KMMIN << i) <= KMMAX; i++)
+    if(n <= (KMMIN << i))
+      return kmcachealloc(kmclass[i]);
+  return 0;
+}
+
+// Free the object at v, which must have been returned by
+// kmalloc() or kmcachealloc().
+void
+kmfree(void *v)
+{
+  struct slab *s;
+  struct kmcache *c;
+  struct kmmag *m;
+
+  s = (struct slab*)PGROUNDDOWN((uint)v);
+  c = s->cache;
+  if(c < kmtable.cache || c >= kmtable.cache + kmtable.n ||
+     (uint)v < (uint)s + SLABHDR || ((uint)v - (uint)s - SLABHDR) % c->size)
+    panic("kmfree");
+
+  // Fill with junk to catch dangling refs.
+  memset(v, 1, c->size);
+
+  pushcli();
+  m = &c->mag[cpu->id];
+  if(m->n == KMMAG){
+    acquire(&c->lock);
+    slabput(c, m->obj + KMMAG/2, KMMAG/2);
+    release(&c->lock);
+    m->n = KMMAG/2;
+  }
+  m->obj[m->n++] = v;
+  m->frees++;
+  popcli();
+}
+
+// Copy usage of up to n caches into st[].
+// Returns the number of caches.
+int
+kmstat(struct kmstat *st, int n)
+{
+  struct kmcache *c;
+  int i, j;
+
+  for(i = 0; i < kmtable.n && i < n; i++){
+    c = &kmtable.cache[i];
+    safestrcpy(st[i].name, c->name, sizeof(st[i].name));
+    st[i].size = c->size;
+    st[i].perslab = c->perslab;
+    st[i].allocs = st[i].active = st[i].cached = 0;
+    acquire(&c->lock);
+    st[i].slabs = c->nslab;
+    release(&c->lock);
+    for(j = 0; j < NCPU; j++){
+      st[i].allocs += c->mag[j].allocs;
+      st[i].active += c->mag[j].allocs - c->mag[j].frees;
+      st[i].cached += c->mag[j].n;
+    }
+  }
+  return i;
+}
@@ -0,0 +1,89 @@
+// Sleeping locks, shared or exclusive.
+//
+// A process waiting for a sleep lock gives up the CPU, so
+// they suit locks held across disk I/O.  Any number of
+// processes may hold one shared, or a single process
+// exclusive.  Once a process is waiting for exclusive use,
+// new shared holders wait too, so readers cannot starve it.
+// A shared holder must not take the same lock again, as a
+// writer may have started waiting in between.
+
+#include "types.h"
+#include "defs.h"
+#include "param.h"
+#include "x86.h"
+#include "memlayout.h"
+#include "mmu.h"
+#include "spinlock.h"
+#include "proc.h"
+#include "sleeplock.h"
+
+void
+initsleeplock(struct sleeplock *lk, char *name)
+{
+  initlock(&lk->lk, "sleep lock");
+  lk->name = name;
+  lk->readers = 0;
+  lk->writer = 0;
+  lk->wwait = 0;
+  lk->pid = 0;
+}
+
+// Acquire lk for exclusive use.
+void
+acquiresleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  lk->wwait++;
+  while(lk->writer || lk->readers > 0)
+    sleep(lk, &lk->lk);
+  lk->wwait--;
+  lk->writer = 1;
+  lk->pid = proc->pid;
+  release(&lk->lk);
+}
+
+// Acquire lk shared with other readers.
+void
+acquiresleepshared(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  while(lk->writer || lk->wwait > 0)
+    sleep(lk, &lk->lk);
+  lk->readers++;
+  release(&lk->lk);
+}
+
+// Release lk, held either way.
+void
+releasesleep(struct sleeplock *lk)
+{
+  acquire(&lk->lk);
+  if(lk->writer){
+    lk->writer = 0;
+    lk->pid = 0;
+  } else if(lk->readers > 0)
+    lk->readers--;
+  else
+    panic("releasesleep");
+  // Either all readers or one writer may go next;
+  // let them sort it out.
+  if(lk->readers == 0)
+    wakeup(lk);
+  release(&lk->lk);
+}
+
+// Is lk held, exclusive by this process or shared by anyone?
+int
+holdingsleep(struct sleeplock *lk)
+{
+  int r;
+
+  acquire(&lk->lk);
+  if(lk->writer)
+    r = lk->pid == proc->pid;
+  else
+    r = lk->readers > 0;
+  release(&lk->lk);
+  return r;
+}
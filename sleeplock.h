@@ -0,0 +1,12 @@
+// Long-term lock for processes, held in shared mode by any
+// number of readers or in exclusive mode by one writer.
+struct sleeplock {
+  struct spinlock lk; // protects this sleep lock
+  int readers;        // Shared holders
+  int writer;         // Held exclusive?
+  int wwait;          // Processes waiting to hold it exclusive
+  
+  // For debugging:
+  char *name;         // Name of lock.
+  int pid;            // Process holding it exclusive
+};
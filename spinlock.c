@@ -6,15 +6,219 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
-#include "proc.h"
 #include "spinlock.h"
+#include "proc.h"
+#include "lockstat.h"
+
+// Locks keep contention statistics by class: all the locks
+// with the same name, such as every process's "proc" lock,
+// count together.  Each CPU counts in a line of its own,
+// with interrupts off while it holds the lock, so counting
+// needs no atomic instructions.  The classes past the last
+// one all count as "(other)".
+#define NLOCKCLASS 64
+#define NLOCKHASH  128  // names seen, by address
+
+struct lockcpu {
+  uint acquires;
+  uint contended;
+  uint64 spin;
+  uint64 hold;
+  uint64 holdmax;
+  struct {
+    uint pc;
+    uint count;
+  } site[NLOCKSITE];
+} __attribute__((aligned(64)));
+
+struct lockclass {
+  char *name;
+  struct lockcpu cpu[NCPU];
+};
+
+// Locks are initialized all the time, for every inode, pipe
+// and process, nearly always with a string constant for a
+// name.  So lockclass() remembers each name's class by the
+// name's address, and finds it again without locking.
+// Entries are only ever added, class first.
+struct lockname {
+  char *volatile name;
+  struct lockclass *class;
+};
+
+static struct {
+  volatile uint busy;  // a spin lock; initlock() can't use acquire()
+  int n;
+  struct lockclass class[NLOCKCLASS];
+  struct lockname hash[NLOCKHASH];
+} locktab;
+
+// Look name up by address in locktab.hash.  Returns its
+// entry, or the empty one where it would go, or 0 if the
+// table is full.
+static struct lockname*
+lockname(char *name)
+{
+  struct lockname *h;
+  int i, j;
+
+  j = ((uint)name >> 2) % NLOCKHASH;
+  for(i = 0; i < NLOCKHASH; i++){
+    h = &locktab.hash[(j + i) % NLOCKHASH];
+    if(h->name == name || h->name == 0)
+      return h;
+  }
+  return 0;
+}
+
+// Find or make the class for locks named name.
+static struct lockclass*
+lockclass(char *name)
+{
+  struct lockname *h;
+  struct lockclass *c;
+  uint eflags;
+
+  if((h = lockname(name)) != 0 && h->name == name){
+    __sync_synchronize();  // read class only after name
+    return h->class;
+  }
+
+  eflags = readeflags();
+  cli();
+  while(xchg(&locktab.busy, 1) != 0)
+    pause();
+  for(c = locktab.class; c < locktab.class + locktab.n; c++)
+    if(strncmp(c->name, name, sizeof(((struct lockstat*)0)->name)) == 0)
+      goto found;
+  if(locktab.n < NLOCKCLASS - 1){
+    c = &locktab.class[locktab.n++];
+    c->name = name;
+  } else {
+    c = &locktab.class[NLOCKCLASS - 1];
+    c->name = "(other)";
+  }
+found:
+  if((h = lockname(name)) != 0 && h->name == 0){
+    h->class = c;
+    __sync_synchronize();
+    h->name = name;
+  }
+  xchg(&locktab.busy, 0);
+  if(eflags & FL_IF)
+    sti();
+  return c;
+}
 
 void
 initlock(struct spinlock *lk, char *name)
 {
   lk->name = name;
-  lk->locked = 0;
+  lk->next = 0;
+  lk->owner = 0;
+  lk->tail = 0;
+  lk->mcs = 0;
   lk->cpu = 0;
+  lk->class = lockclass(name);
+}
+
+// Initialize an MCS queue lock.  Its waiters each spin on a
+// node of their own instead of on the lock, so the lock's
+// cache line does not bounce between them.  Worth it for the
+// global locks that many CPUs contend for.
+void
+initmcslock(struct spinlock *lk, char *name)
+{
+  initlock(lk, name);
+  lk->mcs = 1;
+}
+
+// Take a ticket for lk and wait for it to come up.
+// Returns the cycles spent waiting.
+static uint64
+ticketacquire(struct spinlock *lk)
+{
+  uint t;
+  uint64 t0;
+
+  t = xadd(&lk->next, 1);
+  if(lk->owner == t)
+    return 0;
+  t0 = rdtsc();
+  while(lk->owner != t)
+    pause();
+  return rdtsc() - t0;
+}
+
+// Join the line for MCS lock lk and wait for our turn.
+// Returns the cycles spent waiting.
+static uint64
+mcsacquire(struct spinlock *lk)
+{
+  struct mcsnode *n, *pred;
+  uint64 t0;
+  int i;
+
+  for(i = 0; i < NMCS; i++)
+    if((cpu->mcsused & (1 << i)) == 0)
+      break;
+  if(i == NMCS)
+    panic("acquire: too many mcs locks");
+  cpu->mcsused |= 1 << i;
+  n = &cpu->mcs[i];
+  n->next = 0;
+  n->wait = 1;
+  pred = (struct mcsnode*)xchg((volatile uint*)&lk->tail, (uint)n);
+  if(pred == 0){
+    lk->node = n;
+    return 0;
+  }
+  t0 = rdtsc();
+  pred->next = n;
+  while(n->wait)
+    pause();
+  // Only now, as holder, may we replace the previous holder's node.
+  lk->node = n;
+  return rdtsc() - t0;
+}
+
+// Hand MCS lock lk to the next in line, if any.
+static void
+mcsrelease(struct spinlock *lk)
+{
+  struct mcsnode *n;
+
+  n = lk->node;
+  if(n->next == 0){
+    // Nobody in line, unless someone is just joining.
+    if(cmpxchg((volatile uint*)&lk->tail, (uint)n, 0) == (uint)n)
+      goto done;
+    while(n->next == 0)
+      pause();
+  }
+  n->next->wait = 0;
+done:
+  cpu->mcsused &= ~(1 << (n - cpu->mcs));
+}
+
+// Count a contended acquisition from pc among s's top sites,
+// replacing the least contended one if pc is not there.
+static void
+locksite(struct lockcpu *s, uint pc)
+{
+  int i, min;
+
+  min = 0;
+  for(i = 0; i < NLOCKSITE; i++){
+    if(s->site[i].pc == pc){
+      s->site[i].count++;
+      return;
+    }
+    if(s->site[i].count < s->site[min].count)
+      min = i;
+  }
+  s->site[min].pc = pc;
+  s->site[min].count++;
 }
 
 // Acquire the lock.
@@ -24,41 +228,61 @@ initlock(struct spinlock *lk, char *name)
 void
 acquire(struct spinlock *lk)
 {
+  struct lockcpu *s;
+  uint64 spin;
+
   pushcli(); // disable interrupts to avoid deadlock.
   if(holding(lk))
     panic("acquire");
 
-  // The xchg is atomic.
-  // It also serializes, so that reads after acquire are not
-  // reordered before it. 
-  while(xchg(&lk->locked, 1) != 0)
-    ;
+  if(lk->mcs)
+    spin = mcsacquire(lk);
+  else
+    spin = ticketacquire(lk);
 
-  // Record info about lock acquisition for debugging.
+  // Tell the C compiler and the processor not to move loads
+  // or stores of the critical section before this point.
+  __sync_synchronize();
+
+  // Record info about lock acquisition for debugging and
+  // statistics.  Only waiting is worth a call stack.
   lk->cpu = cpu;
-  getcallerpcs(&lk, lk->pcs);
+  s = &lk->class->cpu[cpu->id];
+  s->acquires++;
+  if(spin){
+    s->contended++;
+    s->spin += spin;
+    getcallerpcs(&lk, lk->pcs);
+    locksite(s, lk->pcs[0]);
+  }
+  lk->start = rdtsc();
 }
 
 // Release the lock.
 void
 release(struct spinlock *lk)
 {
+  struct lockcpu *s;
+  uint64 hold;
+
   if(!holding(lk))
     panic("release");
 
-  lk->pcs[0] = 0;
+  hold = rdtsc() - lk->start;
+  s = &lk->class->cpu[cpu->id];
+  s->hold += hold;
+  if(hold > s->holdmax)
+    s->holdmax = hold;
   lk->cpu = 0;
 
-  // The xchg serializes, so that reads before release are 
-  // not reordered after it.  The 1996 PentiumPro manual (Volume 3,
-  // 7.2) says reads can be carried out speculatively and in
-  // any order, which implies we need to serialize here.
-  // But the 2007 Intel 64 Architecture Memory Ordering White
-  // Paper says that Intel 64 and IA-32 will not move a load
-  // after a store. So lock->locked = 0 would work here.
-  // The xchg being asm volatile ensures gcc emits it after
-  // the above assignments (and after the critical section).
-  xchg(&lk->locked, 0);
+  // Nor after this point.  x86 does not move stores past
+  // other stores, so a plain store then releases the lock.
+  __sync_synchronize();
+
+  if(lk->mcs)
+    mcsrelease(lk);
+  else
+    lk->owner++;
 
   popcli();
 }
@@ -82,10 +306,11 @@ getcallerpcs(void *v, uint pcs[])
 }
 
 // Check whether this cpu is holding the lock.
+// lk->cpu is set only while the lock is held.
 int
 holding(struct spinlock *lock)
 {
-  return lock->locked && lock->cpu == cpu;
+  return lock->cpu == cpu;
 }
 
 
@@ -115,3 +340,70 @@ popcli(void)
     sti();
 }
 
+// Merge the per-CPU top call sites of c into st's.
+static void
+topsites(struct lockclass *c, struct lockstat *st)
+{
+  uint pc[NCPU*NLOCKSITE], count[NCPU*NLOCKSITE];
+  int i, j, k, n, best;
+
+  n = 0;
+  for(i = 0; i < NCPU; i++){
+    for(j = 0; j < NLOCKSITE; j++){
+      if(c->cpu[i].site[j].count == 0)
+        continue;
+      for(k = 0; k < n && pc[k] != c->cpu[i].site[j].pc; k++)
+        ;
+      if(k == n){
+        pc[n] = c->cpu[i].site[j].pc;
+        count[n++] = 0;
+      }
+      count[k] += c->cpu[i].site[j].count;
+    }
+  }
+  for(i = 0; i < NLOCKSITE; i++){
+    best = -1;
+    for(k = 0; k < n; k++)
+      if(count[k] && (best < 0 || count[k] > count[best]))
+        best = k;
+    st->site[i].pc = st->site[i].count = 0;
+    if(best >= 0){
+      st->site[i].pc = pc[best];
+      st->site[i].count = count[best];
+      count[best] = 0;
+    }
+  }
+}
+
+// Copy the statistics of up to n lock classes into st[], then
+// zero them all if reset is set.  Returns the number copied.
+// Counts racing with a reset may be lost.
+int
+lockstat(struct lockstat *st, int n, int reset)
+{
+  struct lockclass *c;
+  struct lockcpu *s;
+  int i;
+
+  for(i = 0, c = locktab.class; c < locktab.class + NLOCKCLASS && i < n; c++){
+    if(c->name == 0)
+      continue;
+    safestrcpy(st[i].name, c->name, sizeof(st[i].name));
+    st[i].acquires = st[i].contended = 0;
+    st[i].spin = st[i].hold = st[i].holdmax = 0;
+    for(s = c->cpu; s < c->cpu + NCPU; s++){
+      st[i].acquires += s->acquires;
+      st[i].contended += s->contended;
+      st[i].spin += s->spin;
+      st[i].hold += s->hold;
+      if(s->holdmax > st[i].holdmax)
+        st[i].holdmax = s->holdmax;
+    }
+    topsites(c, &st[i]);
+    i++;
+  }
+  if(reset)
+    for(c = locktab.class; c < locktab.class + NLOCKCLASS; c++)
+      memset(c->cpu, 0, sizeof(c->cpu));
+  return i;
+}
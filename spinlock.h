@@ -1,11 +1,26 @@
-// Mutual exclusion lock.
+// Queue node for an MCS lock.  Each CPU has NMCS of them, one
+// for every MCS lock it holds or is waiting for, and a waiter
+// spins only on its own node.
+struct mcsnode {
+  struct mcsnode *volatile next;  // next waiter in line
+  volatile uint wait;             // cleared by the holder before us
+} __attribute__((aligned(64)));
+
+// Mutual exclusion lock.  A ticket lock unless initialized
+// with initmcslock(), which makes it an MCS queue lock.
+// Both hand the lock to waiters in the order they came.
 struct spinlock {
-  uint locked;       // Is the lock held?
+  volatile uint next;  // Ticket lock: next ticket to hand out
+  volatile uint owner; // Ticket lock: ticket now holding the lock
+  struct mcsnode *volatile tail;  // MCS lock: last in line
+  struct mcsnode *node;           // MCS lock: the holder's node
+  int mcs;             // Is it an MCS lock?
   
   // For debugging:
   char *name;        // Name of lock.
   struct cpu *cpu;   // The cpu holding the lock.
   uint pcs[10];      // The call stack (an array of program counters)
-                     // that locked the lock.
+                     // that last waited for the lock.
+  struct lockclass *class;  // Statistics; see spinlock.c
+  uint64 start;      // When the holder acquired it
 };
-
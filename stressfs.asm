@@ -0,0 +1,1868 @@
+
+_stressfs:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "fs.h"
+#include "fcntl.h"
+
+int
+main(int argc, char *argv[])
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	81 ec 24 02 00 00    	sub    $0x224,%esp
+  int fd, i;
+  char path[] = "stressfs0";
+  14:	c7 45 e6 73 74 72 65 	movl   $0x65727473,-0x1a(%ebp)
+  1b:	c7 45 ea 73 73 66 73 	movl   $0x73667373,-0x16(%ebp)
+  22:	66 c7 45 ee 30 00    	movw   $0x30,-0x12(%ebp)
+  char data[512];
+
+  printf(1, "stressfs starting\n");
+  28:	83 ec 08             	sub    $0x8,%esp
+  2b:	68 b9 0d 00 00       	push   $0xdb9
+  30:	6a 01                	push   $0x1
+  32:	e8 43 09 00 00       	call   97a <printf>
+  37:	83 c4 10             	add    $0x10,%esp
+  memset(data, 'a', sizeof(data));
+  3a:	83 ec 04             	sub    $0x4,%esp
+  3d:	68 00 02 00 00       	push   $0x200
+  42:	6a 61                	push   $0x61
+  44:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  4a:	50                   	push   %eax
+  4b:	e8 10 02 00 00       	call   260 <memset>
+  50:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 4; i++)
+  53:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  5a:	eb 0d                	jmp    69 <main+0x69>
+    if(fork() > 0)
+  5c:	e8 3c 07 00 00       	call   79d <fork>
+  61:	85 c0                	test   %eax,%eax
+  63:	7f 0c                	jg     71 <main+0x71>
+  for(i = 0; i < 4; i++)
+  65:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  69:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+  6d:	7e ed                	jle    5c <main+0x5c>
+  6f:	eb 01                	jmp    72 <main+0x72>
+      break;
+  71:	90                   	nop
+
+  printf(1, "write %d\n", i);
+  72:	83 ec 04             	sub    $0x4,%esp
+  75:	ff 75 f4             	push   -0xc(%ebp)
+  78:	68 cc 0d 00 00       	push   $0xdcc
+  7d:	6a 01                	push   $0x1
+  7f:	e8 f6 08 00 00       	call   97a <printf>
+  84:	83 c4 10             	add    $0x10,%esp
+
+  path[8] += i;
+  87:	0f b6 45 ee          	movzbl -0x12(%ebp),%eax
+  8b:	89 c2                	mov    %eax,%edx
+  8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  90:	01 d0                	add    %edx,%eax
+  92:	88 45 ee             	mov    %al,-0x12(%ebp)
+  fd = open(path, O_CREATE | O_RDWR);
+  95:	83 ec 08             	sub    $0x8,%esp
+  98:	68 02 02 00 00       	push   $0x202
+  9d:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+  a0:	50                   	push   %eax
+  a1:	e8 36 07 00 00       	call   7dc <open>
+  a6:	83 c4 10             	add    $0x10,%esp
+  a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 20; i++)
+  ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  b3:	eb 1e                	jmp    d3 <main+0xd3>
+//    printf(fd, "%d\n", i);
+    write(fd, data, sizeof(data));
+  b5:	83 ec 04             	sub    $0x4,%esp
+  b8:	68 00 02 00 00       	push   $0x200
+  bd:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+  c3:	50                   	push   %eax
+  c4:	ff 75 f0             	push   -0x10(%ebp)
+  c7:	e8 f4 06 00 00       	call   7c0 <write>
+  cc:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 20; i++)
+  cf:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  d3:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+  d7:	7e dc                	jle    b5 <main+0xb5>
+  close(fd);
+  d9:	83 ec 0c             	sub    $0xc,%esp
+  dc:	ff 75 f0             	push   -0x10(%ebp)
+  df:	e8 e3 06 00 00       	call   7c7 <close>
+  e4:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "read\n");
+  e7:	83 ec 08             	sub    $0x8,%esp
+  ea:	68 d6 0d 00 00       	push   $0xdd6
+  ef:	6a 01                	push   $0x1
+  f1:	e8 84 08 00 00       	call   97a <printf>
+  f6:	83 c4 10             	add    $0x10,%esp
+
+  fd = open(path, O_RDONLY);
+  f9:	83 ec 08             	sub    $0x8,%esp
+  fc:	6a 00                	push   $0x0
+  fe:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+ 101:	50                   	push   %eax
+ 102:	e8 d5 06 00 00       	call   7dc <open>
+ 107:	83 c4 10             	add    $0x10,%esp
+ 10a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for (i = 0; i < 20; i++)
+ 10d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 114:	eb 1e                	jmp    134 <main+0x134>
+    read(fd, data, sizeof(data));
+ 116:	83 ec 04             	sub    $0x4,%esp
+ 119:	68 00 02 00 00       	push   $0x200
+ 11e:	8d 85 e6 fd ff ff    	lea    -0x21a(%ebp),%eax
+ 124:	50                   	push   %eax
+ 125:	ff 75 f0             	push   -0x10(%ebp)
+ 128:	e8 8c 06 00 00       	call   7b9 <read>
+ 12d:	83 c4 10             	add    $0x10,%esp
+  for (i = 0; i < 20; i++)
+ 130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+ 138:	7e dc                	jle    116 <main+0x116>
+  close(fd);
+ 13a:	83 ec 0c             	sub    $0xc,%esp
+ 13d:	ff 75 f0             	push   -0x10(%ebp)
+ 140:	e8 82 06 00 00       	call   7c7 <close>
+ 145:	83 c4 10             	add    $0x10,%esp
+
+  wait();
+ 148:	e8 5e 06 00 00       	call   7ab <wait>
+  
+  exit();
+ 14d:	e8 52 06 00 00       	call   7a4 <exit>
+
+00000152 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 152:	55                   	push   %ebp
+ 153:	89 e5                	mov    %esp,%ebp
+ 155:	57                   	push   %edi
+ 156:	53                   	push   %ebx
+char*
+ 157:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 15a:	8b 55 10             	mov    0x10(%ebp),%edx
+ 15d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 160:	89 cb                	mov    %ecx,%ebx
+ 162:	89 df                	mov    %ebx,%edi
+ 164:	89 d1                	mov    %edx,%ecx
+ 166:	fc                   	cld
+ 167:	f3 aa                	rep stos %al,%es:(%edi)
+ 169:	89 ca                	mov    %ecx,%edx
+ 16b:	89 fb                	mov    %edi,%ebx
+ 16d:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 170:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 173:	90                   	nop
+ 174:	5b                   	pop    %ebx
+ 175:	5f                   	pop    %edi
+ 176:	5d                   	pop    %ebp
+ 177:	c3                   	ret
+
+00000178 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 178:	55                   	push   %ebp
+ 179:	89 e5                	mov    %esp,%ebp
+ 17b:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 17e:	8b 55 08             	mov    0x8(%ebp),%edx
+ 181:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 184:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 187:	f0 87 02             	lock xchg %eax,(%edx)
+ 18a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 18d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 190:	c9                   	leave
+ 191:	c3                   	ret
+
+00000192 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 192:	55                   	push   %ebp
+ 193:	89 e5                	mov    %esp,%ebp
+ 195:	53                   	push   %ebx
+ 196:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 199:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 19c:	8b 55 10             	mov    0x10(%ebp),%edx
+ 19f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1a2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1a5:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 1a9:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 1ac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 1af:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 1b2:	c9                   	leave
+ 1b3:	c3                   	ret
+
+000001b4 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 1b4:	55                   	push   %ebp
+ 1b5:	89 e5                	mov    %esp,%ebp
+ 1b7:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 1ba:	0f 31                	rdtsc
+ 1bc:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 1bf:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 1c2:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 1c5:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 1c8:	c9                   	leave
+ 1c9:	c3                   	ret
+
+000001ca <strcpy>:
+{
+ 1ca:	55                   	push   %ebp
+ 1cb:	89 e5                	mov    %esp,%ebp
+ 1cd:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 1d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1d3:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 1d6:	90                   	nop
+ 1d7:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 1da:	8d 42 01             	lea    0x1(%edx),%eax
+ 1dd:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 1e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1e3:	8d 48 01             	lea    0x1(%eax),%ecx
+ 1e6:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 1e9:	0f b6 12             	movzbl (%edx),%edx
+ 1ec:	88 10                	mov    %dl,(%eax)
+ 1ee:	0f b6 00             	movzbl (%eax),%eax
+ 1f1:	84 c0                	test   %al,%al
+ 1f3:	75 e2                	jne    1d7 <strcpy+0xd>
+  return os;
+ 1f5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 1f8:	c9                   	leave
+ 1f9:	c3                   	ret
+
+000001fa <strcmp>:
+{
+ 1fa:	55                   	push   %ebp
+ 1fb:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 1fd:	eb 08                	jmp    207 <strcmp+0xd>
+    p++, q++;
+ 1ff:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 203:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 207:	8b 45 08             	mov    0x8(%ebp),%eax
+ 20a:	0f b6 00             	movzbl (%eax),%eax
+ 20d:	84 c0                	test   %al,%al
+ 20f:	74 10                	je     221 <strcmp+0x27>
+ 211:	8b 45 08             	mov    0x8(%ebp),%eax
+ 214:	0f b6 10             	movzbl (%eax),%edx
+ 217:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 21a:	0f b6 00             	movzbl (%eax),%eax
+ 21d:	38 c2                	cmp    %al,%dl
+ 21f:	74 de                	je     1ff <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 221:	8b 45 08             	mov    0x8(%ebp),%eax
+ 224:	0f b6 00             	movzbl (%eax),%eax
+ 227:	0f b6 d0             	movzbl %al,%edx
+ 22a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 22d:	0f b6 00             	movzbl (%eax),%eax
+ 230:	0f b6 c0             	movzbl %al,%eax
+ 233:	29 c2                	sub    %eax,%edx
+ 235:	89 d0                	mov    %edx,%eax
+}
+ 237:	5d                   	pop    %ebp
+ 238:	c3                   	ret
+
+00000239 <strlen>:
+{
+ 239:	55                   	push   %ebp
+ 23a:	89 e5                	mov    %esp,%ebp
+ 23c:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 23f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 246:	eb 04                	jmp    24c <strlen+0x13>
+ 248:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 24c:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 24f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 252:	01 d0                	add    %edx,%eax
+ 254:	0f b6 00             	movzbl (%eax),%eax
+ 257:	84 c0                	test   %al,%al
+ 259:	75 ed                	jne    248 <strlen+0xf>
+  return n;
+ 25b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 25e:	c9                   	leave
+ 25f:	c3                   	ret
+
+00000260 <memset>:
+{
+ 260:	55                   	push   %ebp
+ 261:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 263:	8b 45 10             	mov    0x10(%ebp),%eax
+ 266:	50                   	push   %eax
+ 267:	ff 75 0c             	push   0xc(%ebp)
+ 26a:	ff 75 08             	push   0x8(%ebp)
+ 26d:	e8 e0 fe ff ff       	call   152 <stosb>
+ 272:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 275:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 278:	c9                   	leave
+ 279:	c3                   	ret
+
+0000027a <strchr>:
+{
+ 27a:	55                   	push   %ebp
+ 27b:	89 e5                	mov    %esp,%ebp
+ 27d:	83 ec 04             	sub    $0x4,%esp
+ 280:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 283:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 286:	eb 14                	jmp    29c <strchr+0x22>
+    if(*s == c)
+ 288:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28b:	0f b6 00             	movzbl (%eax),%eax
+ 28e:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 291:	75 05                	jne    298 <strchr+0x1e>
+      return (char*)s;
+ 293:	8b 45 08             	mov    0x8(%ebp),%eax
+ 296:	eb 13                	jmp    2ab <strchr+0x31>
+  for(; *s; s++)
+ 298:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 29c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 29f:	0f b6 00             	movzbl (%eax),%eax
+ 2a2:	84 c0                	test   %al,%al
+ 2a4:	75 e2                	jne    288 <strchr+0xe>
+  return 0;
+ 2a6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 2ab:	c9                   	leave
+ 2ac:	c3                   	ret
+
+000002ad <gets>:
+{
+ 2ad:	55                   	push   %ebp
+ 2ae:	89 e5                	mov    %esp,%ebp
+ 2b0:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 2b3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 2ba:	eb 42                	jmp    2fe <gets+0x51>
+    cc = read(0, &c, 1);
+ 2bc:	83 ec 04             	sub    $0x4,%esp
+ 2bf:	6a 01                	push   $0x1
+ 2c1:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 2c4:	50                   	push   %eax
+ 2c5:	6a 00                	push   $0x0
+ 2c7:	e8 ed 04 00 00       	call   7b9 <read>
+ 2cc:	83 c4 10             	add    $0x10,%esp
+ 2cf:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 2d2:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 2d6:	7e 33                	jle    30b <gets+0x5e>
+    buf[i++] = c;
+ 2d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 2db:	8d 50 01             	lea    0x1(%eax),%edx
+ 2de:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 2e1:	89 c2                	mov    %eax,%edx
+ 2e3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e6:	01 c2                	add    %eax,%edx
+ 2e8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2ec:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 2ee:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2f2:	3c 0a                	cmp    $0xa,%al
+ 2f4:	74 16                	je     30c <gets+0x5f>
+ 2f6:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 2fa:	3c 0d                	cmp    $0xd,%al
+ 2fc:	74 0e                	je     30c <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 2fe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 301:	83 c0 01             	add    $0x1,%eax
+ 304:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 307:	7f b3                	jg     2bc <gets+0xf>
+ 309:	eb 01                	jmp    30c <gets+0x5f>
+      break;
+ 30b:	90                   	nop
+  buf[i] = '\0';
+ 30c:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 30f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 312:	01 d0                	add    %edx,%eax
+ 314:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 317:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 31a:	c9                   	leave
+ 31b:	c3                   	ret
+
+0000031c <stat>:
+{
+ 31c:	55                   	push   %ebp
+ 31d:	89 e5                	mov    %esp,%ebp
+ 31f:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 322:	83 ec 08             	sub    $0x8,%esp
+ 325:	6a 00                	push   $0x0
+ 327:	ff 75 08             	push   0x8(%ebp)
+ 32a:	e8 ad 04 00 00       	call   7dc <open>
+ 32f:	83 c4 10             	add    $0x10,%esp
+ 332:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 335:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 339:	79 07                	jns    342 <stat+0x26>
+    return -1;
+ 33b:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 340:	eb 25                	jmp    367 <stat+0x4b>
+  r = fstat(fd, st);
+ 342:	83 ec 08             	sub    $0x8,%esp
+ 345:	ff 75 0c             	push   0xc(%ebp)
+ 348:	ff 75 f4             	push   -0xc(%ebp)
+ 34b:	e8 a1 04 00 00       	call   7f1 <fstat>
+ 350:	83 c4 10             	add    $0x10,%esp
+ 353:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 356:	83 ec 0c             	sub    $0xc,%esp
+ 359:	ff 75 f4             	push   -0xc(%ebp)
+ 35c:	e8 66 04 00 00       	call   7c7 <close>
+ 361:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 364:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 367:	c9                   	leave
+ 368:	c3                   	ret
+
+00000369 <atoi>:
+{
+ 369:	55                   	push   %ebp
+ 36a:	89 e5                	mov    %esp,%ebp
+ 36c:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 36f:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 376:	eb 25                	jmp    39d <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 378:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 37b:	89 d0                	mov    %edx,%eax
+ 37d:	c1 e0 02             	shl    $0x2,%eax
+ 380:	01 d0                	add    %edx,%eax
+ 382:	01 c0                	add    %eax,%eax
+ 384:	89 c1                	mov    %eax,%ecx
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+ 389:	8d 50 01             	lea    0x1(%eax),%edx
+ 38c:	89 55 08             	mov    %edx,0x8(%ebp)
+ 38f:	0f b6 00             	movzbl (%eax),%eax
+ 392:	0f be c0             	movsbl %al,%eax
+ 395:	01 c8                	add    %ecx,%eax
+ 397:	83 e8 30             	sub    $0x30,%eax
+ 39a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 39d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a0:	0f b6 00             	movzbl (%eax),%eax
+ 3a3:	3c 2f                	cmp    $0x2f,%al
+ 3a5:	7e 0a                	jle    3b1 <atoi+0x48>
+ 3a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3aa:	0f b6 00             	movzbl (%eax),%eax
+ 3ad:	3c 39                	cmp    $0x39,%al
+ 3af:	7e c7                	jle    378 <atoi+0xf>
+  return n;
+ 3b1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 3b4:	c9                   	leave
+ 3b5:	c3                   	ret
+
+000003b6 <memmove>:
+{
+ 3b6:	55                   	push   %ebp
+ 3b7:	89 e5                	mov    %esp,%ebp
+ 3b9:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 3bc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3bf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 3c2:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c5:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 3c8:	eb 17                	jmp    3e1 <memmove+0x2b>
+    *dst++ = *src++;
+ 3ca:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 3cd:	8d 42 01             	lea    0x1(%edx),%eax
+ 3d0:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 3d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3d6:	8d 48 01             	lea    0x1(%eax),%ecx
+ 3d9:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 3dc:	0f b6 12             	movzbl (%edx),%edx
+ 3df:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 3e1:	8b 45 10             	mov    0x10(%ebp),%eax
+ 3e4:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 3e7:	89 55 10             	mov    %edx,0x10(%ebp)
+ 3ea:	85 c0                	test   %eax,%eax
+ 3ec:	7f dc                	jg     3ca <memmove+0x14>
+  return vdst;
+ 3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3f1:	c9                   	leave
+ 3f2:	c3                   	ret
+
+000003f3 <mutex_init>:
+{
+ 3f3:	55                   	push   %ebp
+ 3f4:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 3f6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f9:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 3ff:	90                   	nop
+ 400:	5d                   	pop    %ebp
+ 401:	c3                   	ret
+
+00000402 <mutex_lock>:
+{
+ 402:	55                   	push   %ebp
+ 403:	89 e5                	mov    %esp,%ebp
+ 405:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 408:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40b:	6a 01                	push   $0x1
+ 40d:	6a 00                	push   $0x0
+ 40f:	50                   	push   %eax
+ 410:	e8 7d fd ff ff       	call   192 <cmpxchg>
+ 415:	83 c4 0c             	add    $0xc,%esp
+ 418:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 41b:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 41f:	74 46                	je     467 <mutex_lock+0x65>
+  if(c != 2)
+ 421:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 425:	74 38                	je     45f <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 427:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42a:	6a 02                	push   $0x2
+ 42c:	50                   	push   %eax
+ 42d:	e8 46 fd ff ff       	call   178 <xchg>
+ 432:	83 c4 08             	add    $0x8,%esp
+ 435:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 438:	eb 25                	jmp    45f <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 43a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 43d:	83 ec 08             	sub    $0x8,%esp
+ 440:	6a 02                	push   $0x2
+ 442:	50                   	push   %eax
+ 443:	e8 22 04 00 00       	call   86a <futex_wait>
+ 448:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 44b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44e:	83 ec 08             	sub    $0x8,%esp
+ 451:	6a 02                	push   $0x2
+ 453:	50                   	push   %eax
+ 454:	e8 1f fd ff ff       	call   178 <xchg>
+ 459:	83 c4 10             	add    $0x10,%esp
+ 45c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 45f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 463:	75 d5                	jne    43a <mutex_lock+0x38>
+ 465:	eb 01                	jmp    468 <mutex_lock+0x66>
+    return;
+ 467:	90                   	nop
+}
+ 468:	c9                   	leave
+ 469:	c3                   	ret
+
+0000046a <mutex_unlock>:
+{
+ 46a:	55                   	push   %ebp
+ 46b:	89 e5                	mov    %esp,%ebp
+ 46d:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 470:	8b 45 08             	mov    0x8(%ebp),%eax
+ 473:	6a 00                	push   $0x0
+ 475:	50                   	push   %eax
+ 476:	e8 fd fc ff ff       	call   178 <xchg>
+ 47b:	83 c4 08             	add    $0x8,%esp
+ 47e:	83 f8 02             	cmp    $0x2,%eax
+ 481:	75 11                	jne    494 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 483:	8b 45 08             	mov    0x8(%ebp),%eax
+ 486:	83 ec 08             	sub    $0x8,%esp
+ 489:	6a 01                	push   $0x1
+ 48b:	50                   	push   %eax
+ 48c:	e8 e3 03 00 00       	call   874 <futex_wake>
+ 491:	83 c4 10             	add    $0x10,%esp
+}
+ 494:	90                   	nop
+ 495:	c9                   	leave
+ 496:	c3                   	ret
+
+00000497 <cond_init>:
+{
+ 497:	55                   	push   %ebp
+ 498:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 49a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49d:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 4a3:	90                   	nop
+ 4a4:	5d                   	pop    %ebp
+ 4a5:	c3                   	ret
+
+000004a6 <cond_wait>:
+{
+ 4a6:	55                   	push   %ebp
+ 4a7:	89 e5                	mov    %esp,%ebp
+ 4a9:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 4ac:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4af:	8b 00                	mov    (%eax),%eax
+ 4b1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 4b4:	83 ec 0c             	sub    $0xc,%esp
+ 4b7:	ff 75 0c             	push   0xc(%ebp)
+ 4ba:	e8 ab ff ff ff       	call   46a <mutex_unlock>
+ 4bf:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 4c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4c5:	83 ec 08             	sub    $0x8,%esp
+ 4c8:	ff 75 f4             	push   -0xc(%ebp)
+ 4cb:	50                   	push   %eax
+ 4cc:	e8 99 03 00 00       	call   86a <futex_wait>
+ 4d1:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4d4:	eb 11                	jmp    4e7 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 4d6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4d9:	83 ec 08             	sub    $0x8,%esp
+ 4dc:	6a 02                	push   $0x2
+ 4de:	50                   	push   %eax
+ 4df:	e8 86 03 00 00       	call   86a <futex_wait>
+ 4e4:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 4e7:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 4ea:	83 ec 08             	sub    $0x8,%esp
+ 4ed:	6a 02                	push   $0x2
+ 4ef:	50                   	push   %eax
+ 4f0:	e8 83 fc ff ff       	call   178 <xchg>
+ 4f5:	83 c4 10             	add    $0x10,%esp
+ 4f8:	85 c0                	test   %eax,%eax
+ 4fa:	75 da                	jne    4d6 <cond_wait+0x30>
+}
+ 4fc:	90                   	nop
+ 4fd:	90                   	nop
+ 4fe:	c9                   	leave
+ 4ff:	c3                   	ret
+
+00000500 <condbump>:
+{
+ 500:	55                   	push   %ebp
+ 501:	89 e5                	mov    %esp,%ebp
+ 503:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 506:	8b 45 08             	mov    0x8(%ebp),%eax
+ 509:	8b 00                	mov    (%eax),%eax
+ 50b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 50e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 511:	8d 50 01             	lea    0x1(%eax),%edx
+ 514:	8b 45 08             	mov    0x8(%ebp),%eax
+ 517:	52                   	push   %edx
+ 518:	ff 75 fc             	push   -0x4(%ebp)
+ 51b:	50                   	push   %eax
+ 51c:	e8 71 fc ff ff       	call   192 <cmpxchg>
+ 521:	83 c4 0c             	add    $0xc,%esp
+ 524:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 527:	75 dd                	jne    506 <condbump+0x6>
+}
+ 529:	90                   	nop
+ 52a:	90                   	nop
+ 52b:	c9                   	leave
+ 52c:	c3                   	ret
+
+0000052d <cond_signal>:
+{
+ 52d:	55                   	push   %ebp
+ 52e:	89 e5                	mov    %esp,%ebp
+ 530:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 533:	ff 75 08             	push   0x8(%ebp)
+ 536:	e8 c5 ff ff ff       	call   500 <condbump>
+ 53b:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 53e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 541:	83 ec 08             	sub    $0x8,%esp
+ 544:	6a 01                	push   $0x1
+ 546:	50                   	push   %eax
+ 547:	e8 28 03 00 00       	call   874 <futex_wake>
+ 54c:	83 c4 10             	add    $0x10,%esp
+}
+ 54f:	90                   	nop
+ 550:	c9                   	leave
+ 551:	c3                   	ret
+
+00000552 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 552:	55                   	push   %ebp
+ 553:	89 e5                	mov    %esp,%ebp
+ 555:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 558:	ff 75 08             	push   0x8(%ebp)
+ 55b:	e8 a0 ff ff ff       	call   500 <condbump>
+ 560:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 563:	8b 45 08             	mov    0x8(%ebp),%eax
+ 566:	83 ec 08             	sub    $0x8,%esp
+ 569:	68 ff ff ff 7f       	push   $0x7fffffff
+ 56e:	50                   	push   %eax
+ 56f:	e8 00 03 00 00       	call   874 <futex_wake>
+ 574:	83 c4 10             	add    $0x10,%esp
+}
+ 577:	90                   	nop
+ 578:	c9                   	leave
+ 579:	c3                   	ret
+
+0000057a <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 57a:	55                   	push   %ebp
+ 57b:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 57d:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 582:	8b 00                	mov    (%eax),%eax
+}
+ 584:	5d                   	pop    %ebp
+ 585:	c3                   	ret
+
+00000586 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 586:	55                   	push   %ebp
+ 587:	89 e5                	mov    %esp,%ebp
+ 589:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 58c:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 591:	8b 00                	mov    (%eax),%eax
+ 593:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 596:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 59a:	74 05                	je     5a1 <vgetpid+0x1b>
+    return pid;
+ 59c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 59f:	eb 05                	jmp    5a6 <vgetpid+0x20>
+  return getpid();
+ 5a1:	e8 74 02 00 00       	call   81a <getpid>
+}
+ 5a6:	c9                   	leave
+ 5a7:	c3                   	ret
+
+000005a8 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 5a8:	55                   	push   %ebp
+ 5a9:	89 e5                	mov    %esp,%ebp
+ 5ab:	57                   	push   %edi
+ 5ac:	56                   	push   %esi
+ 5ad:	53                   	push   %ebx
+ 5ae:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 5b1:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 5b8:	e8 f7 fb ff ff       	call   1b4 <rdtsc>
+ 5bd:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 5c0:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 5c3:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 5c6:	29 c8                	sub    %ecx,%eax
+ 5c8:	19 da                	sbb    %ebx,%edx
+ 5ca:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 5cd:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 5d0:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 5d3:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 5d6:	89 d0                	mov    %edx,%eax
+ 5d8:	31 d2                	xor    %edx,%edx
+ 5da:	89 c1                	mov    %eax,%ecx
+ 5dc:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 5e1:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 5e4:	8b 40 04             	mov    0x4(%eax),%eax
+ 5e7:	ba 00 00 00 00       	mov    $0x0,%edx
+ 5ec:	89 df                	mov    %ebx,%edi
+ 5ee:	0f af f8             	imul   %eax,%edi
+ 5f1:	89 d6                	mov    %edx,%esi
+ 5f3:	0f af f1             	imul   %ecx,%esi
+ 5f6:	01 f7                	add    %esi,%edi
+ 5f8:	f7 e1                	mul    %ecx
+ 5fa:	89 c1                	mov    %eax,%ecx
+ 5fc:	89 d3                	mov    %edx,%ebx
+ 5fe:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 601:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 603:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 606:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 609:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 60c:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 613:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 616:	8b 40 04             	mov    0x4(%eax),%eax
+ 619:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 61c:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 623:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 626:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 629:	89 d7                	mov    %edx,%edi
+ 62b:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 62e:	0f af fe             	imul   %esi,%edi
+ 631:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 634:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 637:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 63a:	0f af f0             	imul   %eax,%esi
+ 63d:	01 f7                	add    %esi,%edi
+ 63f:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 642:	f7 65 d8             	mull   -0x28(%ebp)
+ 645:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 648:	89 f2                	mov    %esi,%edx
+ 64a:	89 d0                	mov    %edx,%eax
+ 64c:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 64e:	01 c8                	add    %ecx,%eax
+ 650:	11 da                	adc    %ebx,%edx
+}
+ 652:	83 c4 24             	add    $0x24,%esp
+ 655:	5b                   	pop    %ebx
+ 656:	5e                   	pop    %esi
+ 657:	5f                   	pop    %edi
+ 658:	5d                   	pop    %ebp
+ 659:	c3                   	ret
+
+0000065a <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 65a:	55                   	push   %ebp
+ 65b:	89 e5                	mov    %esp,%ebp
+ 65d:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 660:	8b 45 08             	mov    0x8(%ebp),%eax
+ 663:	8b 50 04             	mov    0x4(%eax),%edx
+ 666:	8b 45 08             	mov    0x8(%ebp),%eax
+ 669:	8b 00                	mov    (%eax),%eax
+ 66b:	29 c2                	sub    %eax,%edx
+ 66d:	83 fa 1f             	cmp    $0x1f,%edx
+ 670:	76 07                	jbe    679 <ring_queue+0x1f>
+    return -1;
+ 672:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 677:	eb 68                	jmp    6e1 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 679:	8b 45 08             	mov    0x8(%ebp),%eax
+ 67c:	8b 40 04             	mov    0x4(%eax),%eax
+ 67f:	83 e0 1f             	and    $0x1f,%eax
+ 682:	89 c2                	mov    %eax,%edx
+ 684:	89 d0                	mov    %edx,%eax
+ 686:	c1 e0 02             	shl    $0x2,%eax
+ 689:	01 d0                	add    %edx,%eax
+ 68b:	c1 e0 02             	shl    $0x2,%eax
+ 68e:	8d 50 10             	lea    0x10(%eax),%edx
+ 691:	8b 45 08             	mov    0x8(%ebp),%eax
+ 694:	01 d0                	add    %edx,%eax
+ 696:	83 c0 04             	add    $0x4,%eax
+ 699:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 69c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 69f:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 6a2:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 6a4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6a7:	8b 55 10             	mov    0x10(%ebp),%edx
+ 6aa:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 6ad:	8b 55 14             	mov    0x14(%ebp),%edx
+ 6b0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b3:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 6b6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6b9:	8b 55 18             	mov    0x18(%ebp),%edx
+ 6bc:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 6bf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 6c2:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 6c5:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 6c8:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 6cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d0:	8b 40 04             	mov    0x4(%eax),%eax
+ 6d3:	8d 50 01             	lea    0x1(%eax),%edx
+ 6d6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d9:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 6dc:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 6e1:	c9                   	leave
+ 6e2:	c3                   	ret
+
+000006e3 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 6e3:	55                   	push   %ebp
+ 6e4:	89 e5                	mov    %esp,%ebp
+ 6e6:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 6e9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 6ee:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 6f2:	7f 1a                	jg     70e <ring_submit+0x2b>
+ 6f4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f7:	8b 40 10             	mov    0x10(%eax),%eax
+ 6fa:	83 e0 01             	and    $0x1,%eax
+ 6fd:	85 c0                	test   %eax,%eax
+ 6ff:	74 0d                	je     70e <ring_submit+0x2b>
+ 701:	8b 45 08             	mov    0x8(%ebp),%eax
+ 704:	8b 40 10             	mov    0x10(%eax),%eax
+ 707:	83 e0 02             	and    $0x2,%eax
+ 70a:	85 c0                	test   %eax,%eax
+ 70c:	74 10                	je     71e <ring_submit+0x3b>
+    return ring_enter(min);
+ 70e:	83 ec 0c             	sub    $0xc,%esp
+ 711:	ff 75 0c             	push   0xc(%ebp)
+ 714:	e8 83 01 00 00       	call   89c <ring_enter>
+ 719:	83 c4 10             	add    $0x10,%esp
+ 71c:	eb 10                	jmp    72e <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 71e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 721:	8b 50 0c             	mov    0xc(%eax),%edx
+ 724:	8b 45 08             	mov    0x8(%ebp),%eax
+ 727:	8b 40 08             	mov    0x8(%eax),%eax
+ 72a:	29 c2                	sub    %eax,%edx
+ 72c:	89 d0                	mov    %edx,%eax
+}
+ 72e:	c9                   	leave
+ 72f:	c3                   	ret
+
+00000730 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 730:	55                   	push   %ebp
+ 731:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 733:	8b 45 08             	mov    0x8(%ebp),%eax
+ 736:	8b 50 08             	mov    0x8(%eax),%edx
+ 739:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73c:	8b 40 0c             	mov    0xc(%eax),%eax
+ 73f:	39 c2                	cmp    %eax,%edx
+ 741:	75 07                	jne    74a <ring_reap+0x1a>
+    return -1;
+ 743:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 748:	eb 3b                	jmp    785 <ring_reap+0x55>
+  __sync_synchronize();
+ 74a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 74f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 752:	8b 40 08             	mov    0x8(%eax),%eax
+ 755:	83 e0 1f             	and    $0x1f,%eax
+ 758:	89 c2                	mov    %eax,%edx
+ 75a:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 75d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 760:	83 c2 52             	add    $0x52,%edx
+ 763:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 767:	8b 02                	mov    (%edx),%eax
+ 769:	8b 52 04             	mov    0x4(%edx),%edx
+ 76c:	89 01                	mov    %eax,(%ecx)
+ 76e:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 771:	8b 45 08             	mov    0x8(%ebp),%eax
+ 774:	8b 40 08             	mov    0x8(%eax),%eax
+ 777:	8d 50 01             	lea    0x1(%eax),%edx
+ 77a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 77d:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 780:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 785:	5d                   	pop    %ebp
+ 786:	c3                   	ret
+
+00000787 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 787:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 78e:	74 0a                	je     79a <usyscall+0x13>
+  movl %esp, %ecx
+ 790:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 792:	ba 99 07 00 00       	mov    $0x799,%edx
+  sysenter
+ 797:	0f 34                	sysenter
+2:
+  ret
+ 799:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 79a:	cd 40                	int    $0x40
+  ret
+ 79c:	c3                   	ret
+
+0000079d <fork>:
+
+SYSCALL(fork)
+ 79d:	b8 01 00 00 00       	mov    $0x1,%eax
+ 7a2:	eb e3                	jmp    787 <usyscall>
+
+000007a4 <exit>:
+SYSCALL(exit)
+ 7a4:	b8 02 00 00 00       	mov    $0x2,%eax
+ 7a9:	eb dc                	jmp    787 <usyscall>
+
+000007ab <wait>:
+SYSCALL(wait)
+ 7ab:	b8 03 00 00 00       	mov    $0x3,%eax
+ 7b0:	eb d5                	jmp    787 <usyscall>
+
+000007b2 <pipe>:
+SYSCALL(pipe)
+ 7b2:	b8 04 00 00 00       	mov    $0x4,%eax
+ 7b7:	eb ce                	jmp    787 <usyscall>
+
+000007b9 <read>:
+SYSCALL(read)
+ 7b9:	b8 05 00 00 00       	mov    $0x5,%eax
+ 7be:	eb c7                	jmp    787 <usyscall>
+
+000007c0 <write>:
+SYSCALL(write)
+ 7c0:	b8 10 00 00 00       	mov    $0x10,%eax
+ 7c5:	eb c0                	jmp    787 <usyscall>
+
+000007c7 <close>:
+SYSCALL(close)
+ 7c7:	b8 15 00 00 00       	mov    $0x15,%eax
+ 7cc:	eb b9                	jmp    787 <usyscall>
+
+000007ce <kill>:
+SYSCALL(kill)
+ 7ce:	b8 06 00 00 00       	mov    $0x6,%eax
+ 7d3:	eb b2                	jmp    787 <usyscall>
+
+000007d5 <exec>:
+SYSCALL(exec)
+ 7d5:	b8 07 00 00 00       	mov    $0x7,%eax
+ 7da:	eb ab                	jmp    787 <usyscall>
+
+000007dc <open>:
+SYSCALL(open)
+ 7dc:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 7e1:	eb a4                	jmp    787 <usyscall>
+
+000007e3 <mknod>:
+SYSCALL(mknod)
+ 7e3:	b8 11 00 00 00       	mov    $0x11,%eax
+ 7e8:	eb 9d                	jmp    787 <usyscall>
+
+000007ea <unlink>:
+SYSCALL(unlink)
+ 7ea:	b8 12 00 00 00       	mov    $0x12,%eax
+ 7ef:	eb 96                	jmp    787 <usyscall>
+
+000007f1 <fstat>:
+SYSCALL(fstat)
+ 7f1:	b8 08 00 00 00       	mov    $0x8,%eax
+ 7f6:	eb 8f                	jmp    787 <usyscall>
+
+000007f8 <link>:
+SYSCALL(link)
+ 7f8:	b8 13 00 00 00       	mov    $0x13,%eax
+ 7fd:	eb 88                	jmp    787 <usyscall>
+
+000007ff <mkdir>:
+SYSCALL(mkdir)
+ 7ff:	b8 14 00 00 00       	mov    $0x14,%eax
+ 804:	eb 81                	jmp    787 <usyscall>
+
+00000806 <chdir>:
+SYSCALL(chdir)
+ 806:	b8 09 00 00 00       	mov    $0x9,%eax
+ 80b:	e9 77 ff ff ff       	jmp    787 <usyscall>
+
+00000810 <dup>:
+SYSCALL(dup)
+ 810:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 815:	e9 6d ff ff ff       	jmp    787 <usyscall>
+
+0000081a <getpid>:
+SYSCALL(getpid)
+ 81a:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 81f:	e9 63 ff ff ff       	jmp    787 <usyscall>
+
+00000824 <sbrk>:
+SYSCALL(sbrk)
+ 824:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 829:	e9 59 ff ff ff       	jmp    787 <usyscall>
+
+0000082e <sleep>:
+SYSCALL(sleep)
+ 82e:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 833:	e9 4f ff ff ff       	jmp    787 <usyscall>
+
+00000838 <uptime>:
+SYSCALL(uptime)
+ 838:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 83d:	e9 45 ff ff ff       	jmp    787 <usyscall>
+
+00000842 <kmstat>:
+SYSCALL(kmstat)
+ 842:	b8 16 00 00 00       	mov    $0x16,%eax
+ 847:	e9 3b ff ff ff       	jmp    787 <usyscall>
+
+0000084c <setpriority>:
+SYSCALL(setpriority)
+ 84c:	b8 17 00 00 00       	mov    $0x17,%eax
+ 851:	e9 31 ff ff ff       	jmp    787 <usyscall>
+
+00000856 <clone>:
+SYSCALL(clone)
+ 856:	b8 18 00 00 00       	mov    $0x18,%eax
+ 85b:	e9 27 ff ff ff       	jmp    787 <usyscall>
+
+00000860 <join>:
+SYSCALL(join)
+ 860:	b8 19 00 00 00       	mov    $0x19,%eax
+ 865:	e9 1d ff ff ff       	jmp    787 <usyscall>
+
+0000086a <futex_wait>:
+SYSCALL(futex_wait)
+ 86a:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 86f:	e9 13 ff ff ff       	jmp    787 <usyscall>
+
+00000874 <futex_wake>:
+SYSCALL(futex_wake)
+ 874:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 879:	e9 09 ff ff ff       	jmp    787 <usyscall>
+
+0000087e <lockstat>:
+SYSCALL(lockstat)
+ 87e:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 883:	e9 ff fe ff ff       	jmp    787 <usyscall>
+
+00000888 <sysstat>:
+SYSCALL(sysstat)
+ 888:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 88d:	e9 f5 fe ff ff       	jmp    787 <usyscall>
+
+00000892 <ring_setup>:
+SYSCALL(ring_setup)
+ 892:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 897:	e9 eb fe ff ff       	jmp    787 <usyscall>
+
+0000089c <ring_enter>:
+SYSCALL(ring_enter)
+ 89c:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 8a1:	e9 e1 fe ff ff       	jmp    787 <usyscall>
+
+000008a6 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 8a6:	55                   	push   %ebp
+ 8a7:	89 e5                	mov    %esp,%ebp
+ 8a9:	83 ec 18             	sub    $0x18,%esp
+ 8ac:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8af:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 8b2:	83 ec 04             	sub    $0x4,%esp
+ 8b5:	6a 01                	push   $0x1
+ 8b7:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 8ba:	50                   	push   %eax
+ 8bb:	ff 75 08             	push   0x8(%ebp)
+ 8be:	e8 fd fe ff ff       	call   7c0 <write>
+ 8c3:	83 c4 10             	add    $0x10,%esp
+}
+ 8c6:	90                   	nop
+ 8c7:	c9                   	leave
+ 8c8:	c3                   	ret
+
+000008c9 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 8c9:	55                   	push   %ebp
+ 8ca:	89 e5                	mov    %esp,%ebp
+ 8cc:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 8cf:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 8d6:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 8da:	74 17                	je     8f3 <printint+0x2a>
+ 8dc:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 8e0:	79 11                	jns    8f3 <printint+0x2a>
+    neg = 1;
+ 8e2:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 8e9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8ec:	f7 d8                	neg    %eax
+ 8ee:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 8f1:	eb 06                	jmp    8f9 <printint+0x30>
+  } else {
+    x = xx;
+ 8f3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 8f6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 8f9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 900:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 903:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 906:	ba 00 00 00 00       	mov    $0x0,%edx
+ 90b:	f7 f1                	div    %ecx
+ 90d:	89 d1                	mov    %edx,%ecx
+ 90f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 912:	8d 50 01             	lea    0x1(%eax),%edx
+ 915:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 918:	0f b6 91 98 12 00 00 	movzbl 0x1298(%ecx),%edx
+ 91f:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 923:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 926:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 929:	ba 00 00 00 00       	mov    $0x0,%edx
+ 92e:	f7 f1                	div    %ecx
+ 930:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 933:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 937:	75 c7                	jne    900 <printint+0x37>
+  if(neg)
+ 939:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 93d:	74 2d                	je     96c <printint+0xa3>
+    buf[i++] = '-';
+ 93f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 942:	8d 50 01             	lea    0x1(%eax),%edx
+ 945:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 948:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 94d:	eb 1d                	jmp    96c <printint+0xa3>
+    putc(fd, buf[i]);
+ 94f:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 952:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 955:	01 d0                	add    %edx,%eax
+ 957:	0f b6 00             	movzbl (%eax),%eax
+ 95a:	0f be c0             	movsbl %al,%eax
+ 95d:	83 ec 08             	sub    $0x8,%esp
+ 960:	50                   	push   %eax
+ 961:	ff 75 08             	push   0x8(%ebp)
+ 964:	e8 3d ff ff ff       	call   8a6 <putc>
+ 969:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 96c:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 970:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 974:	79 d9                	jns    94f <printint+0x86>
+}
+ 976:	90                   	nop
+ 977:	90                   	nop
+ 978:	c9                   	leave
+ 979:	c3                   	ret
+
+0000097a <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 97a:	55                   	push   %ebp
+ 97b:	89 e5                	mov    %esp,%ebp
+ 97d:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 980:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 987:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 98a:	83 c0 04             	add    $0x4,%eax
+ 98d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 990:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 997:	e9 59 01 00 00       	jmp    af5 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 99c:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 99f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9a2:	01 d0                	add    %edx,%eax
+ 9a4:	0f b6 00             	movzbl (%eax),%eax
+ 9a7:	0f be c0             	movsbl %al,%eax
+ 9aa:	25 ff 00 00 00       	and    $0xff,%eax
+ 9af:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 9b2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9b6:	75 2c                	jne    9e4 <printf+0x6a>
+      if(c == '%'){
+ 9b8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 9bc:	75 0c                	jne    9ca <printf+0x50>
+        state = '%';
+ 9be:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 9c5:	e9 27 01 00 00       	jmp    af1 <printf+0x177>
+      } else {
+        putc(fd, c);
+ 9ca:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9cd:	0f be c0             	movsbl %al,%eax
+ 9d0:	83 ec 08             	sub    $0x8,%esp
+ 9d3:	50                   	push   %eax
+ 9d4:	ff 75 08             	push   0x8(%ebp)
+ 9d7:	e8 ca fe ff ff       	call   8a6 <putc>
+ 9dc:	83 c4 10             	add    $0x10,%esp
+ 9df:	e9 0d 01 00 00       	jmp    af1 <printf+0x177>
+      }
+    } else if(state == '%'){
+ 9e4:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 9e8:	0f 85 03 01 00 00    	jne    af1 <printf+0x177>
+      if(c == 'd'){
+ 9ee:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 9f2:	75 1e                	jne    a12 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 9f4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 9f7:	8b 00                	mov    (%eax),%eax
+ 9f9:	6a 01                	push   $0x1
+ 9fb:	6a 0a                	push   $0xa
+ 9fd:	50                   	push   %eax
+ 9fe:	ff 75 08             	push   0x8(%ebp)
+ a01:	e8 c3 fe ff ff       	call   8c9 <printint>
+ a06:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a09:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a0d:	e9 d8 00 00 00       	jmp    aea <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a12:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a16:	74 06                	je     a1e <printf+0xa4>
+ a18:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a1c:	75 1e                	jne    a3c <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a1e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a21:	8b 00                	mov    (%eax),%eax
+ a23:	6a 00                	push   $0x0
+ a25:	6a 10                	push   $0x10
+ a27:	50                   	push   %eax
+ a28:	ff 75 08             	push   0x8(%ebp)
+ a2b:	e8 99 fe ff ff       	call   8c9 <printint>
+ a30:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a33:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a37:	e9 ae 00 00 00       	jmp    aea <printf+0x170>
+      } else if(c == 's'){
+ a3c:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ a40:	75 43                	jne    a85 <printf+0x10b>
+        s = (char*)*ap;
+ a42:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a45:	8b 00                	mov    (%eax),%eax
+ a47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ a4a:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ a4e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a52:	75 25                	jne    a79 <printf+0xff>
+          s = "(null)";
+ a54:	c7 45 f4 dc 0d 00 00 	movl   $0xddc,-0xc(%ebp)
+        while(*s != 0){
+ a5b:	eb 1c                	jmp    a79 <printf+0xff>
+          putc(fd, *s);
+ a5d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a60:	0f b6 00             	movzbl (%eax),%eax
+ a63:	0f be c0             	movsbl %al,%eax
+ a66:	83 ec 08             	sub    $0x8,%esp
+ a69:	50                   	push   %eax
+ a6a:	ff 75 08             	push   0x8(%ebp)
+ a6d:	e8 34 fe ff ff       	call   8a6 <putc>
+ a72:	83 c4 10             	add    $0x10,%esp
+          s++;
+ a75:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ a79:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ a7c:	0f b6 00             	movzbl (%eax),%eax
+ a7f:	84 c0                	test   %al,%al
+ a81:	75 da                	jne    a5d <printf+0xe3>
+ a83:	eb 65                	jmp    aea <printf+0x170>
+        }
+      } else if(c == 'c'){
+ a85:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ a89:	75 1d                	jne    aa8 <printf+0x12e>
+        putc(fd, *ap);
+ a8b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a8e:	8b 00                	mov    (%eax),%eax
+ a90:	0f be c0             	movsbl %al,%eax
+ a93:	83 ec 08             	sub    $0x8,%esp
+ a96:	50                   	push   %eax
+ a97:	ff 75 08             	push   0x8(%ebp)
+ a9a:	e8 07 fe ff ff       	call   8a6 <putc>
+ a9f:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ aa2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ aa6:	eb 42                	jmp    aea <printf+0x170>
+      } else if(c == '%'){
+ aa8:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ aac:	75 17                	jne    ac5 <printf+0x14b>
+        putc(fd, c);
+ aae:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ab1:	0f be c0             	movsbl %al,%eax
+ ab4:	83 ec 08             	sub    $0x8,%esp
+ ab7:	50                   	push   %eax
+ ab8:	ff 75 08             	push   0x8(%ebp)
+ abb:	e8 e6 fd ff ff       	call   8a6 <putc>
+ ac0:	83 c4 10             	add    $0x10,%esp
+ ac3:	eb 25                	jmp    aea <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ ac5:	83 ec 08             	sub    $0x8,%esp
+ ac8:	6a 25                	push   $0x25
+ aca:	ff 75 08             	push   0x8(%ebp)
+ acd:	e8 d4 fd ff ff       	call   8a6 <putc>
+ ad2:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ ad5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ ad8:	0f be c0             	movsbl %al,%eax
+ adb:	83 ec 08             	sub    $0x8,%esp
+ ade:	50                   	push   %eax
+ adf:	ff 75 08             	push   0x8(%ebp)
+ ae2:	e8 bf fd ff ff       	call   8a6 <putc>
+ ae7:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ aea:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ af1:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ af5:	8b 55 0c             	mov    0xc(%ebp),%edx
+ af8:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ afb:	01 d0                	add    %edx,%eax
+ afd:	0f b6 00             	movzbl (%eax),%eax
+ b00:	84 c0                	test   %al,%al
+ b02:	0f 85 94 fe ff ff    	jne    99c <printf+0x22>
+    }
+  }
+}
+ b08:	90                   	nop
+ b09:	90                   	nop
+ b0a:	c9                   	leave
+ b0b:	c3                   	ret
+
+00000b0c <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b0c:	55                   	push   %ebp
+ b0d:	89 e5                	mov    %esp,%ebp
+ b0f:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b12:	8b 45 08             	mov    0x8(%ebp),%eax
+ b15:	83 e8 08             	sub    $0x8,%eax
+ b18:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b1b:	a1 b4 12 00 00       	mov    0x12b4,%eax
+ b20:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b23:	eb 24                	jmp    b49 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b25:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b28:	8b 00                	mov    (%eax),%eax
+ b2a:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b2d:	72 12                	jb     b41 <free+0x35>
+ b2f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b32:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b35:	72 24                	jb     b5b <free+0x4f>
+ b37:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b3a:	8b 00                	mov    (%eax),%eax
+ b3c:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b3f:	72 1a                	jb     b5b <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b41:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b44:	8b 00                	mov    (%eax),%eax
+ b46:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b49:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b4c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b4f:	73 d4                	jae    b25 <free+0x19>
+ b51:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b54:	8b 00                	mov    (%eax),%eax
+ b56:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ b59:	73 ca                	jae    b25 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ b5b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b5e:	8b 40 04             	mov    0x4(%eax),%eax
+ b61:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ b68:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b6b:	01 c2                	add    %eax,%edx
+ b6d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b70:	8b 00                	mov    (%eax),%eax
+ b72:	39 c2                	cmp    %eax,%edx
+ b74:	75 24                	jne    b9a <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ b76:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b79:	8b 50 04             	mov    0x4(%eax),%edx
+ b7c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b7f:	8b 00                	mov    (%eax),%eax
+ b81:	8b 40 04             	mov    0x4(%eax),%eax
+ b84:	01 c2                	add    %eax,%edx
+ b86:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b89:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ b8c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b8f:	8b 00                	mov    (%eax),%eax
+ b91:	8b 10                	mov    (%eax),%edx
+ b93:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b96:	89 10                	mov    %edx,(%eax)
+ b98:	eb 0a                	jmp    ba4 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ b9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b9d:	8b 10                	mov    (%eax),%edx
+ b9f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ ba2:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ ba4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba7:	8b 40 04             	mov    0x4(%eax),%eax
+ baa:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bb1:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb4:	01 d0                	add    %edx,%eax
+ bb6:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bb9:	75 20                	jne    bdb <free+0xcf>
+    p->s.size += bp->s.size;
+ bbb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbe:	8b 50 04             	mov    0x4(%eax),%edx
+ bc1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc4:	8b 40 04             	mov    0x4(%eax),%eax
+ bc7:	01 c2                	add    %eax,%edx
+ bc9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bcc:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ bcf:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd2:	8b 10                	mov    (%eax),%edx
+ bd4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd7:	89 10                	mov    %edx,(%eax)
+ bd9:	eb 08                	jmp    be3 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ bdb:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bde:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ be1:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ be3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be6:	a3 b4 12 00 00       	mov    %eax,0x12b4
+}
+ beb:	90                   	nop
+ bec:	c9                   	leave
+ bed:	c3                   	ret
+
+00000bee <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ bee:	55                   	push   %ebp
+ bef:	89 e5                	mov    %esp,%ebp
+ bf1:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ bf4:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ bfb:	77 07                	ja     c04 <morecore+0x16>
+    nu = 4096;
+ bfd:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c04:	8b 45 08             	mov    0x8(%ebp),%eax
+ c07:	c1 e0 03             	shl    $0x3,%eax
+ c0a:	83 ec 0c             	sub    $0xc,%esp
+ c0d:	50                   	push   %eax
+ c0e:	e8 11 fc ff ff       	call   824 <sbrk>
+ c13:	83 c4 10             	add    $0x10,%esp
+ c16:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c19:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c1d:	75 07                	jne    c26 <morecore+0x38>
+    return 0;
+ c1f:	b8 00 00 00 00       	mov    $0x0,%eax
+ c24:	eb 26                	jmp    c4c <morecore+0x5e>
+  hp = (Header*)p;
+ c26:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c29:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c2c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c2f:	8b 55 08             	mov    0x8(%ebp),%edx
+ c32:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ c35:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c38:	83 c0 08             	add    $0x8,%eax
+ c3b:	83 ec 0c             	sub    $0xc,%esp
+ c3e:	50                   	push   %eax
+ c3f:	e8 c8 fe ff ff       	call   b0c <free>
+ c44:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ c47:	a1 b4 12 00 00       	mov    0x12b4,%eax
+}
+ c4c:	c9                   	leave
+ c4d:	c3                   	ret
+
+00000c4e <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ c4e:	55                   	push   %ebp
+ c4f:	89 e5                	mov    %esp,%ebp
+ c51:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ c54:	8b 45 08             	mov    0x8(%ebp),%eax
+ c57:	83 c0 07             	add    $0x7,%eax
+ c5a:	c1 e8 03             	shr    $0x3,%eax
+ c5d:	83 c0 01             	add    $0x1,%eax
+ c60:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ c63:	a1 b4 12 00 00       	mov    0x12b4,%eax
+ c68:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c6b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c6f:	75 23                	jne    c94 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ c71:	c7 45 f0 ac 12 00 00 	movl   $0x12ac,-0x10(%ebp)
+ c78:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c7b:	a3 b4 12 00 00       	mov    %eax,0x12b4
+ c80:	a1 b4 12 00 00       	mov    0x12b4,%eax
+ c85:	a3 ac 12 00 00       	mov    %eax,0x12ac
+    base.s.size = 0;
+ c8a:	c7 05 b0 12 00 00 00 	movl   $0x0,0x12b0
+ c91:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ c94:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c97:	8b 00                	mov    (%eax),%eax
+ c99:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c9c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c9f:	8b 40 04             	mov    0x4(%eax),%eax
+ ca2:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ ca5:	72 4d                	jb     cf4 <malloc+0xa6>
+      if(p->s.size == nunits)
+ ca7:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ caa:	8b 40 04             	mov    0x4(%eax),%eax
+ cad:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ cb0:	75 0c                	jne    cbe <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ cb2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb5:	8b 10                	mov    (%eax),%edx
+ cb7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cba:	89 10                	mov    %edx,(%eax)
+ cbc:	eb 26                	jmp    ce4 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ cbe:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cc1:	8b 40 04             	mov    0x4(%eax),%eax
+ cc4:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ cc7:	89 c2                	mov    %eax,%edx
+ cc9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ccc:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ccf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cd2:	8b 40 04             	mov    0x4(%eax),%eax
+ cd5:	c1 e0 03             	shl    $0x3,%eax
+ cd8:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ cdb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cde:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ ce1:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ ce4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce7:	a3 b4 12 00 00       	mov    %eax,0x12b4
+      return (void*)(p + 1);
+ cec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cef:	83 c0 08             	add    $0x8,%eax
+ cf2:	eb 3b                	jmp    d2f <malloc+0xe1>
+    }
+    if(p == freep)
+ cf4:	a1 b4 12 00 00       	mov    0x12b4,%eax
+ cf9:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ cfc:	75 1e                	jne    d1c <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ cfe:	83 ec 0c             	sub    $0xc,%esp
+ d01:	ff 75 ec             	push   -0x14(%ebp)
+ d04:	e8 e5 fe ff ff       	call   bee <morecore>
+ d09:	83 c4 10             	add    $0x10,%esp
+ d0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d0f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d13:	75 07                	jne    d1c <malloc+0xce>
+        return 0;
+ d15:	b8 00 00 00 00       	mov    $0x0,%eax
+ d1a:	eb 13                	jmp    d2f <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d1f:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d25:	8b 00                	mov    (%eax),%eax
+ d27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d2a:	e9 6d ff ff ff       	jmp    c9c <malloc+0x4e>
+  }
+}
+ d2f:	c9                   	leave
+ d30:	c3                   	ret
+
+00000d31 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d31:	55                   	push   %ebp
+ d32:	89 e5                	mov    %esp,%ebp
+ d34:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ d37:	83 ec 0c             	sub    $0xc,%esp
+ d3a:	68 00 10 00 00       	push   $0x1000
+ d3f:	e8 0a ff ff ff       	call   c4e <malloc>
+ d44:	83 c4 10             	add    $0x10,%esp
+ d47:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d4a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d4e:	75 07                	jne    d57 <thread_create+0x26>
+    return -1;
+ d50:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ d55:	eb 2e                	jmp    d85 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ d57:	83 ec 04             	sub    $0x4,%esp
+ d5a:	ff 75 f4             	push   -0xc(%ebp)
+ d5d:	ff 75 0c             	push   0xc(%ebp)
+ d60:	ff 75 08             	push   0x8(%ebp)
+ d63:	e8 ee fa ff ff       	call   856 <clone>
+ d68:	83 c4 10             	add    $0x10,%esp
+ d6b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d6e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ d72:	79 0e                	jns    d82 <thread_create+0x51>
+    free(stack);
+ d74:	83 ec 0c             	sub    $0xc,%esp
+ d77:	ff 75 f4             	push   -0xc(%ebp)
+ d7a:	e8 8d fd ff ff       	call   b0c <free>
+ d7f:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ d82:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ d85:	c9                   	leave
+ d86:	c3                   	ret
+
+00000d87 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ d87:	55                   	push   %ebp
+ d88:	89 e5                	mov    %esp,%ebp
+ d8a:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ d8d:	83 ec 0c             	sub    $0xc,%esp
+ d90:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ d93:	50                   	push   %eax
+ d94:	e8 c7 fa ff ff       	call   860 <join>
+ d99:	83 c4 10             	add    $0x10,%esp
+ d9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d9f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ da3:	78 0f                	js     db4 <thread_join+0x2d>
+    free(stack);
+ da5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ da8:	83 ec 0c             	sub    $0xc,%esp
+ dab:	50                   	push   %eax
+ dac:	e8 5b fd ff ff       	call   b0c <free>
+ db1:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ db4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ db7:	c9                   	leave
+ db8:	c3                   	ret
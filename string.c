@@ -19,6 +19,13 @@ memcmp(const void *v1, const void *v2, uint n)
   
   s1 = v1;
   s2 = v2;
+  // Skip equal words; the bytes decide the order.
+  if(((uint)s1 | (uint)s2) % 4 == 0)
+    while(n >= 4 && *(uint*)s1 == *(uint*)s2){
+      s1 += 4;
+      s2 += 4;
+      n -= 4;
+    }
   while(n-- > 0){
     if(*s1 != *s2)
       return *s1 - *s2;
@@ -28,23 +35,43 @@ memcmp(const void *v1, const void *v2, uint n)
   return 0;
 }
 
+// Copies forward with rep movs, 4 bytes at a time once dst
+// is aligned.  An overlapping copy to a higher address must go
+// backward; that is rare, and done in C rather than with std,
+// since an interrupt would find the direction flag set.
 void*
 memmove(void *dst, const void *src, uint n)
 {
   const char *s;
   char *d;
+  uint m;
 
   s = src;
   d = dst;
   if(s < d && s + n > d){
     s += n;
     d += n;
-    while(n-- > 0)
-      *--d = *--s;
-  } else
-    while(n-- > 0)
-      *d++ = *s++;
+    if(((uint)s | (uint)d | n) % 4 == 0){
+      for(; n > 0; n -= 4){
+        d -= 4;
+        s -= 4;
+        *(uint*)d = *(uint*)s;
+      }
+    } else
+      while(n-- > 0)
+        *--d = *--s;
+    return dst;
+  }
 
+  if(n >= 16){
+    m = -(uint)d % 4;
+    n -= m;
+    asm volatile("cld; rep movsb" : "+D" (d), "+S" (s), "+c" (m) : : "memory");
+    m = n / 4;
+    n %= 4;
+    asm volatile("rep movsl" : "+D" (d), "+S" (s), "+c" (m) : : "memory");
+  }
+  asm volatile("cld; rep movsb" : "+D" (d), "+S" (s), "+c" (n) : : "memory");
   return dst;
 }
 
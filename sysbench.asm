@@ -0,0 +1,1982 @@
+
+_sysbench:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <rdtsc>:
+#include "traps.h"
+#include "vdso.h"
+
+static inline uint
+rdtsc(void)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 10             	sub    $0x10,%esp
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+   6:	0f 31                	rdtsc
+   8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+   b:	89 55 f8             	mov    %edx,-0x8(%ebp)
+  return lo;
+   e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  11:	c9                   	leave
+  12:	c3                   	ret
+
+00000013 <intgetpid>:
+
+static int
+intgetpid(void)
+{
+  13:	55                   	push   %ebp
+  14:	89 e5                	mov    %esp,%ebp
+  16:	83 ec 10             	sub    $0x10,%esp
+  int r;
+
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  19:	b8 0b 00 00 00       	mov    $0xb,%eax
+  1e:	cd 40                	int    $0x40
+  20:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  return r;
+  23:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  26:	c9                   	leave
+  27:	c3                   	ret
+
+00000028 <sysentergetpid>:
+
+static int
+sysentergetpid(void)
+{
+  28:	55                   	push   %ebp
+  29:	89 e5                	mov    %esp,%ebp
+  2b:	83 ec 10             	sub    $0x10,%esp
+  int r;
+
+  asm volatile("movl %%esp, %%ecx\n\t"
+  2e:	b8 0b 00 00 00       	mov    $0xb,%eax
+  33:	89 e1                	mov    %esp,%ecx
+  35:	ba 3c 00 00 00       	mov    $0x3c,%edx
+  3a:	0f 34                	sysenter
+  3c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+               "movl $1f, %%edx\n\t"
+               "sysenter\n"
+               "1:"
+               : "=a" (r) : "a" (SYS_getpid) : "ecx", "edx", "memory");
+  return r;
+  3f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  42:	c9                   	leave
+  43:	c3                   	ret
+
+00000044 <timecalls>:
+
+// Best average cycles per call of fn over nruns runs of n calls.
+uint
+timecalls(int (*fn)(void), int n, int nruns)
+{
+  44:	55                   	push   %ebp
+  45:	89 e5                	mov    %esp,%ebp
+  47:	83 ec 18             	sub    $0x18,%esp
+  uint t, best;
+  int i, j;
+
+  best = 0xffffffff;
+  4a:	c7 45 f4 ff ff ff ff 	movl   $0xffffffff,-0xc(%ebp)
+  for(j = 0; j < nruns; j++){
+  51:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  58:	eb 49                	jmp    a3 <timecalls+0x5f>
+    t = rdtsc();
+  5a:	e8 a1 ff ff ff       	call   0 <rdtsc>
+  5f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    for(i = 0; i < n; i++)
+  62:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  69:	eb 09                	jmp    74 <timecalls+0x30>
+      fn();
+  6b:	8b 45 08             	mov    0x8(%ebp),%eax
+  6e:	ff d0                	call   *%eax
+    for(i = 0; i < n; i++)
+  70:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+  74:	8b 45 f0             	mov    -0x10(%ebp),%eax
+  77:	3b 45 0c             	cmp    0xc(%ebp),%eax
+  7a:	7c ef                	jl     6b <timecalls+0x27>
+    t = (rdtsc() - t) / n;
+  7c:	e8 7f ff ff ff       	call   0 <rdtsc>
+  81:	2b 45 e8             	sub    -0x18(%ebp),%eax
+  84:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+  87:	ba 00 00 00 00       	mov    $0x0,%edx
+  8c:	f7 f1                	div    %ecx
+  8e:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(t < best)
+  91:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  94:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+  97:	73 06                	jae    9f <timecalls+0x5b>
+      best = t;
+  99:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  9c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(j = 0; j < nruns; j++){
+  9f:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+  a3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  a6:	3b 45 10             	cmp    0x10(%ebp),%eax
+  a9:	7c af                	jl     5a <timecalls+0x16>
+  }
+  return best;
+  ab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+  ae:	c9                   	leave
+  af:	c3                   	ret
+
+000000b0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+  b0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  b4:	83 e4 f0             	and    $0xfffffff0,%esp
+  b7:	ff 71 fc             	push   -0x4(%ecx)
+  ba:	55                   	push   %ebp
+  bb:	89 e5                	mov    %esp,%ebp
+  bd:	53                   	push   %ebx
+  be:	51                   	push   %ecx
+  bf:	83 ec 10             	sub    $0x10,%esp
+  c2:	89 cb                	mov    %ecx,%ebx
+  int n, nruns, pid, sep;
+
+  n = 100000;
+  c4:	c7 45 f4 a0 86 01 00 	movl   $0x186a0,-0xc(%ebp)
+  nruns = 5;
+  cb:	c7 45 f0 05 00 00 00 	movl   $0x5,-0x10(%ebp)
+  if(argc > 1)
+  d2:	83 3b 01             	cmpl   $0x1,(%ebx)
+  d5:	7e 17                	jle    ee <main+0x3e>
+    n = atoi(argv[1]);
+  d7:	8b 43 04             	mov    0x4(%ebx),%eax
+  da:	83 c0 04             	add    $0x4,%eax
+  dd:	8b 00                	mov    (%eax),%eax
+  df:	83 ec 0c             	sub    $0xc,%esp
+  e2:	50                   	push   %eax
+  e3:	e8 10 03 00 00       	call   3f8 <atoi>
+  e8:	83 c4 10             	add    $0x10,%esp
+  eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(argc > 2)
+  ee:	83 3b 02             	cmpl   $0x2,(%ebx)
+  f1:	7e 17                	jle    10a <main+0x5a>
+    nruns = atoi(argv[2]);
+  f3:	8b 43 04             	mov    0x4(%ebx),%eax
+  f6:	83 c0 08             	add    $0x8,%eax
+  f9:	8b 00                	mov    (%eax),%eax
+  fb:	83 ec 0c             	sub    $0xc,%esp
+  fe:	50                   	push   %eax
+  ff:	e8 f4 02 00 00       	call   3f8 <atoi>
+ 104:	83 c4 10             	add    $0x10,%esp
+ 107:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(n <= 0 || nruns <= 0){
+ 10a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 10e:	7e 06                	jle    116 <main+0x66>
+ 110:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 114:	7f 17                	jg     12d <main+0x7d>
+    printf(2, "usage: sysbench [ncalls [nruns]]\n");
+ 116:	83 ec 08             	sub    $0x8,%esp
+ 119:	68 48 0e 00 00       	push   $0xe48
+ 11e:	6a 02                	push   $0x2
+ 120:	e8 e4 08 00 00       	call   a09 <printf>
+ 125:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 128:	e8 06 07 00 00       	call   833 <exit>
+  }
+
+  sep = ((struct vdso*)VDSO)->sysenter;
+ 12d:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 132:	8b 40 10             	mov    0x10(%eax),%eax
+ 135:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  pid = getpid();
+ 138:	e8 6c 07 00 00       	call   8a9 <getpid>
+ 13d:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(intgetpid() != pid || (sep && sysentergetpid() != pid)){
+ 140:	e8 ce fe ff ff       	call   13 <intgetpid>
+ 145:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 148:	75 10                	jne    15a <main+0xaa>
+ 14a:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 14e:	74 21                	je     171 <main+0xc1>
+ 150:	e8 d3 fe ff ff       	call   28 <sysentergetpid>
+ 155:	39 45 e8             	cmp    %eax,-0x18(%ebp)
+ 158:	74 17                	je     171 <main+0xc1>
+    printf(2, "sysbench: getpid mismatch\n");
+ 15a:	83 ec 08             	sub    $0x8,%esp
+ 15d:	68 6a 0e 00 00       	push   $0xe6a
+ 162:	6a 02                	push   $0x2
+ 164:	e8 a0 08 00 00       	call   a09 <printf>
+ 169:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 16c:	e8 c2 06 00 00       	call   833 <exit>
+  }
+  printf(1, "sysbench: int $%d: %d cycles/call\n", T_SYSCALL,
+ 171:	83 ec 04             	sub    $0x4,%esp
+ 174:	ff 75 f0             	push   -0x10(%ebp)
+ 177:	ff 75 f4             	push   -0xc(%ebp)
+ 17a:	68 13 00 00 00       	push   $0x13
+ 17f:	e8 c0 fe ff ff       	call   44 <timecalls>
+ 184:	83 c4 10             	add    $0x10,%esp
+ 187:	50                   	push   %eax
+ 188:	6a 40                	push   $0x40
+ 18a:	68 88 0e 00 00       	push   $0xe88
+ 18f:	6a 01                	push   $0x1
+ 191:	e8 73 08 00 00       	call   a09 <printf>
+ 196:	83 c4 10             	add    $0x10,%esp
+         timecalls(intgetpid, n, nruns));
+  if(sep)
+ 199:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 19d:	74 2b                	je     1ca <main+0x11a>
+    printf(1, "sysbench: sysenter: %d cycles/call\n",
+ 19f:	83 ec 04             	sub    $0x4,%esp
+ 1a2:	ff 75 f0             	push   -0x10(%ebp)
+ 1a5:	ff 75 f4             	push   -0xc(%ebp)
+ 1a8:	68 28 00 00 00       	push   $0x28
+ 1ad:	e8 92 fe ff ff       	call   44 <timecalls>
+ 1b2:	83 c4 10             	add    $0x10,%esp
+ 1b5:	83 ec 04             	sub    $0x4,%esp
+ 1b8:	50                   	push   %eax
+ 1b9:	68 ac 0e 00 00       	push   $0xeac
+ 1be:	6a 01                	push   $0x1
+ 1c0:	e8 44 08 00 00       	call   a09 <printf>
+ 1c5:	83 c4 10             	add    $0x10,%esp
+ 1c8:	eb 12                	jmp    1dc <main+0x12c>
+           timecalls(sysentergetpid, n, nruns));
+  else
+    printf(1, "sysbench: sysenter: not supported\n");
+ 1ca:	83 ec 08             	sub    $0x8,%esp
+ 1cd:	68 d0 0e 00 00       	push   $0xed0
+ 1d2:	6a 01                	push   $0x1
+ 1d4:	e8 30 08 00 00       	call   a09 <printf>
+ 1d9:	83 c4 10             	add    $0x10,%esp
+  exit();
+ 1dc:	e8 52 06 00 00       	call   833 <exit>
+
+000001e1 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 1e1:	55                   	push   %ebp
+ 1e2:	89 e5                	mov    %esp,%ebp
+ 1e4:	57                   	push   %edi
+ 1e5:	53                   	push   %ebx
+char*
+ 1e6:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1e9:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ef:	89 cb                	mov    %ecx,%ebx
+ 1f1:	89 df                	mov    %ebx,%edi
+ 1f3:	89 d1                	mov    %edx,%ecx
+ 1f5:	fc                   	cld
+ 1f6:	f3 aa                	rep stos %al,%es:(%edi)
+ 1f8:	89 ca                	mov    %ecx,%edx
+ 1fa:	89 fb                	mov    %edi,%ebx
+ 1fc:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1ff:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 202:	90                   	nop
+ 203:	5b                   	pop    %ebx
+ 204:	5f                   	pop    %edi
+ 205:	5d                   	pop    %ebp
+ 206:	c3                   	ret
+
+00000207 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 207:	55                   	push   %ebp
+ 208:	89 e5                	mov    %esp,%ebp
+ 20a:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 20d:	8b 55 08             	mov    0x8(%ebp),%edx
+ 210:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 213:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 216:	f0 87 02             	lock xchg %eax,(%edx)
+ 219:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 21c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 21f:	c9                   	leave
+ 220:	c3                   	ret
+
+00000221 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 221:	55                   	push   %ebp
+ 222:	89 e5                	mov    %esp,%ebp
+ 224:	53                   	push   %ebx
+ 225:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 228:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 22b:	8b 55 10             	mov    0x10(%ebp),%edx
+ 22e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 231:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 234:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 238:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 23b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 23e:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 241:	c9                   	leave
+ 242:	c3                   	ret
+
+00000243 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 243:	55                   	push   %ebp
+ 244:	89 e5                	mov    %esp,%ebp
+ 246:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 249:	0f 31                	rdtsc
+ 24b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 24e:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 251:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 254:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 257:	c9                   	leave
+ 258:	c3                   	ret
+
+00000259 <strcpy>:
+{
+ 259:	55                   	push   %ebp
+ 25a:	89 e5                	mov    %esp,%ebp
+ 25c:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 25f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 262:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 265:	90                   	nop
+ 266:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 269:	8d 42 01             	lea    0x1(%edx),%eax
+ 26c:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 26f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 272:	8d 48 01             	lea    0x1(%eax),%ecx
+ 275:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 278:	0f b6 12             	movzbl (%edx),%edx
+ 27b:	88 10                	mov    %dl,(%eax)
+ 27d:	0f b6 00             	movzbl (%eax),%eax
+ 280:	84 c0                	test   %al,%al
+ 282:	75 e2                	jne    266 <strcpy+0xd>
+  return os;
+ 284:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 287:	c9                   	leave
+ 288:	c3                   	ret
+
+00000289 <strcmp>:
+{
+ 289:	55                   	push   %ebp
+ 28a:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 28c:	eb 08                	jmp    296 <strcmp+0xd>
+    p++, q++;
+ 28e:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 292:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 296:	8b 45 08             	mov    0x8(%ebp),%eax
+ 299:	0f b6 00             	movzbl (%eax),%eax
+ 29c:	84 c0                	test   %al,%al
+ 29e:	74 10                	je     2b0 <strcmp+0x27>
+ 2a0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2a3:	0f b6 10             	movzbl (%eax),%edx
+ 2a6:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2a9:	0f b6 00             	movzbl (%eax),%eax
+ 2ac:	38 c2                	cmp    %al,%dl
+ 2ae:	74 de                	je     28e <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 2b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2b3:	0f b6 00             	movzbl (%eax),%eax
+ 2b6:	0f b6 d0             	movzbl %al,%edx
+ 2b9:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2bc:	0f b6 00             	movzbl (%eax),%eax
+ 2bf:	0f b6 c0             	movzbl %al,%eax
+ 2c2:	29 c2                	sub    %eax,%edx
+ 2c4:	89 d0                	mov    %edx,%eax
+}
+ 2c6:	5d                   	pop    %ebp
+ 2c7:	c3                   	ret
+
+000002c8 <strlen>:
+{
+ 2c8:	55                   	push   %ebp
+ 2c9:	89 e5                	mov    %esp,%ebp
+ 2cb:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 2ce:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2d5:	eb 04                	jmp    2db <strlen+0x13>
+ 2d7:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e1:	01 d0                	add    %edx,%eax
+ 2e3:	0f b6 00             	movzbl (%eax),%eax
+ 2e6:	84 c0                	test   %al,%al
+ 2e8:	75 ed                	jne    2d7 <strlen+0xf>
+  return n;
+ 2ea:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2ed:	c9                   	leave
+ 2ee:	c3                   	ret
+
+000002ef <memset>:
+{
+ 2ef:	55                   	push   %ebp
+ 2f0:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2f2:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2f5:	50                   	push   %eax
+ 2f6:	ff 75 0c             	push   0xc(%ebp)
+ 2f9:	ff 75 08             	push   0x8(%ebp)
+ 2fc:	e8 e0 fe ff ff       	call   1e1 <stosb>
+ 301:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 304:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 307:	c9                   	leave
+ 308:	c3                   	ret
+
+00000309 <strchr>:
+{
+ 309:	55                   	push   %ebp
+ 30a:	89 e5                	mov    %esp,%ebp
+ 30c:	83 ec 04             	sub    $0x4,%esp
+ 30f:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 312:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 315:	eb 14                	jmp    32b <strchr+0x22>
+    if(*s == c)
+ 317:	8b 45 08             	mov    0x8(%ebp),%eax
+ 31a:	0f b6 00             	movzbl (%eax),%eax
+ 31d:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 320:	75 05                	jne    327 <strchr+0x1e>
+      return (char*)s;
+ 322:	8b 45 08             	mov    0x8(%ebp),%eax
+ 325:	eb 13                	jmp    33a <strchr+0x31>
+  for(; *s; s++)
+ 327:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 32b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 32e:	0f b6 00             	movzbl (%eax),%eax
+ 331:	84 c0                	test   %al,%al
+ 333:	75 e2                	jne    317 <strchr+0xe>
+  return 0;
+ 335:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 33a:	c9                   	leave
+ 33b:	c3                   	ret
+
+0000033c <gets>:
+{
+ 33c:	55                   	push   %ebp
+ 33d:	89 e5                	mov    %esp,%ebp
+ 33f:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 342:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 349:	eb 42                	jmp    38d <gets+0x51>
+    cc = read(0, &c, 1);
+ 34b:	83 ec 04             	sub    $0x4,%esp
+ 34e:	6a 01                	push   $0x1
+ 350:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 353:	50                   	push   %eax
+ 354:	6a 00                	push   $0x0
+ 356:	e8 ed 04 00 00       	call   848 <read>
+ 35b:	83 c4 10             	add    $0x10,%esp
+ 35e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 361:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 365:	7e 33                	jle    39a <gets+0x5e>
+    buf[i++] = c;
+ 367:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 36a:	8d 50 01             	lea    0x1(%eax),%edx
+ 36d:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 370:	89 c2                	mov    %eax,%edx
+ 372:	8b 45 08             	mov    0x8(%ebp),%eax
+ 375:	01 c2                	add    %eax,%edx
+ 377:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 37b:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 37d:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 381:	3c 0a                	cmp    $0xa,%al
+ 383:	74 16                	je     39b <gets+0x5f>
+ 385:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 389:	3c 0d                	cmp    $0xd,%al
+ 38b:	74 0e                	je     39b <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 38d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 390:	83 c0 01             	add    $0x1,%eax
+ 393:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 396:	7f b3                	jg     34b <gets+0xf>
+ 398:	eb 01                	jmp    39b <gets+0x5f>
+      break;
+ 39a:	90                   	nop
+  buf[i] = '\0';
+ 39b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 39e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3a1:	01 d0                	add    %edx,%eax
+ 3a3:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 3a6:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 3a9:	c9                   	leave
+ 3aa:	c3                   	ret
+
+000003ab <stat>:
+{
+ 3ab:	55                   	push   %ebp
+ 3ac:	89 e5                	mov    %esp,%ebp
+ 3ae:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 3b1:	83 ec 08             	sub    $0x8,%esp
+ 3b4:	6a 00                	push   $0x0
+ 3b6:	ff 75 08             	push   0x8(%ebp)
+ 3b9:	e8 ad 04 00 00       	call   86b <open>
+ 3be:	83 c4 10             	add    $0x10,%esp
+ 3c1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3c4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3c8:	79 07                	jns    3d1 <stat+0x26>
+    return -1;
+ 3ca:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3cf:	eb 25                	jmp    3f6 <stat+0x4b>
+  r = fstat(fd, st);
+ 3d1:	83 ec 08             	sub    $0x8,%esp
+ 3d4:	ff 75 0c             	push   0xc(%ebp)
+ 3d7:	ff 75 f4             	push   -0xc(%ebp)
+ 3da:	e8 a1 04 00 00       	call   880 <fstat>
+ 3df:	83 c4 10             	add    $0x10,%esp
+ 3e2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3e5:	83 ec 0c             	sub    $0xc,%esp
+ 3e8:	ff 75 f4             	push   -0xc(%ebp)
+ 3eb:	e8 66 04 00 00       	call   856 <close>
+ 3f0:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3f3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3f6:	c9                   	leave
+ 3f7:	c3                   	ret
+
+000003f8 <atoi>:
+{
+ 3f8:	55                   	push   %ebp
+ 3f9:	89 e5                	mov    %esp,%ebp
+ 3fb:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 3fe:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 405:	eb 25                	jmp    42c <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 407:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 40a:	89 d0                	mov    %edx,%eax
+ 40c:	c1 e0 02             	shl    $0x2,%eax
+ 40f:	01 d0                	add    %edx,%eax
+ 411:	01 c0                	add    %eax,%eax
+ 413:	89 c1                	mov    %eax,%ecx
+ 415:	8b 45 08             	mov    0x8(%ebp),%eax
+ 418:	8d 50 01             	lea    0x1(%eax),%edx
+ 41b:	89 55 08             	mov    %edx,0x8(%ebp)
+ 41e:	0f b6 00             	movzbl (%eax),%eax
+ 421:	0f be c0             	movsbl %al,%eax
+ 424:	01 c8                	add    %ecx,%eax
+ 426:	83 e8 30             	sub    $0x30,%eax
+ 429:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 42c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42f:	0f b6 00             	movzbl (%eax),%eax
+ 432:	3c 2f                	cmp    $0x2f,%al
+ 434:	7e 0a                	jle    440 <atoi+0x48>
+ 436:	8b 45 08             	mov    0x8(%ebp),%eax
+ 439:	0f b6 00             	movzbl (%eax),%eax
+ 43c:	3c 39                	cmp    $0x39,%al
+ 43e:	7e c7                	jle    407 <atoi+0xf>
+  return n;
+ 440:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 443:	c9                   	leave
+ 444:	c3                   	ret
+
+00000445 <memmove>:
+{
+ 445:	55                   	push   %ebp
+ 446:	89 e5                	mov    %esp,%ebp
+ 448:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 44b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 44e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 451:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 454:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 457:	eb 17                	jmp    470 <memmove+0x2b>
+    *dst++ = *src++;
+ 459:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 45c:	8d 42 01             	lea    0x1(%edx),%eax
+ 45f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 462:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 465:	8d 48 01             	lea    0x1(%eax),%ecx
+ 468:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 46b:	0f b6 12             	movzbl (%edx),%edx
+ 46e:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 470:	8b 45 10             	mov    0x10(%ebp),%eax
+ 473:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 476:	89 55 10             	mov    %edx,0x10(%ebp)
+ 479:	85 c0                	test   %eax,%eax
+ 47b:	7f dc                	jg     459 <memmove+0x14>
+  return vdst;
+ 47d:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 480:	c9                   	leave
+ 481:	c3                   	ret
+
+00000482 <mutex_init>:
+{
+ 482:	55                   	push   %ebp
+ 483:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 485:	8b 45 08             	mov    0x8(%ebp),%eax
+ 488:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 48e:	90                   	nop
+ 48f:	5d                   	pop    %ebp
+ 490:	c3                   	ret
+
+00000491 <mutex_lock>:
+{
+ 491:	55                   	push   %ebp
+ 492:	89 e5                	mov    %esp,%ebp
+ 494:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 497:	8b 45 08             	mov    0x8(%ebp),%eax
+ 49a:	6a 01                	push   $0x1
+ 49c:	6a 00                	push   $0x0
+ 49e:	50                   	push   %eax
+ 49f:	e8 7d fd ff ff       	call   221 <cmpxchg>
+ 4a4:	83 c4 0c             	add    $0xc,%esp
+ 4a7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 4aa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ae:	74 46                	je     4f6 <mutex_lock+0x65>
+  if(c != 2)
+ 4b0:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 4b4:	74 38                	je     4ee <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b9:	6a 02                	push   $0x2
+ 4bb:	50                   	push   %eax
+ 4bc:	e8 46 fd ff ff       	call   207 <xchg>
+ 4c1:	83 c4 08             	add    $0x8,%esp
+ 4c4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 4c7:	eb 25                	jmp    4ee <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 4c9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4cc:	83 ec 08             	sub    $0x8,%esp
+ 4cf:	6a 02                	push   $0x2
+ 4d1:	50                   	push   %eax
+ 4d2:	e8 22 04 00 00       	call   8f9 <futex_wait>
+ 4d7:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 4da:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4dd:	83 ec 08             	sub    $0x8,%esp
+ 4e0:	6a 02                	push   $0x2
+ 4e2:	50                   	push   %eax
+ 4e3:	e8 1f fd ff ff       	call   207 <xchg>
+ 4e8:	83 c4 10             	add    $0x10,%esp
+ 4eb:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 4ee:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4f2:	75 d5                	jne    4c9 <mutex_lock+0x38>
+ 4f4:	eb 01                	jmp    4f7 <mutex_lock+0x66>
+    return;
+ 4f6:	90                   	nop
+}
+ 4f7:	c9                   	leave
+ 4f8:	c3                   	ret
+
+000004f9 <mutex_unlock>:
+{
+ 4f9:	55                   	push   %ebp
+ 4fa:	89 e5                	mov    %esp,%ebp
+ 4fc:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 4ff:	8b 45 08             	mov    0x8(%ebp),%eax
+ 502:	6a 00                	push   $0x0
+ 504:	50                   	push   %eax
+ 505:	e8 fd fc ff ff       	call   207 <xchg>
+ 50a:	83 c4 08             	add    $0x8,%esp
+ 50d:	83 f8 02             	cmp    $0x2,%eax
+ 510:	75 11                	jne    523 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 512:	8b 45 08             	mov    0x8(%ebp),%eax
+ 515:	83 ec 08             	sub    $0x8,%esp
+ 518:	6a 01                	push   $0x1
+ 51a:	50                   	push   %eax
+ 51b:	e8 e3 03 00 00       	call   903 <futex_wake>
+ 520:	83 c4 10             	add    $0x10,%esp
+}
+ 523:	90                   	nop
+ 524:	c9                   	leave
+ 525:	c3                   	ret
+
+00000526 <cond_init>:
+{
+ 526:	55                   	push   %ebp
+ 527:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 529:	8b 45 08             	mov    0x8(%ebp),%eax
+ 52c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 532:	90                   	nop
+ 533:	5d                   	pop    %ebp
+ 534:	c3                   	ret
+
+00000535 <cond_wait>:
+{
+ 535:	55                   	push   %ebp
+ 536:	89 e5                	mov    %esp,%ebp
+ 538:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 53b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53e:	8b 00                	mov    (%eax),%eax
+ 540:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 543:	83 ec 0c             	sub    $0xc,%esp
+ 546:	ff 75 0c             	push   0xc(%ebp)
+ 549:	e8 ab ff ff ff       	call   4f9 <mutex_unlock>
+ 54e:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 551:	8b 45 08             	mov    0x8(%ebp),%eax
+ 554:	83 ec 08             	sub    $0x8,%esp
+ 557:	ff 75 f4             	push   -0xc(%ebp)
+ 55a:	50                   	push   %eax
+ 55b:	e8 99 03 00 00       	call   8f9 <futex_wait>
+ 560:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 563:	eb 11                	jmp    576 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 565:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 568:	83 ec 08             	sub    $0x8,%esp
+ 56b:	6a 02                	push   $0x2
+ 56d:	50                   	push   %eax
+ 56e:	e8 86 03 00 00       	call   8f9 <futex_wait>
+ 573:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 576:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 579:	83 ec 08             	sub    $0x8,%esp
+ 57c:	6a 02                	push   $0x2
+ 57e:	50                   	push   %eax
+ 57f:	e8 83 fc ff ff       	call   207 <xchg>
+ 584:	83 c4 10             	add    $0x10,%esp
+ 587:	85 c0                	test   %eax,%eax
+ 589:	75 da                	jne    565 <cond_wait+0x30>
+}
+ 58b:	90                   	nop
+ 58c:	90                   	nop
+ 58d:	c9                   	leave
+ 58e:	c3                   	ret
+
+0000058f <condbump>:
+{
+ 58f:	55                   	push   %ebp
+ 590:	89 e5                	mov    %esp,%ebp
+ 592:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 595:	8b 45 08             	mov    0x8(%ebp),%eax
+ 598:	8b 00                	mov    (%eax),%eax
+ 59a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 59d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 5a0:	8d 50 01             	lea    0x1(%eax),%edx
+ 5a3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5a6:	52                   	push   %edx
+ 5a7:	ff 75 fc             	push   -0x4(%ebp)
+ 5aa:	50                   	push   %eax
+ 5ab:	e8 71 fc ff ff       	call   221 <cmpxchg>
+ 5b0:	83 c4 0c             	add    $0xc,%esp
+ 5b3:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 5b6:	75 dd                	jne    595 <condbump+0x6>
+}
+ 5b8:	90                   	nop
+ 5b9:	90                   	nop
+ 5ba:	c9                   	leave
+ 5bb:	c3                   	ret
+
+000005bc <cond_signal>:
+{
+ 5bc:	55                   	push   %ebp
+ 5bd:	89 e5                	mov    %esp,%ebp
+ 5bf:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 5c2:	ff 75 08             	push   0x8(%ebp)
+ 5c5:	e8 c5 ff ff ff       	call   58f <condbump>
+ 5ca:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 5cd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d0:	83 ec 08             	sub    $0x8,%esp
+ 5d3:	6a 01                	push   $0x1
+ 5d5:	50                   	push   %eax
+ 5d6:	e8 28 03 00 00       	call   903 <futex_wake>
+ 5db:	83 c4 10             	add    $0x10,%esp
+}
+ 5de:	90                   	nop
+ 5df:	c9                   	leave
+ 5e0:	c3                   	ret
+
+000005e1 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 5e1:	55                   	push   %ebp
+ 5e2:	89 e5                	mov    %esp,%ebp
+ 5e4:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 5e7:	ff 75 08             	push   0x8(%ebp)
+ 5ea:	e8 a0 ff ff ff       	call   58f <condbump>
+ 5ef:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 5f2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5f5:	83 ec 08             	sub    $0x8,%esp
+ 5f8:	68 ff ff ff 7f       	push   $0x7fffffff
+ 5fd:	50                   	push   %eax
+ 5fe:	e8 00 03 00 00       	call   903 <futex_wake>
+ 603:	83 c4 10             	add    $0x10,%esp
+}
+ 606:	90                   	nop
+ 607:	c9                   	leave
+ 608:	c3                   	ret
+
+00000609 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 609:	55                   	push   %ebp
+ 60a:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 60c:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 611:	8b 00                	mov    (%eax),%eax
+}
+ 613:	5d                   	pop    %ebp
+ 614:	c3                   	ret
+
+00000615 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 615:	55                   	push   %ebp
+ 616:	89 e5                	mov    %esp,%ebp
+ 618:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 61b:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 620:	8b 00                	mov    (%eax),%eax
+ 622:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 625:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 629:	74 05                	je     630 <vgetpid+0x1b>
+    return pid;
+ 62b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 62e:	eb 05                	jmp    635 <vgetpid+0x20>
+  return getpid();
+ 630:	e8 74 02 00 00       	call   8a9 <getpid>
+}
+ 635:	c9                   	leave
+ 636:	c3                   	ret
+
+00000637 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 637:	55                   	push   %ebp
+ 638:	89 e5                	mov    %esp,%ebp
+ 63a:	57                   	push   %edi
+ 63b:	56                   	push   %esi
+ 63c:	53                   	push   %ebx
+ 63d:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 640:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 647:	e8 f7 fb ff ff       	call   243 <rdtsc>
+ 64c:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 64f:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 652:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 655:	29 c8                	sub    %ecx,%eax
+ 657:	19 da                	sbb    %ebx,%edx
+ 659:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 65c:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 65f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 662:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 665:	89 d0                	mov    %edx,%eax
+ 667:	31 d2                	xor    %edx,%edx
+ 669:	89 c1                	mov    %eax,%ecx
+ 66b:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 670:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 673:	8b 40 04             	mov    0x4(%eax),%eax
+ 676:	ba 00 00 00 00       	mov    $0x0,%edx
+ 67b:	89 df                	mov    %ebx,%edi
+ 67d:	0f af f8             	imul   %eax,%edi
+ 680:	89 d6                	mov    %edx,%esi
+ 682:	0f af f1             	imul   %ecx,%esi
+ 685:	01 f7                	add    %esi,%edi
+ 687:	f7 e1                	mul    %ecx
+ 689:	89 c1                	mov    %eax,%ecx
+ 68b:	89 d3                	mov    %edx,%ebx
+ 68d:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 690:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 692:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 695:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 698:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 69b:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 6a2:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 6a5:	8b 40 04             	mov    0x4(%eax),%eax
+ 6a8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 6ab:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 6b2:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 6b5:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 6b8:	89 d7                	mov    %edx,%edi
+ 6ba:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 6bd:	0f af fe             	imul   %esi,%edi
+ 6c0:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 6c3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 6c6:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 6c9:	0f af f0             	imul   %eax,%esi
+ 6cc:	01 f7                	add    %esi,%edi
+ 6ce:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6d1:	f7 65 d8             	mull   -0x28(%ebp)
+ 6d4:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 6d7:	89 f2                	mov    %esi,%edx
+ 6d9:	89 d0                	mov    %edx,%eax
+ 6db:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 6dd:	01 c8                	add    %ecx,%eax
+ 6df:	11 da                	adc    %ebx,%edx
+}
+ 6e1:	83 c4 24             	add    $0x24,%esp
+ 6e4:	5b                   	pop    %ebx
+ 6e5:	5e                   	pop    %esi
+ 6e6:	5f                   	pop    %edi
+ 6e7:	5d                   	pop    %ebp
+ 6e8:	c3                   	ret
+
+000006e9 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 6e9:	55                   	push   %ebp
+ 6ea:	89 e5                	mov    %esp,%ebp
+ 6ec:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 6ef:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f2:	8b 50 04             	mov    0x4(%eax),%edx
+ 6f5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6f8:	8b 00                	mov    (%eax),%eax
+ 6fa:	29 c2                	sub    %eax,%edx
+ 6fc:	83 fa 1f             	cmp    $0x1f,%edx
+ 6ff:	76 07                	jbe    708 <ring_queue+0x1f>
+    return -1;
+ 701:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 706:	eb 68                	jmp    770 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 708:	8b 45 08             	mov    0x8(%ebp),%eax
+ 70b:	8b 40 04             	mov    0x4(%eax),%eax
+ 70e:	83 e0 1f             	and    $0x1f,%eax
+ 711:	89 c2                	mov    %eax,%edx
+ 713:	89 d0                	mov    %edx,%eax
+ 715:	c1 e0 02             	shl    $0x2,%eax
+ 718:	01 d0                	add    %edx,%eax
+ 71a:	c1 e0 02             	shl    $0x2,%eax
+ 71d:	8d 50 10             	lea    0x10(%eax),%edx
+ 720:	8b 45 08             	mov    0x8(%ebp),%eax
+ 723:	01 d0                	add    %edx,%eax
+ 725:	83 c0 04             	add    $0x4,%eax
+ 728:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 72b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72e:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 731:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 733:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 736:	8b 55 10             	mov    0x10(%ebp),%edx
+ 739:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 73c:	8b 55 14             	mov    0x14(%ebp),%edx
+ 73f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 742:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 745:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 748:	8b 55 18             	mov    0x18(%ebp),%edx
+ 74b:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 74e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 751:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 754:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 757:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 75c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 75f:	8b 40 04             	mov    0x4(%eax),%eax
+ 762:	8d 50 01             	lea    0x1(%eax),%edx
+ 765:	8b 45 08             	mov    0x8(%ebp),%eax
+ 768:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 76b:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 770:	c9                   	leave
+ 771:	c3                   	ret
+
+00000772 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 772:	55                   	push   %ebp
+ 773:	89 e5                	mov    %esp,%ebp
+ 775:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 778:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 77d:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 781:	7f 1a                	jg     79d <ring_submit+0x2b>
+ 783:	8b 45 08             	mov    0x8(%ebp),%eax
+ 786:	8b 40 10             	mov    0x10(%eax),%eax
+ 789:	83 e0 01             	and    $0x1,%eax
+ 78c:	85 c0                	test   %eax,%eax
+ 78e:	74 0d                	je     79d <ring_submit+0x2b>
+ 790:	8b 45 08             	mov    0x8(%ebp),%eax
+ 793:	8b 40 10             	mov    0x10(%eax),%eax
+ 796:	83 e0 02             	and    $0x2,%eax
+ 799:	85 c0                	test   %eax,%eax
+ 79b:	74 10                	je     7ad <ring_submit+0x3b>
+    return ring_enter(min);
+ 79d:	83 ec 0c             	sub    $0xc,%esp
+ 7a0:	ff 75 0c             	push   0xc(%ebp)
+ 7a3:	e8 83 01 00 00       	call   92b <ring_enter>
+ 7a8:	83 c4 10             	add    $0x10,%esp
+ 7ab:	eb 10                	jmp    7bd <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 7ad:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b0:	8b 50 0c             	mov    0xc(%eax),%edx
+ 7b3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7b6:	8b 40 08             	mov    0x8(%eax),%eax
+ 7b9:	29 c2                	sub    %eax,%edx
+ 7bb:	89 d0                	mov    %edx,%eax
+}
+ 7bd:	c9                   	leave
+ 7be:	c3                   	ret
+
+000007bf <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 7bf:	55                   	push   %ebp
+ 7c0:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 7c2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7c5:	8b 50 08             	mov    0x8(%eax),%edx
+ 7c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cb:	8b 40 0c             	mov    0xc(%eax),%eax
+ 7ce:	39 c2                	cmp    %eax,%edx
+ 7d0:	75 07                	jne    7d9 <ring_reap+0x1a>
+    return -1;
+ 7d2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7d7:	eb 3b                	jmp    814 <ring_reap+0x55>
+  __sync_synchronize();
+ 7d9:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 7de:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e1:	8b 40 08             	mov    0x8(%eax),%eax
+ 7e4:	83 e0 1f             	and    $0x1f,%eax
+ 7e7:	89 c2                	mov    %eax,%edx
+ 7e9:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 7ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7ef:	83 c2 52             	add    $0x52,%edx
+ 7f2:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 7f6:	8b 02                	mov    (%edx),%eax
+ 7f8:	8b 52 04             	mov    0x4(%edx),%edx
+ 7fb:	89 01                	mov    %eax,(%ecx)
+ 7fd:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 800:	8b 45 08             	mov    0x8(%ebp),%eax
+ 803:	8b 40 08             	mov    0x8(%eax),%eax
+ 806:	8d 50 01             	lea    0x1(%eax),%edx
+ 809:	8b 45 08             	mov    0x8(%ebp),%eax
+ 80c:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 80f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 814:	5d                   	pop    %ebp
+ 815:	c3                   	ret
+
+00000816 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 816:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 81d:	74 0a                	je     829 <usyscall+0x13>
+  movl %esp, %ecx
+ 81f:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 821:	ba 28 08 00 00       	mov    $0x828,%edx
+  sysenter
+ 826:	0f 34                	sysenter
+2:
+  ret
+ 828:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 829:	cd 40                	int    $0x40
+  ret
+ 82b:	c3                   	ret
+
+0000082c <fork>:
+
+SYSCALL(fork)
+ 82c:	b8 01 00 00 00       	mov    $0x1,%eax
+ 831:	eb e3                	jmp    816 <usyscall>
+
+00000833 <exit>:
+SYSCALL(exit)
+ 833:	b8 02 00 00 00       	mov    $0x2,%eax
+ 838:	eb dc                	jmp    816 <usyscall>
+
+0000083a <wait>:
+SYSCALL(wait)
+ 83a:	b8 03 00 00 00       	mov    $0x3,%eax
+ 83f:	eb d5                	jmp    816 <usyscall>
+
+00000841 <pipe>:
+SYSCALL(pipe)
+ 841:	b8 04 00 00 00       	mov    $0x4,%eax
+ 846:	eb ce                	jmp    816 <usyscall>
+
+00000848 <read>:
+SYSCALL(read)
+ 848:	b8 05 00 00 00       	mov    $0x5,%eax
+ 84d:	eb c7                	jmp    816 <usyscall>
+
+0000084f <write>:
+SYSCALL(write)
+ 84f:	b8 10 00 00 00       	mov    $0x10,%eax
+ 854:	eb c0                	jmp    816 <usyscall>
+
+00000856 <close>:
+SYSCALL(close)
+ 856:	b8 15 00 00 00       	mov    $0x15,%eax
+ 85b:	eb b9                	jmp    816 <usyscall>
+
+0000085d <kill>:
+SYSCALL(kill)
+ 85d:	b8 06 00 00 00       	mov    $0x6,%eax
+ 862:	eb b2                	jmp    816 <usyscall>
+
+00000864 <exec>:
+SYSCALL(exec)
+ 864:	b8 07 00 00 00       	mov    $0x7,%eax
+ 869:	eb ab                	jmp    816 <usyscall>
+
+0000086b <open>:
+SYSCALL(open)
+ 86b:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 870:	eb a4                	jmp    816 <usyscall>
+
+00000872 <mknod>:
+SYSCALL(mknod)
+ 872:	b8 11 00 00 00       	mov    $0x11,%eax
+ 877:	eb 9d                	jmp    816 <usyscall>
+
+00000879 <unlink>:
+SYSCALL(unlink)
+ 879:	b8 12 00 00 00       	mov    $0x12,%eax
+ 87e:	eb 96                	jmp    816 <usyscall>
+
+00000880 <fstat>:
+SYSCALL(fstat)
+ 880:	b8 08 00 00 00       	mov    $0x8,%eax
+ 885:	eb 8f                	jmp    816 <usyscall>
+
+00000887 <link>:
+SYSCALL(link)
+ 887:	b8 13 00 00 00       	mov    $0x13,%eax
+ 88c:	eb 88                	jmp    816 <usyscall>
+
+0000088e <mkdir>:
+SYSCALL(mkdir)
+ 88e:	b8 14 00 00 00       	mov    $0x14,%eax
+ 893:	eb 81                	jmp    816 <usyscall>
+
+00000895 <chdir>:
+SYSCALL(chdir)
+ 895:	b8 09 00 00 00       	mov    $0x9,%eax
+ 89a:	e9 77 ff ff ff       	jmp    816 <usyscall>
+
+0000089f <dup>:
+SYSCALL(dup)
+ 89f:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 8a4:	e9 6d ff ff ff       	jmp    816 <usyscall>
+
+000008a9 <getpid>:
+SYSCALL(getpid)
+ 8a9:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 8ae:	e9 63 ff ff ff       	jmp    816 <usyscall>
+
+000008b3 <sbrk>:
+SYSCALL(sbrk)
+ 8b3:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 8b8:	e9 59 ff ff ff       	jmp    816 <usyscall>
+
+000008bd <sleep>:
+SYSCALL(sleep)
+ 8bd:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 8c2:	e9 4f ff ff ff       	jmp    816 <usyscall>
+
+000008c7 <uptime>:
+SYSCALL(uptime)
+ 8c7:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8cc:	e9 45 ff ff ff       	jmp    816 <usyscall>
+
+000008d1 <kmstat>:
+SYSCALL(kmstat)
+ 8d1:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8d6:	e9 3b ff ff ff       	jmp    816 <usyscall>
+
+000008db <setpriority>:
+SYSCALL(setpriority)
+ 8db:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8e0:	e9 31 ff ff ff       	jmp    816 <usyscall>
+
+000008e5 <clone>:
+SYSCALL(clone)
+ 8e5:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8ea:	e9 27 ff ff ff       	jmp    816 <usyscall>
+
+000008ef <join>:
+SYSCALL(join)
+ 8ef:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8f4:	e9 1d ff ff ff       	jmp    816 <usyscall>
+
+000008f9 <futex_wait>:
+SYSCALL(futex_wait)
+ 8f9:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8fe:	e9 13 ff ff ff       	jmp    816 <usyscall>
+
+00000903 <futex_wake>:
+SYSCALL(futex_wake)
+ 903:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 908:	e9 09 ff ff ff       	jmp    816 <usyscall>
+
+0000090d <lockstat>:
+SYSCALL(lockstat)
+ 90d:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 912:	e9 ff fe ff ff       	jmp    816 <usyscall>
+
+00000917 <sysstat>:
+SYSCALL(sysstat)
+ 917:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 91c:	e9 f5 fe ff ff       	jmp    816 <usyscall>
+
+00000921 <ring_setup>:
+SYSCALL(ring_setup)
+ 921:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 926:	e9 eb fe ff ff       	jmp    816 <usyscall>
+
+0000092b <ring_enter>:
+SYSCALL(ring_enter)
+ 92b:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 930:	e9 e1 fe ff ff       	jmp    816 <usyscall>
+
+00000935 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 935:	55                   	push   %ebp
+ 936:	89 e5                	mov    %esp,%ebp
+ 938:	83 ec 18             	sub    $0x18,%esp
+ 93b:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 93e:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 941:	83 ec 04             	sub    $0x4,%esp
+ 944:	6a 01                	push   $0x1
+ 946:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 949:	50                   	push   %eax
+ 94a:	ff 75 08             	push   0x8(%ebp)
+ 94d:	e8 fd fe ff ff       	call   84f <write>
+ 952:	83 c4 10             	add    $0x10,%esp
+}
+ 955:	90                   	nop
+ 956:	c9                   	leave
+ 957:	c3                   	ret
+
+00000958 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 958:	55                   	push   %ebp
+ 959:	89 e5                	mov    %esp,%ebp
+ 95b:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 95e:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 965:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 969:	74 17                	je     982 <printint+0x2a>
+ 96b:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 96f:	79 11                	jns    982 <printint+0x2a>
+    neg = 1;
+ 971:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 978:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 97b:	f7 d8                	neg    %eax
+ 97d:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 980:	eb 06                	jmp    988 <printint+0x30>
+  } else {
+    x = xx;
+ 982:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 985:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 988:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 98f:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 992:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 995:	ba 00 00 00 00       	mov    $0x0,%edx
+ 99a:	f7 f1                	div    %ecx
+ 99c:	89 d1                	mov    %edx,%ecx
+ 99e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9a1:	8d 50 01             	lea    0x1(%eax),%edx
+ 9a4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 9a7:	0f b6 91 34 14 00 00 	movzbl 0x1434(%ecx),%edx
+ 9ae:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 9b2:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 9b5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 9b8:	ba 00 00 00 00       	mov    $0x0,%edx
+ 9bd:	f7 f1                	div    %ecx
+ 9bf:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 9c2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9c6:	75 c7                	jne    98f <printint+0x37>
+  if(neg)
+ 9c8:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9cc:	74 2d                	je     9fb <printint+0xa3>
+    buf[i++] = '-';
+ 9ce:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9d1:	8d 50 01             	lea    0x1(%eax),%edx
+ 9d4:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 9d7:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 9dc:	eb 1d                	jmp    9fb <printint+0xa3>
+    putc(fd, buf[i]);
+ 9de:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 9e1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9e4:	01 d0                	add    %edx,%eax
+ 9e6:	0f b6 00             	movzbl (%eax),%eax
+ 9e9:	0f be c0             	movsbl %al,%eax
+ 9ec:	83 ec 08             	sub    $0x8,%esp
+ 9ef:	50                   	push   %eax
+ 9f0:	ff 75 08             	push   0x8(%ebp)
+ 9f3:	e8 3d ff ff ff       	call   935 <putc>
+ 9f8:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 9fb:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9ff:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ a03:	79 d9                	jns    9de <printint+0x86>
+}
+ a05:	90                   	nop
+ a06:	90                   	nop
+ a07:	c9                   	leave
+ a08:	c3                   	ret
+
+00000a09 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ a09:	55                   	push   %ebp
+ a0a:	89 e5                	mov    %esp,%ebp
+ a0c:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ a0f:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ a16:	8d 45 0c             	lea    0xc(%ebp),%eax
+ a19:	83 c0 04             	add    $0x4,%eax
+ a1c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ a1f:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ a26:	e9 59 01 00 00       	jmp    b84 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ a2b:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a2e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a31:	01 d0                	add    %edx,%eax
+ a33:	0f b6 00             	movzbl (%eax),%eax
+ a36:	0f be c0             	movsbl %al,%eax
+ a39:	25 ff 00 00 00       	and    $0xff,%eax
+ a3e:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ a41:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a45:	75 2c                	jne    a73 <printf+0x6a>
+      if(c == '%'){
+ a47:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a4b:	75 0c                	jne    a59 <printf+0x50>
+        state = '%';
+ a4d:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a54:	e9 27 01 00 00       	jmp    b80 <printf+0x177>
+      } else {
+        putc(fd, c);
+ a59:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a5c:	0f be c0             	movsbl %al,%eax
+ a5f:	83 ec 08             	sub    $0x8,%esp
+ a62:	50                   	push   %eax
+ a63:	ff 75 08             	push   0x8(%ebp)
+ a66:	e8 ca fe ff ff       	call   935 <putc>
+ a6b:	83 c4 10             	add    $0x10,%esp
+ a6e:	e9 0d 01 00 00       	jmp    b80 <printf+0x177>
+      }
+    } else if(state == '%'){
+ a73:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a77:	0f 85 03 01 00 00    	jne    b80 <printf+0x177>
+      if(c == 'd'){
+ a7d:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a81:	75 1e                	jne    aa1 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a83:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a86:	8b 00                	mov    (%eax),%eax
+ a88:	6a 01                	push   $0x1
+ a8a:	6a 0a                	push   $0xa
+ a8c:	50                   	push   %eax
+ a8d:	ff 75 08             	push   0x8(%ebp)
+ a90:	e8 c3 fe ff ff       	call   958 <printint>
+ a95:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a98:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a9c:	e9 d8 00 00 00       	jmp    b79 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ aa1:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ aa5:	74 06                	je     aad <printf+0xa4>
+ aa7:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ aab:	75 1e                	jne    acb <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ aad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ab0:	8b 00                	mov    (%eax),%eax
+ ab2:	6a 00                	push   $0x0
+ ab4:	6a 10                	push   $0x10
+ ab6:	50                   	push   %eax
+ ab7:	ff 75 08             	push   0x8(%ebp)
+ aba:	e8 99 fe ff ff       	call   958 <printint>
+ abf:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ ac2:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ ac6:	e9 ae 00 00 00       	jmp    b79 <printf+0x170>
+      } else if(c == 's'){
+ acb:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ acf:	75 43                	jne    b14 <printf+0x10b>
+        s = (char*)*ap;
+ ad1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ad4:	8b 00                	mov    (%eax),%eax
+ ad6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ ad9:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ add:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ae1:	75 25                	jne    b08 <printf+0xff>
+          s = "(null)";
+ ae3:	c7 45 f4 f3 0e 00 00 	movl   $0xef3,-0xc(%ebp)
+        while(*s != 0){
+ aea:	eb 1c                	jmp    b08 <printf+0xff>
+          putc(fd, *s);
+ aec:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ aef:	0f b6 00             	movzbl (%eax),%eax
+ af2:	0f be c0             	movsbl %al,%eax
+ af5:	83 ec 08             	sub    $0x8,%esp
+ af8:	50                   	push   %eax
+ af9:	ff 75 08             	push   0x8(%ebp)
+ afc:	e8 34 fe ff ff       	call   935 <putc>
+ b01:	83 c4 10             	add    $0x10,%esp
+          s++;
+ b04:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ b08:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b0b:	0f b6 00             	movzbl (%eax),%eax
+ b0e:	84 c0                	test   %al,%al
+ b10:	75 da                	jne    aec <printf+0xe3>
+ b12:	eb 65                	jmp    b79 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ b14:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ b18:	75 1d                	jne    b37 <printf+0x12e>
+        putc(fd, *ap);
+ b1a:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ b1d:	8b 00                	mov    (%eax),%eax
+ b1f:	0f be c0             	movsbl %al,%eax
+ b22:	83 ec 08             	sub    $0x8,%esp
+ b25:	50                   	push   %eax
+ b26:	ff 75 08             	push   0x8(%ebp)
+ b29:	e8 07 fe ff ff       	call   935 <putc>
+ b2e:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b31:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b35:	eb 42                	jmp    b79 <printf+0x170>
+      } else if(c == '%'){
+ b37:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b3b:	75 17                	jne    b54 <printf+0x14b>
+        putc(fd, c);
+ b3d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b40:	0f be c0             	movsbl %al,%eax
+ b43:	83 ec 08             	sub    $0x8,%esp
+ b46:	50                   	push   %eax
+ b47:	ff 75 08             	push   0x8(%ebp)
+ b4a:	e8 e6 fd ff ff       	call   935 <putc>
+ b4f:	83 c4 10             	add    $0x10,%esp
+ b52:	eb 25                	jmp    b79 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b54:	83 ec 08             	sub    $0x8,%esp
+ b57:	6a 25                	push   $0x25
+ b59:	ff 75 08             	push   0x8(%ebp)
+ b5c:	e8 d4 fd ff ff       	call   935 <putc>
+ b61:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b64:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b67:	0f be c0             	movsbl %al,%eax
+ b6a:	83 ec 08             	sub    $0x8,%esp
+ b6d:	50                   	push   %eax
+ b6e:	ff 75 08             	push   0x8(%ebp)
+ b71:	e8 bf fd ff ff       	call   935 <putc>
+ b76:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b79:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b80:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b84:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b87:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b8a:	01 d0                	add    %edx,%eax
+ b8c:	0f b6 00             	movzbl (%eax),%eax
+ b8f:	84 c0                	test   %al,%al
+ b91:	0f 85 94 fe ff ff    	jne    a2b <printf+0x22>
+    }
+  }
+}
+ b97:	90                   	nop
+ b98:	90                   	nop
+ b99:	c9                   	leave
+ b9a:	c3                   	ret
+
+00000b9b <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b9b:	55                   	push   %ebp
+ b9c:	89 e5                	mov    %esp,%ebp
+ b9e:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ ba1:	8b 45 08             	mov    0x8(%ebp),%eax
+ ba4:	83 e8 08             	sub    $0x8,%eax
+ ba7:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ baa:	a1 50 14 00 00       	mov    0x1450,%eax
+ baf:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bb2:	eb 24                	jmp    bd8 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ bb4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bb7:	8b 00                	mov    (%eax),%eax
+ bb9:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bbc:	72 12                	jb     bd0 <free+0x35>
+ bbe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc1:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bc4:	72 24                	jb     bea <free+0x4f>
+ bc6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bc9:	8b 00                	mov    (%eax),%eax
+ bcb:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bce:	72 1a                	jb     bea <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bd0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bd3:	8b 00                	mov    (%eax),%eax
+ bd5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bd8:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bdb:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bde:	73 d4                	jae    bb4 <free+0x19>
+ be0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ be3:	8b 00                	mov    (%eax),%eax
+ be5:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ be8:	73 ca                	jae    bb4 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bea:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bed:	8b 40 04             	mov    0x4(%eax),%eax
+ bf0:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bf7:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bfa:	01 c2                	add    %eax,%edx
+ bfc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bff:	8b 00                	mov    (%eax),%eax
+ c01:	39 c2                	cmp    %eax,%edx
+ c03:	75 24                	jne    c29 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ c05:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c08:	8b 50 04             	mov    0x4(%eax),%edx
+ c0b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c0e:	8b 00                	mov    (%eax),%eax
+ c10:	8b 40 04             	mov    0x4(%eax),%eax
+ c13:	01 c2                	add    %eax,%edx
+ c15:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c18:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ c1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1e:	8b 00                	mov    (%eax),%eax
+ c20:	8b 10                	mov    (%eax),%edx
+ c22:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c25:	89 10                	mov    %edx,(%eax)
+ c27:	eb 0a                	jmp    c33 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ c29:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c2c:	8b 10                	mov    (%eax),%edx
+ c2e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c31:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c33:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c36:	8b 40 04             	mov    0x4(%eax),%eax
+ c39:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c40:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c43:	01 d0                	add    %edx,%eax
+ c45:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c48:	75 20                	jne    c6a <free+0xcf>
+    p->s.size += bp->s.size;
+ c4a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c4d:	8b 50 04             	mov    0x4(%eax),%edx
+ c50:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c53:	8b 40 04             	mov    0x4(%eax),%eax
+ c56:	01 c2                	add    %eax,%edx
+ c58:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c5b:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c5e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c61:	8b 10                	mov    (%eax),%edx
+ c63:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c66:	89 10                	mov    %edx,(%eax)
+ c68:	eb 08                	jmp    c72 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c6a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c6d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c70:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c72:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c75:	a3 50 14 00 00       	mov    %eax,0x1450
+}
+ c7a:	90                   	nop
+ c7b:	c9                   	leave
+ c7c:	c3                   	ret
+
+00000c7d <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c7d:	55                   	push   %ebp
+ c7e:	89 e5                	mov    %esp,%ebp
+ c80:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c83:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c8a:	77 07                	ja     c93 <morecore+0x16>
+    nu = 4096;
+ c8c:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c93:	8b 45 08             	mov    0x8(%ebp),%eax
+ c96:	c1 e0 03             	shl    $0x3,%eax
+ c99:	83 ec 0c             	sub    $0xc,%esp
+ c9c:	50                   	push   %eax
+ c9d:	e8 11 fc ff ff       	call   8b3 <sbrk>
+ ca2:	83 c4 10             	add    $0x10,%esp
+ ca5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ ca8:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ cac:	75 07                	jne    cb5 <morecore+0x38>
+    return 0;
+ cae:	b8 00 00 00 00       	mov    $0x0,%eax
+ cb3:	eb 26                	jmp    cdb <morecore+0x5e>
+  hp = (Header*)p;
+ cb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ cb8:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ cbb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cbe:	8b 55 08             	mov    0x8(%ebp),%edx
+ cc1:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ cc4:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ cc7:	83 c0 08             	add    $0x8,%eax
+ cca:	83 ec 0c             	sub    $0xc,%esp
+ ccd:	50                   	push   %eax
+ cce:	e8 c8 fe ff ff       	call   b9b <free>
+ cd3:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cd6:	a1 50 14 00 00       	mov    0x1450,%eax
+}
+ cdb:	c9                   	leave
+ cdc:	c3                   	ret
+
+00000cdd <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ cdd:	55                   	push   %ebp
+ cde:	89 e5                	mov    %esp,%ebp
+ ce0:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ ce3:	8b 45 08             	mov    0x8(%ebp),%eax
+ ce6:	83 c0 07             	add    $0x7,%eax
+ ce9:	c1 e8 03             	shr    $0x3,%eax
+ cec:	83 c0 01             	add    $0x1,%eax
+ cef:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ cf2:	a1 50 14 00 00       	mov    0x1450,%eax
+ cf7:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cfa:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cfe:	75 23                	jne    d23 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ d00:	c7 45 f0 48 14 00 00 	movl   $0x1448,-0x10(%ebp)
+ d07:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d0a:	a3 50 14 00 00       	mov    %eax,0x1450
+ d0f:	a1 50 14 00 00       	mov    0x1450,%eax
+ d14:	a3 48 14 00 00       	mov    %eax,0x1448
+    base.s.size = 0;
+ d19:	c7 05 4c 14 00 00 00 	movl   $0x0,0x144c
+ d20:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d23:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d26:	8b 00                	mov    (%eax),%eax
+ d28:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d2b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2e:	8b 40 04             	mov    0x4(%eax),%eax
+ d31:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ d34:	72 4d                	jb     d83 <malloc+0xa6>
+      if(p->s.size == nunits)
+ d36:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d39:	8b 40 04             	mov    0x4(%eax),%eax
+ d3c:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ d3f:	75 0c                	jne    d4d <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ d41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d44:	8b 10                	mov    (%eax),%edx
+ d46:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d49:	89 10                	mov    %edx,(%eax)
+ d4b:	eb 26                	jmp    d73 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d4d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d50:	8b 40 04             	mov    0x4(%eax),%eax
+ d53:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d56:	89 c2                	mov    %eax,%edx
+ d58:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5b:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d5e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d61:	8b 40 04             	mov    0x4(%eax),%eax
+ d64:	c1 e0 03             	shl    $0x3,%eax
+ d67:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d6d:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d70:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d73:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d76:	a3 50 14 00 00       	mov    %eax,0x1450
+      return (void*)(p + 1);
+ d7b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d7e:	83 c0 08             	add    $0x8,%eax
+ d81:	eb 3b                	jmp    dbe <malloc+0xe1>
+    }
+    if(p == freep)
+ d83:	a1 50 14 00 00       	mov    0x1450,%eax
+ d88:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d8b:	75 1e                	jne    dab <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d8d:	83 ec 0c             	sub    $0xc,%esp
+ d90:	ff 75 ec             	push   -0x14(%ebp)
+ d93:	e8 e5 fe ff ff       	call   c7d <morecore>
+ d98:	83 c4 10             	add    $0x10,%esp
+ d9b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d9e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ da2:	75 07                	jne    dab <malloc+0xce>
+        return 0;
+ da4:	b8 00 00 00 00       	mov    $0x0,%eax
+ da9:	eb 13                	jmp    dbe <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ dab:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ dae:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ db1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ db4:	8b 00                	mov    (%eax),%eax
+ db6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ db9:	e9 6d ff ff ff       	jmp    d2b <malloc+0x4e>
+  }
+}
+ dbe:	c9                   	leave
+ dbf:	c3                   	ret
+
+00000dc0 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ dc0:	55                   	push   %ebp
+ dc1:	89 e5                	mov    %esp,%ebp
+ dc3:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ dc6:	83 ec 0c             	sub    $0xc,%esp
+ dc9:	68 00 10 00 00       	push   $0x1000
+ dce:	e8 0a ff ff ff       	call   cdd <malloc>
+ dd3:	83 c4 10             	add    $0x10,%esp
+ dd6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ dd9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ ddd:	75 07                	jne    de6 <thread_create+0x26>
+    return -1;
+ ddf:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ de4:	eb 2e                	jmp    e14 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ de6:	83 ec 04             	sub    $0x4,%esp
+ de9:	ff 75 f4             	push   -0xc(%ebp)
+ dec:	ff 75 0c             	push   0xc(%ebp)
+ def:	ff 75 08             	push   0x8(%ebp)
+ df2:	e8 ee fa ff ff       	call   8e5 <clone>
+ df7:	83 c4 10             	add    $0x10,%esp
+ dfa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dfd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ e01:	79 0e                	jns    e11 <thread_create+0x51>
+    free(stack);
+ e03:	83 ec 0c             	sub    $0xc,%esp
+ e06:	ff 75 f4             	push   -0xc(%ebp)
+ e09:	e8 8d fd ff ff       	call   b9b <free>
+ e0e:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ e11:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ e14:	c9                   	leave
+ e15:	c3                   	ret
+
+00000e16 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ e16:	55                   	push   %ebp
+ e17:	89 e5                	mov    %esp,%ebp
+ e19:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ e1c:	83 ec 0c             	sub    $0xc,%esp
+ e1f:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ e22:	50                   	push   %eax
+ e23:	e8 c7 fa ff ff       	call   8ef <join>
+ e28:	83 c4 10             	add    $0x10,%esp
+ e2b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e2e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e32:	78 0f                	js     e43 <thread_join+0x2d>
+    free(stack);
+ e34:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e37:	83 ec 0c             	sub    $0xc,%esp
+ e3a:	50                   	push   %eax
+ e3b:	e8 5b fd ff ff       	call   b9b <free>
+ e40:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ e43:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e46:	c9                   	leave
+ e47:	c3                   	ret
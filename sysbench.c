@@ -0,0 +1,95 @@
+// Null system call benchmark: times getpid() entered through
+// int $T_SYSCALL and, if the CPU has it, through SYSENTER,
+// which usys.S then uses.  Prints the average cost of a round
+// trip in TSC cycles, best of several runs.
+//
+//   sysbench [ncalls [nruns]]
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "syscall.h"
+#include "traps.h"
+#include "vdso.h"
+
+static inline uint
+rdtsc(void)
+{
+  uint lo, hi;
+
+  asm volatile("rdtsc" : "=a" (lo), "=d" (hi));
+  return lo;
+}
+
+static int
+intgetpid(void)
+{
+  int r;
+
+  asm volatile("int %1" : "=a" (r) : "i" (T_SYSCALL), "a" (SYS_getpid) : "memory");
+  return r;
+}
+
+static int
+sysentergetpid(void)
+{
+  int r;
+
+  asm volatile("movl %%esp, %%ecx\n\t"
+               "movl $1f, %%edx\n\t"
+               "sysenter\n"
+               "1:"
+               : "=a" (r) : "a" (SYS_getpid) : "ecx", "edx", "memory");
+  return r;
+}
+
+// Best average cycles per call of fn over nruns runs of n calls.
+uint
+timecalls(int (*fn)(void), int n, int nruns)
+{
+  uint t, best;
+  int i, j;
+
+  best = 0xffffffff;
+  for(j = 0; j < nruns; j++){
+    t = rdtsc();
+    for(i = 0; i < n; i++)
+      fn();
+    t = (rdtsc() - t) / n;
+    if(t < best)
+      best = t;
+  }
+  return best;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int n, nruns, pid, sep;
+
+  n = 100000;
+  nruns = 5;
+  if(argc > 1)
+    n = atoi(argv[1]);
+  if(argc > 2)
+    nruns = atoi(argv[2]);
+  if(n <= 0 || nruns <= 0){
+    printf(2, "usage: sysbench [ncalls [nruns]]\n");
+    exit();
+  }
+
+  sep = ((struct vdso*)VDSO)->sysenter;
+  pid = getpid();
+  if(intgetpid() != pid || (sep && sysentergetpid() != pid)){
+    printf(2, "sysbench: getpid mismatch\n");
+    exit();
+  }
+  printf(1, "sysbench: int $%d: %d cycles/call\n", T_SYSCALL,
+         timecalls(intgetpid, n, nruns));
+  if(sep)
+    printf(1, "sysbench: sysenter: %d cycles/call\n",
+           timecalls(sysentergetpid, n, nruns));
+  else
+    printf(1, "sysbench: sysenter: not supported\n");
+  exit();
+}
@@ -3,11 +3,13 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "syscall.h"
+#include "sysstat.h"
 
-// User code makes a system call with INT T_SYSCALL.
+// User code makes a system call with INT T_SYSCALL or SYSENTER.
 // System call number in %eax.
 // Arguments on the stack, from the user call to the C
 // library system call function. The saved user %esp points
@@ -98,6 +100,16 @@ extern int sys_unlink(void);
 extern int sys_wait(void);
 extern int sys_write(void);
 extern int sys_uptime(void);
+extern int sys_kmstat(void);
+extern int sys_setpriority(void);
+extern int sys_clone(void);
+extern int sys_join(void);
+extern int sys_futex_wait(void);
+extern int sys_futex_wake(void);
+extern int sys_lockstat(void);
+extern int sys_sysstat(void);
+extern int sys_ring_setup(void);
+extern int sys_ring_enter(void);
 
 static int (*syscalls[])(void) = {
 [SYS_fork]    sys_fork,
@@ -121,19 +133,137 @@ static int (*syscalls[])(void) = {
 [SYS_link]    sys_link,
 [SYS_mkdir]   sys_mkdir,
 [SYS_close]   sys_close,
+[SYS_kmstat]  sys_kmstat,
+[SYS_setpriority] sys_setpriority,
+[SYS_clone]   sys_clone,
+[SYS_join]    sys_join,
+[SYS_futex_wait] sys_futex_wait,
+[SYS_futex_wake] sys_futex_wake,
+[SYS_lockstat] sys_lockstat,
+[SYS_sysstat] sys_sysstat,
+[SYS_ring_setup] sys_ring_setup,
+[SYS_ring_enter] sys_ring_enter,
 };
 
+static char *sysnames[] = {
+[SYS_fork]    "fork",
+[SYS_exit]    "exit",
+[SYS_wait]    "wait",
+[SYS_pipe]    "pipe",
+[SYS_read]    "read",
+[SYS_kill]    "kill",
+[SYS_exec]    "exec",
+[SYS_fstat]   "fstat",
+[SYS_chdir]   "chdir",
+[SYS_dup]     "dup",
+[SYS_getpid]  "getpid",
+[SYS_sbrk]    "sbrk",
+[SYS_sleep]   "sleep",
+[SYS_uptime]  "uptime",
+[SYS_open]    "open",
+[SYS_write]   "write",
+[SYS_mknod]   "mknod",
+[SYS_unlink]  "unlink",
+[SYS_link]    "link",
+[SYS_mkdir]   "mkdir",
+[SYS_close]   "close",
+[SYS_kmstat]  "kmstat",
+[SYS_setpriority] "setpriority",
+[SYS_clone]   "clone",
+[SYS_join]    "join",
+[SYS_futex_wait] "futex_wait",
+[SYS_futex_wake] "futex_wake",
+[SYS_lockstat] "lockstat",
+[SYS_sysstat] "sysstat",
+[SYS_ring_setup] "ring_setup",
+[SYS_ring_enter] "ring_enter",
+};
+
+// Each CPU counts in lines of its own, with interrupts off,
+// so counting needs no locks or atomic instructions.  A call
+// that sleeps may finish on another CPU than it started.
+struct syscpu {
+  uint calls;
+  uint errors;
+  uint64 cycles;
+  uint hist[NSYSHIST];
+};
+
+static struct {
+  struct syscpu call[NELEM(syscalls)];
+} __attribute__((aligned(64))) syscpus[NCPU];
+
+// Record a call to num that returned ret after t cycles.
+static void
+sysdone(int num, int ret, uint64 t)
+{
+  struct syscpu *s;
+  uint lo;
+  int b;
+
+  lo = (t >> 32) ? 0xffffffff : (uint)t;
+  b = lo ? 31 - __builtin_clz(lo) : 0;
+  pushcli();
+  s = &syscpus[cpu->id].call[num];
+  if(ret == -1)
+    s->errors++;
+  s->cycles += t;
+  s->hist[b]++;
+  popcli();
+}
+
 void
 syscall(void)
 {
-  int num;
+  int num, ret;
+  uint64 t;
 
   num = proc->tf->eax;
   if(num > 0 && num < NELEM(syscalls) && syscalls[num]) {
-    proc->tf->eax = syscalls[num]();
+    pushcli();
+    syscpus[cpu->id].call[num].calls++;
+    popcli();
+    t = rdtsc();
+    ret = syscalls[num]();
+    sysdone(num, ret, rdtsc() - t);
+    proc->tf->eax = ret;
   } else {
     cprintf("%d %s: unknown sys call %d\n",
             proc->pid, proc->name, num);
     proc->tf->eax = -1;
   }
 }
+
+// Copy the counts of up to n system calls into st[], then zero
+// them all if reset is set.  Returns the number copied.  Calls
+// that have not returned, such as every exit(), are counted in
+// calls but not in the histogram.  Counts racing with a reset
+// may be lost.
+int
+sysstat(struct sysstat *st, int n, int reset)
+{
+  struct syscpu *s;
+  int num, i, j, c;
+
+  for(i = 0, num = 1; num < NELEM(syscalls) && i < n; num++){
+    if(syscalls[num] == 0)
+      continue;
+    safestrcpy(st[i].name, sysnames[num], sizeof(st[i].name));
+    st[i].num = num;
+    st[i].calls = st[i].errors = 0;
+    st[i].cycles = 0;
+    memset(st[i].hist, 0, sizeof(st[i].hist));
+    for(c = 0; c < NCPU; c++){
+      s = &syscpus[c].call[num];
+      st[i].calls += s->calls;
+      st[i].errors += s->errors;
+      st[i].cycles += s->cycles;
+      for(j = 0; j < NSYSHIST; j++)
+        st[i].hist[j] += s->hist[j];
+    }
+    i++;
+  }
+  if(reset)
+    memset(syscpus, 0, sizeof(syscpus));
+  return i;
+}
@@ -20,3 +20,13 @@
 #define SYS_link   19
 #define SYS_mkdir  20
 #define SYS_close  21
+#define SYS_kmstat 22
+#define SYS_setpriority 23
+#define SYS_clone  24
+#define SYS_join   25
+#define SYS_futex_wait 26
+#define SYS_futex_wake 27
+#define SYS_lockstat 28
+#define SYS_sysstat 29
+#define SYS_ring_setup 30
+#define SYS_ring_enter 31
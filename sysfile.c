@@ -9,13 +9,35 @@
 #include "param.h"
 #include "stat.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "fs.h"
+#include "sleeplock.h"
 #include "file.h"
 #include "fcntl.h"
 
+// Return the open file for file descriptor fd with a reference
+// of the caller's own, so that another thread's close() cannot
+// free it; the caller must fileclose() it.  Returns 0 if none.
+static struct file*
+fdget(int fd)
+{
+  struct proc *g;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return 0;
+  g = proc->leader;
+  acquire(&g->glock);
+  if((f = g->ofile[fd]) != 0)
+    filedup(f);
+  release(&g->glock);
+  return f;
+}
+
 // Fetch the nth word-sized system call argument as a file descriptor
-// and return both the descriptor and the corresponding struct file.
+// and return both the descriptor and the corresponding struct file,
+// with a reference that the caller must fileclose().
 static int
 argfd(int n, int *pfd, struct file **pf)
 {
@@ -24,7 +46,7 @@ argfd(int n, int *pfd, struct file **pf)
 
   if(argint(n, &fd) < 0)
     return -1;
-  if(fd < 0 || fd >= NOFILE || (f=proc->ofile[fd]) == 0)
+  if((f = fdget(fd)) == 0)
     return -1;
   if(pfd)
     *pfd = fd;
@@ -39,16 +61,41 @@ static int
 fdalloc(struct file *f)
 {
   int fd;
+  struct proc *g;
 
+  g = proc->leader;
+  acquire(&g->glock);
   for(fd = 0; fd < NOFILE; fd++){
-    if(proc->ofile[fd] == 0){
-      proc->ofile[fd] = f;
+    if(g->ofile[fd] == 0){
+      g->ofile[fd] = f;
+      release(&g->glock);
       return fd;
     }
   }
+  release(&g->glock);
   return -1;
 }
 
+// Clear file descriptor fd if it still refers to f.
+// Returns 0 if it did, so that of two threads closing
+// fd at once only one goes on to close f.
+static int
+fdclear(int fd, struct file *f)
+{
+  struct proc *g;
+  int r;
+
+  g = proc->leader;
+  acquire(&g->glock);
+  r = -1;
+  if(g->ofile[fd] == f){
+    g->ofile[fd] = 0;
+    r = 0;
+  }
+  release(&g->glock);
+  return r;
+}
+
 int
 sys_dup(void)
 {
@@ -57,47 +104,90 @@ sys_dup(void)
   
   if(argfd(0, 0, &f) < 0)
     return -1;
-  if((fd=fdalloc(f)) < 0)
+  if((fd=fdalloc(f)) < 0){
+    fileclose(f);
     return -1;
-  filedup(f);
+  }
   return fd;
 }
 
+// The bodies of read(), write() and close(), shared with the
+// submission ring (ring.c).  p must already be checked.
 int
-sys_read(void)
+fdread(int fd, char *p, int n)
 {
   struct file *f;
-  int n;
+  int r;
+
+  if((f = fdget(fd)) == 0)
+    return -1;
+  r = fileread(f, p, n);
+  fileclose(f);
+  return r;
+}
+
+int
+fdwrite(int fd, char *p, int n)
+{
+  struct file *f;
+  int r;
+
+  if((f = fdget(fd)) == 0)
+    return -1;
+  r = filewrite(f, p, n);
+  fileclose(f);
+  return r;
+}
+
+int
+fdclose(int fd)
+{
+  struct proc *g;
+  struct file *f;
+
+  if(fd < 0 || fd >= NOFILE)
+    return -1;
+  g = proc->leader;
+  acquire(&g->glock);
+  if((f = g->ofile[fd]) != 0)
+    g->ofile[fd] = 0;
+  release(&g->glock);
+  if(f == 0)
+    return -1;
+  fileclose(f);
+  return 0;
+}
+
+int
+sys_read(void)
+{
+  int fd, n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(0, &fd) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
-  return fileread(f, p, n);
+  return fdread(fd, p, n);
 }
 
 int
 sys_write(void)
 {
-  struct file *f;
-  int n;
+  int fd, n;
   char *p;
 
-  if(argfd(0, 0, &f) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
+  if(argint(0, &fd) < 0 || argint(2, &n) < 0 || argptr(1, &p, n) < 0)
     return -1;
-  return filewrite(f, p, n);
+  return fdwrite(fd, p, n);
 }
 
 int
 sys_close(void)
 {
   int fd;
-  struct file *f;
   
-  if(argfd(0, &fd, &f) < 0)
+  if(argint(0, &fd) < 0)
     return -1;
-  proc->ofile[fd] = 0;
-  fileclose(f);
-  return 0;
+  return fdclose(fd);
 }
 
 int
@@ -105,10 +195,13 @@ sys_fstat(void)
 {
   struct file *f;
   struct stat *st;
+  int r;
   
-  if(argfd(0, 0, &f) < 0 || argptr(1, (void*)&st, sizeof(*st)) < 0)
+  if(argptr(1, (void*)&st, sizeof(*st)) < 0 || argfd(0, 0, &f) < 0)
     return -1;
-  return filestat(f, st);
+  r = filestat(f, st);
+  fileclose(f);
+  return r;
 }
 
 // Create the path new as a link to the same inode as old.
@@ -211,6 +304,7 @@ sys_unlink(void)
   memset(&de, 0, sizeof(de));
   if(writei(dp, (char*)&de, off, sizeof(de)) != sizeof(de))
     panic("unlink: writei");
+  nameforget(dp, name);
   if(ip->type == T_DIR){
     dp->nlink--;
     iupdate(dp);
@@ -276,16 +370,14 @@ create(char *path, short type, short major, short minor)
   return ip;
 }
 
+// The body of open(), shared with the submission ring.
 int
-sys_open(void)
+openpath(char *path, int omode)
 {
-  char *path;
-  int fd, omode;
+  int fd;
   struct file *f;
   struct inode *ip;
 
-  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
-    return -1;
   if(omode & O_CREATE){
     begin_trans();
     ip = create(path, T_FILE, 0, 0);
@@ -295,7 +387,7 @@ sys_open(void)
   } else {
     if((ip = namei(path)) == 0)
       return -1;
-    ilock(ip);
+    ilockshared(ip);
     if(ip->type == T_DIR && omode != O_RDONLY){
       iunlockput(ip);
       return -1;
@@ -318,6 +410,37 @@ sys_open(void)
   return fd;
 }
 
+int
+sys_open(void)
+{
+  char *path;
+  int omode;
+
+  if(argstr(0, &path) < 0 || argint(1, &omode) < 0)
+    return -1;
+  return openpath(path, omode);
+}
+
+int
+sys_ring_setup(void)
+{
+  int addr, flags;
+
+  if(argint(0, &addr) < 0 || argint(1, &flags) < 0)
+    return -1;
+  return ringsetup(addr, flags);
+}
+
+int
+sys_ring_enter(void)
+{
+  int min;
+
+  if(argint(0, &min) < 0)
+    return -1;
+  return ringenter(min);
+}
+
 int
 sys_mkdir(void)
 {
@@ -359,18 +482,21 @@ int
 sys_chdir(void)
 {
   char *path;
-  struct inode *ip;
+  struct inode *ip, *old;
 
   if(argstr(0, &path) < 0 || (ip = namei(path)) == 0)
     return -1;
-  ilock(ip);
+  ilockshared(ip);
   if(ip->type != T_DIR){
     iunlockput(ip);
     return -1;
   }
   iunlock(ip);
-  iput(proc->cwd);
-  proc->cwd = ip;
+  acquire(&proc->leader->glock);
+  old = proc->leader->cwd;
+  proc->leader->cwd = ip;
+  release(&proc->leader->glock);
+  iput(old);
   return 0;
 }
 
@@ -413,9 +539,9 @@ sys_pipe(void)
     return -1;
   fd0 = -1;
   if((fd0 = fdalloc(rf)) < 0 || (fd1 = fdalloc(wf)) < 0){
-    if(fd0 >= 0)
-      proc->ofile[fd0] = 0;
-    fileclose(rf);
+    // If another thread already closed fd0, it closed rf too.
+    if(fd0 < 0 || fdclear(fd0, rf) == 0)
+      fileclose(rf);
     fileclose(wf);
     return -1;
   }
@@ -4,7 +4,11 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
+#include "kmstat.h"
+#include "lockstat.h"
+#include "sysstat.h"
 
 int
 sys_fork(void)
@@ -25,6 +29,54 @@ sys_wait(void)
   return wait();
 }
 
+// start a thread running fn(arg) on a one-page user stack.
+int
+sys_clone(void)
+{
+  int fn, arg, stack;
+
+  if(argint(0, &fn) < 0 || argint(1, &arg) < 0 || argint(2, &stack) < 0)
+    return -1;
+  return clone((void(*)(void*))fn, (void*)arg, (void*)stack);
+}
+
+// wait for a thread to exit; stores the stack it was
+// given in *stack, for the caller to free.
+int
+sys_join(void)
+{
+  void **stack, *s;
+  int pid;
+
+  if(argptr(0, (char**)&stack, sizeof(*stack)) < 0)
+    return -1;
+  if((pid = join(&s)) >= 0)
+    *stack = s;
+  return pid;
+}
+
+// sleep until futex_wake(addr) if *addr == val.
+int
+sys_futex_wait(void)
+{
+  int addr, val;
+
+  if(argint(0, &addr) < 0 || argint(1, &val) < 0)
+    return -1;
+  return futexwait(addr, val);
+}
+
+// wake up to n threads sleeping in futex_wait(addr).
+int
+sys_futex_wake(void)
+{
+  int addr, n;
+
+  if(argint(0, &addr) < 0 || argint(1, &n) < 0)
+    return -1;
+  return futexwake(addr, n);
+}
+
 int
 sys_kill(void)
 {
@@ -35,6 +87,18 @@ sys_kill(void)
   return kill(pid);
 }
 
+// set the nice level of a process: the highest scheduling
+// priority level it may reach, 0 (highest) to NPRIO-1.
+int
+sys_setpriority(void)
+{
+  int pid, nice;
+
+  if(argint(0, &pid) < 0 || argint(1, &nice) < 0)
+    return -1;
+  return setpriority(pid, nice);
+}
+
 int
 sys_getpid(void)
 {
@@ -44,15 +108,11 @@ sys_getpid(void)
 int
 sys_sbrk(void)
 {
-  int addr;
   int n;
 
   if(argint(0, &n) < 0)
     return -1;
-  addr = proc->sz;
-  if(growproc(n) < 0)
-    return -1;
-  return addr;
+  return growproc(n);
 }
 
 int
@@ -88,3 +148,52 @@ sys_uptime(void)
   release(&tickslock);
   return xticks;
 }
+
+// copy usage of up to n kernel object caches to user memory.
+// returns the number of caches copied.
+int
+sys_kmstat(void)
+{
+  struct kmstat *st;
+  int n;
+
+  // Bound n first, so n*sizeof(*st) cannot overflow.
+  if(argint(1, &n) < 0 || n < 0 || n > 0x7fffffff / sizeof(*st) ||
+     argptr(0, (char**)&st, n*sizeof(*st)) < 0)
+    return -1;
+  return kmstat(st, n);
+}
+
+// copy contention statistics of up to n lock classes to user
+// memory, then zero them if reset is set.
+// returns the number of classes copied.
+int
+sys_lockstat(void)
+{
+  struct lockstat *st;
+  int n, reset;
+
+  if(argint(1, &n) < 0 || n < 0 || n > 0x7fffffff / sizeof(*st) ||
+     argptr(0, (char**)&st, n*sizeof(*st)) < 0)
+    return -1;
+  if(argint(2, &reset) < 0)
+    return -1;
+  return lockstat(st, n, reset);
+}
+
+// copy counts of up to n system calls to user memory,
+// then zero them if reset is set.
+// returns the number of system calls copied.
+int
+sys_sysstat(void)
+{
+  struct sysstat *st;
+  int n, reset;
+
+  if(argint(1, &n) < 0 || n < 0 || n > 0x7fffffff / sizeof(*st) ||
+     argptr(0, (char**)&st, n*sizeof(*st)) < 0)
+    return -1;
+  if(argint(2, &reset) < 0)
+    return -1;
+  return sysstat(st, n, reset);
+}
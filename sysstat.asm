@@ -0,0 +1,2203 @@
+
+_sysstat:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <div64>:
+struct sysstat st[NSYS];
+
+// a / b, without 64-bit division.
+uint
+div64(uint64 a, uint b)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+       6:	8b 45 08             	mov    0x8(%ebp),%eax
+       9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+       c:	8b 45 0c             	mov    0xc(%ebp),%eax
+       f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  int shift;
+
+  for(shift = 0; a >> 32; shift++)
+      12:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+      19:	eb 16                	jmp    31 <div64+0x31>
+    a >>= 1;
+      1b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      1e:	8b 55 ec             	mov    -0x14(%ebp),%edx
+      21:	0f ac d0 01          	shrd   $0x1,%edx,%eax
+      25:	d1 ea                	shr    %edx
+      27:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      2a:	89 55 ec             	mov    %edx,-0x14(%ebp)
+  for(shift = 0; a >> 32; shift++)
+      2d:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+      31:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      34:	8b 55 ec             	mov    -0x14(%ebp),%edx
+      37:	89 d0                	mov    %edx,%eax
+      39:	31 d2                	xor    %edx,%edx
+      3b:	09 d0                	or     %edx,%eax
+      3d:	85 c0                	test   %eax,%eax
+      3f:	75 da                	jne    1b <div64+0x1b>
+  return ((uint)a / b) << shift;
+      41:	8b 45 e8             	mov    -0x18(%ebp),%eax
+      44:	ba 00 00 00 00       	mov    $0x0,%edx
+      49:	f7 75 10             	divl   0x10(%ebp)
+      4c:	89 c2                	mov    %eax,%edx
+      4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+      51:	89 c1                	mov    %eax,%ecx
+      53:	d3 e2                	shl    %cl,%edx
+      55:	89 d0                	mov    %edx,%eax
+}
+      57:	c9                   	leave
+      58:	c3                   	ret
+
+00000059 <percentile>:
+
+// Upper end of the histogram bucket holding the call that
+// makes up fraction pct of the n calls in hist[].
+uint
+percentile(uint *hist, uint n, uint pct)
+{
+      59:	55                   	push   %ebp
+      5a:	89 e5                	mov    %esp,%ebp
+      5c:	53                   	push   %ebx
+      5d:	83 ec 10             	sub    $0x10,%esp
+  uint sum, want;
+  int i;
+
+  want = (n / 100) * pct + ((n % 100) * pct + 99) / 100;
+      60:	8b 45 0c             	mov    0xc(%ebp),%eax
+      63:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+      68:	f7 e2                	mul    %edx
+      6a:	89 d0                	mov    %edx,%eax
+      6c:	c1 e8 05             	shr    $0x5,%eax
+      6f:	0f af 45 10          	imul   0x10(%ebp),%eax
+      73:	89 c3                	mov    %eax,%ebx
+      75:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+      78:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+      7d:	89 c8                	mov    %ecx,%eax
+      7f:	f7 e2                	mul    %edx
+      81:	89 d0                	mov    %edx,%eax
+      83:	c1 e8 05             	shr    $0x5,%eax
+      86:	6b d0 64             	imul   $0x64,%eax,%edx
+      89:	89 c8                	mov    %ecx,%eax
+      8b:	29 d0                	sub    %edx,%eax
+      8d:	0f af 45 10          	imul   0x10(%ebp),%eax
+      91:	83 c0 63             	add    $0x63,%eax
+      94:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+      99:	f7 e2                	mul    %edx
+      9b:	89 d0                	mov    %edx,%eax
+      9d:	c1 e8 05             	shr    $0x5,%eax
+      a0:	01 d8                	add    %ebx,%eax
+      a2:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  sum = 0;
+      a5:	c7 45 f8 00 00 00 00 	movl   $0x0,-0x8(%ebp)
+  for(i = 0; i < NSYSHIST - 1; i++){
+      ac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+      b3:	eb 20                	jmp    d5 <percentile+0x7c>
+    sum += hist[i];
+      b5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      b8:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+      bf:	8b 45 08             	mov    0x8(%ebp),%eax
+      c2:	01 d0                	add    %edx,%eax
+      c4:	8b 00                	mov    (%eax),%eax
+      c6:	01 45 f8             	add    %eax,-0x8(%ebp)
+    if(sum >= want)
+      c9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+      cc:	3b 45 f0             	cmp    -0x10(%ebp),%eax
+      cf:	73 0c                	jae    dd <percentile+0x84>
+  for(i = 0; i < NSYSHIST - 1; i++){
+      d1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+      d5:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+      d9:	7e da                	jle    b5 <percentile+0x5c>
+      db:	eb 01                	jmp    de <percentile+0x85>
+      break;
+      dd:	90                   	nop
+  }
+  return (2U << i) - 1;
+      de:	8b 45 f4             	mov    -0xc(%ebp),%eax
+      e1:	ba 02 00 00 00       	mov    $0x2,%edx
+      e6:	89 c1                	mov    %eax,%ecx
+      e8:	d3 e2                	shl    %cl,%edx
+      ea:	89 d0                	mov    %edx,%eax
+      ec:	83 e8 01             	sub    $0x1,%eax
+}
+      ef:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+      f2:	c9                   	leave
+      f3:	c3                   	ret
+
+000000f4 <main>:
+
+int
+main(int argc, char *argv[])
+{
+      f4:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+      f8:	83 e4 f0             	and    $0xfffffff0,%esp
+      fb:	ff 71 fc             	push   -0x4(%ecx)
+      fe:	55                   	push   %ebp
+      ff:	89 e5                	mov    %esp,%ebp
+     101:	57                   	push   %edi
+     102:	56                   	push   %esi
+     103:	53                   	push   %ebx
+     104:	51                   	push   %ecx
+     105:	81 ec c8 00 00 00    	sub    $0xc8,%esp
+     10b:	89 cb                	mov    %ecx,%ebx
+  int i, j, n, reset, hist;
+  uint done;
+  struct sysstat t;
+
+  reset = hist = 0;
+     10d:	c7 45 d8 00 00 00 00 	movl   $0x0,-0x28(%ebp)
+     114:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     117:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  for(i = 1; i < argc; i++){
+     11a:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+     121:	eb 79                	jmp    19c <main+0xa8>
+    if(strcmp(argv[i], "-r") == 0)
+     123:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     126:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     12d:	8b 43 04             	mov    0x4(%ebx),%eax
+     130:	01 d0                	add    %edx,%eax
+     132:	8b 00                	mov    (%eax),%eax
+     134:	83 ec 08             	sub    $0x8,%esp
+     137:	68 1c 11 00 00       	push   $0x111c
+     13c:	50                   	push   %eax
+     13d:	e8 1b 04 00 00       	call   55d <strcmp>
+     142:	83 c4 10             	add    $0x10,%esp
+     145:	85 c0                	test   %eax,%eax
+     147:	75 09                	jne    152 <main+0x5e>
+      reset = 1;
+     149:	c7 45 dc 01 00 00 00 	movl   $0x1,-0x24(%ebp)
+     150:	eb 46                	jmp    198 <main+0xa4>
+    else if(strcmp(argv[i], "-h") == 0)
+     152:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+     15c:	8b 43 04             	mov    0x4(%ebx),%eax
+     15f:	01 d0                	add    %edx,%eax
+     161:	8b 00                	mov    (%eax),%eax
+     163:	83 ec 08             	sub    $0x8,%esp
+     166:	68 1f 11 00 00       	push   $0x111f
+     16b:	50                   	push   %eax
+     16c:	e8 ec 03 00 00       	call   55d <strcmp>
+     171:	83 c4 10             	add    $0x10,%esp
+     174:	85 c0                	test   %eax,%eax
+     176:	75 09                	jne    181 <main+0x8d>
+      hist = 1;
+     178:	c7 45 d8 01 00 00 00 	movl   $0x1,-0x28(%ebp)
+     17f:	eb 17                	jmp    198 <main+0xa4>
+    else {
+      printf(2, "usage: sysstat [-h] [-r]\n");
+     181:	83 ec 08             	sub    $0x8,%esp
+     184:	68 22 11 00 00       	push   $0x1122
+     189:	6a 02                	push   $0x2
+     18b:	e8 4d 0b 00 00       	call   cdd <printf>
+     190:	83 c4 10             	add    $0x10,%esp
+      exit();
+     193:	e8 6f 09 00 00       	call   b07 <exit>
+  for(i = 1; i < argc; i++){
+     198:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     19c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     19f:	3b 03                	cmp    (%ebx),%eax
+     1a1:	7c 80                	jl     123 <main+0x2f>
+    }
+  }
+  if((n = sysstat(st, NSYS, reset)) < 0){
+     1a3:	83 ec 04             	sub    $0x4,%esp
+     1a6:	ff 75 dc             	push   -0x24(%ebp)
+     1a9:	6a 40                	push   $0x40
+     1ab:	68 e0 16 00 00       	push   $0x16e0
+     1b0:	e8 36 0a 00 00       	call   beb <sysstat>
+     1b5:	83 c4 10             	add    $0x10,%esp
+     1b8:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     1bb:	83 7d d0 00          	cmpl   $0x0,-0x30(%ebp)
+     1bf:	79 17                	jns    1d8 <main+0xe4>
+    printf(2, "sysstat: failed\n");
+     1c1:	83 ec 08             	sub    $0x8,%esp
+     1c4:	68 3c 11 00 00       	push   $0x113c
+     1c9:	6a 02                	push   $0x2
+     1cb:	e8 0d 0b 00 00       	call   cdd <printf>
+     1d0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     1d3:	e8 2f 09 00 00       	call   b07 <exit>
+  }
+
+  // Sort by time spent.
+  for(i = 1; i < n; i++){
+     1d8:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+     1df:	e9 b7 00 00 00       	jmp    29b <main+0x1a7>
+    t = st[i];
+     1e4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     1e7:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     1ed:	8d 90 e0 16 00 00    	lea    0x16e0(%eax),%edx
+     1f3:	8d 85 2c ff ff ff    	lea    -0xd4(%ebp),%eax
+     1f9:	89 d3                	mov    %edx,%ebx
+     1fb:	ba 29 00 00 00       	mov    $0x29,%edx
+     200:	89 c7                	mov    %eax,%edi
+     202:	89 de                	mov    %ebx,%esi
+     204:	89 d1                	mov    %edx,%ecx
+     206:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].cycles < t.cycles; j--)
+     208:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     20b:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     20e:	eb 33                	jmp    243 <main+0x14f>
+      st[j] = st[j-1];
+     210:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     213:	8d 48 ff             	lea    -0x1(%eax),%ecx
+     216:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     219:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     21f:	8d 90 e0 16 00 00    	lea    0x16e0(%eax),%edx
+     225:	69 c1 a4 00 00 00    	imul   $0xa4,%ecx,%eax
+     22b:	05 e0 16 00 00       	add    $0x16e0,%eax
+     230:	89 c3                	mov    %eax,%ebx
+     232:	b8 29 00 00 00       	mov    $0x29,%eax
+     237:	89 d7                	mov    %edx,%edi
+     239:	89 de                	mov    %ebx,%esi
+     23b:	89 c1                	mov    %eax,%ecx
+     23d:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+    for(j = i; j > 0 && st[j-1].cycles < t.cycles; j--)
+     23f:	83 6d e0 01          	subl   $0x1,-0x20(%ebp)
+     243:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     247:	7e 2b                	jle    274 <main+0x180>
+     249:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     24c:	83 e8 01             	sub    $0x1,%eax
+     24f:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     255:	05 f0 16 00 00       	add    $0x16f0,%eax
+     25a:	8b 48 0c             	mov    0xc(%eax),%ecx
+     25d:	8b 58 10             	mov    0x10(%eax),%ebx
+     260:	8b 85 48 ff ff ff    	mov    -0xb8(%ebp),%eax
+     266:	8b 95 4c ff ff ff    	mov    -0xb4(%ebp),%edx
+     26c:	39 c1                	cmp    %eax,%ecx
+     26e:	89 df                	mov    %ebx,%edi
+     270:	19 d7                	sbb    %edx,%edi
+     272:	72 9c                	jb     210 <main+0x11c>
+    st[j] = t;
+     274:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     277:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     27d:	05 e0 16 00 00       	add    $0x16e0,%eax
+     282:	89 c3                	mov    %eax,%ebx
+     284:	8d 85 2c ff ff ff    	lea    -0xd4(%ebp),%eax
+     28a:	ba 29 00 00 00       	mov    $0x29,%edx
+     28f:	89 df                	mov    %ebx,%edi
+     291:	89 c6                	mov    %eax,%esi
+     293:	89 d1                	mov    %edx,%ecx
+     295:	f3 a5                	rep movsl %ds:(%esi),%es:(%edi)
+  for(i = 1; i < n; i++){
+     297:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     29b:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     29e:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+     2a1:	0f 8c 3d ff ff ff    	jl     1e4 <main+0xf0>
+  }
+
+  printf(1, "name calls errors total-kcyc avg p50 p99\n");
+     2a7:	83 ec 08             	sub    $0x8,%esp
+     2aa:	68 50 11 00 00       	push   $0x1150
+     2af:	6a 01                	push   $0x1
+     2b1:	e8 27 0a 00 00       	call   cdd <printf>
+     2b6:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < n; i++){
+     2b9:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+     2c0:	e9 df 01 00 00       	jmp    4a4 <main+0x3b0>
+    if(st[i].calls == 0)
+     2c5:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     2c8:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     2ce:	05 f4 16 00 00       	add    $0x16f4,%eax
+     2d3:	8b 00                	mov    (%eax),%eax
+     2d5:	85 c0                	test   %eax,%eax
+     2d7:	0f 84 c2 01 00 00    	je     49f <main+0x3ab>
+      continue;
+    done = 0;
+     2dd:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    for(j = 0; j < NSYSHIST; j++)
+     2e4:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     2eb:	eb 25                	jmp    312 <main+0x21e>
+      done += st[i].hist[j];
+     2ed:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     2f0:	89 d0                	mov    %edx,%eax
+     2f2:	c1 e0 02             	shl    $0x2,%eax
+     2f5:	01 d0                	add    %edx,%eax
+     2f7:	c1 e0 03             	shl    $0x3,%eax
+     2fa:	01 d0                	add    %edx,%eax
+     2fc:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     2ff:	01 d0                	add    %edx,%eax
+     301:	83 c0 08             	add    $0x8,%eax
+     304:	8b 04 85 e4 16 00 00 	mov    0x16e4(,%eax,4),%eax
+     30b:	01 45 d4             	add    %eax,-0x2c(%ebp)
+    for(j = 0; j < NSYSHIST; j++)
+     30e:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     312:	83 7d e0 1f          	cmpl   $0x1f,-0x20(%ebp)
+     316:	7e d5                	jle    2ed <main+0x1f9>
+    printf(1, "%s %d %d %d", st[i].name, st[i].calls, st[i].errors,
+           (uint)(st[i].cycles >> 10));
+     318:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     31b:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     321:	05 f0 16 00 00       	add    $0x16f0,%eax
+     326:	8b 50 10             	mov    0x10(%eax),%edx
+     329:	8b 40 0c             	mov    0xc(%eax),%eax
+     32c:	0f ac d0 0a          	shrd   $0xa,%edx,%eax
+     330:	c1 ea 0a             	shr    $0xa,%edx
+    printf(1, "%s %d %d %d", st[i].name, st[i].calls, st[i].errors,
+     333:	89 c3                	mov    %eax,%ebx
+     335:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     338:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     33e:	05 f8 16 00 00       	add    $0x16f8,%eax
+     343:	8b 10                	mov    (%eax),%edx
+     345:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     348:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     34e:	05 f4 16 00 00       	add    $0x16f4,%eax
+     353:	8b 00                	mov    (%eax),%eax
+     355:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+     358:	69 c9 a4 00 00 00    	imul   $0xa4,%ecx,%ecx
+     35e:	81 c1 e0 16 00 00    	add    $0x16e0,%ecx
+     364:	83 ec 08             	sub    $0x8,%esp
+     367:	53                   	push   %ebx
+     368:	52                   	push   %edx
+     369:	50                   	push   %eax
+     36a:	51                   	push   %ecx
+     36b:	68 7a 11 00 00       	push   $0x117a
+     370:	6a 01                	push   $0x1
+     372:	e8 66 09 00 00       	call   cdd <printf>
+     377:	83 c4 20             	add    $0x20,%esp
+    if(done)
+     37a:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+     37e:	0f 84 89 00 00 00    	je     40d <main+0x319>
+      printf(1, " %d %d %d", div64(st[i].cycles, done),
+             percentile(st[i].hist, done, 50),
+             percentile(st[i].hist, done, 99));
+     384:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     387:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     38d:	83 c0 20             	add    $0x20,%eax
+     390:	05 e0 16 00 00       	add    $0x16e0,%eax
+     395:	83 c0 04             	add    $0x4,%eax
+      printf(1, " %d %d %d", div64(st[i].cycles, done),
+     398:	83 ec 04             	sub    $0x4,%esp
+     39b:	6a 63                	push   $0x63
+     39d:	ff 75 d4             	push   -0x2c(%ebp)
+     3a0:	50                   	push   %eax
+     3a1:	e8 b3 fc ff ff       	call   59 <percentile>
+     3a6:	83 c4 10             	add    $0x10,%esp
+     3a9:	89 c6                	mov    %eax,%esi
+             percentile(st[i].hist, done, 50),
+     3ab:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     3ae:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     3b4:	83 c0 20             	add    $0x20,%eax
+     3b7:	05 e0 16 00 00       	add    $0x16e0,%eax
+     3bc:	83 c0 04             	add    $0x4,%eax
+      printf(1, " %d %d %d", div64(st[i].cycles, done),
+     3bf:	83 ec 04             	sub    $0x4,%esp
+     3c2:	6a 32                	push   $0x32
+     3c4:	ff 75 d4             	push   -0x2c(%ebp)
+     3c7:	50                   	push   %eax
+     3c8:	e8 8c fc ff ff       	call   59 <percentile>
+     3cd:	83 c4 10             	add    $0x10,%esp
+     3d0:	89 c3                	mov    %eax,%ebx
+     3d2:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     3d5:	69 c0 a4 00 00 00    	imul   $0xa4,%eax,%eax
+     3db:	05 f0 16 00 00       	add    $0x16f0,%eax
+     3e0:	8b 50 10             	mov    0x10(%eax),%edx
+     3e3:	8b 40 0c             	mov    0xc(%eax),%eax
+     3e6:	83 ec 04             	sub    $0x4,%esp
+     3e9:	ff 75 d4             	push   -0x2c(%ebp)
+     3ec:	52                   	push   %edx
+     3ed:	50                   	push   %eax
+     3ee:	e8 0d fc ff ff       	call   0 <div64>
+     3f3:	83 c4 10             	add    $0x10,%esp
+     3f6:	83 ec 0c             	sub    $0xc,%esp
+     3f9:	56                   	push   %esi
+     3fa:	53                   	push   %ebx
+     3fb:	50                   	push   %eax
+     3fc:	68 86 11 00 00       	push   $0x1186
+     401:	6a 01                	push   $0x1
+     403:	e8 d5 08 00 00       	call   cdd <printf>
+     408:	83 c4 20             	add    $0x20,%esp
+     40b:	eb 12                	jmp    41f <main+0x32b>
+    else
+      printf(1, " - - -");
+     40d:	83 ec 08             	sub    $0x8,%esp
+     410:	68 90 11 00 00       	push   $0x1190
+     415:	6a 01                	push   $0x1
+     417:	e8 c1 08 00 00       	call   cdd <printf>
+     41c:	83 c4 10             	add    $0x10,%esp
+    if(hist)
+     41f:	83 7d d8 00          	cmpl   $0x0,-0x28(%ebp)
+     423:	74 66                	je     48b <main+0x397>
+      for(j = 0; j < NSYSHIST; j++)
+     425:	c7 45 e0 00 00 00 00 	movl   $0x0,-0x20(%ebp)
+     42c:	eb 57                	jmp    485 <main+0x391>
+        if(st[i].hist[j])
+     42e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     431:	89 d0                	mov    %edx,%eax
+     433:	c1 e0 02             	shl    $0x2,%eax
+     436:	01 d0                	add    %edx,%eax
+     438:	c1 e0 03             	shl    $0x3,%eax
+     43b:	01 d0                	add    %edx,%eax
+     43d:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     440:	01 d0                	add    %edx,%eax
+     442:	83 c0 08             	add    $0x8,%eax
+     445:	8b 04 85 e4 16 00 00 	mov    0x16e4(,%eax,4),%eax
+     44c:	85 c0                	test   %eax,%eax
+     44e:	74 31                	je     481 <main+0x38d>
+          printf(1, " 2^%d:%d", j, st[i].hist[j]);
+     450:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     453:	89 d0                	mov    %edx,%eax
+     455:	c1 e0 02             	shl    $0x2,%eax
+     458:	01 d0                	add    %edx,%eax
+     45a:	c1 e0 03             	shl    $0x3,%eax
+     45d:	01 d0                	add    %edx,%eax
+     45f:	8b 55 e0             	mov    -0x20(%ebp),%edx
+     462:	01 d0                	add    %edx,%eax
+     464:	83 c0 08             	add    $0x8,%eax
+     467:	8b 04 85 e4 16 00 00 	mov    0x16e4(,%eax,4),%eax
+     46e:	50                   	push   %eax
+     46f:	ff 75 e0             	push   -0x20(%ebp)
+     472:	68 97 11 00 00       	push   $0x1197
+     477:	6a 01                	push   $0x1
+     479:	e8 5f 08 00 00       	call   cdd <printf>
+     47e:	83 c4 10             	add    $0x10,%esp
+      for(j = 0; j < NSYSHIST; j++)
+     481:	83 45 e0 01          	addl   $0x1,-0x20(%ebp)
+     485:	83 7d e0 1f          	cmpl   $0x1f,-0x20(%ebp)
+     489:	7e a3                	jle    42e <main+0x33a>
+    printf(1, "\n");
+     48b:	83 ec 08             	sub    $0x8,%esp
+     48e:	68 a0 11 00 00       	push   $0x11a0
+     493:	6a 01                	push   $0x1
+     495:	e8 43 08 00 00       	call   cdd <printf>
+     49a:	83 c4 10             	add    $0x10,%esp
+     49d:	eb 01                	jmp    4a0 <main+0x3ac>
+      continue;
+     49f:	90                   	nop
+  for(i = 0; i < n; i++){
+     4a0:	83 45 e4 01          	addl   $0x1,-0x1c(%ebp)
+     4a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     4a7:	3b 45 d0             	cmp    -0x30(%ebp),%eax
+     4aa:	0f 8c 15 fe ff ff    	jl     2c5 <main+0x1d1>
+  }
+  exit();
+     4b0:	e8 52 06 00 00       	call   b07 <exit>
+
+000004b5 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+     4b5:	55                   	push   %ebp
+     4b6:	89 e5                	mov    %esp,%ebp
+     4b8:	57                   	push   %edi
+     4b9:	53                   	push   %ebx
+char*
+     4ba:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4bd:	8b 55 10             	mov    0x10(%ebp),%edx
+     4c0:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4c3:	89 cb                	mov    %ecx,%ebx
+     4c5:	89 df                	mov    %ebx,%edi
+     4c7:	89 d1                	mov    %edx,%ecx
+     4c9:	fc                   	cld
+     4ca:	f3 aa                	rep stos %al,%es:(%edi)
+     4cc:	89 ca                	mov    %ecx,%edx
+     4ce:	89 fb                	mov    %edi,%ebx
+     4d0:	89 5d 08             	mov    %ebx,0x8(%ebp)
+     4d3:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+     4d6:	90                   	nop
+     4d7:	5b                   	pop    %ebx
+     4d8:	5f                   	pop    %edi
+     4d9:	5d                   	pop    %ebp
+     4da:	c3                   	ret
+
+000004db <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+     4db:	55                   	push   %ebp
+     4dc:	89 e5                	mov    %esp,%ebp
+     4de:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+     4e1:	8b 55 08             	mov    0x8(%ebp),%edx
+     4e4:	8b 45 0c             	mov    0xc(%ebp),%eax
+     4e7:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     4ea:	f0 87 02             	lock xchg %eax,(%edx)
+     4ed:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+     4f0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+     4f3:	c9                   	leave
+     4f4:	c3                   	ret
+
+000004f5 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+     4f5:	55                   	push   %ebp
+     4f6:	89 e5                	mov    %esp,%ebp
+     4f8:	53                   	push   %ebx
+     4f9:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+     4fc:	8b 5d 08             	mov    0x8(%ebp),%ebx
+     4ff:	8b 55 10             	mov    0x10(%ebp),%edx
+     502:	8b 45 0c             	mov    0xc(%ebp),%eax
+     505:	8b 4d 08             	mov    0x8(%ebp),%ecx
+     508:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+     50c:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+     50f:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+     512:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+     515:	c9                   	leave
+     516:	c3                   	ret
+
+00000517 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+     517:	55                   	push   %ebp
+     518:	89 e5                	mov    %esp,%ebp
+     51a:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+     51d:	0f 31                	rdtsc
+     51f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     522:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+     525:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     528:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+     52b:	c9                   	leave
+     52c:	c3                   	ret
+
+0000052d <strcpy>:
+{
+     52d:	55                   	push   %ebp
+     52e:	89 e5                	mov    %esp,%ebp
+     530:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+     533:	8b 45 08             	mov    0x8(%ebp),%eax
+     536:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+     539:	90                   	nop
+     53a:	8b 55 0c             	mov    0xc(%ebp),%edx
+     53d:	8d 42 01             	lea    0x1(%edx),%eax
+     540:	89 45 0c             	mov    %eax,0xc(%ebp)
+     543:	8b 45 08             	mov    0x8(%ebp),%eax
+     546:	8d 48 01             	lea    0x1(%eax),%ecx
+     549:	89 4d 08             	mov    %ecx,0x8(%ebp)
+     54c:	0f b6 12             	movzbl (%edx),%edx
+     54f:	88 10                	mov    %dl,(%eax)
+     551:	0f b6 00             	movzbl (%eax),%eax
+     554:	84 c0                	test   %al,%al
+     556:	75 e2                	jne    53a <strcpy+0xd>
+  return os;
+     558:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     55b:	c9                   	leave
+     55c:	c3                   	ret
+
+0000055d <strcmp>:
+{
+     55d:	55                   	push   %ebp
+     55e:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+     560:	eb 08                	jmp    56a <strcmp+0xd>
+    p++, q++;
+     562:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     566:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+     56a:	8b 45 08             	mov    0x8(%ebp),%eax
+     56d:	0f b6 00             	movzbl (%eax),%eax
+     570:	84 c0                	test   %al,%al
+     572:	74 10                	je     584 <strcmp+0x27>
+     574:	8b 45 08             	mov    0x8(%ebp),%eax
+     577:	0f b6 10             	movzbl (%eax),%edx
+     57a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     57d:	0f b6 00             	movzbl (%eax),%eax
+     580:	38 c2                	cmp    %al,%dl
+     582:	74 de                	je     562 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+     584:	8b 45 08             	mov    0x8(%ebp),%eax
+     587:	0f b6 00             	movzbl (%eax),%eax
+     58a:	0f b6 d0             	movzbl %al,%edx
+     58d:	8b 45 0c             	mov    0xc(%ebp),%eax
+     590:	0f b6 00             	movzbl (%eax),%eax
+     593:	0f b6 c0             	movzbl %al,%eax
+     596:	29 c2                	sub    %eax,%edx
+     598:	89 d0                	mov    %edx,%eax
+}
+     59a:	5d                   	pop    %ebp
+     59b:	c3                   	ret
+
+0000059c <strlen>:
+{
+     59c:	55                   	push   %ebp
+     59d:	89 e5                	mov    %esp,%ebp
+     59f:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+     5a2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+     5a9:	eb 04                	jmp    5af <strlen+0x13>
+     5ab:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+     5af:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     5b2:	8b 45 08             	mov    0x8(%ebp),%eax
+     5b5:	01 d0                	add    %edx,%eax
+     5b7:	0f b6 00             	movzbl (%eax),%eax
+     5ba:	84 c0                	test   %al,%al
+     5bc:	75 ed                	jne    5ab <strlen+0xf>
+  return n;
+     5be:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     5c1:	c9                   	leave
+     5c2:	c3                   	ret
+
+000005c3 <memset>:
+{
+     5c3:	55                   	push   %ebp
+     5c4:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+     5c6:	8b 45 10             	mov    0x10(%ebp),%eax
+     5c9:	50                   	push   %eax
+     5ca:	ff 75 0c             	push   0xc(%ebp)
+     5cd:	ff 75 08             	push   0x8(%ebp)
+     5d0:	e8 e0 fe ff ff       	call   4b5 <stosb>
+     5d5:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+     5d8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     5db:	c9                   	leave
+     5dc:	c3                   	ret
+
+000005dd <strchr>:
+{
+     5dd:	55                   	push   %ebp
+     5de:	89 e5                	mov    %esp,%ebp
+     5e0:	83 ec 04             	sub    $0x4,%esp
+     5e3:	8b 45 0c             	mov    0xc(%ebp),%eax
+     5e6:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+     5e9:	eb 14                	jmp    5ff <strchr+0x22>
+    if(*s == c)
+     5eb:	8b 45 08             	mov    0x8(%ebp),%eax
+     5ee:	0f b6 00             	movzbl (%eax),%eax
+     5f1:	38 45 fc             	cmp    %al,-0x4(%ebp)
+     5f4:	75 05                	jne    5fb <strchr+0x1e>
+      return (char*)s;
+     5f6:	8b 45 08             	mov    0x8(%ebp),%eax
+     5f9:	eb 13                	jmp    60e <strchr+0x31>
+  for(; *s; s++)
+     5fb:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+     5ff:	8b 45 08             	mov    0x8(%ebp),%eax
+     602:	0f b6 00             	movzbl (%eax),%eax
+     605:	84 c0                	test   %al,%al
+     607:	75 e2                	jne    5eb <strchr+0xe>
+  return 0;
+     609:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     60e:	c9                   	leave
+     60f:	c3                   	ret
+
+00000610 <gets>:
+{
+     610:	55                   	push   %ebp
+     611:	89 e5                	mov    %esp,%ebp
+     613:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+     616:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     61d:	eb 42                	jmp    661 <gets+0x51>
+    cc = read(0, &c, 1);
+     61f:	83 ec 04             	sub    $0x4,%esp
+     622:	6a 01                	push   $0x1
+     624:	8d 45 ef             	lea    -0x11(%ebp),%eax
+     627:	50                   	push   %eax
+     628:	6a 00                	push   $0x0
+     62a:	e8 ed 04 00 00       	call   b1c <read>
+     62f:	83 c4 10             	add    $0x10,%esp
+     632:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+     635:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     639:	7e 33                	jle    66e <gets+0x5e>
+    buf[i++] = c;
+     63b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     63e:	8d 50 01             	lea    0x1(%eax),%edx
+     641:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     644:	89 c2                	mov    %eax,%edx
+     646:	8b 45 08             	mov    0x8(%ebp),%eax
+     649:	01 c2                	add    %eax,%edx
+     64b:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     64f:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+     651:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     655:	3c 0a                	cmp    $0xa,%al
+     657:	74 16                	je     66f <gets+0x5f>
+     659:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+     65d:	3c 0d                	cmp    $0xd,%al
+     65f:	74 0e                	je     66f <gets+0x5f>
+  for(i=0; i+1 < max; ){
+     661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     664:	83 c0 01             	add    $0x1,%eax
+     667:	39 45 0c             	cmp    %eax,0xc(%ebp)
+     66a:	7f b3                	jg     61f <gets+0xf>
+     66c:	eb 01                	jmp    66f <gets+0x5f>
+      break;
+     66e:	90                   	nop
+  buf[i] = '\0';
+     66f:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     672:	8b 45 08             	mov    0x8(%ebp),%eax
+     675:	01 d0                	add    %edx,%eax
+     677:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+     67a:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     67d:	c9                   	leave
+     67e:	c3                   	ret
+
+0000067f <stat>:
+{
+     67f:	55                   	push   %ebp
+     680:	89 e5                	mov    %esp,%ebp
+     682:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+     685:	83 ec 08             	sub    $0x8,%esp
+     688:	6a 00                	push   $0x0
+     68a:	ff 75 08             	push   0x8(%ebp)
+     68d:	e8 ad 04 00 00       	call   b3f <open>
+     692:	83 c4 10             	add    $0x10,%esp
+     695:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+     698:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     69c:	79 07                	jns    6a5 <stat+0x26>
+    return -1;
+     69e:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     6a3:	eb 25                	jmp    6ca <stat+0x4b>
+  r = fstat(fd, st);
+     6a5:	83 ec 08             	sub    $0x8,%esp
+     6a8:	ff 75 0c             	push   0xc(%ebp)
+     6ab:	ff 75 f4             	push   -0xc(%ebp)
+     6ae:	e8 a1 04 00 00       	call   b54 <fstat>
+     6b3:	83 c4 10             	add    $0x10,%esp
+     6b6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+     6b9:	83 ec 0c             	sub    $0xc,%esp
+     6bc:	ff 75 f4             	push   -0xc(%ebp)
+     6bf:	e8 66 04 00 00       	call   b2a <close>
+     6c4:	83 c4 10             	add    $0x10,%esp
+  return r;
+     6c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+     6ca:	c9                   	leave
+     6cb:	c3                   	ret
+
+000006cc <atoi>:
+{
+     6cc:	55                   	push   %ebp
+     6cd:	89 e5                	mov    %esp,%ebp
+     6cf:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+     6d2:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     6d9:	eb 25                	jmp    700 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+     6db:	8b 55 fc             	mov    -0x4(%ebp),%edx
+     6de:	89 d0                	mov    %edx,%eax
+     6e0:	c1 e0 02             	shl    $0x2,%eax
+     6e3:	01 d0                	add    %edx,%eax
+     6e5:	01 c0                	add    %eax,%eax
+     6e7:	89 c1                	mov    %eax,%ecx
+     6e9:	8b 45 08             	mov    0x8(%ebp),%eax
+     6ec:	8d 50 01             	lea    0x1(%eax),%edx
+     6ef:	89 55 08             	mov    %edx,0x8(%ebp)
+     6f2:	0f b6 00             	movzbl (%eax),%eax
+     6f5:	0f be c0             	movsbl %al,%eax
+     6f8:	01 c8                	add    %ecx,%eax
+     6fa:	83 e8 30             	sub    $0x30,%eax
+     6fd:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+     700:	8b 45 08             	mov    0x8(%ebp),%eax
+     703:	0f b6 00             	movzbl (%eax),%eax
+     706:	3c 2f                	cmp    $0x2f,%al
+     708:	7e 0a                	jle    714 <atoi+0x48>
+     70a:	8b 45 08             	mov    0x8(%ebp),%eax
+     70d:	0f b6 00             	movzbl (%eax),%eax
+     710:	3c 39                	cmp    $0x39,%al
+     712:	7e c7                	jle    6db <atoi+0xf>
+  return n;
+     714:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+     717:	c9                   	leave
+     718:	c3                   	ret
+
+00000719 <memmove>:
+{
+     719:	55                   	push   %ebp
+     71a:	89 e5                	mov    %esp,%ebp
+     71c:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+     71f:	8b 45 08             	mov    0x8(%ebp),%eax
+     722:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+     725:	8b 45 0c             	mov    0xc(%ebp),%eax
+     728:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+     72b:	eb 17                	jmp    744 <memmove+0x2b>
+    *dst++ = *src++;
+     72d:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     730:	8d 42 01             	lea    0x1(%edx),%eax
+     733:	89 45 f8             	mov    %eax,-0x8(%ebp)
+     736:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     739:	8d 48 01             	lea    0x1(%eax),%ecx
+     73c:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+     73f:	0f b6 12             	movzbl (%edx),%edx
+     742:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+     744:	8b 45 10             	mov    0x10(%ebp),%eax
+     747:	8d 50 ff             	lea    -0x1(%eax),%edx
+     74a:	89 55 10             	mov    %edx,0x10(%ebp)
+     74d:	85 c0                	test   %eax,%eax
+     74f:	7f dc                	jg     72d <memmove+0x14>
+  return vdst;
+     751:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+     754:	c9                   	leave
+     755:	c3                   	ret
+
+00000756 <mutex_init>:
+{
+     756:	55                   	push   %ebp
+     757:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+     759:	8b 45 08             	mov    0x8(%ebp),%eax
+     75c:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     762:	90                   	nop
+     763:	5d                   	pop    %ebp
+     764:	c3                   	ret
+
+00000765 <mutex_lock>:
+{
+     765:	55                   	push   %ebp
+     766:	89 e5                	mov    %esp,%ebp
+     768:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+     76b:	8b 45 08             	mov    0x8(%ebp),%eax
+     76e:	6a 01                	push   $0x1
+     770:	6a 00                	push   $0x0
+     772:	50                   	push   %eax
+     773:	e8 7d fd ff ff       	call   4f5 <cmpxchg>
+     778:	83 c4 0c             	add    $0xc,%esp
+     77b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     77e:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     782:	74 46                	je     7ca <mutex_lock+0x65>
+  if(c != 2)
+     784:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+     788:	74 38                	je     7c2 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+     78a:	8b 45 08             	mov    0x8(%ebp),%eax
+     78d:	6a 02                	push   $0x2
+     78f:	50                   	push   %eax
+     790:	e8 46 fd ff ff       	call   4db <xchg>
+     795:	83 c4 08             	add    $0x8,%esp
+     798:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+     79b:	eb 25                	jmp    7c2 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+     79d:	8b 45 08             	mov    0x8(%ebp),%eax
+     7a0:	83 ec 08             	sub    $0x8,%esp
+     7a3:	6a 02                	push   $0x2
+     7a5:	50                   	push   %eax
+     7a6:	e8 22 04 00 00       	call   bcd <futex_wait>
+     7ab:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+     7ae:	8b 45 08             	mov    0x8(%ebp),%eax
+     7b1:	83 ec 08             	sub    $0x8,%esp
+     7b4:	6a 02                	push   $0x2
+     7b6:	50                   	push   %eax
+     7b7:	e8 1f fd ff ff       	call   4db <xchg>
+     7bc:	83 c4 10             	add    $0x10,%esp
+     7bf:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+     7c2:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     7c6:	75 d5                	jne    79d <mutex_lock+0x38>
+     7c8:	eb 01                	jmp    7cb <mutex_lock+0x66>
+    return;
+     7ca:	90                   	nop
+}
+     7cb:	c9                   	leave
+     7cc:	c3                   	ret
+
+000007cd <mutex_unlock>:
+{
+     7cd:	55                   	push   %ebp
+     7ce:	89 e5                	mov    %esp,%ebp
+     7d0:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+     7d3:	8b 45 08             	mov    0x8(%ebp),%eax
+     7d6:	6a 00                	push   $0x0
+     7d8:	50                   	push   %eax
+     7d9:	e8 fd fc ff ff       	call   4db <xchg>
+     7de:	83 c4 08             	add    $0x8,%esp
+     7e1:	83 f8 02             	cmp    $0x2,%eax
+     7e4:	75 11                	jne    7f7 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+     7e6:	8b 45 08             	mov    0x8(%ebp),%eax
+     7e9:	83 ec 08             	sub    $0x8,%esp
+     7ec:	6a 01                	push   $0x1
+     7ee:	50                   	push   %eax
+     7ef:	e8 e3 03 00 00       	call   bd7 <futex_wake>
+     7f4:	83 c4 10             	add    $0x10,%esp
+}
+     7f7:	90                   	nop
+     7f8:	c9                   	leave
+     7f9:	c3                   	ret
+
+000007fa <cond_init>:
+{
+     7fa:	55                   	push   %ebp
+     7fb:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+     7fd:	8b 45 08             	mov    0x8(%ebp),%eax
+     800:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+     806:	90                   	nop
+     807:	5d                   	pop    %ebp
+     808:	c3                   	ret
+
+00000809 <cond_wait>:
+{
+     809:	55                   	push   %ebp
+     80a:	89 e5                	mov    %esp,%ebp
+     80c:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+     80f:	8b 45 08             	mov    0x8(%ebp),%eax
+     812:	8b 00                	mov    (%eax),%eax
+     814:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+     817:	83 ec 0c             	sub    $0xc,%esp
+     81a:	ff 75 0c             	push   0xc(%ebp)
+     81d:	e8 ab ff ff ff       	call   7cd <mutex_unlock>
+     822:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+     825:	8b 45 08             	mov    0x8(%ebp),%eax
+     828:	83 ec 08             	sub    $0x8,%esp
+     82b:	ff 75 f4             	push   -0xc(%ebp)
+     82e:	50                   	push   %eax
+     82f:	e8 99 03 00 00       	call   bcd <futex_wait>
+     834:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+     837:	eb 11                	jmp    84a <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+     839:	8b 45 0c             	mov    0xc(%ebp),%eax
+     83c:	83 ec 08             	sub    $0x8,%esp
+     83f:	6a 02                	push   $0x2
+     841:	50                   	push   %eax
+     842:	e8 86 03 00 00       	call   bcd <futex_wait>
+     847:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+     84a:	8b 45 0c             	mov    0xc(%ebp),%eax
+     84d:	83 ec 08             	sub    $0x8,%esp
+     850:	6a 02                	push   $0x2
+     852:	50                   	push   %eax
+     853:	e8 83 fc ff ff       	call   4db <xchg>
+     858:	83 c4 10             	add    $0x10,%esp
+     85b:	85 c0                	test   %eax,%eax
+     85d:	75 da                	jne    839 <cond_wait+0x30>
+}
+     85f:	90                   	nop
+     860:	90                   	nop
+     861:	c9                   	leave
+     862:	c3                   	ret
+
+00000863 <condbump>:
+{
+     863:	55                   	push   %ebp
+     864:	89 e5                	mov    %esp,%ebp
+     866:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+     869:	8b 45 08             	mov    0x8(%ebp),%eax
+     86c:	8b 00                	mov    (%eax),%eax
+     86e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+     871:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     874:	8d 50 01             	lea    0x1(%eax),%edx
+     877:	8b 45 08             	mov    0x8(%ebp),%eax
+     87a:	52                   	push   %edx
+     87b:	ff 75 fc             	push   -0x4(%ebp)
+     87e:	50                   	push   %eax
+     87f:	e8 71 fc ff ff       	call   4f5 <cmpxchg>
+     884:	83 c4 0c             	add    $0xc,%esp
+     887:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     88a:	75 dd                	jne    869 <condbump+0x6>
+}
+     88c:	90                   	nop
+     88d:	90                   	nop
+     88e:	c9                   	leave
+     88f:	c3                   	ret
+
+00000890 <cond_signal>:
+{
+     890:	55                   	push   %ebp
+     891:	89 e5                	mov    %esp,%ebp
+     893:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+     896:	ff 75 08             	push   0x8(%ebp)
+     899:	e8 c5 ff ff ff       	call   863 <condbump>
+     89e:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+     8a1:	8b 45 08             	mov    0x8(%ebp),%eax
+     8a4:	83 ec 08             	sub    $0x8,%esp
+     8a7:	6a 01                	push   $0x1
+     8a9:	50                   	push   %eax
+     8aa:	e8 28 03 00 00       	call   bd7 <futex_wake>
+     8af:	83 c4 10             	add    $0x10,%esp
+}
+     8b2:	90                   	nop
+     8b3:	c9                   	leave
+     8b4:	c3                   	ret
+
+000008b5 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+     8b5:	55                   	push   %ebp
+     8b6:	89 e5                	mov    %esp,%ebp
+     8b8:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+     8bb:	ff 75 08             	push   0x8(%ebp)
+     8be:	e8 a0 ff ff ff       	call   863 <condbump>
+     8c3:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+     8c6:	8b 45 08             	mov    0x8(%ebp),%eax
+     8c9:	83 ec 08             	sub    $0x8,%esp
+     8cc:	68 ff ff ff 7f       	push   $0x7fffffff
+     8d1:	50                   	push   %eax
+     8d2:	e8 00 03 00 00       	call   bd7 <futex_wake>
+     8d7:	83 c4 10             	add    $0x10,%esp
+}
+     8da:	90                   	nop
+     8db:	c9                   	leave
+     8dc:	c3                   	ret
+
+000008dd <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+     8dd:	55                   	push   %ebp
+     8de:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+     8e0:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+     8e5:	8b 00                	mov    (%eax),%eax
+}
+     8e7:	5d                   	pop    %ebp
+     8e8:	c3                   	ret
+
+000008e9 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+     8e9:	55                   	push   %ebp
+     8ea:	89 e5                	mov    %esp,%ebp
+     8ec:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+     8ef:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+     8f4:	8b 00                	mov    (%eax),%eax
+     8f6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+     8f9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     8fd:	74 05                	je     904 <vgetpid+0x1b>
+    return pid;
+     8ff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     902:	eb 05                	jmp    909 <vgetpid+0x20>
+  return getpid();
+     904:	e8 74 02 00 00       	call   b7d <getpid>
+}
+     909:	c9                   	leave
+     90a:	c3                   	ret
+
+0000090b <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+     90b:	55                   	push   %ebp
+     90c:	89 e5                	mov    %esp,%ebp
+     90e:	57                   	push   %edi
+     90f:	56                   	push   %esi
+     910:	53                   	push   %ebx
+     911:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+     914:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+     91b:	e8 f7 fb ff ff       	call   517 <rdtsc>
+     920:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+     923:	8b 59 0c             	mov    0xc(%ecx),%ebx
+     926:	8b 49 08             	mov    0x8(%ecx),%ecx
+     929:	29 c8                	sub    %ecx,%eax
+     92b:	19 da                	sbb    %ebx,%edx
+     92d:	89 45 e0             	mov    %eax,-0x20(%ebp)
+     930:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+     933:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     936:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     939:	89 d0                	mov    %edx,%eax
+     93b:	31 d2                	xor    %edx,%edx
+     93d:	89 c1                	mov    %eax,%ecx
+     93f:	bb 00 00 00 00       	mov    $0x0,%ebx
+     944:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     947:	8b 40 04             	mov    0x4(%eax),%eax
+     94a:	ba 00 00 00 00       	mov    $0x0,%edx
+     94f:	89 df                	mov    %ebx,%edi
+     951:	0f af f8             	imul   %eax,%edi
+     954:	89 d6                	mov    %edx,%esi
+     956:	0f af f1             	imul   %ecx,%esi
+     959:	01 f7                	add    %esi,%edi
+     95b:	f7 e1                	mul    %ecx
+     95d:	89 c1                	mov    %eax,%ecx
+     95f:	89 d3                	mov    %edx,%ebx
+     961:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+     964:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+     966:	8b 45 e0             	mov    -0x20(%ebp),%eax
+     969:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+     96c:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     96f:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+     976:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     979:	8b 40 04             	mov    0x4(%eax),%eax
+     97c:	89 45 d0             	mov    %eax,-0x30(%ebp)
+     97f:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+     986:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     989:	8b 55 dc             	mov    -0x24(%ebp),%edx
+     98c:	89 d7                	mov    %edx,%edi
+     98e:	8b 75 d0             	mov    -0x30(%ebp),%esi
+     991:	0f af fe             	imul   %esi,%edi
+     994:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+     997:	89 45 d8             	mov    %eax,-0x28(%ebp)
+     99a:	89 55 dc             	mov    %edx,-0x24(%ebp)
+     99d:	0f af f0             	imul   %eax,%esi
+     9a0:	01 f7                	add    %esi,%edi
+     9a2:	8b 45 d0             	mov    -0x30(%ebp),%eax
+     9a5:	f7 65 d8             	mull   -0x28(%ebp)
+     9a8:	8d 34 17             	lea    (%edi,%edx,1),%esi
+     9ab:	89 f2                	mov    %esi,%edx
+     9ad:	89 d0                	mov    %edx,%eax
+     9af:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+     9b1:	01 c8                	add    %ecx,%eax
+     9b3:	11 da                	adc    %ebx,%edx
+}
+     9b5:	83 c4 24             	add    $0x24,%esp
+     9b8:	5b                   	pop    %ebx
+     9b9:	5e                   	pop    %esi
+     9ba:	5f                   	pop    %edi
+     9bb:	5d                   	pop    %ebp
+     9bc:	c3                   	ret
+
+000009bd <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+     9bd:	55                   	push   %ebp
+     9be:	89 e5                	mov    %esp,%ebp
+     9c0:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+     9c3:	8b 45 08             	mov    0x8(%ebp),%eax
+     9c6:	8b 50 04             	mov    0x4(%eax),%edx
+     9c9:	8b 45 08             	mov    0x8(%ebp),%eax
+     9cc:	8b 00                	mov    (%eax),%eax
+     9ce:	29 c2                	sub    %eax,%edx
+     9d0:	83 fa 1f             	cmp    $0x1f,%edx
+     9d3:	76 07                	jbe    9dc <ring_queue+0x1f>
+    return -1;
+     9d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     9da:	eb 68                	jmp    a44 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+     9dc:	8b 45 08             	mov    0x8(%ebp),%eax
+     9df:	8b 40 04             	mov    0x4(%eax),%eax
+     9e2:	83 e0 1f             	and    $0x1f,%eax
+     9e5:	89 c2                	mov    %eax,%edx
+     9e7:	89 d0                	mov    %edx,%eax
+     9e9:	c1 e0 02             	shl    $0x2,%eax
+     9ec:	01 d0                	add    %edx,%eax
+     9ee:	c1 e0 02             	shl    $0x2,%eax
+     9f1:	8d 50 10             	lea    0x10(%eax),%edx
+     9f4:	8b 45 08             	mov    0x8(%ebp),%eax
+     9f7:	01 d0                	add    %edx,%eax
+     9f9:	83 c0 04             	add    $0x4,%eax
+     9fc:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+     9ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a02:	8b 55 0c             	mov    0xc(%ebp),%edx
+     a05:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+     a07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a0a:	8b 55 10             	mov    0x10(%ebp),%edx
+     a0d:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+     a10:	8b 55 14             	mov    0x14(%ebp),%edx
+     a13:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a16:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+     a19:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a1c:	8b 55 18             	mov    0x18(%ebp),%edx
+     a1f:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+     a22:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     a25:	8b 55 1c             	mov    0x1c(%ebp),%edx
+     a28:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+     a2b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+     a30:	8b 45 08             	mov    0x8(%ebp),%eax
+     a33:	8b 40 04             	mov    0x4(%eax),%eax
+     a36:	8d 50 01             	lea    0x1(%eax),%edx
+     a39:	8b 45 08             	mov    0x8(%ebp),%eax
+     a3c:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+     a3f:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     a44:	c9                   	leave
+     a45:	c3                   	ret
+
+00000a46 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+     a46:	55                   	push   %ebp
+     a47:	89 e5                	mov    %esp,%ebp
+     a49:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+     a4c:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+     a51:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     a55:	7f 1a                	jg     a71 <ring_submit+0x2b>
+     a57:	8b 45 08             	mov    0x8(%ebp),%eax
+     a5a:	8b 40 10             	mov    0x10(%eax),%eax
+     a5d:	83 e0 01             	and    $0x1,%eax
+     a60:	85 c0                	test   %eax,%eax
+     a62:	74 0d                	je     a71 <ring_submit+0x2b>
+     a64:	8b 45 08             	mov    0x8(%ebp),%eax
+     a67:	8b 40 10             	mov    0x10(%eax),%eax
+     a6a:	83 e0 02             	and    $0x2,%eax
+     a6d:	85 c0                	test   %eax,%eax
+     a6f:	74 10                	je     a81 <ring_submit+0x3b>
+    return ring_enter(min);
+     a71:	83 ec 0c             	sub    $0xc,%esp
+     a74:	ff 75 0c             	push   0xc(%ebp)
+     a77:	e8 83 01 00 00       	call   bff <ring_enter>
+     a7c:	83 c4 10             	add    $0x10,%esp
+     a7f:	eb 10                	jmp    a91 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+     a81:	8b 45 08             	mov    0x8(%ebp),%eax
+     a84:	8b 50 0c             	mov    0xc(%eax),%edx
+     a87:	8b 45 08             	mov    0x8(%ebp),%eax
+     a8a:	8b 40 08             	mov    0x8(%eax),%eax
+     a8d:	29 c2                	sub    %eax,%edx
+     a8f:	89 d0                	mov    %edx,%eax
+}
+     a91:	c9                   	leave
+     a92:	c3                   	ret
+
+00000a93 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+     a93:	55                   	push   %ebp
+     a94:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+     a96:	8b 45 08             	mov    0x8(%ebp),%eax
+     a99:	8b 50 08             	mov    0x8(%eax),%edx
+     a9c:	8b 45 08             	mov    0x8(%ebp),%eax
+     a9f:	8b 40 0c             	mov    0xc(%eax),%eax
+     aa2:	39 c2                	cmp    %eax,%edx
+     aa4:	75 07                	jne    aad <ring_reap+0x1a>
+    return -1;
+     aa6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+     aab:	eb 3b                	jmp    ae8 <ring_reap+0x55>
+  __sync_synchronize();
+     aad:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+     ab2:	8b 45 08             	mov    0x8(%ebp),%eax
+     ab5:	8b 40 08             	mov    0x8(%eax),%eax
+     ab8:	83 e0 1f             	and    $0x1f,%eax
+     abb:	89 c2                	mov    %eax,%edx
+     abd:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+     ac0:	8b 45 08             	mov    0x8(%ebp),%eax
+     ac3:	83 c2 52             	add    $0x52,%edx
+     ac6:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+     aca:	8b 02                	mov    (%edx),%eax
+     acc:	8b 52 04             	mov    0x4(%edx),%edx
+     acf:	89 01                	mov    %eax,(%ecx)
+     ad1:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+     ad4:	8b 45 08             	mov    0x8(%ebp),%eax
+     ad7:	8b 40 08             	mov    0x8(%eax),%eax
+     ada:	8d 50 01             	lea    0x1(%eax),%edx
+     add:	8b 45 08             	mov    0x8(%ebp),%eax
+     ae0:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+     ae3:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+     ae8:	5d                   	pop    %ebp
+     ae9:	c3                   	ret
+
+00000aea <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+     aea:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+     af1:	74 0a                	je     afd <usyscall+0x13>
+  movl %esp, %ecx
+     af3:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+     af5:	ba fc 0a 00 00       	mov    $0xafc,%edx
+  sysenter
+     afa:	0f 34                	sysenter
+2:
+  ret
+     afc:	c3                   	ret
+1:
+  int $T_SYSCALL
+     afd:	cd 40                	int    $0x40
+  ret
+     aff:	c3                   	ret
+
+00000b00 <fork>:
+
+SYSCALL(fork)
+     b00:	b8 01 00 00 00       	mov    $0x1,%eax
+     b05:	eb e3                	jmp    aea <usyscall>
+
+00000b07 <exit>:
+SYSCALL(exit)
+     b07:	b8 02 00 00 00       	mov    $0x2,%eax
+     b0c:	eb dc                	jmp    aea <usyscall>
+
+00000b0e <wait>:
+SYSCALL(wait)
+     b0e:	b8 03 00 00 00       	mov    $0x3,%eax
+     b13:	eb d5                	jmp    aea <usyscall>
+
+00000b15 <pipe>:
+SYSCALL(pipe)
+     b15:	b8 04 00 00 00       	mov    $0x4,%eax
+     b1a:	eb ce                	jmp    aea <usyscall>
+
+00000b1c <read>:
+SYSCALL(read)
+     b1c:	b8 05 00 00 00       	mov    $0x5,%eax
+     b21:	eb c7                	jmp    aea <usyscall>
+
+00000b23 <write>:
+SYSCALL(write)
+     b23:	b8 10 00 00 00       	mov    $0x10,%eax
+     b28:	eb c0                	jmp    aea <usyscall>
+
+00000b2a <close>:
+SYSCALL(close)
+     b2a:	b8 15 00 00 00       	mov    $0x15,%eax
+     b2f:	eb b9                	jmp    aea <usyscall>
+
+00000b31 <kill>:
+SYSCALL(kill)
+     b31:	b8 06 00 00 00       	mov    $0x6,%eax
+     b36:	eb b2                	jmp    aea <usyscall>
+
+00000b38 <exec>:
+SYSCALL(exec)
+     b38:	b8 07 00 00 00       	mov    $0x7,%eax
+     b3d:	eb ab                	jmp    aea <usyscall>
+
+00000b3f <open>:
+SYSCALL(open)
+     b3f:	b8 0f 00 00 00       	mov    $0xf,%eax
+     b44:	eb a4                	jmp    aea <usyscall>
+
+00000b46 <mknod>:
+SYSCALL(mknod)
+     b46:	b8 11 00 00 00       	mov    $0x11,%eax
+     b4b:	eb 9d                	jmp    aea <usyscall>
+
+00000b4d <unlink>:
+SYSCALL(unlink)
+     b4d:	b8 12 00 00 00       	mov    $0x12,%eax
+     b52:	eb 96                	jmp    aea <usyscall>
+
+00000b54 <fstat>:
+SYSCALL(fstat)
+     b54:	b8 08 00 00 00       	mov    $0x8,%eax
+     b59:	eb 8f                	jmp    aea <usyscall>
+
+00000b5b <link>:
+SYSCALL(link)
+     b5b:	b8 13 00 00 00       	mov    $0x13,%eax
+     b60:	eb 88                	jmp    aea <usyscall>
+
+00000b62 <mkdir>:
+SYSCALL(mkdir)
+     b62:	b8 14 00 00 00       	mov    $0x14,%eax
+     b67:	eb 81                	jmp    aea <usyscall>
+
+00000b69 <chdir>:
+SYSCALL(chdir)
+     b69:	b8 09 00 00 00       	mov    $0x9,%eax
+     b6e:	e9 77 ff ff ff       	jmp    aea <usyscall>
+
+00000b73 <dup>:
+SYSCALL(dup)
+     b73:	b8 0a 00 00 00       	mov    $0xa,%eax
+     b78:	e9 6d ff ff ff       	jmp    aea <usyscall>
+
+00000b7d <getpid>:
+SYSCALL(getpid)
+     b7d:	b8 0b 00 00 00       	mov    $0xb,%eax
+     b82:	e9 63 ff ff ff       	jmp    aea <usyscall>
+
+00000b87 <sbrk>:
+SYSCALL(sbrk)
+     b87:	b8 0c 00 00 00       	mov    $0xc,%eax
+     b8c:	e9 59 ff ff ff       	jmp    aea <usyscall>
+
+00000b91 <sleep>:
+SYSCALL(sleep)
+     b91:	b8 0d 00 00 00       	mov    $0xd,%eax
+     b96:	e9 4f ff ff ff       	jmp    aea <usyscall>
+
+00000b9b <uptime>:
+SYSCALL(uptime)
+     b9b:	b8 0e 00 00 00       	mov    $0xe,%eax
+     ba0:	e9 45 ff ff ff       	jmp    aea <usyscall>
+
+00000ba5 <kmstat>:
+SYSCALL(kmstat)
+     ba5:	b8 16 00 00 00       	mov    $0x16,%eax
+     baa:	e9 3b ff ff ff       	jmp    aea <usyscall>
+
+00000baf <setpriority>:
+SYSCALL(setpriority)
+     baf:	b8 17 00 00 00       	mov    $0x17,%eax
+     bb4:	e9 31 ff ff ff       	jmp    aea <usyscall>
+
+00000bb9 <clone>:
+SYSCALL(clone)
+     bb9:	b8 18 00 00 00       	mov    $0x18,%eax
+     bbe:	e9 27 ff ff ff       	jmp    aea <usyscall>
+
+00000bc3 <join>:
+SYSCALL(join)
+     bc3:	b8 19 00 00 00       	mov    $0x19,%eax
+     bc8:	e9 1d ff ff ff       	jmp    aea <usyscall>
+
+00000bcd <futex_wait>:
+SYSCALL(futex_wait)
+     bcd:	b8 1a 00 00 00       	mov    $0x1a,%eax
+     bd2:	e9 13 ff ff ff       	jmp    aea <usyscall>
+
+00000bd7 <futex_wake>:
+SYSCALL(futex_wake)
+     bd7:	b8 1b 00 00 00       	mov    $0x1b,%eax
+     bdc:	e9 09 ff ff ff       	jmp    aea <usyscall>
+
+00000be1 <lockstat>:
+SYSCALL(lockstat)
+     be1:	b8 1c 00 00 00       	mov    $0x1c,%eax
+     be6:	e9 ff fe ff ff       	jmp    aea <usyscall>
+
+00000beb <sysstat>:
+SYSCALL(sysstat)
+     beb:	b8 1d 00 00 00       	mov    $0x1d,%eax
+     bf0:	e9 f5 fe ff ff       	jmp    aea <usyscall>
+
+00000bf5 <ring_setup>:
+SYSCALL(ring_setup)
+     bf5:	b8 1e 00 00 00       	mov    $0x1e,%eax
+     bfa:	e9 eb fe ff ff       	jmp    aea <usyscall>
+
+00000bff <ring_enter>:
+SYSCALL(ring_enter)
+     bff:	b8 1f 00 00 00       	mov    $0x1f,%eax
+     c04:	e9 e1 fe ff ff       	jmp    aea <usyscall>
+
+00000c09 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+     c09:	55                   	push   %ebp
+     c0a:	89 e5                	mov    %esp,%ebp
+     c0c:	83 ec 18             	sub    $0x18,%esp
+     c0f:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c12:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+     c15:	83 ec 04             	sub    $0x4,%esp
+     c18:	6a 01                	push   $0x1
+     c1a:	8d 45 f4             	lea    -0xc(%ebp),%eax
+     c1d:	50                   	push   %eax
+     c1e:	ff 75 08             	push   0x8(%ebp)
+     c21:	e8 fd fe ff ff       	call   b23 <write>
+     c26:	83 c4 10             	add    $0x10,%esp
+}
+     c29:	90                   	nop
+     c2a:	c9                   	leave
+     c2b:	c3                   	ret
+
+00000c2c <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+     c2c:	55                   	push   %ebp
+     c2d:	89 e5                	mov    %esp,%ebp
+     c2f:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+     c32:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+     c39:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+     c3d:	74 17                	je     c56 <printint+0x2a>
+     c3f:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+     c43:	79 11                	jns    c56 <printint+0x2a>
+    neg = 1;
+     c45:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+     c4c:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c4f:	f7 d8                	neg    %eax
+     c51:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c54:	eb 06                	jmp    c5c <printint+0x30>
+  } else {
+    x = xx;
+     c56:	8b 45 0c             	mov    0xc(%ebp),%eax
+     c59:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+     c5c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+     c63:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c66:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c69:	ba 00 00 00 00       	mov    $0x0,%edx
+     c6e:	f7 f1                	div    %ecx
+     c70:	89 d1                	mov    %edx,%ecx
+     c72:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c75:	8d 50 01             	lea    0x1(%eax),%edx
+     c78:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     c7b:	0f b6 91 b0 16 00 00 	movzbl 0x16b0(%ecx),%edx
+     c82:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+     c86:	8b 4d 10             	mov    0x10(%ebp),%ecx
+     c89:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c8c:	ba 00 00 00 00       	mov    $0x0,%edx
+     c91:	f7 f1                	div    %ecx
+     c93:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     c96:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     c9a:	75 c7                	jne    c63 <printint+0x37>
+  if(neg)
+     c9c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     ca0:	74 2d                	je     ccf <printint+0xa3>
+    buf[i++] = '-';
+     ca2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ca5:	8d 50 01             	lea    0x1(%eax),%edx
+     ca8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     cab:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+     cb0:	eb 1d                	jmp    ccf <printint+0xa3>
+    putc(fd, buf[i]);
+     cb2:	8d 55 dc             	lea    -0x24(%ebp),%edx
+     cb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     cb8:	01 d0                	add    %edx,%eax
+     cba:	0f b6 00             	movzbl (%eax),%eax
+     cbd:	0f be c0             	movsbl %al,%eax
+     cc0:	83 ec 08             	sub    $0x8,%esp
+     cc3:	50                   	push   %eax
+     cc4:	ff 75 08             	push   0x8(%ebp)
+     cc7:	e8 3d ff ff ff       	call   c09 <putc>
+     ccc:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+     ccf:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+     cd3:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     cd7:	79 d9                	jns    cb2 <printint+0x86>
+}
+     cd9:	90                   	nop
+     cda:	90                   	nop
+     cdb:	c9                   	leave
+     cdc:	c3                   	ret
+
+00000cdd <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+     cdd:	55                   	push   %ebp
+     cde:	89 e5                	mov    %esp,%ebp
+     ce0:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+     ce3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+     cea:	8d 45 0c             	lea    0xc(%ebp),%eax
+     ced:	83 c0 04             	add    $0x4,%eax
+     cf0:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+     cf3:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     cfa:	e9 59 01 00 00       	jmp    e58 <printf+0x17b>
+    c = fmt[i] & 0xff;
+     cff:	8b 55 0c             	mov    0xc(%ebp),%edx
+     d02:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     d05:	01 d0                	add    %edx,%eax
+     d07:	0f b6 00             	movzbl (%eax),%eax
+     d0a:	0f be c0             	movsbl %al,%eax
+     d0d:	25 ff 00 00 00       	and    $0xff,%eax
+     d12:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+     d15:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     d19:	75 2c                	jne    d47 <printf+0x6a>
+      if(c == '%'){
+     d1b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     d1f:	75 0c                	jne    d2d <printf+0x50>
+        state = '%';
+     d21:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+     d28:	e9 27 01 00 00       	jmp    e54 <printf+0x177>
+      } else {
+        putc(fd, c);
+     d2d:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     d30:	0f be c0             	movsbl %al,%eax
+     d33:	83 ec 08             	sub    $0x8,%esp
+     d36:	50                   	push   %eax
+     d37:	ff 75 08             	push   0x8(%ebp)
+     d3a:	e8 ca fe ff ff       	call   c09 <putc>
+     d3f:	83 c4 10             	add    $0x10,%esp
+     d42:	e9 0d 01 00 00       	jmp    e54 <printf+0x177>
+      }
+    } else if(state == '%'){
+     d47:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+     d4b:	0f 85 03 01 00 00    	jne    e54 <printf+0x177>
+      if(c == 'd'){
+     d51:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+     d55:	75 1e                	jne    d75 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+     d57:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d5a:	8b 00                	mov    (%eax),%eax
+     d5c:	6a 01                	push   $0x1
+     d5e:	6a 0a                	push   $0xa
+     d60:	50                   	push   %eax
+     d61:	ff 75 08             	push   0x8(%ebp)
+     d64:	e8 c3 fe ff ff       	call   c2c <printint>
+     d69:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d6c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     d70:	e9 d8 00 00 00       	jmp    e4d <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+     d75:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+     d79:	74 06                	je     d81 <printf+0xa4>
+     d7b:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+     d7f:	75 1e                	jne    d9f <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+     d81:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d84:	8b 00                	mov    (%eax),%eax
+     d86:	6a 00                	push   $0x0
+     d88:	6a 10                	push   $0x10
+     d8a:	50                   	push   %eax
+     d8b:	ff 75 08             	push   0x8(%ebp)
+     d8e:	e8 99 fe ff ff       	call   c2c <printint>
+     d93:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     d96:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     d9a:	e9 ae 00 00 00       	jmp    e4d <printf+0x170>
+      } else if(c == 's'){
+     d9f:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+     da3:	75 43                	jne    de8 <printf+0x10b>
+        s = (char*)*ap;
+     da5:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     da8:	8b 00                	mov    (%eax),%eax
+     daa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+     dad:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+     db1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     db5:	75 25                	jne    ddc <printf+0xff>
+          s = "(null)";
+     db7:	c7 45 f4 a2 11 00 00 	movl   $0x11a2,-0xc(%ebp)
+        while(*s != 0){
+     dbe:	eb 1c                	jmp    ddc <printf+0xff>
+          putc(fd, *s);
+     dc0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     dc3:	0f b6 00             	movzbl (%eax),%eax
+     dc6:	0f be c0             	movsbl %al,%eax
+     dc9:	83 ec 08             	sub    $0x8,%esp
+     dcc:	50                   	push   %eax
+     dcd:	ff 75 08             	push   0x8(%ebp)
+     dd0:	e8 34 fe ff ff       	call   c09 <putc>
+     dd5:	83 c4 10             	add    $0x10,%esp
+          s++;
+     dd8:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+     ddc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     ddf:	0f b6 00             	movzbl (%eax),%eax
+     de2:	84 c0                	test   %al,%al
+     de4:	75 da                	jne    dc0 <printf+0xe3>
+     de6:	eb 65                	jmp    e4d <printf+0x170>
+        }
+      } else if(c == 'c'){
+     de8:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+     dec:	75 1d                	jne    e0b <printf+0x12e>
+        putc(fd, *ap);
+     dee:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     df1:	8b 00                	mov    (%eax),%eax
+     df3:	0f be c0             	movsbl %al,%eax
+     df6:	83 ec 08             	sub    $0x8,%esp
+     df9:	50                   	push   %eax
+     dfa:	ff 75 08             	push   0x8(%ebp)
+     dfd:	e8 07 fe ff ff       	call   c09 <putc>
+     e02:	83 c4 10             	add    $0x10,%esp
+        ap++;
+     e05:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+     e09:	eb 42                	jmp    e4d <printf+0x170>
+      } else if(c == '%'){
+     e0b:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+     e0f:	75 17                	jne    e28 <printf+0x14b>
+        putc(fd, c);
+     e11:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e14:	0f be c0             	movsbl %al,%eax
+     e17:	83 ec 08             	sub    $0x8,%esp
+     e1a:	50                   	push   %eax
+     e1b:	ff 75 08             	push   0x8(%ebp)
+     e1e:	e8 e6 fd ff ff       	call   c09 <putc>
+     e23:	83 c4 10             	add    $0x10,%esp
+     e26:	eb 25                	jmp    e4d <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+     e28:	83 ec 08             	sub    $0x8,%esp
+     e2b:	6a 25                	push   $0x25
+     e2d:	ff 75 08             	push   0x8(%ebp)
+     e30:	e8 d4 fd ff ff       	call   c09 <putc>
+     e35:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+     e38:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     e3b:	0f be c0             	movsbl %al,%eax
+     e3e:	83 ec 08             	sub    $0x8,%esp
+     e41:	50                   	push   %eax
+     e42:	ff 75 08             	push   0x8(%ebp)
+     e45:	e8 bf fd ff ff       	call   c09 <putc>
+     e4a:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+     e4d:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+     e54:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     e58:	8b 55 0c             	mov    0xc(%ebp),%edx
+     e5b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     e5e:	01 d0                	add    %edx,%eax
+     e60:	0f b6 00             	movzbl (%eax),%eax
+     e63:	84 c0                	test   %al,%al
+     e65:	0f 85 94 fe ff ff    	jne    cff <printf+0x22>
+    }
+  }
+}
+     e6b:	90                   	nop
+     e6c:	90                   	nop
+     e6d:	c9                   	leave
+     e6e:	c3                   	ret
+
+00000e6f <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+     e6f:	55                   	push   %ebp
+     e70:	89 e5                	mov    %esp,%ebp
+     e72:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+     e75:	8b 45 08             	mov    0x8(%ebp),%eax
+     e78:	83 e8 08             	sub    $0x8,%eax
+     e7b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     e7e:	a1 e8 3f 00 00       	mov    0x3fe8,%eax
+     e83:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     e86:	eb 24                	jmp    eac <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+     e88:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e8b:	8b 00                	mov    (%eax),%eax
+     e8d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e90:	72 12                	jb     ea4 <free+0x35>
+     e92:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     e95:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     e98:	72 24                	jb     ebe <free+0x4f>
+     e9a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     e9d:	8b 00                	mov    (%eax),%eax
+     e9f:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     ea2:	72 1a                	jb     ebe <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+     ea4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ea7:	8b 00                	mov    (%eax),%eax
+     ea9:	89 45 fc             	mov    %eax,-0x4(%ebp)
+     eac:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     eaf:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+     eb2:	73 d4                	jae    e88 <free+0x19>
+     eb4:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     eb7:	8b 00                	mov    (%eax),%eax
+     eb9:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     ebc:	73 ca                	jae    e88 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+     ebe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ec1:	8b 40 04             	mov    0x4(%eax),%eax
+     ec4:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     ecb:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ece:	01 c2                	add    %eax,%edx
+     ed0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ed3:	8b 00                	mov    (%eax),%eax
+     ed5:	39 c2                	cmp    %eax,%edx
+     ed7:	75 24                	jne    efd <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+     ed9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     edc:	8b 50 04             	mov    0x4(%eax),%edx
+     edf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ee2:	8b 00                	mov    (%eax),%eax
+     ee4:	8b 40 04             	mov    0x4(%eax),%eax
+     ee7:	01 c2                	add    %eax,%edx
+     ee9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     eec:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+     eef:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     ef2:	8b 00                	mov    (%eax),%eax
+     ef4:	8b 10                	mov    (%eax),%edx
+     ef6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     ef9:	89 10                	mov    %edx,(%eax)
+     efb:	eb 0a                	jmp    f07 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+     efd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f00:	8b 10                	mov    (%eax),%edx
+     f02:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f05:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+     f07:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f0a:	8b 40 04             	mov    0x4(%eax),%eax
+     f0d:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+     f14:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f17:	01 d0                	add    %edx,%eax
+     f19:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+     f1c:	75 20                	jne    f3e <free+0xcf>
+    p->s.size += bp->s.size;
+     f1e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f21:	8b 50 04             	mov    0x4(%eax),%edx
+     f24:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f27:	8b 40 04             	mov    0x4(%eax),%eax
+     f2a:	01 c2                	add    %eax,%edx
+     f2c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f2f:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+     f32:	8b 45 f8             	mov    -0x8(%ebp),%eax
+     f35:	8b 10                	mov    (%eax),%edx
+     f37:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f3a:	89 10                	mov    %edx,(%eax)
+     f3c:	eb 08                	jmp    f46 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+     f3e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f41:	8b 55 f8             	mov    -0x8(%ebp),%edx
+     f44:	89 10                	mov    %edx,(%eax)
+  freep = p;
+     f46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+     f49:	a3 e8 3f 00 00       	mov    %eax,0x3fe8
+}
+     f4e:	90                   	nop
+     f4f:	c9                   	leave
+     f50:	c3                   	ret
+
+00000f51 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+     f51:	55                   	push   %ebp
+     f52:	89 e5                	mov    %esp,%ebp
+     f54:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+     f57:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+     f5e:	77 07                	ja     f67 <morecore+0x16>
+    nu = 4096;
+     f60:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+     f67:	8b 45 08             	mov    0x8(%ebp),%eax
+     f6a:	c1 e0 03             	shl    $0x3,%eax
+     f6d:	83 ec 0c             	sub    $0xc,%esp
+     f70:	50                   	push   %eax
+     f71:	e8 11 fc ff ff       	call   b87 <sbrk>
+     f76:	83 c4 10             	add    $0x10,%esp
+     f79:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+     f7c:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+     f80:	75 07                	jne    f89 <morecore+0x38>
+    return 0;
+     f82:	b8 00 00 00 00       	mov    $0x0,%eax
+     f87:	eb 26                	jmp    faf <morecore+0x5e>
+  hp = (Header*)p;
+     f89:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     f8c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+     f8f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f92:	8b 55 08             	mov    0x8(%ebp),%edx
+     f95:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+     f98:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     f9b:	83 c0 08             	add    $0x8,%eax
+     f9e:	83 ec 0c             	sub    $0xc,%esp
+     fa1:	50                   	push   %eax
+     fa2:	e8 c8 fe ff ff       	call   e6f <free>
+     fa7:	83 c4 10             	add    $0x10,%esp
+  return freep;
+     faa:	a1 e8 3f 00 00       	mov    0x3fe8,%eax
+}
+     faf:	c9                   	leave
+     fb0:	c3                   	ret
+
+00000fb1 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+     fb1:	55                   	push   %ebp
+     fb2:	89 e5                	mov    %esp,%ebp
+     fb4:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+     fb7:	8b 45 08             	mov    0x8(%ebp),%eax
+     fba:	83 c0 07             	add    $0x7,%eax
+     fbd:	c1 e8 03             	shr    $0x3,%eax
+     fc0:	83 c0 01             	add    $0x1,%eax
+     fc3:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+     fc6:	a1 e8 3f 00 00       	mov    0x3fe8,%eax
+     fcb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+     fce:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     fd2:	75 23                	jne    ff7 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+     fd4:	c7 45 f0 e0 3f 00 00 	movl   $0x3fe0,-0x10(%ebp)
+     fdb:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     fde:	a3 e8 3f 00 00       	mov    %eax,0x3fe8
+     fe3:	a1 e8 3f 00 00       	mov    0x3fe8,%eax
+     fe8:	a3 e0 3f 00 00       	mov    %eax,0x3fe0
+    base.s.size = 0;
+     fed:	c7 05 e4 3f 00 00 00 	movl   $0x0,0x3fe4
+     ff4:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+     ff7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     ffa:	8b 00                	mov    (%eax),%eax
+     ffc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+     fff:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1002:	8b 40 04             	mov    0x4(%eax),%eax
+    1005:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    1008:	72 4d                	jb     1057 <malloc+0xa6>
+      if(p->s.size == nunits)
+    100a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    100d:	8b 40 04             	mov    0x4(%eax),%eax
+    1010:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1013:	75 0c                	jne    1021 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    1015:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1018:	8b 10                	mov    (%eax),%edx
+    101a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    101d:	89 10                	mov    %edx,(%eax)
+    101f:	eb 26                	jmp    1047 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    1021:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1024:	8b 40 04             	mov    0x4(%eax),%eax
+    1027:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    102a:	89 c2                	mov    %eax,%edx
+    102c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    102f:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    1032:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1035:	8b 40 04             	mov    0x4(%eax),%eax
+    1038:	c1 e0 03             	shl    $0x3,%eax
+    103b:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    103e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1041:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    1044:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    1047:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    104a:	a3 e8 3f 00 00       	mov    %eax,0x3fe8
+      return (void*)(p + 1);
+    104f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1052:	83 c0 08             	add    $0x8,%eax
+    1055:	eb 3b                	jmp    1092 <malloc+0xe1>
+    }
+    if(p == freep)
+    1057:	a1 e8 3f 00 00       	mov    0x3fe8,%eax
+    105c:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    105f:	75 1e                	jne    107f <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    1061:	83 ec 0c             	sub    $0xc,%esp
+    1064:	ff 75 ec             	push   -0x14(%ebp)
+    1067:	e8 e5 fe ff ff       	call   f51 <morecore>
+    106c:	83 c4 10             	add    $0x10,%esp
+    106f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1072:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1076:	75 07                	jne    107f <malloc+0xce>
+        return 0;
+    1078:	b8 00 00 00 00       	mov    $0x0,%eax
+    107d:	eb 13                	jmp    1092 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    107f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1082:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    1085:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1088:	8b 00                	mov    (%eax),%eax
+    108a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    108d:	e9 6d ff ff ff       	jmp    fff <malloc+0x4e>
+  }
+}
+    1092:	c9                   	leave
+    1093:	c3                   	ret
+
+00001094 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    1094:	55                   	push   %ebp
+    1095:	89 e5                	mov    %esp,%ebp
+    1097:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    109a:	83 ec 0c             	sub    $0xc,%esp
+    109d:	68 00 10 00 00       	push   $0x1000
+    10a2:	e8 0a ff ff ff       	call   fb1 <malloc>
+    10a7:	83 c4 10             	add    $0x10,%esp
+    10aa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    10ad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    10b1:	75 07                	jne    10ba <thread_create+0x26>
+    return -1;
+    10b3:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    10b8:	eb 2e                	jmp    10e8 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+    10ba:	83 ec 04             	sub    $0x4,%esp
+    10bd:	ff 75 f4             	push   -0xc(%ebp)
+    10c0:	ff 75 0c             	push   0xc(%ebp)
+    10c3:	ff 75 08             	push   0x8(%ebp)
+    10c6:	e8 ee fa ff ff       	call   bb9 <clone>
+    10cb:	83 c4 10             	add    $0x10,%esp
+    10ce:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    10d1:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    10d5:	79 0e                	jns    10e5 <thread_create+0x51>
+    free(stack);
+    10d7:	83 ec 0c             	sub    $0xc,%esp
+    10da:	ff 75 f4             	push   -0xc(%ebp)
+    10dd:	e8 8d fd ff ff       	call   e6f <free>
+    10e2:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    10e5:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    10e8:	c9                   	leave
+    10e9:	c3                   	ret
+
+000010ea <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+    10ea:	55                   	push   %ebp
+    10eb:	89 e5                	mov    %esp,%ebp
+    10ed:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    10f0:	83 ec 0c             	sub    $0xc,%esp
+    10f3:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    10f6:	50                   	push   %eax
+    10f7:	e8 c7 fa ff ff       	call   bc3 <join>
+    10fc:	83 c4 10             	add    $0x10,%esp
+    10ff:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1102:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1106:	78 0f                	js     1117 <thread_join+0x2d>
+    free(stack);
+    1108:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    110b:	83 ec 0c             	sub    $0xc,%esp
+    110e:	50                   	push   %eax
+    110f:	e8 5b fd ff ff       	call   e6f <free>
+    1114:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    1117:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    111a:	c9                   	leave
+    111b:	c3                   	ret
@@ -0,0 +1,100 @@
+// Print system call counts and latencies, the most time
+// consuming calls first.  Latencies are in cycles; p50 and p99
+// are the upper ends of the power-of-two histogram buckets
+// they fall in.  sysstat -h also prints the nonzero buckets,
+// as 2^i:count for calls taking 2^i to 2^(i+1)-1 cycles.
+// sysstat -r zeroes the counts after printing them, so the
+// next run shows only what happened in between.
+
+#include "types.h"
+#include "stat.h"
+#include "user.h"
+#include "sysstat.h"
+
+#define NSYS 64
+
+struct sysstat st[NSYS];
+
+// a / b, without 64-bit division.
+uint
+div64(uint64 a, uint b)
+{
+  int shift;
+
+  for(shift = 0; a >> 32; shift++)
+    a >>= 1;
+  return ((uint)a / b) << shift;
+}
+
+// Upper end of the histogram bucket holding the call that
+// makes up fraction pct of the n calls in hist[].
+uint
+percentile(uint *hist, uint n, uint pct)
+{
+  uint sum, want;
+  int i;
+
+  want = (n / 100) * pct + ((n % 100) * pct + 99) / 100;
+  sum = 0;
+  for(i = 0; i < NSYSHIST - 1; i++){
+    sum += hist[i];
+    if(sum >= want)
+      break;
+  }
+  return (2U << i) - 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+  int i, j, n, reset, hist;
+  uint done;
+  struct sysstat t;
+
+  reset = hist = 0;
+  for(i = 1; i < argc; i++){
+    if(strcmp(argv[i], "-r") == 0)
+      reset = 1;
+    else if(strcmp(argv[i], "-h") == 0)
+      hist = 1;
+    else {
+      printf(2, "usage: sysstat [-h] [-r]\n");
+      exit();
+    }
+  }
+  if((n = sysstat(st, NSYS, reset)) < 0){
+    printf(2, "sysstat: failed\n");
+    exit();
+  }
+
+  // Sort by time spent.
+  for(i = 1; i < n; i++){
+    t = st[i];
+    for(j = i; j > 0 && st[j-1].cycles < t.cycles; j--)
+      st[j] = st[j-1];
+    st[j] = t;
+  }
+
+  printf(1, "name calls errors total-kcyc avg p50 p99\n");
+  for(i = 0; i < n; i++){
+    if(st[i].calls == 0)
+      continue;
+    done = 0;
+    for(j = 0; j < NSYSHIST; j++)
+      done += st[i].hist[j];
+    printf(1, "%s %d %d %d", st[i].name, st[i].calls, st[i].errors,
+           (uint)(st[i].cycles >> 10));
+    if(done)
+      printf(1, " %d %d %d", div64(st[i].cycles, done),
+             percentile(st[i].hist, done, 50),
+             percentile(st[i].hist, done, 99));
+    else
+      printf(1, " - - -");
+    if(hist)
+      for(j = 0; j < NSYSHIST; j++)
+        if(st[i].hist[j])
+          printf(1, " 2^%d:%d", j, st[i].hist[j]);
+    printf(1, "\n");
+  }
+  exit();
+}
@@ -0,0 +1,12 @@
+// Counts for one system call, as reported by sysstat().
+// Times are in CPU cycles.
+#define NSYSHIST 32
+
+struct sysstat {
+  char name[16];        // System call name
+  int num;              // System call number
+  uint calls;           // Calls made
+  uint errors;          // Calls that returned -1
+  uint64 cycles;        // Cycles spent in calls that returned
+  uint hist[NSYSHIST];  // Calls that took 2^i to 2^(i+1)-1 cycles
+};
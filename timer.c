@@ -8,6 +8,8 @@
 #include "x86.h"
 
 #define IO_TIMER1       0x040           // 8253 Timer #1
+#define IO_TIMER2       (IO_TIMER1 + 2) // counter 2
+#define IO_PPI          0x061           // counter 2 gate and output
 
 // Frequency of all three count-down timers;
 // (TIMER_FREQ/freq) is the appropriate count
@@ -18,6 +20,8 @@
 
 #define TIMER_MODE      (IO_TIMER1 + 3) // timer mode port
 #define TIMER_SEL0      0x00    // select counter 0
+#define TIMER_SEL2      0x80    // select counter 2
+#define TIMER_INTTC     0x00    // mode 0, interrupt on terminal count
 #define TIMER_RATEGEN   0x04    // mode 2, rate generator
 #define TIMER_16BIT     0x30    // r/w counter 16 bits, LSB first
 
@@ -30,3 +34,22 @@ timerinit(void)
   outb(IO_TIMER1, TIMER_DIV(100) / 256);
   picenable(IRQ_TIMER);
 }
+
+// Count TSC cycles in 10ms, timed by counter 2, which
+// works without interrupts and is free on every PC.
+// Returns 0 if the counter never runs out.
+uint
+tsccalibrate(void)
+{
+  uint t0, i;
+
+  outb(IO_PPI, (inb(IO_PPI) & ~0x02) | 0x01);  // gate on, speaker off
+  outb(TIMER_MODE, TIMER_SEL2 | TIMER_INTTC | TIMER_16BIT);
+  outb(IO_TIMER2, TIMER_DIV(100) % 256);
+  outb(IO_TIMER2, TIMER_DIV(100) / 256);
+  t0 = rdtsc();
+  for(i = 0; (inb(IO_PPI) & 0x20) == 0; i++)
+    if(i == 10000000)
+      return 0;
+  return rdtsc() - t0;
+}
@@ -3,14 +3,15 @@
 #include "param.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "x86.h"
 #include "traps.h"
-#include "spinlock.h"
 
 // Interrupt descriptor table (shared by all CPUs).
 struct gatedesc idt[256];
 extern uint vectors[];  // in vectors.S: array of 256 entry pointers
+extern char sysenter[]; // in trapasm.S
 struct spinlock tickslock;
 uint ticks;
 
@@ -30,6 +31,16 @@ void
 idtinit(void)
 {
   lidt(idt, sizeof(idt));
+
+  // SYSENTER loads %esp from the MSR, but it has to start on the
+  // current process's kernel stack; point it at this CPU's copy
+  // of that address and let sysenter load it.  The words below
+  // are a stack for a debug trap taken before then (see trap).
+  if(cpuid(1) & CPUID_SEP){
+    wrmsr(MSR_SYSENTER_CS, SEG_KCODE << 3);
+    wrmsr(MSR_SYSENTER_ESP, (uint)&cpu->sysesp);
+    wrmsr(MSR_SYSENTER_EIP, (uint)sysenter);
+  }
 }
 
 //PAGEBREAK: 41
@@ -51,6 +62,7 @@ trap(struct trapframe *tf)
     if(cpu->id == 0){
       acquire(&tickslock);
       ticks++;
+      vdsotick(ticks);
       wakeup(&ticks);
       release(&tickslock);
     }
@@ -60,6 +72,10 @@ trap(struct trapframe *tf)
     ideintr();
     lapiceoi();
     break;
+  case T_IRQ0 + IRQ_WAKEUP:
+    // An idle CPU was halted; the scheduler looks for work next.
+    lapiceoi();
+    break;
   case T_IRQ0 + IRQ_IDE+1:
     // Bochs generates spurious IDE1 interrupts.
     break;
@@ -71,6 +87,19 @@ trap(struct trapframe *tf)
     uartintr();
     lapiceoi();
     break;
+  case T_DEVICE:
+    if((tf->cs&3) == DPL_USER && fputrap() == 0)
+      break;
+    goto bad;
+  case T_DEBUG:
+    // SYSENTER keeps the user's TF, so a single-stepped
+    // sysenter traps before the entry's first instruction,
+    // on cpu->sysstack.  Drop TF and let the call go on.
+    if((tf->cs&3) == 0 && tf->eip == (uint)sysenter){
+      tf->eflags &= ~FL_TF;
+      break;
+    }
+    goto bad;
   case T_IRQ0 + 7:
   case T_IRQ0 + IRQ_SPURIOUS:
     cprintf("cpu%d: spurious interrupt at %x:%x\n",
@@ -80,6 +109,7 @@ trap(struct trapframe *tf)
    
   //PAGEBREAK: 13
   default:
+  bad:
     if(proc == 0 || (tf->cs&3) == 0){
       // In kernel, it must be our mistake.
       cprintf("unexpected trap %d from cpu %d eip %x (cr2=0x%x)\n",
@@ -100,9 +130,11 @@ trap(struct trapframe *tf)
   if(proc && proc->killed && (tf->cs&3) == DPL_USER)
     exit();
 
-  // Force process to give up CPU on clock tick.
+  // Force process to give up CPU on clock tick, once it has
+  // used up its quantum (see schedtick).
   // If interrupts were on while locks held, would need to check nlock.
-  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER)
+  if(proc && proc->state == RUNNING && tf->trapno == T_IRQ0+IRQ_TIMER &&
+     schedtick())
     yield();
 
   // Check if the process has been killed since we yielded
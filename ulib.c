@@ -3,6 +3,8 @@
 #include "fcntl.h"
 #include "user.h"
 #include "x86.h"
+#include "vdso.h"
+#include "ring.h"
 
 char*
 strcpy(char *s, char *t)
@@ -103,3 +105,159 @@ memmove(void *vdst, void *vsrc, int n)
     *dst++ = *src++;
   return vdst;
 }
+
+// Mutexes and condition variables for threads.  Taking a free
+// mutex or releasing one nobody waits for is a single atomic
+// instruction; only contention costs a system call.
+
+void
+mutex_init(struct mutex *m)
+{
+  m->state = 0;
+}
+
+void
+mutex_lock(struct mutex *m)
+{
+  uint c;
+
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    return;
+  // Mark it contended so the holder knows to wake us.
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+}
+
+void
+mutex_unlock(struct mutex *m)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  seq = c->seq;
+  mutex_unlock(m);
+  futex_wait((uint*)&c->seq, seq);
+  // Others may be waiting for m too: take it contended.
+  while(xchg(&m->state, 2) != 0)
+    futex_wait((uint*)&m->state, 2);
+}
+
+static void
+condbump(struct cond *c)
+{
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+
+void
+cond_signal(struct cond *c)
+{
+  condbump(c);
+  futex_wake((uint*)&c->seq, 1);
+}
+
+void
+cond_broadcast(struct cond *c)
+{
+  condbump(c);
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+}
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+  return ((volatile struct vdso*)VDSO)->ticks;
+}
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+    return pid;
+  return getpid();
+}
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+  t = rdtsc() - v->boottsc;
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+}
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+    return -1;
+  e = &r->sq[r->sqtail % NRING];
+  e->op = op;
+  e->fd = fd;
+  e->addr = (uint)addr;
+  e->n = n;
+  e->data = data;
+  __sync_synchronize();
+  r->sqtail++;
+  return 0;
+}
+
+// Have the kernel carry out the queued operations, and wait
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+  __sync_synchronize();
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+    return ring_enter(min);
+  return r->cqtail - r->cqhead;
+}
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+  if(r->cqhead == r->cqtail)
+    return -1;
+  __sync_synchronize();
+  *c = r->cq[r->cqhead % NRING];
+  r->cqhead++;
+  return 0;
+}
@@ -1,4 +1,18 @@
 struct stat;
+struct kmstat;
+struct lockstat;
+struct sysstat;
+struct ring;
+struct cqe;
+
+// Sleeping locks built on futexes; see ulib.c.
+struct mutex {
+  volatile uint state;  // 0 free, 1 held, 2 held with waiters
+};
+
+struct cond {
+  volatile uint seq;    // bumped by every signal
+};
 
 // system calls
 int fork(void);
@@ -22,6 +36,16 @@ int getpid(void);
 char* sbrk(int);
 int sleep(int);
 int uptime(void);
+int kmstat(struct kmstat*, int);
+int setpriority(int, int);
+int clone(void(*)(void*), void*, void*);
+int join(void**);
+int futex_wait(uint*, uint);
+int futex_wake(uint*, int);
+int lockstat(struct lockstat*, int, int);
+int sysstat(struct sysstat*, int, int);
+int ring_setup(struct ring*, int);
+int ring_enter(int);
 
 // ulib.c
 int stat(char*, struct stat*);
@@ -36,3 +60,18 @@ void* memset(void*, int, uint);
 void* malloc(uint);
 void free(void*);
 int atoi(const char*);
+void mutex_init(struct mutex*);
+void mutex_lock(struct mutex*);
+void mutex_unlock(struct mutex*);
+void cond_init(struct cond*);
+void cond_wait(struct cond*, struct mutex*);
+void cond_signal(struct cond*);
+void cond_broadcast(struct cond*);
+uint vuptime(void);
+int vgetpid(void);
+uint64 vclock(void);
+int ring_queue(struct ring*, int, int, void*, int, uint);
+int ring_submit(struct ring*, int);
+int ring_reap(struct ring*, struct cqe*);
+int thread_create(void(*)(void*), void*);
+int thread_join(void);
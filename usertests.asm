@@ -0,0 +1,9655 @@
+
+_usertests:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <opentest>:
+
+// simple file system tests
+
+void
+opentest(void)
+{
+       0:	55                   	push   %ebp
+       1:	89 e5                	mov    %esp,%ebp
+       3:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(stdout, "open test\n");
+       6:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+       b:	83 ec 08             	sub    $0x8,%esp
+       e:	68 62 57 00 00       	push   $0x5762
+      13:	50                   	push   %eax
+      14:	e8 f3 52 00 00       	call   530c <printf>
+      19:	83 c4 10             	add    $0x10,%esp
+  fd = open("echo", 0);
+      1c:	83 ec 08             	sub    $0x8,%esp
+      1f:	6a 00                	push   $0x0
+      21:	68 4c 57 00 00       	push   $0x574c
+      26:	e8 43 51 00 00       	call   516e <open>
+      2b:	83 c4 10             	add    $0x10,%esp
+      2e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+      31:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      35:	79 1b                	jns    52 <opentest+0x52>
+    printf(stdout, "open echo failed!\n");
+      37:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+      3c:	83 ec 08             	sub    $0x8,%esp
+      3f:	68 6d 57 00 00       	push   $0x576d
+      44:	50                   	push   %eax
+      45:	e8 c2 52 00 00       	call   530c <printf>
+      4a:	83 c4 10             	add    $0x10,%esp
+    exit();
+      4d:	e8 e4 50 00 00       	call   5136 <exit>
+  }
+  close(fd);
+      52:	83 ec 0c             	sub    $0xc,%esp
+      55:	ff 75 f4             	push   -0xc(%ebp)
+      58:	e8 fc 50 00 00       	call   5159 <close>
+      5d:	83 c4 10             	add    $0x10,%esp
+  fd = open("doesnotexist", 0);
+      60:	83 ec 08             	sub    $0x8,%esp
+      63:	6a 00                	push   $0x0
+      65:	68 80 57 00 00       	push   $0x5780
+      6a:	e8 ff 50 00 00       	call   516e <open>
+      6f:	83 c4 10             	add    $0x10,%esp
+      72:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+      75:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+      79:	78 1b                	js     96 <opentest+0x96>
+    printf(stdout, "open doesnotexist succeeded!\n");
+      7b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+      80:	83 ec 08             	sub    $0x8,%esp
+      83:	68 8d 57 00 00       	push   $0x578d
+      88:	50                   	push   %eax
+      89:	e8 7e 52 00 00       	call   530c <printf>
+      8e:	83 c4 10             	add    $0x10,%esp
+    exit();
+      91:	e8 a0 50 00 00       	call   5136 <exit>
+  }
+  printf(stdout, "open test ok\n");
+      96:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+      9b:	83 ec 08             	sub    $0x8,%esp
+      9e:	68 ab 57 00 00       	push   $0x57ab
+      a3:	50                   	push   %eax
+      a4:	e8 63 52 00 00       	call   530c <printf>
+      a9:	83 c4 10             	add    $0x10,%esp
+}
+      ac:	90                   	nop
+      ad:	c9                   	leave
+      ae:	c3                   	ret
+
+000000af <writetest>:
+
+void
+writetest(void)
+{
+      af:	55                   	push   %ebp
+      b0:	89 e5                	mov    %esp,%ebp
+      b2:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+  int i;
+
+  printf(stdout, "small file test\n");
+      b5:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+      ba:	83 ec 08             	sub    $0x8,%esp
+      bd:	68 b9 57 00 00       	push   $0x57b9
+      c2:	50                   	push   %eax
+      c3:	e8 44 52 00 00       	call   530c <printf>
+      c8:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_CREATE|O_RDWR);
+      cb:	83 ec 08             	sub    $0x8,%esp
+      ce:	68 02 02 00 00       	push   $0x202
+      d3:	68 ca 57 00 00       	push   $0x57ca
+      d8:	e8 91 50 00 00       	call   516e <open>
+      dd:	83 c4 10             	add    $0x10,%esp
+      e0:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+      e3:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+      e7:	78 22                	js     10b <writetest+0x5c>
+    printf(stdout, "creat small succeeded; ok\n");
+      e9:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+      ee:	83 ec 08             	sub    $0x8,%esp
+      f1:	68 d0 57 00 00       	push   $0x57d0
+      f6:	50                   	push   %eax
+      f7:	e8 10 52 00 00       	call   530c <printf>
+      fc:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: creat small failed!\n");
+    exit();
+  }
+  for(i = 0; i < 100; i++){
+      ff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     106:	e9 8f 00 00 00       	jmp    19a <writetest+0xeb>
+    printf(stdout, "error: creat small failed!\n");
+     10b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     110:	83 ec 08             	sub    $0x8,%esp
+     113:	68 eb 57 00 00       	push   $0x57eb
+     118:	50                   	push   %eax
+     119:	e8 ee 51 00 00       	call   530c <printf>
+     11e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     121:	e8 10 50 00 00       	call   5136 <exit>
+    if(write(fd, "aaaaaaaaaa", 10) != 10){
+     126:	83 ec 04             	sub    $0x4,%esp
+     129:	6a 0a                	push   $0xa
+     12b:	68 07 58 00 00       	push   $0x5807
+     130:	ff 75 f0             	push   -0x10(%ebp)
+     133:	e8 1a 50 00 00       	call   5152 <write>
+     138:	83 c4 10             	add    $0x10,%esp
+     13b:	83 f8 0a             	cmp    $0xa,%eax
+     13e:	74 1e                	je     15e <writetest+0xaf>
+      printf(stdout, "error: write aa %d new file failed\n", i);
+     140:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     145:	83 ec 04             	sub    $0x4,%esp
+     148:	ff 75 f4             	push   -0xc(%ebp)
+     14b:	68 14 58 00 00       	push   $0x5814
+     150:	50                   	push   %eax
+     151:	e8 b6 51 00 00       	call   530c <printf>
+     156:	83 c4 10             	add    $0x10,%esp
+      exit();
+     159:	e8 d8 4f 00 00       	call   5136 <exit>
+    }
+    if(write(fd, "bbbbbbbbbb", 10) != 10){
+     15e:	83 ec 04             	sub    $0x4,%esp
+     161:	6a 0a                	push   $0xa
+     163:	68 38 58 00 00       	push   $0x5838
+     168:	ff 75 f0             	push   -0x10(%ebp)
+     16b:	e8 e2 4f 00 00       	call   5152 <write>
+     170:	83 c4 10             	add    $0x10,%esp
+     173:	83 f8 0a             	cmp    $0xa,%eax
+     176:	74 1e                	je     196 <writetest+0xe7>
+      printf(stdout, "error: write bb %d new file failed\n", i);
+     178:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     17d:	83 ec 04             	sub    $0x4,%esp
+     180:	ff 75 f4             	push   -0xc(%ebp)
+     183:	68 44 58 00 00       	push   $0x5844
+     188:	50                   	push   %eax
+     189:	e8 7e 51 00 00       	call   530c <printf>
+     18e:	83 c4 10             	add    $0x10,%esp
+      exit();
+     191:	e8 a0 4f 00 00       	call   5136 <exit>
+  for(i = 0; i < 100; i++){
+     196:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     19a:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+     19e:	7e 86                	jle    126 <writetest+0x77>
+    }
+  }
+  printf(stdout, "writes ok\n");
+     1a0:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     1a5:	83 ec 08             	sub    $0x8,%esp
+     1a8:	68 68 58 00 00       	push   $0x5868
+     1ad:	50                   	push   %eax
+     1ae:	e8 59 51 00 00       	call   530c <printf>
+     1b3:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+     1b6:	83 ec 0c             	sub    $0xc,%esp
+     1b9:	ff 75 f0             	push   -0x10(%ebp)
+     1bc:	e8 98 4f 00 00       	call   5159 <close>
+     1c1:	83 c4 10             	add    $0x10,%esp
+  fd = open("small", O_RDONLY);
+     1c4:	83 ec 08             	sub    $0x8,%esp
+     1c7:	6a 00                	push   $0x0
+     1c9:	68 ca 57 00 00       	push   $0x57ca
+     1ce:	e8 9b 4f 00 00       	call   516e <open>
+     1d3:	83 c4 10             	add    $0x10,%esp
+     1d6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd >= 0){
+     1d9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     1dd:	78 3c                	js     21b <writetest+0x16c>
+    printf(stdout, "open small succeeded ok\n");
+     1df:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     1e4:	83 ec 08             	sub    $0x8,%esp
+     1e7:	68 73 58 00 00       	push   $0x5873
+     1ec:	50                   	push   %eax
+     1ed:	e8 1a 51 00 00       	call   530c <printf>
+     1f2:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "error: open small failed!\n");
+    exit();
+  }
+  i = read(fd, buf, 2000);
+     1f5:	83 ec 04             	sub    $0x4,%esp
+     1f8:	68 d0 07 00 00       	push   $0x7d0
+     1fd:	68 20 7e 00 00       	push   $0x7e20
+     202:	ff 75 f0             	push   -0x10(%ebp)
+     205:	e8 41 4f 00 00       	call   514b <read>
+     20a:	83 c4 10             	add    $0x10,%esp
+     20d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(i == 2000){
+     210:	81 7d f4 d0 07 00 00 	cmpl   $0x7d0,-0xc(%ebp)
+     217:	75 57                	jne    270 <writetest+0x1c1>
+     219:	eb 1b                	jmp    236 <writetest+0x187>
+    printf(stdout, "error: open small failed!\n");
+     21b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     220:	83 ec 08             	sub    $0x8,%esp
+     223:	68 8c 58 00 00       	push   $0x588c
+     228:	50                   	push   %eax
+     229:	e8 de 50 00 00       	call   530c <printf>
+     22e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     231:	e8 00 4f 00 00       	call   5136 <exit>
+    printf(stdout, "read succeeded ok\n");
+     236:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     23b:	83 ec 08             	sub    $0x8,%esp
+     23e:	68 a7 58 00 00       	push   $0x58a7
+     243:	50                   	push   %eax
+     244:	e8 c3 50 00 00       	call   530c <printf>
+     249:	83 c4 10             	add    $0x10,%esp
+  } else {
+    printf(stdout, "read failed\n");
+    exit();
+  }
+  close(fd);
+     24c:	83 ec 0c             	sub    $0xc,%esp
+     24f:	ff 75 f0             	push   -0x10(%ebp)
+     252:	e8 02 4f 00 00       	call   5159 <close>
+     257:	83 c4 10             	add    $0x10,%esp
+
+  if(unlink("small") < 0){
+     25a:	83 ec 0c             	sub    $0xc,%esp
+     25d:	68 ca 57 00 00       	push   $0x57ca
+     262:	e8 15 4f 00 00       	call   517c <unlink>
+     267:	83 c4 10             	add    $0x10,%esp
+     26a:	85 c0                	test   %eax,%eax
+     26c:	79 38                	jns    2a6 <writetest+0x1f7>
+     26e:	eb 1b                	jmp    28b <writetest+0x1dc>
+    printf(stdout, "read failed\n");
+     270:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     275:	83 ec 08             	sub    $0x8,%esp
+     278:	68 ba 58 00 00       	push   $0x58ba
+     27d:	50                   	push   %eax
+     27e:	e8 89 50 00 00       	call   530c <printf>
+     283:	83 c4 10             	add    $0x10,%esp
+    exit();
+     286:	e8 ab 4e 00 00       	call   5136 <exit>
+    printf(stdout, "unlink small failed\n");
+     28b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     290:	83 ec 08             	sub    $0x8,%esp
+     293:	68 c7 58 00 00       	push   $0x58c7
+     298:	50                   	push   %eax
+     299:	e8 6e 50 00 00       	call   530c <printf>
+     29e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     2a1:	e8 90 4e 00 00       	call   5136 <exit>
+  }
+  printf(stdout, "small file test ok\n");
+     2a6:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     2ab:	83 ec 08             	sub    $0x8,%esp
+     2ae:	68 dc 58 00 00       	push   $0x58dc
+     2b3:	50                   	push   %eax
+     2b4:	e8 53 50 00 00       	call   530c <printf>
+     2b9:	83 c4 10             	add    $0x10,%esp
+}
+     2bc:	90                   	nop
+     2bd:	c9                   	leave
+     2be:	c3                   	ret
+
+000002bf <writetest1>:
+
+void
+writetest1(void)
+{
+     2bf:	55                   	push   %ebp
+     2c0:	89 e5                	mov    %esp,%ebp
+     2c2:	83 ec 18             	sub    $0x18,%esp
+  int i, fd, n;
+
+  printf(stdout, "big files test\n");
+     2c5:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     2ca:	83 ec 08             	sub    $0x8,%esp
+     2cd:	68 f0 58 00 00       	push   $0x58f0
+     2d2:	50                   	push   %eax
+     2d3:	e8 34 50 00 00       	call   530c <printf>
+     2d8:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_CREATE|O_RDWR);
+     2db:	83 ec 08             	sub    $0x8,%esp
+     2de:	68 02 02 00 00       	push   $0x202
+     2e3:	68 00 59 00 00       	push   $0x5900
+     2e8:	e8 81 4e 00 00       	call   516e <open>
+     2ed:	83 c4 10             	add    $0x10,%esp
+     2f0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     2f3:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     2f7:	79 1b                	jns    314 <writetest1+0x55>
+    printf(stdout, "error: creat big failed!\n");
+     2f9:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     2fe:	83 ec 08             	sub    $0x8,%esp
+     301:	68 04 59 00 00       	push   $0x5904
+     306:	50                   	push   %eax
+     307:	e8 00 50 00 00       	call   530c <printf>
+     30c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     30f:	e8 22 4e 00 00       	call   5136 <exit>
+  }
+
+  for(i = 0; i < MAXFILE; i++){
+     314:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     31b:	eb 4b                	jmp    368 <writetest1+0xa9>
+    ((int*)buf)[0] = i;
+     31d:	ba 20 7e 00 00       	mov    $0x7e20,%edx
+     322:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     325:	89 02                	mov    %eax,(%edx)
+    if(write(fd, buf, 512) != 512){
+     327:	83 ec 04             	sub    $0x4,%esp
+     32a:	68 00 02 00 00       	push   $0x200
+     32f:	68 20 7e 00 00       	push   $0x7e20
+     334:	ff 75 ec             	push   -0x14(%ebp)
+     337:	e8 16 4e 00 00       	call   5152 <write>
+     33c:	83 c4 10             	add    $0x10,%esp
+     33f:	3d 00 02 00 00       	cmp    $0x200,%eax
+     344:	74 1e                	je     364 <writetest1+0xa5>
+      printf(stdout, "error: write big file failed\n", i);
+     346:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     34b:	83 ec 04             	sub    $0x4,%esp
+     34e:	ff 75 f4             	push   -0xc(%ebp)
+     351:	68 1e 59 00 00       	push   $0x591e
+     356:	50                   	push   %eax
+     357:	e8 b0 4f 00 00       	call   530c <printf>
+     35c:	83 c4 10             	add    $0x10,%esp
+      exit();
+     35f:	e8 d2 4d 00 00       	call   5136 <exit>
+  for(i = 0; i < MAXFILE; i++){
+     364:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     368:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     36b:	3d 8b 00 00 00       	cmp    $0x8b,%eax
+     370:	76 ab                	jbe    31d <writetest1+0x5e>
+    }
+  }
+
+  close(fd);
+     372:	83 ec 0c             	sub    $0xc,%esp
+     375:	ff 75 ec             	push   -0x14(%ebp)
+     378:	e8 dc 4d 00 00       	call   5159 <close>
+     37d:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("big", O_RDONLY);
+     380:	83 ec 08             	sub    $0x8,%esp
+     383:	6a 00                	push   $0x0
+     385:	68 00 59 00 00       	push   $0x5900
+     38a:	e8 df 4d 00 00       	call   516e <open>
+     38f:	83 c4 10             	add    $0x10,%esp
+     392:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+     395:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     399:	79 1b                	jns    3b6 <writetest1+0xf7>
+    printf(stdout, "error: open big failed!\n");
+     39b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     3a0:	83 ec 08             	sub    $0x8,%esp
+     3a3:	68 3c 59 00 00       	push   $0x593c
+     3a8:	50                   	push   %eax
+     3a9:	e8 5e 4f 00 00       	call   530c <printf>
+     3ae:	83 c4 10             	add    $0x10,%esp
+    exit();
+     3b1:	e8 80 4d 00 00       	call   5136 <exit>
+  }
+
+  n = 0;
+     3b6:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(;;){
+    i = read(fd, buf, 512);
+     3bd:	83 ec 04             	sub    $0x4,%esp
+     3c0:	68 00 02 00 00       	push   $0x200
+     3c5:	68 20 7e 00 00       	push   $0x7e20
+     3ca:	ff 75 ec             	push   -0x14(%ebp)
+     3cd:	e8 79 4d 00 00       	call   514b <read>
+     3d2:	83 c4 10             	add    $0x10,%esp
+     3d5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(i == 0){
+     3d8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     3dc:	75 27                	jne    405 <writetest1+0x146>
+      if(n == MAXFILE - 1){
+     3de:	81 7d f0 8b 00 00 00 	cmpl   $0x8b,-0x10(%ebp)
+     3e5:	75 7d                	jne    464 <writetest1+0x1a5>
+        printf(stdout, "read only %d blocks from big", n);
+     3e7:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     3ec:	83 ec 04             	sub    $0x4,%esp
+     3ef:	ff 75 f0             	push   -0x10(%ebp)
+     3f2:	68 55 59 00 00       	push   $0x5955
+     3f7:	50                   	push   %eax
+     3f8:	e8 0f 4f 00 00       	call   530c <printf>
+     3fd:	83 c4 10             	add    $0x10,%esp
+        exit();
+     400:	e8 31 4d 00 00       	call   5136 <exit>
+      }
+      break;
+    } else if(i != 512){
+     405:	81 7d f4 00 02 00 00 	cmpl   $0x200,-0xc(%ebp)
+     40c:	74 1e                	je     42c <writetest1+0x16d>
+      printf(stdout, "read failed %d\n", i);
+     40e:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     413:	83 ec 04             	sub    $0x4,%esp
+     416:	ff 75 f4             	push   -0xc(%ebp)
+     419:	68 72 59 00 00       	push   $0x5972
+     41e:	50                   	push   %eax
+     41f:	e8 e8 4e 00 00       	call   530c <printf>
+     424:	83 c4 10             	add    $0x10,%esp
+      exit();
+     427:	e8 0a 4d 00 00       	call   5136 <exit>
+    }
+    if(((int*)buf)[0] != n){
+     42c:	b8 20 7e 00 00       	mov    $0x7e20,%eax
+     431:	8b 00                	mov    (%eax),%eax
+     433:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     436:	74 23                	je     45b <writetest1+0x19c>
+      printf(stdout, "read content of block %d is %d\n",
+             n, ((int*)buf)[0]);
+     438:	b8 20 7e 00 00       	mov    $0x7e20,%eax
+      printf(stdout, "read content of block %d is %d\n",
+     43d:	8b 10                	mov    (%eax),%edx
+     43f:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     444:	52                   	push   %edx
+     445:	ff 75 f0             	push   -0x10(%ebp)
+     448:	68 84 59 00 00       	push   $0x5984
+     44d:	50                   	push   %eax
+     44e:	e8 b9 4e 00 00       	call   530c <printf>
+     453:	83 c4 10             	add    $0x10,%esp
+      exit();
+     456:	e8 db 4c 00 00       	call   5136 <exit>
+    }
+    n++;
+     45b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    i = read(fd, buf, 512);
+     45f:	e9 59 ff ff ff       	jmp    3bd <writetest1+0xfe>
+      break;
+     464:	90                   	nop
+  }
+  close(fd);
+     465:	83 ec 0c             	sub    $0xc,%esp
+     468:	ff 75 ec             	push   -0x14(%ebp)
+     46b:	e8 e9 4c 00 00       	call   5159 <close>
+     470:	83 c4 10             	add    $0x10,%esp
+  if(unlink("big") < 0){
+     473:	83 ec 0c             	sub    $0xc,%esp
+     476:	68 00 59 00 00       	push   $0x5900
+     47b:	e8 fc 4c 00 00       	call   517c <unlink>
+     480:	83 c4 10             	add    $0x10,%esp
+     483:	85 c0                	test   %eax,%eax
+     485:	79 1b                	jns    4a2 <writetest1+0x1e3>
+    printf(stdout, "unlink big failed\n");
+     487:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     48c:	83 ec 08             	sub    $0x8,%esp
+     48f:	68 a4 59 00 00       	push   $0x59a4
+     494:	50                   	push   %eax
+     495:	e8 72 4e 00 00       	call   530c <printf>
+     49a:	83 c4 10             	add    $0x10,%esp
+    exit();
+     49d:	e8 94 4c 00 00       	call   5136 <exit>
+  }
+  printf(stdout, "big files ok\n");
+     4a2:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     4a7:	83 ec 08             	sub    $0x8,%esp
+     4aa:	68 b7 59 00 00       	push   $0x59b7
+     4af:	50                   	push   %eax
+     4b0:	e8 57 4e 00 00       	call   530c <printf>
+     4b5:	83 c4 10             	add    $0x10,%esp
+}
+     4b8:	90                   	nop
+     4b9:	c9                   	leave
+     4ba:	c3                   	ret
+
+000004bb <createtest>:
+
+void
+createtest(void)
+{
+     4bb:	55                   	push   %ebp
+     4bc:	89 e5                	mov    %esp,%ebp
+     4be:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(stdout, "many creates, followed by unlink test\n");
+     4c1:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     4c6:	83 ec 08             	sub    $0x8,%esp
+     4c9:	68 c8 59 00 00       	push   $0x59c8
+     4ce:	50                   	push   %eax
+     4cf:	e8 38 4e 00 00       	call   530c <printf>
+     4d4:	83 c4 10             	add    $0x10,%esp
+
+  name[0] = 'a';
+     4d7:	c6 05 20 9e 00 00 61 	movb   $0x61,0x9e20
+  name[2] = '\0';
+     4de:	c6 05 22 9e 00 00 00 	movb   $0x0,0x9e22
+  for(i = 0; i < 52; i++){
+     4e5:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     4ec:	eb 35                	jmp    523 <createtest+0x68>
+    name[1] = '0' + i;
+     4ee:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     4f1:	83 c0 30             	add    $0x30,%eax
+     4f4:	a2 21 9e 00 00       	mov    %al,0x9e21
+    fd = open(name, O_CREATE|O_RDWR);
+     4f9:	83 ec 08             	sub    $0x8,%esp
+     4fc:	68 02 02 00 00       	push   $0x202
+     501:	68 20 9e 00 00       	push   $0x9e20
+     506:	e8 63 4c 00 00       	call   516e <open>
+     50b:	83 c4 10             	add    $0x10,%esp
+     50e:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    close(fd);
+     511:	83 ec 0c             	sub    $0xc,%esp
+     514:	ff 75 f0             	push   -0x10(%ebp)
+     517:	e8 3d 4c 00 00       	call   5159 <close>
+     51c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     51f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     523:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     527:	7e c5                	jle    4ee <createtest+0x33>
+  }
+  name[0] = 'a';
+     529:	c6 05 20 9e 00 00 61 	movb   $0x61,0x9e20
+  name[2] = '\0';
+     530:	c6 05 22 9e 00 00 00 	movb   $0x0,0x9e22
+  for(i = 0; i < 52; i++){
+     537:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     53e:	eb 1f                	jmp    55f <createtest+0xa4>
+    name[1] = '0' + i;
+     540:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     543:	83 c0 30             	add    $0x30,%eax
+     546:	a2 21 9e 00 00       	mov    %al,0x9e21
+    unlink(name);
+     54b:	83 ec 0c             	sub    $0xc,%esp
+     54e:	68 20 9e 00 00       	push   $0x9e20
+     553:	e8 24 4c 00 00       	call   517c <unlink>
+     558:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 52; i++){
+     55b:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     55f:	83 7d f4 33          	cmpl   $0x33,-0xc(%ebp)
+     563:	7e db                	jle    540 <createtest+0x85>
+  }
+  printf(stdout, "many creates, followed by unlink; ok\n");
+     565:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     56a:	83 ec 08             	sub    $0x8,%esp
+     56d:	68 f0 59 00 00       	push   $0x59f0
+     572:	50                   	push   %eax
+     573:	e8 94 4d 00 00       	call   530c <printf>
+     578:	83 c4 10             	add    $0x10,%esp
+}
+     57b:	90                   	nop
+     57c:	c9                   	leave
+     57d:	c3                   	ret
+
+0000057e <dirtest>:
+
+void dirtest(void)
+{
+     57e:	55                   	push   %ebp
+     57f:	89 e5                	mov    %esp,%ebp
+     581:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "mkdir test\n");
+     584:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     589:	83 ec 08             	sub    $0x8,%esp
+     58c:	68 16 5a 00 00       	push   $0x5a16
+     591:	50                   	push   %eax
+     592:	e8 75 4d 00 00       	call   530c <printf>
+     597:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("dir0") < 0){
+     59a:	83 ec 0c             	sub    $0xc,%esp
+     59d:	68 22 5a 00 00       	push   $0x5a22
+     5a2:	e8 ea 4b 00 00       	call   5191 <mkdir>
+     5a7:	83 c4 10             	add    $0x10,%esp
+     5aa:	85 c0                	test   %eax,%eax
+     5ac:	79 1b                	jns    5c9 <dirtest+0x4b>
+    printf(stdout, "mkdir failed\n");
+     5ae:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     5b3:	83 ec 08             	sub    $0x8,%esp
+     5b6:	68 27 5a 00 00       	push   $0x5a27
+     5bb:	50                   	push   %eax
+     5bc:	e8 4b 4d 00 00       	call   530c <printf>
+     5c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5c4:	e8 6d 4b 00 00       	call   5136 <exit>
+  }
+
+  if(chdir("dir0") < 0){
+     5c9:	83 ec 0c             	sub    $0xc,%esp
+     5cc:	68 22 5a 00 00       	push   $0x5a22
+     5d1:	e8 c2 4b 00 00       	call   5198 <chdir>
+     5d6:	83 c4 10             	add    $0x10,%esp
+     5d9:	85 c0                	test   %eax,%eax
+     5db:	79 1b                	jns    5f8 <dirtest+0x7a>
+    printf(stdout, "chdir dir0 failed\n");
+     5dd:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     5e2:	83 ec 08             	sub    $0x8,%esp
+     5e5:	68 35 5a 00 00       	push   $0x5a35
+     5ea:	50                   	push   %eax
+     5eb:	e8 1c 4d 00 00       	call   530c <printf>
+     5f0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     5f3:	e8 3e 4b 00 00       	call   5136 <exit>
+  }
+
+  if(chdir("..") < 0){
+     5f8:	83 ec 0c             	sub    $0xc,%esp
+     5fb:	68 48 5a 00 00       	push   $0x5a48
+     600:	e8 93 4b 00 00       	call   5198 <chdir>
+     605:	83 c4 10             	add    $0x10,%esp
+     608:	85 c0                	test   %eax,%eax
+     60a:	79 1b                	jns    627 <dirtest+0xa9>
+    printf(stdout, "chdir .. failed\n");
+     60c:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     611:	83 ec 08             	sub    $0x8,%esp
+     614:	68 4b 5a 00 00       	push   $0x5a4b
+     619:	50                   	push   %eax
+     61a:	e8 ed 4c 00 00       	call   530c <printf>
+     61f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     622:	e8 0f 4b 00 00       	call   5136 <exit>
+  }
+
+  if(unlink("dir0") < 0){
+     627:	83 ec 0c             	sub    $0xc,%esp
+     62a:	68 22 5a 00 00       	push   $0x5a22
+     62f:	e8 48 4b 00 00       	call   517c <unlink>
+     634:	83 c4 10             	add    $0x10,%esp
+     637:	85 c0                	test   %eax,%eax
+     639:	79 1b                	jns    656 <dirtest+0xd8>
+    printf(stdout, "unlink dir0 failed\n");
+     63b:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     640:	83 ec 08             	sub    $0x8,%esp
+     643:	68 5c 5a 00 00       	push   $0x5a5c
+     648:	50                   	push   %eax
+     649:	e8 be 4c 00 00       	call   530c <printf>
+     64e:	83 c4 10             	add    $0x10,%esp
+    exit();
+     651:	e8 e0 4a 00 00       	call   5136 <exit>
+  }
+  printf(stdout, "mkdir test\n");
+     656:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     65b:	83 ec 08             	sub    $0x8,%esp
+     65e:	68 16 5a 00 00       	push   $0x5a16
+     663:	50                   	push   %eax
+     664:	e8 a3 4c 00 00       	call   530c <printf>
+     669:	83 c4 10             	add    $0x10,%esp
+}
+     66c:	90                   	nop
+     66d:	c9                   	leave
+     66e:	c3                   	ret
+
+0000066f <exectest>:
+
+void
+exectest(void)
+{
+     66f:	55                   	push   %ebp
+     670:	89 e5                	mov    %esp,%ebp
+     672:	83 ec 08             	sub    $0x8,%esp
+  printf(stdout, "exec test\n");
+     675:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     67a:	83 ec 08             	sub    $0x8,%esp
+     67d:	68 70 5a 00 00       	push   $0x5a70
+     682:	50                   	push   %eax
+     683:	e8 84 4c 00 00       	call   530c <printf>
+     688:	83 c4 10             	add    $0x10,%esp
+  if(exec("echo", echoargv) < 0){
+     68b:	83 ec 08             	sub    $0x8,%esp
+     68e:	68 d8 7d 00 00       	push   $0x7dd8
+     693:	68 4c 57 00 00       	push   $0x574c
+     698:	e8 ca 4a 00 00       	call   5167 <exec>
+     69d:	83 c4 10             	add    $0x10,%esp
+     6a0:	85 c0                	test   %eax,%eax
+     6a2:	79 1b                	jns    6bf <exectest+0x50>
+    printf(stdout, "exec echo failed\n");
+     6a4:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+     6a9:	83 ec 08             	sub    $0x8,%esp
+     6ac:	68 7b 5a 00 00       	push   $0x5a7b
+     6b1:	50                   	push   %eax
+     6b2:	e8 55 4c 00 00       	call   530c <printf>
+     6b7:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6ba:	e8 77 4a 00 00       	call   5136 <exit>
+  }
+}
+     6bf:	90                   	nop
+     6c0:	c9                   	leave
+     6c1:	c3                   	ret
+
+000006c2 <pipe1>:
+
+// simple fork and pipe read/write
+
+void
+pipe1(void)
+{
+     6c2:	55                   	push   %ebp
+     6c3:	89 e5                	mov    %esp,%ebp
+     6c5:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], pid;
+  int seq, i, n, cc, total;
+
+  if(pipe(fds) != 0){
+     6c8:	83 ec 0c             	sub    $0xc,%esp
+     6cb:	8d 45 d8             	lea    -0x28(%ebp),%eax
+     6ce:	50                   	push   %eax
+     6cf:	e8 70 4a 00 00       	call   5144 <pipe>
+     6d4:	83 c4 10             	add    $0x10,%esp
+     6d7:	85 c0                	test   %eax,%eax
+     6d9:	74 17                	je     6f2 <pipe1+0x30>
+    printf(1, "pipe() failed\n");
+     6db:	83 ec 08             	sub    $0x8,%esp
+     6de:	68 8d 5a 00 00       	push   $0x5a8d
+     6e3:	6a 01                	push   $0x1
+     6e5:	e8 22 4c 00 00       	call   530c <printf>
+     6ea:	83 c4 10             	add    $0x10,%esp
+    exit();
+     6ed:	e8 44 4a 00 00       	call   5136 <exit>
+  }
+  pid = fork();
+     6f2:	e8 38 4a 00 00       	call   512f <fork>
+     6f7:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  seq = 0;
+     6fa:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  if(pid == 0){
+     701:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     705:	0f 85 89 00 00 00    	jne    794 <pipe1+0xd2>
+    close(fds[0]);
+     70b:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     70e:	83 ec 0c             	sub    $0xc,%esp
+     711:	50                   	push   %eax
+     712:	e8 42 4a 00 00       	call   5159 <close>
+     717:	83 c4 10             	add    $0x10,%esp
+    for(n = 0; n < 5; n++){
+     71a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+     721:	eb 66                	jmp    789 <pipe1+0xc7>
+      for(i = 0; i < 1033; i++)
+     723:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     72a:	eb 19                	jmp    745 <pipe1+0x83>
+        buf[i] = seq++;
+     72c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     72f:	8d 50 01             	lea    0x1(%eax),%edx
+     732:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     735:	89 c2                	mov    %eax,%edx
+     737:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     73a:	05 20 7e 00 00       	add    $0x7e20,%eax
+     73f:	88 10                	mov    %dl,(%eax)
+      for(i = 0; i < 1033; i++)
+     741:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     745:	81 7d f0 08 04 00 00 	cmpl   $0x408,-0x10(%ebp)
+     74c:	7e de                	jle    72c <pipe1+0x6a>
+      if(write(fds[1], buf, 1033) != 1033){
+     74e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     751:	83 ec 04             	sub    $0x4,%esp
+     754:	68 09 04 00 00       	push   $0x409
+     759:	68 20 7e 00 00       	push   $0x7e20
+     75e:	50                   	push   %eax
+     75f:	e8 ee 49 00 00       	call   5152 <write>
+     764:	83 c4 10             	add    $0x10,%esp
+     767:	3d 09 04 00 00       	cmp    $0x409,%eax
+     76c:	74 17                	je     785 <pipe1+0xc3>
+        printf(1, "pipe1 oops 1\n");
+     76e:	83 ec 08             	sub    $0x8,%esp
+     771:	68 9c 5a 00 00       	push   $0x5a9c
+     776:	6a 01                	push   $0x1
+     778:	e8 8f 4b 00 00       	call   530c <printf>
+     77d:	83 c4 10             	add    $0x10,%esp
+        exit();
+     780:	e8 b1 49 00 00       	call   5136 <exit>
+    for(n = 0; n < 5; n++){
+     785:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+     789:	83 7d ec 04          	cmpl   $0x4,-0x14(%ebp)
+     78d:	7e 94                	jle    723 <pipe1+0x61>
+      }
+    }
+    exit();
+     78f:	e8 a2 49 00 00       	call   5136 <exit>
+  } else if(pid > 0){
+     794:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+     798:	0f 8e f4 00 00 00    	jle    892 <pipe1+0x1d0>
+    close(fds[1]);
+     79e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     7a1:	83 ec 0c             	sub    $0xc,%esp
+     7a4:	50                   	push   %eax
+     7a5:	e8 af 49 00 00       	call   5159 <close>
+     7aa:	83 c4 10             	add    $0x10,%esp
+    total = 0;
+     7ad:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+    cc = 1;
+     7b4:	c7 45 e8 01 00 00 00 	movl   $0x1,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     7bb:	eb 66                	jmp    823 <pipe1+0x161>
+      for(i = 0; i < n; i++){
+     7bd:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     7c4:	eb 3b                	jmp    801 <pipe1+0x13f>
+        if((buf[i] & 0xff) != (seq++ & 0xff)){
+     7c6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     7c9:	05 20 7e 00 00       	add    $0x7e20,%eax
+     7ce:	0f b6 00             	movzbl (%eax),%eax
+     7d1:	0f be c8             	movsbl %al,%ecx
+     7d4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     7d7:	8d 50 01             	lea    0x1(%eax),%edx
+     7da:	89 55 f4             	mov    %edx,-0xc(%ebp)
+     7dd:	31 c8                	xor    %ecx,%eax
+     7df:	0f b6 c0             	movzbl %al,%eax
+     7e2:	85 c0                	test   %eax,%eax
+     7e4:	74 17                	je     7fd <pipe1+0x13b>
+          printf(1, "pipe1 oops 2\n");
+     7e6:	83 ec 08             	sub    $0x8,%esp
+     7e9:	68 aa 5a 00 00       	push   $0x5aaa
+     7ee:	6a 01                	push   $0x1
+     7f0:	e8 17 4b 00 00       	call   530c <printf>
+     7f5:	83 c4 10             	add    $0x10,%esp
+     7f8:	e9 ac 00 00 00       	jmp    8a9 <pipe1+0x1e7>
+      for(i = 0; i < n; i++){
+     7fd:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     801:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     804:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+     807:	7c bd                	jl     7c6 <pipe1+0x104>
+          return;
+        }
+      }
+      total += n;
+     809:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     80c:	01 45 e4             	add    %eax,-0x1c(%ebp)
+      cc = cc * 2;
+     80f:	d1 65 e8             	shll   -0x18(%ebp)
+      if(cc > sizeof(buf))
+     812:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     815:	3d 00 20 00 00       	cmp    $0x2000,%eax
+     81a:	76 07                	jbe    823 <pipe1+0x161>
+        cc = sizeof(buf);
+     81c:	c7 45 e8 00 20 00 00 	movl   $0x2000,-0x18(%ebp)
+    while((n = read(fds[0], buf, cc)) > 0){
+     823:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     826:	83 ec 04             	sub    $0x4,%esp
+     829:	ff 75 e8             	push   -0x18(%ebp)
+     82c:	68 20 7e 00 00       	push   $0x7e20
+     831:	50                   	push   %eax
+     832:	e8 14 49 00 00       	call   514b <read>
+     837:	83 c4 10             	add    $0x10,%esp
+     83a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+     83d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+     841:	0f 8f 76 ff ff ff    	jg     7bd <pipe1+0xfb>
+    }
+    if(total != 5 * 1033){
+     847:	81 7d e4 2d 14 00 00 	cmpl   $0x142d,-0x1c(%ebp)
+     84e:	74 1a                	je     86a <pipe1+0x1a8>
+      printf(1, "pipe1 oops 3 total %d\n", total);
+     850:	83 ec 04             	sub    $0x4,%esp
+     853:	ff 75 e4             	push   -0x1c(%ebp)
+     856:	68 b8 5a 00 00       	push   $0x5ab8
+     85b:	6a 01                	push   $0x1
+     85d:	e8 aa 4a 00 00       	call   530c <printf>
+     862:	83 c4 10             	add    $0x10,%esp
+      exit();
+     865:	e8 cc 48 00 00       	call   5136 <exit>
+    }
+    close(fds[0]);
+     86a:	8b 45 d8             	mov    -0x28(%ebp),%eax
+     86d:	83 ec 0c             	sub    $0xc,%esp
+     870:	50                   	push   %eax
+     871:	e8 e3 48 00 00       	call   5159 <close>
+     876:	83 c4 10             	add    $0x10,%esp
+    wait();
+     879:	e8 bf 48 00 00       	call   513d <wait>
+  } else {
+    printf(1, "fork() failed\n");
+    exit();
+  }
+  printf(1, "pipe1 ok\n");
+     87e:	83 ec 08             	sub    $0x8,%esp
+     881:	68 de 5a 00 00       	push   $0x5ade
+     886:	6a 01                	push   $0x1
+     888:	e8 7f 4a 00 00       	call   530c <printf>
+     88d:	83 c4 10             	add    $0x10,%esp
+     890:	eb 17                	jmp    8a9 <pipe1+0x1e7>
+    printf(1, "fork() failed\n");
+     892:	83 ec 08             	sub    $0x8,%esp
+     895:	68 cf 5a 00 00       	push   $0x5acf
+     89a:	6a 01                	push   $0x1
+     89c:	e8 6b 4a 00 00       	call   530c <printf>
+     8a1:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8a4:	e8 8d 48 00 00       	call   5136 <exit>
+}
+     8a9:	c9                   	leave
+     8aa:	c3                   	ret
+
+000008ab <manypipes>:
+
+// open more files across the system than the old fixed
+// file table (100 entries) could hold.
+void
+manypipes(void)
+{
+     8ab:	55                   	push   %ebp
+     8ac:	89 e5                	mov    %esp,%ebp
+     8ae:	83 ec 58             	sub    $0x58,%esp
+  int r[2], fds[2], pids[10], i, n, total;
+  char c;
+
+  printf(1, "manypipes test\n");
+     8b1:	83 ec 08             	sub    $0x8,%esp
+     8b4:	68 e8 5a 00 00       	push   $0x5ae8
+     8b9:	6a 01                	push   $0x1
+     8bb:	e8 4c 4a 00 00       	call   530c <printf>
+     8c0:	83 c4 10             	add    $0x10,%esp
+  if(pipe(r) != 0){
+     8c3:	83 ec 0c             	sub    $0xc,%esp
+     8c6:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+     8c9:	50                   	push   %eax
+     8ca:	e8 75 48 00 00       	call   5144 <pipe>
+     8cf:	83 c4 10             	add    $0x10,%esp
+     8d2:	85 c0                	test   %eax,%eax
+     8d4:	74 17                	je     8ed <manypipes+0x42>
+    printf(1, "pipe() failed\n");
+     8d6:	83 ec 08             	sub    $0x8,%esp
+     8d9:	68 8d 5a 00 00       	push   $0x5a8d
+     8de:	6a 01                	push   $0x1
+     8e0:	e8 27 4a 00 00       	call   530c <printf>
+     8e5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     8e8:	e8 49 48 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < 10; i++){
+     8ed:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     8f4:	e9 a1 00 00 00       	jmp    99a <manypipes+0xef>
+    pids[i] = fork();
+     8f9:	e8 31 48 00 00       	call   512f <fork>
+     8fe:	8b 55 f4             	mov    -0xc(%ebp),%edx
+     901:	89 44 95 b4          	mov    %eax,-0x4c(%ebp,%edx,4)
+    if(pids[i] < 0){
+     905:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     908:	8b 44 85 b4          	mov    -0x4c(%ebp,%eax,4),%eax
+     90c:	85 c0                	test   %eax,%eax
+     90e:	79 17                	jns    927 <manypipes+0x7c>
+      printf(1, "fork failed\n");
+     910:	83 ec 08             	sub    $0x8,%esp
+     913:	68 f8 5a 00 00       	push   $0x5af8
+     918:	6a 01                	push   $0x1
+     91a:	e8 ed 49 00 00       	call   530c <printf>
+     91f:	83 c4 10             	add    $0x10,%esp
+      exit();
+     922:	e8 0f 48 00 00       	call   5136 <exit>
+    }
+    if(pids[i] == 0){
+     927:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     92a:	8b 44 85 b4          	mov    -0x4c(%ebp,%eax,4),%eax
+     92e:	85 c0                	test   %eax,%eax
+     930:	75 64                	jne    996 <manypipes+0xeb>
+      close(r[0]);
+     932:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     935:	83 ec 0c             	sub    $0xc,%esp
+     938:	50                   	push   %eax
+     939:	e8 1b 48 00 00       	call   5159 <close>
+     93e:	83 c4 10             	add    $0x10,%esp
+      for(n = 0; pipe(fds) == 0; n++)
+     941:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+     948:	eb 04                	jmp    94e <manypipes+0xa3>
+     94a:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+     94e:	83 ec 0c             	sub    $0xc,%esp
+     951:	8d 45 dc             	lea    -0x24(%ebp),%eax
+     954:	50                   	push   %eax
+     955:	e8 ea 47 00 00       	call   5144 <pipe>
+     95a:	83 c4 10             	add    $0x10,%esp
+     95d:	85 c0                	test   %eax,%eax
+     95f:	74 e9                	je     94a <manypipes+0x9f>
+        ;
+      c = n;
+     961:	8b 45 f0             	mov    -0x10(%ebp),%eax
+     964:	88 45 b3             	mov    %al,-0x4d(%ebp)
+      write(r[1], &c, 1);
+     967:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     96a:	83 ec 04             	sub    $0x4,%esp
+     96d:	6a 01                	push   $0x1
+     96f:	8d 55 b3             	lea    -0x4d(%ebp),%edx
+     972:	52                   	push   %edx
+     973:	50                   	push   %eax
+     974:	e8 d9 47 00 00       	call   5152 <write>
+     979:	83 c4 10             	add    $0x10,%esp
+      read(fds[0], &c, 1);  // blocks until killed
+     97c:	8b 45 dc             	mov    -0x24(%ebp),%eax
+     97f:	83 ec 04             	sub    $0x4,%esp
+     982:	6a 01                	push   $0x1
+     984:	8d 55 b3             	lea    -0x4d(%ebp),%edx
+     987:	52                   	push   %edx
+     988:	50                   	push   %eax
+     989:	e8 bd 47 00 00       	call   514b <read>
+     98e:	83 c4 10             	add    $0x10,%esp
+      exit();
+     991:	e8 a0 47 00 00       	call   5136 <exit>
+  for(i = 0; i < 10; i++){
+     996:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     99a:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     99e:	0f 8e 55 ff ff ff    	jle    8f9 <manypipes+0x4e>
+    }
+  }
+  close(r[1]);
+     9a4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     9a7:	83 ec 0c             	sub    $0xc,%esp
+     9aa:	50                   	push   %eax
+     9ab:	e8 a9 47 00 00       	call   5159 <close>
+     9b0:	83 c4 10             	add    $0x10,%esp
+  total = 0;
+     9b3:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; i < 10; i++){
+     9ba:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     9c1:	eb 41                	jmp    a04 <manypipes+0x159>
+    if(read(r[0], &c, 1) != 1){
+     9c3:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     9c6:	83 ec 04             	sub    $0x4,%esp
+     9c9:	6a 01                	push   $0x1
+     9cb:	8d 55 b3             	lea    -0x4d(%ebp),%edx
+     9ce:	52                   	push   %edx
+     9cf:	50                   	push   %eax
+     9d0:	e8 76 47 00 00       	call   514b <read>
+     9d5:	83 c4 10             	add    $0x10,%esp
+     9d8:	83 f8 01             	cmp    $0x1,%eax
+     9db:	74 17                	je     9f4 <manypipes+0x149>
+      printf(1, "manypipes read failed\n");
+     9dd:	83 ec 08             	sub    $0x8,%esp
+     9e0:	68 05 5b 00 00       	push   $0x5b05
+     9e5:	6a 01                	push   $0x1
+     9e7:	e8 20 49 00 00       	call   530c <printf>
+     9ec:	83 c4 10             	add    $0x10,%esp
+      exit();
+     9ef:	e8 42 47 00 00       	call   5136 <exit>
+    }
+    total += 2*c;
+     9f4:	0f b6 45 b3          	movzbl -0x4d(%ebp),%eax
+     9f8:	0f be c0             	movsbl %al,%eax
+     9fb:	01 c0                	add    %eax,%eax
+     9fd:	01 45 ec             	add    %eax,-0x14(%ebp)
+  for(i = 0; i < 10; i++){
+     a00:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a04:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     a08:	7e b9                	jle    9c3 <manypipes+0x118>
+  }
+  close(r[0]);
+     a0a:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+     a0d:	83 ec 0c             	sub    $0xc,%esp
+     a10:	50                   	push   %eax
+     a11:	e8 43 47 00 00       	call   5159 <close>
+     a16:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 10; i++){
+     a19:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     a20:	eb 1c                	jmp    a3e <manypipes+0x193>
+    kill(pids[i]);
+     a22:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     a25:	8b 44 85 b4          	mov    -0x4c(%ebp,%eax,4),%eax
+     a29:	83 ec 0c             	sub    $0xc,%esp
+     a2c:	50                   	push   %eax
+     a2d:	e8 2e 47 00 00       	call   5160 <kill>
+     a32:	83 c4 10             	add    $0x10,%esp
+    wait();
+     a35:	e8 03 47 00 00       	call   513d <wait>
+  for(i = 0; i < 10; i++){
+     a3a:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     a3e:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+     a42:	7e de                	jle    a22 <manypipes+0x177>
+  }
+  if(total <= 100){
+     a44:	83 7d ec 64          	cmpl   $0x64,-0x14(%ebp)
+     a48:	7f 1a                	jg     a64 <manypipes+0x1b9>
+    printf(1, "manypipes: only %d files\n", total);
+     a4a:	83 ec 04             	sub    $0x4,%esp
+     a4d:	ff 75 ec             	push   -0x14(%ebp)
+     a50:	68 1c 5b 00 00       	push   $0x5b1c
+     a55:	6a 01                	push   $0x1
+     a57:	e8 b0 48 00 00       	call   530c <printf>
+     a5c:	83 c4 10             	add    $0x10,%esp
+    exit();
+     a5f:	e8 d2 46 00 00       	call   5136 <exit>
+  }
+  printf(1, "manypipes ok\n");
+     a64:	83 ec 08             	sub    $0x8,%esp
+     a67:	68 36 5b 00 00       	push   $0x5b36
+     a6c:	6a 01                	push   $0x1
+     a6e:	e8 99 48 00 00       	call   530c <printf>
+     a73:	83 c4 10             	add    $0x10,%esp
+}
+     a76:	90                   	nop
+     a77:	c9                   	leave
+     a78:	c3                   	ret
+
+00000a79 <prioritytest>:
+
+// setpriority() accepts levels 0..NPRIO-1 of live processes only.
+void
+prioritytest(void)
+{
+     a79:	55                   	push   %ebp
+     a7a:	89 e5                	mov    %esp,%ebp
+     a7c:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  printf(1, "priority test\n");
+     a7f:	83 ec 08             	sub    $0x8,%esp
+     a82:	68 44 5b 00 00       	push   $0x5b44
+     a87:	6a 01                	push   $0x1
+     a89:	e8 7e 48 00 00       	call   530c <printf>
+     a8e:	83 c4 10             	add    $0x10,%esp
+  if(setpriority(getpid(), -1) != -1 || setpriority(getpid(), 100) != -1){
+     a91:	e8 16 47 00 00       	call   51ac <getpid>
+     a96:	83 ec 08             	sub    $0x8,%esp
+     a99:	6a ff                	push   $0xffffffff
+     a9b:	50                   	push   %eax
+     a9c:	e8 3d 47 00 00       	call   51de <setpriority>
+     aa1:	83 c4 10             	add    $0x10,%esp
+     aa4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     aa7:	75 18                	jne    ac1 <prioritytest+0x48>
+     aa9:	e8 fe 46 00 00       	call   51ac <getpid>
+     aae:	83 ec 08             	sub    $0x8,%esp
+     ab1:	6a 64                	push   $0x64
+     ab3:	50                   	push   %eax
+     ab4:	e8 25 47 00 00       	call   51de <setpriority>
+     ab9:	83 c4 10             	add    $0x10,%esp
+     abc:	83 f8 ff             	cmp    $0xffffffff,%eax
+     abf:	74 17                	je     ad8 <prioritytest+0x5f>
+    printf(1, "setpriority accepted a bad level\n");
+     ac1:	83 ec 08             	sub    $0x8,%esp
+     ac4:	68 54 5b 00 00       	push   $0x5b54
+     ac9:	6a 01                	push   $0x1
+     acb:	e8 3c 48 00 00       	call   530c <printf>
+     ad0:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ad3:	e8 5e 46 00 00       	call   5136 <exit>
+  }
+  pid = fork();
+     ad8:	e8 52 46 00 00       	call   512f <fork>
+     add:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid == 0){
+     ae0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+     ae4:	75 03                	jne    ae9 <prioritytest+0x70>
+    for(;;)
+     ae6:	90                   	nop
+     ae7:	eb fd                	jmp    ae6 <prioritytest+0x6d>
+      ;
+  }
+  if(setpriority(pid, 3) != 0 || setpriority(pid, 0) != 0){
+     ae9:	83 ec 08             	sub    $0x8,%esp
+     aec:	6a 03                	push   $0x3
+     aee:	ff 75 f4             	push   -0xc(%ebp)
+     af1:	e8 e8 46 00 00       	call   51de <setpriority>
+     af6:	83 c4 10             	add    $0x10,%esp
+     af9:	85 c0                	test   %eax,%eax
+     afb:	75 14                	jne    b11 <prioritytest+0x98>
+     afd:	83 ec 08             	sub    $0x8,%esp
+     b00:	6a 00                	push   $0x0
+     b02:	ff 75 f4             	push   -0xc(%ebp)
+     b05:	e8 d4 46 00 00       	call   51de <setpriority>
+     b0a:	83 c4 10             	add    $0x10,%esp
+     b0d:	85 c0                	test   %eax,%eax
+     b0f:	74 17                	je     b28 <prioritytest+0xaf>
+    printf(1, "setpriority failed\n");
+     b11:	83 ec 08             	sub    $0x8,%esp
+     b14:	68 76 5b 00 00       	push   $0x5b76
+     b19:	6a 01                	push   $0x1
+     b1b:	e8 ec 47 00 00       	call   530c <printf>
+     b20:	83 c4 10             	add    $0x10,%esp
+    exit();
+     b23:	e8 0e 46 00 00       	call   5136 <exit>
+  }
+  kill(pid);
+     b28:	83 ec 0c             	sub    $0xc,%esp
+     b2b:	ff 75 f4             	push   -0xc(%ebp)
+     b2e:	e8 2d 46 00 00       	call   5160 <kill>
+     b33:	83 c4 10             	add    $0x10,%esp
+  wait();
+     b36:	e8 02 46 00 00       	call   513d <wait>
+  if(setpriority(pid, 0) != -1){
+     b3b:	83 ec 08             	sub    $0x8,%esp
+     b3e:	6a 00                	push   $0x0
+     b40:	ff 75 f4             	push   -0xc(%ebp)
+     b43:	e8 96 46 00 00       	call   51de <setpriority>
+     b48:	83 c4 10             	add    $0x10,%esp
+     b4b:	83 f8 ff             	cmp    $0xffffffff,%eax
+     b4e:	74 17                	je     b67 <prioritytest+0xee>
+    printf(1, "setpriority of dead process succeeded\n");
+     b50:	83 ec 08             	sub    $0x8,%esp
+     b53:	68 8c 5b 00 00       	push   $0x5b8c
+     b58:	6a 01                	push   $0x1
+     b5a:	e8 ad 47 00 00       	call   530c <printf>
+     b5f:	83 c4 10             	add    $0x10,%esp
+    exit();
+     b62:	e8 cf 45 00 00       	call   5136 <exit>
+  }
+  printf(1, "priority ok\n");
+     b67:	83 ec 08             	sub    $0x8,%esp
+     b6a:	68 b3 5b 00 00       	push   $0x5bb3
+     b6f:	6a 01                	push   $0x1
+     b71:	e8 96 47 00 00       	call   530c <printf>
+     b76:	83 c4 10             	add    $0x10,%esp
+}
+     b79:	90                   	nop
+     b7a:	c9                   	leave
+     b7b:	c3                   	ret
+
+00000b7c <threadfn>:
+int threadslot[4];
+int threadfd;
+
+void
+threadfn(void *arg)
+{
+     b7c:	55                   	push   %ebp
+     b7d:	89 e5                	mov    %esp,%ebp
+     b7f:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  i = (int)arg;
+     b82:	8b 45 08             	mov    0x8(%ebp),%eax
+     b85:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  threadslot[i] = i + 100;
+     b88:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b8b:	8d 50 64             	lea    0x64(%eax),%edx
+     b8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     b91:	89 14 85 24 9e 00 00 	mov    %edx,0x9e24(,%eax,4)
+  write(threadfd, "x", 1);
+     b98:	a1 34 9e 00 00       	mov    0x9e34,%eax
+     b9d:	83 ec 04             	sub    $0x4,%esp
+     ba0:	6a 01                	push   $0x1
+     ba2:	68 c0 5b 00 00       	push   $0x5bc0
+     ba7:	50                   	push   %eax
+     ba8:	e8 a5 45 00 00       	call   5152 <write>
+     bad:	83 c4 10             	add    $0x10,%esp
+  exit();
+     bb0:	e8 81 45 00 00       	call   5136 <exit>
+
+00000bb5 <threadspin>:
+}
+
+void
+threadspin(void *arg)
+{
+     bb5:	55                   	push   %ebp
+     bb6:	89 e5                	mov    %esp,%ebp
+  for(;;)
+     bb8:	90                   	nop
+     bb9:	eb fd                	jmp    bb8 <threadspin+0x3>
+
+00000bbb <threadtest>:
+
+// threads share memory and open files, are reaped by
+// join() rather than wait(), and die with their leader.
+void
+threadtest(void)
+{
+     bbb:	55                   	push   %ebp
+     bbc:	89 e5                	mov    %esp,%ebp
+     bbe:	83 ec 28             	sub    $0x28,%esp
+  int fds[2], i, pid;
+  char c;
+
+  printf(1, "thread test\n");
+     bc1:	83 ec 08             	sub    $0x8,%esp
+     bc4:	68 c2 5b 00 00       	push   $0x5bc2
+     bc9:	6a 01                	push   $0x1
+     bcb:	e8 3c 47 00 00       	call   530c <printf>
+     bd0:	83 c4 10             	add    $0x10,%esp
+  if(pipe(fds) != 0){
+     bd3:	83 ec 0c             	sub    $0xc,%esp
+     bd6:	8d 45 e8             	lea    -0x18(%ebp),%eax
+     bd9:	50                   	push   %eax
+     bda:	e8 65 45 00 00       	call   5144 <pipe>
+     bdf:	83 c4 10             	add    $0x10,%esp
+     be2:	85 c0                	test   %eax,%eax
+     be4:	74 17                	je     bfd <threadtest+0x42>
+    printf(1, "pipe() failed\n");
+     be6:	83 ec 08             	sub    $0x8,%esp
+     be9:	68 8d 5a 00 00       	push   $0x5a8d
+     bee:	6a 01                	push   $0x1
+     bf0:	e8 17 47 00 00       	call   530c <printf>
+     bf5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     bf8:	e8 39 45 00 00       	call   5136 <exit>
+  }
+  threadfd = fds[1];
+     bfd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     c00:	a3 34 9e 00 00       	mov    %eax,0x9e34
+  for(i = 0; i < 4; i++){
+     c05:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c0c:	eb 33                	jmp    c41 <threadtest+0x86>
+    if(thread_create(threadfn, (void*)i) < 0){
+     c0e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     c11:	83 ec 08             	sub    $0x8,%esp
+     c14:	50                   	push   %eax
+     c15:	68 7c 0b 00 00       	push   $0xb7c
+     c1a:	e8 a4 4a 00 00       	call   56c3 <thread_create>
+     c1f:	83 c4 10             	add    $0x10,%esp
+     c22:	85 c0                	test   %eax,%eax
+     c24:	79 17                	jns    c3d <threadtest+0x82>
+      printf(1, "thread_create failed\n");
+     c26:	83 ec 08             	sub    $0x8,%esp
+     c29:	68 cf 5b 00 00       	push   $0x5bcf
+     c2e:	6a 01                	push   $0x1
+     c30:	e8 d7 46 00 00       	call   530c <printf>
+     c35:	83 c4 10             	add    $0x10,%esp
+      exit();
+     c38:	e8 f9 44 00 00       	call   5136 <exit>
+  for(i = 0; i < 4; i++){
+     c3d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     c41:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     c45:	7e c7                	jle    c0e <threadtest+0x53>
+    }
+  }
+  for(i = 0; i < 4; i++){
+     c47:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     c4e:	eb 35                	jmp    c85 <threadtest+0xca>
+    if(read(fds[0], &c, 1) != 1){
+     c50:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     c53:	83 ec 04             	sub    $0x4,%esp
+     c56:	6a 01                	push   $0x1
+     c58:	8d 55 e7             	lea    -0x19(%ebp),%edx
+     c5b:	52                   	push   %edx
+     c5c:	50                   	push   %eax
+     c5d:	e8 e9 44 00 00       	call   514b <read>
+     c62:	83 c4 10             	add    $0x10,%esp
+     c65:	83 f8 01             	cmp    $0x1,%eax
+     c68:	74 17                	je     c81 <threadtest+0xc6>
+      printf(1, "thread write failed\n");
+     c6a:	83 ec 08             	sub    $0x8,%esp
+     c6d:	68 e5 5b 00 00       	push   $0x5be5
+     c72:	6a 01                	push   $0x1
+     c74:	e8 93 46 00 00       	call   530c <printf>
+     c79:	83 c4 10             	add    $0x10,%esp
+      exit();
+     c7c:	e8 b5 44 00 00       	call   5136 <exit>
+  for(i = 0; i < 4; i++){
+     c81:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     c85:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     c89:	7e c5                	jle    c50 <threadtest+0x95>
+    }
+  }
+  if(wait() != -1){
+     c8b:	e8 ad 44 00 00       	call   513d <wait>
+     c90:	83 f8 ff             	cmp    $0xffffffff,%eax
+     c93:	74 17                	je     cac <threadtest+0xf1>
+    printf(1, "wait returned a thread\n");
+     c95:	83 ec 08             	sub    $0x8,%esp
+     c98:	68 fa 5b 00 00       	push   $0x5bfa
+     c9d:	6a 01                	push   $0x1
+     c9f:	e8 68 46 00 00       	call   530c <printf>
+     ca4:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ca7:	e8 8a 44 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < 4; i++){
+     cac:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     cb3:	eb 24                	jmp    cd9 <threadtest+0x11e>
+    if(thread_join() < 0){
+     cb5:	e8 5f 4a 00 00       	call   5719 <thread_join>
+     cba:	85 c0                	test   %eax,%eax
+     cbc:	79 17                	jns    cd5 <threadtest+0x11a>
+      printf(1, "thread_join failed\n");
+     cbe:	83 ec 08             	sub    $0x8,%esp
+     cc1:	68 12 5c 00 00       	push   $0x5c12
+     cc6:	6a 01                	push   $0x1
+     cc8:	e8 3f 46 00 00       	call   530c <printf>
+     ccd:	83 c4 10             	add    $0x10,%esp
+      exit();
+     cd0:	e8 61 44 00 00       	call   5136 <exit>
+  for(i = 0; i < 4; i++){
+     cd5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     cd9:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     cdd:	7e d6                	jle    cb5 <threadtest+0xfa>
+    }
+  }
+  if(thread_join() != -1){
+     cdf:	e8 35 4a 00 00       	call   5719 <thread_join>
+     ce4:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ce7:	74 17                	je     d00 <threadtest+0x145>
+    printf(1, "thread_join with no threads succeeded\n");
+     ce9:	83 ec 08             	sub    $0x8,%esp
+     cec:	68 28 5c 00 00       	push   $0x5c28
+     cf1:	6a 01                	push   $0x1
+     cf3:	e8 14 46 00 00       	call   530c <printf>
+     cf8:	83 c4 10             	add    $0x10,%esp
+    exit();
+     cfb:	e8 36 44 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < 4; i++){
+     d00:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     d07:	eb 2f                	jmp    d38 <threadtest+0x17d>
+    if(threadslot[i] != i + 100){
+     d09:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d0c:	8b 14 85 24 9e 00 00 	mov    0x9e24(,%eax,4),%edx
+     d13:	8b 45 f4             	mov    -0xc(%ebp),%eax
+     d16:	83 c0 64             	add    $0x64,%eax
+     d19:	39 c2                	cmp    %eax,%edx
+     d1b:	74 17                	je     d34 <threadtest+0x179>
+      printf(1, "thread memory not shared\n");
+     d1d:	83 ec 08             	sub    $0x8,%esp
+     d20:	68 4f 5c 00 00       	push   $0x5c4f
+     d25:	6a 01                	push   $0x1
+     d27:	e8 e0 45 00 00       	call   530c <printf>
+     d2c:	83 c4 10             	add    $0x10,%esp
+      exit();
+     d2f:	e8 02 44 00 00       	call   5136 <exit>
+  for(i = 0; i < 4; i++){
+     d34:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     d38:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     d3c:	7e cb                	jle    d09 <threadtest+0x14e>
+    }
+  }
+  close(fds[0]);
+     d3e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+     d41:	83 ec 0c             	sub    $0xc,%esp
+     d44:	50                   	push   %eax
+     d45:	e8 0f 44 00 00       	call   5159 <close>
+     d4a:	83 c4 10             	add    $0x10,%esp
+  close(fds[1]);
+     d4d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+     d50:	83 ec 0c             	sub    $0xc,%esp
+     d53:	50                   	push   %eax
+     d54:	e8 00 44 00 00       	call   5159 <close>
+     d59:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+     d5c:	e8 ce 43 00 00       	call   512f <fork>
+     d61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+     d64:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+     d68:	75 29                	jne    d93 <threadtest+0x1d8>
+    thread_create(threadspin, 0);
+     d6a:	83 ec 08             	sub    $0x8,%esp
+     d6d:	6a 00                	push   $0x0
+     d6f:	68 b5 0b 00 00       	push   $0xbb5
+     d74:	e8 4a 49 00 00       	call   56c3 <thread_create>
+     d79:	83 c4 10             	add    $0x10,%esp
+    thread_create(threadspin, 0);
+     d7c:	83 ec 08             	sub    $0x8,%esp
+     d7f:	6a 00                	push   $0x0
+     d81:	68 b5 0b 00 00       	push   $0xbb5
+     d86:	e8 38 49 00 00       	call   56c3 <thread_create>
+     d8b:	83 c4 10             	add    $0x10,%esp
+    exit();
+     d8e:	e8 a3 43 00 00       	call   5136 <exit>
+  }
+  if(wait() != pid){
+     d93:	e8 a5 43 00 00       	call   513d <wait>
+     d98:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+     d9b:	74 17                	je     db4 <threadtest+0x1f9>
+    printf(1, "leader with threads did not exit\n");
+     d9d:	83 ec 08             	sub    $0x8,%esp
+     da0:	68 6c 5c 00 00       	push   $0x5c6c
+     da5:	6a 01                	push   $0x1
+     da7:	e8 60 45 00 00       	call   530c <printf>
+     dac:	83 c4 10             	add    $0x10,%esp
+    exit();
+     daf:	e8 82 43 00 00       	call   5136 <exit>
+  }
+  printf(1, "thread ok\n");
+     db4:	83 ec 08             	sub    $0x8,%esp
+     db7:	68 8e 5c 00 00       	push   $0x5c8e
+     dbc:	6a 01                	push   $0x1
+     dbe:	e8 49 45 00 00       	call   530c <printf>
+     dc3:	83 c4 10             	add    $0x10,%esp
+}
+     dc6:	90                   	nop
+     dc7:	c9                   	leave
+     dc8:	c3                   	ret
+
+00000dc9 <futexfn>:
+struct cond futexcv;
+int futexcount, futexdone;
+
+void
+futexfn(void *arg)
+{
+     dc9:	55                   	push   %ebp
+     dca:	89 e5                	mov    %esp,%ebp
+     dcc:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  for(i = 0; i < 1000; i++){
+     dcf:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     dd6:	eb 31                	jmp    e09 <futexfn+0x40>
+    mutex_lock(&futexmu);
+     dd8:	83 ec 0c             	sub    $0xc,%esp
+     ddb:	68 38 9e 00 00       	push   $0x9e38
+     de0:	e8 af 3f 00 00       	call   4d94 <mutex_lock>
+     de5:	83 c4 10             	add    $0x10,%esp
+    futexcount++;
+     de8:	a1 40 9e 00 00       	mov    0x9e40,%eax
+     ded:	83 c0 01             	add    $0x1,%eax
+     df0:	a3 40 9e 00 00       	mov    %eax,0x9e40
+    mutex_unlock(&futexmu);
+     df5:	83 ec 0c             	sub    $0xc,%esp
+     df8:	68 38 9e 00 00       	push   $0x9e38
+     dfd:	e8 fa 3f 00 00       	call   4dfc <mutex_unlock>
+     e02:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+     e05:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     e09:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+     e10:	7e c6                	jle    dd8 <futexfn+0xf>
+  }
+  mutex_lock(&futexmu);
+     e12:	83 ec 0c             	sub    $0xc,%esp
+     e15:	68 38 9e 00 00       	push   $0x9e38
+     e1a:	e8 75 3f 00 00       	call   4d94 <mutex_lock>
+     e1f:	83 c4 10             	add    $0x10,%esp
+  futexdone++;
+     e22:	a1 44 9e 00 00       	mov    0x9e44,%eax
+     e27:	83 c0 01             	add    $0x1,%eax
+     e2a:	a3 44 9e 00 00       	mov    %eax,0x9e44
+  cond_signal(&futexcv);
+     e2f:	83 ec 0c             	sub    $0xc,%esp
+     e32:	68 3c 9e 00 00       	push   $0x9e3c
+     e37:	e8 83 40 00 00       	call   4ebf <cond_signal>
+     e3c:	83 c4 10             	add    $0x10,%esp
+  mutex_unlock(&futexmu);
+     e3f:	83 ec 0c             	sub    $0xc,%esp
+     e42:	68 38 9e 00 00       	push   $0x9e38
+     e47:	e8 b0 3f 00 00       	call   4dfc <mutex_unlock>
+     e4c:	83 c4 10             	add    $0x10,%esp
+  exit();
+     e4f:	e8 e2 42 00 00       	call   5136 <exit>
+
+00000e54 <futextest>:
+
+// threads counting under a futex mutex lose no updates,
+// and a condition variable reports when they are done.
+void
+futextest(void)
+{
+     e54:	55                   	push   %ebp
+     e55:	89 e5                	mov    %esp,%ebp
+     e57:	83 ec 18             	sub    $0x18,%esp
+  uint w;
+  int i;
+
+  printf(1, "futex test\n");
+     e5a:	83 ec 08             	sub    $0x8,%esp
+     e5d:	68 99 5c 00 00       	push   $0x5c99
+     e62:	6a 01                	push   $0x1
+     e64:	e8 a3 44 00 00       	call   530c <printf>
+     e69:	83 c4 10             	add    $0x10,%esp
+  w = 1;
+     e6c:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+  if(futex_wait(&w, 2) != 0 || futex_wake(&w, 1) != 0){
+     e73:	83 ec 08             	sub    $0x8,%esp
+     e76:	6a 02                	push   $0x2
+     e78:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     e7b:	50                   	push   %eax
+     e7c:	e8 7b 43 00 00       	call   51fc <futex_wait>
+     e81:	83 c4 10             	add    $0x10,%esp
+     e84:	85 c0                	test   %eax,%eax
+     e86:	75 15                	jne    e9d <futextest+0x49>
+     e88:	83 ec 08             	sub    $0x8,%esp
+     e8b:	6a 01                	push   $0x1
+     e8d:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     e90:	50                   	push   %eax
+     e91:	e8 70 43 00 00       	call   5206 <futex_wake>
+     e96:	83 c4 10             	add    $0x10,%esp
+     e99:	85 c0                	test   %eax,%eax
+     e9b:	74 17                	je     eb4 <futextest+0x60>
+    printf(1, "futex on unchanged word failed\n");
+     e9d:	83 ec 08             	sub    $0x8,%esp
+     ea0:	68 a8 5c 00 00       	push   $0x5ca8
+     ea5:	6a 01                	push   $0x1
+     ea7:	e8 60 44 00 00       	call   530c <printf>
+     eac:	83 c4 10             	add    $0x10,%esp
+    exit();
+     eaf:	e8 82 42 00 00       	call   5136 <exit>
+  }
+  if(futex_wait((uint*)0x7ffffffc, 0) != -1 || futex_wait((uint*)((char*)&w + 1), 0) != -1){
+     eb4:	83 ec 08             	sub    $0x8,%esp
+     eb7:	6a 00                	push   $0x0
+     eb9:	68 fc ff ff 7f       	push   $0x7ffffffc
+     ebe:	e8 39 43 00 00       	call   51fc <futex_wait>
+     ec3:	83 c4 10             	add    $0x10,%esp
+     ec6:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ec9:	75 19                	jne    ee4 <futextest+0x90>
+     ecb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+     ece:	83 c0 01             	add    $0x1,%eax
+     ed1:	83 ec 08             	sub    $0x8,%esp
+     ed4:	6a 00                	push   $0x0
+     ed6:	50                   	push   %eax
+     ed7:	e8 20 43 00 00       	call   51fc <futex_wait>
+     edc:	83 c4 10             	add    $0x10,%esp
+     edf:	83 f8 ff             	cmp    $0xffffffff,%eax
+     ee2:	74 17                	je     efb <futextest+0xa7>
+    printf(1, "futex accepted a bad address\n");
+     ee4:	83 ec 08             	sub    $0x8,%esp
+     ee7:	68 c8 5c 00 00       	push   $0x5cc8
+     eec:	6a 01                	push   $0x1
+     eee:	e8 19 44 00 00       	call   530c <printf>
+     ef3:	83 c4 10             	add    $0x10,%esp
+    exit();
+     ef6:	e8 3b 42 00 00       	call   5136 <exit>
+  }
+
+  mutex_init(&futexmu);
+     efb:	83 ec 0c             	sub    $0xc,%esp
+     efe:	68 38 9e 00 00       	push   $0x9e38
+     f03:	e8 7d 3e 00 00       	call   4d85 <mutex_init>
+     f08:	83 c4 10             	add    $0x10,%esp
+  cond_init(&futexcv);
+     f0b:	83 ec 0c             	sub    $0xc,%esp
+     f0e:	68 3c 9e 00 00       	push   $0x9e3c
+     f13:	e8 11 3f 00 00       	call   4e29 <cond_init>
+     f18:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 4; i++){
+     f1b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     f22:	eb 31                	jmp    f55 <futextest+0x101>
+    if(thread_create(futexfn, 0) < 0){
+     f24:	83 ec 08             	sub    $0x8,%esp
+     f27:	6a 00                	push   $0x0
+     f29:	68 c9 0d 00 00       	push   $0xdc9
+     f2e:	e8 90 47 00 00       	call   56c3 <thread_create>
+     f33:	83 c4 10             	add    $0x10,%esp
+     f36:	85 c0                	test   %eax,%eax
+     f38:	79 17                	jns    f51 <futextest+0xfd>
+      printf(1, "thread_create failed\n");
+     f3a:	83 ec 08             	sub    $0x8,%esp
+     f3d:	68 cf 5b 00 00       	push   $0x5bcf
+     f42:	6a 01                	push   $0x1
+     f44:	e8 c3 43 00 00       	call   530c <printf>
+     f49:	83 c4 10             	add    $0x10,%esp
+      exit();
+     f4c:	e8 e5 41 00 00       	call   5136 <exit>
+  for(i = 0; i < 4; i++){
+     f51:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     f55:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     f59:	7e c9                	jle    f24 <futextest+0xd0>
+    }
+  }
+  mutex_lock(&futexmu);
+     f5b:	83 ec 0c             	sub    $0xc,%esp
+     f5e:	68 38 9e 00 00       	push   $0x9e38
+     f63:	e8 2c 3e 00 00       	call   4d94 <mutex_lock>
+     f68:	83 c4 10             	add    $0x10,%esp
+  while(futexdone < 4)
+     f6b:	eb 15                	jmp    f82 <futextest+0x12e>
+    cond_wait(&futexcv, &futexmu);
+     f6d:	83 ec 08             	sub    $0x8,%esp
+     f70:	68 38 9e 00 00       	push   $0x9e38
+     f75:	68 3c 9e 00 00       	push   $0x9e3c
+     f7a:	e8 b9 3e 00 00       	call   4e38 <cond_wait>
+     f7f:	83 c4 10             	add    $0x10,%esp
+  while(futexdone < 4)
+     f82:	a1 44 9e 00 00       	mov    0x9e44,%eax
+     f87:	83 f8 03             	cmp    $0x3,%eax
+     f8a:	7e e1                	jle    f6d <futextest+0x119>
+  mutex_unlock(&futexmu);
+     f8c:	83 ec 0c             	sub    $0xc,%esp
+     f8f:	68 38 9e 00 00       	push   $0x9e38
+     f94:	e8 63 3e 00 00       	call   4dfc <mutex_unlock>
+     f99:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 4; i++)
+     f9c:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+     fa3:	eb 09                	jmp    fae <futextest+0x15a>
+    thread_join();
+     fa5:	e8 6f 47 00 00       	call   5719 <thread_join>
+  for(i = 0; i < 4; i++)
+     faa:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+     fae:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+     fb2:	7e f1                	jle    fa5 <futextest+0x151>
+  if(futexcount != 4000){
+     fb4:	a1 40 9e 00 00       	mov    0x9e40,%eax
+     fb9:	3d a0 0f 00 00       	cmp    $0xfa0,%eax
+     fbe:	74 1d                	je     fdd <futextest+0x189>
+    printf(1, "futex mutex lost updates: %d\n", futexcount);
+     fc0:	a1 40 9e 00 00       	mov    0x9e40,%eax
+     fc5:	83 ec 04             	sub    $0x4,%esp
+     fc8:	50                   	push   %eax
+     fc9:	68 e6 5c 00 00       	push   $0x5ce6
+     fce:	6a 01                	push   $0x1
+     fd0:	e8 37 43 00 00       	call   530c <printf>
+     fd5:	83 c4 10             	add    $0x10,%esp
+    exit();
+     fd8:	e8 59 41 00 00       	call   5136 <exit>
+  }
+  printf(1, "futex ok\n");
+     fdd:	83 ec 08             	sub    $0x8,%esp
+     fe0:	68 04 5d 00 00       	push   $0x5d04
+     fe5:	6a 01                	push   $0x1
+     fe7:	e8 20 43 00 00       	call   530c <printf>
+     fec:	83 c4 10             	add    $0x10,%esp
+}
+     fef:	90                   	nop
+     ff0:	c9                   	leave
+     ff1:	c3                   	ret
+
+00000ff2 <vdsofn>:
+
+volatile int vdsopid;
+
+void
+vdsofn(void *arg)
+{
+     ff2:	55                   	push   %ebp
+     ff3:	89 e5                	mov    %esp,%ebp
+     ff5:	53                   	push   %ebx
+     ff6:	83 ec 04             	sub    $0x4,%esp
+  vdsopid = vgetpid() == getpid() ? 1 : -1;
+     ff9:	e8 1a 3f 00 00       	call   4f18 <vgetpid>
+     ffe:	89 c3                	mov    %eax,%ebx
+    1000:	e8 a7 41 00 00       	call   51ac <getpid>
+    1005:	39 c3                	cmp    %eax,%ebx
+    1007:	75 07                	jne    1010 <vdsofn+0x1e>
+    1009:	b8 01 00 00 00       	mov    $0x1,%eax
+    100e:	eb 05                	jmp    1015 <vdsofn+0x23>
+    1010:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    1015:	a3 48 9e 00 00       	mov    %eax,0x9e48
+  exit();
+    101a:	e8 17 41 00 00       	call   5136 <exit>
+
+0000101f <vdsotest>:
+
+// the vDSO page helpers agree with the system calls,
+// in children and threads too.
+void
+vdsotest(void)
+{
+    101f:	55                   	push   %ebp
+    1020:	89 e5                	mov    %esp,%ebp
+    1022:	53                   	push   %ebx
+    1023:	83 ec 34             	sub    $0x34,%esp
+  uint t0, t1, t2;
+  uint64 c0, c1;
+  int pid;
+
+  printf(1, "vdso test\n");
+    1026:	83 ec 08             	sub    $0x8,%esp
+    1029:	68 0e 5d 00 00       	push   $0x5d0e
+    102e:	6a 01                	push   $0x1
+    1030:	e8 d7 42 00 00       	call   530c <printf>
+    1035:	83 c4 10             	add    $0x10,%esp
+  if(vgetpid() != getpid()){
+    1038:	e8 db 3e 00 00       	call   4f18 <vgetpid>
+    103d:	89 c3                	mov    %eax,%ebx
+    103f:	e8 68 41 00 00       	call   51ac <getpid>
+    1044:	39 c3                	cmp    %eax,%ebx
+    1046:	74 17                	je     105f <vdsotest+0x40>
+    printf(1, "vgetpid wrong\n");
+    1048:	83 ec 08             	sub    $0x8,%esp
+    104b:	68 19 5d 00 00       	push   $0x5d19
+    1050:	6a 01                	push   $0x1
+    1052:	e8 b5 42 00 00       	call   530c <printf>
+    1057:	83 c4 10             	add    $0x10,%esp
+    exit();
+    105a:	e8 d7 40 00 00       	call   5136 <exit>
+  }
+  t0 = uptime();
+    105f:	e8 66 41 00 00       	call   51ca <uptime>
+    1064:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  t1 = vuptime();
+    1067:	e8 a0 3e 00 00       	call   4f0c <vuptime>
+    106c:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  t2 = uptime();
+    106f:	e8 56 41 00 00       	call   51ca <uptime>
+    1074:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(t1 < t0 || t1 > t2){
+    1077:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    107a:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    107d:	72 08                	jb     1087 <vdsotest+0x68>
+    107f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1082:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    1085:	73 20                	jae    10a7 <vdsotest+0x88>
+    printf(1, "vuptime wrong: %d not in %d..%d\n", t1, t0, t2);
+    1087:	83 ec 0c             	sub    $0xc,%esp
+    108a:	ff 75 ec             	push   -0x14(%ebp)
+    108d:	ff 75 f4             	push   -0xc(%ebp)
+    1090:	ff 75 f0             	push   -0x10(%ebp)
+    1093:	68 28 5d 00 00       	push   $0x5d28
+    1098:	6a 01                	push   $0x1
+    109a:	e8 6d 42 00 00       	call   530c <printf>
+    109f:	83 c4 20             	add    $0x20,%esp
+    exit();
+    10a2:	e8 8f 40 00 00       	call   5136 <exit>
+  }
+  c0 = vclock();
+    10a7:	e8 8e 3e 00 00       	call   4f3a <vclock>
+    10ac:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    10af:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  sleep(2);
+    10b2:	83 ec 0c             	sub    $0xc,%esp
+    10b5:	6a 02                	push   $0x2
+    10b7:	e8 04 41 00 00       	call   51c0 <sleep>
+    10bc:	83 c4 10             	add    $0x10,%esp
+  c1 = vclock();
+    10bf:	e8 76 3e 00 00       	call   4f3a <vclock>
+    10c4:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    10c7:	89 55 dc             	mov    %edx,-0x24(%ebp)
+  if(c1 <= c0){
+    10ca:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    10cd:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    10d0:	8b 4d e4             	mov    -0x1c(%ebp),%ecx
+    10d3:	39 45 e0             	cmp    %eax,-0x20(%ebp)
+    10d6:	19 d1                	sbb    %edx,%ecx
+    10d8:	72 17                	jb     10f1 <vdsotest+0xd2>
+    printf(1, "vclock did not advance\n");
+    10da:	83 ec 08             	sub    $0x8,%esp
+    10dd:	68 49 5d 00 00       	push   $0x5d49
+    10e2:	6a 01                	push   $0x1
+    10e4:	e8 23 42 00 00       	call   530c <printf>
+    10e9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    10ec:	e8 45 40 00 00       	call   5136 <exit>
+  }
+
+  pid = fork();
+    10f1:	e8 39 40 00 00       	call   512f <fork>
+    10f6:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+  if(pid == 0){
+    10f9:	83 7d d4 00          	cmpl   $0x0,-0x2c(%ebp)
+    10fd:	75 27                	jne    1126 <vdsotest+0x107>
+    if(vgetpid() != getpid())
+    10ff:	e8 14 3e 00 00       	call   4f18 <vgetpid>
+    1104:	89 c3                	mov    %eax,%ebx
+    1106:	e8 a1 40 00 00       	call   51ac <getpid>
+    110b:	39 c3                	cmp    %eax,%ebx
+    110d:	74 12                	je     1121 <vdsotest+0x102>
+      printf(1, "vgetpid wrong in child\n");
+    110f:	83 ec 08             	sub    $0x8,%esp
+    1112:	68 61 5d 00 00       	push   $0x5d61
+    1117:	6a 01                	push   $0x1
+    1119:	e8 ee 41 00 00       	call   530c <printf>
+    111e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1121:	e8 10 40 00 00       	call   5136 <exit>
+  }
+  wait();
+    1126:	e8 12 40 00 00       	call   513d <wait>
+
+  if(thread_create(vdsofn, 0) < 0){
+    112b:	83 ec 08             	sub    $0x8,%esp
+    112e:	6a 00                	push   $0x0
+    1130:	68 f2 0f 00 00       	push   $0xff2
+    1135:	e8 89 45 00 00       	call   56c3 <thread_create>
+    113a:	83 c4 10             	add    $0x10,%esp
+    113d:	85 c0                	test   %eax,%eax
+    113f:	79 17                	jns    1158 <vdsotest+0x139>
+    printf(1, "thread_create failed\n");
+    1141:	83 ec 08             	sub    $0x8,%esp
+    1144:	68 cf 5b 00 00       	push   $0x5bcf
+    1149:	6a 01                	push   $0x1
+    114b:	e8 bc 41 00 00       	call   530c <printf>
+    1150:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1153:	e8 de 3f 00 00       	call   5136 <exit>
+  }
+  thread_join();
+    1158:	e8 bc 45 00 00       	call   5719 <thread_join>
+  if(vdsopid != 1){
+    115d:	a1 48 9e 00 00       	mov    0x9e48,%eax
+    1162:	83 f8 01             	cmp    $0x1,%eax
+    1165:	74 17                	je     117e <vdsotest+0x15f>
+    printf(1, "vgetpid wrong in thread\n");
+    1167:	83 ec 08             	sub    $0x8,%esp
+    116a:	68 79 5d 00 00       	push   $0x5d79
+    116f:	6a 01                	push   $0x1
+    1171:	e8 96 41 00 00       	call   530c <printf>
+    1176:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1179:	e8 b8 3f 00 00       	call   5136 <exit>
+  }
+  printf(1, "vdso ok\n");
+    117e:	83 ec 08             	sub    $0x8,%esp
+    1181:	68 92 5d 00 00       	push   $0x5d92
+    1186:	6a 01                	push   $0x1
+    1188:	e8 7f 41 00 00       	call   530c <printf>
+    118d:	83 c4 10             	add    $0x10,%esp
+}
+    1190:	90                   	nop
+    1191:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    1194:	c9                   	leave
+    1195:	c3                   	ret
+
+00001196 <ringwait>:
+struct ring ring, pollring;
+
+// Submit what is queued on r and take exactly n completions.
+void
+ringwait(struct ring *r, struct cqe *c, int n)
+{
+    1196:	55                   	push   %ebp
+    1197:	89 e5                	mov    %esp,%ebp
+    1199:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  if(ring_submit(r, n) < n){
+    119c:	83 ec 08             	sub    $0x8,%esp
+    119f:	ff 75 10             	push   0x10(%ebp)
+    11a2:	ff 75 08             	push   0x8(%ebp)
+    11a5:	e8 cb 3e 00 00       	call   5075 <ring_submit>
+    11aa:	83 c4 10             	add    $0x10,%esp
+    11ad:	39 45 10             	cmp    %eax,0x10(%ebp)
+    11b0:	7e 17                	jle    11c9 <ringwait+0x33>
+    printf(1, "ring_submit failed\n");
+    11b2:	83 ec 08             	sub    $0x8,%esp
+    11b5:	68 9b 5d 00 00       	push   $0x5d9b
+    11ba:	6a 01                	push   $0x1
+    11bc:	e8 4b 41 00 00       	call   530c <printf>
+    11c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    11c4:	e8 6d 3f 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < n; i++){
+    11c9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    11d0:	eb 55                	jmp    1227 <ringwait+0x91>
+    if(ring_reap(r, &c[i]) < 0 || c[i].data != i){
+    11d2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11d5:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    11dc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    11df:	01 d0                	add    %edx,%eax
+    11e1:	83 ec 08             	sub    $0x8,%esp
+    11e4:	50                   	push   %eax
+    11e5:	ff 75 08             	push   0x8(%ebp)
+    11e8:	e8 d5 3e 00 00       	call   50c2 <ring_reap>
+    11ed:	83 c4 10             	add    $0x10,%esp
+    11f0:	85 c0                	test   %eax,%eax
+    11f2:	78 18                	js     120c <ringwait+0x76>
+    11f4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    11f7:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    11fe:	8b 45 0c             	mov    0xc(%ebp),%eax
+    1201:	01 d0                	add    %edx,%eax
+    1203:	8b 10                	mov    (%eax),%edx
+    1205:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1208:	39 c2                	cmp    %eax,%edx
+    120a:	74 17                	je     1223 <ringwait+0x8d>
+      printf(1, "ring completion missing\n");
+    120c:	83 ec 08             	sub    $0x8,%esp
+    120f:	68 af 5d 00 00       	push   $0x5daf
+    1214:	6a 01                	push   $0x1
+    1216:	e8 f1 40 00 00       	call   530c <printf>
+    121b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    121e:	e8 13 3f 00 00       	call   5136 <exit>
+  for(i = 0; i < n; i++){
+    1223:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1227:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    122a:	3b 45 10             	cmp    0x10(%ebp),%eax
+    122d:	7c a3                	jl     11d2 <ringwait+0x3c>
+    }
+  }
+  if(ring_reap(r, &c[0]) == 0){
+    122f:	83 ec 08             	sub    $0x8,%esp
+    1232:	ff 75 0c             	push   0xc(%ebp)
+    1235:	ff 75 08             	push   0x8(%ebp)
+    1238:	e8 85 3e 00 00       	call   50c2 <ring_reap>
+    123d:	83 c4 10             	add    $0x10,%esp
+    1240:	85 c0                	test   %eax,%eax
+    1242:	75 17                	jne    125b <ringwait+0xc5>
+    printf(1, "ring completion extra\n");
+    1244:	83 ec 08             	sub    $0x8,%esp
+    1247:	68 c8 5d 00 00       	push   $0x5dc8
+    124c:	6a 01                	push   $0x1
+    124e:	e8 b9 40 00 00       	call   530c <printf>
+    1253:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1256:	e8 db 3e 00 00       	call   5136 <exit>
+  }
+}
+    125b:	90                   	nop
+    125c:	c9                   	leave
+    125d:	c3                   	ret
+
+0000125e <ringtest>:
+
+// file operations through the submission ring, with and
+// without a kernel thread polling it.
+void
+ringtest(void)
+{
+    125e:	55                   	push   %ebp
+    125f:	89 e5                	mov    %esp,%ebp
+    1261:	83 ec 48             	sub    $0x48,%esp
+  struct cqe c[4];
+  char buf[16];
+  int fd, fds[2], pid;
+
+  printf(1, "ring test\n");
+    1264:	83 ec 08             	sub    $0x8,%esp
+    1267:	68 df 5d 00 00       	push   $0x5ddf
+    126c:	6a 01                	push   $0x1
+    126e:	e8 99 40 00 00       	call   530c <printf>
+    1273:	83 c4 10             	add    $0x10,%esp
+  if(ring_setup(&ring, 0) != 0 || ring_setup(&ring, 0) != -1){
+    1276:	83 ec 08             	sub    $0x8,%esp
+    1279:	6a 00                	push   $0x0
+    127b:	68 60 9e 00 00       	push   $0x9e60
+    1280:	e8 9f 3f 00 00       	call   5224 <ring_setup>
+    1285:	83 c4 10             	add    $0x10,%esp
+    1288:	85 c0                	test   %eax,%eax
+    128a:	75 17                	jne    12a3 <ringtest+0x45>
+    128c:	83 ec 08             	sub    $0x8,%esp
+    128f:	6a 00                	push   $0x0
+    1291:	68 60 9e 00 00       	push   $0x9e60
+    1296:	e8 89 3f 00 00       	call   5224 <ring_setup>
+    129b:	83 c4 10             	add    $0x10,%esp
+    129e:	83 f8 ff             	cmp    $0xffffffff,%eax
+    12a1:	74 17                	je     12ba <ringtest+0x5c>
+    printf(1, "ring_setup failed\n");
+    12a3:	83 ec 08             	sub    $0x8,%esp
+    12a6:	68 ea 5d 00 00       	push   $0x5dea
+    12ab:	6a 01                	push   $0x1
+    12ad:	e8 5a 40 00 00       	call   530c <printf>
+    12b2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    12b5:	e8 7c 3e 00 00       	call   5136 <exit>
+  }
+  ring_queue(&ring, RING_OPEN, 0, "ringfile", O_CREATE|O_RDWR, 0);
+    12ba:	83 ec 08             	sub    $0x8,%esp
+    12bd:	6a 00                	push   $0x0
+    12bf:	68 02 02 00 00       	push   $0x202
+    12c4:	68 fd 5d 00 00       	push   $0x5dfd
+    12c9:	6a 00                	push   $0x0
+    12cb:	6a 03                	push   $0x3
+    12cd:	68 60 9e 00 00       	push   $0x9e60
+    12d2:	e8 15 3d 00 00       	call   4fec <ring_queue>
+    12d7:	83 c4 20             	add    $0x20,%esp
+  ringwait(&ring, c, 1);
+    12da:	83 ec 04             	sub    $0x4,%esp
+    12dd:	6a 01                	push   $0x1
+    12df:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    12e2:	50                   	push   %eax
+    12e3:	68 60 9e 00 00       	push   $0x9e60
+    12e8:	e8 a9 fe ff ff       	call   1196 <ringwait>
+    12ed:	83 c4 10             	add    $0x10,%esp
+  if((fd = c[0].res) < 0){
+    12f0:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    12f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    12f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    12fa:	79 17                	jns    1313 <ringtest+0xb5>
+    printf(1, "ring open failed\n");
+    12fc:	83 ec 08             	sub    $0x8,%esp
+    12ff:	68 06 5e 00 00       	push   $0x5e06
+    1304:	6a 01                	push   $0x1
+    1306:	e8 01 40 00 00       	call   530c <printf>
+    130b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    130e:	e8 23 3e 00 00       	call   5136 <exit>
+  }
+  ring_queue(&ring, RING_WRITE, fd, "0123456789", 10, 0);
+    1313:	83 ec 08             	sub    $0x8,%esp
+    1316:	6a 00                	push   $0x0
+    1318:	6a 0a                	push   $0xa
+    131a:	68 18 5e 00 00       	push   $0x5e18
+    131f:	ff 75 f4             	push   -0xc(%ebp)
+    1322:	6a 02                	push   $0x2
+    1324:	68 60 9e 00 00       	push   $0x9e60
+    1329:	e8 be 3c 00 00       	call   4fec <ring_queue>
+    132e:	83 c4 20             	add    $0x20,%esp
+  ring_queue(&ring, RING_CLOSE, fd, 0, 0, 1);
+    1331:	83 ec 08             	sub    $0x8,%esp
+    1334:	6a 01                	push   $0x1
+    1336:	6a 00                	push   $0x0
+    1338:	6a 00                	push   $0x0
+    133a:	ff 75 f4             	push   -0xc(%ebp)
+    133d:	6a 04                	push   $0x4
+    133f:	68 60 9e 00 00       	push   $0x9e60
+    1344:	e8 a3 3c 00 00       	call   4fec <ring_queue>
+    1349:	83 c4 20             	add    $0x20,%esp
+  ring_queue(&ring, RING_OPEN, 0, "ringfile", O_RDONLY, 2);
+    134c:	83 ec 08             	sub    $0x8,%esp
+    134f:	6a 02                	push   $0x2
+    1351:	6a 00                	push   $0x0
+    1353:	68 fd 5d 00 00       	push   $0x5dfd
+    1358:	6a 00                	push   $0x0
+    135a:	6a 03                	push   $0x3
+    135c:	68 60 9e 00 00       	push   $0x9e60
+    1361:	e8 86 3c 00 00       	call   4fec <ring_queue>
+    1366:	83 c4 20             	add    $0x20,%esp
+  ringwait(&ring, c, 3);
+    1369:	83 ec 04             	sub    $0x4,%esp
+    136c:	6a 03                	push   $0x3
+    136e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1371:	50                   	push   %eax
+    1372:	68 60 9e 00 00       	push   $0x9e60
+    1377:	e8 1a fe ff ff       	call   1196 <ringwait>
+    137c:	83 c4 10             	add    $0x10,%esp
+  if(c[0].res != 10 || c[1].res != 0 || (fd = c[2].res) < 0){
+    137f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1382:	83 f8 0a             	cmp    $0xa,%eax
+    1385:	75 13                	jne    139a <ringtest+0x13c>
+    1387:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    138a:	85 c0                	test   %eax,%eax
+    138c:	75 0c                	jne    139a <ringtest+0x13c>
+    138e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1391:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    1394:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1398:	79 17                	jns    13b1 <ringtest+0x153>
+    printf(1, "ring write failed\n");
+    139a:	83 ec 08             	sub    $0x8,%esp
+    139d:	68 23 5e 00 00       	push   $0x5e23
+    13a2:	6a 01                	push   $0x1
+    13a4:	e8 63 3f 00 00       	call   530c <printf>
+    13a9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    13ac:	e8 85 3d 00 00       	call   5136 <exit>
+  }
+  ring_queue(&ring, RING_READ, fd, buf, sizeof(buf), 0);
+    13b1:	83 ec 08             	sub    $0x8,%esp
+    13b4:	6a 00                	push   $0x0
+    13b6:	6a 10                	push   $0x10
+    13b8:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    13bb:	50                   	push   %eax
+    13bc:	ff 75 f4             	push   -0xc(%ebp)
+    13bf:	6a 01                	push   $0x1
+    13c1:	68 60 9e 00 00       	push   $0x9e60
+    13c6:	e8 21 3c 00 00       	call   4fec <ring_queue>
+    13cb:	83 c4 20             	add    $0x20,%esp
+  ring_queue(&ring, RING_CLOSE, fd, 0, 0, 1);
+    13ce:	83 ec 08             	sub    $0x8,%esp
+    13d1:	6a 01                	push   $0x1
+    13d3:	6a 00                	push   $0x0
+    13d5:	6a 00                	push   $0x0
+    13d7:	ff 75 f4             	push   -0xc(%ebp)
+    13da:	6a 04                	push   $0x4
+    13dc:	68 60 9e 00 00       	push   $0x9e60
+    13e1:	e8 06 3c 00 00       	call   4fec <ring_queue>
+    13e6:	83 c4 20             	add    $0x20,%esp
+  ring_queue(&ring, RING_READ, fd, buf, sizeof(buf), 2);
+    13e9:	83 ec 08             	sub    $0x8,%esp
+    13ec:	6a 02                	push   $0x2
+    13ee:	6a 10                	push   $0x10
+    13f0:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    13f3:	50                   	push   %eax
+    13f4:	ff 75 f4             	push   -0xc(%ebp)
+    13f7:	6a 01                	push   $0x1
+    13f9:	68 60 9e 00 00       	push   $0x9e60
+    13fe:	e8 e9 3b 00 00       	call   4fec <ring_queue>
+    1403:	83 c4 20             	add    $0x20,%esp
+  ring_queue(&ring, 99, 0, 0, 0, 3);
+    1406:	83 ec 08             	sub    $0x8,%esp
+    1409:	6a 03                	push   $0x3
+    140b:	6a 00                	push   $0x0
+    140d:	6a 00                	push   $0x0
+    140f:	6a 00                	push   $0x0
+    1411:	6a 63                	push   $0x63
+    1413:	68 60 9e 00 00       	push   $0x9e60
+    1418:	e8 cf 3b 00 00       	call   4fec <ring_queue>
+    141d:	83 c4 20             	add    $0x20,%esp
+  ringwait(&ring, c, 4);
+    1420:	83 ec 04             	sub    $0x4,%esp
+    1423:	6a 04                	push   $0x4
+    1425:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1428:	50                   	push   %eax
+    1429:	68 60 9e 00 00       	push   $0x9e60
+    142e:	e8 63 fd ff ff       	call   1196 <ringwait>
+    1433:	83 c4 10             	add    $0x10,%esp
+  buf[10] = 0;
+    1436:	c6 45 ca 00          	movb   $0x0,-0x36(%ebp)
+  if(c[0].res != 10 || strcmp(buf, "0123456789") != 0 || c[1].res != 0 ||
+    143a:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    143d:	83 f8 0a             	cmp    $0xa,%eax
+    1440:	75 2f                	jne    1471 <ringtest+0x213>
+    1442:	83 ec 08             	sub    $0x8,%esp
+    1445:	68 18 5e 00 00       	push   $0x5e18
+    144a:	8d 45 c0             	lea    -0x40(%ebp),%eax
+    144d:	50                   	push   %eax
+    144e:	e8 39 37 00 00       	call   4b8c <strcmp>
+    1453:	83 c4 10             	add    $0x10,%esp
+    1456:	85 c0                	test   %eax,%eax
+    1458:	75 17                	jne    1471 <ringtest+0x213>
+    145a:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    145d:	85 c0                	test   %eax,%eax
+    145f:	75 10                	jne    1471 <ringtest+0x213>
+     c[2].res != -1 || c[3].res != -1){
+    1461:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+  if(c[0].res != 10 || strcmp(buf, "0123456789") != 0 || c[1].res != 0 ||
+    1464:	83 f8 ff             	cmp    $0xffffffff,%eax
+    1467:	75 08                	jne    1471 <ringtest+0x213>
+     c[2].res != -1 || c[3].res != -1){
+    1469:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    146c:	83 f8 ff             	cmp    $0xffffffff,%eax
+    146f:	74 17                	je     1488 <ringtest+0x22a>
+    printf(1, "ring read failed\n");
+    1471:	83 ec 08             	sub    $0x8,%esp
+    1474:	68 36 5e 00 00       	push   $0x5e36
+    1479:	6a 01                	push   $0x1
+    147b:	e8 8c 3e 00 00       	call   530c <printf>
+    1480:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1483:	e8 ae 3c 00 00       	call   5136 <exit>
+  }
+  unlink("ringfile");
+    1488:	83 ec 0c             	sub    $0xc,%esp
+    148b:	68 fd 5d 00 00       	push   $0x5dfd
+    1490:	e8 e7 3c 00 00       	call   517c <unlink>
+    1495:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+    1498:	e8 92 3c 00 00       	call   512f <fork>
+    149d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    14a0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    14a4:	0f 85 19 01 00 00    	jne    15c3 <ringtest+0x365>
+    if(ring_setup(&pollring, RING_SQPOLL) != 0 || pipe(fds) != 0){
+    14aa:	83 ec 08             	sub    $0x8,%esp
+    14ad:	6a 01                	push   $0x1
+    14af:	68 00 a2 00 00       	push   $0xa200
+    14b4:	e8 6b 3d 00 00       	call   5224 <ring_setup>
+    14b9:	83 c4 10             	add    $0x10,%esp
+    14bc:	85 c0                	test   %eax,%eax
+    14be:	75 13                	jne    14d3 <ringtest+0x275>
+    14c0:	83 ec 0c             	sub    $0xc,%esp
+    14c3:	8d 45 b8             	lea    -0x48(%ebp),%eax
+    14c6:	50                   	push   %eax
+    14c7:	e8 78 3c 00 00       	call   5144 <pipe>
+    14cc:	83 c4 10             	add    $0x10,%esp
+    14cf:	85 c0                	test   %eax,%eax
+    14d1:	74 17                	je     14ea <ringtest+0x28c>
+      printf(1, "ring_setup RING_SQPOLL failed\n");
+    14d3:	83 ec 08             	sub    $0x8,%esp
+    14d6:	68 48 5e 00 00       	push   $0x5e48
+    14db:	6a 01                	push   $0x1
+    14dd:	e8 2a 3e 00 00       	call   530c <printf>
+    14e2:	83 c4 10             	add    $0x10,%esp
+      exit();
+    14e5:	e8 4c 3c 00 00       	call   5136 <exit>
+    }
+    ring_queue(&pollring, RING_WRITE, fds[1], "x", 1, 0);
+    14ea:	8b 45 bc             	mov    -0x44(%ebp),%eax
+    14ed:	83 ec 08             	sub    $0x8,%esp
+    14f0:	6a 00                	push   $0x0
+    14f2:	6a 01                	push   $0x1
+    14f4:	68 c0 5b 00 00       	push   $0x5bc0
+    14f9:	50                   	push   %eax
+    14fa:	6a 02                	push   $0x2
+    14fc:	68 00 a2 00 00       	push   $0xa200
+    1501:	e8 e6 3a 00 00       	call   4fec <ring_queue>
+    1506:	83 c4 20             	add    $0x20,%esp
+    ringwait(&pollring, c, 1);
+    1509:	83 ec 04             	sub    $0x4,%esp
+    150c:	6a 01                	push   $0x1
+    150e:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    1511:	50                   	push   %eax
+    1512:	68 00 a2 00 00       	push   $0xa200
+    1517:	e8 7a fc ff ff       	call   1196 <ringwait>
+    151c:	83 c4 10             	add    $0x10,%esp
+    if(c[0].res != 1 || read(fds[0], buf, 1) != 1 || buf[0] != 'x'){
+    151f:	8b 45 d4             	mov    -0x2c(%ebp),%eax
+    1522:	83 f8 01             	cmp    $0x1,%eax
+    1525:	75 22                	jne    1549 <ringtest+0x2eb>
+    1527:	8b 45 b8             	mov    -0x48(%ebp),%eax
+    152a:	83 ec 04             	sub    $0x4,%esp
+    152d:	6a 01                	push   $0x1
+    152f:	8d 55 c0             	lea    -0x40(%ebp),%edx
+    1532:	52                   	push   %edx
+    1533:	50                   	push   %eax
+    1534:	e8 12 3c 00 00       	call   514b <read>
+    1539:	83 c4 10             	add    $0x10,%esp
+    153c:	83 f8 01             	cmp    $0x1,%eax
+    153f:	75 08                	jne    1549 <ringtest+0x2eb>
+    1541:	0f b6 45 c0          	movzbl -0x40(%ebp),%eax
+    1545:	3c 78                	cmp    $0x78,%al
+    1547:	74 17                	je     1560 <ringtest+0x302>
+      printf(1, "ring poller write failed\n");
+    1549:	83 ec 08             	sub    $0x8,%esp
+    154c:	68 67 5e 00 00       	push   $0x5e67
+    1551:	6a 01                	push   $0x1
+    1553:	e8 b4 3d 00 00       	call   530c <printf>
+    1558:	83 c4 10             	add    $0x10,%esp
+      exit();
+    155b:	e8 d6 3b 00 00       	call   5136 <exit>
+    }
+    sleep(10);  // let the poller go to sleep
+    1560:	83 ec 0c             	sub    $0xc,%esp
+    1563:	6a 0a                	push   $0xa
+    1565:	e8 56 3c 00 00       	call   51c0 <sleep>
+    156a:	83 c4 10             	add    $0x10,%esp
+    ring_queue(&pollring, RING_NOP, 0, 0, 0, 0);
+    156d:	83 ec 08             	sub    $0x8,%esp
+    1570:	6a 00                	push   $0x0
+    1572:	6a 00                	push   $0x0
+    1574:	6a 00                	push   $0x0
+    1576:	6a 00                	push   $0x0
+    1578:	6a 00                	push   $0x0
+    157a:	68 00 a2 00 00       	push   $0xa200
+    157f:	e8 68 3a 00 00       	call   4fec <ring_queue>
+    1584:	83 c4 20             	add    $0x20,%esp
+    ringwait(&pollring, c, 1);
+    1587:	83 ec 04             	sub    $0x4,%esp
+    158a:	6a 01                	push   $0x1
+    158c:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    158f:	50                   	push   %eax
+    1590:	68 00 a2 00 00       	push   $0xa200
+    1595:	e8 fc fb ff ff       	call   1196 <ringwait>
+    159a:	83 c4 10             	add    $0x10,%esp
+    if(thread_join() != -1){
+    159d:	e8 77 41 00 00       	call   5719 <thread_join>
+    15a2:	83 f8 ff             	cmp    $0xffffffff,%eax
+    15a5:	74 17                	je     15be <ringtest+0x360>
+      printf(1, "thread_join returned the ring poller\n");
+    15a7:	83 ec 08             	sub    $0x8,%esp
+    15aa:	68 84 5e 00 00       	push   $0x5e84
+    15af:	6a 01                	push   $0x1
+    15b1:	e8 56 3d 00 00       	call   530c <printf>
+    15b6:	83 c4 10             	add    $0x10,%esp
+      exit();
+    15b9:	e8 78 3b 00 00       	call   5136 <exit>
+    }
+    exit();
+    15be:	e8 73 3b 00 00       	call   5136 <exit>
+  }
+  if(wait() != pid){
+    15c3:	e8 75 3b 00 00       	call   513d <wait>
+    15c8:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    15cb:	74 17                	je     15e4 <ringtest+0x386>
+    printf(1, "ring poller did not exit\n");
+    15cd:	83 ec 08             	sub    $0x8,%esp
+    15d0:	68 aa 5e 00 00       	push   $0x5eaa
+    15d5:	6a 01                	push   $0x1
+    15d7:	e8 30 3d 00 00       	call   530c <printf>
+    15dc:	83 c4 10             	add    $0x10,%esp
+    exit();
+    15df:	e8 52 3b 00 00       	call   5136 <exit>
+  }
+  printf(1, "ring ok\n");
+    15e4:	83 ec 08             	sub    $0x8,%esp
+    15e7:	68 c4 5e 00 00       	push   $0x5ec4
+    15ec:	6a 01                	push   $0x1
+    15ee:	e8 19 3d 00 00       	call   530c <printf>
+    15f3:	83 c4 10             	add    $0x10,%esp
+}
+    15f6:	90                   	nop
+    15f7:	c9                   	leave
+    15f8:	c3                   	ret
+
+000015f9 <xmm0is>:
+
+static int
+xmm0is(uint *v)
+{
+    15f9:	55                   	push   %ebp
+    15fa:	89 e5                	mov    %esp,%ebp
+    15fc:	83 ec 20             	sub    $0x20,%esp
+  uint x[4];
+  int i;
+
+  asm volatile("movups %%xmm0, %0" : "=m" (x));
+    15ff:	0f 11 45 ec          	movups %xmm0,-0x14(%ebp)
+  for(i = 0; i < 4; i++)
+    1603:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    160a:	eb 27                	jmp    1633 <xmm0is+0x3a>
+    if(x[i] != v[i])
+    160c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    160f:	8b 54 85 ec          	mov    -0x14(%ebp,%eax,4),%edx
+    1613:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    1616:	8d 0c 85 00 00 00 00 	lea    0x0(,%eax,4),%ecx
+    161d:	8b 45 08             	mov    0x8(%ebp),%eax
+    1620:	01 c8                	add    %ecx,%eax
+    1622:	8b 00                	mov    (%eax),%eax
+    1624:	39 c2                	cmp    %eax,%edx
+    1626:	74 07                	je     162f <xmm0is+0x36>
+      return 0;
+    1628:	b8 00 00 00 00       	mov    $0x0,%eax
+    162d:	eb 0f                	jmp    163e <xmm0is+0x45>
+  for(i = 0; i < 4; i++)
+    162f:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    1633:	83 7d fc 03          	cmpl   $0x3,-0x4(%ebp)
+    1637:	7e d3                	jle    160c <xmm0is+0x13>
+  return 1;
+    1639:	b8 01 00 00 00       	mov    $0x1,%eax
+}
+    163e:	c9                   	leave
+    163f:	c3                   	ret
+
+00001640 <fputest>:
+
+// SSE registers survive context switches, and fork copies them.
+void
+fputest(void)
+{
+    1640:	55                   	push   %ebp
+    1641:	89 e5                	mov    %esp,%ebp
+    1643:	83 ec 38             	sub    $0x38,%esp
+  uint a[4], b[4];
+  int i, pid;
+
+  printf(1, "fpu test\n");
+    1646:	83 ec 08             	sub    $0x8,%esp
+    1649:	68 cd 5e 00 00       	push   $0x5ecd
+    164e:	6a 01                	push   $0x1
+    1650:	e8 b7 3c 00 00       	call   530c <printf>
+    1655:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 4; i++){
+    1658:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    165f:	eb 27                	jmp    1688 <fputest+0x48>
+    a[i] = 0x12345678 + i;
+    1661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1664:	05 78 56 34 12       	add    $0x12345678,%eax
+    1669:	89 c2                	mov    %eax,%edx
+    166b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    166e:	89 54 85 e0          	mov    %edx,-0x20(%ebp,%eax,4)
+    b[i] = ~a[i];
+    1672:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1675:	8b 44 85 e0          	mov    -0x20(%ebp,%eax,4),%eax
+    1679:	f7 d0                	not    %eax
+    167b:	89 c2                	mov    %eax,%edx
+    167d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1680:	89 54 85 d0          	mov    %edx,-0x30(%ebp,%eax,4)
+  for(i = 0; i < 4; i++){
+    1684:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1688:	83 7d f4 03          	cmpl   $0x3,-0xc(%ebp)
+    168c:	7e d3                	jle    1661 <fputest+0x21>
+  }
+  asm volatile("movups %0, %%xmm0" : : "m" (a));
+    168e:	0f 10 45 e0          	movups -0x20(%ebp),%xmm0
+  pid = fork();
+    1692:	e8 98 3a 00 00       	call   512f <fork>
+    1697:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+    169a:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    169e:	79 17                	jns    16b7 <fputest+0x77>
+    printf(1, "fork failed\n");
+    16a0:	83 ec 08             	sub    $0x8,%esp
+    16a3:	68 f8 5a 00 00       	push   $0x5af8
+    16a8:	6a 01                	push   $0x1
+    16aa:	e8 5d 3c 00 00       	call   530c <printf>
+    16af:	83 c4 10             	add    $0x10,%esp
+    exit();
+    16b2:	e8 7f 3a 00 00       	call   5136 <exit>
+  }
+  if(pid == 0){
+    16b7:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    16bb:	75 60                	jne    171d <fputest+0xdd>
+    if(!xmm0is(a))
+    16bd:	83 ec 0c             	sub    $0xc,%esp
+    16c0:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    16c3:	50                   	push   %eax
+    16c4:	e8 30 ff ff ff       	call   15f9 <xmm0is>
+    16c9:	83 c4 10             	add    $0x10,%esp
+    16cc:	85 c0                	test   %eax,%eax
+    16ce:	75 12                	jne    16e2 <fputest+0xa2>
+      printf(1, "fork lost SSE state\n");
+    16d0:	83 ec 08             	sub    $0x8,%esp
+    16d3:	68 d7 5e 00 00       	push   $0x5ed7
+    16d8:	6a 01                	push   $0x1
+    16da:	e8 2d 3c 00 00       	call   530c <printf>
+    16df:	83 c4 10             	add    $0x10,%esp
+    asm volatile("movups %0, %%xmm0" : : "m" (b));
+    16e2:	0f 10 45 d0          	movups -0x30(%ebp),%xmm0
+    sleep(2);
+    16e6:	83 ec 0c             	sub    $0xc,%esp
+    16e9:	6a 02                	push   $0x2
+    16eb:	e8 d0 3a 00 00       	call   51c0 <sleep>
+    16f0:	83 c4 10             	add    $0x10,%esp
+    if(!xmm0is(b))
+    16f3:	83 ec 0c             	sub    $0xc,%esp
+    16f6:	8d 45 d0             	lea    -0x30(%ebp),%eax
+    16f9:	50                   	push   %eax
+    16fa:	e8 fa fe ff ff       	call   15f9 <xmm0is>
+    16ff:	83 c4 10             	add    $0x10,%esp
+    1702:	85 c0                	test   %eax,%eax
+    1704:	75 12                	jne    1718 <fputest+0xd8>
+      printf(1, "child lost SSE state\n");
+    1706:	83 ec 08             	sub    $0x8,%esp
+    1709:	68 ec 5e 00 00       	push   $0x5eec
+    170e:	6a 01                	push   $0x1
+    1710:	e8 f7 3b 00 00       	call   530c <printf>
+    1715:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1718:	e8 19 3a 00 00       	call   5136 <exit>
+  }
+  sleep(1);
+    171d:	83 ec 0c             	sub    $0xc,%esp
+    1720:	6a 01                	push   $0x1
+    1722:	e8 99 3a 00 00       	call   51c0 <sleep>
+    1727:	83 c4 10             	add    $0x10,%esp
+  if(!xmm0is(a)){
+    172a:	83 ec 0c             	sub    $0xc,%esp
+    172d:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    1730:	50                   	push   %eax
+    1731:	e8 c3 fe ff ff       	call   15f9 <xmm0is>
+    1736:	83 c4 10             	add    $0x10,%esp
+    1739:	85 c0                	test   %eax,%eax
+    173b:	75 17                	jne    1754 <fputest+0x114>
+    printf(1, "parent lost SSE state\n");
+    173d:	83 ec 08             	sub    $0x8,%esp
+    1740:	68 02 5f 00 00       	push   $0x5f02
+    1745:	6a 01                	push   $0x1
+    1747:	e8 c0 3b 00 00       	call   530c <printf>
+    174c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    174f:	e8 e2 39 00 00       	call   5136 <exit>
+  }
+  wait();
+    1754:	e8 e4 39 00 00       	call   513d <wait>
+  if(!xmm0is(a)){
+    1759:	83 ec 0c             	sub    $0xc,%esp
+    175c:	8d 45 e0             	lea    -0x20(%ebp),%eax
+    175f:	50                   	push   %eax
+    1760:	e8 94 fe ff ff       	call   15f9 <xmm0is>
+    1765:	83 c4 10             	add    $0x10,%esp
+    1768:	85 c0                	test   %eax,%eax
+    176a:	75 17                	jne    1783 <fputest+0x143>
+    printf(1, "parent lost SSE state after wait\n");
+    176c:	83 ec 08             	sub    $0x8,%esp
+    176f:	68 1c 5f 00 00       	push   $0x5f1c
+    1774:	6a 01                	push   $0x1
+    1776:	e8 91 3b 00 00       	call   530c <printf>
+    177b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    177e:	e8 b3 39 00 00       	call   5136 <exit>
+  }
+  printf(1, "fpu ok\n");
+    1783:	83 ec 08             	sub    $0x8,%esp
+    1786:	68 3e 5f 00 00       	push   $0x5f3e
+    178b:	6a 01                	push   $0x1
+    178d:	e8 7a 3b 00 00       	call   530c <printf>
+    1792:	83 c4 10             	add    $0x10,%esp
+}
+    1795:	90                   	nop
+    1796:	c9                   	leave
+    1797:	c3                   	ret
+
+00001798 <preempt>:
+
+// meant to be run w/ at most two CPUs
+void
+preempt(void)
+{
+    1798:	55                   	push   %ebp
+    1799:	89 e5                	mov    %esp,%ebp
+    179b:	83 ec 28             	sub    $0x28,%esp
+  int pid1, pid2, pid3;
+  int pfds[2];
+
+  printf(1, "preempt: ");
+    179e:	83 ec 08             	sub    $0x8,%esp
+    17a1:	68 46 5f 00 00       	push   $0x5f46
+    17a6:	6a 01                	push   $0x1
+    17a8:	e8 5f 3b 00 00       	call   530c <printf>
+    17ad:	83 c4 10             	add    $0x10,%esp
+  pid1 = fork();
+    17b0:	e8 7a 39 00 00       	call   512f <fork>
+    17b5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(pid1 == 0)
+    17b8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    17bc:	75 03                	jne    17c1 <preempt+0x29>
+    for(;;)
+    17be:	90                   	nop
+    17bf:	eb fd                	jmp    17be <preempt+0x26>
+      ;
+
+  pid2 = fork();
+    17c1:	e8 69 39 00 00       	call   512f <fork>
+    17c6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid2 == 0)
+    17c9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    17cd:	75 03                	jne    17d2 <preempt+0x3a>
+    for(;;)
+    17cf:	90                   	nop
+    17d0:	eb fd                	jmp    17cf <preempt+0x37>
+      ;
+
+  pipe(pfds);
+    17d2:	83 ec 0c             	sub    $0xc,%esp
+    17d5:	8d 45 e4             	lea    -0x1c(%ebp),%eax
+    17d8:	50                   	push   %eax
+    17d9:	e8 66 39 00 00       	call   5144 <pipe>
+    17de:	83 c4 10             	add    $0x10,%esp
+  pid3 = fork();
+    17e1:	e8 49 39 00 00       	call   512f <fork>
+    17e6:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid3 == 0){
+    17e9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    17ed:	75 4e                	jne    183d <preempt+0xa5>
+    close(pfds[0]);
+    17ef:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    17f2:	83 ec 0c             	sub    $0xc,%esp
+    17f5:	50                   	push   %eax
+    17f6:	e8 5e 39 00 00       	call   5159 <close>
+    17fb:	83 c4 10             	add    $0x10,%esp
+    if(write(pfds[1], "x", 1) != 1)
+    17fe:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1801:	83 ec 04             	sub    $0x4,%esp
+    1804:	6a 01                	push   $0x1
+    1806:	68 c0 5b 00 00       	push   $0x5bc0
+    180b:	50                   	push   %eax
+    180c:	e8 41 39 00 00       	call   5152 <write>
+    1811:	83 c4 10             	add    $0x10,%esp
+    1814:	83 f8 01             	cmp    $0x1,%eax
+    1817:	74 12                	je     182b <preempt+0x93>
+      printf(1, "preempt write error");
+    1819:	83 ec 08             	sub    $0x8,%esp
+    181c:	68 50 5f 00 00       	push   $0x5f50
+    1821:	6a 01                	push   $0x1
+    1823:	e8 e4 3a 00 00       	call   530c <printf>
+    1828:	83 c4 10             	add    $0x10,%esp
+    close(pfds[1]);
+    182b:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    182e:	83 ec 0c             	sub    $0xc,%esp
+    1831:	50                   	push   %eax
+    1832:	e8 22 39 00 00       	call   5159 <close>
+    1837:	83 c4 10             	add    $0x10,%esp
+    for(;;)
+    183a:	90                   	nop
+    183b:	eb fd                	jmp    183a <preempt+0xa2>
+      ;
+  }
+
+  close(pfds[1]);
+    183d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    1840:	83 ec 0c             	sub    $0xc,%esp
+    1843:	50                   	push   %eax
+    1844:	e8 10 39 00 00       	call   5159 <close>
+    1849:	83 c4 10             	add    $0x10,%esp
+  if(read(pfds[0], buf, sizeof(buf)) != 1){
+    184c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    184f:	83 ec 04             	sub    $0x4,%esp
+    1852:	68 00 20 00 00       	push   $0x2000
+    1857:	68 20 7e 00 00       	push   $0x7e20
+    185c:	50                   	push   %eax
+    185d:	e8 e9 38 00 00       	call   514b <read>
+    1862:	83 c4 10             	add    $0x10,%esp
+    1865:	83 f8 01             	cmp    $0x1,%eax
+    1868:	74 14                	je     187e <preempt+0xe6>
+    printf(1, "preempt read error");
+    186a:	83 ec 08             	sub    $0x8,%esp
+    186d:	68 64 5f 00 00       	push   $0x5f64
+    1872:	6a 01                	push   $0x1
+    1874:	e8 93 3a 00 00       	call   530c <printf>
+    1879:	83 c4 10             	add    $0x10,%esp
+    187c:	eb 7e                	jmp    18fc <preempt+0x164>
+    return;
+  }
+  close(pfds[0]);
+    187e:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    1881:	83 ec 0c             	sub    $0xc,%esp
+    1884:	50                   	push   %eax
+    1885:	e8 cf 38 00 00       	call   5159 <close>
+    188a:	83 c4 10             	add    $0x10,%esp
+  printf(1, "kill... ");
+    188d:	83 ec 08             	sub    $0x8,%esp
+    1890:	68 77 5f 00 00       	push   $0x5f77
+    1895:	6a 01                	push   $0x1
+    1897:	e8 70 3a 00 00       	call   530c <printf>
+    189c:	83 c4 10             	add    $0x10,%esp
+  kill(pid1);
+    189f:	83 ec 0c             	sub    $0xc,%esp
+    18a2:	ff 75 f4             	push   -0xc(%ebp)
+    18a5:	e8 b6 38 00 00       	call   5160 <kill>
+    18aa:	83 c4 10             	add    $0x10,%esp
+  kill(pid2);
+    18ad:	83 ec 0c             	sub    $0xc,%esp
+    18b0:	ff 75 f0             	push   -0x10(%ebp)
+    18b3:	e8 a8 38 00 00       	call   5160 <kill>
+    18b8:	83 c4 10             	add    $0x10,%esp
+  kill(pid3);
+    18bb:	83 ec 0c             	sub    $0xc,%esp
+    18be:	ff 75 ec             	push   -0x14(%ebp)
+    18c1:	e8 9a 38 00 00       	call   5160 <kill>
+    18c6:	83 c4 10             	add    $0x10,%esp
+  printf(1, "wait... ");
+    18c9:	83 ec 08             	sub    $0x8,%esp
+    18cc:	68 80 5f 00 00       	push   $0x5f80
+    18d1:	6a 01                	push   $0x1
+    18d3:	e8 34 3a 00 00       	call   530c <printf>
+    18d8:	83 c4 10             	add    $0x10,%esp
+  wait();
+    18db:	e8 5d 38 00 00       	call   513d <wait>
+  wait();
+    18e0:	e8 58 38 00 00       	call   513d <wait>
+  wait();
+    18e5:	e8 53 38 00 00       	call   513d <wait>
+  printf(1, "preempt ok\n");
+    18ea:	83 ec 08             	sub    $0x8,%esp
+    18ed:	68 89 5f 00 00       	push   $0x5f89
+    18f2:	6a 01                	push   $0x1
+    18f4:	e8 13 3a 00 00       	call   530c <printf>
+    18f9:	83 c4 10             	add    $0x10,%esp
+}
+    18fc:	c9                   	leave
+    18fd:	c3                   	ret
+
+000018fe <exitwait>:
+
+// try to find any races between exit and wait
+void
+exitwait(void)
+{
+    18fe:	55                   	push   %ebp
+    18ff:	89 e5                	mov    %esp,%ebp
+    1901:	83 ec 18             	sub    $0x18,%esp
+  int i, pid;
+
+  for(i = 0; i < 100; i++){
+    1904:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    190b:	eb 4f                	jmp    195c <exitwait+0x5e>
+    pid = fork();
+    190d:	e8 1d 38 00 00       	call   512f <fork>
+    1912:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0){
+    1915:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1919:	79 14                	jns    192f <exitwait+0x31>
+      printf(1, "fork failed\n");
+    191b:	83 ec 08             	sub    $0x8,%esp
+    191e:	68 f8 5a 00 00       	push   $0x5af8
+    1923:	6a 01                	push   $0x1
+    1925:	e8 e2 39 00 00       	call   530c <printf>
+    192a:	83 c4 10             	add    $0x10,%esp
+      return;
+    192d:	eb 45                	jmp    1974 <exitwait+0x76>
+    }
+    if(pid){
+    192f:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1933:	74 1e                	je     1953 <exitwait+0x55>
+      if(wait() != pid){
+    1935:	e8 03 38 00 00       	call   513d <wait>
+    193a:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    193d:	74 19                	je     1958 <exitwait+0x5a>
+        printf(1, "wait wrong pid\n");
+    193f:	83 ec 08             	sub    $0x8,%esp
+    1942:	68 95 5f 00 00       	push   $0x5f95
+    1947:	6a 01                	push   $0x1
+    1949:	e8 be 39 00 00       	call   530c <printf>
+    194e:	83 c4 10             	add    $0x10,%esp
+        return;
+    1951:	eb 21                	jmp    1974 <exitwait+0x76>
+      }
+    } else {
+      exit();
+    1953:	e8 de 37 00 00       	call   5136 <exit>
+  for(i = 0; i < 100; i++){
+    1958:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    195c:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    1960:	7e ab                	jle    190d <exitwait+0xf>
+    }
+  }
+  printf(1, "exitwait ok\n");
+    1962:	83 ec 08             	sub    $0x8,%esp
+    1965:	68 a5 5f 00 00       	push   $0x5fa5
+    196a:	6a 01                	push   $0x1
+    196c:	e8 9b 39 00 00       	call   530c <printf>
+    1971:	83 c4 10             	add    $0x10,%esp
+}
+    1974:	c9                   	leave
+    1975:	c3                   	ret
+
+00001976 <mem>:
+
+void
+mem(void)
+{
+    1976:	55                   	push   %ebp
+    1977:	89 e5                	mov    %esp,%ebp
+    1979:	83 ec 18             	sub    $0x18,%esp
+  void *m1, *m2;
+  int pid, ppid;
+
+  printf(1, "mem test\n");
+    197c:	83 ec 08             	sub    $0x8,%esp
+    197f:	68 b2 5f 00 00       	push   $0x5fb2
+    1984:	6a 01                	push   $0x1
+    1986:	e8 81 39 00 00       	call   530c <printf>
+    198b:	83 c4 10             	add    $0x10,%esp
+  ppid = getpid();
+    198e:	e8 19 38 00 00       	call   51ac <getpid>
+    1993:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if((pid = fork()) == 0){
+    1996:	e8 94 37 00 00       	call   512f <fork>
+    199b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    199e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    19a2:	0f 85 b7 00 00 00    	jne    1a5f <mem+0xe9>
+    m1 = 0;
+    19a8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    19af:	eb 0e                	jmp    19bf <mem+0x49>
+      *(char**)m2 = m1;
+    19b1:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    19b4:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    19b7:	89 10                	mov    %edx,(%eax)
+      m1 = m2;
+    19b9:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    19bc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while((m2 = malloc(10001)) != 0){
+    19bf:	83 ec 0c             	sub    $0xc,%esp
+    19c2:	68 11 27 00 00       	push   $0x2711
+    19c7:	e8 14 3c 00 00       	call   55e0 <malloc>
+    19cc:	83 c4 10             	add    $0x10,%esp
+    19cf:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    19d2:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    19d6:	75 d9                	jne    19b1 <mem+0x3b>
+    }
+    while(m1){
+    19d8:	eb 1c                	jmp    19f6 <mem+0x80>
+      m2 = *(char**)m1;
+    19da:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    19dd:	8b 00                	mov    (%eax),%eax
+    19df:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      free(m1);
+    19e2:	83 ec 0c             	sub    $0xc,%esp
+    19e5:	ff 75 f4             	push   -0xc(%ebp)
+    19e8:	e8 b1 3a 00 00       	call   549e <free>
+    19ed:	83 c4 10             	add    $0x10,%esp
+      m1 = m2;
+    19f0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    19f3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    while(m1){
+    19f6:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    19fa:	75 de                	jne    19da <mem+0x64>
+    }
+    m1 = malloc(1024*20);
+    19fc:	83 ec 0c             	sub    $0xc,%esp
+    19ff:	68 00 50 00 00       	push   $0x5000
+    1a04:	e8 d7 3b 00 00       	call   55e0 <malloc>
+    1a09:	83 c4 10             	add    $0x10,%esp
+    1a0c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(m1 == 0){
+    1a0f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1a13:	75 25                	jne    1a3a <mem+0xc4>
+      printf(1, "couldn't allocate mem?!!\n");
+    1a15:	83 ec 08             	sub    $0x8,%esp
+    1a18:	68 bc 5f 00 00       	push   $0x5fbc
+    1a1d:	6a 01                	push   $0x1
+    1a1f:	e8 e8 38 00 00       	call   530c <printf>
+    1a24:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    1a27:	83 ec 0c             	sub    $0xc,%esp
+    1a2a:	ff 75 f0             	push   -0x10(%ebp)
+    1a2d:	e8 2e 37 00 00       	call   5160 <kill>
+    1a32:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1a35:	e8 fc 36 00 00       	call   5136 <exit>
+    }
+    free(m1);
+    1a3a:	83 ec 0c             	sub    $0xc,%esp
+    1a3d:	ff 75 f4             	push   -0xc(%ebp)
+    1a40:	e8 59 3a 00 00       	call   549e <free>
+    1a45:	83 c4 10             	add    $0x10,%esp
+    printf(1, "mem ok\n");
+    1a48:	83 ec 08             	sub    $0x8,%esp
+    1a4b:	68 d6 5f 00 00       	push   $0x5fd6
+    1a50:	6a 01                	push   $0x1
+    1a52:	e8 b5 38 00 00       	call   530c <printf>
+    1a57:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1a5a:	e8 d7 36 00 00       	call   5136 <exit>
+  } else {
+    wait();
+    1a5f:	e8 d9 36 00 00       	call   513d <wait>
+  }
+}
+    1a64:	90                   	nop
+    1a65:	c9                   	leave
+    1a66:	c3                   	ret
+
+00001a67 <sharedfd>:
+
+// two processes write to the same file descriptor
+// is the offset shared? does inode locking work?
+void
+sharedfd(void)
+{
+    1a67:	55                   	push   %ebp
+    1a68:	89 e5                	mov    %esp,%ebp
+    1a6a:	83 ec 38             	sub    $0x38,%esp
+  int fd, pid, i, n, nc, np;
+  char buf[10];
+
+  printf(1, "sharedfd test\n");
+    1a6d:	83 ec 08             	sub    $0x8,%esp
+    1a70:	68 de 5f 00 00       	push   $0x5fde
+    1a75:	6a 01                	push   $0x1
+    1a77:	e8 90 38 00 00       	call   530c <printf>
+    1a7c:	83 c4 10             	add    $0x10,%esp
+
+  unlink("sharedfd");
+    1a7f:	83 ec 0c             	sub    $0xc,%esp
+    1a82:	68 ed 5f 00 00       	push   $0x5fed
+    1a87:	e8 f0 36 00 00       	call   517c <unlink>
+    1a8c:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", O_CREATE|O_RDWR);
+    1a8f:	83 ec 08             	sub    $0x8,%esp
+    1a92:	68 02 02 00 00       	push   $0x202
+    1a97:	68 ed 5f 00 00       	push   $0x5fed
+    1a9c:	e8 cd 36 00 00       	call   516e <open>
+    1aa1:	83 c4 10             	add    $0x10,%esp
+    1aa4:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1aa7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1aab:	79 17                	jns    1ac4 <sharedfd+0x5d>
+    printf(1, "fstests: cannot open sharedfd for writing");
+    1aad:	83 ec 08             	sub    $0x8,%esp
+    1ab0:	68 f8 5f 00 00       	push   $0x5ff8
+    1ab5:	6a 01                	push   $0x1
+    1ab7:	e8 50 38 00 00       	call   530c <printf>
+    1abc:	83 c4 10             	add    $0x10,%esp
+    return;
+    1abf:	e9 84 01 00 00       	jmp    1c48 <sharedfd+0x1e1>
+  }
+  pid = fork();
+    1ac4:	e8 66 36 00 00       	call   512f <fork>
+    1ac9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  memset(buf, pid==0?'c':'p', sizeof(buf));
+    1acc:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1ad0:	75 07                	jne    1ad9 <sharedfd+0x72>
+    1ad2:	b8 63 00 00 00       	mov    $0x63,%eax
+    1ad7:	eb 05                	jmp    1ade <sharedfd+0x77>
+    1ad9:	b8 70 00 00 00       	mov    $0x70,%eax
+    1ade:	83 ec 04             	sub    $0x4,%esp
+    1ae1:	6a 0a                	push   $0xa
+    1ae3:	50                   	push   %eax
+    1ae4:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1ae7:	50                   	push   %eax
+    1ae8:	e8 05 31 00 00       	call   4bf2 <memset>
+    1aed:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 1000; i++){
+    1af0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1af7:	eb 31                	jmp    1b2a <sharedfd+0xc3>
+    if(write(fd, buf, sizeof(buf)) != sizeof(buf)){
+    1af9:	83 ec 04             	sub    $0x4,%esp
+    1afc:	6a 0a                	push   $0xa
+    1afe:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1b01:	50                   	push   %eax
+    1b02:	ff 75 e8             	push   -0x18(%ebp)
+    1b05:	e8 48 36 00 00       	call   5152 <write>
+    1b0a:	83 c4 10             	add    $0x10,%esp
+    1b0d:	83 f8 0a             	cmp    $0xa,%eax
+    1b10:	74 14                	je     1b26 <sharedfd+0xbf>
+      printf(1, "fstests: write sharedfd failed\n");
+    1b12:	83 ec 08             	sub    $0x8,%esp
+    1b15:	68 24 60 00 00       	push   $0x6024
+    1b1a:	6a 01                	push   $0x1
+    1b1c:	e8 eb 37 00 00       	call   530c <printf>
+    1b21:	83 c4 10             	add    $0x10,%esp
+      break;
+    1b24:	eb 0d                	jmp    1b33 <sharedfd+0xcc>
+  for(i = 0; i < 1000; i++){
+    1b26:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1b2a:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    1b31:	7e c6                	jle    1af9 <sharedfd+0x92>
+    }
+  }
+  if(pid == 0)
+    1b33:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+    1b37:	75 05                	jne    1b3e <sharedfd+0xd7>
+    exit();
+    1b39:	e8 f8 35 00 00       	call   5136 <exit>
+  else
+    wait();
+    1b3e:	e8 fa 35 00 00       	call   513d <wait>
+  close(fd);
+    1b43:	83 ec 0c             	sub    $0xc,%esp
+    1b46:	ff 75 e8             	push   -0x18(%ebp)
+    1b49:	e8 0b 36 00 00       	call   5159 <close>
+    1b4e:	83 c4 10             	add    $0x10,%esp
+  fd = open("sharedfd", 0);
+    1b51:	83 ec 08             	sub    $0x8,%esp
+    1b54:	6a 00                	push   $0x0
+    1b56:	68 ed 5f 00 00       	push   $0x5fed
+    1b5b:	e8 0e 36 00 00       	call   516e <open>
+    1b60:	83 c4 10             	add    $0x10,%esp
+    1b63:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(fd < 0){
+    1b66:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1b6a:	79 17                	jns    1b83 <sharedfd+0x11c>
+    printf(1, "fstests: cannot open sharedfd for reading\n");
+    1b6c:	83 ec 08             	sub    $0x8,%esp
+    1b6f:	68 44 60 00 00       	push   $0x6044
+    1b74:	6a 01                	push   $0x1
+    1b76:	e8 91 37 00 00       	call   530c <printf>
+    1b7b:	83 c4 10             	add    $0x10,%esp
+    return;
+    1b7e:	e9 c5 00 00 00       	jmp    1c48 <sharedfd+0x1e1>
+  }
+  nc = np = 0;
+    1b83:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    1b8a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    1b8d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1b90:	eb 3b                	jmp    1bcd <sharedfd+0x166>
+    for(i = 0; i < sizeof(buf); i++){
+    1b92:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1b99:	eb 2a                	jmp    1bc5 <sharedfd+0x15e>
+      if(buf[i] == 'c')
+    1b9b:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1b9e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1ba1:	01 d0                	add    %edx,%eax
+    1ba3:	0f b6 00             	movzbl (%eax),%eax
+    1ba6:	3c 63                	cmp    $0x63,%al
+    1ba8:	75 04                	jne    1bae <sharedfd+0x147>
+        nc++;
+    1baa:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(buf[i] == 'p')
+    1bae:	8d 55 d6             	lea    -0x2a(%ebp),%edx
+    1bb1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bb4:	01 d0                	add    %edx,%eax
+    1bb6:	0f b6 00             	movzbl (%eax),%eax
+    1bb9:	3c 70                	cmp    $0x70,%al
+    1bbb:	75 04                	jne    1bc1 <sharedfd+0x15a>
+        np++;
+    1bbd:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+    for(i = 0; i < sizeof(buf); i++){
+    1bc1:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1bc5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1bc8:	83 f8 09             	cmp    $0x9,%eax
+    1bcb:	76 ce                	jbe    1b9b <sharedfd+0x134>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+    1bcd:	83 ec 04             	sub    $0x4,%esp
+    1bd0:	6a 0a                	push   $0xa
+    1bd2:	8d 45 d6             	lea    -0x2a(%ebp),%eax
+    1bd5:	50                   	push   %eax
+    1bd6:	ff 75 e8             	push   -0x18(%ebp)
+    1bd9:	e8 6d 35 00 00       	call   514b <read>
+    1bde:	83 c4 10             	add    $0x10,%esp
+    1be1:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    1be4:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1be8:	7f a8                	jg     1b92 <sharedfd+0x12b>
+    }
+  }
+  close(fd);
+    1bea:	83 ec 0c             	sub    $0xc,%esp
+    1bed:	ff 75 e8             	push   -0x18(%ebp)
+    1bf0:	e8 64 35 00 00       	call   5159 <close>
+    1bf5:	83 c4 10             	add    $0x10,%esp
+  unlink("sharedfd");
+    1bf8:	83 ec 0c             	sub    $0xc,%esp
+    1bfb:	68 ed 5f 00 00       	push   $0x5fed
+    1c00:	e8 77 35 00 00       	call   517c <unlink>
+    1c05:	83 c4 10             	add    $0x10,%esp
+  if(nc == 10000 && np == 10000){
+    1c08:	81 7d f0 10 27 00 00 	cmpl   $0x2710,-0x10(%ebp)
+    1c0f:	75 1d                	jne    1c2e <sharedfd+0x1c7>
+    1c11:	81 7d ec 10 27 00 00 	cmpl   $0x2710,-0x14(%ebp)
+    1c18:	75 14                	jne    1c2e <sharedfd+0x1c7>
+    printf(1, "sharedfd ok\n");
+    1c1a:	83 ec 08             	sub    $0x8,%esp
+    1c1d:	68 6f 60 00 00       	push   $0x606f
+    1c22:	6a 01                	push   $0x1
+    1c24:	e8 e3 36 00 00       	call   530c <printf>
+    1c29:	83 c4 10             	add    $0x10,%esp
+    1c2c:	eb 1a                	jmp    1c48 <sharedfd+0x1e1>
+  } else {
+    printf(1, "sharedfd oops %d %d\n", nc, np);
+    1c2e:	ff 75 ec             	push   -0x14(%ebp)
+    1c31:	ff 75 f0             	push   -0x10(%ebp)
+    1c34:	68 7c 60 00 00       	push   $0x607c
+    1c39:	6a 01                	push   $0x1
+    1c3b:	e8 cc 36 00 00       	call   530c <printf>
+    1c40:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1c43:	e8 ee 34 00 00       	call   5136 <exit>
+  }
+}
+    1c48:	c9                   	leave
+    1c49:	c3                   	ret
+
+00001c4a <twofiles>:
+
+// two processes write two different files at the same
+// time, to test block allocation.
+void
+twofiles(void)
+{
+    1c4a:	55                   	push   %ebp
+    1c4b:	89 e5                	mov    %esp,%ebp
+    1c4d:	83 ec 28             	sub    $0x28,%esp
+  int fd, pid, i, j, n, total;
+  char *fname;
+
+  printf(1, "twofiles test\n");
+    1c50:	83 ec 08             	sub    $0x8,%esp
+    1c53:	68 91 60 00 00       	push   $0x6091
+    1c58:	6a 01                	push   $0x1
+    1c5a:	e8 ad 36 00 00       	call   530c <printf>
+    1c5f:	83 c4 10             	add    $0x10,%esp
+
+  unlink("f1");
+    1c62:	83 ec 0c             	sub    $0xc,%esp
+    1c65:	68 a0 60 00 00       	push   $0x60a0
+    1c6a:	e8 0d 35 00 00       	call   517c <unlink>
+    1c6f:	83 c4 10             	add    $0x10,%esp
+  unlink("f2");
+    1c72:	83 ec 0c             	sub    $0xc,%esp
+    1c75:	68 a3 60 00 00       	push   $0x60a3
+    1c7a:	e8 fd 34 00 00       	call   517c <unlink>
+    1c7f:	83 c4 10             	add    $0x10,%esp
+
+  pid = fork();
+    1c82:	e8 a8 34 00 00       	call   512f <fork>
+    1c87:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    1c8a:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1c8e:	79 17                	jns    1ca7 <twofiles+0x5d>
+    printf(1, "fork failed\n");
+    1c90:	83 ec 08             	sub    $0x8,%esp
+    1c93:	68 f8 5a 00 00       	push   $0x5af8
+    1c98:	6a 01                	push   $0x1
+    1c9a:	e8 6d 36 00 00       	call   530c <printf>
+    1c9f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ca2:	e8 8f 34 00 00       	call   5136 <exit>
+  }
+
+  fname = pid ? "f1" : "f2";
+    1ca7:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1cab:	74 07                	je     1cb4 <twofiles+0x6a>
+    1cad:	b8 a0 60 00 00       	mov    $0x60a0,%eax
+    1cb2:	eb 05                	jmp    1cb9 <twofiles+0x6f>
+    1cb4:	b8 a3 60 00 00       	mov    $0x60a3,%eax
+    1cb9:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  fd = open(fname, O_CREATE | O_RDWR);
+    1cbc:	83 ec 08             	sub    $0x8,%esp
+    1cbf:	68 02 02 00 00       	push   $0x202
+    1cc4:	ff 75 e4             	push   -0x1c(%ebp)
+    1cc7:	e8 a2 34 00 00       	call   516e <open>
+    1ccc:	83 c4 10             	add    $0x10,%esp
+    1ccf:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  if(fd < 0){
+    1cd2:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+    1cd6:	79 17                	jns    1cef <twofiles+0xa5>
+    printf(1, "create failed\n");
+    1cd8:	83 ec 08             	sub    $0x8,%esp
+    1cdb:	68 a6 60 00 00       	push   $0x60a6
+    1ce0:	6a 01                	push   $0x1
+    1ce2:	e8 25 36 00 00       	call   530c <printf>
+    1ce7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1cea:	e8 47 34 00 00       	call   5136 <exit>
+  }
+
+  memset(buf, pid?'p':'c', 512);
+    1cef:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1cf3:	74 07                	je     1cfc <twofiles+0xb2>
+    1cf5:	b8 70 00 00 00       	mov    $0x70,%eax
+    1cfa:	eb 05                	jmp    1d01 <twofiles+0xb7>
+    1cfc:	b8 63 00 00 00       	mov    $0x63,%eax
+    1d01:	83 ec 04             	sub    $0x4,%esp
+    1d04:	68 00 02 00 00       	push   $0x200
+    1d09:	50                   	push   %eax
+    1d0a:	68 20 7e 00 00       	push   $0x7e20
+    1d0f:	e8 de 2e 00 00       	call   4bf2 <memset>
+    1d14:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 12; i++){
+    1d17:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d1e:	eb 42                	jmp    1d62 <twofiles+0x118>
+    if((n = write(fd, buf, 500)) != 500){
+    1d20:	83 ec 04             	sub    $0x4,%esp
+    1d23:	68 f4 01 00 00       	push   $0x1f4
+    1d28:	68 20 7e 00 00       	push   $0x7e20
+    1d2d:	ff 75 e0             	push   -0x20(%ebp)
+    1d30:	e8 1d 34 00 00       	call   5152 <write>
+    1d35:	83 c4 10             	add    $0x10,%esp
+    1d38:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1d3b:	81 7d dc f4 01 00 00 	cmpl   $0x1f4,-0x24(%ebp)
+    1d42:	74 1a                	je     1d5e <twofiles+0x114>
+      printf(1, "write failed %d\n", n);
+    1d44:	83 ec 04             	sub    $0x4,%esp
+    1d47:	ff 75 dc             	push   -0x24(%ebp)
+    1d4a:	68 b5 60 00 00       	push   $0x60b5
+    1d4f:	6a 01                	push   $0x1
+    1d51:	e8 b6 35 00 00       	call   530c <printf>
+    1d56:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1d59:	e8 d8 33 00 00       	call   5136 <exit>
+  for(i = 0; i < 12; i++){
+    1d5e:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1d62:	83 7d f4 0b          	cmpl   $0xb,-0xc(%ebp)
+    1d66:	7e b8                	jle    1d20 <twofiles+0xd6>
+    }
+  }
+  close(fd);
+    1d68:	83 ec 0c             	sub    $0xc,%esp
+    1d6b:	ff 75 e0             	push   -0x20(%ebp)
+    1d6e:	e8 e6 33 00 00       	call   5159 <close>
+    1d73:	83 c4 10             	add    $0x10,%esp
+  if(pid)
+    1d76:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    1d7a:	74 11                	je     1d8d <twofiles+0x143>
+    wait();
+    1d7c:	e8 bc 33 00 00       	call   513d <wait>
+  else
+    exit();
+
+  for(i = 0; i < 2; i++){
+    1d81:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1d88:	e9 dd 00 00 00       	jmp    1e6a <twofiles+0x220>
+    exit();
+    1d8d:	e8 a4 33 00 00       	call   5136 <exit>
+    fd = open(i?"f1":"f2", 0);
+    1d92:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1d96:	74 07                	je     1d9f <twofiles+0x155>
+    1d98:	b8 a0 60 00 00       	mov    $0x60a0,%eax
+    1d9d:	eb 05                	jmp    1da4 <twofiles+0x15a>
+    1d9f:	b8 a3 60 00 00       	mov    $0x60a3,%eax
+    1da4:	83 ec 08             	sub    $0x8,%esp
+    1da7:	6a 00                	push   $0x0
+    1da9:	50                   	push   %eax
+    1daa:	e8 bf 33 00 00       	call   516e <open>
+    1daf:	83 c4 10             	add    $0x10,%esp
+    1db2:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    total = 0;
+    1db5:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1dbc:	eb 56                	jmp    1e14 <twofiles+0x1ca>
+      for(j = 0; j < n; j++){
+    1dbe:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    1dc5:	eb 3f                	jmp    1e06 <twofiles+0x1bc>
+        if(buf[j] != (i?'p':'c')){
+    1dc7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1dca:	05 20 7e 00 00       	add    $0x7e20,%eax
+    1dcf:	0f b6 00             	movzbl (%eax),%eax
+    1dd2:	0f be c0             	movsbl %al,%eax
+    1dd5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1dd9:	74 07                	je     1de2 <twofiles+0x198>
+    1ddb:	ba 70 00 00 00       	mov    $0x70,%edx
+    1de0:	eb 05                	jmp    1de7 <twofiles+0x19d>
+    1de2:	ba 63 00 00 00       	mov    $0x63,%edx
+    1de7:	39 c2                	cmp    %eax,%edx
+    1de9:	74 17                	je     1e02 <twofiles+0x1b8>
+          printf(1, "wrong char\n");
+    1deb:	83 ec 08             	sub    $0x8,%esp
+    1dee:	68 c6 60 00 00       	push   $0x60c6
+    1df3:	6a 01                	push   $0x1
+    1df5:	e8 12 35 00 00       	call   530c <printf>
+    1dfa:	83 c4 10             	add    $0x10,%esp
+          exit();
+    1dfd:	e8 34 33 00 00       	call   5136 <exit>
+      for(j = 0; j < n; j++){
+    1e02:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    1e06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    1e09:	3b 45 dc             	cmp    -0x24(%ebp),%eax
+    1e0c:	7c b9                	jl     1dc7 <twofiles+0x17d>
+        }
+      }
+      total += n;
+    1e0e:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    1e11:	01 45 ec             	add    %eax,-0x14(%ebp)
+    while((n = read(fd, buf, sizeof(buf))) > 0){
+    1e14:	83 ec 04             	sub    $0x4,%esp
+    1e17:	68 00 20 00 00       	push   $0x2000
+    1e1c:	68 20 7e 00 00       	push   $0x7e20
+    1e21:	ff 75 e0             	push   -0x20(%ebp)
+    1e24:	e8 22 33 00 00       	call   514b <read>
+    1e29:	83 c4 10             	add    $0x10,%esp
+    1e2c:	89 45 dc             	mov    %eax,-0x24(%ebp)
+    1e2f:	83 7d dc 00          	cmpl   $0x0,-0x24(%ebp)
+    1e33:	7f 89                	jg     1dbe <twofiles+0x174>
+    }
+    close(fd);
+    1e35:	83 ec 0c             	sub    $0xc,%esp
+    1e38:	ff 75 e0             	push   -0x20(%ebp)
+    1e3b:	e8 19 33 00 00       	call   5159 <close>
+    1e40:	83 c4 10             	add    $0x10,%esp
+    if(total != 12*500){
+    1e43:	81 7d ec 70 17 00 00 	cmpl   $0x1770,-0x14(%ebp)
+    1e4a:	74 1a                	je     1e66 <twofiles+0x21c>
+      printf(1, "wrong length %d\n", total);
+    1e4c:	83 ec 04             	sub    $0x4,%esp
+    1e4f:	ff 75 ec             	push   -0x14(%ebp)
+    1e52:	68 d2 60 00 00       	push   $0x60d2
+    1e57:	6a 01                	push   $0x1
+    1e59:	e8 ae 34 00 00       	call   530c <printf>
+    1e5e:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1e61:	e8 d0 32 00 00       	call   5136 <exit>
+  for(i = 0; i < 2; i++){
+    1e66:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1e6a:	83 7d f4 01          	cmpl   $0x1,-0xc(%ebp)
+    1e6e:	0f 8e 1e ff ff ff    	jle    1d92 <twofiles+0x148>
+    }
+  }
+
+  unlink("f1");
+    1e74:	83 ec 0c             	sub    $0xc,%esp
+    1e77:	68 a0 60 00 00       	push   $0x60a0
+    1e7c:	e8 fb 32 00 00       	call   517c <unlink>
+    1e81:	83 c4 10             	add    $0x10,%esp
+  unlink("f2");
+    1e84:	83 ec 0c             	sub    $0xc,%esp
+    1e87:	68 a3 60 00 00       	push   $0x60a3
+    1e8c:	e8 eb 32 00 00       	call   517c <unlink>
+    1e91:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "twofiles ok\n");
+    1e94:	83 ec 08             	sub    $0x8,%esp
+    1e97:	68 e3 60 00 00       	push   $0x60e3
+    1e9c:	6a 01                	push   $0x1
+    1e9e:	e8 69 34 00 00       	call   530c <printf>
+    1ea3:	83 c4 10             	add    $0x10,%esp
+}
+    1ea6:	90                   	nop
+    1ea7:	c9                   	leave
+    1ea8:	c3                   	ret
+
+00001ea9 <createdelete>:
+
+// two processes create and delete different files in same directory
+void
+createdelete(void)
+{
+    1ea9:	55                   	push   %ebp
+    1eaa:	89 e5                	mov    %esp,%ebp
+    1eac:	83 ec 38             	sub    $0x38,%esp
+  enum { N = 20 };
+  int pid, i, fd;
+  char name[32];
+
+  printf(1, "createdelete test\n");
+    1eaf:	83 ec 08             	sub    $0x8,%esp
+    1eb2:	68 f0 60 00 00       	push   $0x60f0
+    1eb7:	6a 01                	push   $0x1
+    1eb9:	e8 4e 34 00 00       	call   530c <printf>
+    1ebe:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    1ec1:	e8 69 32 00 00       	call   512f <fork>
+    1ec6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid < 0){
+    1ec9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1ecd:	79 17                	jns    1ee6 <createdelete+0x3d>
+    printf(1, "fork failed\n");
+    1ecf:	83 ec 08             	sub    $0x8,%esp
+    1ed2:	68 f8 5a 00 00       	push   $0x5af8
+    1ed7:	6a 01                	push   $0x1
+    1ed9:	e8 2e 34 00 00       	call   530c <printf>
+    1ede:	83 c4 10             	add    $0x10,%esp
+    exit();
+    1ee1:	e8 50 32 00 00       	call   5136 <exit>
+  }
+
+  name[0] = pid ? 'p' : 'c';
+    1ee6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1eea:	74 07                	je     1ef3 <createdelete+0x4a>
+    1eec:	b8 70 00 00 00       	mov    $0x70,%eax
+    1ef1:	eb 05                	jmp    1ef8 <createdelete+0x4f>
+    1ef3:	b8 63 00 00 00       	mov    $0x63,%eax
+    1ef8:	88 45 cc             	mov    %al,-0x34(%ebp)
+  name[2] = '\0';
+    1efb:	c6 45 ce 00          	movb   $0x0,-0x32(%ebp)
+  for(i = 0; i < N; i++){
+    1eff:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1f06:	e9 9b 00 00 00       	jmp    1fa6 <createdelete+0xfd>
+    name[1] = '0' + i;
+    1f0b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f0e:	83 c0 30             	add    $0x30,%eax
+    1f11:	88 45 cd             	mov    %al,-0x33(%ebp)
+    fd = open(name, O_CREATE | O_RDWR);
+    1f14:	83 ec 08             	sub    $0x8,%esp
+    1f17:	68 02 02 00 00       	push   $0x202
+    1f1c:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    1f1f:	50                   	push   %eax
+    1f20:	e8 49 32 00 00       	call   516e <open>
+    1f25:	83 c4 10             	add    $0x10,%esp
+    1f28:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    1f2b:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1f2f:	79 17                	jns    1f48 <createdelete+0x9f>
+      printf(1, "create failed\n");
+    1f31:	83 ec 08             	sub    $0x8,%esp
+    1f34:	68 a6 60 00 00       	push   $0x60a6
+    1f39:	6a 01                	push   $0x1
+    1f3b:	e8 cc 33 00 00       	call   530c <printf>
+    1f40:	83 c4 10             	add    $0x10,%esp
+      exit();
+    1f43:	e8 ee 31 00 00       	call   5136 <exit>
+    }
+    close(fd);
+    1f48:	83 ec 0c             	sub    $0xc,%esp
+    1f4b:	ff 75 ec             	push   -0x14(%ebp)
+    1f4e:	e8 06 32 00 00       	call   5159 <close>
+    1f53:	83 c4 10             	add    $0x10,%esp
+    if(i > 0 && (i % 2 ) == 0){
+    1f56:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1f5a:	7e 46                	jle    1fa2 <createdelete+0xf9>
+    1f5c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f5f:	83 e0 01             	and    $0x1,%eax
+    1f62:	85 c0                	test   %eax,%eax
+    1f64:	75 3c                	jne    1fa2 <createdelete+0xf9>
+      name[1] = '0' + (i / 2);
+    1f66:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1f69:	89 c2                	mov    %eax,%edx
+    1f6b:	c1 ea 1f             	shr    $0x1f,%edx
+    1f6e:	01 d0                	add    %edx,%eax
+    1f70:	d1 f8                	sar    %eax
+    1f72:	83 c0 30             	add    $0x30,%eax
+    1f75:	88 45 cd             	mov    %al,-0x33(%ebp)
+      if(unlink(name) < 0){
+    1f78:	83 ec 0c             	sub    $0xc,%esp
+    1f7b:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    1f7e:	50                   	push   %eax
+    1f7f:	e8 f8 31 00 00       	call   517c <unlink>
+    1f84:	83 c4 10             	add    $0x10,%esp
+    1f87:	85 c0                	test   %eax,%eax
+    1f89:	79 17                	jns    1fa2 <createdelete+0xf9>
+        printf(1, "unlink failed\n");
+    1f8b:	83 ec 08             	sub    $0x8,%esp
+    1f8e:	68 03 61 00 00       	push   $0x6103
+    1f93:	6a 01                	push   $0x1
+    1f95:	e8 72 33 00 00       	call   530c <printf>
+    1f9a:	83 c4 10             	add    $0x10,%esp
+        exit();
+    1f9d:	e8 94 31 00 00       	call   5136 <exit>
+  for(i = 0; i < N; i++){
+    1fa2:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    1fa6:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    1faa:	0f 8e 5b ff ff ff    	jle    1f0b <createdelete+0x62>
+      }
+    }
+  }
+
+  if(pid==0)
+    1fb0:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    1fb4:	75 05                	jne    1fbb <createdelete+0x112>
+    exit();
+    1fb6:	e8 7b 31 00 00       	call   5136 <exit>
+  else
+    wait();
+    1fbb:	e8 7d 31 00 00       	call   513d <wait>
+
+  for(i = 0; i < N; i++){
+    1fc0:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    1fc7:	e9 22 01 00 00       	jmp    20ee <createdelete+0x245>
+    name[0] = 'p';
+    1fcc:	c6 45 cc 70          	movb   $0x70,-0x34(%ebp)
+    name[1] = '0' + i;
+    1fd0:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    1fd3:	83 c0 30             	add    $0x30,%eax
+    1fd6:	88 45 cd             	mov    %al,-0x33(%ebp)
+    fd = open(name, 0);
+    1fd9:	83 ec 08             	sub    $0x8,%esp
+    1fdc:	6a 00                	push   $0x0
+    1fde:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    1fe1:	50                   	push   %eax
+    1fe2:	e8 87 31 00 00       	call   516e <open>
+    1fe7:	83 c4 10             	add    $0x10,%esp
+    1fea:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((i == 0 || i >= N/2) && fd < 0){
+    1fed:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    1ff1:	74 06                	je     1ff9 <createdelete+0x150>
+    1ff3:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    1ff7:	7e 21                	jle    201a <createdelete+0x171>
+    1ff9:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    1ffd:	79 1b                	jns    201a <createdelete+0x171>
+      printf(1, "oops createdelete %s didn't exist\n", name);
+    1fff:	83 ec 04             	sub    $0x4,%esp
+    2002:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2005:	50                   	push   %eax
+    2006:	68 14 61 00 00       	push   $0x6114
+    200b:	6a 01                	push   $0x1
+    200d:	e8 fa 32 00 00       	call   530c <printf>
+    2012:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2015:	e8 1c 31 00 00       	call   5136 <exit>
+    } else if((i >= 1 && i < N/2) && fd >= 0){
+    201a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    201e:	7e 27                	jle    2047 <createdelete+0x19e>
+    2020:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2024:	7f 21                	jg     2047 <createdelete+0x19e>
+    2026:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    202a:	78 1b                	js     2047 <createdelete+0x19e>
+      printf(1, "oops createdelete %s did exist\n", name);
+    202c:	83 ec 04             	sub    $0x4,%esp
+    202f:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2032:	50                   	push   %eax
+    2033:	68 38 61 00 00       	push   $0x6138
+    2038:	6a 01                	push   $0x1
+    203a:	e8 cd 32 00 00       	call   530c <printf>
+    203f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2042:	e8 ef 30 00 00       	call   5136 <exit>
+    }
+    if(fd >= 0)
+    2047:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    204b:	78 0e                	js     205b <createdelete+0x1b2>
+      close(fd);
+    204d:	83 ec 0c             	sub    $0xc,%esp
+    2050:	ff 75 ec             	push   -0x14(%ebp)
+    2053:	e8 01 31 00 00       	call   5159 <close>
+    2058:	83 c4 10             	add    $0x10,%esp
+
+    name[0] = 'c';
+    205b:	c6 45 cc 63          	movb   $0x63,-0x34(%ebp)
+    name[1] = '0' + i;
+    205f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2062:	83 c0 30             	add    $0x30,%eax
+    2065:	88 45 cd             	mov    %al,-0x33(%ebp)
+    fd = open(name, 0);
+    2068:	83 ec 08             	sub    $0x8,%esp
+    206b:	6a 00                	push   $0x0
+    206d:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2070:	50                   	push   %eax
+    2071:	e8 f8 30 00 00       	call   516e <open>
+    2076:	83 c4 10             	add    $0x10,%esp
+    2079:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if((i == 0 || i >= N/2) && fd < 0){
+    207c:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2080:	74 06                	je     2088 <createdelete+0x1df>
+    2082:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    2086:	7e 21                	jle    20a9 <createdelete+0x200>
+    2088:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    208c:	79 1b                	jns    20a9 <createdelete+0x200>
+      printf(1, "oops createdelete %s didn't exist\n", name);
+    208e:	83 ec 04             	sub    $0x4,%esp
+    2091:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2094:	50                   	push   %eax
+    2095:	68 14 61 00 00       	push   $0x6114
+    209a:	6a 01                	push   $0x1
+    209c:	e8 6b 32 00 00       	call   530c <printf>
+    20a1:	83 c4 10             	add    $0x10,%esp
+      exit();
+    20a4:	e8 8d 30 00 00       	call   5136 <exit>
+    } else if((i >= 1 && i < N/2) && fd >= 0){
+    20a9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    20ad:	7e 27                	jle    20d6 <createdelete+0x22d>
+    20af:	83 7d f4 09          	cmpl   $0x9,-0xc(%ebp)
+    20b3:	7f 21                	jg     20d6 <createdelete+0x22d>
+    20b5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    20b9:	78 1b                	js     20d6 <createdelete+0x22d>
+      printf(1, "oops createdelete %s did exist\n", name);
+    20bb:	83 ec 04             	sub    $0x4,%esp
+    20be:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    20c1:	50                   	push   %eax
+    20c2:	68 38 61 00 00       	push   $0x6138
+    20c7:	6a 01                	push   $0x1
+    20c9:	e8 3e 32 00 00       	call   530c <printf>
+    20ce:	83 c4 10             	add    $0x10,%esp
+      exit();
+    20d1:	e8 60 30 00 00       	call   5136 <exit>
+    }
+    if(fd >= 0)
+    20d6:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    20da:	78 0e                	js     20ea <createdelete+0x241>
+      close(fd);
+    20dc:	83 ec 0c             	sub    $0xc,%esp
+    20df:	ff 75 ec             	push   -0x14(%ebp)
+    20e2:	e8 72 30 00 00       	call   5159 <close>
+    20e7:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++){
+    20ea:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    20ee:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    20f2:	0f 8e d4 fe ff ff    	jle    1fcc <createdelete+0x123>
+  }
+
+  for(i = 0; i < N; i++){
+    20f8:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    20ff:	eb 33                	jmp    2134 <createdelete+0x28b>
+    name[0] = 'p';
+    2101:	c6 45 cc 70          	movb   $0x70,-0x34(%ebp)
+    name[1] = '0' + i;
+    2105:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2108:	83 c0 30             	add    $0x30,%eax
+    210b:	88 45 cd             	mov    %al,-0x33(%ebp)
+    unlink(name);
+    210e:	83 ec 0c             	sub    $0xc,%esp
+    2111:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2114:	50                   	push   %eax
+    2115:	e8 62 30 00 00       	call   517c <unlink>
+    211a:	83 c4 10             	add    $0x10,%esp
+    name[0] = 'c';
+    211d:	c6 45 cc 63          	movb   $0x63,-0x34(%ebp)
+    unlink(name);
+    2121:	83 ec 0c             	sub    $0xc,%esp
+    2124:	8d 45 cc             	lea    -0x34(%ebp),%eax
+    2127:	50                   	push   %eax
+    2128:	e8 4f 30 00 00       	call   517c <unlink>
+    212d:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < N; i++){
+    2130:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2134:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    2138:	7e c7                	jle    2101 <createdelete+0x258>
+  }
+
+  printf(1, "createdelete ok\n");
+    213a:	83 ec 08             	sub    $0x8,%esp
+    213d:	68 58 61 00 00       	push   $0x6158
+    2142:	6a 01                	push   $0x1
+    2144:	e8 c3 31 00 00       	call   530c <printf>
+    2149:	83 c4 10             	add    $0x10,%esp
+}
+    214c:	90                   	nop
+    214d:	c9                   	leave
+    214e:	c3                   	ret
+
+0000214f <unlinkread>:
+
+// can I unlink a file and still read it?
+void
+unlinkread(void)
+{
+    214f:	55                   	push   %ebp
+    2150:	89 e5                	mov    %esp,%ebp
+    2152:	83 ec 18             	sub    $0x18,%esp
+  int fd, fd1;
+
+  printf(1, "unlinkread test\n");
+    2155:	83 ec 08             	sub    $0x8,%esp
+    2158:	68 69 61 00 00       	push   $0x6169
+    215d:	6a 01                	push   $0x1
+    215f:	e8 a8 31 00 00       	call   530c <printf>
+    2164:	83 c4 10             	add    $0x10,%esp
+  fd = open("unlinkread", O_CREATE | O_RDWR);
+    2167:	83 ec 08             	sub    $0x8,%esp
+    216a:	68 02 02 00 00       	push   $0x202
+    216f:	68 7a 61 00 00       	push   $0x617a
+    2174:	e8 f5 2f 00 00       	call   516e <open>
+    2179:	83 c4 10             	add    $0x10,%esp
+    217c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    217f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2183:	79 17                	jns    219c <unlinkread+0x4d>
+    printf(1, "create unlinkread failed\n");
+    2185:	83 ec 08             	sub    $0x8,%esp
+    2188:	68 85 61 00 00       	push   $0x6185
+    218d:	6a 01                	push   $0x1
+    218f:	e8 78 31 00 00       	call   530c <printf>
+    2194:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2197:	e8 9a 2f 00 00       	call   5136 <exit>
+  }
+  write(fd, "hello", 5);
+    219c:	83 ec 04             	sub    $0x4,%esp
+    219f:	6a 05                	push   $0x5
+    21a1:	68 9f 61 00 00       	push   $0x619f
+    21a6:	ff 75 f4             	push   -0xc(%ebp)
+    21a9:	e8 a4 2f 00 00       	call   5152 <write>
+    21ae:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    21b1:	83 ec 0c             	sub    $0xc,%esp
+    21b4:	ff 75 f4             	push   -0xc(%ebp)
+    21b7:	e8 9d 2f 00 00       	call   5159 <close>
+    21bc:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("unlinkread", O_RDWR);
+    21bf:	83 ec 08             	sub    $0x8,%esp
+    21c2:	6a 02                	push   $0x2
+    21c4:	68 7a 61 00 00       	push   $0x617a
+    21c9:	e8 a0 2f 00 00       	call   516e <open>
+    21ce:	83 c4 10             	add    $0x10,%esp
+    21d1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    21d4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    21d8:	79 17                	jns    21f1 <unlinkread+0xa2>
+    printf(1, "open unlinkread failed\n");
+    21da:	83 ec 08             	sub    $0x8,%esp
+    21dd:	68 a5 61 00 00       	push   $0x61a5
+    21e2:	6a 01                	push   $0x1
+    21e4:	e8 23 31 00 00       	call   530c <printf>
+    21e9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    21ec:	e8 45 2f 00 00       	call   5136 <exit>
+  }
+  if(unlink("unlinkread") != 0){
+    21f1:	83 ec 0c             	sub    $0xc,%esp
+    21f4:	68 7a 61 00 00       	push   $0x617a
+    21f9:	e8 7e 2f 00 00       	call   517c <unlink>
+    21fe:	83 c4 10             	add    $0x10,%esp
+    2201:	85 c0                	test   %eax,%eax
+    2203:	74 17                	je     221c <unlinkread+0xcd>
+    printf(1, "unlink unlinkread failed\n");
+    2205:	83 ec 08             	sub    $0x8,%esp
+    2208:	68 bd 61 00 00       	push   $0x61bd
+    220d:	6a 01                	push   $0x1
+    220f:	e8 f8 30 00 00       	call   530c <printf>
+    2214:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2217:	e8 1a 2f 00 00       	call   5136 <exit>
+  }
+
+  fd1 = open("unlinkread", O_CREATE | O_RDWR);
+    221c:	83 ec 08             	sub    $0x8,%esp
+    221f:	68 02 02 00 00       	push   $0x202
+    2224:	68 7a 61 00 00       	push   $0x617a
+    2229:	e8 40 2f 00 00       	call   516e <open>
+    222e:	83 c4 10             	add    $0x10,%esp
+    2231:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  write(fd1, "yyy", 3);
+    2234:	83 ec 04             	sub    $0x4,%esp
+    2237:	6a 03                	push   $0x3
+    2239:	68 d7 61 00 00       	push   $0x61d7
+    223e:	ff 75 f0             	push   -0x10(%ebp)
+    2241:	e8 0c 2f 00 00       	call   5152 <write>
+    2246:	83 c4 10             	add    $0x10,%esp
+  close(fd1);
+    2249:	83 ec 0c             	sub    $0xc,%esp
+    224c:	ff 75 f0             	push   -0x10(%ebp)
+    224f:	e8 05 2f 00 00       	call   5159 <close>
+    2254:	83 c4 10             	add    $0x10,%esp
+
+  if(read(fd, buf, sizeof(buf)) != 5){
+    2257:	83 ec 04             	sub    $0x4,%esp
+    225a:	68 00 20 00 00       	push   $0x2000
+    225f:	68 20 7e 00 00       	push   $0x7e20
+    2264:	ff 75 f4             	push   -0xc(%ebp)
+    2267:	e8 df 2e 00 00       	call   514b <read>
+    226c:	83 c4 10             	add    $0x10,%esp
+    226f:	83 f8 05             	cmp    $0x5,%eax
+    2272:	74 17                	je     228b <unlinkread+0x13c>
+    printf(1, "unlinkread read failed");
+    2274:	83 ec 08             	sub    $0x8,%esp
+    2277:	68 db 61 00 00       	push   $0x61db
+    227c:	6a 01                	push   $0x1
+    227e:	e8 89 30 00 00       	call   530c <printf>
+    2283:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2286:	e8 ab 2e 00 00       	call   5136 <exit>
+  }
+  if(buf[0] != 'h'){
+    228b:	0f b6 05 20 7e 00 00 	movzbl 0x7e20,%eax
+    2292:	3c 68                	cmp    $0x68,%al
+    2294:	74 17                	je     22ad <unlinkread+0x15e>
+    printf(1, "unlinkread wrong data\n");
+    2296:	83 ec 08             	sub    $0x8,%esp
+    2299:	68 f2 61 00 00       	push   $0x61f2
+    229e:	6a 01                	push   $0x1
+    22a0:	e8 67 30 00 00       	call   530c <printf>
+    22a5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22a8:	e8 89 2e 00 00       	call   5136 <exit>
+  }
+  if(write(fd, buf, 10) != 10){
+    22ad:	83 ec 04             	sub    $0x4,%esp
+    22b0:	6a 0a                	push   $0xa
+    22b2:	68 20 7e 00 00       	push   $0x7e20
+    22b7:	ff 75 f4             	push   -0xc(%ebp)
+    22ba:	e8 93 2e 00 00       	call   5152 <write>
+    22bf:	83 c4 10             	add    $0x10,%esp
+    22c2:	83 f8 0a             	cmp    $0xa,%eax
+    22c5:	74 17                	je     22de <unlinkread+0x18f>
+    printf(1, "unlinkread write failed\n");
+    22c7:	83 ec 08             	sub    $0x8,%esp
+    22ca:	68 09 62 00 00       	push   $0x6209
+    22cf:	6a 01                	push   $0x1
+    22d1:	e8 36 30 00 00       	call   530c <printf>
+    22d6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    22d9:	e8 58 2e 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    22de:	83 ec 0c             	sub    $0xc,%esp
+    22e1:	ff 75 f4             	push   -0xc(%ebp)
+    22e4:	e8 70 2e 00 00       	call   5159 <close>
+    22e9:	83 c4 10             	add    $0x10,%esp
+  unlink("unlinkread");
+    22ec:	83 ec 0c             	sub    $0xc,%esp
+    22ef:	68 7a 61 00 00       	push   $0x617a
+    22f4:	e8 83 2e 00 00       	call   517c <unlink>
+    22f9:	83 c4 10             	add    $0x10,%esp
+  printf(1, "unlinkread ok\n");
+    22fc:	83 ec 08             	sub    $0x8,%esp
+    22ff:	68 22 62 00 00       	push   $0x6222
+    2304:	6a 01                	push   $0x1
+    2306:	e8 01 30 00 00       	call   530c <printf>
+    230b:	83 c4 10             	add    $0x10,%esp
+}
+    230e:	90                   	nop
+    230f:	c9                   	leave
+    2310:	c3                   	ret
+
+00002311 <linktest>:
+
+void
+linktest(void)
+{
+    2311:	55                   	push   %ebp
+    2312:	89 e5                	mov    %esp,%ebp
+    2314:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "linktest\n");
+    2317:	83 ec 08             	sub    $0x8,%esp
+    231a:	68 31 62 00 00       	push   $0x6231
+    231f:	6a 01                	push   $0x1
+    2321:	e8 e6 2f 00 00       	call   530c <printf>
+    2326:	83 c4 10             	add    $0x10,%esp
+
+  unlink("lf1");
+    2329:	83 ec 0c             	sub    $0xc,%esp
+    232c:	68 3b 62 00 00       	push   $0x623b
+    2331:	e8 46 2e 00 00       	call   517c <unlink>
+    2336:	83 c4 10             	add    $0x10,%esp
+  unlink("lf2");
+    2339:	83 ec 0c             	sub    $0xc,%esp
+    233c:	68 3f 62 00 00       	push   $0x623f
+    2341:	e8 36 2e 00 00       	call   517c <unlink>
+    2346:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("lf1", O_CREATE|O_RDWR);
+    2349:	83 ec 08             	sub    $0x8,%esp
+    234c:	68 02 02 00 00       	push   $0x202
+    2351:	68 3b 62 00 00       	push   $0x623b
+    2356:	e8 13 2e 00 00       	call   516e <open>
+    235b:	83 c4 10             	add    $0x10,%esp
+    235e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2361:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2365:	79 17                	jns    237e <linktest+0x6d>
+    printf(1, "create lf1 failed\n");
+    2367:	83 ec 08             	sub    $0x8,%esp
+    236a:	68 43 62 00 00       	push   $0x6243
+    236f:	6a 01                	push   $0x1
+    2371:	e8 96 2f 00 00       	call   530c <printf>
+    2376:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2379:	e8 b8 2d 00 00       	call   5136 <exit>
+  }
+  if(write(fd, "hello", 5) != 5){
+    237e:	83 ec 04             	sub    $0x4,%esp
+    2381:	6a 05                	push   $0x5
+    2383:	68 9f 61 00 00       	push   $0x619f
+    2388:	ff 75 f4             	push   -0xc(%ebp)
+    238b:	e8 c2 2d 00 00       	call   5152 <write>
+    2390:	83 c4 10             	add    $0x10,%esp
+    2393:	83 f8 05             	cmp    $0x5,%eax
+    2396:	74 17                	je     23af <linktest+0x9e>
+    printf(1, "write lf1 failed\n");
+    2398:	83 ec 08             	sub    $0x8,%esp
+    239b:	68 56 62 00 00       	push   $0x6256
+    23a0:	6a 01                	push   $0x1
+    23a2:	e8 65 2f 00 00       	call   530c <printf>
+    23a7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23aa:	e8 87 2d 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    23af:	83 ec 0c             	sub    $0xc,%esp
+    23b2:	ff 75 f4             	push   -0xc(%ebp)
+    23b5:	e8 9f 2d 00 00       	call   5159 <close>
+    23ba:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf1", "lf2") < 0){
+    23bd:	83 ec 08             	sub    $0x8,%esp
+    23c0:	68 3f 62 00 00       	push   $0x623f
+    23c5:	68 3b 62 00 00       	push   $0x623b
+    23ca:	e8 bb 2d 00 00       	call   518a <link>
+    23cf:	83 c4 10             	add    $0x10,%esp
+    23d2:	85 c0                	test   %eax,%eax
+    23d4:	79 17                	jns    23ed <linktest+0xdc>
+    printf(1, "link lf1 lf2 failed\n");
+    23d6:	83 ec 08             	sub    $0x8,%esp
+    23d9:	68 68 62 00 00       	push   $0x6268
+    23de:	6a 01                	push   $0x1
+    23e0:	e8 27 2f 00 00       	call   530c <printf>
+    23e5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    23e8:	e8 49 2d 00 00       	call   5136 <exit>
+  }
+  unlink("lf1");
+    23ed:	83 ec 0c             	sub    $0xc,%esp
+    23f0:	68 3b 62 00 00       	push   $0x623b
+    23f5:	e8 82 2d 00 00       	call   517c <unlink>
+    23fa:	83 c4 10             	add    $0x10,%esp
+
+  if(open("lf1", 0) >= 0){
+    23fd:	83 ec 08             	sub    $0x8,%esp
+    2400:	6a 00                	push   $0x0
+    2402:	68 3b 62 00 00       	push   $0x623b
+    2407:	e8 62 2d 00 00       	call   516e <open>
+    240c:	83 c4 10             	add    $0x10,%esp
+    240f:	85 c0                	test   %eax,%eax
+    2411:	78 17                	js     242a <linktest+0x119>
+    printf(1, "unlinked lf1 but it is still there!\n");
+    2413:	83 ec 08             	sub    $0x8,%esp
+    2416:	68 80 62 00 00       	push   $0x6280
+    241b:	6a 01                	push   $0x1
+    241d:	e8 ea 2e 00 00       	call   530c <printf>
+    2422:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2425:	e8 0c 2d 00 00       	call   5136 <exit>
+  }
+
+  fd = open("lf2", 0);
+    242a:	83 ec 08             	sub    $0x8,%esp
+    242d:	6a 00                	push   $0x0
+    242f:	68 3f 62 00 00       	push   $0x623f
+    2434:	e8 35 2d 00 00       	call   516e <open>
+    2439:	83 c4 10             	add    $0x10,%esp
+    243c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    243f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2443:	79 17                	jns    245c <linktest+0x14b>
+    printf(1, "open lf2 failed\n");
+    2445:	83 ec 08             	sub    $0x8,%esp
+    2448:	68 a5 62 00 00       	push   $0x62a5
+    244d:	6a 01                	push   $0x1
+    244f:	e8 b8 2e 00 00       	call   530c <printf>
+    2454:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2457:	e8 da 2c 00 00       	call   5136 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 5){
+    245c:	83 ec 04             	sub    $0x4,%esp
+    245f:	68 00 20 00 00       	push   $0x2000
+    2464:	68 20 7e 00 00       	push   $0x7e20
+    2469:	ff 75 f4             	push   -0xc(%ebp)
+    246c:	e8 da 2c 00 00       	call   514b <read>
+    2471:	83 c4 10             	add    $0x10,%esp
+    2474:	83 f8 05             	cmp    $0x5,%eax
+    2477:	74 17                	je     2490 <linktest+0x17f>
+    printf(1, "read lf2 failed\n");
+    2479:	83 ec 08             	sub    $0x8,%esp
+    247c:	68 b6 62 00 00       	push   $0x62b6
+    2481:	6a 01                	push   $0x1
+    2483:	e8 84 2e 00 00       	call   530c <printf>
+    2488:	83 c4 10             	add    $0x10,%esp
+    exit();
+    248b:	e8 a6 2c 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    2490:	83 ec 0c             	sub    $0xc,%esp
+    2493:	ff 75 f4             	push   -0xc(%ebp)
+    2496:	e8 be 2c 00 00       	call   5159 <close>
+    249b:	83 c4 10             	add    $0x10,%esp
+
+  if(link("lf2", "lf2") >= 0){
+    249e:	83 ec 08             	sub    $0x8,%esp
+    24a1:	68 3f 62 00 00       	push   $0x623f
+    24a6:	68 3f 62 00 00       	push   $0x623f
+    24ab:	e8 da 2c 00 00       	call   518a <link>
+    24b0:	83 c4 10             	add    $0x10,%esp
+    24b3:	85 c0                	test   %eax,%eax
+    24b5:	78 17                	js     24ce <linktest+0x1bd>
+    printf(1, "link lf2 lf2 succeeded! oops\n");
+    24b7:	83 ec 08             	sub    $0x8,%esp
+    24ba:	68 c7 62 00 00       	push   $0x62c7
+    24bf:	6a 01                	push   $0x1
+    24c1:	e8 46 2e 00 00       	call   530c <printf>
+    24c6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    24c9:	e8 68 2c 00 00       	call   5136 <exit>
+  }
+
+  unlink("lf2");
+    24ce:	83 ec 0c             	sub    $0xc,%esp
+    24d1:	68 3f 62 00 00       	push   $0x623f
+    24d6:	e8 a1 2c 00 00       	call   517c <unlink>
+    24db:	83 c4 10             	add    $0x10,%esp
+  if(link("lf2", "lf1") >= 0){
+    24de:	83 ec 08             	sub    $0x8,%esp
+    24e1:	68 3b 62 00 00       	push   $0x623b
+    24e6:	68 3f 62 00 00       	push   $0x623f
+    24eb:	e8 9a 2c 00 00       	call   518a <link>
+    24f0:	83 c4 10             	add    $0x10,%esp
+    24f3:	85 c0                	test   %eax,%eax
+    24f5:	78 17                	js     250e <linktest+0x1fd>
+    printf(1, "link non-existant succeeded! oops\n");
+    24f7:	83 ec 08             	sub    $0x8,%esp
+    24fa:	68 e8 62 00 00       	push   $0x62e8
+    24ff:	6a 01                	push   $0x1
+    2501:	e8 06 2e 00 00       	call   530c <printf>
+    2506:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2509:	e8 28 2c 00 00       	call   5136 <exit>
+  }
+
+  if(link(".", "lf1") >= 0){
+    250e:	83 ec 08             	sub    $0x8,%esp
+    2511:	68 3b 62 00 00       	push   $0x623b
+    2516:	68 0b 63 00 00       	push   $0x630b
+    251b:	e8 6a 2c 00 00       	call   518a <link>
+    2520:	83 c4 10             	add    $0x10,%esp
+    2523:	85 c0                	test   %eax,%eax
+    2525:	78 17                	js     253e <linktest+0x22d>
+    printf(1, "link . lf1 succeeded! oops\n");
+    2527:	83 ec 08             	sub    $0x8,%esp
+    252a:	68 0d 63 00 00       	push   $0x630d
+    252f:	6a 01                	push   $0x1
+    2531:	e8 d6 2d 00 00       	call   530c <printf>
+    2536:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2539:	e8 f8 2b 00 00       	call   5136 <exit>
+  }
+
+  printf(1, "linktest ok\n");
+    253e:	83 ec 08             	sub    $0x8,%esp
+    2541:	68 29 63 00 00       	push   $0x6329
+    2546:	6a 01                	push   $0x1
+    2548:	e8 bf 2d 00 00       	call   530c <printf>
+    254d:	83 c4 10             	add    $0x10,%esp
+}
+    2550:	90                   	nop
+    2551:	c9                   	leave
+    2552:	c3                   	ret
+
+00002553 <concreate>:
+
+// test concurrent create/link/unlink of the same file
+void
+concreate(void)
+{
+    2553:	55                   	push   %ebp
+    2554:	89 e5                	mov    %esp,%ebp
+    2556:	83 ec 58             	sub    $0x58,%esp
+  struct {
+    ushort inum;
+    char name[14];
+  } de;
+
+  printf(1, "concreate test\n");
+    2559:	83 ec 08             	sub    $0x8,%esp
+    255c:	68 36 63 00 00       	push   $0x6336
+    2561:	6a 01                	push   $0x1
+    2563:	e8 a4 2d 00 00       	call   530c <printf>
+    2568:	83 c4 10             	add    $0x10,%esp
+  file[0] = 'C';
+    256b:	c6 45 e5 43          	movb   $0x43,-0x1b(%ebp)
+  file[2] = '\0';
+    256f:	c6 45 e7 00          	movb   $0x0,-0x19(%ebp)
+  for(i = 0; i < 40; i++){
+    2573:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    257a:	e9 fc 00 00 00       	jmp    267b <concreate+0x128>
+    file[1] = '0' + i;
+    257f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2582:	83 c0 30             	add    $0x30,%eax
+    2585:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    unlink(file);
+    2588:	83 ec 0c             	sub    $0xc,%esp
+    258b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    258e:	50                   	push   %eax
+    258f:	e8 e8 2b 00 00       	call   517c <unlink>
+    2594:	83 c4 10             	add    $0x10,%esp
+    pid = fork();
+    2597:	e8 93 2b 00 00       	call   512f <fork>
+    259c:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid && (i % 3) == 1){
+    259f:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    25a3:	74 3b                	je     25e0 <concreate+0x8d>
+    25a5:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    25a8:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    25ad:	89 c8                	mov    %ecx,%eax
+    25af:	f7 ea                	imul   %edx
+    25b1:	89 c8                	mov    %ecx,%eax
+    25b3:	c1 f8 1f             	sar    $0x1f,%eax
+    25b6:	29 c2                	sub    %eax,%edx
+    25b8:	89 d0                	mov    %edx,%eax
+    25ba:	01 c0                	add    %eax,%eax
+    25bc:	01 d0                	add    %edx,%eax
+    25be:	29 c1                	sub    %eax,%ecx
+    25c0:	89 ca                	mov    %ecx,%edx
+    25c2:	83 fa 01             	cmp    $0x1,%edx
+    25c5:	75 19                	jne    25e0 <concreate+0x8d>
+      link("C0", file);
+    25c7:	83 ec 08             	sub    $0x8,%esp
+    25ca:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    25cd:	50                   	push   %eax
+    25ce:	68 46 63 00 00       	push   $0x6346
+    25d3:	e8 b2 2b 00 00       	call   518a <link>
+    25d8:	83 c4 10             	add    $0x10,%esp
+    25db:	e9 87 00 00 00       	jmp    2667 <concreate+0x114>
+    } else if(pid == 0 && (i % 5) == 1){
+    25e0:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    25e4:	75 3b                	jne    2621 <concreate+0xce>
+    25e6:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    25e9:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    25ee:	89 c8                	mov    %ecx,%eax
+    25f0:	f7 ea                	imul   %edx
+    25f2:	d1 fa                	sar    %edx
+    25f4:	89 c8                	mov    %ecx,%eax
+    25f6:	c1 f8 1f             	sar    $0x1f,%eax
+    25f9:	29 c2                	sub    %eax,%edx
+    25fb:	89 d0                	mov    %edx,%eax
+    25fd:	c1 e0 02             	shl    $0x2,%eax
+    2600:	01 d0                	add    %edx,%eax
+    2602:	29 c1                	sub    %eax,%ecx
+    2604:	89 ca                	mov    %ecx,%edx
+    2606:	83 fa 01             	cmp    $0x1,%edx
+    2609:	75 16                	jne    2621 <concreate+0xce>
+      link("C0", file);
+    260b:	83 ec 08             	sub    $0x8,%esp
+    260e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2611:	50                   	push   %eax
+    2612:	68 46 63 00 00       	push   $0x6346
+    2617:	e8 6e 2b 00 00       	call   518a <link>
+    261c:	83 c4 10             	add    $0x10,%esp
+    261f:	eb 46                	jmp    2667 <concreate+0x114>
+    } else {
+      fd = open(file, O_CREATE | O_RDWR);
+    2621:	83 ec 08             	sub    $0x8,%esp
+    2624:	68 02 02 00 00       	push   $0x202
+    2629:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    262c:	50                   	push   %eax
+    262d:	e8 3c 2b 00 00       	call   516e <open>
+    2632:	83 c4 10             	add    $0x10,%esp
+    2635:	89 45 ec             	mov    %eax,-0x14(%ebp)
+      if(fd < 0){
+    2638:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    263c:	79 1b                	jns    2659 <concreate+0x106>
+        printf(1, "concreate create %s failed\n", file);
+    263e:	83 ec 04             	sub    $0x4,%esp
+    2641:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2644:	50                   	push   %eax
+    2645:	68 49 63 00 00       	push   $0x6349
+    264a:	6a 01                	push   $0x1
+    264c:	e8 bb 2c 00 00       	call   530c <printf>
+    2651:	83 c4 10             	add    $0x10,%esp
+        exit();
+    2654:	e8 dd 2a 00 00       	call   5136 <exit>
+      }
+      close(fd);
+    2659:	83 ec 0c             	sub    $0xc,%esp
+    265c:	ff 75 ec             	push   -0x14(%ebp)
+    265f:	e8 f5 2a 00 00       	call   5159 <close>
+    2664:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    2667:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    266b:	75 05                	jne    2672 <concreate+0x11f>
+      exit();
+    266d:	e8 c4 2a 00 00       	call   5136 <exit>
+    else
+      wait();
+    2672:	e8 c6 2a 00 00       	call   513d <wait>
+  for(i = 0; i < 40; i++){
+    2677:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    267b:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    267f:	0f 8e fa fe ff ff    	jle    257f <concreate+0x2c>
+  }
+
+  memset(fa, 0, sizeof(fa));
+    2685:	83 ec 04             	sub    $0x4,%esp
+    2688:	6a 28                	push   $0x28
+    268a:	6a 00                	push   $0x0
+    268c:	8d 45 bd             	lea    -0x43(%ebp),%eax
+    268f:	50                   	push   %eax
+    2690:	e8 5d 25 00 00       	call   4bf2 <memset>
+    2695:	83 c4 10             	add    $0x10,%esp
+  fd = open(".", 0);
+    2698:	83 ec 08             	sub    $0x8,%esp
+    269b:	6a 00                	push   $0x0
+    269d:	68 0b 63 00 00       	push   $0x630b
+    26a2:	e8 c7 2a 00 00       	call   516e <open>
+    26a7:	83 c4 10             	add    $0x10,%esp
+    26aa:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  n = 0;
+    26ad:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  while(read(fd, &de, sizeof(de)) > 0){
+    26b4:	e9 99 00 00 00       	jmp    2752 <concreate+0x1ff>
+    if(de.inum == 0)
+    26b9:	0f b7 45 ac          	movzwl -0x54(%ebp),%eax
+    26bd:	66 85 c0             	test   %ax,%ax
+    26c0:	0f 84 8b 00 00 00    	je     2751 <concreate+0x1fe>
+      continue;
+    if(de.name[0] == 'C' && de.name[2] == '\0'){
+    26c6:	0f b6 45 ae          	movzbl -0x52(%ebp),%eax
+    26ca:	3c 43                	cmp    $0x43,%al
+    26cc:	0f 85 80 00 00 00    	jne    2752 <concreate+0x1ff>
+    26d2:	0f b6 45 b0          	movzbl -0x50(%ebp),%eax
+    26d6:	84 c0                	test   %al,%al
+    26d8:	75 78                	jne    2752 <concreate+0x1ff>
+      i = de.name[1] - '0';
+    26da:	0f b6 45 af          	movzbl -0x51(%ebp),%eax
+    26de:	0f be c0             	movsbl %al,%eax
+    26e1:	83 e8 30             	sub    $0x30,%eax
+    26e4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+      if(i < 0 || i >= sizeof(fa)){
+    26e7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    26eb:	78 08                	js     26f5 <concreate+0x1a2>
+    26ed:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    26f0:	83 f8 27             	cmp    $0x27,%eax
+    26f3:	76 1e                	jbe    2713 <concreate+0x1c0>
+        printf(1, "concreate weird file %s\n", de.name);
+    26f5:	83 ec 04             	sub    $0x4,%esp
+    26f8:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    26fb:	83 c0 02             	add    $0x2,%eax
+    26fe:	50                   	push   %eax
+    26ff:	68 65 63 00 00       	push   $0x6365
+    2704:	6a 01                	push   $0x1
+    2706:	e8 01 2c 00 00       	call   530c <printf>
+    270b:	83 c4 10             	add    $0x10,%esp
+        exit();
+    270e:	e8 23 2a 00 00       	call   5136 <exit>
+      }
+      if(fa[i]){
+    2713:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    2716:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2719:	01 d0                	add    %edx,%eax
+    271b:	0f b6 00             	movzbl (%eax),%eax
+    271e:	84 c0                	test   %al,%al
+    2720:	74 1e                	je     2740 <concreate+0x1ed>
+        printf(1, "concreate duplicate file %s\n", de.name);
+    2722:	83 ec 04             	sub    $0x4,%esp
+    2725:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    2728:	83 c0 02             	add    $0x2,%eax
+    272b:	50                   	push   %eax
+    272c:	68 7e 63 00 00       	push   $0x637e
+    2731:	6a 01                	push   $0x1
+    2733:	e8 d4 2b 00 00       	call   530c <printf>
+    2738:	83 c4 10             	add    $0x10,%esp
+        exit();
+    273b:	e8 f6 29 00 00       	call   5136 <exit>
+      }
+      fa[i] = 1;
+    2740:	8d 55 bd             	lea    -0x43(%ebp),%edx
+    2743:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2746:	01 d0                	add    %edx,%eax
+    2748:	c6 00 01             	movb   $0x1,(%eax)
+      n++;
+    274b:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    274f:	eb 01                	jmp    2752 <concreate+0x1ff>
+      continue;
+    2751:	90                   	nop
+  while(read(fd, &de, sizeof(de)) > 0){
+    2752:	83 ec 04             	sub    $0x4,%esp
+    2755:	6a 10                	push   $0x10
+    2757:	8d 45 ac             	lea    -0x54(%ebp),%eax
+    275a:	50                   	push   %eax
+    275b:	ff 75 ec             	push   -0x14(%ebp)
+    275e:	e8 e8 29 00 00       	call   514b <read>
+    2763:	83 c4 10             	add    $0x10,%esp
+    2766:	85 c0                	test   %eax,%eax
+    2768:	0f 8f 4b ff ff ff    	jg     26b9 <concreate+0x166>
+    }
+  }
+  close(fd);
+    276e:	83 ec 0c             	sub    $0xc,%esp
+    2771:	ff 75 ec             	push   -0x14(%ebp)
+    2774:	e8 e0 29 00 00       	call   5159 <close>
+    2779:	83 c4 10             	add    $0x10,%esp
+
+  if(n != 40){
+    277c:	83 7d f0 28          	cmpl   $0x28,-0x10(%ebp)
+    2780:	74 17                	je     2799 <concreate+0x246>
+    printf(1, "concreate not enough files in directory listing\n");
+    2782:	83 ec 08             	sub    $0x8,%esp
+    2785:	68 9c 63 00 00       	push   $0x639c
+    278a:	6a 01                	push   $0x1
+    278c:	e8 7b 2b 00 00       	call   530c <printf>
+    2791:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2794:	e8 9d 29 00 00       	call   5136 <exit>
+  }
+
+  for(i = 0; i < 40; i++){
+    2799:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    27a0:	e9 43 01 00 00       	jmp    28e8 <concreate+0x395>
+    file[1] = '0' + i;
+    27a5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    27a8:	83 c0 30             	add    $0x30,%eax
+    27ab:	88 45 e6             	mov    %al,-0x1a(%ebp)
+    pid = fork();
+    27ae:	e8 7c 29 00 00       	call   512f <fork>
+    27b3:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    27b6:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    27ba:	79 17                	jns    27d3 <concreate+0x280>
+      printf(1, "fork failed\n");
+    27bc:	83 ec 08             	sub    $0x8,%esp
+    27bf:	68 f8 5a 00 00       	push   $0x5af8
+    27c4:	6a 01                	push   $0x1
+    27c6:	e8 41 2b 00 00       	call   530c <printf>
+    27cb:	83 c4 10             	add    $0x10,%esp
+      exit();
+    27ce:	e8 63 29 00 00       	call   5136 <exit>
+    }
+    if(((i % 3) == 0 && pid == 0) ||
+    27d3:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    27d6:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    27db:	89 c8                	mov    %ecx,%eax
+    27dd:	f7 ea                	imul   %edx
+    27df:	89 c8                	mov    %ecx,%eax
+    27e1:	c1 f8 1f             	sar    $0x1f,%eax
+    27e4:	29 c2                	sub    %eax,%edx
+    27e6:	89 d0                	mov    %edx,%eax
+    27e8:	01 c0                	add    %eax,%eax
+    27ea:	01 d0                	add    %edx,%eax
+    27ec:	29 c1                	sub    %eax,%ecx
+    27ee:	89 ca                	mov    %ecx,%edx
+    27f0:	85 d2                	test   %edx,%edx
+    27f2:	75 06                	jne    27fa <concreate+0x2a7>
+    27f4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    27f8:	74 28                	je     2822 <concreate+0x2cf>
+       ((i % 3) == 1 && pid != 0)){
+    27fa:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    27fd:	ba 56 55 55 55       	mov    $0x55555556,%edx
+    2802:	89 c8                	mov    %ecx,%eax
+    2804:	f7 ea                	imul   %edx
+    2806:	89 c8                	mov    %ecx,%eax
+    2808:	c1 f8 1f             	sar    $0x1f,%eax
+    280b:	29 c2                	sub    %eax,%edx
+    280d:	89 d0                	mov    %edx,%eax
+    280f:	01 c0                	add    %eax,%eax
+    2811:	01 d0                	add    %edx,%eax
+    2813:	29 c1                	sub    %eax,%ecx
+    2815:	89 ca                	mov    %ecx,%edx
+    if(((i % 3) == 0 && pid == 0) ||
+    2817:	83 fa 01             	cmp    $0x1,%edx
+    281a:	75 7c                	jne    2898 <concreate+0x345>
+       ((i % 3) == 1 && pid != 0)){
+    281c:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    2820:	74 76                	je     2898 <concreate+0x345>
+      close(open(file, 0));
+    2822:	83 ec 08             	sub    $0x8,%esp
+    2825:	6a 00                	push   $0x0
+    2827:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    282a:	50                   	push   %eax
+    282b:	e8 3e 29 00 00       	call   516e <open>
+    2830:	83 c4 10             	add    $0x10,%esp
+    2833:	83 ec 0c             	sub    $0xc,%esp
+    2836:	50                   	push   %eax
+    2837:	e8 1d 29 00 00       	call   5159 <close>
+    283c:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    283f:	83 ec 08             	sub    $0x8,%esp
+    2842:	6a 00                	push   $0x0
+    2844:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2847:	50                   	push   %eax
+    2848:	e8 21 29 00 00       	call   516e <open>
+    284d:	83 c4 10             	add    $0x10,%esp
+    2850:	83 ec 0c             	sub    $0xc,%esp
+    2853:	50                   	push   %eax
+    2854:	e8 00 29 00 00       	call   5159 <close>
+    2859:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    285c:	83 ec 08             	sub    $0x8,%esp
+    285f:	6a 00                	push   $0x0
+    2861:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2864:	50                   	push   %eax
+    2865:	e8 04 29 00 00       	call   516e <open>
+    286a:	83 c4 10             	add    $0x10,%esp
+    286d:	83 ec 0c             	sub    $0xc,%esp
+    2870:	50                   	push   %eax
+    2871:	e8 e3 28 00 00       	call   5159 <close>
+    2876:	83 c4 10             	add    $0x10,%esp
+      close(open(file, 0));
+    2879:	83 ec 08             	sub    $0x8,%esp
+    287c:	6a 00                	push   $0x0
+    287e:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    2881:	50                   	push   %eax
+    2882:	e8 e7 28 00 00       	call   516e <open>
+    2887:	83 c4 10             	add    $0x10,%esp
+    288a:	83 ec 0c             	sub    $0xc,%esp
+    288d:	50                   	push   %eax
+    288e:	e8 c6 28 00 00       	call   5159 <close>
+    2893:	83 c4 10             	add    $0x10,%esp
+    2896:	eb 3c                	jmp    28d4 <concreate+0x381>
+    } else {
+      unlink(file);
+    2898:	83 ec 0c             	sub    $0xc,%esp
+    289b:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    289e:	50                   	push   %eax
+    289f:	e8 d8 28 00 00       	call   517c <unlink>
+    28a4:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    28a7:	83 ec 0c             	sub    $0xc,%esp
+    28aa:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28ad:	50                   	push   %eax
+    28ae:	e8 c9 28 00 00       	call   517c <unlink>
+    28b3:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    28b6:	83 ec 0c             	sub    $0xc,%esp
+    28b9:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28bc:	50                   	push   %eax
+    28bd:	e8 ba 28 00 00       	call   517c <unlink>
+    28c2:	83 c4 10             	add    $0x10,%esp
+      unlink(file);
+    28c5:	83 ec 0c             	sub    $0xc,%esp
+    28c8:	8d 45 e5             	lea    -0x1b(%ebp),%eax
+    28cb:	50                   	push   %eax
+    28cc:	e8 ab 28 00 00       	call   517c <unlink>
+    28d1:	83 c4 10             	add    $0x10,%esp
+    }
+    if(pid == 0)
+    28d4:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    28d8:	75 05                	jne    28df <concreate+0x38c>
+      exit();
+    28da:	e8 57 28 00 00       	call   5136 <exit>
+    else
+      wait();
+    28df:	e8 59 28 00 00       	call   513d <wait>
+  for(i = 0; i < 40; i++){
+    28e4:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    28e8:	83 7d f4 27          	cmpl   $0x27,-0xc(%ebp)
+    28ec:	0f 8e b3 fe ff ff    	jle    27a5 <concreate+0x252>
+  }
+
+  printf(1, "concreate ok\n");
+    28f2:	83 ec 08             	sub    $0x8,%esp
+    28f5:	68 cd 63 00 00       	push   $0x63cd
+    28fa:	6a 01                	push   $0x1
+    28fc:	e8 0b 2a 00 00       	call   530c <printf>
+    2901:	83 c4 10             	add    $0x10,%esp
+}
+    2904:	90                   	nop
+    2905:	c9                   	leave
+    2906:	c3                   	ret
+
+00002907 <linkunlink>:
+
+// another concurrent link/unlink/create test,
+// to look for deadlocks.
+void
+linkunlink()
+{
+    2907:	55                   	push   %ebp
+    2908:	89 e5                	mov    %esp,%ebp
+    290a:	83 ec 18             	sub    $0x18,%esp
+  int pid, i;
+
+  printf(1, "linkunlink test\n");
+    290d:	83 ec 08             	sub    $0x8,%esp
+    2910:	68 db 63 00 00       	push   $0x63db
+    2915:	6a 01                	push   $0x1
+    2917:	e8 f0 29 00 00       	call   530c <printf>
+    291c:	83 c4 10             	add    $0x10,%esp
+
+  unlink("x");
+    291f:	83 ec 0c             	sub    $0xc,%esp
+    2922:	68 c0 5b 00 00       	push   $0x5bc0
+    2927:	e8 50 28 00 00       	call   517c <unlink>
+    292c:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    292f:	e8 fb 27 00 00       	call   512f <fork>
+    2934:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(pid < 0){
+    2937:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    293b:	79 17                	jns    2954 <linkunlink+0x4d>
+    printf(1, "fork failed\n");
+    293d:	83 ec 08             	sub    $0x8,%esp
+    2940:	68 f8 5a 00 00       	push   $0x5af8
+    2945:	6a 01                	push   $0x1
+    2947:	e8 c0 29 00 00       	call   530c <printf>
+    294c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    294f:	e8 e2 27 00 00       	call   5136 <exit>
+  }
+
+  unsigned int x = (pid ? 1 : 97);
+    2954:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2958:	74 07                	je     2961 <linkunlink+0x5a>
+    295a:	b8 01 00 00 00       	mov    $0x1,%eax
+    295f:	eb 05                	jmp    2966 <linkunlink+0x5f>
+    2961:	b8 61 00 00 00       	mov    $0x61,%eax
+    2966:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  for(i = 0; i < 100; i++){
+    2969:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2970:	e9 98 00 00 00       	jmp    2a0d <linkunlink+0x106>
+    x = x * 1103515245 + 12345;
+    2975:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    2978:	69 c0 6d 4e c6 41    	imul   $0x41c64e6d,%eax,%eax
+    297e:	05 39 30 00 00       	add    $0x3039,%eax
+    2983:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if((x % 3) == 0){
+    2986:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    2989:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    298e:	89 c8                	mov    %ecx,%eax
+    2990:	f7 e2                	mul    %edx
+    2992:	d1 ea                	shr    %edx
+    2994:	89 d0                	mov    %edx,%eax
+    2996:	01 c0                	add    %eax,%eax
+    2998:	01 d0                	add    %edx,%eax
+    299a:	29 c1                	sub    %eax,%ecx
+    299c:	89 ca                	mov    %ecx,%edx
+    299e:	85 d2                	test   %edx,%edx
+    29a0:	75 23                	jne    29c5 <linkunlink+0xbe>
+      close(open("x", O_RDWR | O_CREATE));
+    29a2:	83 ec 08             	sub    $0x8,%esp
+    29a5:	68 02 02 00 00       	push   $0x202
+    29aa:	68 c0 5b 00 00       	push   $0x5bc0
+    29af:	e8 ba 27 00 00       	call   516e <open>
+    29b4:	83 c4 10             	add    $0x10,%esp
+    29b7:	83 ec 0c             	sub    $0xc,%esp
+    29ba:	50                   	push   %eax
+    29bb:	e8 99 27 00 00       	call   5159 <close>
+    29c0:	83 c4 10             	add    $0x10,%esp
+    29c3:	eb 44                	jmp    2a09 <linkunlink+0x102>
+    } else if((x % 3) == 1){
+    29c5:	8b 4d f0             	mov    -0x10(%ebp),%ecx
+    29c8:	ba ab aa aa aa       	mov    $0xaaaaaaab,%edx
+    29cd:	89 c8                	mov    %ecx,%eax
+    29cf:	f7 e2                	mul    %edx
+    29d1:	d1 ea                	shr    %edx
+    29d3:	89 d0                	mov    %edx,%eax
+    29d5:	01 c0                	add    %eax,%eax
+    29d7:	01 d0                	add    %edx,%eax
+    29d9:	29 c1                	sub    %eax,%ecx
+    29db:	89 ca                	mov    %ecx,%edx
+    29dd:	83 fa 01             	cmp    $0x1,%edx
+    29e0:	75 17                	jne    29f9 <linkunlink+0xf2>
+      link("cat", "x");
+    29e2:	83 ec 08             	sub    $0x8,%esp
+    29e5:	68 c0 5b 00 00       	push   $0x5bc0
+    29ea:	68 ec 63 00 00       	push   $0x63ec
+    29ef:	e8 96 27 00 00       	call   518a <link>
+    29f4:	83 c4 10             	add    $0x10,%esp
+    29f7:	eb 10                	jmp    2a09 <linkunlink+0x102>
+    } else {
+      unlink("x");
+    29f9:	83 ec 0c             	sub    $0xc,%esp
+    29fc:	68 c0 5b 00 00       	push   $0x5bc0
+    2a01:	e8 76 27 00 00       	call   517c <unlink>
+    2a06:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 100; i++){
+    2a09:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2a0d:	83 7d f4 63          	cmpl   $0x63,-0xc(%ebp)
+    2a11:	0f 8e 5e ff ff ff    	jle    2975 <linkunlink+0x6e>
+    }
+  }
+
+  if(pid)
+    2a17:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    2a1b:	74 07                	je     2a24 <linkunlink+0x11d>
+    wait();
+    2a1d:	e8 1b 27 00 00       	call   513d <wait>
+    2a22:	eb 05                	jmp    2a29 <linkunlink+0x122>
+  else 
+    exit();
+    2a24:	e8 0d 27 00 00       	call   5136 <exit>
+
+  printf(1, "linkunlink ok\n");
+    2a29:	83 ec 08             	sub    $0x8,%esp
+    2a2c:	68 f0 63 00 00       	push   $0x63f0
+    2a31:	6a 01                	push   $0x1
+    2a33:	e8 d4 28 00 00       	call   530c <printf>
+    2a38:	83 c4 10             	add    $0x10,%esp
+}
+    2a3b:	90                   	nop
+    2a3c:	c9                   	leave
+    2a3d:	c3                   	ret
+
+00002a3e <bigdir>:
+
+// directory that uses indirect blocks
+void
+bigdir(void)
+{
+    2a3e:	55                   	push   %ebp
+    2a3f:	89 e5                	mov    %esp,%ebp
+    2a41:	83 ec 28             	sub    $0x28,%esp
+  int i, fd;
+  char name[10];
+
+  printf(1, "bigdir test\n");
+    2a44:	83 ec 08             	sub    $0x8,%esp
+    2a47:	68 ff 63 00 00       	push   $0x63ff
+    2a4c:	6a 01                	push   $0x1
+    2a4e:	e8 b9 28 00 00       	call   530c <printf>
+    2a53:	83 c4 10             	add    $0x10,%esp
+  unlink("bd");
+    2a56:	83 ec 0c             	sub    $0xc,%esp
+    2a59:	68 0c 64 00 00       	push   $0x640c
+    2a5e:	e8 19 27 00 00       	call   517c <unlink>
+    2a63:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bd", O_CREATE);
+    2a66:	83 ec 08             	sub    $0x8,%esp
+    2a69:	68 00 02 00 00       	push   $0x200
+    2a6e:	68 0c 64 00 00       	push   $0x640c
+    2a73:	e8 f6 26 00 00       	call   516e <open>
+    2a78:	83 c4 10             	add    $0x10,%esp
+    2a7b:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(fd < 0){
+    2a7e:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    2a82:	79 17                	jns    2a9b <bigdir+0x5d>
+    printf(1, "bigdir create failed\n");
+    2a84:	83 ec 08             	sub    $0x8,%esp
+    2a87:	68 0f 64 00 00       	push   $0x640f
+    2a8c:	6a 01                	push   $0x1
+    2a8e:	e8 79 28 00 00       	call   530c <printf>
+    2a93:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2a96:	e8 9b 26 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    2a9b:	83 ec 0c             	sub    $0xc,%esp
+    2a9e:	ff 75 f0             	push   -0x10(%ebp)
+    2aa1:	e8 b3 26 00 00       	call   5159 <close>
+    2aa6:	83 c4 10             	add    $0x10,%esp
+
+  for(i = 0; i < 500; i++){
+    2aa9:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2ab0:	eb 69                	jmp    2b1b <bigdir+0xdd>
+    name[0] = 'x';
+    2ab2:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    2ab6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2ab9:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2abc:	85 c0                	test   %eax,%eax
+    2abe:	0f 48 c2             	cmovs  %edx,%eax
+    2ac1:	c1 f8 06             	sar    $0x6,%eax
+    2ac4:	83 c0 30             	add    $0x30,%eax
+    2ac7:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    2aca:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2acd:	89 d0                	mov    %edx,%eax
+    2acf:	c1 f8 1f             	sar    $0x1f,%eax
+    2ad2:	c1 e8 1a             	shr    $0x1a,%eax
+    2ad5:	01 c2                	add    %eax,%edx
+    2ad7:	83 e2 3f             	and    $0x3f,%edx
+    2ada:	29 c2                	sub    %eax,%edx
+    2adc:	89 d0                	mov    %edx,%eax
+    2ade:	83 c0 30             	add    $0x30,%eax
+    2ae1:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    2ae4:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(link("bd", name) != 0){
+    2ae8:	83 ec 08             	sub    $0x8,%esp
+    2aeb:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    2aee:	50                   	push   %eax
+    2aef:	68 0c 64 00 00       	push   $0x640c
+    2af4:	e8 91 26 00 00       	call   518a <link>
+    2af9:	83 c4 10             	add    $0x10,%esp
+    2afc:	85 c0                	test   %eax,%eax
+    2afe:	74 17                	je     2b17 <bigdir+0xd9>
+      printf(1, "bigdir link failed\n");
+    2b00:	83 ec 08             	sub    $0x8,%esp
+    2b03:	68 25 64 00 00       	push   $0x6425
+    2b08:	6a 01                	push   $0x1
+    2b0a:	e8 fd 27 00 00       	call   530c <printf>
+    2b0f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2b12:	e8 1f 26 00 00       	call   5136 <exit>
+  for(i = 0; i < 500; i++){
+    2b17:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2b1b:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2b22:	7e 8e                	jle    2ab2 <bigdir+0x74>
+    }
+  }
+
+  unlink("bd");
+    2b24:	83 ec 0c             	sub    $0xc,%esp
+    2b27:	68 0c 64 00 00       	push   $0x640c
+    2b2c:	e8 4b 26 00 00       	call   517c <unlink>
+    2b31:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 500; i++){
+    2b34:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    2b3b:	eb 64                	jmp    2ba1 <bigdir+0x163>
+    name[0] = 'x';
+    2b3d:	c6 45 e6 78          	movb   $0x78,-0x1a(%ebp)
+    name[1] = '0' + (i / 64);
+    2b41:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    2b44:	8d 50 3f             	lea    0x3f(%eax),%edx
+    2b47:	85 c0                	test   %eax,%eax
+    2b49:	0f 48 c2             	cmovs  %edx,%eax
+    2b4c:	c1 f8 06             	sar    $0x6,%eax
+    2b4f:	83 c0 30             	add    $0x30,%eax
+    2b52:	88 45 e7             	mov    %al,-0x19(%ebp)
+    name[2] = '0' + (i % 64);
+    2b55:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    2b58:	89 d0                	mov    %edx,%eax
+    2b5a:	c1 f8 1f             	sar    $0x1f,%eax
+    2b5d:	c1 e8 1a             	shr    $0x1a,%eax
+    2b60:	01 c2                	add    %eax,%edx
+    2b62:	83 e2 3f             	and    $0x3f,%edx
+    2b65:	29 c2                	sub    %eax,%edx
+    2b67:	89 d0                	mov    %edx,%eax
+    2b69:	83 c0 30             	add    $0x30,%eax
+    2b6c:	88 45 e8             	mov    %al,-0x18(%ebp)
+    name[3] = '\0';
+    2b6f:	c6 45 e9 00          	movb   $0x0,-0x17(%ebp)
+    if(unlink(name) != 0){
+    2b73:	83 ec 0c             	sub    $0xc,%esp
+    2b76:	8d 45 e6             	lea    -0x1a(%ebp),%eax
+    2b79:	50                   	push   %eax
+    2b7a:	e8 fd 25 00 00       	call   517c <unlink>
+    2b7f:	83 c4 10             	add    $0x10,%esp
+    2b82:	85 c0                	test   %eax,%eax
+    2b84:	74 17                	je     2b9d <bigdir+0x15f>
+      printf(1, "bigdir unlink failed");
+    2b86:	83 ec 08             	sub    $0x8,%esp
+    2b89:	68 39 64 00 00       	push   $0x6439
+    2b8e:	6a 01                	push   $0x1
+    2b90:	e8 77 27 00 00       	call   530c <printf>
+    2b95:	83 c4 10             	add    $0x10,%esp
+      exit();
+    2b98:	e8 99 25 00 00       	call   5136 <exit>
+  for(i = 0; i < 500; i++){
+    2b9d:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    2ba1:	81 7d f4 f3 01 00 00 	cmpl   $0x1f3,-0xc(%ebp)
+    2ba8:	7e 93                	jle    2b3d <bigdir+0xff>
+    }
+  }
+
+  printf(1, "bigdir ok\n");
+    2baa:	83 ec 08             	sub    $0x8,%esp
+    2bad:	68 4e 64 00 00       	push   $0x644e
+    2bb2:	6a 01                	push   $0x1
+    2bb4:	e8 53 27 00 00       	call   530c <printf>
+    2bb9:	83 c4 10             	add    $0x10,%esp
+}
+    2bbc:	90                   	nop
+    2bbd:	c9                   	leave
+    2bbe:	c3                   	ret
+
+00002bbf <subdir>:
+
+void
+subdir(void)
+{
+    2bbf:	55                   	push   %ebp
+    2bc0:	89 e5                	mov    %esp,%ebp
+    2bc2:	83 ec 18             	sub    $0x18,%esp
+  int fd, cc;
+
+  printf(1, "subdir test\n");
+    2bc5:	83 ec 08             	sub    $0x8,%esp
+    2bc8:	68 59 64 00 00       	push   $0x6459
+    2bcd:	6a 01                	push   $0x1
+    2bcf:	e8 38 27 00 00       	call   530c <printf>
+    2bd4:	83 c4 10             	add    $0x10,%esp
+
+  unlink("ff");
+    2bd7:	83 ec 0c             	sub    $0xc,%esp
+    2bda:	68 66 64 00 00       	push   $0x6466
+    2bdf:	e8 98 25 00 00       	call   517c <unlink>
+    2be4:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dd") != 0){
+    2be7:	83 ec 0c             	sub    $0xc,%esp
+    2bea:	68 69 64 00 00       	push   $0x6469
+    2bef:	e8 9d 25 00 00       	call   5191 <mkdir>
+    2bf4:	83 c4 10             	add    $0x10,%esp
+    2bf7:	85 c0                	test   %eax,%eax
+    2bf9:	74 17                	je     2c12 <subdir+0x53>
+    printf(1, "subdir mkdir dd failed\n");
+    2bfb:	83 ec 08             	sub    $0x8,%esp
+    2bfe:	68 6c 64 00 00       	push   $0x646c
+    2c03:	6a 01                	push   $0x1
+    2c05:	e8 02 27 00 00       	call   530c <printf>
+    2c0a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c0d:	e8 24 25 00 00       	call   5136 <exit>
+  }
+
+  fd = open("dd/ff", O_CREATE | O_RDWR);
+    2c12:	83 ec 08             	sub    $0x8,%esp
+    2c15:	68 02 02 00 00       	push   $0x202
+    2c1a:	68 84 64 00 00       	push   $0x6484
+    2c1f:	e8 4a 25 00 00       	call   516e <open>
+    2c24:	83 c4 10             	add    $0x10,%esp
+    2c27:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2c2a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2c2e:	79 17                	jns    2c47 <subdir+0x88>
+    printf(1, "create dd/ff failed\n");
+    2c30:	83 ec 08             	sub    $0x8,%esp
+    2c33:	68 8a 64 00 00       	push   $0x648a
+    2c38:	6a 01                	push   $0x1
+    2c3a:	e8 cd 26 00 00       	call   530c <printf>
+    2c3f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c42:	e8 ef 24 00 00       	call   5136 <exit>
+  }
+  write(fd, "ff", 2);
+    2c47:	83 ec 04             	sub    $0x4,%esp
+    2c4a:	6a 02                	push   $0x2
+    2c4c:	68 66 64 00 00       	push   $0x6466
+    2c51:	ff 75 f4             	push   -0xc(%ebp)
+    2c54:	e8 f9 24 00 00       	call   5152 <write>
+    2c59:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2c5c:	83 ec 0c             	sub    $0xc,%esp
+    2c5f:	ff 75 f4             	push   -0xc(%ebp)
+    2c62:	e8 f2 24 00 00       	call   5159 <close>
+    2c67:	83 c4 10             	add    $0x10,%esp
+  
+  if(unlink("dd") >= 0){
+    2c6a:	83 ec 0c             	sub    $0xc,%esp
+    2c6d:	68 69 64 00 00       	push   $0x6469
+    2c72:	e8 05 25 00 00       	call   517c <unlink>
+    2c77:	83 c4 10             	add    $0x10,%esp
+    2c7a:	85 c0                	test   %eax,%eax
+    2c7c:	78 17                	js     2c95 <subdir+0xd6>
+    printf(1, "unlink dd (non-empty dir) succeeded!\n");
+    2c7e:	83 ec 08             	sub    $0x8,%esp
+    2c81:	68 a0 64 00 00       	push   $0x64a0
+    2c86:	6a 01                	push   $0x1
+    2c88:	e8 7f 26 00 00       	call   530c <printf>
+    2c8d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2c90:	e8 a1 24 00 00       	call   5136 <exit>
+  }
+
+  if(mkdir("/dd/dd") != 0){
+    2c95:	83 ec 0c             	sub    $0xc,%esp
+    2c98:	68 c6 64 00 00       	push   $0x64c6
+    2c9d:	e8 ef 24 00 00       	call   5191 <mkdir>
+    2ca2:	83 c4 10             	add    $0x10,%esp
+    2ca5:	85 c0                	test   %eax,%eax
+    2ca7:	74 17                	je     2cc0 <subdir+0x101>
+    printf(1, "subdir mkdir dd/dd failed\n");
+    2ca9:	83 ec 08             	sub    $0x8,%esp
+    2cac:	68 cd 64 00 00       	push   $0x64cd
+    2cb1:	6a 01                	push   $0x1
+    2cb3:	e8 54 26 00 00       	call   530c <printf>
+    2cb8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cbb:	e8 76 24 00 00       	call   5136 <exit>
+  }
+
+  fd = open("dd/dd/ff", O_CREATE | O_RDWR);
+    2cc0:	83 ec 08             	sub    $0x8,%esp
+    2cc3:	68 02 02 00 00       	push   $0x202
+    2cc8:	68 e8 64 00 00       	push   $0x64e8
+    2ccd:	e8 9c 24 00 00       	call   516e <open>
+    2cd2:	83 c4 10             	add    $0x10,%esp
+    2cd5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2cd8:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2cdc:	79 17                	jns    2cf5 <subdir+0x136>
+    printf(1, "create dd/dd/ff failed\n");
+    2cde:	83 ec 08             	sub    $0x8,%esp
+    2ce1:	68 f1 64 00 00       	push   $0x64f1
+    2ce6:	6a 01                	push   $0x1
+    2ce8:	e8 1f 26 00 00       	call   530c <printf>
+    2ced:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2cf0:	e8 41 24 00 00       	call   5136 <exit>
+  }
+  write(fd, "FF", 2);
+    2cf5:	83 ec 04             	sub    $0x4,%esp
+    2cf8:	6a 02                	push   $0x2
+    2cfa:	68 09 65 00 00       	push   $0x6509
+    2cff:	ff 75 f4             	push   -0xc(%ebp)
+    2d02:	e8 4b 24 00 00       	call   5152 <write>
+    2d07:	83 c4 10             	add    $0x10,%esp
+  close(fd);
+    2d0a:	83 ec 0c             	sub    $0xc,%esp
+    2d0d:	ff 75 f4             	push   -0xc(%ebp)
+    2d10:	e8 44 24 00 00       	call   5159 <close>
+    2d15:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dd/dd/../ff", 0);
+    2d18:	83 ec 08             	sub    $0x8,%esp
+    2d1b:	6a 00                	push   $0x0
+    2d1d:	68 0c 65 00 00       	push   $0x650c
+    2d22:	e8 47 24 00 00       	call   516e <open>
+    2d27:	83 c4 10             	add    $0x10,%esp
+    2d2a:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2d2d:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2d31:	79 17                	jns    2d4a <subdir+0x18b>
+    printf(1, "open dd/dd/../ff failed\n");
+    2d33:	83 ec 08             	sub    $0x8,%esp
+    2d36:	68 18 65 00 00       	push   $0x6518
+    2d3b:	6a 01                	push   $0x1
+    2d3d:	e8 ca 25 00 00       	call   530c <printf>
+    2d42:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d45:	e8 ec 23 00 00       	call   5136 <exit>
+  }
+  cc = read(fd, buf, sizeof(buf));
+    2d4a:	83 ec 04             	sub    $0x4,%esp
+    2d4d:	68 00 20 00 00       	push   $0x2000
+    2d52:	68 20 7e 00 00       	push   $0x7e20
+    2d57:	ff 75 f4             	push   -0xc(%ebp)
+    2d5a:	e8 ec 23 00 00       	call   514b <read>
+    2d5f:	83 c4 10             	add    $0x10,%esp
+    2d62:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(cc != 2 || buf[0] != 'f'){
+    2d65:	83 7d f0 02          	cmpl   $0x2,-0x10(%ebp)
+    2d69:	75 0b                	jne    2d76 <subdir+0x1b7>
+    2d6b:	0f b6 05 20 7e 00 00 	movzbl 0x7e20,%eax
+    2d72:	3c 66                	cmp    $0x66,%al
+    2d74:	74 17                	je     2d8d <subdir+0x1ce>
+    printf(1, "dd/dd/../ff wrong content\n");
+    2d76:	83 ec 08             	sub    $0x8,%esp
+    2d79:	68 31 65 00 00       	push   $0x6531
+    2d7e:	6a 01                	push   $0x1
+    2d80:	e8 87 25 00 00       	call   530c <printf>
+    2d85:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2d88:	e8 a9 23 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    2d8d:	83 ec 0c             	sub    $0xc,%esp
+    2d90:	ff 75 f4             	push   -0xc(%ebp)
+    2d93:	e8 c1 23 00 00       	call   5159 <close>
+    2d98:	83 c4 10             	add    $0x10,%esp
+
+  if(link("dd/dd/ff", "dd/dd/ffff") != 0){
+    2d9b:	83 ec 08             	sub    $0x8,%esp
+    2d9e:	68 4c 65 00 00       	push   $0x654c
+    2da3:	68 e8 64 00 00       	push   $0x64e8
+    2da8:	e8 dd 23 00 00       	call   518a <link>
+    2dad:	83 c4 10             	add    $0x10,%esp
+    2db0:	85 c0                	test   %eax,%eax
+    2db2:	74 17                	je     2dcb <subdir+0x20c>
+    printf(1, "link dd/dd/ff dd/dd/ffff failed\n");
+    2db4:	83 ec 08             	sub    $0x8,%esp
+    2db7:	68 58 65 00 00       	push   $0x6558
+    2dbc:	6a 01                	push   $0x1
+    2dbe:	e8 49 25 00 00       	call   530c <printf>
+    2dc3:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2dc6:	e8 6b 23 00 00       	call   5136 <exit>
+  }
+
+  if(unlink("dd/dd/ff") != 0){
+    2dcb:	83 ec 0c             	sub    $0xc,%esp
+    2dce:	68 e8 64 00 00       	push   $0x64e8
+    2dd3:	e8 a4 23 00 00       	call   517c <unlink>
+    2dd8:	83 c4 10             	add    $0x10,%esp
+    2ddb:	85 c0                	test   %eax,%eax
+    2ddd:	74 17                	je     2df6 <subdir+0x237>
+    printf(1, "unlink dd/dd/ff failed\n");
+    2ddf:	83 ec 08             	sub    $0x8,%esp
+    2de2:	68 79 65 00 00       	push   $0x6579
+    2de7:	6a 01                	push   $0x1
+    2de9:	e8 1e 25 00 00       	call   530c <printf>
+    2dee:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2df1:	e8 40 23 00 00       	call   5136 <exit>
+  }
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2df6:	83 ec 08             	sub    $0x8,%esp
+    2df9:	6a 00                	push   $0x0
+    2dfb:	68 e8 64 00 00       	push   $0x64e8
+    2e00:	e8 69 23 00 00       	call   516e <open>
+    2e05:	83 c4 10             	add    $0x10,%esp
+    2e08:	85 c0                	test   %eax,%eax
+    2e0a:	78 17                	js     2e23 <subdir+0x264>
+    printf(1, "open (unlinked) dd/dd/ff succeeded\n");
+    2e0c:	83 ec 08             	sub    $0x8,%esp
+    2e0f:	68 94 65 00 00       	push   $0x6594
+    2e14:	6a 01                	push   $0x1
+    2e16:	e8 f1 24 00 00       	call   530c <printf>
+    2e1b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e1e:	e8 13 23 00 00       	call   5136 <exit>
+  }
+
+  if(chdir("dd") != 0){
+    2e23:	83 ec 0c             	sub    $0xc,%esp
+    2e26:	68 69 64 00 00       	push   $0x6469
+    2e2b:	e8 68 23 00 00       	call   5198 <chdir>
+    2e30:	83 c4 10             	add    $0x10,%esp
+    2e33:	85 c0                	test   %eax,%eax
+    2e35:	74 17                	je     2e4e <subdir+0x28f>
+    printf(1, "chdir dd failed\n");
+    2e37:	83 ec 08             	sub    $0x8,%esp
+    2e3a:	68 b8 65 00 00       	push   $0x65b8
+    2e3f:	6a 01                	push   $0x1
+    2e41:	e8 c6 24 00 00       	call   530c <printf>
+    2e46:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e49:	e8 e8 22 00 00       	call   5136 <exit>
+  }
+  if(chdir("dd/../../dd") != 0){
+    2e4e:	83 ec 0c             	sub    $0xc,%esp
+    2e51:	68 c9 65 00 00       	push   $0x65c9
+    2e56:	e8 3d 23 00 00       	call   5198 <chdir>
+    2e5b:	83 c4 10             	add    $0x10,%esp
+    2e5e:	85 c0                	test   %eax,%eax
+    2e60:	74 17                	je     2e79 <subdir+0x2ba>
+    printf(1, "chdir dd/../../dd failed\n");
+    2e62:	83 ec 08             	sub    $0x8,%esp
+    2e65:	68 d5 65 00 00       	push   $0x65d5
+    2e6a:	6a 01                	push   $0x1
+    2e6c:	e8 9b 24 00 00       	call   530c <printf>
+    2e71:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e74:	e8 bd 22 00 00       	call   5136 <exit>
+  }
+  if(chdir("dd/../../../dd") != 0){
+    2e79:	83 ec 0c             	sub    $0xc,%esp
+    2e7c:	68 ef 65 00 00       	push   $0x65ef
+    2e81:	e8 12 23 00 00       	call   5198 <chdir>
+    2e86:	83 c4 10             	add    $0x10,%esp
+    2e89:	85 c0                	test   %eax,%eax
+    2e8b:	74 17                	je     2ea4 <subdir+0x2e5>
+    printf(1, "chdir dd/../../dd failed\n");
+    2e8d:	83 ec 08             	sub    $0x8,%esp
+    2e90:	68 d5 65 00 00       	push   $0x65d5
+    2e95:	6a 01                	push   $0x1
+    2e97:	e8 70 24 00 00       	call   530c <printf>
+    2e9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2e9f:	e8 92 22 00 00       	call   5136 <exit>
+  }
+  if(chdir("./..") != 0){
+    2ea4:	83 ec 0c             	sub    $0xc,%esp
+    2ea7:	68 fe 65 00 00       	push   $0x65fe
+    2eac:	e8 e7 22 00 00       	call   5198 <chdir>
+    2eb1:	83 c4 10             	add    $0x10,%esp
+    2eb4:	85 c0                	test   %eax,%eax
+    2eb6:	74 17                	je     2ecf <subdir+0x310>
+    printf(1, "chdir ./.. failed\n");
+    2eb8:	83 ec 08             	sub    $0x8,%esp
+    2ebb:	68 03 66 00 00       	push   $0x6603
+    2ec0:	6a 01                	push   $0x1
+    2ec2:	e8 45 24 00 00       	call   530c <printf>
+    2ec7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2eca:	e8 67 22 00 00       	call   5136 <exit>
+  }
+
+  fd = open("dd/dd/ffff", 0);
+    2ecf:	83 ec 08             	sub    $0x8,%esp
+    2ed2:	6a 00                	push   $0x0
+    2ed4:	68 4c 65 00 00       	push   $0x654c
+    2ed9:	e8 90 22 00 00       	call   516e <open>
+    2ede:	83 c4 10             	add    $0x10,%esp
+    2ee1:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    2ee4:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    2ee8:	79 17                	jns    2f01 <subdir+0x342>
+    printf(1, "open dd/dd/ffff failed\n");
+    2eea:	83 ec 08             	sub    $0x8,%esp
+    2eed:	68 16 66 00 00       	push   $0x6616
+    2ef2:	6a 01                	push   $0x1
+    2ef4:	e8 13 24 00 00       	call   530c <printf>
+    2ef9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2efc:	e8 35 22 00 00       	call   5136 <exit>
+  }
+  if(read(fd, buf, sizeof(buf)) != 2){
+    2f01:	83 ec 04             	sub    $0x4,%esp
+    2f04:	68 00 20 00 00       	push   $0x2000
+    2f09:	68 20 7e 00 00       	push   $0x7e20
+    2f0e:	ff 75 f4             	push   -0xc(%ebp)
+    2f11:	e8 35 22 00 00       	call   514b <read>
+    2f16:	83 c4 10             	add    $0x10,%esp
+    2f19:	83 f8 02             	cmp    $0x2,%eax
+    2f1c:	74 17                	je     2f35 <subdir+0x376>
+    printf(1, "read dd/dd/ffff wrong len\n");
+    2f1e:	83 ec 08             	sub    $0x8,%esp
+    2f21:	68 2e 66 00 00       	push   $0x662e
+    2f26:	6a 01                	push   $0x1
+    2f28:	e8 df 23 00 00       	call   530c <printf>
+    2f2d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f30:	e8 01 22 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    2f35:	83 ec 0c             	sub    $0xc,%esp
+    2f38:	ff 75 f4             	push   -0xc(%ebp)
+    2f3b:	e8 19 22 00 00       	call   5159 <close>
+    2f40:	83 c4 10             	add    $0x10,%esp
+
+  if(open("dd/dd/ff", O_RDONLY) >= 0){
+    2f43:	83 ec 08             	sub    $0x8,%esp
+    2f46:	6a 00                	push   $0x0
+    2f48:	68 e8 64 00 00       	push   $0x64e8
+    2f4d:	e8 1c 22 00 00       	call   516e <open>
+    2f52:	83 c4 10             	add    $0x10,%esp
+    2f55:	85 c0                	test   %eax,%eax
+    2f57:	78 17                	js     2f70 <subdir+0x3b1>
+    printf(1, "open (unlinked) dd/dd/ff succeeded!\n");
+    2f59:	83 ec 08             	sub    $0x8,%esp
+    2f5c:	68 4c 66 00 00       	push   $0x664c
+    2f61:	6a 01                	push   $0x1
+    2f63:	e8 a4 23 00 00       	call   530c <printf>
+    2f68:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f6b:	e8 c6 21 00 00       	call   5136 <exit>
+  }
+
+  if(open("dd/ff/ff", O_CREATE|O_RDWR) >= 0){
+    2f70:	83 ec 08             	sub    $0x8,%esp
+    2f73:	68 02 02 00 00       	push   $0x202
+    2f78:	68 71 66 00 00       	push   $0x6671
+    2f7d:	e8 ec 21 00 00       	call   516e <open>
+    2f82:	83 c4 10             	add    $0x10,%esp
+    2f85:	85 c0                	test   %eax,%eax
+    2f87:	78 17                	js     2fa0 <subdir+0x3e1>
+    printf(1, "create dd/ff/ff succeeded!\n");
+    2f89:	83 ec 08             	sub    $0x8,%esp
+    2f8c:	68 7a 66 00 00       	push   $0x667a
+    2f91:	6a 01                	push   $0x1
+    2f93:	e8 74 23 00 00       	call   530c <printf>
+    2f98:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2f9b:	e8 96 21 00 00       	call   5136 <exit>
+  }
+  if(open("dd/xx/ff", O_CREATE|O_RDWR) >= 0){
+    2fa0:	83 ec 08             	sub    $0x8,%esp
+    2fa3:	68 02 02 00 00       	push   $0x202
+    2fa8:	68 96 66 00 00       	push   $0x6696
+    2fad:	e8 bc 21 00 00       	call   516e <open>
+    2fb2:	83 c4 10             	add    $0x10,%esp
+    2fb5:	85 c0                	test   %eax,%eax
+    2fb7:	78 17                	js     2fd0 <subdir+0x411>
+    printf(1, "create dd/xx/ff succeeded!\n");
+    2fb9:	83 ec 08             	sub    $0x8,%esp
+    2fbc:	68 9f 66 00 00       	push   $0x669f
+    2fc1:	6a 01                	push   $0x1
+    2fc3:	e8 44 23 00 00       	call   530c <printf>
+    2fc8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2fcb:	e8 66 21 00 00       	call   5136 <exit>
+  }
+  if(open("dd", O_CREATE) >= 0){
+    2fd0:	83 ec 08             	sub    $0x8,%esp
+    2fd3:	68 00 02 00 00       	push   $0x200
+    2fd8:	68 69 64 00 00       	push   $0x6469
+    2fdd:	e8 8c 21 00 00       	call   516e <open>
+    2fe2:	83 c4 10             	add    $0x10,%esp
+    2fe5:	85 c0                	test   %eax,%eax
+    2fe7:	78 17                	js     3000 <subdir+0x441>
+    printf(1, "create dd succeeded!\n");
+    2fe9:	83 ec 08             	sub    $0x8,%esp
+    2fec:	68 bb 66 00 00       	push   $0x66bb
+    2ff1:	6a 01                	push   $0x1
+    2ff3:	e8 14 23 00 00       	call   530c <printf>
+    2ff8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    2ffb:	e8 36 21 00 00       	call   5136 <exit>
+  }
+  if(open("dd", O_RDWR) >= 0){
+    3000:	83 ec 08             	sub    $0x8,%esp
+    3003:	6a 02                	push   $0x2
+    3005:	68 69 64 00 00       	push   $0x6469
+    300a:	e8 5f 21 00 00       	call   516e <open>
+    300f:	83 c4 10             	add    $0x10,%esp
+    3012:	85 c0                	test   %eax,%eax
+    3014:	78 17                	js     302d <subdir+0x46e>
+    printf(1, "open dd rdwr succeeded!\n");
+    3016:	83 ec 08             	sub    $0x8,%esp
+    3019:	68 d1 66 00 00       	push   $0x66d1
+    301e:	6a 01                	push   $0x1
+    3020:	e8 e7 22 00 00       	call   530c <printf>
+    3025:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3028:	e8 09 21 00 00       	call   5136 <exit>
+  }
+  if(open("dd", O_WRONLY) >= 0){
+    302d:	83 ec 08             	sub    $0x8,%esp
+    3030:	6a 01                	push   $0x1
+    3032:	68 69 64 00 00       	push   $0x6469
+    3037:	e8 32 21 00 00       	call   516e <open>
+    303c:	83 c4 10             	add    $0x10,%esp
+    303f:	85 c0                	test   %eax,%eax
+    3041:	78 17                	js     305a <subdir+0x49b>
+    printf(1, "open dd wronly succeeded!\n");
+    3043:	83 ec 08             	sub    $0x8,%esp
+    3046:	68 ea 66 00 00       	push   $0x66ea
+    304b:	6a 01                	push   $0x1
+    304d:	e8 ba 22 00 00       	call   530c <printf>
+    3052:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3055:	e8 dc 20 00 00       	call   5136 <exit>
+  }
+  if(link("dd/ff/ff", "dd/dd/xx") == 0){
+    305a:	83 ec 08             	sub    $0x8,%esp
+    305d:	68 05 67 00 00       	push   $0x6705
+    3062:	68 71 66 00 00       	push   $0x6671
+    3067:	e8 1e 21 00 00       	call   518a <link>
+    306c:	83 c4 10             	add    $0x10,%esp
+    306f:	85 c0                	test   %eax,%eax
+    3071:	75 17                	jne    308a <subdir+0x4cb>
+    printf(1, "link dd/ff/ff dd/dd/xx succeeded!\n");
+    3073:	83 ec 08             	sub    $0x8,%esp
+    3076:	68 10 67 00 00       	push   $0x6710
+    307b:	6a 01                	push   $0x1
+    307d:	e8 8a 22 00 00       	call   530c <printf>
+    3082:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3085:	e8 ac 20 00 00       	call   5136 <exit>
+  }
+  if(link("dd/xx/ff", "dd/dd/xx") == 0){
+    308a:	83 ec 08             	sub    $0x8,%esp
+    308d:	68 05 67 00 00       	push   $0x6705
+    3092:	68 96 66 00 00       	push   $0x6696
+    3097:	e8 ee 20 00 00       	call   518a <link>
+    309c:	83 c4 10             	add    $0x10,%esp
+    309f:	85 c0                	test   %eax,%eax
+    30a1:	75 17                	jne    30ba <subdir+0x4fb>
+    printf(1, "link dd/xx/ff dd/dd/xx succeeded!\n");
+    30a3:	83 ec 08             	sub    $0x8,%esp
+    30a6:	68 34 67 00 00       	push   $0x6734
+    30ab:	6a 01                	push   $0x1
+    30ad:	e8 5a 22 00 00       	call   530c <printf>
+    30b2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30b5:	e8 7c 20 00 00       	call   5136 <exit>
+  }
+  if(link("dd/ff", "dd/dd/ffff") == 0){
+    30ba:	83 ec 08             	sub    $0x8,%esp
+    30bd:	68 4c 65 00 00       	push   $0x654c
+    30c2:	68 84 64 00 00       	push   $0x6484
+    30c7:	e8 be 20 00 00       	call   518a <link>
+    30cc:	83 c4 10             	add    $0x10,%esp
+    30cf:	85 c0                	test   %eax,%eax
+    30d1:	75 17                	jne    30ea <subdir+0x52b>
+    printf(1, "link dd/ff dd/dd/ffff succeeded!\n");
+    30d3:	83 ec 08             	sub    $0x8,%esp
+    30d6:	68 58 67 00 00       	push   $0x6758
+    30db:	6a 01                	push   $0x1
+    30dd:	e8 2a 22 00 00       	call   530c <printf>
+    30e2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    30e5:	e8 4c 20 00 00       	call   5136 <exit>
+  }
+  if(mkdir("dd/ff/ff") == 0){
+    30ea:	83 ec 0c             	sub    $0xc,%esp
+    30ed:	68 71 66 00 00       	push   $0x6671
+    30f2:	e8 9a 20 00 00       	call   5191 <mkdir>
+    30f7:	83 c4 10             	add    $0x10,%esp
+    30fa:	85 c0                	test   %eax,%eax
+    30fc:	75 17                	jne    3115 <subdir+0x556>
+    printf(1, "mkdir dd/ff/ff succeeded!\n");
+    30fe:	83 ec 08             	sub    $0x8,%esp
+    3101:	68 7a 67 00 00       	push   $0x677a
+    3106:	6a 01                	push   $0x1
+    3108:	e8 ff 21 00 00       	call   530c <printf>
+    310d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3110:	e8 21 20 00 00       	call   5136 <exit>
+  }
+  if(mkdir("dd/xx/ff") == 0){
+    3115:	83 ec 0c             	sub    $0xc,%esp
+    3118:	68 96 66 00 00       	push   $0x6696
+    311d:	e8 6f 20 00 00       	call   5191 <mkdir>
+    3122:	83 c4 10             	add    $0x10,%esp
+    3125:	85 c0                	test   %eax,%eax
+    3127:	75 17                	jne    3140 <subdir+0x581>
+    printf(1, "mkdir dd/xx/ff succeeded!\n");
+    3129:	83 ec 08             	sub    $0x8,%esp
+    312c:	68 95 67 00 00       	push   $0x6795
+    3131:	6a 01                	push   $0x1
+    3133:	e8 d4 21 00 00       	call   530c <printf>
+    3138:	83 c4 10             	add    $0x10,%esp
+    exit();
+    313b:	e8 f6 1f 00 00       	call   5136 <exit>
+  }
+  if(mkdir("dd/dd/ffff") == 0){
+    3140:	83 ec 0c             	sub    $0xc,%esp
+    3143:	68 4c 65 00 00       	push   $0x654c
+    3148:	e8 44 20 00 00       	call   5191 <mkdir>
+    314d:	83 c4 10             	add    $0x10,%esp
+    3150:	85 c0                	test   %eax,%eax
+    3152:	75 17                	jne    316b <subdir+0x5ac>
+    printf(1, "mkdir dd/dd/ffff succeeded!\n");
+    3154:	83 ec 08             	sub    $0x8,%esp
+    3157:	68 b0 67 00 00       	push   $0x67b0
+    315c:	6a 01                	push   $0x1
+    315e:	e8 a9 21 00 00       	call   530c <printf>
+    3163:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3166:	e8 cb 1f 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd/xx/ff") == 0){
+    316b:	83 ec 0c             	sub    $0xc,%esp
+    316e:	68 96 66 00 00       	push   $0x6696
+    3173:	e8 04 20 00 00       	call   517c <unlink>
+    3178:	83 c4 10             	add    $0x10,%esp
+    317b:	85 c0                	test   %eax,%eax
+    317d:	75 17                	jne    3196 <subdir+0x5d7>
+    printf(1, "unlink dd/xx/ff succeeded!\n");
+    317f:	83 ec 08             	sub    $0x8,%esp
+    3182:	68 cd 67 00 00       	push   $0x67cd
+    3187:	6a 01                	push   $0x1
+    3189:	e8 7e 21 00 00       	call   530c <printf>
+    318e:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3191:	e8 a0 1f 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd/ff/ff") == 0){
+    3196:	83 ec 0c             	sub    $0xc,%esp
+    3199:	68 71 66 00 00       	push   $0x6671
+    319e:	e8 d9 1f 00 00       	call   517c <unlink>
+    31a3:	83 c4 10             	add    $0x10,%esp
+    31a6:	85 c0                	test   %eax,%eax
+    31a8:	75 17                	jne    31c1 <subdir+0x602>
+    printf(1, "unlink dd/ff/ff succeeded!\n");
+    31aa:	83 ec 08             	sub    $0x8,%esp
+    31ad:	68 e9 67 00 00       	push   $0x67e9
+    31b2:	6a 01                	push   $0x1
+    31b4:	e8 53 21 00 00       	call   530c <printf>
+    31b9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31bc:	e8 75 1f 00 00       	call   5136 <exit>
+  }
+  if(chdir("dd/ff") == 0){
+    31c1:	83 ec 0c             	sub    $0xc,%esp
+    31c4:	68 84 64 00 00       	push   $0x6484
+    31c9:	e8 ca 1f 00 00       	call   5198 <chdir>
+    31ce:	83 c4 10             	add    $0x10,%esp
+    31d1:	85 c0                	test   %eax,%eax
+    31d3:	75 17                	jne    31ec <subdir+0x62d>
+    printf(1, "chdir dd/ff succeeded!\n");
+    31d5:	83 ec 08             	sub    $0x8,%esp
+    31d8:	68 05 68 00 00       	push   $0x6805
+    31dd:	6a 01                	push   $0x1
+    31df:	e8 28 21 00 00       	call   530c <printf>
+    31e4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    31e7:	e8 4a 1f 00 00       	call   5136 <exit>
+  }
+  if(chdir("dd/xx") == 0){
+    31ec:	83 ec 0c             	sub    $0xc,%esp
+    31ef:	68 1d 68 00 00       	push   $0x681d
+    31f4:	e8 9f 1f 00 00       	call   5198 <chdir>
+    31f9:	83 c4 10             	add    $0x10,%esp
+    31fc:	85 c0                	test   %eax,%eax
+    31fe:	75 17                	jne    3217 <subdir+0x658>
+    printf(1, "chdir dd/xx succeeded!\n");
+    3200:	83 ec 08             	sub    $0x8,%esp
+    3203:	68 23 68 00 00       	push   $0x6823
+    3208:	6a 01                	push   $0x1
+    320a:	e8 fd 20 00 00       	call   530c <printf>
+    320f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3212:	e8 1f 1f 00 00       	call   5136 <exit>
+  }
+
+  if(unlink("dd/dd/ffff") != 0){
+    3217:	83 ec 0c             	sub    $0xc,%esp
+    321a:	68 4c 65 00 00       	push   $0x654c
+    321f:	e8 58 1f 00 00       	call   517c <unlink>
+    3224:	83 c4 10             	add    $0x10,%esp
+    3227:	85 c0                	test   %eax,%eax
+    3229:	74 17                	je     3242 <subdir+0x683>
+    printf(1, "unlink dd/dd/ff failed\n");
+    322b:	83 ec 08             	sub    $0x8,%esp
+    322e:	68 79 65 00 00       	push   $0x6579
+    3233:	6a 01                	push   $0x1
+    3235:	e8 d2 20 00 00       	call   530c <printf>
+    323a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    323d:	e8 f4 1e 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd/ff") != 0){
+    3242:	83 ec 0c             	sub    $0xc,%esp
+    3245:	68 84 64 00 00       	push   $0x6484
+    324a:	e8 2d 1f 00 00       	call   517c <unlink>
+    324f:	83 c4 10             	add    $0x10,%esp
+    3252:	85 c0                	test   %eax,%eax
+    3254:	74 17                	je     326d <subdir+0x6ae>
+    printf(1, "unlink dd/ff failed\n");
+    3256:	83 ec 08             	sub    $0x8,%esp
+    3259:	68 3b 68 00 00       	push   $0x683b
+    325e:	6a 01                	push   $0x1
+    3260:	e8 a7 20 00 00       	call   530c <printf>
+    3265:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3268:	e8 c9 1e 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd") == 0){
+    326d:	83 ec 0c             	sub    $0xc,%esp
+    3270:	68 69 64 00 00       	push   $0x6469
+    3275:	e8 02 1f 00 00       	call   517c <unlink>
+    327a:	83 c4 10             	add    $0x10,%esp
+    327d:	85 c0                	test   %eax,%eax
+    327f:	75 17                	jne    3298 <subdir+0x6d9>
+    printf(1, "unlink non-empty dd succeeded!\n");
+    3281:	83 ec 08             	sub    $0x8,%esp
+    3284:	68 50 68 00 00       	push   $0x6850
+    3289:	6a 01                	push   $0x1
+    328b:	e8 7c 20 00 00       	call   530c <printf>
+    3290:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3293:	e8 9e 1e 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd/dd") < 0){
+    3298:	83 ec 0c             	sub    $0xc,%esp
+    329b:	68 70 68 00 00       	push   $0x6870
+    32a0:	e8 d7 1e 00 00       	call   517c <unlink>
+    32a5:	83 c4 10             	add    $0x10,%esp
+    32a8:	85 c0                	test   %eax,%eax
+    32aa:	79 17                	jns    32c3 <subdir+0x704>
+    printf(1, "unlink dd/dd failed\n");
+    32ac:	83 ec 08             	sub    $0x8,%esp
+    32af:	68 76 68 00 00       	push   $0x6876
+    32b4:	6a 01                	push   $0x1
+    32b6:	e8 51 20 00 00       	call   530c <printf>
+    32bb:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32be:	e8 73 1e 00 00       	call   5136 <exit>
+  }
+  if(unlink("dd") < 0){
+    32c3:	83 ec 0c             	sub    $0xc,%esp
+    32c6:	68 69 64 00 00       	push   $0x6469
+    32cb:	e8 ac 1e 00 00       	call   517c <unlink>
+    32d0:	83 c4 10             	add    $0x10,%esp
+    32d3:	85 c0                	test   %eax,%eax
+    32d5:	79 17                	jns    32ee <subdir+0x72f>
+    printf(1, "unlink dd failed\n");
+    32d7:	83 ec 08             	sub    $0x8,%esp
+    32da:	68 8b 68 00 00       	push   $0x688b
+    32df:	6a 01                	push   $0x1
+    32e1:	e8 26 20 00 00       	call   530c <printf>
+    32e6:	83 c4 10             	add    $0x10,%esp
+    exit();
+    32e9:	e8 48 1e 00 00       	call   5136 <exit>
+  }
+
+  printf(1, "subdir ok\n");
+    32ee:	83 ec 08             	sub    $0x8,%esp
+    32f1:	68 9d 68 00 00       	push   $0x689d
+    32f6:	6a 01                	push   $0x1
+    32f8:	e8 0f 20 00 00       	call   530c <printf>
+    32fd:	83 c4 10             	add    $0x10,%esp
+}
+    3300:	90                   	nop
+    3301:	c9                   	leave
+    3302:	c3                   	ret
+
+00003303 <bigwrite>:
+
+// test writes that are larger than the log.
+void
+bigwrite(void)
+{
+    3303:	55                   	push   %ebp
+    3304:	89 e5                	mov    %esp,%ebp
+    3306:	83 ec 18             	sub    $0x18,%esp
+  int fd, sz;
+
+  printf(1, "bigwrite test\n");
+    3309:	83 ec 08             	sub    $0x8,%esp
+    330c:	68 a8 68 00 00       	push   $0x68a8
+    3311:	6a 01                	push   $0x1
+    3313:	e8 f4 1f 00 00       	call   530c <printf>
+    3318:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigwrite");
+    331b:	83 ec 0c             	sub    $0xc,%esp
+    331e:	68 b7 68 00 00       	push   $0x68b7
+    3323:	e8 54 1e 00 00       	call   517c <unlink>
+    3328:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    332b:	c7 45 f4 f3 01 00 00 	movl   $0x1f3,-0xc(%ebp)
+    3332:	e9 a8 00 00 00       	jmp    33df <bigwrite+0xdc>
+    fd = open("bigwrite", O_CREATE | O_RDWR);
+    3337:	83 ec 08             	sub    $0x8,%esp
+    333a:	68 02 02 00 00       	push   $0x202
+    333f:	68 b7 68 00 00       	push   $0x68b7
+    3344:	e8 25 1e 00 00       	call   516e <open>
+    3349:	83 c4 10             	add    $0x10,%esp
+    334c:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    if(fd < 0){
+    334f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3353:	79 17                	jns    336c <bigwrite+0x69>
+      printf(1, "cannot create bigwrite\n");
+    3355:	83 ec 08             	sub    $0x8,%esp
+    3358:	68 c0 68 00 00       	push   $0x68c0
+    335d:	6a 01                	push   $0x1
+    335f:	e8 a8 1f 00 00       	call   530c <printf>
+    3364:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3367:	e8 ca 1d 00 00       	call   5136 <exit>
+    }
+    int i;
+    for(i = 0; i < 2; i++){
+    336c:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3373:	eb 3f                	jmp    33b4 <bigwrite+0xb1>
+      int cc = write(fd, buf, sz);
+    3375:	83 ec 04             	sub    $0x4,%esp
+    3378:	ff 75 f4             	push   -0xc(%ebp)
+    337b:	68 20 7e 00 00       	push   $0x7e20
+    3380:	ff 75 ec             	push   -0x14(%ebp)
+    3383:	e8 ca 1d 00 00       	call   5152 <write>
+    3388:	83 c4 10             	add    $0x10,%esp
+    338b:	89 45 e8             	mov    %eax,-0x18(%ebp)
+      if(cc != sz){
+    338e:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    3391:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3394:	74 1a                	je     33b0 <bigwrite+0xad>
+        printf(1, "write(%d) ret %d\n", sz, cc);
+    3396:	ff 75 e8             	push   -0x18(%ebp)
+    3399:	ff 75 f4             	push   -0xc(%ebp)
+    339c:	68 d8 68 00 00       	push   $0x68d8
+    33a1:	6a 01                	push   $0x1
+    33a3:	e8 64 1f 00 00       	call   530c <printf>
+    33a8:	83 c4 10             	add    $0x10,%esp
+        exit();
+    33ab:	e8 86 1d 00 00       	call   5136 <exit>
+    for(i = 0; i < 2; i++){
+    33b0:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    33b4:	83 7d f0 01          	cmpl   $0x1,-0x10(%ebp)
+    33b8:	7e bb                	jle    3375 <bigwrite+0x72>
+      }
+    }
+    close(fd);
+    33ba:	83 ec 0c             	sub    $0xc,%esp
+    33bd:	ff 75 ec             	push   -0x14(%ebp)
+    33c0:	e8 94 1d 00 00       	call   5159 <close>
+    33c5:	83 c4 10             	add    $0x10,%esp
+    unlink("bigwrite");
+    33c8:	83 ec 0c             	sub    $0xc,%esp
+    33cb:	68 b7 68 00 00       	push   $0x68b7
+    33d0:	e8 a7 1d 00 00       	call   517c <unlink>
+    33d5:	83 c4 10             	add    $0x10,%esp
+  for(sz = 499; sz < 12*512; sz += 471){
+    33d8:	81 45 f4 d7 01 00 00 	addl   $0x1d7,-0xc(%ebp)
+    33df:	81 7d f4 ff 17 00 00 	cmpl   $0x17ff,-0xc(%ebp)
+    33e6:	0f 8e 4b ff ff ff    	jle    3337 <bigwrite+0x34>
+  }
+
+  printf(1, "bigwrite ok\n");
+    33ec:	83 ec 08             	sub    $0x8,%esp
+    33ef:	68 ea 68 00 00       	push   $0x68ea
+    33f4:	6a 01                	push   $0x1
+    33f6:	e8 11 1f 00 00       	call   530c <printf>
+    33fb:	83 c4 10             	add    $0x10,%esp
+}
+    33fe:	90                   	nop
+    33ff:	c9                   	leave
+    3400:	c3                   	ret
+
+00003401 <bigfile>:
+
+void
+bigfile(void)
+{
+    3401:	55                   	push   %ebp
+    3402:	89 e5                	mov    %esp,%ebp
+    3404:	83 ec 18             	sub    $0x18,%esp
+  int fd, i, total, cc;
+
+  printf(1, "bigfile test\n");
+    3407:	83 ec 08             	sub    $0x8,%esp
+    340a:	68 f7 68 00 00       	push   $0x68f7
+    340f:	6a 01                	push   $0x1
+    3411:	e8 f6 1e 00 00       	call   530c <printf>
+    3416:	83 c4 10             	add    $0x10,%esp
+
+  unlink("bigfile");
+    3419:	83 ec 0c             	sub    $0xc,%esp
+    341c:	68 05 69 00 00       	push   $0x6905
+    3421:	e8 56 1d 00 00       	call   517c <unlink>
+    3426:	83 c4 10             	add    $0x10,%esp
+  fd = open("bigfile", O_CREATE | O_RDWR);
+    3429:	83 ec 08             	sub    $0x8,%esp
+    342c:	68 02 02 00 00       	push   $0x202
+    3431:	68 05 69 00 00       	push   $0x6905
+    3436:	e8 33 1d 00 00       	call   516e <open>
+    343b:	83 c4 10             	add    $0x10,%esp
+    343e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    3441:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    3445:	79 17                	jns    345e <bigfile+0x5d>
+    printf(1, "cannot create bigfile");
+    3447:	83 ec 08             	sub    $0x8,%esp
+    344a:	68 0d 69 00 00       	push   $0x690d
+    344f:	6a 01                	push   $0x1
+    3451:	e8 b6 1e 00 00       	call   530c <printf>
+    3456:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3459:	e8 d8 1c 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < 20; i++){
+    345e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3465:	eb 52                	jmp    34b9 <bigfile+0xb8>
+    memset(buf, i, 600);
+    3467:	83 ec 04             	sub    $0x4,%esp
+    346a:	68 58 02 00 00       	push   $0x258
+    346f:	ff 75 f4             	push   -0xc(%ebp)
+    3472:	68 20 7e 00 00       	push   $0x7e20
+    3477:	e8 76 17 00 00       	call   4bf2 <memset>
+    347c:	83 c4 10             	add    $0x10,%esp
+    if(write(fd, buf, 600) != 600){
+    347f:	83 ec 04             	sub    $0x4,%esp
+    3482:	68 58 02 00 00       	push   $0x258
+    3487:	68 20 7e 00 00       	push   $0x7e20
+    348c:	ff 75 ec             	push   -0x14(%ebp)
+    348f:	e8 be 1c 00 00       	call   5152 <write>
+    3494:	83 c4 10             	add    $0x10,%esp
+    3497:	3d 58 02 00 00       	cmp    $0x258,%eax
+    349c:	74 17                	je     34b5 <bigfile+0xb4>
+      printf(1, "write bigfile failed\n");
+    349e:	83 ec 08             	sub    $0x8,%esp
+    34a1:	68 23 69 00 00       	push   $0x6923
+    34a6:	6a 01                	push   $0x1
+    34a8:	e8 5f 1e 00 00       	call   530c <printf>
+    34ad:	83 c4 10             	add    $0x10,%esp
+      exit();
+    34b0:	e8 81 1c 00 00       	call   5136 <exit>
+  for(i = 0; i < 20; i++){
+    34b5:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    34b9:	83 7d f4 13          	cmpl   $0x13,-0xc(%ebp)
+    34bd:	7e a8                	jle    3467 <bigfile+0x66>
+    }
+  }
+  close(fd);
+    34bf:	83 ec 0c             	sub    $0xc,%esp
+    34c2:	ff 75 ec             	push   -0x14(%ebp)
+    34c5:	e8 8f 1c 00 00       	call   5159 <close>
+    34ca:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("bigfile", 0);
+    34cd:	83 ec 08             	sub    $0x8,%esp
+    34d0:	6a 00                	push   $0x0
+    34d2:	68 05 69 00 00       	push   $0x6905
+    34d7:	e8 92 1c 00 00       	call   516e <open>
+    34dc:	83 c4 10             	add    $0x10,%esp
+    34df:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    34e2:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    34e6:	79 17                	jns    34ff <bigfile+0xfe>
+    printf(1, "cannot open bigfile\n");
+    34e8:	83 ec 08             	sub    $0x8,%esp
+    34eb:	68 39 69 00 00       	push   $0x6939
+    34f0:	6a 01                	push   $0x1
+    34f2:	e8 15 1e 00 00       	call   530c <printf>
+    34f7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    34fa:	e8 37 1c 00 00       	call   5136 <exit>
+  }
+  total = 0;
+    34ff:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  for(i = 0; ; i++){
+    3506:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    350d:	83 ec 04             	sub    $0x4,%esp
+    3510:	68 2c 01 00 00       	push   $0x12c
+    3515:	68 20 7e 00 00       	push   $0x7e20
+    351a:	ff 75 ec             	push   -0x14(%ebp)
+    351d:	e8 29 1c 00 00       	call   514b <read>
+    3522:	83 c4 10             	add    $0x10,%esp
+    3525:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(cc < 0){
+    3528:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    352c:	79 17                	jns    3545 <bigfile+0x144>
+      printf(1, "read bigfile failed\n");
+    352e:	83 ec 08             	sub    $0x8,%esp
+    3531:	68 4e 69 00 00       	push   $0x694e
+    3536:	6a 01                	push   $0x1
+    3538:	e8 cf 1d 00 00       	call   530c <printf>
+    353d:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3540:	e8 f1 1b 00 00       	call   5136 <exit>
+    }
+    if(cc == 0)
+    3545:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3549:	74 7a                	je     35c5 <bigfile+0x1c4>
+      break;
+    if(cc != 300){
+    354b:	81 7d e8 2c 01 00 00 	cmpl   $0x12c,-0x18(%ebp)
+    3552:	74 17                	je     356b <bigfile+0x16a>
+      printf(1, "short read bigfile\n");
+    3554:	83 ec 08             	sub    $0x8,%esp
+    3557:	68 63 69 00 00       	push   $0x6963
+    355c:	6a 01                	push   $0x1
+    355e:	e8 a9 1d 00 00       	call   530c <printf>
+    3563:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3566:	e8 cb 1b 00 00       	call   5136 <exit>
+    }
+    if(buf[0] != i/2 || buf[299] != i/2){
+    356b:	0f b6 05 20 7e 00 00 	movzbl 0x7e20,%eax
+    3572:	0f be d0             	movsbl %al,%edx
+    3575:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3578:	89 c1                	mov    %eax,%ecx
+    357a:	c1 e9 1f             	shr    $0x1f,%ecx
+    357d:	01 c8                	add    %ecx,%eax
+    357f:	d1 f8                	sar    %eax
+    3581:	39 c2                	cmp    %eax,%edx
+    3583:	75 1a                	jne    359f <bigfile+0x19e>
+    3585:	0f b6 05 4b 7f 00 00 	movzbl 0x7f4b,%eax
+    358c:	0f be d0             	movsbl %al,%edx
+    358f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3592:	89 c1                	mov    %eax,%ecx
+    3594:	c1 e9 1f             	shr    $0x1f,%ecx
+    3597:	01 c8                	add    %ecx,%eax
+    3599:	d1 f8                	sar    %eax
+    359b:	39 c2                	cmp    %eax,%edx
+    359d:	74 17                	je     35b6 <bigfile+0x1b5>
+      printf(1, "read bigfile wrong data\n");
+    359f:	83 ec 08             	sub    $0x8,%esp
+    35a2:	68 77 69 00 00       	push   $0x6977
+    35a7:	6a 01                	push   $0x1
+    35a9:	e8 5e 1d 00 00       	call   530c <printf>
+    35ae:	83 c4 10             	add    $0x10,%esp
+      exit();
+    35b1:	e8 80 1b 00 00       	call   5136 <exit>
+    }
+    total += cc;
+    35b6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    35b9:	01 45 f0             	add    %eax,-0x10(%ebp)
+  for(i = 0; ; i++){
+    35bc:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    cc = read(fd, buf, 300);
+    35c0:	e9 48 ff ff ff       	jmp    350d <bigfile+0x10c>
+      break;
+    35c5:	90                   	nop
+  }
+  close(fd);
+    35c6:	83 ec 0c             	sub    $0xc,%esp
+    35c9:	ff 75 ec             	push   -0x14(%ebp)
+    35cc:	e8 88 1b 00 00       	call   5159 <close>
+    35d1:	83 c4 10             	add    $0x10,%esp
+  if(total != 20*600){
+    35d4:	81 7d f0 e0 2e 00 00 	cmpl   $0x2ee0,-0x10(%ebp)
+    35db:	74 17                	je     35f4 <bigfile+0x1f3>
+    printf(1, "read bigfile wrong total\n");
+    35dd:	83 ec 08             	sub    $0x8,%esp
+    35e0:	68 90 69 00 00       	push   $0x6990
+    35e5:	6a 01                	push   $0x1
+    35e7:	e8 20 1d 00 00       	call   530c <printf>
+    35ec:	83 c4 10             	add    $0x10,%esp
+    exit();
+    35ef:	e8 42 1b 00 00       	call   5136 <exit>
+  }
+  unlink("bigfile");
+    35f4:	83 ec 0c             	sub    $0xc,%esp
+    35f7:	68 05 69 00 00       	push   $0x6905
+    35fc:	e8 7b 1b 00 00       	call   517c <unlink>
+    3601:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "bigfile test ok\n");
+    3604:	83 ec 08             	sub    $0x8,%esp
+    3607:	68 aa 69 00 00       	push   $0x69aa
+    360c:	6a 01                	push   $0x1
+    360e:	e8 f9 1c 00 00       	call   530c <printf>
+    3613:	83 c4 10             	add    $0x10,%esp
+}
+    3616:	90                   	nop
+    3617:	c9                   	leave
+    3618:	c3                   	ret
+
+00003619 <fourteen>:
+
+void
+fourteen(void)
+{
+    3619:	55                   	push   %ebp
+    361a:	89 e5                	mov    %esp,%ebp
+    361c:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  // DIRSIZ is 14.
+  printf(1, "fourteen test\n");
+    361f:	83 ec 08             	sub    $0x8,%esp
+    3622:	68 bb 69 00 00       	push   $0x69bb
+    3627:	6a 01                	push   $0x1
+    3629:	e8 de 1c 00 00       	call   530c <printf>
+    362e:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234") != 0){
+    3631:	83 ec 0c             	sub    $0xc,%esp
+    3634:	68 ca 69 00 00       	push   $0x69ca
+    3639:	e8 53 1b 00 00       	call   5191 <mkdir>
+    363e:	83 c4 10             	add    $0x10,%esp
+    3641:	85 c0                	test   %eax,%eax
+    3643:	74 17                	je     365c <fourteen+0x43>
+    printf(1, "mkdir 12345678901234 failed\n");
+    3645:	83 ec 08             	sub    $0x8,%esp
+    3648:	68 d9 69 00 00       	push   $0x69d9
+    364d:	6a 01                	push   $0x1
+    364f:	e8 b8 1c 00 00       	call   530c <printf>
+    3654:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3657:	e8 da 1a 00 00       	call   5136 <exit>
+  }
+  if(mkdir("12345678901234/123456789012345") != 0){
+    365c:	83 ec 0c             	sub    $0xc,%esp
+    365f:	68 f8 69 00 00       	push   $0x69f8
+    3664:	e8 28 1b 00 00       	call   5191 <mkdir>
+    3669:	83 c4 10             	add    $0x10,%esp
+    366c:	85 c0                	test   %eax,%eax
+    366e:	74 17                	je     3687 <fourteen+0x6e>
+    printf(1, "mkdir 12345678901234/123456789012345 failed\n");
+    3670:	83 ec 08             	sub    $0x8,%esp
+    3673:	68 18 6a 00 00       	push   $0x6a18
+    3678:	6a 01                	push   $0x1
+    367a:	e8 8d 1c 00 00       	call   530c <printf>
+    367f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3682:	e8 af 1a 00 00       	call   5136 <exit>
+  }
+  fd = open("123456789012345/123456789012345/123456789012345", O_CREATE);
+    3687:	83 ec 08             	sub    $0x8,%esp
+    368a:	68 00 02 00 00       	push   $0x200
+    368f:	68 48 6a 00 00       	push   $0x6a48
+    3694:	e8 d5 1a 00 00       	call   516e <open>
+    3699:	83 c4 10             	add    $0x10,%esp
+    369c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    369f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    36a3:	79 17                	jns    36bc <fourteen+0xa3>
+    printf(1, "create 123456789012345/123456789012345/123456789012345 failed\n");
+    36a5:	83 ec 08             	sub    $0x8,%esp
+    36a8:	68 78 6a 00 00       	push   $0x6a78
+    36ad:	6a 01                	push   $0x1
+    36af:	e8 58 1c 00 00       	call   530c <printf>
+    36b4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36b7:	e8 7a 1a 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    36bc:	83 ec 0c             	sub    $0xc,%esp
+    36bf:	ff 75 f4             	push   -0xc(%ebp)
+    36c2:	e8 92 1a 00 00       	call   5159 <close>
+    36c7:	83 c4 10             	add    $0x10,%esp
+  fd = open("12345678901234/12345678901234/12345678901234", 0);
+    36ca:	83 ec 08             	sub    $0x8,%esp
+    36cd:	6a 00                	push   $0x0
+    36cf:	68 b8 6a 00 00       	push   $0x6ab8
+    36d4:	e8 95 1a 00 00       	call   516e <open>
+    36d9:	83 c4 10             	add    $0x10,%esp
+    36dc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    36df:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    36e3:	79 17                	jns    36fc <fourteen+0xe3>
+    printf(1, "open 12345678901234/12345678901234/12345678901234 failed\n");
+    36e5:	83 ec 08             	sub    $0x8,%esp
+    36e8:	68 e8 6a 00 00       	push   $0x6ae8
+    36ed:	6a 01                	push   $0x1
+    36ef:	e8 18 1c 00 00       	call   530c <printf>
+    36f4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    36f7:	e8 3a 1a 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    36fc:	83 ec 0c             	sub    $0xc,%esp
+    36ff:	ff 75 f4             	push   -0xc(%ebp)
+    3702:	e8 52 1a 00 00       	call   5159 <close>
+    3707:	83 c4 10             	add    $0x10,%esp
+
+  if(mkdir("12345678901234/12345678901234") == 0){
+    370a:	83 ec 0c             	sub    $0xc,%esp
+    370d:	68 22 6b 00 00       	push   $0x6b22
+    3712:	e8 7a 1a 00 00       	call   5191 <mkdir>
+    3717:	83 c4 10             	add    $0x10,%esp
+    371a:	85 c0                	test   %eax,%eax
+    371c:	75 17                	jne    3735 <fourteen+0x11c>
+    printf(1, "mkdir 12345678901234/12345678901234 succeeded!\n");
+    371e:	83 ec 08             	sub    $0x8,%esp
+    3721:	68 40 6b 00 00       	push   $0x6b40
+    3726:	6a 01                	push   $0x1
+    3728:	e8 df 1b 00 00       	call   530c <printf>
+    372d:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3730:	e8 01 1a 00 00       	call   5136 <exit>
+  }
+  if(mkdir("123456789012345/12345678901234") == 0){
+    3735:	83 ec 0c             	sub    $0xc,%esp
+    3738:	68 70 6b 00 00       	push   $0x6b70
+    373d:	e8 4f 1a 00 00       	call   5191 <mkdir>
+    3742:	83 c4 10             	add    $0x10,%esp
+    3745:	85 c0                	test   %eax,%eax
+    3747:	75 17                	jne    3760 <fourteen+0x147>
+    printf(1, "mkdir 12345678901234/123456789012345 succeeded!\n");
+    3749:	83 ec 08             	sub    $0x8,%esp
+    374c:	68 90 6b 00 00       	push   $0x6b90
+    3751:	6a 01                	push   $0x1
+    3753:	e8 b4 1b 00 00       	call   530c <printf>
+    3758:	83 c4 10             	add    $0x10,%esp
+    exit();
+    375b:	e8 d6 19 00 00       	call   5136 <exit>
+  }
+
+  printf(1, "fourteen ok\n");
+    3760:	83 ec 08             	sub    $0x8,%esp
+    3763:	68 c1 6b 00 00       	push   $0x6bc1
+    3768:	6a 01                	push   $0x1
+    376a:	e8 9d 1b 00 00       	call   530c <printf>
+    376f:	83 c4 10             	add    $0x10,%esp
+}
+    3772:	90                   	nop
+    3773:	c9                   	leave
+    3774:	c3                   	ret
+
+00003775 <rmdot>:
+
+void
+rmdot(void)
+{
+    3775:	55                   	push   %ebp
+    3776:	89 e5                	mov    %esp,%ebp
+    3778:	83 ec 08             	sub    $0x8,%esp
+  printf(1, "rmdot test\n");
+    377b:	83 ec 08             	sub    $0x8,%esp
+    377e:	68 ce 6b 00 00       	push   $0x6bce
+    3783:	6a 01                	push   $0x1
+    3785:	e8 82 1b 00 00       	call   530c <printf>
+    378a:	83 c4 10             	add    $0x10,%esp
+  if(mkdir("dots") != 0){
+    378d:	83 ec 0c             	sub    $0xc,%esp
+    3790:	68 da 6b 00 00       	push   $0x6bda
+    3795:	e8 f7 19 00 00       	call   5191 <mkdir>
+    379a:	83 c4 10             	add    $0x10,%esp
+    379d:	85 c0                	test   %eax,%eax
+    379f:	74 17                	je     37b8 <rmdot+0x43>
+    printf(1, "mkdir dots failed\n");
+    37a1:	83 ec 08             	sub    $0x8,%esp
+    37a4:	68 df 6b 00 00       	push   $0x6bdf
+    37a9:	6a 01                	push   $0x1
+    37ab:	e8 5c 1b 00 00       	call   530c <printf>
+    37b0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37b3:	e8 7e 19 00 00       	call   5136 <exit>
+  }
+  if(chdir("dots") != 0){
+    37b8:	83 ec 0c             	sub    $0xc,%esp
+    37bb:	68 da 6b 00 00       	push   $0x6bda
+    37c0:	e8 d3 19 00 00       	call   5198 <chdir>
+    37c5:	83 c4 10             	add    $0x10,%esp
+    37c8:	85 c0                	test   %eax,%eax
+    37ca:	74 17                	je     37e3 <rmdot+0x6e>
+    printf(1, "chdir dots failed\n");
+    37cc:	83 ec 08             	sub    $0x8,%esp
+    37cf:	68 f2 6b 00 00       	push   $0x6bf2
+    37d4:	6a 01                	push   $0x1
+    37d6:	e8 31 1b 00 00       	call   530c <printf>
+    37db:	83 c4 10             	add    $0x10,%esp
+    exit();
+    37de:	e8 53 19 00 00       	call   5136 <exit>
+  }
+  if(unlink(".") == 0){
+    37e3:	83 ec 0c             	sub    $0xc,%esp
+    37e6:	68 0b 63 00 00       	push   $0x630b
+    37eb:	e8 8c 19 00 00       	call   517c <unlink>
+    37f0:	83 c4 10             	add    $0x10,%esp
+    37f3:	85 c0                	test   %eax,%eax
+    37f5:	75 17                	jne    380e <rmdot+0x99>
+    printf(1, "rm . worked!\n");
+    37f7:	83 ec 08             	sub    $0x8,%esp
+    37fa:	68 05 6c 00 00       	push   $0x6c05
+    37ff:	6a 01                	push   $0x1
+    3801:	e8 06 1b 00 00       	call   530c <printf>
+    3806:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3809:	e8 28 19 00 00       	call   5136 <exit>
+  }
+  if(unlink("..") == 0){
+    380e:	83 ec 0c             	sub    $0xc,%esp
+    3811:	68 48 5a 00 00       	push   $0x5a48
+    3816:	e8 61 19 00 00       	call   517c <unlink>
+    381b:	83 c4 10             	add    $0x10,%esp
+    381e:	85 c0                	test   %eax,%eax
+    3820:	75 17                	jne    3839 <rmdot+0xc4>
+    printf(1, "rm .. worked!\n");
+    3822:	83 ec 08             	sub    $0x8,%esp
+    3825:	68 13 6c 00 00       	push   $0x6c13
+    382a:	6a 01                	push   $0x1
+    382c:	e8 db 1a 00 00       	call   530c <printf>
+    3831:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3834:	e8 fd 18 00 00       	call   5136 <exit>
+  }
+  if(chdir("/") != 0){
+    3839:	83 ec 0c             	sub    $0xc,%esp
+    383c:	68 22 6c 00 00       	push   $0x6c22
+    3841:	e8 52 19 00 00       	call   5198 <chdir>
+    3846:	83 c4 10             	add    $0x10,%esp
+    3849:	85 c0                	test   %eax,%eax
+    384b:	74 17                	je     3864 <rmdot+0xef>
+    printf(1, "chdir / failed\n");
+    384d:	83 ec 08             	sub    $0x8,%esp
+    3850:	68 24 6c 00 00       	push   $0x6c24
+    3855:	6a 01                	push   $0x1
+    3857:	e8 b0 1a 00 00       	call   530c <printf>
+    385c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    385f:	e8 d2 18 00 00       	call   5136 <exit>
+  }
+  if(unlink("dots/.") == 0){
+    3864:	83 ec 0c             	sub    $0xc,%esp
+    3867:	68 34 6c 00 00       	push   $0x6c34
+    386c:	e8 0b 19 00 00       	call   517c <unlink>
+    3871:	83 c4 10             	add    $0x10,%esp
+    3874:	85 c0                	test   %eax,%eax
+    3876:	75 17                	jne    388f <rmdot+0x11a>
+    printf(1, "unlink dots/. worked!\n");
+    3878:	83 ec 08             	sub    $0x8,%esp
+    387b:	68 3b 6c 00 00       	push   $0x6c3b
+    3880:	6a 01                	push   $0x1
+    3882:	e8 85 1a 00 00       	call   530c <printf>
+    3887:	83 c4 10             	add    $0x10,%esp
+    exit();
+    388a:	e8 a7 18 00 00       	call   5136 <exit>
+  }
+  if(unlink("dots/..") == 0){
+    388f:	83 ec 0c             	sub    $0xc,%esp
+    3892:	68 52 6c 00 00       	push   $0x6c52
+    3897:	e8 e0 18 00 00       	call   517c <unlink>
+    389c:	83 c4 10             	add    $0x10,%esp
+    389f:	85 c0                	test   %eax,%eax
+    38a1:	75 17                	jne    38ba <rmdot+0x145>
+    printf(1, "unlink dots/.. worked!\n");
+    38a3:	83 ec 08             	sub    $0x8,%esp
+    38a6:	68 5a 6c 00 00       	push   $0x6c5a
+    38ab:	6a 01                	push   $0x1
+    38ad:	e8 5a 1a 00 00       	call   530c <printf>
+    38b2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38b5:	e8 7c 18 00 00       	call   5136 <exit>
+  }
+  if(unlink("dots") != 0){
+    38ba:	83 ec 0c             	sub    $0xc,%esp
+    38bd:	68 da 6b 00 00       	push   $0x6bda
+    38c2:	e8 b5 18 00 00       	call   517c <unlink>
+    38c7:	83 c4 10             	add    $0x10,%esp
+    38ca:	85 c0                	test   %eax,%eax
+    38cc:	74 17                	je     38e5 <rmdot+0x170>
+    printf(1, "unlink dots failed!\n");
+    38ce:	83 ec 08             	sub    $0x8,%esp
+    38d1:	68 72 6c 00 00       	push   $0x6c72
+    38d6:	6a 01                	push   $0x1
+    38d8:	e8 2f 1a 00 00       	call   530c <printf>
+    38dd:	83 c4 10             	add    $0x10,%esp
+    exit();
+    38e0:	e8 51 18 00 00       	call   5136 <exit>
+  }
+  printf(1, "rmdot ok\n");
+    38e5:	83 ec 08             	sub    $0x8,%esp
+    38e8:	68 87 6c 00 00       	push   $0x6c87
+    38ed:	6a 01                	push   $0x1
+    38ef:	e8 18 1a 00 00       	call   530c <printf>
+    38f4:	83 c4 10             	add    $0x10,%esp
+}
+    38f7:	90                   	nop
+    38f8:	c9                   	leave
+    38f9:	c3                   	ret
+
+000038fa <dirfile>:
+
+void
+dirfile(void)
+{
+    38fa:	55                   	push   %ebp
+    38fb:	89 e5                	mov    %esp,%ebp
+    38fd:	83 ec 18             	sub    $0x18,%esp
+  int fd;
+
+  printf(1, "dir vs file\n");
+    3900:	83 ec 08             	sub    $0x8,%esp
+    3903:	68 91 6c 00 00       	push   $0x6c91
+    3908:	6a 01                	push   $0x1
+    390a:	e8 fd 19 00 00       	call   530c <printf>
+    390f:	83 c4 10             	add    $0x10,%esp
+
+  fd = open("dirfile", O_CREATE);
+    3912:	83 ec 08             	sub    $0x8,%esp
+    3915:	68 00 02 00 00       	push   $0x200
+    391a:	68 9e 6c 00 00       	push   $0x6c9e
+    391f:	e8 4a 18 00 00       	call   516e <open>
+    3924:	83 c4 10             	add    $0x10,%esp
+    3927:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0){
+    392a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    392e:	79 17                	jns    3947 <dirfile+0x4d>
+    printf(1, "create dirfile failed\n");
+    3930:	83 ec 08             	sub    $0x8,%esp
+    3933:	68 a6 6c 00 00       	push   $0x6ca6
+    3938:	6a 01                	push   $0x1
+    393a:	e8 cd 19 00 00       	call   530c <printf>
+    393f:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3942:	e8 ef 17 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    3947:	83 ec 0c             	sub    $0xc,%esp
+    394a:	ff 75 f4             	push   -0xc(%ebp)
+    394d:	e8 07 18 00 00       	call   5159 <close>
+    3952:	83 c4 10             	add    $0x10,%esp
+  if(chdir("dirfile") == 0){
+    3955:	83 ec 0c             	sub    $0xc,%esp
+    3958:	68 9e 6c 00 00       	push   $0x6c9e
+    395d:	e8 36 18 00 00       	call   5198 <chdir>
+    3962:	83 c4 10             	add    $0x10,%esp
+    3965:	85 c0                	test   %eax,%eax
+    3967:	75 17                	jne    3980 <dirfile+0x86>
+    printf(1, "chdir dirfile succeeded!\n");
+    3969:	83 ec 08             	sub    $0x8,%esp
+    396c:	68 bd 6c 00 00       	push   $0x6cbd
+    3971:	6a 01                	push   $0x1
+    3973:	e8 94 19 00 00       	call   530c <printf>
+    3978:	83 c4 10             	add    $0x10,%esp
+    exit();
+    397b:	e8 b6 17 00 00       	call   5136 <exit>
+  }
+  fd = open("dirfile/xx", 0);
+    3980:	83 ec 08             	sub    $0x8,%esp
+    3983:	6a 00                	push   $0x0
+    3985:	68 d7 6c 00 00       	push   $0x6cd7
+    398a:	e8 df 17 00 00       	call   516e <open>
+    398f:	83 c4 10             	add    $0x10,%esp
+    3992:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3995:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3999:	78 17                	js     39b2 <dirfile+0xb8>
+    printf(1, "create dirfile/xx succeeded!\n");
+    399b:	83 ec 08             	sub    $0x8,%esp
+    399e:	68 e2 6c 00 00       	push   $0x6ce2
+    39a3:	6a 01                	push   $0x1
+    39a5:	e8 62 19 00 00       	call   530c <printf>
+    39aa:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39ad:	e8 84 17 00 00       	call   5136 <exit>
+  }
+  fd = open("dirfile/xx", O_CREATE);
+    39b2:	83 ec 08             	sub    $0x8,%esp
+    39b5:	68 00 02 00 00       	push   $0x200
+    39ba:	68 d7 6c 00 00       	push   $0x6cd7
+    39bf:	e8 aa 17 00 00       	call   516e <open>
+    39c4:	83 c4 10             	add    $0x10,%esp
+    39c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    39ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    39ce:	78 17                	js     39e7 <dirfile+0xed>
+    printf(1, "create dirfile/xx succeeded!\n");
+    39d0:	83 ec 08             	sub    $0x8,%esp
+    39d3:	68 e2 6c 00 00       	push   $0x6ce2
+    39d8:	6a 01                	push   $0x1
+    39da:	e8 2d 19 00 00       	call   530c <printf>
+    39df:	83 c4 10             	add    $0x10,%esp
+    exit();
+    39e2:	e8 4f 17 00 00       	call   5136 <exit>
+  }
+  if(mkdir("dirfile/xx") == 0){
+    39e7:	83 ec 0c             	sub    $0xc,%esp
+    39ea:	68 d7 6c 00 00       	push   $0x6cd7
+    39ef:	e8 9d 17 00 00       	call   5191 <mkdir>
+    39f4:	83 c4 10             	add    $0x10,%esp
+    39f7:	85 c0                	test   %eax,%eax
+    39f9:	75 17                	jne    3a12 <dirfile+0x118>
+    printf(1, "mkdir dirfile/xx succeeded!\n");
+    39fb:	83 ec 08             	sub    $0x8,%esp
+    39fe:	68 00 6d 00 00       	push   $0x6d00
+    3a03:	6a 01                	push   $0x1
+    3a05:	e8 02 19 00 00       	call   530c <printf>
+    3a0a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a0d:	e8 24 17 00 00       	call   5136 <exit>
+  }
+  if(unlink("dirfile/xx") == 0){
+    3a12:	83 ec 0c             	sub    $0xc,%esp
+    3a15:	68 d7 6c 00 00       	push   $0x6cd7
+    3a1a:	e8 5d 17 00 00       	call   517c <unlink>
+    3a1f:	83 c4 10             	add    $0x10,%esp
+    3a22:	85 c0                	test   %eax,%eax
+    3a24:	75 17                	jne    3a3d <dirfile+0x143>
+    printf(1, "unlink dirfile/xx succeeded!\n");
+    3a26:	83 ec 08             	sub    $0x8,%esp
+    3a29:	68 1d 6d 00 00       	push   $0x6d1d
+    3a2e:	6a 01                	push   $0x1
+    3a30:	e8 d7 18 00 00       	call   530c <printf>
+    3a35:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a38:	e8 f9 16 00 00       	call   5136 <exit>
+  }
+  if(link("README", "dirfile/xx") == 0){
+    3a3d:	83 ec 08             	sub    $0x8,%esp
+    3a40:	68 d7 6c 00 00       	push   $0x6cd7
+    3a45:	68 3b 6d 00 00       	push   $0x6d3b
+    3a4a:	e8 3b 17 00 00       	call   518a <link>
+    3a4f:	83 c4 10             	add    $0x10,%esp
+    3a52:	85 c0                	test   %eax,%eax
+    3a54:	75 17                	jne    3a6d <dirfile+0x173>
+    printf(1, "link to dirfile/xx succeeded!\n");
+    3a56:	83 ec 08             	sub    $0x8,%esp
+    3a59:	68 44 6d 00 00       	push   $0x6d44
+    3a5e:	6a 01                	push   $0x1
+    3a60:	e8 a7 18 00 00       	call   530c <printf>
+    3a65:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a68:	e8 c9 16 00 00       	call   5136 <exit>
+  }
+  if(unlink("dirfile") != 0){
+    3a6d:	83 ec 0c             	sub    $0xc,%esp
+    3a70:	68 9e 6c 00 00       	push   $0x6c9e
+    3a75:	e8 02 17 00 00       	call   517c <unlink>
+    3a7a:	83 c4 10             	add    $0x10,%esp
+    3a7d:	85 c0                	test   %eax,%eax
+    3a7f:	74 17                	je     3a98 <dirfile+0x19e>
+    printf(1, "unlink dirfile failed!\n");
+    3a81:	83 ec 08             	sub    $0x8,%esp
+    3a84:	68 63 6d 00 00       	push   $0x6d63
+    3a89:	6a 01                	push   $0x1
+    3a8b:	e8 7c 18 00 00       	call   530c <printf>
+    3a90:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3a93:	e8 9e 16 00 00       	call   5136 <exit>
+  }
+
+  fd = open(".", O_RDWR);
+    3a98:	83 ec 08             	sub    $0x8,%esp
+    3a9b:	6a 02                	push   $0x2
+    3a9d:	68 0b 63 00 00       	push   $0x630b
+    3aa2:	e8 c7 16 00 00       	call   516e <open>
+    3aa7:	83 c4 10             	add    $0x10,%esp
+    3aaa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd >= 0){
+    3aad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3ab1:	78 17                	js     3aca <dirfile+0x1d0>
+    printf(1, "open . for writing succeeded!\n");
+    3ab3:	83 ec 08             	sub    $0x8,%esp
+    3ab6:	68 7c 6d 00 00       	push   $0x6d7c
+    3abb:	6a 01                	push   $0x1
+    3abd:	e8 4a 18 00 00       	call   530c <printf>
+    3ac2:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3ac5:	e8 6c 16 00 00       	call   5136 <exit>
+  }
+  fd = open(".", 0);
+    3aca:	83 ec 08             	sub    $0x8,%esp
+    3acd:	6a 00                	push   $0x0
+    3acf:	68 0b 63 00 00       	push   $0x630b
+    3ad4:	e8 95 16 00 00       	call   516e <open>
+    3ad9:	83 c4 10             	add    $0x10,%esp
+    3adc:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(write(fd, "x", 1) > 0){
+    3adf:	83 ec 04             	sub    $0x4,%esp
+    3ae2:	6a 01                	push   $0x1
+    3ae4:	68 c0 5b 00 00       	push   $0x5bc0
+    3ae9:	ff 75 f4             	push   -0xc(%ebp)
+    3aec:	e8 61 16 00 00       	call   5152 <write>
+    3af1:	83 c4 10             	add    $0x10,%esp
+    3af4:	85 c0                	test   %eax,%eax
+    3af6:	7e 17                	jle    3b0f <dirfile+0x215>
+    printf(1, "write . succeeded!\n");
+    3af8:	83 ec 08             	sub    $0x8,%esp
+    3afb:	68 9b 6d 00 00       	push   $0x6d9b
+    3b00:	6a 01                	push   $0x1
+    3b02:	e8 05 18 00 00       	call   530c <printf>
+    3b07:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3b0a:	e8 27 16 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    3b0f:	83 ec 0c             	sub    $0xc,%esp
+    3b12:	ff 75 f4             	push   -0xc(%ebp)
+    3b15:	e8 3f 16 00 00       	call   5159 <close>
+    3b1a:	83 c4 10             	add    $0x10,%esp
+
+  printf(1, "dir vs file OK\n");
+    3b1d:	83 ec 08             	sub    $0x8,%esp
+    3b20:	68 af 6d 00 00       	push   $0x6daf
+    3b25:	6a 01                	push   $0x1
+    3b27:	e8 e0 17 00 00       	call   530c <printf>
+    3b2c:	83 c4 10             	add    $0x10,%esp
+}
+    3b2f:	90                   	nop
+    3b30:	c9                   	leave
+    3b31:	c3                   	ret
+
+00003b32 <iref>:
+
+// test that iput() is called at the end of _namei()
+void
+iref(void)
+{
+    3b32:	55                   	push   %ebp
+    3b33:	89 e5                	mov    %esp,%ebp
+    3b35:	83 ec 18             	sub    $0x18,%esp
+  int i, fd;
+
+  printf(1, "empty file name\n");
+    3b38:	83 ec 08             	sub    $0x8,%esp
+    3b3b:	68 bf 6d 00 00       	push   $0x6dbf
+    3b40:	6a 01                	push   $0x1
+    3b42:	e8 c5 17 00 00       	call   530c <printf>
+    3b47:	83 c4 10             	add    $0x10,%esp
+
+  // the 50 was NINODE, back when the inode cache was a fixed table
+  for(i = 0; i < 50 + 1; i++){
+    3b4a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3b51:	e9 e7 00 00 00       	jmp    3c3d <iref+0x10b>
+    if(mkdir("irefd") != 0){
+    3b56:	83 ec 0c             	sub    $0xc,%esp
+    3b59:	68 d0 6d 00 00       	push   $0x6dd0
+    3b5e:	e8 2e 16 00 00       	call   5191 <mkdir>
+    3b63:	83 c4 10             	add    $0x10,%esp
+    3b66:	85 c0                	test   %eax,%eax
+    3b68:	74 17                	je     3b81 <iref+0x4f>
+      printf(1, "mkdir irefd failed\n");
+    3b6a:	83 ec 08             	sub    $0x8,%esp
+    3b6d:	68 d6 6d 00 00       	push   $0x6dd6
+    3b72:	6a 01                	push   $0x1
+    3b74:	e8 93 17 00 00       	call   530c <printf>
+    3b79:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3b7c:	e8 b5 15 00 00       	call   5136 <exit>
+    }
+    if(chdir("irefd") != 0){
+    3b81:	83 ec 0c             	sub    $0xc,%esp
+    3b84:	68 d0 6d 00 00       	push   $0x6dd0
+    3b89:	e8 0a 16 00 00       	call   5198 <chdir>
+    3b8e:	83 c4 10             	add    $0x10,%esp
+    3b91:	85 c0                	test   %eax,%eax
+    3b93:	74 17                	je     3bac <iref+0x7a>
+      printf(1, "chdir irefd failed\n");
+    3b95:	83 ec 08             	sub    $0x8,%esp
+    3b98:	68 ea 6d 00 00       	push   $0x6dea
+    3b9d:	6a 01                	push   $0x1
+    3b9f:	e8 68 17 00 00       	call   530c <printf>
+    3ba4:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3ba7:	e8 8a 15 00 00       	call   5136 <exit>
+    }
+
+    mkdir("");
+    3bac:	83 ec 0c             	sub    $0xc,%esp
+    3baf:	68 fe 6d 00 00       	push   $0x6dfe
+    3bb4:	e8 d8 15 00 00       	call   5191 <mkdir>
+    3bb9:	83 c4 10             	add    $0x10,%esp
+    link("README", "");
+    3bbc:	83 ec 08             	sub    $0x8,%esp
+    3bbf:	68 fe 6d 00 00       	push   $0x6dfe
+    3bc4:	68 3b 6d 00 00       	push   $0x6d3b
+    3bc9:	e8 bc 15 00 00       	call   518a <link>
+    3bce:	83 c4 10             	add    $0x10,%esp
+    fd = open("", O_CREATE);
+    3bd1:	83 ec 08             	sub    $0x8,%esp
+    3bd4:	68 00 02 00 00       	push   $0x200
+    3bd9:	68 fe 6d 00 00       	push   $0x6dfe
+    3bde:	e8 8b 15 00 00       	call   516e <open>
+    3be3:	83 c4 10             	add    $0x10,%esp
+    3be6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3be9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3bed:	78 0e                	js     3bfd <iref+0xcb>
+      close(fd);
+    3bef:	83 ec 0c             	sub    $0xc,%esp
+    3bf2:	ff 75 f0             	push   -0x10(%ebp)
+    3bf5:	e8 5f 15 00 00       	call   5159 <close>
+    3bfa:	83 c4 10             	add    $0x10,%esp
+    fd = open("xx", O_CREATE);
+    3bfd:	83 ec 08             	sub    $0x8,%esp
+    3c00:	68 00 02 00 00       	push   $0x200
+    3c05:	68 ff 6d 00 00       	push   $0x6dff
+    3c0a:	e8 5f 15 00 00       	call   516e <open>
+    3c0f:	83 c4 10             	add    $0x10,%esp
+    3c12:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(fd >= 0)
+    3c15:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3c19:	78 0e                	js     3c29 <iref+0xf7>
+      close(fd);
+    3c1b:	83 ec 0c             	sub    $0xc,%esp
+    3c1e:	ff 75 f0             	push   -0x10(%ebp)
+    3c21:	e8 33 15 00 00       	call   5159 <close>
+    3c26:	83 c4 10             	add    $0x10,%esp
+    unlink("xx");
+    3c29:	83 ec 0c             	sub    $0xc,%esp
+    3c2c:	68 ff 6d 00 00       	push   $0x6dff
+    3c31:	e8 46 15 00 00       	call   517c <unlink>
+    3c36:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < 50 + 1; i++){
+    3c39:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3c3d:	83 7d f4 32          	cmpl   $0x32,-0xc(%ebp)
+    3c41:	0f 8e 0f ff ff ff    	jle    3b56 <iref+0x24>
+  }
+
+  chdir("/");
+    3c47:	83 ec 0c             	sub    $0xc,%esp
+    3c4a:	68 22 6c 00 00       	push   $0x6c22
+    3c4f:	e8 44 15 00 00       	call   5198 <chdir>
+    3c54:	83 c4 10             	add    $0x10,%esp
+  printf(1, "empty file name OK\n");
+    3c57:	83 ec 08             	sub    $0x8,%esp
+    3c5a:	68 02 6e 00 00       	push   $0x6e02
+    3c5f:	6a 01                	push   $0x1
+    3c61:	e8 a6 16 00 00       	call   530c <printf>
+    3c66:	83 c4 10             	add    $0x10,%esp
+}
+    3c69:	90                   	nop
+    3c6a:	c9                   	leave
+    3c6b:	c3                   	ret
+
+00003c6c <forktest>:
+// test that fork fails gracefully
+// the forktest binary also does this, but it runs out of proc entries first.
+// inside the bigger usertests binary, we run out of memory first.
+void
+forktest(void)
+{
+    3c6c:	55                   	push   %ebp
+    3c6d:	89 e5                	mov    %esp,%ebp
+    3c6f:	83 ec 18             	sub    $0x18,%esp
+  int n, pid;
+
+  printf(1, "fork test\n");
+    3c72:	83 ec 08             	sub    $0x8,%esp
+    3c75:	68 16 6e 00 00       	push   $0x6e16
+    3c7a:	6a 01                	push   $0x1
+    3c7c:	e8 8b 16 00 00       	call   530c <printf>
+    3c81:	83 c4 10             	add    $0x10,%esp
+
+  for(n=0; n<1000; n++){
+    3c84:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    3c8b:	eb 1d                	jmp    3caa <forktest+0x3e>
+    pid = fork();
+    3c8d:	e8 9d 14 00 00       	call   512f <fork>
+    3c92:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(pid < 0)
+    3c95:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3c99:	78 1a                	js     3cb5 <forktest+0x49>
+      break;
+    if(pid == 0)
+    3c9b:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    3c9f:	75 05                	jne    3ca6 <forktest+0x3a>
+      exit();
+    3ca1:	e8 90 14 00 00       	call   5136 <exit>
+  for(n=0; n<1000; n++){
+    3ca6:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    3caa:	81 7d f4 e7 03 00 00 	cmpl   $0x3e7,-0xc(%ebp)
+    3cb1:	7e da                	jle    3c8d <forktest+0x21>
+    3cb3:	eb 01                	jmp    3cb6 <forktest+0x4a>
+      break;
+    3cb5:	90                   	nop
+  }
+  
+  if(n == 1000){
+    3cb6:	81 7d f4 e8 03 00 00 	cmpl   $0x3e8,-0xc(%ebp)
+    3cbd:	75 3b                	jne    3cfa <forktest+0x8e>
+    printf(1, "fork claimed to work 1000 times!\n");
+    3cbf:	83 ec 08             	sub    $0x8,%esp
+    3cc2:	68 24 6e 00 00       	push   $0x6e24
+    3cc7:	6a 01                	push   $0x1
+    3cc9:	e8 3e 16 00 00       	call   530c <printf>
+    3cce:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3cd1:	e8 60 14 00 00       	call   5136 <exit>
+  }
+  
+  for(; n > 0; n--){
+    if(wait() < 0){
+    3cd6:	e8 62 14 00 00       	call   513d <wait>
+    3cdb:	85 c0                	test   %eax,%eax
+    3cdd:	79 17                	jns    3cf6 <forktest+0x8a>
+      printf(1, "wait stopped early\n");
+    3cdf:	83 ec 08             	sub    $0x8,%esp
+    3ce2:	68 46 6e 00 00       	push   $0x6e46
+    3ce7:	6a 01                	push   $0x1
+    3ce9:	e8 1e 16 00 00       	call   530c <printf>
+    3cee:	83 c4 10             	add    $0x10,%esp
+      exit();
+    3cf1:	e8 40 14 00 00       	call   5136 <exit>
+  for(; n > 0; n--){
+    3cf6:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    3cfa:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    3cfe:	7f d6                	jg     3cd6 <forktest+0x6a>
+    }
+  }
+  
+  if(wait() != -1){
+    3d00:	e8 38 14 00 00       	call   513d <wait>
+    3d05:	83 f8 ff             	cmp    $0xffffffff,%eax
+    3d08:	74 17                	je     3d21 <forktest+0xb5>
+    printf(1, "wait got too many\n");
+    3d0a:	83 ec 08             	sub    $0x8,%esp
+    3d0d:	68 5a 6e 00 00       	push   $0x6e5a
+    3d12:	6a 01                	push   $0x1
+    3d14:	e8 f3 15 00 00       	call   530c <printf>
+    3d19:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3d1c:	e8 15 14 00 00       	call   5136 <exit>
+  }
+  
+  printf(1, "fork test OK\n");
+    3d21:	83 ec 08             	sub    $0x8,%esp
+    3d24:	68 6d 6e 00 00       	push   $0x6e6d
+    3d29:	6a 01                	push   $0x1
+    3d2b:	e8 dc 15 00 00       	call   530c <printf>
+    3d30:	83 c4 10             	add    $0x10,%esp
+}
+    3d33:	90                   	nop
+    3d34:	c9                   	leave
+    3d35:	c3                   	ret
+
+00003d36 <sbrktest>:
+
+void
+sbrktest(void)
+{
+    3d36:	55                   	push   %ebp
+    3d37:	89 e5                	mov    %esp,%ebp
+    3d39:	83 ec 68             	sub    $0x68,%esp
+  int fds[2], pid, pids[10], ppid;
+  char *a, *b, *c, *lastaddr, *oldbrk, *p, scratch;
+  uint amt;
+
+  printf(stdout, "sbrk test\n");
+    3d3c:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3d41:	83 ec 08             	sub    $0x8,%esp
+    3d44:	68 7b 6e 00 00       	push   $0x6e7b
+    3d49:	50                   	push   %eax
+    3d4a:	e8 bd 15 00 00       	call   530c <printf>
+    3d4f:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    3d52:	83 ec 0c             	sub    $0xc,%esp
+    3d55:	6a 00                	push   $0x0
+    3d57:	e8 5a 14 00 00       	call   51b6 <sbrk>
+    3d5c:	83 c4 10             	add    $0x10,%esp
+    3d5f:	89 45 ec             	mov    %eax,-0x14(%ebp)
+
+  // can one sbrk() less than a page?
+  a = sbrk(0);
+    3d62:	83 ec 0c             	sub    $0xc,%esp
+    3d65:	6a 00                	push   $0x0
+    3d67:	e8 4a 14 00 00       	call   51b6 <sbrk>
+    3d6c:	83 c4 10             	add    $0x10,%esp
+    3d6f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  int i;
+  for(i = 0; i < 5000; i++){ 
+    3d72:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    3d79:	eb 4f                	jmp    3dca <sbrktest+0x94>
+    b = sbrk(1);
+    3d7b:	83 ec 0c             	sub    $0xc,%esp
+    3d7e:	6a 01                	push   $0x1
+    3d80:	e8 31 14 00 00       	call   51b6 <sbrk>
+    3d85:	83 c4 10             	add    $0x10,%esp
+    3d88:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    if(b != a){
+    3d8b:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3d8e:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3d91:	74 24                	je     3db7 <sbrktest+0x81>
+      printf(stdout, "sbrk test failed %d %x %x\n", i, a, b);
+    3d93:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3d98:	83 ec 0c             	sub    $0xc,%esp
+    3d9b:	ff 75 d0             	push   -0x30(%ebp)
+    3d9e:	ff 75 f4             	push   -0xc(%ebp)
+    3da1:	ff 75 f0             	push   -0x10(%ebp)
+    3da4:	68 86 6e 00 00       	push   $0x6e86
+    3da9:	50                   	push   %eax
+    3daa:	e8 5d 15 00 00       	call   530c <printf>
+    3daf:	83 c4 20             	add    $0x20,%esp
+      exit();
+    3db2:	e8 7f 13 00 00       	call   5136 <exit>
+    }
+    *b = 1;
+    3db7:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3dba:	c6 00 01             	movb   $0x1,(%eax)
+    a = b + 1;
+    3dbd:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    3dc0:	83 c0 01             	add    $0x1,%eax
+    3dc3:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  for(i = 0; i < 5000; i++){ 
+    3dc6:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    3dca:	81 7d f0 87 13 00 00 	cmpl   $0x1387,-0x10(%ebp)
+    3dd1:	7e a8                	jle    3d7b <sbrktest+0x45>
+  }
+  pid = fork();
+    3dd3:	e8 57 13 00 00       	call   512f <fork>
+    3dd8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    3ddb:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3ddf:	79 1b                	jns    3dfc <sbrktest+0xc6>
+    printf(stdout, "sbrk test fork failed\n");
+    3de1:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3de6:	83 ec 08             	sub    $0x8,%esp
+    3de9:	68 a1 6e 00 00       	push   $0x6ea1
+    3dee:	50                   	push   %eax
+    3def:	e8 18 15 00 00       	call   530c <printf>
+    3df4:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3df7:	e8 3a 13 00 00       	call   5136 <exit>
+  }
+  c = sbrk(1);
+    3dfc:	83 ec 0c             	sub    $0xc,%esp
+    3dff:	6a 01                	push   $0x1
+    3e01:	e8 b0 13 00 00       	call   51b6 <sbrk>
+    3e06:	83 c4 10             	add    $0x10,%esp
+    3e09:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  c = sbrk(1);
+    3e0c:	83 ec 0c             	sub    $0xc,%esp
+    3e0f:	6a 01                	push   $0x1
+    3e11:	e8 a0 13 00 00       	call   51b6 <sbrk>
+    3e16:	83 c4 10             	add    $0x10,%esp
+    3e19:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a + 1){
+    3e1c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e1f:	83 c0 01             	add    $0x1,%eax
+    3e22:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3e25:	74 1b                	je     3e42 <sbrktest+0x10c>
+    printf(stdout, "sbrk test failed post-fork\n");
+    3e27:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3e2c:	83 ec 08             	sub    $0x8,%esp
+    3e2f:	68 b8 6e 00 00       	push   $0x6eb8
+    3e34:	50                   	push   %eax
+    3e35:	e8 d2 14 00 00       	call   530c <printf>
+    3e3a:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e3d:	e8 f4 12 00 00       	call   5136 <exit>
+  }
+  if(pid == 0)
+    3e42:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    3e46:	75 05                	jne    3e4d <sbrktest+0x117>
+    exit();
+    3e48:	e8 e9 12 00 00       	call   5136 <exit>
+  wait();
+    3e4d:	e8 eb 12 00 00       	call   513d <wait>
+
+  // can one grow address space to something big?
+#define BIG (100*1024*1024)
+  a = sbrk(0);
+    3e52:	83 ec 0c             	sub    $0xc,%esp
+    3e55:	6a 00                	push   $0x0
+    3e57:	e8 5a 13 00 00       	call   51b6 <sbrk>
+    3e5c:	83 c4 10             	add    $0x10,%esp
+    3e5f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  amt = (BIG) - (uint)a;
+    3e62:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3e65:	ba 00 00 40 06       	mov    $0x6400000,%edx
+    3e6a:	29 c2                	sub    %eax,%edx
+    3e6c:	89 55 e0             	mov    %edx,-0x20(%ebp)
+  p = sbrk(amt);
+    3e6f:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    3e72:	83 ec 0c             	sub    $0xc,%esp
+    3e75:	50                   	push   %eax
+    3e76:	e8 3b 13 00 00       	call   51b6 <sbrk>
+    3e7b:	83 c4 10             	add    $0x10,%esp
+    3e7e:	89 45 dc             	mov    %eax,-0x24(%ebp)
+  if (p != a) { 
+    3e81:	8b 45 dc             	mov    -0x24(%ebp),%eax
+    3e84:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3e87:	74 1b                	je     3ea4 <sbrktest+0x16e>
+    printf(stdout, "sbrk test failed to grow big address space; enough phys mem?\n");
+    3e89:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3e8e:	83 ec 08             	sub    $0x8,%esp
+    3e91:	68 d4 6e 00 00       	push   $0x6ed4
+    3e96:	50                   	push   %eax
+    3e97:	e8 70 14 00 00       	call   530c <printf>
+    3e9c:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3e9f:	e8 92 12 00 00       	call   5136 <exit>
+  }
+  lastaddr = (char*) (BIG-1);
+    3ea4:	c7 45 d8 ff ff 3f 06 	movl   $0x63fffff,-0x28(%ebp)
+  *lastaddr = 99;
+    3eab:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3eae:	c6 00 63             	movb   $0x63,(%eax)
+
+  // can one de-allocate?
+  a = sbrk(0);
+    3eb1:	83 ec 0c             	sub    $0xc,%esp
+    3eb4:	6a 00                	push   $0x0
+    3eb6:	e8 fb 12 00 00       	call   51b6 <sbrk>
+    3ebb:	83 c4 10             	add    $0x10,%esp
+    3ebe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-4096);
+    3ec1:	83 ec 0c             	sub    $0xc,%esp
+    3ec4:	68 00 f0 ff ff       	push   $0xfffff000
+    3ec9:	e8 e8 12 00 00       	call   51b6 <sbrk>
+    3ece:	83 c4 10             	add    $0x10,%esp
+    3ed1:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c == (char*)0xffffffff){
+    3ed4:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    3ed8:	75 1b                	jne    3ef5 <sbrktest+0x1bf>
+    printf(stdout, "sbrk could not deallocate\n");
+    3eda:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3edf:	83 ec 08             	sub    $0x8,%esp
+    3ee2:	68 12 6f 00 00       	push   $0x6f12
+    3ee7:	50                   	push   %eax
+    3ee8:	e8 1f 14 00 00       	call   530c <printf>
+    3eed:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3ef0:	e8 41 12 00 00       	call   5136 <exit>
+  }
+  c = sbrk(0);
+    3ef5:	83 ec 0c             	sub    $0xc,%esp
+    3ef8:	6a 00                	push   $0x0
+    3efa:	e8 b7 12 00 00       	call   51b6 <sbrk>
+    3eff:	83 c4 10             	add    $0x10,%esp
+    3f02:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a - 4096){
+    3f05:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    3f08:	2d 00 10 00 00       	sub    $0x1000,%eax
+    3f0d:	39 45 e4             	cmp    %eax,-0x1c(%ebp)
+    3f10:	74 1e                	je     3f30 <sbrktest+0x1fa>
+    printf(stdout, "sbrk deallocation produced wrong address, a %x c %x\n", a, c);
+    3f12:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3f17:	ff 75 e4             	push   -0x1c(%ebp)
+    3f1a:	ff 75 f4             	push   -0xc(%ebp)
+    3f1d:	68 30 6f 00 00       	push   $0x6f30
+    3f22:	50                   	push   %eax
+    3f23:	e8 e4 13 00 00       	call   530c <printf>
+    3f28:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f2b:	e8 06 12 00 00       	call   5136 <exit>
+  }
+
+  // can one re-allocate that page?
+  a = sbrk(0);
+    3f30:	83 ec 0c             	sub    $0xc,%esp
+    3f33:	6a 00                	push   $0x0
+    3f35:	e8 7c 12 00 00       	call   51b6 <sbrk>
+    3f3a:	83 c4 10             	add    $0x10,%esp
+    3f3d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(4096);
+    3f40:	83 ec 0c             	sub    $0xc,%esp
+    3f43:	68 00 10 00 00       	push   $0x1000
+    3f48:	e8 69 12 00 00       	call   51b6 <sbrk>
+    3f4d:	83 c4 10             	add    $0x10,%esp
+    3f50:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a || sbrk(0) != a + 4096){
+    3f53:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3f56:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3f59:	75 1a                	jne    3f75 <sbrktest+0x23f>
+    3f5b:	83 ec 0c             	sub    $0xc,%esp
+    3f5e:	6a 00                	push   $0x0
+    3f60:	e8 51 12 00 00       	call   51b6 <sbrk>
+    3f65:	83 c4 10             	add    $0x10,%esp
+    3f68:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    3f6b:	81 c2 00 10 00 00    	add    $0x1000,%edx
+    3f71:	39 d0                	cmp    %edx,%eax
+    3f73:	74 1e                	je     3f93 <sbrktest+0x25d>
+    printf(stdout, "sbrk re-allocation failed, a %x c %x\n", a, c);
+    3f75:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3f7a:	ff 75 e4             	push   -0x1c(%ebp)
+    3f7d:	ff 75 f4             	push   -0xc(%ebp)
+    3f80:	68 68 6f 00 00       	push   $0x6f68
+    3f85:	50                   	push   %eax
+    3f86:	e8 81 13 00 00       	call   530c <printf>
+    3f8b:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3f8e:	e8 a3 11 00 00       	call   5136 <exit>
+  }
+  if(*lastaddr == 99){
+    3f93:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    3f96:	0f b6 00             	movzbl (%eax),%eax
+    3f99:	3c 63                	cmp    $0x63,%al
+    3f9b:	75 1b                	jne    3fb8 <sbrktest+0x282>
+    // should be zero
+    printf(stdout, "sbrk de-allocation didn't really deallocate\n");
+    3f9d:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3fa2:	83 ec 08             	sub    $0x8,%esp
+    3fa5:	68 90 6f 00 00       	push   $0x6f90
+    3faa:	50                   	push   %eax
+    3fab:	e8 5c 13 00 00       	call   530c <printf>
+    3fb0:	83 c4 10             	add    $0x10,%esp
+    exit();
+    3fb3:	e8 7e 11 00 00       	call   5136 <exit>
+  }
+
+  a = sbrk(0);
+    3fb8:	83 ec 0c             	sub    $0xc,%esp
+    3fbb:	6a 00                	push   $0x0
+    3fbd:	e8 f4 11 00 00       	call   51b6 <sbrk>
+    3fc2:	83 c4 10             	add    $0x10,%esp
+    3fc5:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  c = sbrk(-(sbrk(0) - oldbrk));
+    3fc8:	83 ec 0c             	sub    $0xc,%esp
+    3fcb:	6a 00                	push   $0x0
+    3fcd:	e8 e4 11 00 00       	call   51b6 <sbrk>
+    3fd2:	83 c4 10             	add    $0x10,%esp
+    3fd5:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    3fd8:	29 c2                	sub    %eax,%edx
+    3fda:	83 ec 0c             	sub    $0xc,%esp
+    3fdd:	52                   	push   %edx
+    3fde:	e8 d3 11 00 00       	call   51b6 <sbrk>
+    3fe3:	83 c4 10             	add    $0x10,%esp
+    3fe6:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  if(c != a){
+    3fe9:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    3fec:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    3fef:	74 1e                	je     400f <sbrktest+0x2d9>
+    printf(stdout, "sbrk downsize failed, a %x c %x\n", a, c);
+    3ff1:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    3ff6:	ff 75 e4             	push   -0x1c(%ebp)
+    3ff9:	ff 75 f4             	push   -0xc(%ebp)
+    3ffc:	68 c0 6f 00 00       	push   $0x6fc0
+    4001:	50                   	push   %eax
+    4002:	e8 05 13 00 00       	call   530c <printf>
+    4007:	83 c4 10             	add    $0x10,%esp
+    exit();
+    400a:	e8 27 11 00 00       	call   5136 <exit>
+  }
+  
+  // can we read the kernel's memory?
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    400f:	c7 45 f4 00 00 00 80 	movl   $0x80000000,-0xc(%ebp)
+    4016:	eb 76                	jmp    408e <sbrktest+0x358>
+    ppid = getpid();
+    4018:	e8 8f 11 00 00       	call   51ac <getpid>
+    401d:	89 45 d4             	mov    %eax,-0x2c(%ebp)
+    pid = fork();
+    4020:	e8 0a 11 00 00       	call   512f <fork>
+    4025:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(pid < 0){
+    4028:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    402c:	79 1b                	jns    4049 <sbrktest+0x313>
+      printf(stdout, "fork failed\n");
+    402e:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4033:	83 ec 08             	sub    $0x8,%esp
+    4036:	68 f8 5a 00 00       	push   $0x5af8
+    403b:	50                   	push   %eax
+    403c:	e8 cb 12 00 00       	call   530c <printf>
+    4041:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4044:	e8 ed 10 00 00       	call   5136 <exit>
+    }
+    if(pid == 0){
+    4049:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    404d:	75 33                	jne    4082 <sbrktest+0x34c>
+      printf(stdout, "oops could read %x = %x\n", a, *a);
+    404f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4052:	0f b6 00             	movzbl (%eax),%eax
+    4055:	0f be d0             	movsbl %al,%edx
+    4058:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    405d:	52                   	push   %edx
+    405e:	ff 75 f4             	push   -0xc(%ebp)
+    4061:	68 e1 6f 00 00       	push   $0x6fe1
+    4066:	50                   	push   %eax
+    4067:	e8 a0 12 00 00       	call   530c <printf>
+    406c:	83 c4 10             	add    $0x10,%esp
+      kill(ppid);
+    406f:	83 ec 0c             	sub    $0xc,%esp
+    4072:	ff 75 d4             	push   -0x2c(%ebp)
+    4075:	e8 e6 10 00 00       	call   5160 <kill>
+    407a:	83 c4 10             	add    $0x10,%esp
+      exit();
+    407d:	e8 b4 10 00 00       	call   5136 <exit>
+    }
+    wait();
+    4082:	e8 b6 10 00 00       	call   513d <wait>
+  for(a = (char*)(KERNBASE); a < (char*) (KERNBASE+2000000); a += 50000){
+    4087:	81 45 f4 50 c3 00 00 	addl   $0xc350,-0xc(%ebp)
+    408e:	81 7d f4 7f 84 1e 80 	cmpl   $0x801e847f,-0xc(%ebp)
+    4095:	76 81                	jbe    4018 <sbrktest+0x2e2>
+  }
+
+  // if we run the system out of memory, does it clean up the last
+  // failed allocation?
+  if(pipe(fds) != 0){
+    4097:	83 ec 0c             	sub    $0xc,%esp
+    409a:	8d 45 c8             	lea    -0x38(%ebp),%eax
+    409d:	50                   	push   %eax
+    409e:	e8 a1 10 00 00       	call   5144 <pipe>
+    40a3:	83 c4 10             	add    $0x10,%esp
+    40a6:	85 c0                	test   %eax,%eax
+    40a8:	74 17                	je     40c1 <sbrktest+0x38b>
+    printf(1, "pipe() failed\n");
+    40aa:	83 ec 08             	sub    $0x8,%esp
+    40ad:	68 8d 5a 00 00       	push   $0x5a8d
+    40b2:	6a 01                	push   $0x1
+    40b4:	e8 53 12 00 00       	call   530c <printf>
+    40b9:	83 c4 10             	add    $0x10,%esp
+    exit();
+    40bc:	e8 75 10 00 00       	call   5136 <exit>
+  }
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    40c1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    40c8:	e9 86 00 00 00       	jmp    4153 <sbrktest+0x41d>
+    if((pids[i] = fork()) == 0){
+    40cd:	e8 5d 10 00 00       	call   512f <fork>
+    40d2:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    40d5:	89 44 95 a0          	mov    %eax,-0x60(%ebp,%edx,4)
+    40d9:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    40dc:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    40e0:	85 c0                	test   %eax,%eax
+    40e2:	75 4a                	jne    412e <sbrktest+0x3f8>
+      // allocate a lot of memory
+      sbrk(BIG - (uint)sbrk(0));
+    40e4:	83 ec 0c             	sub    $0xc,%esp
+    40e7:	6a 00                	push   $0x0
+    40e9:	e8 c8 10 00 00       	call   51b6 <sbrk>
+    40ee:	83 c4 10             	add    $0x10,%esp
+    40f1:	89 c2                	mov    %eax,%edx
+    40f3:	b8 00 00 40 06       	mov    $0x6400000,%eax
+    40f8:	29 d0                	sub    %edx,%eax
+    40fa:	83 ec 0c             	sub    $0xc,%esp
+    40fd:	50                   	push   %eax
+    40fe:	e8 b3 10 00 00       	call   51b6 <sbrk>
+    4103:	83 c4 10             	add    $0x10,%esp
+      write(fds[1], "x", 1);
+    4106:	8b 45 cc             	mov    -0x34(%ebp),%eax
+    4109:	83 ec 04             	sub    $0x4,%esp
+    410c:	6a 01                	push   $0x1
+    410e:	68 c0 5b 00 00       	push   $0x5bc0
+    4113:	50                   	push   %eax
+    4114:	e8 39 10 00 00       	call   5152 <write>
+    4119:	83 c4 10             	add    $0x10,%esp
+      // sit around until killed
+      for(;;) sleep(1000);
+    411c:	83 ec 0c             	sub    $0xc,%esp
+    411f:	68 e8 03 00 00       	push   $0x3e8
+    4124:	e8 97 10 00 00       	call   51c0 <sleep>
+    4129:	83 c4 10             	add    $0x10,%esp
+    412c:	eb ee                	jmp    411c <sbrktest+0x3e6>
+    }
+    if(pids[i] != -1)
+    412e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4131:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    4135:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4138:	74 15                	je     414f <sbrktest+0x419>
+      read(fds[0], &scratch, 1);
+    413a:	8b 45 c8             	mov    -0x38(%ebp),%eax
+    413d:	83 ec 04             	sub    $0x4,%esp
+    4140:	6a 01                	push   $0x1
+    4142:	8d 55 9f             	lea    -0x61(%ebp),%edx
+    4145:	52                   	push   %edx
+    4146:	50                   	push   %eax
+    4147:	e8 ff 0f 00 00       	call   514b <read>
+    414c:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    414f:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    4153:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4156:	83 f8 09             	cmp    $0x9,%eax
+    4159:	0f 86 6e ff ff ff    	jbe    40cd <sbrktest+0x397>
+  }
+  // if those failed allocations freed up the pages they did allocate,
+  // we'll be able to allocate here
+  c = sbrk(4096);
+    415f:	83 ec 0c             	sub    $0xc,%esp
+    4162:	68 00 10 00 00       	push   $0x1000
+    4167:	e8 4a 10 00 00       	call   51b6 <sbrk>
+    416c:	83 c4 10             	add    $0x10,%esp
+    416f:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    4172:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    4179:	eb 2b                	jmp    41a6 <sbrktest+0x470>
+    if(pids[i] == -1)
+    417b:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    417e:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    4182:	83 f8 ff             	cmp    $0xffffffff,%eax
+    4185:	74 1a                	je     41a1 <sbrktest+0x46b>
+      continue;
+    kill(pids[i]);
+    4187:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    418a:	8b 44 85 a0          	mov    -0x60(%ebp,%eax,4),%eax
+    418e:	83 ec 0c             	sub    $0xc,%esp
+    4191:	50                   	push   %eax
+    4192:	e8 c9 0f 00 00       	call   5160 <kill>
+    4197:	83 c4 10             	add    $0x10,%esp
+    wait();
+    419a:	e8 9e 0f 00 00       	call   513d <wait>
+    419f:	eb 01                	jmp    41a2 <sbrktest+0x46c>
+      continue;
+    41a1:	90                   	nop
+  for(i = 0; i < sizeof(pids)/sizeof(pids[0]); i++){
+    41a2:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    41a6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    41a9:	83 f8 09             	cmp    $0x9,%eax
+    41ac:	76 cd                	jbe    417b <sbrktest+0x445>
+  }
+  if(c == (char*)0xffffffff){
+    41ae:	83 7d e4 ff          	cmpl   $0xffffffff,-0x1c(%ebp)
+    41b2:	75 1b                	jne    41cf <sbrktest+0x499>
+    printf(stdout, "failed sbrk leaked memory\n");
+    41b4:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    41b9:	83 ec 08             	sub    $0x8,%esp
+    41bc:	68 fa 6f 00 00       	push   $0x6ffa
+    41c1:	50                   	push   %eax
+    41c2:	e8 45 11 00 00       	call   530c <printf>
+    41c7:	83 c4 10             	add    $0x10,%esp
+    exit();
+    41ca:	e8 67 0f 00 00       	call   5136 <exit>
+  }
+
+  if(sbrk(0) > oldbrk)
+    41cf:	83 ec 0c             	sub    $0xc,%esp
+    41d2:	6a 00                	push   $0x0
+    41d4:	e8 dd 0f 00 00       	call   51b6 <sbrk>
+    41d9:	83 c4 10             	add    $0x10,%esp
+    41dc:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    41df:	73 1e                	jae    41ff <sbrktest+0x4c9>
+    sbrk(-(sbrk(0) - oldbrk));
+    41e1:	83 ec 0c             	sub    $0xc,%esp
+    41e4:	6a 00                	push   $0x0
+    41e6:	e8 cb 0f 00 00       	call   51b6 <sbrk>
+    41eb:	83 c4 10             	add    $0x10,%esp
+    41ee:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    41f1:	29 c2                	sub    %eax,%edx
+    41f3:	83 ec 0c             	sub    $0xc,%esp
+    41f6:	52                   	push   %edx
+    41f7:	e8 ba 0f 00 00       	call   51b6 <sbrk>
+    41fc:	83 c4 10             	add    $0x10,%esp
+
+  printf(stdout, "sbrk test OK\n");
+    41ff:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4204:	83 ec 08             	sub    $0x8,%esp
+    4207:	68 15 70 00 00       	push   $0x7015
+    420c:	50                   	push   %eax
+    420d:	e8 fa 10 00 00       	call   530c <printf>
+    4212:	83 c4 10             	add    $0x10,%esp
+}
+    4215:	90                   	nop
+    4216:	c9                   	leave
+    4217:	c3                   	ret
+
+00004218 <superpagetest>:
+// Grow the heap over whole, aligned 4MB stretches so the kernel
+// can back them with superpages, then check that fork copies them
+// and that shrinking into the middle of one keeps the rest.
+void
+superpagetest(void)
+{
+    4218:	55                   	push   %ebp
+    4219:	89 e5                	mov    %esp,%ebp
+    421b:	83 ec 18             	sub    $0x18,%esp
+  char *oldbrk, *a, *p;
+  int pid;
+
+  printf(stdout, "superpage test\n");
+    421e:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4223:	83 ec 08             	sub    $0x8,%esp
+    4226:	68 23 70 00 00       	push   $0x7023
+    422b:	50                   	push   %eax
+    422c:	e8 db 10 00 00       	call   530c <printf>
+    4231:	83 c4 10             	add    $0x10,%esp
+  oldbrk = sbrk(0);
+    4234:	83 ec 0c             	sub    $0xc,%esp
+    4237:	6a 00                	push   $0x0
+    4239:	e8 78 0f 00 00       	call   51b6 <sbrk>
+    423e:	83 c4 10             	add    $0x10,%esp
+    4241:	89 45 f0             	mov    %eax,-0x10(%ebp)
+#define SUPER (4*1024*1024)
+  a = (char*)(((uint)oldbrk + SUPER - 1) & ~(SUPER - 1));
+    4244:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4247:	05 ff ff 3f 00       	add    $0x3fffff,%eax
+    424c:	25 00 00 c0 ff       	and    $0xffc00000,%eax
+    4251:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(sbrk(a - oldbrk + 2*SUPER) != oldbrk){
+    4254:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4257:	2b 45 f0             	sub    -0x10(%ebp),%eax
+    425a:	05 00 00 80 00       	add    $0x800000,%eax
+    425f:	83 ec 0c             	sub    $0xc,%esp
+    4262:	50                   	push   %eax
+    4263:	e8 4e 0f 00 00       	call   51b6 <sbrk>
+    4268:	83 c4 10             	add    $0x10,%esp
+    426b:	39 45 f0             	cmp    %eax,-0x10(%ebp)
+    426e:	74 1b                	je     428b <superpagetest+0x73>
+    printf(stdout, "superpage sbrk failed\n");
+    4270:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4275:	83 ec 08             	sub    $0x8,%esp
+    4278:	68 33 70 00 00       	push   $0x7033
+    427d:	50                   	push   %eax
+    427e:	e8 89 10 00 00       	call   530c <printf>
+    4283:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4286:	e8 ab 0e 00 00       	call   5136 <exit>
+  }
+  for(p = a; p < a + 2*SUPER; p += 4096)
+    428b:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    428e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4291:	eb 14                	jmp    42a7 <superpagetest+0x8f>
+    *p = (uint)p >> 12;
+    4293:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4296:	c1 e8 0c             	shr    $0xc,%eax
+    4299:	89 c2                	mov    %eax,%edx
+    429b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    429e:	88 10                	mov    %dl,(%eax)
+  for(p = a; p < a + 2*SUPER; p += 4096)
+    42a0:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    42a7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    42aa:	05 00 00 80 00       	add    $0x800000,%eax
+    42af:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    42b2:	72 df                	jb     4293 <superpagetest+0x7b>
+
+  pid = fork();
+    42b4:	e8 76 0e 00 00       	call   512f <fork>
+    42b9:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  if(pid < 0){
+    42bc:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    42c0:	79 1b                	jns    42dd <superpagetest+0xc5>
+    printf(stdout, "superpage fork failed\n");
+    42c2:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    42c7:	83 ec 08             	sub    $0x8,%esp
+    42ca:	68 4a 70 00 00       	push   $0x704a
+    42cf:	50                   	push   %eax
+    42d0:	e8 37 10 00 00       	call   530c <printf>
+    42d5:	83 c4 10             	add    $0x10,%esp
+    exit();
+    42d8:	e8 59 0e 00 00       	call   5136 <exit>
+  }
+  if(pid == 0){
+    42dd:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    42e1:	75 55                	jne    4338 <superpagetest+0x120>
+    for(p = a; p < a + 2*SUPER; p += 4096){
+    42e3:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    42e6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    42e9:	eb 3b                	jmp    4326 <superpagetest+0x10e>
+      if(*p != (char)((uint)p >> 12)){
+    42eb:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    42ee:	0f b6 00             	movzbl (%eax),%eax
+    42f1:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    42f4:	c1 ea 0c             	shr    $0xc,%edx
+    42f7:	38 d0                	cmp    %dl,%al
+    42f9:	74 1e                	je     4319 <superpagetest+0x101>
+        printf(stdout, "superpage child saw wrong data at %x\n", p);
+    42fb:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4300:	83 ec 04             	sub    $0x4,%esp
+    4303:	ff 75 f4             	push   -0xc(%ebp)
+    4306:	68 64 70 00 00       	push   $0x7064
+    430b:	50                   	push   %eax
+    430c:	e8 fb 0f 00 00       	call   530c <printf>
+    4311:	83 c4 10             	add    $0x10,%esp
+        exit();
+    4314:	e8 1d 0e 00 00       	call   5136 <exit>
+      }
+      *p = 0;
+    4319:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    431c:	c6 00 00             	movb   $0x0,(%eax)
+    for(p = a; p < a + 2*SUPER; p += 4096){
+    431f:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    4326:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4329:	05 00 00 80 00       	add    $0x800000,%eax
+    432e:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    4331:	72 b8                	jb     42eb <superpagetest+0xd3>
+    }
+    exit();
+    4333:	e8 fe 0d 00 00       	call   5136 <exit>
+  }
+  wait();
+    4338:	e8 00 0e 00 00       	call   513d <wait>
+  for(p = a; p < a + 2*SUPER; p += 4096){
+    433d:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4340:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4343:	eb 35                	jmp    437a <superpagetest+0x162>
+    if(*p != (char)((uint)p >> 12)){
+    4345:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4348:	0f b6 00             	movzbl (%eax),%eax
+    434b:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    434e:	c1 ea 0c             	shr    $0xc,%edx
+    4351:	38 d0                	cmp    %dl,%al
+    4353:	74 1e                	je     4373 <superpagetest+0x15b>
+      printf(stdout, "superpage parent saw child's write at %x\n", p);
+    4355:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    435a:	83 ec 04             	sub    $0x4,%esp
+    435d:	ff 75 f4             	push   -0xc(%ebp)
+    4360:	68 8c 70 00 00       	push   $0x708c
+    4365:	50                   	push   %eax
+    4366:	e8 a1 0f 00 00       	call   530c <printf>
+    436b:	83 c4 10             	add    $0x10,%esp
+      exit();
+    436e:	e8 c3 0d 00 00       	call   5136 <exit>
+  for(p = a; p < a + 2*SUPER; p += 4096){
+    4373:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    437a:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    437d:	05 00 00 80 00       	add    $0x800000,%eax
+    4382:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    4385:	72 be                	jb     4345 <superpagetest+0x12d>
+    }
+  }
+
+  // Cut back into the middle of the first superpage.
+  if(sbrk(-(SUPER + SUPER/2)) == (char*)0xffffffff){
+    4387:	83 ec 0c             	sub    $0xc,%esp
+    438a:	68 00 00 a0 ff       	push   $0xffa00000
+    438f:	e8 22 0e 00 00       	call   51b6 <sbrk>
+    4394:	83 c4 10             	add    $0x10,%esp
+    4397:	83 f8 ff             	cmp    $0xffffffff,%eax
+    439a:	75 1b                	jne    43b7 <superpagetest+0x19f>
+    printf(stdout, "superpage shrink failed\n");
+    439c:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    43a1:	83 ec 08             	sub    $0x8,%esp
+    43a4:	68 b6 70 00 00       	push   $0x70b6
+    43a9:	50                   	push   %eax
+    43aa:	e8 5d 0f 00 00       	call   530c <printf>
+    43af:	83 c4 10             	add    $0x10,%esp
+    exit();
+    43b2:	e8 7f 0d 00 00       	call   5136 <exit>
+  }
+  for(p = a; p < a + SUPER/2; p += 4096){
+    43b7:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    43ba:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    43bd:	eb 35                	jmp    43f4 <superpagetest+0x1dc>
+    if(*p != (char)((uint)p >> 12)){
+    43bf:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    43c2:	0f b6 00             	movzbl (%eax),%eax
+    43c5:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    43c8:	c1 ea 0c             	shr    $0xc,%edx
+    43cb:	38 d0                	cmp    %dl,%al
+    43cd:	74 1e                	je     43ed <superpagetest+0x1d5>
+      printf(stdout, "superpage shrink lost data at %x\n", p);
+    43cf:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    43d4:	83 ec 04             	sub    $0x4,%esp
+    43d7:	ff 75 f4             	push   -0xc(%ebp)
+    43da:	68 d0 70 00 00       	push   $0x70d0
+    43df:	50                   	push   %eax
+    43e0:	e8 27 0f 00 00       	call   530c <printf>
+    43e5:	83 c4 10             	add    $0x10,%esp
+      exit();
+    43e8:	e8 49 0d 00 00       	call   5136 <exit>
+  for(p = a; p < a + SUPER/2; p += 4096){
+    43ed:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    43f4:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    43f7:	05 00 00 20 00       	add    $0x200000,%eax
+    43fc:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    43ff:	72 be                	jb     43bf <superpagetest+0x1a7>
+    }
+  }
+
+  sbrk(-(sbrk(0) - oldbrk));
+    4401:	83 ec 0c             	sub    $0xc,%esp
+    4404:	6a 00                	push   $0x0
+    4406:	e8 ab 0d 00 00       	call   51b6 <sbrk>
+    440b:	83 c4 10             	add    $0x10,%esp
+    440e:	8b 55 f0             	mov    -0x10(%ebp),%edx
+    4411:	29 c2                	sub    %eax,%edx
+    4413:	83 ec 0c             	sub    $0xc,%esp
+    4416:	52                   	push   %edx
+    4417:	e8 9a 0d 00 00       	call   51b6 <sbrk>
+    441c:	83 c4 10             	add    $0x10,%esp
+  printf(stdout, "superpage test OK\n");
+    441f:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4424:	83 ec 08             	sub    $0x8,%esp
+    4427:	68 f2 70 00 00       	push   $0x70f2
+    442c:	50                   	push   %eax
+    442d:	e8 da 0e 00 00       	call   530c <printf>
+    4432:	83 c4 10             	add    $0x10,%esp
+}
+    4435:	90                   	nop
+    4436:	c9                   	leave
+    4437:	c3                   	ret
+
+00004438 <validateint>:
+
+void
+validateint(int *p)
+{
+    4438:	55                   	push   %ebp
+    4439:	89 e5                	mov    %esp,%ebp
+    443b:	53                   	push   %ebx
+    443c:	83 ec 10             	sub    $0x10,%esp
+  int res;
+  asm("mov %%esp, %%ebx\n\t"
+    443f:	b8 0d 00 00 00       	mov    $0xd,%eax
+    4444:	8b 55 08             	mov    0x8(%ebp),%edx
+    4447:	89 d1                	mov    %edx,%ecx
+    4449:	89 e3                	mov    %esp,%ebx
+    444b:	89 cc                	mov    %ecx,%esp
+    444d:	cd 40                	int    $0x40
+    444f:	89 dc                	mov    %ebx,%esp
+    4451:	89 45 f8             	mov    %eax,-0x8(%ebp)
+      "int %2\n\t"
+      "mov %%ebx, %%esp" :
+      "=a" (res) :
+      "a" (SYS_sleep), "n" (T_SYSCALL), "c" (p) :
+      "ebx");
+}
+    4454:	90                   	nop
+    4455:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4458:	c9                   	leave
+    4459:	c3                   	ret
+
+0000445a <validatetest>:
+
+void
+validatetest(void)
+{
+    445a:	55                   	push   %ebp
+    445b:	89 e5                	mov    %esp,%ebp
+    445d:	83 ec 18             	sub    $0x18,%esp
+  int hi, pid;
+  uint p;
+
+  printf(stdout, "validate test\n");
+    4460:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4465:	83 ec 08             	sub    $0x8,%esp
+    4468:	68 05 71 00 00       	push   $0x7105
+    446d:	50                   	push   %eax
+    446e:	e8 99 0e 00 00       	call   530c <printf>
+    4473:	83 c4 10             	add    $0x10,%esp
+  hi = 1100*1024;
+    4476:	c7 45 f0 00 30 11 00 	movl   $0x113000,-0x10(%ebp)
+
+  for(p = 0; p <= (uint)hi; p += 4096){
+    447d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4484:	e9 8a 00 00 00       	jmp    4513 <validatetest+0xb9>
+    if((pid = fork()) == 0){
+    4489:	e8 a1 0c 00 00       	call   512f <fork>
+    448e:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    4491:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4495:	75 14                	jne    44ab <validatetest+0x51>
+      // try to crash the kernel by passing in a badly placed integer
+      validateint((int*)p);
+    4497:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    449a:	83 ec 0c             	sub    $0xc,%esp
+    449d:	50                   	push   %eax
+    449e:	e8 95 ff ff ff       	call   4438 <validateint>
+    44a3:	83 c4 10             	add    $0x10,%esp
+      exit();
+    44a6:	e8 8b 0c 00 00       	call   5136 <exit>
+    }
+    sleep(0);
+    44ab:	83 ec 0c             	sub    $0xc,%esp
+    44ae:	6a 00                	push   $0x0
+    44b0:	e8 0b 0d 00 00       	call   51c0 <sleep>
+    44b5:	83 c4 10             	add    $0x10,%esp
+    sleep(0);
+    44b8:	83 ec 0c             	sub    $0xc,%esp
+    44bb:	6a 00                	push   $0x0
+    44bd:	e8 fe 0c 00 00       	call   51c0 <sleep>
+    44c2:	83 c4 10             	add    $0x10,%esp
+    kill(pid);
+    44c5:	83 ec 0c             	sub    $0xc,%esp
+    44c8:	ff 75 ec             	push   -0x14(%ebp)
+    44cb:	e8 90 0c 00 00       	call   5160 <kill>
+    44d0:	83 c4 10             	add    $0x10,%esp
+    wait();
+    44d3:	e8 65 0c 00 00       	call   513d <wait>
+
+    // try to crash the kernel by passing in a bad string pointer
+    if(link("nosuchfile", (char*)p) != -1){
+    44d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    44db:	83 ec 08             	sub    $0x8,%esp
+    44de:	50                   	push   %eax
+    44df:	68 14 71 00 00       	push   $0x7114
+    44e4:	e8 a1 0c 00 00       	call   518a <link>
+    44e9:	83 c4 10             	add    $0x10,%esp
+    44ec:	83 f8 ff             	cmp    $0xffffffff,%eax
+    44ef:	74 1b                	je     450c <validatetest+0xb2>
+      printf(stdout, "link should not succeed\n");
+    44f1:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    44f6:	83 ec 08             	sub    $0x8,%esp
+    44f9:	68 1f 71 00 00       	push   $0x711f
+    44fe:	50                   	push   %eax
+    44ff:	e8 08 0e 00 00       	call   530c <printf>
+    4504:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4507:	e8 2a 0c 00 00       	call   5136 <exit>
+  for(p = 0; p <= (uint)hi; p += 4096){
+    450c:	81 45 f4 00 10 00 00 	addl   $0x1000,-0xc(%ebp)
+    4513:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    4516:	3b 45 f4             	cmp    -0xc(%ebp),%eax
+    4519:	0f 83 6a ff ff ff    	jae    4489 <validatetest+0x2f>
+    }
+  }
+
+  printf(stdout, "validate ok\n");
+    451f:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4524:	83 ec 08             	sub    $0x8,%esp
+    4527:	68 38 71 00 00       	push   $0x7138
+    452c:	50                   	push   %eax
+    452d:	e8 da 0d 00 00       	call   530c <printf>
+    4532:	83 c4 10             	add    $0x10,%esp
+}
+    4535:	90                   	nop
+    4536:	c9                   	leave
+    4537:	c3                   	ret
+
+00004538 <bsstest>:
+
+// does unintialized data start out zero?
+char uninit[10000];
+void
+bsstest(void)
+{
+    4538:	55                   	push   %ebp
+    4539:	89 e5                	mov    %esp,%ebp
+    453b:	83 ec 18             	sub    $0x18,%esp
+  int i;
+
+  printf(stdout, "bss test\n");
+    453e:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4543:	83 ec 08             	sub    $0x8,%esp
+    4546:	68 45 71 00 00       	push   $0x7145
+    454b:	50                   	push   %eax
+    454c:	e8 bb 0d 00 00       	call   530c <printf>
+    4551:	83 c4 10             	add    $0x10,%esp
+  for(i = 0; i < sizeof(uninit); i++){
+    4554:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    455b:	eb 2e                	jmp    458b <bsstest+0x53>
+    if(uninit[i] != '\0'){
+    455d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4560:	05 a0 a5 00 00       	add    $0xa5a0,%eax
+    4565:	0f b6 00             	movzbl (%eax),%eax
+    4568:	84 c0                	test   %al,%al
+    456a:	74 1b                	je     4587 <bsstest+0x4f>
+      printf(stdout, "bss test failed\n");
+    456c:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4571:	83 ec 08             	sub    $0x8,%esp
+    4574:	68 4f 71 00 00       	push   $0x714f
+    4579:	50                   	push   %eax
+    457a:	e8 8d 0d 00 00       	call   530c <printf>
+    457f:	83 c4 10             	add    $0x10,%esp
+      exit();
+    4582:	e8 af 0b 00 00       	call   5136 <exit>
+  for(i = 0; i < sizeof(uninit); i++){
+    4587:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    458b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    458e:	3d 0f 27 00 00       	cmp    $0x270f,%eax
+    4593:	76 c8                	jbe    455d <bsstest+0x25>
+    }
+  }
+  printf(stdout, "bss test ok\n");
+    4595:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    459a:	83 ec 08             	sub    $0x8,%esp
+    459d:	68 60 71 00 00       	push   $0x7160
+    45a2:	50                   	push   %eax
+    45a3:	e8 64 0d 00 00       	call   530c <printf>
+    45a8:	83 c4 10             	add    $0x10,%esp
+}
+    45ab:	90                   	nop
+    45ac:	c9                   	leave
+    45ad:	c3                   	ret
+
+000045ae <bigargtest>:
+// does exec return an error if the arguments
+// are larger than a page? or does it write
+// below the stack and wreck the instructions/data?
+void
+bigargtest(void)
+{
+    45ae:	55                   	push   %ebp
+    45af:	89 e5                	mov    %esp,%ebp
+    45b1:	83 ec 18             	sub    $0x18,%esp
+  int pid, fd;
+
+  unlink("bigarg-ok");
+    45b4:	83 ec 0c             	sub    $0xc,%esp
+    45b7:	68 6d 71 00 00       	push   $0x716d
+    45bc:	e8 bb 0b 00 00       	call   517c <unlink>
+    45c1:	83 c4 10             	add    $0x10,%esp
+  pid = fork();
+    45c4:	e8 66 0b 00 00       	call   512f <fork>
+    45c9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  if(pid == 0){
+    45cc:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    45d0:	0f 85 97 00 00 00    	jne    466d <bigargtest+0xbf>
+    static char *args[MAXARG];
+    int i;
+    for(i = 0; i < MAXARG-1; i++)
+    45d6:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    45dd:	eb 12                	jmp    45f1 <bigargtest+0x43>
+      args[i] = "bigargs test: failed\n                                                                                                                                                                                                       ";
+    45df:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    45e2:	c7 04 85 c0 cc 00 00 	movl   $0x7178,0xccc0(,%eax,4)
+    45e9:	78 71 00 00 
+    for(i = 0; i < MAXARG-1; i++)
+    45ed:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    45f1:	83 7d f4 1e          	cmpl   $0x1e,-0xc(%ebp)
+    45f5:	7e e8                	jle    45df <bigargtest+0x31>
+    args[MAXARG-1] = 0;
+    45f7:	c7 05 3c cd 00 00 00 	movl   $0x0,0xcd3c
+    45fe:	00 00 00 
+    printf(stdout, "bigarg test\n");
+    4601:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4606:	83 ec 08             	sub    $0x8,%esp
+    4609:	68 55 72 00 00       	push   $0x7255
+    460e:	50                   	push   %eax
+    460f:	e8 f8 0c 00 00       	call   530c <printf>
+    4614:	83 c4 10             	add    $0x10,%esp
+    exec("echo", args);
+    4617:	83 ec 08             	sub    $0x8,%esp
+    461a:	68 c0 cc 00 00       	push   $0xccc0
+    461f:	68 4c 57 00 00       	push   $0x574c
+    4624:	e8 3e 0b 00 00       	call   5167 <exec>
+    4629:	83 c4 10             	add    $0x10,%esp
+    printf(stdout, "bigarg test ok\n");
+    462c:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4631:	83 ec 08             	sub    $0x8,%esp
+    4634:	68 62 72 00 00       	push   $0x7262
+    4639:	50                   	push   %eax
+    463a:	e8 cd 0c 00 00       	call   530c <printf>
+    463f:	83 c4 10             	add    $0x10,%esp
+    fd = open("bigarg-ok", O_CREATE);
+    4642:	83 ec 08             	sub    $0x8,%esp
+    4645:	68 00 02 00 00       	push   $0x200
+    464a:	68 6d 71 00 00       	push   $0x716d
+    464f:	e8 1a 0b 00 00       	call   516e <open>
+    4654:	83 c4 10             	add    $0x10,%esp
+    4657:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    close(fd);
+    465a:	83 ec 0c             	sub    $0xc,%esp
+    465d:	ff 75 ec             	push   -0x14(%ebp)
+    4660:	e8 f4 0a 00 00       	call   5159 <close>
+    4665:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4668:	e8 c9 0a 00 00       	call   5136 <exit>
+  } else if(pid < 0){
+    466d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4671:	79 1b                	jns    468e <bigargtest+0xe0>
+    printf(stdout, "bigargtest: fork failed\n");
+    4673:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    4678:	83 ec 08             	sub    $0x8,%esp
+    467b:	68 72 72 00 00       	push   $0x7272
+    4680:	50                   	push   %eax
+    4681:	e8 86 0c 00 00       	call   530c <printf>
+    4686:	83 c4 10             	add    $0x10,%esp
+    exit();
+    4689:	e8 a8 0a 00 00       	call   5136 <exit>
+  }
+  wait();
+    468e:	e8 aa 0a 00 00       	call   513d <wait>
+  fd = open("bigarg-ok", 0);
+    4693:	83 ec 08             	sub    $0x8,%esp
+    4696:	6a 00                	push   $0x0
+    4698:	68 6d 71 00 00       	push   $0x716d
+    469d:	e8 cc 0a 00 00       	call   516e <open>
+    46a2:	83 c4 10             	add    $0x10,%esp
+    46a5:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if(fd < 0){
+    46a8:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    46ac:	79 1b                	jns    46c9 <bigargtest+0x11b>
+    printf(stdout, "bigarg test failed!\n");
+    46ae:	a1 ec 7d 00 00       	mov    0x7dec,%eax
+    46b3:	83 ec 08             	sub    $0x8,%esp
+    46b6:	68 8b 72 00 00       	push   $0x728b
+    46bb:	50                   	push   %eax
+    46bc:	e8 4b 0c 00 00       	call   530c <printf>
+    46c1:	83 c4 10             	add    $0x10,%esp
+    exit();
+    46c4:	e8 6d 0a 00 00       	call   5136 <exit>
+  }
+  close(fd);
+    46c9:	83 ec 0c             	sub    $0xc,%esp
+    46cc:	ff 75 ec             	push   -0x14(%ebp)
+    46cf:	e8 85 0a 00 00       	call   5159 <close>
+    46d4:	83 c4 10             	add    $0x10,%esp
+  unlink("bigarg-ok");
+    46d7:	83 ec 0c             	sub    $0xc,%esp
+    46da:	68 6d 71 00 00       	push   $0x716d
+    46df:	e8 98 0a 00 00       	call   517c <unlink>
+    46e4:	83 c4 10             	add    $0x10,%esp
+}
+    46e7:	90                   	nop
+    46e8:	c9                   	leave
+    46e9:	c3                   	ret
+
+000046ea <fsfull>:
+
+// what happens when the file system runs out of blocks?
+// answer: balloc panics, so this test is not useful.
+void
+fsfull()
+{
+    46ea:	55                   	push   %ebp
+    46eb:	89 e5                	mov    %esp,%ebp
+    46ed:	53                   	push   %ebx
+    46ee:	83 ec 64             	sub    $0x64,%esp
+  int nfiles;
+  int fsblocks = 0;
+    46f1:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+
+  printf(1, "fsfull test\n");
+    46f8:	83 ec 08             	sub    $0x8,%esp
+    46fb:	68 a0 72 00 00       	push   $0x72a0
+    4700:	6a 01                	push   $0x1
+    4702:	e8 05 0c 00 00       	call   530c <printf>
+    4707:	83 c4 10             	add    $0x10,%esp
+
+  for(nfiles = 0; ; nfiles++){
+    470a:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    char name[64];
+    name[0] = 'f';
+    4711:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4715:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4718:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    471d:	89 c8                	mov    %ecx,%eax
+    471f:	f7 ea                	imul   %edx
+    4721:	c1 fa 06             	sar    $0x6,%edx
+    4724:	89 c8                	mov    %ecx,%eax
+    4726:	c1 f8 1f             	sar    $0x1f,%eax
+    4729:	29 c2                	sub    %eax,%edx
+    472b:	89 d0                	mov    %edx,%eax
+    472d:	83 c0 30             	add    $0x30,%eax
+    4730:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    4733:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4736:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    473b:	89 d8                	mov    %ebx,%eax
+    473d:	f7 ea                	imul   %edx
+    473f:	c1 fa 06             	sar    $0x6,%edx
+    4742:	89 d8                	mov    %ebx,%eax
+    4744:	c1 f8 1f             	sar    $0x1f,%eax
+    4747:	89 d1                	mov    %edx,%ecx
+    4749:	29 c1                	sub    %eax,%ecx
+    474b:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    4751:	29 c3                	sub    %eax,%ebx
+    4753:	89 d9                	mov    %ebx,%ecx
+    4755:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    475a:	89 c8                	mov    %ecx,%eax
+    475c:	f7 ea                	imul   %edx
+    475e:	c1 fa 05             	sar    $0x5,%edx
+    4761:	89 c8                	mov    %ecx,%eax
+    4763:	c1 f8 1f             	sar    $0x1f,%eax
+    4766:	29 c2                	sub    %eax,%edx
+    4768:	89 d0                	mov    %edx,%eax
+    476a:	83 c0 30             	add    $0x30,%eax
+    476d:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    4770:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    4773:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    4778:	89 d8                	mov    %ebx,%eax
+    477a:	f7 ea                	imul   %edx
+    477c:	c1 fa 05             	sar    $0x5,%edx
+    477f:	89 d8                	mov    %ebx,%eax
+    4781:	c1 f8 1f             	sar    $0x1f,%eax
+    4784:	89 d1                	mov    %edx,%ecx
+    4786:	29 c1                	sub    %eax,%ecx
+    4788:	6b c1 64             	imul   $0x64,%ecx,%eax
+    478b:	29 c3                	sub    %eax,%ebx
+    478d:	89 d9                	mov    %ebx,%ecx
+    478f:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4794:	89 c8                	mov    %ecx,%eax
+    4796:	f7 ea                	imul   %edx
+    4798:	c1 fa 02             	sar    $0x2,%edx
+    479b:	89 c8                	mov    %ecx,%eax
+    479d:	c1 f8 1f             	sar    $0x1f,%eax
+    47a0:	29 c2                	sub    %eax,%edx
+    47a2:	89 d0                	mov    %edx,%eax
+    47a4:	83 c0 30             	add    $0x30,%eax
+    47a7:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    47aa:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    47ad:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    47b2:	89 c8                	mov    %ecx,%eax
+    47b4:	f7 ea                	imul   %edx
+    47b6:	c1 fa 02             	sar    $0x2,%edx
+    47b9:	89 c8                	mov    %ecx,%eax
+    47bb:	c1 f8 1f             	sar    $0x1f,%eax
+    47be:	29 c2                	sub    %eax,%edx
+    47c0:	89 d0                	mov    %edx,%eax
+    47c2:	c1 e0 02             	shl    $0x2,%eax
+    47c5:	01 d0                	add    %edx,%eax
+    47c7:	01 c0                	add    %eax,%eax
+    47c9:	29 c1                	sub    %eax,%ecx
+    47cb:	89 ca                	mov    %ecx,%edx
+    47cd:	89 d0                	mov    %edx,%eax
+    47cf:	83 c0 30             	add    $0x30,%eax
+    47d2:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    47d5:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    printf(1, "writing %s\n", name);
+    47d9:	83 ec 04             	sub    $0x4,%esp
+    47dc:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    47df:	50                   	push   %eax
+    47e0:	68 ad 72 00 00       	push   $0x72ad
+    47e5:	6a 01                	push   $0x1
+    47e7:	e8 20 0b 00 00       	call   530c <printf>
+    47ec:	83 c4 10             	add    $0x10,%esp
+    int fd = open(name, O_CREATE|O_RDWR);
+    47ef:	83 ec 08             	sub    $0x8,%esp
+    47f2:	68 02 02 00 00       	push   $0x202
+    47f7:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    47fa:	50                   	push   %eax
+    47fb:	e8 6e 09 00 00       	call   516e <open>
+    4800:	83 c4 10             	add    $0x10,%esp
+    4803:	89 45 e8             	mov    %eax,-0x18(%ebp)
+    if(fd < 0){
+    4806:	83 7d e8 00          	cmpl   $0x0,-0x18(%ebp)
+    480a:	79 18                	jns    4824 <fsfull+0x13a>
+      printf(1, "open %s failed\n", name);
+    480c:	83 ec 04             	sub    $0x4,%esp
+    480f:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4812:	50                   	push   %eax
+    4813:	68 b9 72 00 00       	push   $0x72b9
+    4818:	6a 01                	push   $0x1
+    481a:	e8 ed 0a 00 00       	call   530c <printf>
+    481f:	83 c4 10             	add    $0x10,%esp
+      break;
+    4822:	eb 6b                	jmp    488f <fsfull+0x1a5>
+    }
+    int total = 0;
+    4824:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+    while(1){
+      int cc = write(fd, buf, 512);
+    482b:	83 ec 04             	sub    $0x4,%esp
+    482e:	68 00 02 00 00       	push   $0x200
+    4833:	68 20 7e 00 00       	push   $0x7e20
+    4838:	ff 75 e8             	push   -0x18(%ebp)
+    483b:	e8 12 09 00 00       	call   5152 <write>
+    4840:	83 c4 10             	add    $0x10,%esp
+    4843:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+      if(cc < 512)
+    4846:	81 7d e4 ff 01 00 00 	cmpl   $0x1ff,-0x1c(%ebp)
+    484d:	7e 0c                	jle    485b <fsfull+0x171>
+        break;
+      total += cc;
+    484f:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    4852:	01 45 ec             	add    %eax,-0x14(%ebp)
+      fsblocks++;
+    4855:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    while(1){
+    4859:	eb d0                	jmp    482b <fsfull+0x141>
+        break;
+    485b:	90                   	nop
+    }
+    printf(1, "wrote %d bytes\n", total);
+    485c:	83 ec 04             	sub    $0x4,%esp
+    485f:	ff 75 ec             	push   -0x14(%ebp)
+    4862:	68 c9 72 00 00       	push   $0x72c9
+    4867:	6a 01                	push   $0x1
+    4869:	e8 9e 0a 00 00       	call   530c <printf>
+    486e:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+    4871:	83 ec 0c             	sub    $0xc,%esp
+    4874:	ff 75 e8             	push   -0x18(%ebp)
+    4877:	e8 dd 08 00 00       	call   5159 <close>
+    487c:	83 c4 10             	add    $0x10,%esp
+    if(total == 0)
+    487f:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    4883:	74 09                	je     488e <fsfull+0x1a4>
+  for(nfiles = 0; ; nfiles++){
+    4885:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+    4889:	e9 83 fe ff ff       	jmp    4711 <fsfull+0x27>
+      break;
+    488e:	90                   	nop
+  }
+
+  while(nfiles >= 0){
+    488f:	e9 db 00 00 00       	jmp    496f <fsfull+0x285>
+    char name[64];
+    name[0] = 'f';
+    4894:	c6 45 a4 66          	movb   $0x66,-0x5c(%ebp)
+    name[1] = '0' + nfiles / 1000;
+    4898:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    489b:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    48a0:	89 c8                	mov    %ecx,%eax
+    48a2:	f7 ea                	imul   %edx
+    48a4:	c1 fa 06             	sar    $0x6,%edx
+    48a7:	89 c8                	mov    %ecx,%eax
+    48a9:	c1 f8 1f             	sar    $0x1f,%eax
+    48ac:	29 c2                	sub    %eax,%edx
+    48ae:	89 d0                	mov    %edx,%eax
+    48b0:	83 c0 30             	add    $0x30,%eax
+    48b3:	88 45 a5             	mov    %al,-0x5b(%ebp)
+    name[2] = '0' + (nfiles % 1000) / 100;
+    48b6:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    48b9:	ba d3 4d 62 10       	mov    $0x10624dd3,%edx
+    48be:	89 d8                	mov    %ebx,%eax
+    48c0:	f7 ea                	imul   %edx
+    48c2:	c1 fa 06             	sar    $0x6,%edx
+    48c5:	89 d8                	mov    %ebx,%eax
+    48c7:	c1 f8 1f             	sar    $0x1f,%eax
+    48ca:	89 d1                	mov    %edx,%ecx
+    48cc:	29 c1                	sub    %eax,%ecx
+    48ce:	69 c1 e8 03 00 00    	imul   $0x3e8,%ecx,%eax
+    48d4:	29 c3                	sub    %eax,%ebx
+    48d6:	89 d9                	mov    %ebx,%ecx
+    48d8:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    48dd:	89 c8                	mov    %ecx,%eax
+    48df:	f7 ea                	imul   %edx
+    48e1:	c1 fa 05             	sar    $0x5,%edx
+    48e4:	89 c8                	mov    %ecx,%eax
+    48e6:	c1 f8 1f             	sar    $0x1f,%eax
+    48e9:	29 c2                	sub    %eax,%edx
+    48eb:	89 d0                	mov    %edx,%eax
+    48ed:	83 c0 30             	add    $0x30,%eax
+    48f0:	88 45 a6             	mov    %al,-0x5a(%ebp)
+    name[3] = '0' + (nfiles % 100) / 10;
+    48f3:	8b 5d f4             	mov    -0xc(%ebp),%ebx
+    48f6:	ba 1f 85 eb 51       	mov    $0x51eb851f,%edx
+    48fb:	89 d8                	mov    %ebx,%eax
+    48fd:	f7 ea                	imul   %edx
+    48ff:	c1 fa 05             	sar    $0x5,%edx
+    4902:	89 d8                	mov    %ebx,%eax
+    4904:	c1 f8 1f             	sar    $0x1f,%eax
+    4907:	89 d1                	mov    %edx,%ecx
+    4909:	29 c1                	sub    %eax,%ecx
+    490b:	6b c1 64             	imul   $0x64,%ecx,%eax
+    490e:	29 c3                	sub    %eax,%ebx
+    4910:	89 d9                	mov    %ebx,%ecx
+    4912:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4917:	89 c8                	mov    %ecx,%eax
+    4919:	f7 ea                	imul   %edx
+    491b:	c1 fa 02             	sar    $0x2,%edx
+    491e:	89 c8                	mov    %ecx,%eax
+    4920:	c1 f8 1f             	sar    $0x1f,%eax
+    4923:	29 c2                	sub    %eax,%edx
+    4925:	89 d0                	mov    %edx,%eax
+    4927:	83 c0 30             	add    $0x30,%eax
+    492a:	88 45 a7             	mov    %al,-0x59(%ebp)
+    name[4] = '0' + (nfiles % 10);
+    492d:	8b 4d f4             	mov    -0xc(%ebp),%ecx
+    4930:	ba 67 66 66 66       	mov    $0x66666667,%edx
+    4935:	89 c8                	mov    %ecx,%eax
+    4937:	f7 ea                	imul   %edx
+    4939:	c1 fa 02             	sar    $0x2,%edx
+    493c:	89 c8                	mov    %ecx,%eax
+    493e:	c1 f8 1f             	sar    $0x1f,%eax
+    4941:	29 c2                	sub    %eax,%edx
+    4943:	89 d0                	mov    %edx,%eax
+    4945:	c1 e0 02             	shl    $0x2,%eax
+    4948:	01 d0                	add    %edx,%eax
+    494a:	01 c0                	add    %eax,%eax
+    494c:	29 c1                	sub    %eax,%ecx
+    494e:	89 ca                	mov    %ecx,%edx
+    4950:	89 d0                	mov    %edx,%eax
+    4952:	83 c0 30             	add    $0x30,%eax
+    4955:	88 45 a8             	mov    %al,-0x58(%ebp)
+    name[5] = '\0';
+    4958:	c6 45 a9 00          	movb   $0x0,-0x57(%ebp)
+    unlink(name);
+    495c:	83 ec 0c             	sub    $0xc,%esp
+    495f:	8d 45 a4             	lea    -0x5c(%ebp),%eax
+    4962:	50                   	push   %eax
+    4963:	e8 14 08 00 00       	call   517c <unlink>
+    4968:	83 c4 10             	add    $0x10,%esp
+    nfiles--;
+    496b:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+  while(nfiles >= 0){
+    496f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4973:	0f 89 1b ff ff ff    	jns    4894 <fsfull+0x1aa>
+  }
+
+  printf(1, "fsfull test finished\n");
+    4979:	83 ec 08             	sub    $0x8,%esp
+    497c:	68 d9 72 00 00       	push   $0x72d9
+    4981:	6a 01                	push   $0x1
+    4983:	e8 84 09 00 00       	call   530c <printf>
+    4988:	83 c4 10             	add    $0x10,%esp
+}
+    498b:	90                   	nop
+    498c:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    498f:	c9                   	leave
+    4990:	c3                   	ret
+
+00004991 <rand>:
+
+unsigned long randstate = 1;
+unsigned int
+rand()
+{
+    4991:	55                   	push   %ebp
+    4992:	89 e5                	mov    %esp,%ebp
+  randstate = randstate * 1664525 + 1013904223;
+    4994:	a1 f0 7d 00 00       	mov    0x7df0,%eax
+    4999:	69 c0 0d 66 19 00    	imul   $0x19660d,%eax,%eax
+    499f:	05 5f f3 6e 3c       	add    $0x3c6ef35f,%eax
+    49a4:	a3 f0 7d 00 00       	mov    %eax,0x7df0
+  return randstate;
+    49a9:	a1 f0 7d 00 00       	mov    0x7df0,%eax
+}
+    49ae:	5d                   	pop    %ebp
+    49af:	c3                   	ret
+
+000049b0 <main>:
+
+int
+main(int argc, char *argv[])
+{
+    49b0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+    49b4:	83 e4 f0             	and    $0xfffffff0,%esp
+    49b7:	ff 71 fc             	push   -0x4(%ecx)
+    49ba:	55                   	push   %ebp
+    49bb:	89 e5                	mov    %esp,%ebp
+    49bd:	51                   	push   %ecx
+    49be:	83 ec 04             	sub    $0x4,%esp
+  printf(1, "usertests starting\n");
+    49c1:	83 ec 08             	sub    $0x8,%esp
+    49c4:	68 ef 72 00 00       	push   $0x72ef
+    49c9:	6a 01                	push   $0x1
+    49cb:	e8 3c 09 00 00       	call   530c <printf>
+    49d0:	83 c4 10             	add    $0x10,%esp
+
+  if(open("usertests.ran", 0) >= 0){
+    49d3:	83 ec 08             	sub    $0x8,%esp
+    49d6:	6a 00                	push   $0x0
+    49d8:	68 03 73 00 00       	push   $0x7303
+    49dd:	e8 8c 07 00 00       	call   516e <open>
+    49e2:	83 c4 10             	add    $0x10,%esp
+    49e5:	85 c0                	test   %eax,%eax
+    49e7:	78 17                	js     4a00 <main+0x50>
+    printf(1, "already ran user tests -- rebuild fs.img\n");
+    49e9:	83 ec 08             	sub    $0x8,%esp
+    49ec:	68 14 73 00 00       	push   $0x7314
+    49f1:	6a 01                	push   $0x1
+    49f3:	e8 14 09 00 00       	call   530c <printf>
+    49f8:	83 c4 10             	add    $0x10,%esp
+    exit();
+    49fb:	e8 36 07 00 00       	call   5136 <exit>
+  }
+  close(open("usertests.ran", O_CREATE));
+    4a00:	83 ec 08             	sub    $0x8,%esp
+    4a03:	68 00 02 00 00       	push   $0x200
+    4a08:	68 03 73 00 00       	push   $0x7303
+    4a0d:	e8 5c 07 00 00       	call   516e <open>
+    4a12:	83 c4 10             	add    $0x10,%esp
+    4a15:	83 ec 0c             	sub    $0xc,%esp
+    4a18:	50                   	push   %eax
+    4a19:	e8 3b 07 00 00       	call   5159 <close>
+    4a1e:	83 c4 10             	add    $0x10,%esp
+
+  bigargtest();
+    4a21:	e8 88 fb ff ff       	call   45ae <bigargtest>
+  bigwrite();
+    4a26:	e8 d8 e8 ff ff       	call   3303 <bigwrite>
+  bigargtest();
+    4a2b:	e8 7e fb ff ff       	call   45ae <bigargtest>
+  bsstest();
+    4a30:	e8 03 fb ff ff       	call   4538 <bsstest>
+  sbrktest();
+    4a35:	e8 fc f2 ff ff       	call   3d36 <sbrktest>
+  superpagetest();
+    4a3a:	e8 d9 f7 ff ff       	call   4218 <superpagetest>
+  validatetest();
+    4a3f:	e8 16 fa ff ff       	call   445a <validatetest>
+
+  opentest();
+    4a44:	e8 b7 b5 ff ff       	call   0 <opentest>
+  writetest();
+    4a49:	e8 61 b6 ff ff       	call   af <writetest>
+  writetest1();
+    4a4e:	e8 6c b8 ff ff       	call   2bf <writetest1>
+  createtest();
+    4a53:	e8 63 ba ff ff       	call   4bb <createtest>
+
+  mem();
+    4a58:	e8 19 cf ff ff       	call   1976 <mem>
+  pipe1();
+    4a5d:	e8 60 bc ff ff       	call   6c2 <pipe1>
+  manypipes();
+    4a62:	e8 44 be ff ff       	call   8ab <manypipes>
+  preempt();
+    4a67:	e8 2c cd ff ff       	call   1798 <preempt>
+  prioritytest();
+    4a6c:	e8 08 c0 ff ff       	call   a79 <prioritytest>
+  threadtest();
+    4a71:	e8 45 c1 ff ff       	call   bbb <threadtest>
+  futextest();
+    4a76:	e8 d9 c3 ff ff       	call   e54 <futextest>
+  vdsotest();
+    4a7b:	e8 9f c5 ff ff       	call   101f <vdsotest>
+  ringtest();
+    4a80:	e8 d9 c7 ff ff       	call   125e <ringtest>
+  fputest();
+    4a85:	e8 b6 cb ff ff       	call   1640 <fputest>
+  exitwait();
+    4a8a:	e8 6f ce ff ff       	call   18fe <exitwait>
+
+  rmdot();
+    4a8f:	e8 e1 ec ff ff       	call   3775 <rmdot>
+  fourteen();
+    4a94:	e8 80 eb ff ff       	call   3619 <fourteen>
+  bigfile();
+    4a99:	e8 63 e9 ff ff       	call   3401 <bigfile>
+  subdir();
+    4a9e:	e8 1c e1 ff ff       	call   2bbf <subdir>
+  concreate();
+    4aa3:	e8 ab da ff ff       	call   2553 <concreate>
+  linkunlink();
+    4aa8:	e8 5a de ff ff       	call   2907 <linkunlink>
+  linktest();
+    4aad:	e8 5f d8 ff ff       	call   2311 <linktest>
+  unlinkread();
+    4ab2:	e8 98 d6 ff ff       	call   214f <unlinkread>
+  createdelete();
+    4ab7:	e8 ed d3 ff ff       	call   1ea9 <createdelete>
+  twofiles();
+    4abc:	e8 89 d1 ff ff       	call   1c4a <twofiles>
+  sharedfd();
+    4ac1:	e8 a1 cf ff ff       	call   1a67 <sharedfd>
+  dirfile();
+    4ac6:	e8 2f ee ff ff       	call   38fa <dirfile>
+  iref();
+    4acb:	e8 62 f0 ff ff       	call   3b32 <iref>
+  forktest();
+    4ad0:	e8 97 f1 ff ff       	call   3c6c <forktest>
+  bigdir(); // slow
+    4ad5:	e8 64 df ff ff       	call   2a3e <bigdir>
+
+  exectest();
+    4ada:	e8 90 bb ff ff       	call   66f <exectest>
+
+  exit();
+    4adf:	e8 52 06 00 00       	call   5136 <exit>
+
+00004ae4 <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+    4ae4:	55                   	push   %ebp
+    4ae5:	89 e5                	mov    %esp,%ebp
+    4ae7:	57                   	push   %edi
+    4ae8:	53                   	push   %ebx
+char*
+    4ae9:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4aec:	8b 55 10             	mov    0x10(%ebp),%edx
+    4aef:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4af2:	89 cb                	mov    %ecx,%ebx
+    4af4:	89 df                	mov    %ebx,%edi
+    4af6:	89 d1                	mov    %edx,%ecx
+    4af8:	fc                   	cld
+    4af9:	f3 aa                	rep stos %al,%es:(%edi)
+    4afb:	89 ca                	mov    %ecx,%edx
+    4afd:	89 fb                	mov    %edi,%ebx
+    4aff:	89 5d 08             	mov    %ebx,0x8(%ebp)
+    4b02:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+    4b05:	90                   	nop
+    4b06:	5b                   	pop    %ebx
+    4b07:	5f                   	pop    %edi
+    4b08:	5d                   	pop    %ebp
+    4b09:	c3                   	ret
+
+00004b0a <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+    4b0a:	55                   	push   %ebp
+    4b0b:	89 e5                	mov    %esp,%ebp
+    4b0d:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+    4b10:	8b 55 08             	mov    0x8(%ebp),%edx
+    4b13:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b16:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4b19:	f0 87 02             	lock xchg %eax,(%edx)
+    4b1c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+    4b1f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+    4b22:	c9                   	leave
+    4b23:	c3                   	ret
+
+00004b24 <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+    4b24:	55                   	push   %ebp
+    4b25:	89 e5                	mov    %esp,%ebp
+    4b27:	53                   	push   %ebx
+    4b28:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+    4b2b:	8b 5d 08             	mov    0x8(%ebp),%ebx
+    4b2e:	8b 55 10             	mov    0x10(%ebp),%edx
+    4b31:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4b34:	8b 4d 08             	mov    0x8(%ebp),%ecx
+    4b37:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+    4b3b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+    4b3e:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+    4b41:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+    4b44:	c9                   	leave
+    4b45:	c3                   	ret
+
+00004b46 <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+    4b46:	55                   	push   %ebp
+    4b47:	89 e5                	mov    %esp,%ebp
+    4b49:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+    4b4c:	0f 31                	rdtsc
+    4b4e:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    4b51:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+    4b54:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    4b57:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+    4b5a:	c9                   	leave
+    4b5b:	c3                   	ret
+
+00004b5c <strcpy>:
+{
+    4b5c:	55                   	push   %ebp
+    4b5d:	89 e5                	mov    %esp,%ebp
+    4b5f:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+    4b62:	8b 45 08             	mov    0x8(%ebp),%eax
+    4b65:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+    4b68:	90                   	nop
+    4b69:	8b 55 0c             	mov    0xc(%ebp),%edx
+    4b6c:	8d 42 01             	lea    0x1(%edx),%eax
+    4b6f:	89 45 0c             	mov    %eax,0xc(%ebp)
+    4b72:	8b 45 08             	mov    0x8(%ebp),%eax
+    4b75:	8d 48 01             	lea    0x1(%eax),%ecx
+    4b78:	89 4d 08             	mov    %ecx,0x8(%ebp)
+    4b7b:	0f b6 12             	movzbl (%edx),%edx
+    4b7e:	88 10                	mov    %dl,(%eax)
+    4b80:	0f b6 00             	movzbl (%eax),%eax
+    4b83:	84 c0                	test   %al,%al
+    4b85:	75 e2                	jne    4b69 <strcpy+0xd>
+  return os;
+    4b87:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4b8a:	c9                   	leave
+    4b8b:	c3                   	ret
+
+00004b8c <strcmp>:
+{
+    4b8c:	55                   	push   %ebp
+    4b8d:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+    4b8f:	eb 08                	jmp    4b99 <strcmp+0xd>
+    p++, q++;
+    4b91:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4b95:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+    4b99:	8b 45 08             	mov    0x8(%ebp),%eax
+    4b9c:	0f b6 00             	movzbl (%eax),%eax
+    4b9f:	84 c0                	test   %al,%al
+    4ba1:	74 10                	je     4bb3 <strcmp+0x27>
+    4ba3:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ba6:	0f b6 10             	movzbl (%eax),%edx
+    4ba9:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4bac:	0f b6 00             	movzbl (%eax),%eax
+    4baf:	38 c2                	cmp    %al,%dl
+    4bb1:	74 de                	je     4b91 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+    4bb3:	8b 45 08             	mov    0x8(%ebp),%eax
+    4bb6:	0f b6 00             	movzbl (%eax),%eax
+    4bb9:	0f b6 d0             	movzbl %al,%edx
+    4bbc:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4bbf:	0f b6 00             	movzbl (%eax),%eax
+    4bc2:	0f b6 c0             	movzbl %al,%eax
+    4bc5:	29 c2                	sub    %eax,%edx
+    4bc7:	89 d0                	mov    %edx,%eax
+}
+    4bc9:	5d                   	pop    %ebp
+    4bca:	c3                   	ret
+
+00004bcb <strlen>:
+{
+    4bcb:	55                   	push   %ebp
+    4bcc:	89 e5                	mov    %esp,%ebp
+    4bce:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+    4bd1:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+    4bd8:	eb 04                	jmp    4bde <strlen+0x13>
+    4bda:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+    4bde:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4be1:	8b 45 08             	mov    0x8(%ebp),%eax
+    4be4:	01 d0                	add    %edx,%eax
+    4be6:	0f b6 00             	movzbl (%eax),%eax
+    4be9:	84 c0                	test   %al,%al
+    4beb:	75 ed                	jne    4bda <strlen+0xf>
+  return n;
+    4bed:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4bf0:	c9                   	leave
+    4bf1:	c3                   	ret
+
+00004bf2 <memset>:
+{
+    4bf2:	55                   	push   %ebp
+    4bf3:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+    4bf5:	8b 45 10             	mov    0x10(%ebp),%eax
+    4bf8:	50                   	push   %eax
+    4bf9:	ff 75 0c             	push   0xc(%ebp)
+    4bfc:	ff 75 08             	push   0x8(%ebp)
+    4bff:	e8 e0 fe ff ff       	call   4ae4 <stosb>
+    4c04:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+    4c07:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4c0a:	c9                   	leave
+    4c0b:	c3                   	ret
+
+00004c0c <strchr>:
+{
+    4c0c:	55                   	push   %ebp
+    4c0d:	89 e5                	mov    %esp,%ebp
+    4c0f:	83 ec 04             	sub    $0x4,%esp
+    4c12:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4c15:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+    4c18:	eb 14                	jmp    4c2e <strchr+0x22>
+    if(*s == c)
+    4c1a:	8b 45 08             	mov    0x8(%ebp),%eax
+    4c1d:	0f b6 00             	movzbl (%eax),%eax
+    4c20:	38 45 fc             	cmp    %al,-0x4(%ebp)
+    4c23:	75 05                	jne    4c2a <strchr+0x1e>
+      return (char*)s;
+    4c25:	8b 45 08             	mov    0x8(%ebp),%eax
+    4c28:	eb 13                	jmp    4c3d <strchr+0x31>
+  for(; *s; s++)
+    4c2a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+    4c2e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4c31:	0f b6 00             	movzbl (%eax),%eax
+    4c34:	84 c0                	test   %al,%al
+    4c36:	75 e2                	jne    4c1a <strchr+0xe>
+  return 0;
+    4c38:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    4c3d:	c9                   	leave
+    4c3e:	c3                   	ret
+
+00004c3f <gets>:
+{
+    4c3f:	55                   	push   %ebp
+    4c40:	89 e5                	mov    %esp,%ebp
+    4c42:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+    4c45:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+    4c4c:	eb 42                	jmp    4c90 <gets+0x51>
+    cc = read(0, &c, 1);
+    4c4e:	83 ec 04             	sub    $0x4,%esp
+    4c51:	6a 01                	push   $0x1
+    4c53:	8d 45 ef             	lea    -0x11(%ebp),%eax
+    4c56:	50                   	push   %eax
+    4c57:	6a 00                	push   $0x0
+    4c59:	e8 ed 04 00 00       	call   514b <read>
+    4c5e:	83 c4 10             	add    $0x10,%esp
+    4c61:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+    4c64:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    4c68:	7e 33                	jle    4c9d <gets+0x5e>
+    buf[i++] = c;
+    4c6a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4c6d:	8d 50 01             	lea    0x1(%eax),%edx
+    4c70:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    4c73:	89 c2                	mov    %eax,%edx
+    4c75:	8b 45 08             	mov    0x8(%ebp),%eax
+    4c78:	01 c2                	add    %eax,%edx
+    4c7a:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4c7e:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+    4c80:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4c84:	3c 0a                	cmp    $0xa,%al
+    4c86:	74 16                	je     4c9e <gets+0x5f>
+    4c88:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+    4c8c:	3c 0d                	cmp    $0xd,%al
+    4c8e:	74 0e                	je     4c9e <gets+0x5f>
+  for(i=0; i+1 < max; ){
+    4c90:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4c93:	83 c0 01             	add    $0x1,%eax
+    4c96:	39 45 0c             	cmp    %eax,0xc(%ebp)
+    4c99:	7f b3                	jg     4c4e <gets+0xf>
+    4c9b:	eb 01                	jmp    4c9e <gets+0x5f>
+      break;
+    4c9d:	90                   	nop
+  buf[i] = '\0';
+    4c9e:	8b 55 f4             	mov    -0xc(%ebp),%edx
+    4ca1:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ca4:	01 d0                	add    %edx,%eax
+    4ca6:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+    4ca9:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4cac:	c9                   	leave
+    4cad:	c3                   	ret
+
+00004cae <stat>:
+{
+    4cae:	55                   	push   %ebp
+    4caf:	89 e5                	mov    %esp,%ebp
+    4cb1:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+    4cb4:	83 ec 08             	sub    $0x8,%esp
+    4cb7:	6a 00                	push   $0x0
+    4cb9:	ff 75 08             	push   0x8(%ebp)
+    4cbc:	e8 ad 04 00 00       	call   516e <open>
+    4cc1:	83 c4 10             	add    $0x10,%esp
+    4cc4:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+    4cc7:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4ccb:	79 07                	jns    4cd4 <stat+0x26>
+    return -1;
+    4ccd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    4cd2:	eb 25                	jmp    4cf9 <stat+0x4b>
+  r = fstat(fd, st);
+    4cd4:	83 ec 08             	sub    $0x8,%esp
+    4cd7:	ff 75 0c             	push   0xc(%ebp)
+    4cda:	ff 75 f4             	push   -0xc(%ebp)
+    4cdd:	e8 a1 04 00 00       	call   5183 <fstat>
+    4ce2:	83 c4 10             	add    $0x10,%esp
+    4ce5:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+    4ce8:	83 ec 0c             	sub    $0xc,%esp
+    4ceb:	ff 75 f4             	push   -0xc(%ebp)
+    4cee:	e8 66 04 00 00       	call   5159 <close>
+    4cf3:	83 c4 10             	add    $0x10,%esp
+  return r;
+    4cf6:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    4cf9:	c9                   	leave
+    4cfa:	c3                   	ret
+
+00004cfb <atoi>:
+{
+    4cfb:	55                   	push   %ebp
+    4cfc:	89 e5                	mov    %esp,%ebp
+    4cfe:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+    4d01:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4d08:	eb 25                	jmp    4d2f <atoi+0x34>
+    n = n*10 + *s++ - '0';
+    4d0a:	8b 55 fc             	mov    -0x4(%ebp),%edx
+    4d0d:	89 d0                	mov    %edx,%eax
+    4d0f:	c1 e0 02             	shl    $0x2,%eax
+    4d12:	01 d0                	add    %edx,%eax
+    4d14:	01 c0                	add    %eax,%eax
+    4d16:	89 c1                	mov    %eax,%ecx
+    4d18:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d1b:	8d 50 01             	lea    0x1(%eax),%edx
+    4d1e:	89 55 08             	mov    %edx,0x8(%ebp)
+    4d21:	0f b6 00             	movzbl (%eax),%eax
+    4d24:	0f be c0             	movsbl %al,%eax
+    4d27:	01 c8                	add    %ecx,%eax
+    4d29:	83 e8 30             	sub    $0x30,%eax
+    4d2c:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+    4d2f:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d32:	0f b6 00             	movzbl (%eax),%eax
+    4d35:	3c 2f                	cmp    $0x2f,%al
+    4d37:	7e 0a                	jle    4d43 <atoi+0x48>
+    4d39:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d3c:	0f b6 00             	movzbl (%eax),%eax
+    4d3f:	3c 39                	cmp    $0x39,%al
+    4d41:	7e c7                	jle    4d0a <atoi+0xf>
+  return n;
+    4d43:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+    4d46:	c9                   	leave
+    4d47:	c3                   	ret
+
+00004d48 <memmove>:
+{
+    4d48:	55                   	push   %ebp
+    4d49:	89 e5                	mov    %esp,%ebp
+    4d4b:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+    4d4e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d51:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+    4d54:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4d57:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+    4d5a:	eb 17                	jmp    4d73 <memmove+0x2b>
+    *dst++ = *src++;
+    4d5c:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    4d5f:	8d 42 01             	lea    0x1(%edx),%eax
+    4d62:	89 45 f8             	mov    %eax,-0x8(%ebp)
+    4d65:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4d68:	8d 48 01             	lea    0x1(%eax),%ecx
+    4d6b:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+    4d6e:	0f b6 12             	movzbl (%edx),%edx
+    4d71:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+    4d73:	8b 45 10             	mov    0x10(%ebp),%eax
+    4d76:	8d 50 ff             	lea    -0x1(%eax),%edx
+    4d79:	89 55 10             	mov    %edx,0x10(%ebp)
+    4d7c:	85 c0                	test   %eax,%eax
+    4d7e:	7f dc                	jg     4d5c <memmove+0x14>
+  return vdst;
+    4d80:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+    4d83:	c9                   	leave
+    4d84:	c3                   	ret
+
+00004d85 <mutex_init>:
+{
+    4d85:	55                   	push   %ebp
+    4d86:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+    4d88:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d8b:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    4d91:	90                   	nop
+    4d92:	5d                   	pop    %ebp
+    4d93:	c3                   	ret
+
+00004d94 <mutex_lock>:
+{
+    4d94:	55                   	push   %ebp
+    4d95:	89 e5                	mov    %esp,%ebp
+    4d97:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+    4d9a:	8b 45 08             	mov    0x8(%ebp),%eax
+    4d9d:	6a 01                	push   $0x1
+    4d9f:	6a 00                	push   $0x0
+    4da1:	50                   	push   %eax
+    4da2:	e8 7d fd ff ff       	call   4b24 <cmpxchg>
+    4da7:	83 c4 0c             	add    $0xc,%esp
+    4daa:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4dad:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4db1:	74 46                	je     4df9 <mutex_lock+0x65>
+  if(c != 2)
+    4db3:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+    4db7:	74 38                	je     4df1 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+    4db9:	8b 45 08             	mov    0x8(%ebp),%eax
+    4dbc:	6a 02                	push   $0x2
+    4dbe:	50                   	push   %eax
+    4dbf:	e8 46 fd ff ff       	call   4b0a <xchg>
+    4dc4:	83 c4 08             	add    $0x8,%esp
+    4dc7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    4dca:	eb 25                	jmp    4df1 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+    4dcc:	8b 45 08             	mov    0x8(%ebp),%eax
+    4dcf:	83 ec 08             	sub    $0x8,%esp
+    4dd2:	6a 02                	push   $0x2
+    4dd4:	50                   	push   %eax
+    4dd5:	e8 22 04 00 00       	call   51fc <futex_wait>
+    4dda:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+    4ddd:	8b 45 08             	mov    0x8(%ebp),%eax
+    4de0:	83 ec 08             	sub    $0x8,%esp
+    4de3:	6a 02                	push   $0x2
+    4de5:	50                   	push   %eax
+    4de6:	e8 1f fd ff ff       	call   4b0a <xchg>
+    4deb:	83 c4 10             	add    $0x10,%esp
+    4dee:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+    4df1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4df5:	75 d5                	jne    4dcc <mutex_lock+0x38>
+    4df7:	eb 01                	jmp    4dfa <mutex_lock+0x66>
+    return;
+    4df9:	90                   	nop
+}
+    4dfa:	c9                   	leave
+    4dfb:	c3                   	ret
+
+00004dfc <mutex_unlock>:
+{
+    4dfc:	55                   	push   %ebp
+    4dfd:	89 e5                	mov    %esp,%ebp
+    4dff:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+    4e02:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e05:	6a 00                	push   $0x0
+    4e07:	50                   	push   %eax
+    4e08:	e8 fd fc ff ff       	call   4b0a <xchg>
+    4e0d:	83 c4 08             	add    $0x8,%esp
+    4e10:	83 f8 02             	cmp    $0x2,%eax
+    4e13:	75 11                	jne    4e26 <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+    4e15:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e18:	83 ec 08             	sub    $0x8,%esp
+    4e1b:	6a 01                	push   $0x1
+    4e1d:	50                   	push   %eax
+    4e1e:	e8 e3 03 00 00       	call   5206 <futex_wake>
+    4e23:	83 c4 10             	add    $0x10,%esp
+}
+    4e26:	90                   	nop
+    4e27:	c9                   	leave
+    4e28:	c3                   	ret
+
+00004e29 <cond_init>:
+{
+    4e29:	55                   	push   %ebp
+    4e2a:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+    4e2c:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e2f:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+    4e35:	90                   	nop
+    4e36:	5d                   	pop    %ebp
+    4e37:	c3                   	ret
+
+00004e38 <cond_wait>:
+{
+    4e38:	55                   	push   %ebp
+    4e39:	89 e5                	mov    %esp,%ebp
+    4e3b:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+    4e3e:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e41:	8b 00                	mov    (%eax),%eax
+    4e43:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+    4e46:	83 ec 0c             	sub    $0xc,%esp
+    4e49:	ff 75 0c             	push   0xc(%ebp)
+    4e4c:	e8 ab ff ff ff       	call   4dfc <mutex_unlock>
+    4e51:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+    4e54:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e57:	83 ec 08             	sub    $0x8,%esp
+    4e5a:	ff 75 f4             	push   -0xc(%ebp)
+    4e5d:	50                   	push   %eax
+    4e5e:	e8 99 03 00 00       	call   51fc <futex_wait>
+    4e63:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+    4e66:	eb 11                	jmp    4e79 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+    4e68:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4e6b:	83 ec 08             	sub    $0x8,%esp
+    4e6e:	6a 02                	push   $0x2
+    4e70:	50                   	push   %eax
+    4e71:	e8 86 03 00 00       	call   51fc <futex_wait>
+    4e76:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+    4e79:	8b 45 0c             	mov    0xc(%ebp),%eax
+    4e7c:	83 ec 08             	sub    $0x8,%esp
+    4e7f:	6a 02                	push   $0x2
+    4e81:	50                   	push   %eax
+    4e82:	e8 83 fc ff ff       	call   4b0a <xchg>
+    4e87:	83 c4 10             	add    $0x10,%esp
+    4e8a:	85 c0                	test   %eax,%eax
+    4e8c:	75 da                	jne    4e68 <cond_wait+0x30>
+}
+    4e8e:	90                   	nop
+    4e8f:	90                   	nop
+    4e90:	c9                   	leave
+    4e91:	c3                   	ret
+
+00004e92 <condbump>:
+{
+    4e92:	55                   	push   %ebp
+    4e93:	89 e5                	mov    %esp,%ebp
+    4e95:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+    4e98:	8b 45 08             	mov    0x8(%ebp),%eax
+    4e9b:	8b 00                	mov    (%eax),%eax
+    4e9d:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+    4ea0:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    4ea3:	8d 50 01             	lea    0x1(%eax),%edx
+    4ea6:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ea9:	52                   	push   %edx
+    4eaa:	ff 75 fc             	push   -0x4(%ebp)
+    4ead:	50                   	push   %eax
+    4eae:	e8 71 fc ff ff       	call   4b24 <cmpxchg>
+    4eb3:	83 c4 0c             	add    $0xc,%esp
+    4eb6:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    4eb9:	75 dd                	jne    4e98 <condbump+0x6>
+}
+    4ebb:	90                   	nop
+    4ebc:	90                   	nop
+    4ebd:	c9                   	leave
+    4ebe:	c3                   	ret
+
+00004ebf <cond_signal>:
+{
+    4ebf:	55                   	push   %ebp
+    4ec0:	89 e5                	mov    %esp,%ebp
+    4ec2:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+    4ec5:	ff 75 08             	push   0x8(%ebp)
+    4ec8:	e8 c5 ff ff ff       	call   4e92 <condbump>
+    4ecd:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+    4ed0:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ed3:	83 ec 08             	sub    $0x8,%esp
+    4ed6:	6a 01                	push   $0x1
+    4ed8:	50                   	push   %eax
+    4ed9:	e8 28 03 00 00       	call   5206 <futex_wake>
+    4ede:	83 c4 10             	add    $0x10,%esp
+}
+    4ee1:	90                   	nop
+    4ee2:	c9                   	leave
+    4ee3:	c3                   	ret
+
+00004ee4 <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+    4ee4:	55                   	push   %ebp
+    4ee5:	89 e5                	mov    %esp,%ebp
+    4ee7:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+    4eea:	ff 75 08             	push   0x8(%ebp)
+    4eed:	e8 a0 ff ff ff       	call   4e92 <condbump>
+    4ef2:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+    4ef5:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ef8:	83 ec 08             	sub    $0x8,%esp
+    4efb:	68 ff ff ff 7f       	push   $0x7fffffff
+    4f00:	50                   	push   %eax
+    4f01:	e8 00 03 00 00       	call   5206 <futex_wake>
+    4f06:	83 c4 10             	add    $0x10,%esp
+}
+    4f09:	90                   	nop
+    4f0a:	c9                   	leave
+    4f0b:	c3                   	ret
+
+00004f0c <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+    4f0c:	55                   	push   %ebp
+    4f0d:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+    4f0f:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+    4f14:	8b 00                	mov    (%eax),%eax
+}
+    4f16:	5d                   	pop    %ebp
+    4f17:	c3                   	ret
+
+00004f18 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+    4f18:	55                   	push   %ebp
+    4f19:	89 e5                	mov    %esp,%ebp
+    4f1b:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+    4f1e:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+    4f23:	8b 00                	mov    (%eax),%eax
+    4f25:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    4f28:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    4f2c:	74 05                	je     4f33 <vgetpid+0x1b>
+    return pid;
+    4f2e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    4f31:	eb 05                	jmp    4f38 <vgetpid+0x20>
+  return getpid();
+    4f33:	e8 74 02 00 00       	call   51ac <getpid>
+}
+    4f38:	c9                   	leave
+    4f39:	c3                   	ret
+
+00004f3a <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+    4f3a:	55                   	push   %ebp
+    4f3b:	89 e5                	mov    %esp,%ebp
+    4f3d:	57                   	push   %edi
+    4f3e:	56                   	push   %esi
+    4f3f:	53                   	push   %ebx
+    4f40:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+    4f43:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+    4f4a:	e8 f7 fb ff ff       	call   4b46 <rdtsc>
+    4f4f:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+    4f52:	8b 59 0c             	mov    0xc(%ecx),%ebx
+    4f55:	8b 49 08             	mov    0x8(%ecx),%ecx
+    4f58:	29 c8                	sub    %ecx,%eax
+    4f5a:	19 da                	sbb    %ebx,%edx
+    4f5c:	89 45 e0             	mov    %eax,-0x20(%ebp)
+    4f5f:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+    4f62:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4f65:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    4f68:	89 d0                	mov    %edx,%eax
+    4f6a:	31 d2                	xor    %edx,%edx
+    4f6c:	89 c1                	mov    %eax,%ecx
+    4f6e:	bb 00 00 00 00       	mov    $0x0,%ebx
+    4f73:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4f76:	8b 40 04             	mov    0x4(%eax),%eax
+    4f79:	ba 00 00 00 00       	mov    $0x0,%edx
+    4f7e:	89 df                	mov    %ebx,%edi
+    4f80:	0f af f8             	imul   %eax,%edi
+    4f83:	89 d6                	mov    %edx,%esi
+    4f85:	0f af f1             	imul   %ecx,%esi
+    4f88:	01 f7                	add    %esi,%edi
+    4f8a:	f7 e1                	mul    %ecx
+    4f8c:	89 c1                	mov    %eax,%ecx
+    4f8e:	89 d3                	mov    %edx,%ebx
+    4f90:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+    4f93:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+    4f95:	8b 45 e0             	mov    -0x20(%ebp),%eax
+    4f98:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+    4f9b:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    4f9e:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+    4fa5:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    4fa8:	8b 40 04             	mov    0x4(%eax),%eax
+    4fab:	89 45 d0             	mov    %eax,-0x30(%ebp)
+    4fae:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+    4fb5:	8b 45 d8             	mov    -0x28(%ebp),%eax
+    4fb8:	8b 55 dc             	mov    -0x24(%ebp),%edx
+    4fbb:	89 d7                	mov    %edx,%edi
+    4fbd:	8b 75 d0             	mov    -0x30(%ebp),%esi
+    4fc0:	0f af fe             	imul   %esi,%edi
+    4fc3:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+    4fc6:	89 45 d8             	mov    %eax,-0x28(%ebp)
+    4fc9:	89 55 dc             	mov    %edx,-0x24(%ebp)
+    4fcc:	0f af f0             	imul   %eax,%esi
+    4fcf:	01 f7                	add    %esi,%edi
+    4fd1:	8b 45 d0             	mov    -0x30(%ebp),%eax
+    4fd4:	f7 65 d8             	mull   -0x28(%ebp)
+    4fd7:	8d 34 17             	lea    (%edi,%edx,1),%esi
+    4fda:	89 f2                	mov    %esi,%edx
+    4fdc:	89 d0                	mov    %edx,%eax
+    4fde:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+    4fe0:	01 c8                	add    %ecx,%eax
+    4fe2:	11 da                	adc    %ebx,%edx
+}
+    4fe4:	83 c4 24             	add    $0x24,%esp
+    4fe7:	5b                   	pop    %ebx
+    4fe8:	5e                   	pop    %esi
+    4fe9:	5f                   	pop    %edi
+    4fea:	5d                   	pop    %ebp
+    4feb:	c3                   	ret
+
+00004fec <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+    4fec:	55                   	push   %ebp
+    4fed:	89 e5                	mov    %esp,%ebp
+    4fef:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+    4ff2:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ff5:	8b 50 04             	mov    0x4(%eax),%edx
+    4ff8:	8b 45 08             	mov    0x8(%ebp),%eax
+    4ffb:	8b 00                	mov    (%eax),%eax
+    4ffd:	29 c2                	sub    %eax,%edx
+    4fff:	83 fa 1f             	cmp    $0x1f,%edx
+    5002:	76 07                	jbe    500b <ring_queue+0x1f>
+    return -1;
+    5004:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    5009:	eb 68                	jmp    5073 <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+    500b:	8b 45 08             	mov    0x8(%ebp),%eax
+    500e:	8b 40 04             	mov    0x4(%eax),%eax
+    5011:	83 e0 1f             	and    $0x1f,%eax
+    5014:	89 c2                	mov    %eax,%edx
+    5016:	89 d0                	mov    %edx,%eax
+    5018:	c1 e0 02             	shl    $0x2,%eax
+    501b:	01 d0                	add    %edx,%eax
+    501d:	c1 e0 02             	shl    $0x2,%eax
+    5020:	8d 50 10             	lea    0x10(%eax),%edx
+    5023:	8b 45 08             	mov    0x8(%ebp),%eax
+    5026:	01 d0                	add    %edx,%eax
+    5028:	83 c0 04             	add    $0x4,%eax
+    502b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+    502e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5031:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5034:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+    5036:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5039:	8b 55 10             	mov    0x10(%ebp),%edx
+    503c:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+    503f:	8b 55 14             	mov    0x14(%ebp),%edx
+    5042:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5045:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+    5048:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    504b:	8b 55 18             	mov    0x18(%ebp),%edx
+    504e:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+    5051:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5054:	8b 55 1c             	mov    0x1c(%ebp),%edx
+    5057:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+    505a:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+    505f:	8b 45 08             	mov    0x8(%ebp),%eax
+    5062:	8b 40 04             	mov    0x4(%eax),%eax
+    5065:	8d 50 01             	lea    0x1(%eax),%edx
+    5068:	8b 45 08             	mov    0x8(%ebp),%eax
+    506b:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+    506e:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    5073:	c9                   	leave
+    5074:	c3                   	ret
+
+00005075 <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+    5075:	55                   	push   %ebp
+    5076:	89 e5                	mov    %esp,%ebp
+    5078:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+    507b:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+    5080:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    5084:	7f 1a                	jg     50a0 <ring_submit+0x2b>
+    5086:	8b 45 08             	mov    0x8(%ebp),%eax
+    5089:	8b 40 10             	mov    0x10(%eax),%eax
+    508c:	83 e0 01             	and    $0x1,%eax
+    508f:	85 c0                	test   %eax,%eax
+    5091:	74 0d                	je     50a0 <ring_submit+0x2b>
+    5093:	8b 45 08             	mov    0x8(%ebp),%eax
+    5096:	8b 40 10             	mov    0x10(%eax),%eax
+    5099:	83 e0 02             	and    $0x2,%eax
+    509c:	85 c0                	test   %eax,%eax
+    509e:	74 10                	je     50b0 <ring_submit+0x3b>
+    return ring_enter(min);
+    50a0:	83 ec 0c             	sub    $0xc,%esp
+    50a3:	ff 75 0c             	push   0xc(%ebp)
+    50a6:	e8 83 01 00 00       	call   522e <ring_enter>
+    50ab:	83 c4 10             	add    $0x10,%esp
+    50ae:	eb 10                	jmp    50c0 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+    50b0:	8b 45 08             	mov    0x8(%ebp),%eax
+    50b3:	8b 50 0c             	mov    0xc(%eax),%edx
+    50b6:	8b 45 08             	mov    0x8(%ebp),%eax
+    50b9:	8b 40 08             	mov    0x8(%eax),%eax
+    50bc:	29 c2                	sub    %eax,%edx
+    50be:	89 d0                	mov    %edx,%eax
+}
+    50c0:	c9                   	leave
+    50c1:	c3                   	ret
+
+000050c2 <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+    50c2:	55                   	push   %ebp
+    50c3:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+    50c5:	8b 45 08             	mov    0x8(%ebp),%eax
+    50c8:	8b 50 08             	mov    0x8(%eax),%edx
+    50cb:	8b 45 08             	mov    0x8(%ebp),%eax
+    50ce:	8b 40 0c             	mov    0xc(%eax),%eax
+    50d1:	39 c2                	cmp    %eax,%edx
+    50d3:	75 07                	jne    50dc <ring_reap+0x1a>
+    return -1;
+    50d5:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    50da:	eb 3b                	jmp    5117 <ring_reap+0x55>
+  __sync_synchronize();
+    50dc:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+    50e1:	8b 45 08             	mov    0x8(%ebp),%eax
+    50e4:	8b 40 08             	mov    0x8(%eax),%eax
+    50e7:	83 e0 1f             	and    $0x1f,%eax
+    50ea:	89 c2                	mov    %eax,%edx
+    50ec:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+    50ef:	8b 45 08             	mov    0x8(%ebp),%eax
+    50f2:	83 c2 52             	add    $0x52,%edx
+    50f5:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+    50f9:	8b 02                	mov    (%edx),%eax
+    50fb:	8b 52 04             	mov    0x4(%edx),%edx
+    50fe:	89 01                	mov    %eax,(%ecx)
+    5100:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+    5103:	8b 45 08             	mov    0x8(%ebp),%eax
+    5106:	8b 40 08             	mov    0x8(%eax),%eax
+    5109:	8d 50 01             	lea    0x1(%eax),%edx
+    510c:	8b 45 08             	mov    0x8(%ebp),%eax
+    510f:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+    5112:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+    5117:	5d                   	pop    %ebp
+    5118:	c3                   	ret
+
+00005119 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+    5119:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+    5120:	74 0a                	je     512c <usyscall+0x13>
+  movl %esp, %ecx
+    5122:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+    5124:	ba 2b 51 00 00       	mov    $0x512b,%edx
+  sysenter
+    5129:	0f 34                	sysenter
+2:
+  ret
+    512b:	c3                   	ret
+1:
+  int $T_SYSCALL
+    512c:	cd 40                	int    $0x40
+  ret
+    512e:	c3                   	ret
+
+0000512f <fork>:
+
+SYSCALL(fork)
+    512f:	b8 01 00 00 00       	mov    $0x1,%eax
+    5134:	eb e3                	jmp    5119 <usyscall>
+
+00005136 <exit>:
+SYSCALL(exit)
+    5136:	b8 02 00 00 00       	mov    $0x2,%eax
+    513b:	eb dc                	jmp    5119 <usyscall>
+
+0000513d <wait>:
+SYSCALL(wait)
+    513d:	b8 03 00 00 00       	mov    $0x3,%eax
+    5142:	eb d5                	jmp    5119 <usyscall>
+
+00005144 <pipe>:
+SYSCALL(pipe)
+    5144:	b8 04 00 00 00       	mov    $0x4,%eax
+    5149:	eb ce                	jmp    5119 <usyscall>
+
+0000514b <read>:
+SYSCALL(read)
+    514b:	b8 05 00 00 00       	mov    $0x5,%eax
+    5150:	eb c7                	jmp    5119 <usyscall>
+
+00005152 <write>:
+SYSCALL(write)
+    5152:	b8 10 00 00 00       	mov    $0x10,%eax
+    5157:	eb c0                	jmp    5119 <usyscall>
+
+00005159 <close>:
+SYSCALL(close)
+    5159:	b8 15 00 00 00       	mov    $0x15,%eax
+    515e:	eb b9                	jmp    5119 <usyscall>
+
+00005160 <kill>:
+SYSCALL(kill)
+    5160:	b8 06 00 00 00       	mov    $0x6,%eax
+    5165:	eb b2                	jmp    5119 <usyscall>
+
+00005167 <exec>:
+SYSCALL(exec)
+    5167:	b8 07 00 00 00       	mov    $0x7,%eax
+    516c:	eb ab                	jmp    5119 <usyscall>
+
+0000516e <open>:
+SYSCALL(open)
+    516e:	b8 0f 00 00 00       	mov    $0xf,%eax
+    5173:	eb a4                	jmp    5119 <usyscall>
+
+00005175 <mknod>:
+SYSCALL(mknod)
+    5175:	b8 11 00 00 00       	mov    $0x11,%eax
+    517a:	eb 9d                	jmp    5119 <usyscall>
+
+0000517c <unlink>:
+SYSCALL(unlink)
+    517c:	b8 12 00 00 00       	mov    $0x12,%eax
+    5181:	eb 96                	jmp    5119 <usyscall>
+
+00005183 <fstat>:
+SYSCALL(fstat)
+    5183:	b8 08 00 00 00       	mov    $0x8,%eax
+    5188:	eb 8f                	jmp    5119 <usyscall>
+
+0000518a <link>:
+SYSCALL(link)
+    518a:	b8 13 00 00 00       	mov    $0x13,%eax
+    518f:	eb 88                	jmp    5119 <usyscall>
+
+00005191 <mkdir>:
+SYSCALL(mkdir)
+    5191:	b8 14 00 00 00       	mov    $0x14,%eax
+    5196:	eb 81                	jmp    5119 <usyscall>
+
+00005198 <chdir>:
+SYSCALL(chdir)
+    5198:	b8 09 00 00 00       	mov    $0x9,%eax
+    519d:	e9 77 ff ff ff       	jmp    5119 <usyscall>
+
+000051a2 <dup>:
+SYSCALL(dup)
+    51a2:	b8 0a 00 00 00       	mov    $0xa,%eax
+    51a7:	e9 6d ff ff ff       	jmp    5119 <usyscall>
+
+000051ac <getpid>:
+SYSCALL(getpid)
+    51ac:	b8 0b 00 00 00       	mov    $0xb,%eax
+    51b1:	e9 63 ff ff ff       	jmp    5119 <usyscall>
+
+000051b6 <sbrk>:
+SYSCALL(sbrk)
+    51b6:	b8 0c 00 00 00       	mov    $0xc,%eax
+    51bb:	e9 59 ff ff ff       	jmp    5119 <usyscall>
+
+000051c0 <sleep>:
+SYSCALL(sleep)
+    51c0:	b8 0d 00 00 00       	mov    $0xd,%eax
+    51c5:	e9 4f ff ff ff       	jmp    5119 <usyscall>
+
+000051ca <uptime>:
+SYSCALL(uptime)
+    51ca:	b8 0e 00 00 00       	mov    $0xe,%eax
+    51cf:	e9 45 ff ff ff       	jmp    5119 <usyscall>
+
+000051d4 <kmstat>:
+SYSCALL(kmstat)
+    51d4:	b8 16 00 00 00       	mov    $0x16,%eax
+    51d9:	e9 3b ff ff ff       	jmp    5119 <usyscall>
+
+000051de <setpriority>:
+SYSCALL(setpriority)
+    51de:	b8 17 00 00 00       	mov    $0x17,%eax
+    51e3:	e9 31 ff ff ff       	jmp    5119 <usyscall>
+
+000051e8 <clone>:
+SYSCALL(clone)
+    51e8:	b8 18 00 00 00       	mov    $0x18,%eax
+    51ed:	e9 27 ff ff ff       	jmp    5119 <usyscall>
+
+000051f2 <join>:
+SYSCALL(join)
+    51f2:	b8 19 00 00 00       	mov    $0x19,%eax
+    51f7:	e9 1d ff ff ff       	jmp    5119 <usyscall>
+
+000051fc <futex_wait>:
+SYSCALL(futex_wait)
+    51fc:	b8 1a 00 00 00       	mov    $0x1a,%eax
+    5201:	e9 13 ff ff ff       	jmp    5119 <usyscall>
+
+00005206 <futex_wake>:
+SYSCALL(futex_wake)
+    5206:	b8 1b 00 00 00       	mov    $0x1b,%eax
+    520b:	e9 09 ff ff ff       	jmp    5119 <usyscall>
+
+00005210 <lockstat>:
+SYSCALL(lockstat)
+    5210:	b8 1c 00 00 00       	mov    $0x1c,%eax
+    5215:	e9 ff fe ff ff       	jmp    5119 <usyscall>
+
+0000521a <sysstat>:
+SYSCALL(sysstat)
+    521a:	b8 1d 00 00 00       	mov    $0x1d,%eax
+    521f:	e9 f5 fe ff ff       	jmp    5119 <usyscall>
+
+00005224 <ring_setup>:
+SYSCALL(ring_setup)
+    5224:	b8 1e 00 00 00       	mov    $0x1e,%eax
+    5229:	e9 eb fe ff ff       	jmp    5119 <usyscall>
+
+0000522e <ring_enter>:
+SYSCALL(ring_enter)
+    522e:	b8 1f 00 00 00       	mov    $0x1f,%eax
+    5233:	e9 e1 fe ff ff       	jmp    5119 <usyscall>
+
+00005238 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+    5238:	55                   	push   %ebp
+    5239:	89 e5                	mov    %esp,%ebp
+    523b:	83 ec 18             	sub    $0x18,%esp
+    523e:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5241:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+    5244:	83 ec 04             	sub    $0x4,%esp
+    5247:	6a 01                	push   $0x1
+    5249:	8d 45 f4             	lea    -0xc(%ebp),%eax
+    524c:	50                   	push   %eax
+    524d:	ff 75 08             	push   0x8(%ebp)
+    5250:	e8 fd fe ff ff       	call   5152 <write>
+    5255:	83 c4 10             	add    $0x10,%esp
+}
+    5258:	90                   	nop
+    5259:	c9                   	leave
+    525a:	c3                   	ret
+
+0000525b <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+    525b:	55                   	push   %ebp
+    525c:	89 e5                	mov    %esp,%ebp
+    525e:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+    5261:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+    5268:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+    526c:	74 17                	je     5285 <printint+0x2a>
+    526e:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+    5272:	79 11                	jns    5285 <printint+0x2a>
+    neg = 1;
+    5274:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+    527b:	8b 45 0c             	mov    0xc(%ebp),%eax
+    527e:	f7 d8                	neg    %eax
+    5280:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    5283:	eb 06                	jmp    528b <printint+0x30>
+  } else {
+    x = xx;
+    5285:	8b 45 0c             	mov    0xc(%ebp),%eax
+    5288:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+    528b:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+    5292:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    5295:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    5298:	ba 00 00 00 00       	mov    $0x0,%edx
+    529d:	f7 f1                	div    %ecx
+    529f:	89 d1                	mov    %edx,%ecx
+    52a1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    52a4:	8d 50 01             	lea    0x1(%eax),%edx
+    52a7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    52aa:	0f b6 91 f4 7d 00 00 	movzbl 0x7df4(%ecx),%edx
+    52b1:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+    52b5:	8b 4d 10             	mov    0x10(%ebp),%ecx
+    52b8:	8b 45 ec             	mov    -0x14(%ebp),%eax
+    52bb:	ba 00 00 00 00       	mov    $0x0,%edx
+    52c0:	f7 f1                	div    %ecx
+    52c2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+    52c5:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    52c9:	75 c7                	jne    5292 <printint+0x37>
+  if(neg)
+    52cb:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    52cf:	74 2d                	je     52fe <printint+0xa3>
+    buf[i++] = '-';
+    52d1:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    52d4:	8d 50 01             	lea    0x1(%eax),%edx
+    52d7:	89 55 f4             	mov    %edx,-0xc(%ebp)
+    52da:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+    52df:	eb 1d                	jmp    52fe <printint+0xa3>
+    putc(fd, buf[i]);
+    52e1:	8d 55 dc             	lea    -0x24(%ebp),%edx
+    52e4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    52e7:	01 d0                	add    %edx,%eax
+    52e9:	0f b6 00             	movzbl (%eax),%eax
+    52ec:	0f be c0             	movsbl %al,%eax
+    52ef:	83 ec 08             	sub    $0x8,%esp
+    52f2:	50                   	push   %eax
+    52f3:	ff 75 08             	push   0x8(%ebp)
+    52f6:	e8 3d ff ff ff       	call   5238 <putc>
+    52fb:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+    52fe:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+    5302:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5306:	79 d9                	jns    52e1 <printint+0x86>
+}
+    5308:	90                   	nop
+    5309:	90                   	nop
+    530a:	c9                   	leave
+    530b:	c3                   	ret
+
+0000530c <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+    530c:	55                   	push   %ebp
+    530d:	89 e5                	mov    %esp,%ebp
+    530f:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+    5312:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+    5319:	8d 45 0c             	lea    0xc(%ebp),%eax
+    531c:	83 c0 04             	add    $0x4,%eax
+    531f:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+    5322:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+    5329:	e9 59 01 00 00       	jmp    5487 <printf+0x17b>
+    c = fmt[i] & 0xff;
+    532e:	8b 55 0c             	mov    0xc(%ebp),%edx
+    5331:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5334:	01 d0                	add    %edx,%eax
+    5336:	0f b6 00             	movzbl (%eax),%eax
+    5339:	0f be c0             	movsbl %al,%eax
+    533c:	25 ff 00 00 00       	and    $0xff,%eax
+    5341:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+    5344:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+    5348:	75 2c                	jne    5376 <printf+0x6a>
+      if(c == '%'){
+    534a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    534e:	75 0c                	jne    535c <printf+0x50>
+        state = '%';
+    5350:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+    5357:	e9 27 01 00 00       	jmp    5483 <printf+0x177>
+      } else {
+        putc(fd, c);
+    535c:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    535f:	0f be c0             	movsbl %al,%eax
+    5362:	83 ec 08             	sub    $0x8,%esp
+    5365:	50                   	push   %eax
+    5366:	ff 75 08             	push   0x8(%ebp)
+    5369:	e8 ca fe ff ff       	call   5238 <putc>
+    536e:	83 c4 10             	add    $0x10,%esp
+    5371:	e9 0d 01 00 00       	jmp    5483 <printf+0x177>
+      }
+    } else if(state == '%'){
+    5376:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+    537a:	0f 85 03 01 00 00    	jne    5483 <printf+0x177>
+      if(c == 'd'){
+    5380:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+    5384:	75 1e                	jne    53a4 <printf+0x98>
+        printint(fd, *ap, 10, 1);
+    5386:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    5389:	8b 00                	mov    (%eax),%eax
+    538b:	6a 01                	push   $0x1
+    538d:	6a 0a                	push   $0xa
+    538f:	50                   	push   %eax
+    5390:	ff 75 08             	push   0x8(%ebp)
+    5393:	e8 c3 fe ff ff       	call   525b <printint>
+    5398:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    539b:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    539f:	e9 d8 00 00 00       	jmp    547c <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+    53a4:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+    53a8:	74 06                	je     53b0 <printf+0xa4>
+    53aa:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+    53ae:	75 1e                	jne    53ce <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+    53b0:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    53b3:	8b 00                	mov    (%eax),%eax
+    53b5:	6a 00                	push   $0x0
+    53b7:	6a 10                	push   $0x10
+    53b9:	50                   	push   %eax
+    53ba:	ff 75 08             	push   0x8(%ebp)
+    53bd:	e8 99 fe ff ff       	call   525b <printint>
+    53c2:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    53c5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    53c9:	e9 ae 00 00 00       	jmp    547c <printf+0x170>
+      } else if(c == 's'){
+    53ce:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+    53d2:	75 43                	jne    5417 <printf+0x10b>
+        s = (char*)*ap;
+    53d4:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    53d7:	8b 00                	mov    (%eax),%eax
+    53d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+    53dc:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+    53e0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    53e4:	75 25                	jne    540b <printf+0xff>
+          s = "(null)";
+    53e6:	c7 45 f4 3e 73 00 00 	movl   $0x733e,-0xc(%ebp)
+        while(*s != 0){
+    53ed:	eb 1c                	jmp    540b <printf+0xff>
+          putc(fd, *s);
+    53ef:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    53f2:	0f b6 00             	movzbl (%eax),%eax
+    53f5:	0f be c0             	movsbl %al,%eax
+    53f8:	83 ec 08             	sub    $0x8,%esp
+    53fb:	50                   	push   %eax
+    53fc:	ff 75 08             	push   0x8(%ebp)
+    53ff:	e8 34 fe ff ff       	call   5238 <putc>
+    5404:	83 c4 10             	add    $0x10,%esp
+          s++;
+    5407:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+    540b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    540e:	0f b6 00             	movzbl (%eax),%eax
+    5411:	84 c0                	test   %al,%al
+    5413:	75 da                	jne    53ef <printf+0xe3>
+    5415:	eb 65                	jmp    547c <printf+0x170>
+        }
+      } else if(c == 'c'){
+    5417:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+    541b:	75 1d                	jne    543a <printf+0x12e>
+        putc(fd, *ap);
+    541d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+    5420:	8b 00                	mov    (%eax),%eax
+    5422:	0f be c0             	movsbl %al,%eax
+    5425:	83 ec 08             	sub    $0x8,%esp
+    5428:	50                   	push   %eax
+    5429:	ff 75 08             	push   0x8(%ebp)
+    542c:	e8 07 fe ff ff       	call   5238 <putc>
+    5431:	83 c4 10             	add    $0x10,%esp
+        ap++;
+    5434:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+    5438:	eb 42                	jmp    547c <printf+0x170>
+      } else if(c == '%'){
+    543a:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+    543e:	75 17                	jne    5457 <printf+0x14b>
+        putc(fd, c);
+    5440:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    5443:	0f be c0             	movsbl %al,%eax
+    5446:	83 ec 08             	sub    $0x8,%esp
+    5449:	50                   	push   %eax
+    544a:	ff 75 08             	push   0x8(%ebp)
+    544d:	e8 e6 fd ff ff       	call   5238 <putc>
+    5452:	83 c4 10             	add    $0x10,%esp
+    5455:	eb 25                	jmp    547c <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+    5457:	83 ec 08             	sub    $0x8,%esp
+    545a:	6a 25                	push   $0x25
+    545c:	ff 75 08             	push   0x8(%ebp)
+    545f:	e8 d4 fd ff ff       	call   5238 <putc>
+    5464:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+    5467:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+    546a:	0f be c0             	movsbl %al,%eax
+    546d:	83 ec 08             	sub    $0x8,%esp
+    5470:	50                   	push   %eax
+    5471:	ff 75 08             	push   0x8(%ebp)
+    5474:	e8 bf fd ff ff       	call   5238 <putc>
+    5479:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+    547c:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+    5483:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+    5487:	8b 55 0c             	mov    0xc(%ebp),%edx
+    548a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    548d:	01 d0                	add    %edx,%eax
+    548f:	0f b6 00             	movzbl (%eax),%eax
+    5492:	84 c0                	test   %al,%al
+    5494:	0f 85 94 fe ff ff    	jne    532e <printf+0x22>
+    }
+  }
+}
+    549a:	90                   	nop
+    549b:	90                   	nop
+    549c:	c9                   	leave
+    549d:	c3                   	ret
+
+0000549e <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+    549e:	55                   	push   %ebp
+    549f:	89 e5                	mov    %esp,%ebp
+    54a1:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+    54a4:	8b 45 08             	mov    0x8(%ebp),%eax
+    54a7:	83 e8 08             	sub    $0x8,%eax
+    54aa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    54ad:	a1 48 cd 00 00       	mov    0xcd48,%eax
+    54b2:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    54b5:	eb 24                	jmp    54db <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+    54b7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    54ba:	8b 00                	mov    (%eax),%eax
+    54bc:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    54bf:	72 12                	jb     54d3 <free+0x35>
+    54c1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    54c4:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    54c7:	72 24                	jb     54ed <free+0x4f>
+    54c9:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    54cc:	8b 00                	mov    (%eax),%eax
+    54ce:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    54d1:	72 1a                	jb     54ed <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+    54d3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    54d6:	8b 00                	mov    (%eax),%eax
+    54d8:	89 45 fc             	mov    %eax,-0x4(%ebp)
+    54db:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    54de:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+    54e1:	73 d4                	jae    54b7 <free+0x19>
+    54e3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    54e6:	8b 00                	mov    (%eax),%eax
+    54e8:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    54eb:	73 ca                	jae    54b7 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+    54ed:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    54f0:	8b 40 04             	mov    0x4(%eax),%eax
+    54f3:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    54fa:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    54fd:	01 c2                	add    %eax,%edx
+    54ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5502:	8b 00                	mov    (%eax),%eax
+    5504:	39 c2                	cmp    %eax,%edx
+    5506:	75 24                	jne    552c <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+    5508:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    550b:	8b 50 04             	mov    0x4(%eax),%edx
+    550e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5511:	8b 00                	mov    (%eax),%eax
+    5513:	8b 40 04             	mov    0x4(%eax),%eax
+    5516:	01 c2                	add    %eax,%edx
+    5518:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    551b:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+    551e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5521:	8b 00                	mov    (%eax),%eax
+    5523:	8b 10                	mov    (%eax),%edx
+    5525:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5528:	89 10                	mov    %edx,(%eax)
+    552a:	eb 0a                	jmp    5536 <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+    552c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    552f:	8b 10                	mov    (%eax),%edx
+    5531:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5534:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+    5536:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5539:	8b 40 04             	mov    0x4(%eax),%eax
+    553c:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+    5543:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5546:	01 d0                	add    %edx,%eax
+    5548:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+    554b:	75 20                	jne    556d <free+0xcf>
+    p->s.size += bp->s.size;
+    554d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5550:	8b 50 04             	mov    0x4(%eax),%edx
+    5553:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5556:	8b 40 04             	mov    0x4(%eax),%eax
+    5559:	01 c2                	add    %eax,%edx
+    555b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    555e:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+    5561:	8b 45 f8             	mov    -0x8(%ebp),%eax
+    5564:	8b 10                	mov    (%eax),%edx
+    5566:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5569:	89 10                	mov    %edx,(%eax)
+    556b:	eb 08                	jmp    5575 <free+0xd7>
+  } else
+    p->s.ptr = bp;
+    556d:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5570:	8b 55 f8             	mov    -0x8(%ebp),%edx
+    5573:	89 10                	mov    %edx,(%eax)
+  freep = p;
+    5575:	8b 45 fc             	mov    -0x4(%ebp),%eax
+    5578:	a3 48 cd 00 00       	mov    %eax,0xcd48
+}
+    557d:	90                   	nop
+    557e:	c9                   	leave
+    557f:	c3                   	ret
+
+00005580 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+    5580:	55                   	push   %ebp
+    5581:	89 e5                	mov    %esp,%ebp
+    5583:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+    5586:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+    558d:	77 07                	ja     5596 <morecore+0x16>
+    nu = 4096;
+    558f:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+    5596:	8b 45 08             	mov    0x8(%ebp),%eax
+    5599:	c1 e0 03             	shl    $0x3,%eax
+    559c:	83 ec 0c             	sub    $0xc,%esp
+    559f:	50                   	push   %eax
+    55a0:	e8 11 fc ff ff       	call   51b6 <sbrk>
+    55a5:	83 c4 10             	add    $0x10,%esp
+    55a8:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+    55ab:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+    55af:	75 07                	jne    55b8 <morecore+0x38>
+    return 0;
+    55b1:	b8 00 00 00 00       	mov    $0x0,%eax
+    55b6:	eb 26                	jmp    55de <morecore+0x5e>
+  hp = (Header*)p;
+    55b8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    55bb:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+    55be:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    55c1:	8b 55 08             	mov    0x8(%ebp),%edx
+    55c4:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+    55c7:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    55ca:	83 c0 08             	add    $0x8,%eax
+    55cd:	83 ec 0c             	sub    $0xc,%esp
+    55d0:	50                   	push   %eax
+    55d1:	e8 c8 fe ff ff       	call   549e <free>
+    55d6:	83 c4 10             	add    $0x10,%esp
+  return freep;
+    55d9:	a1 48 cd 00 00       	mov    0xcd48,%eax
+}
+    55de:	c9                   	leave
+    55df:	c3                   	ret
+
+000055e0 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+    55e0:	55                   	push   %ebp
+    55e1:	89 e5                	mov    %esp,%ebp
+    55e3:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+    55e6:	8b 45 08             	mov    0x8(%ebp),%eax
+    55e9:	83 c0 07             	add    $0x7,%eax
+    55ec:	c1 e8 03             	shr    $0x3,%eax
+    55ef:	83 c0 01             	add    $0x1,%eax
+    55f2:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+    55f5:	a1 48 cd 00 00       	mov    0xcd48,%eax
+    55fa:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    55fd:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5601:	75 23                	jne    5626 <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+    5603:	c7 45 f0 40 cd 00 00 	movl   $0xcd40,-0x10(%ebp)
+    560a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    560d:	a3 48 cd 00 00       	mov    %eax,0xcd48
+    5612:	a1 48 cd 00 00       	mov    0xcd48,%eax
+    5617:	a3 40 cd 00 00       	mov    %eax,0xcd40
+    base.s.size = 0;
+    561c:	c7 05 44 cd 00 00 00 	movl   $0x0,0xcd44
+    5623:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    5626:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5629:	8b 00                	mov    (%eax),%eax
+    562b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    562e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5631:	8b 40 04             	mov    0x4(%eax),%eax
+    5634:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+    5637:	72 4d                	jb     5686 <malloc+0xa6>
+      if(p->s.size == nunits)
+    5639:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    563c:	8b 40 04             	mov    0x4(%eax),%eax
+    563f:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+    5642:	75 0c                	jne    5650 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+    5644:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5647:	8b 10                	mov    (%eax),%edx
+    5649:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    564c:	89 10                	mov    %edx,(%eax)
+    564e:	eb 26                	jmp    5676 <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+    5650:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5653:	8b 40 04             	mov    0x4(%eax),%eax
+    5656:	2b 45 ec             	sub    -0x14(%ebp),%eax
+    5659:	89 c2                	mov    %eax,%edx
+    565b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    565e:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+    5661:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5664:	8b 40 04             	mov    0x4(%eax),%eax
+    5667:	c1 e0 03             	shl    $0x3,%eax
+    566a:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+    566d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5670:	8b 55 ec             	mov    -0x14(%ebp),%edx
+    5673:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+    5676:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    5679:	a3 48 cd 00 00       	mov    %eax,0xcd48
+      return (void*)(p + 1);
+    567e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    5681:	83 c0 08             	add    $0x8,%eax
+    5684:	eb 3b                	jmp    56c1 <malloc+0xe1>
+    }
+    if(p == freep)
+    5686:	a1 48 cd 00 00       	mov    0xcd48,%eax
+    568b:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+    568e:	75 1e                	jne    56ae <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+    5690:	83 ec 0c             	sub    $0xc,%esp
+    5693:	ff 75 ec             	push   -0x14(%ebp)
+    5696:	e8 e5 fe ff ff       	call   5580 <morecore>
+    569b:	83 c4 10             	add    $0x10,%esp
+    569e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    56a1:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    56a5:	75 07                	jne    56ae <malloc+0xce>
+        return 0;
+    56a7:	b8 00 00 00 00       	mov    $0x0,%eax
+    56ac:	eb 13                	jmp    56c1 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+    56ae:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    56b1:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    56b4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+    56b7:	8b 00                	mov    (%eax),%eax
+    56b9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+    56bc:	e9 6d ff ff ff       	jmp    562e <malloc+0x4e>
+  }
+}
+    56c1:	c9                   	leave
+    56c2:	c3                   	ret
+
+000056c3 <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+    56c3:	55                   	push   %ebp
+    56c4:	89 e5                	mov    %esp,%ebp
+    56c6:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+    56c9:	83 ec 0c             	sub    $0xc,%esp
+    56cc:	68 00 10 00 00       	push   $0x1000
+    56d1:	e8 0a ff ff ff       	call   55e0 <malloc>
+    56d6:	83 c4 10             	add    $0x10,%esp
+    56d9:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    56dc:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    56e0:	75 07                	jne    56e9 <thread_create+0x26>
+    return -1;
+    56e2:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+    56e7:	eb 2e                	jmp    5717 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+    56e9:	83 ec 04             	sub    $0x4,%esp
+    56ec:	ff 75 f4             	push   -0xc(%ebp)
+    56ef:	ff 75 0c             	push   0xc(%ebp)
+    56f2:	ff 75 08             	push   0x8(%ebp)
+    56f5:	e8 ee fa ff ff       	call   51e8 <clone>
+    56fa:	83 c4 10             	add    $0x10,%esp
+    56fd:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    5700:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+    5704:	79 0e                	jns    5714 <thread_create+0x51>
+    free(stack);
+    5706:	83 ec 0c             	sub    $0xc,%esp
+    5709:	ff 75 f4             	push   -0xc(%ebp)
+    570c:	e8 8d fd ff ff       	call   549e <free>
+    5711:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    5714:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+    5717:	c9                   	leave
+    5718:	c3                   	ret
+
+00005719 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+    5719:	55                   	push   %ebp
+    571a:	89 e5                	mov    %esp,%ebp
+    571c:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+    571f:	83 ec 0c             	sub    $0xc,%esp
+    5722:	8d 45 f0             	lea    -0x10(%ebp),%eax
+    5725:	50                   	push   %eax
+    5726:	e8 c7 fa ff ff       	call   51f2 <join>
+    572b:	83 c4 10             	add    $0x10,%esp
+    572e:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    5731:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+    5735:	78 0f                	js     5746 <thread_join+0x2d>
+    free(stack);
+    5737:	8b 45 f0             	mov    -0x10(%ebp),%eax
+    573a:	83 ec 0c             	sub    $0xc,%esp
+    573d:	50                   	push   %eax
+    573e:	e8 5b fd ff ff       	call   549e <free>
+    5743:	83 c4 10             	add    $0x10,%esp
+  return pid;
+    5746:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+    5749:	c9                   	leave
+    574a:	c3                   	ret
@@ -7,6 +7,7 @@
 #include "syscall.h"
 #include "traps.h"
 #include "memlayout.h"
+#include "ring.h"
 
 char buf[8192];
 char name[3];
@@ -254,6 +255,433 @@ pipe1(void)
   printf(1, "pipe1 ok\n");
 }
 
+// open more files across the system than the old fixed
+// file table (100 entries) could hold.
+void
+manypipes(void)
+{
+  int r[2], fds[2], pids[10], i, n, total;
+  char c;
+
+  printf(1, "manypipes test\n");
+  if(pipe(r) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  for(i = 0; i < 10; i++){
+    pids[i] = fork();
+    if(pids[i] < 0){
+      printf(1, "fork failed\n");
+      exit();
+    }
+    if(pids[i] == 0){
+      close(r[0]);
+      for(n = 0; pipe(fds) == 0; n++)
+        ;
+      c = n;
+      write(r[1], &c, 1);
+      read(fds[0], &c, 1);  // blocks until killed
+      exit();
+    }
+  }
+  close(r[1]);
+  total = 0;
+  for(i = 0; i < 10; i++){
+    if(read(r[0], &c, 1) != 1){
+      printf(1, "manypipes read failed\n");
+      exit();
+    }
+    total += 2*c;
+  }
+  close(r[0]);
+  for(i = 0; i < 10; i++){
+    kill(pids[i]);
+    wait();
+  }
+  if(total <= 100){
+    printf(1, "manypipes: only %d files\n", total);
+    exit();
+  }
+  printf(1, "manypipes ok\n");
+}
+
+// setpriority() accepts levels 0..NPRIO-1 of live processes only.
+void
+prioritytest(void)
+{
+  int pid;
+
+  printf(1, "priority test\n");
+  if(setpriority(getpid(), -1) != -1 || setpriority(getpid(), 100) != -1){
+    printf(1, "setpriority accepted a bad level\n");
+    exit();
+  }
+  pid = fork();
+  if(pid == 0){
+    for(;;)
+      ;
+  }
+  if(setpriority(pid, 3) != 0 || setpriority(pid, 0) != 0){
+    printf(1, "setpriority failed\n");
+    exit();
+  }
+  kill(pid);
+  wait();
+  if(setpriority(pid, 0) != -1){
+    printf(1, "setpriority of dead process succeeded\n");
+    exit();
+  }
+  printf(1, "priority ok\n");
+}
+
+int threadslot[4];
+int threadfd;
+
+void
+threadfn(void *arg)
+{
+  int i;
+
+  i = (int)arg;
+  threadslot[i] = i + 100;
+  write(threadfd, "x", 1);
+  exit();
+}
+
+void
+threadspin(void *arg)
+{
+  for(;;)
+    ;
+}
+
+// threads share memory and open files, are reaped by
+// join() rather than wait(), and die with their leader.
+void
+threadtest(void)
+{
+  int fds[2], i, pid;
+  char c;
+
+  printf(1, "thread test\n");
+  if(pipe(fds) != 0){
+    printf(1, "pipe() failed\n");
+    exit();
+  }
+  threadfd = fds[1];
+  for(i = 0; i < 4; i++){
+    if(thread_create(threadfn, (void*)i) < 0){
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  for(i = 0; i < 4; i++){
+    if(read(fds[0], &c, 1) != 1){
+      printf(1, "thread write failed\n");
+      exit();
+    }
+  }
+  if(wait() != -1){
+    printf(1, "wait returned a thread\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if(thread_join() < 0){
+      printf(1, "thread_join failed\n");
+      exit();
+    }
+  }
+  if(thread_join() != -1){
+    printf(1, "thread_join with no threads succeeded\n");
+    exit();
+  }
+  for(i = 0; i < 4; i++){
+    if(threadslot[i] != i + 100){
+      printf(1, "thread memory not shared\n");
+      exit();
+    }
+  }
+  close(fds[0]);
+  close(fds[1]);
+
+  pid = fork();
+  if(pid == 0){
+    thread_create(threadspin, 0);
+    thread_create(threadspin, 0);
+    exit();
+  }
+  if(wait() != pid){
+    printf(1, "leader with threads did not exit\n");
+    exit();
+  }
+  printf(1, "thread ok\n");
+}
+
+struct mutex futexmu;
+struct cond futexcv;
+int futexcount, futexdone;
+
+void
+futexfn(void *arg)
+{
+  int i;
+
+  for(i = 0; i < 1000; i++){
+    mutex_lock(&futexmu);
+    futexcount++;
+    mutex_unlock(&futexmu);
+  }
+  mutex_lock(&futexmu);
+  futexdone++;
+  cond_signal(&futexcv);
+  mutex_unlock(&futexmu);
+  exit();
+}
+
+// threads counting under a futex mutex lose no updates,
+// and a condition variable reports when they are done.
+void
+futextest(void)
+{
+  uint w;
+  int i;
+
+  printf(1, "futex test\n");
+  w = 1;
+  if(futex_wait(&w, 2) != 0 || futex_wake(&w, 1) != 0){
+    printf(1, "futex on unchanged word failed\n");
+    exit();
+  }
+  if(futex_wait((uint*)0x7ffffffc, 0) != -1 || futex_wait((uint*)((char*)&w + 1), 0) != -1){
+    printf(1, "futex accepted a bad address\n");
+    exit();
+  }
+
+  mutex_init(&futexmu);
+  cond_init(&futexcv);
+  for(i = 0; i < 4; i++){
+    if(thread_create(futexfn, 0) < 0){
+      printf(1, "thread_create failed\n");
+      exit();
+    }
+  }
+  mutex_lock(&futexmu);
+  while(futexdone < 4)
+    cond_wait(&futexcv, &futexmu);
+  mutex_unlock(&futexmu);
+  for(i = 0; i < 4; i++)
+    thread_join();
+  if(futexcount != 4000){
+    printf(1, "futex mutex lost updates: %d\n", futexcount);
+    exit();
+  }
+  printf(1, "futex ok\n");
+}
+
+volatile int vdsopid;
+
+void
+vdsofn(void *arg)
+{
+  vdsopid = vgetpid() == getpid() ? 1 : -1;
+  exit();
+}
+
+// the vDSO page helpers agree with the system calls,
+// in children and threads too.
+void
+vdsotest(void)
+{
+  uint t0, t1, t2;
+  uint64 c0, c1;
+  int pid;
+
+  printf(1, "vdso test\n");
+  if(vgetpid() != getpid()){
+    printf(1, "vgetpid wrong\n");
+    exit();
+  }
+  t0 = uptime();
+  t1 = vuptime();
+  t2 = uptime();
+  if(t1 < t0 || t1 > t2){
+    printf(1, "vuptime wrong: %d not in %d..%d\n", t1, t0, t2);
+    exit();
+  }
+  c0 = vclock();
+  sleep(2);
+  c1 = vclock();
+  if(c1 <= c0){
+    printf(1, "vclock did not advance\n");
+    exit();
+  }
+
+  pid = fork();
+  if(pid == 0){
+    if(vgetpid() != getpid())
+      printf(1, "vgetpid wrong in child\n");
+    exit();
+  }
+  wait();
+
+  if(thread_create(vdsofn, 0) < 0){
+    printf(1, "thread_create failed\n");
+    exit();
+  }
+  thread_join();
+  if(vdsopid != 1){
+    printf(1, "vgetpid wrong in thread\n");
+    exit();
+  }
+  printf(1, "vdso ok\n");
+}
+
+struct ring ring, pollring;
+
+// Submit what is queued on r and take exactly n completions.
+void
+ringwait(struct ring *r, struct cqe *c, int n)
+{
+  int i;
+
+  if(ring_submit(r, n) < n){
+    printf(1, "ring_submit failed\n");
+    exit();
+  }
+  for(i = 0; i < n; i++){
+    if(ring_reap(r, &c[i]) < 0 || c[i].data != i){
+      printf(1, "ring completion missing\n");
+      exit();
+    }
+  }
+  if(ring_reap(r, &c[0]) == 0){
+    printf(1, "ring completion extra\n");
+    exit();
+  }
+}
+
+// file operations through the submission ring, with and
+// without a kernel thread polling it.
+void
+ringtest(void)
+{
+  struct cqe c[4];
+  char buf[16];
+  int fd, fds[2], pid;
+
+  printf(1, "ring test\n");
+  if(ring_setup(&ring, 0) != 0 || ring_setup(&ring, 0) != -1){
+    printf(1, "ring_setup failed\n");
+    exit();
+  }
+  ring_queue(&ring, RING_OPEN, 0, "ringfile", O_CREATE|O_RDWR, 0);
+  ringwait(&ring, c, 1);
+  if((fd = c[0].res) < 0){
+    printf(1, "ring open failed\n");
+    exit();
+  }
+  ring_queue(&ring, RING_WRITE, fd, "0123456789", 10, 0);
+  ring_queue(&ring, RING_CLOSE, fd, 0, 0, 1);
+  ring_queue(&ring, RING_OPEN, 0, "ringfile", O_RDONLY, 2);
+  ringwait(&ring, c, 3);
+  if(c[0].res != 10 || c[1].res != 0 || (fd = c[2].res) < 0){
+    printf(1, "ring write failed\n");
+    exit();
+  }
+  ring_queue(&ring, RING_READ, fd, buf, sizeof(buf), 0);
+  ring_queue(&ring, RING_CLOSE, fd, 0, 0, 1);
+  ring_queue(&ring, RING_READ, fd, buf, sizeof(buf), 2);
+  ring_queue(&ring, 99, 0, 0, 0, 3);
+  ringwait(&ring, c, 4);
+  buf[10] = 0;
+  if(c[0].res != 10 || strcmp(buf, "0123456789") != 0 || c[1].res != 0 ||
+     c[2].res != -1 || c[3].res != -1){
+    printf(1, "ring read failed\n");
+    exit();
+  }
+  unlink("ringfile");
+
+  pid = fork();
+  if(pid == 0){
+    if(ring_setup(&pollring, RING_SQPOLL) != 0 || pipe(fds) != 0){
+      printf(1, "ring_setup RING_SQPOLL failed\n");
+      exit();
+    }
+    ring_queue(&pollring, RING_WRITE, fds[1], "x", 1, 0);
+    ringwait(&pollring, c, 1);
+    if(c[0].res != 1 || read(fds[0], buf, 1) != 1 || buf[0] != 'x'){
+      printf(1, "ring poller write failed\n");
+      exit();
+    }
+    sleep(10);  // let the poller go to sleep
+    ring_queue(&pollring, RING_NOP, 0, 0, 0, 0);
+    ringwait(&pollring, c, 1);
+    if(thread_join() != -1){
+      printf(1, "thread_join returned the ring poller\n");
+      exit();
+    }
+    exit();
+  }
+  if(wait() != pid){
+    printf(1, "ring poller did not exit\n");
+    exit();
+  }
+  printf(1, "ring ok\n");
+}
+
+static int
+xmm0is(uint *v)
+{
+  uint x[4];
+  int i;
+
+  asm volatile("movups %%xmm0, %0" : "=m" (x));
+  for(i = 0; i < 4; i++)
+    if(x[i] != v[i])
+      return 0;
+  return 1;
+}
+
+// SSE registers survive context switches, and fork copies them.
+void
+fputest(void)
+{
+  uint a[4], b[4];
+  int i, pid;
+
+  printf(1, "fpu test\n");
+  for(i = 0; i < 4; i++){
+    a[i] = 0x12345678 + i;
+    b[i] = ~a[i];
+  }
+  asm volatile("movups %0, %%xmm0" : : "m" (a));
+  pid = fork();
+  if(pid < 0){
+    printf(1, "fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    if(!xmm0is(a))
+      printf(1, "fork lost SSE state\n");
+    asm volatile("movups %0, %%xmm0" : : "m" (b));
+    sleep(2);
+    if(!xmm0is(b))
+      printf(1, "child lost SSE state\n");
+    exit();
+  }
+  sleep(1);
+  if(!xmm0is(a)){
+    printf(1, "parent lost SSE state\n");
+    exit();
+  }
+  wait();
+  if(!xmm0is(a)){
+    printf(1, "parent lost SSE state after wait\n");
+    exit();
+  }
+  printf(1, "fpu ok\n");
+}
+
 // meant to be run w/ at most two CPUs
 void
 preempt(void)
@@ -1249,7 +1677,7 @@ iref(void)
 
   printf(1, "empty file name\n");
 
-  // the 50 is NINODE
+  // the 50 was NINODE, back when the inode cache was a fixed table
   for(i = 0; i < 50 + 1; i++){
     if(mkdir("irefd") != 0){
       printf(1, "mkdir irefd failed\n");
@@ -1448,6 +1876,65 @@ sbrktest(void)
   printf(stdout, "sbrk test OK\n");
 }
 
+// Grow the heap over whole, aligned 4MB stretches so the kernel
+// can back them with superpages, then check that fork copies them
+// and that shrinking into the middle of one keeps the rest.
+void
+superpagetest(void)
+{
+  char *oldbrk, *a, *p;
+  int pid;
+
+  printf(stdout, "superpage test\n");
+  oldbrk = sbrk(0);
+#define SUPER (4*1024*1024)
+  a = (char*)(((uint)oldbrk + SUPER - 1) & ~(SUPER - 1));
+  if(sbrk(a - oldbrk + 2*SUPER) != oldbrk){
+    printf(stdout, "superpage sbrk failed\n");
+    exit();
+  }
+  for(p = a; p < a + 2*SUPER; p += 4096)
+    *p = (uint)p >> 12;
+
+  pid = fork();
+  if(pid < 0){
+    printf(stdout, "superpage fork failed\n");
+    exit();
+  }
+  if(pid == 0){
+    for(p = a; p < a + 2*SUPER; p += 4096){
+      if(*p != (char)((uint)p >> 12)){
+        printf(stdout, "superpage child saw wrong data at %x\n", p);
+        exit();
+      }
+      *p = 0;
+    }
+    exit();
+  }
+  wait();
+  for(p = a; p < a + 2*SUPER; p += 4096){
+    if(*p != (char)((uint)p >> 12)){
+      printf(stdout, "superpage parent saw child's write at %x\n", p);
+      exit();
+    }
+  }
+
+  // Cut back into the middle of the first superpage.
+  if(sbrk(-(SUPER + SUPER/2)) == (char*)0xffffffff){
+    printf(stdout, "superpage shrink failed\n");
+    exit();
+  }
+  for(p = a; p < a + SUPER/2; p += 4096){
+    if(*p != (char)((uint)p >> 12)){
+      printf(stdout, "superpage shrink lost data at %x\n", p);
+      exit();
+    }
+  }
+
+  sbrk(-(sbrk(0) - oldbrk));
+  printf(stdout, "superpage test OK\n");
+}
+
 void
 validateint(int *p)
 {
@@ -1621,6 +2108,7 @@ main(int argc, char *argv[])
   bigargtest();
   bsstest();
   sbrktest();
+  superpagetest();
   validatetest();
 
   opentest();
@@ -1630,7 +2118,14 @@ main(int argc, char *argv[])
 
   mem();
   pipe1();
+  manypipes();
   preempt();
+  prioritytest();
+  threadtest();
+  futextest();
+  vdsotest();
+  ringtest();
+  fputest();
   exitwait();
 
   rmdot();
@@ -0,0 +1,22 @@
+// Kernel data mapped read-only at the top of every process's
+// user memory, so that user code can read the time and its pid
+// without a system call.  VDSO is shared by all processes;
+// VDSOPROC belongs to the process.  The two pages end at
+// KERNBASE, and user memory must stay below VDSO.
+#define VDSO     0x7FFFE000
+#define VDSOPROC 0x7FFFF000
+
+#define VDSO_SYSENTER (VDSO+16)  // &((struct vdso*)VDSO)->sysenter, for usys.S
+
+#ifndef __ASSEMBLER__
+struct vdso {
+  uint ticks;       // Timer interrupts since boot, as uptime()
+  uint tscmult;     // Microseconds = (TSC cycles * tscmult) >> 32
+  uint64 boottsc;   // TSC when the kernel started
+  uint sysenter;    // System calls may use SYSENTER
+};
+
+struct vdsoproc {
+  int pid;          // getpid(), or 0 once the process has threads
+};
+#endif
@@ -4,11 +4,14 @@
 #include "x86.h"
 #include "memlayout.h"
 #include "mmu.h"
+#include "spinlock.h"
 #include "proc.h"
 #include "elf.h"
+#include "vdso.h"
 
 extern char data[];  // defined by kernel.ld
 pde_t *kpgdir;  // for use in scheduler()
+static struct vdso *vdso;  // mapped at VDSO in every process
 struct segdesc gdt[NSEGS];
 
 // Set up CPU's kernel segment descriptors.
@@ -42,6 +45,8 @@ seginit(void)
 // Return the address of the PTE in page table pgdir
 // that corresponds to virtual address va.  If alloc!=0,
 // create any required page table pages.
+// If va lies in a 4MB superpage, return the page directory
+// entry itself; callers check for PTE_PS (see pagepa).
 static pte_t *
 walkpgdir(pde_t *pgdir, const void *va, int alloc)
 {
@@ -49,6 +54,8 @@ walkpgdir(pde_t *pgdir, const void *va, int alloc)
   pte_t *pgtab;
 
   pde = &pgdir[PDX(va)];
+  if(*pde & PTE_PS)
+    return pde;
   if(*pde & PTE_P){
     pgtab = (pte_t*)p2v(PTE_ADDR(*pde));
   } else {
@@ -89,66 +96,152 @@ mappages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
   return 0;
 }
 
+// Return the physical address of the 4096-byte page holding va,
+// given the entry walkpgdir() returned for it.
+static uint
+pagepa(pte_t *pte, const void *va)
+{
+  if(*pte & PTE_PS)
+    return PTE_ADDR(*pte) + ((uint)va & (SUPERPGSIZE-1) & ~(PGSIZE-1));
+  return PTE_ADDR(*pte);
+}
+
+// Like mappages(), but map with 4MB superpages wherever va and pa
+// are both superpage-aligned and a whole superpage fits in the
+// range.  Used for the kernel's mappings.
+static int
+mapbigpages(pde_t *pgdir, void *va, uint size, uint pa, int perm)
+{
+  uint a, last;
+  pde_t *pde;
+
+  a = PGROUNDDOWN((uint)va);
+  last = PGROUNDDOWN((uint)va + size - 1);
+  for(;;){
+    if(a % SUPERPGSIZE == 0 && pa % SUPERPGSIZE == 0 &&
+       last - a >= SUPERPGSIZE - PGSIZE){
+      pde = &pgdir[PDX(a)];
+      if(*pde & PTE_P)
+        panic("remap");
+      *pde = pa | perm | PTE_P | PTE_PS;
+      if(last - a == SUPERPGSIZE - PGSIZE)
+        break;
+      a += SUPERPGSIZE;
+      pa += SUPERPGSIZE;
+      continue;
+    }
+    if(mappages(pgdir, (void*)a, PGSIZE, pa, perm) < 0)
+      return -1;
+    if(a == last)
+      break;
+    a += PGSIZE;
+    pa += PGSIZE;
+  }
+  return 0;
+}
+
+// Replace the superpage mapping va with a page table of 4096-byte
+// PTEs for the same memory, so that part of it can be unmapped.
+// Returns -1 if no page is free for the page table.
+static int
+splitsuperpage(pde_t *pgdir, const void *va)
+{
+  pde_t *pde;
+  pte_t *pgtab;
+  uint pa, flags;
+  int i;
+
+  pde = &pgdir[PDX(va)];
+  if((*pde & PTE_PS) == 0)
+    panic("splitsuperpage");
+  if((pgtab = (pte_t*)kalloc()) == 0)
+    return -1;
+  pa = PTE_ADDR(*pde);
+  flags = PTE_FLAGS(*pde) & ~PTE_PS;
+  for(i = 0; i < NPTENTRIES; i++)
+    pgtab[i] = (pa + i*PGSIZE) | flags;
+  *pde = v2p(pgtab) | PTE_P | PTE_W | PTE_U;
+  return 0;
+}
+
 // There is one page table per process, plus one that's used when
 // a CPU is not running any process (kpgdir). The kernel uses the
 // current process's page table during system calls and interrupts;
 // page protection bits prevent user code from using the kernel's
 // mappings.
 // 
-// setupkvm() and exec() set up every page table like this:
+// kvmalloc() builds the kernel part once in kpgdir; setupkvm() and
+// exec() set up every page table like this:
 //
 //   0..KERNBASE: user memory (text+data+stack+heap), mapped to
 //                phys memory allocated by the kernel
 //   KERNBASE..KERNBASE+EXTMEM: mapped to 0..EXTMEM (for I/O space)
 //   KERNBASE+EXTMEM..data: mapped to EXTMEM..V2P(data)
 //                for the kernel's instructions and r/o data
-//   data..KERNBASE+PHYSTOP: mapped to V2P(data)..PHYSTOP, 
+//   data..KERNBASE+phystop: mapped to V2P(data)..phystop,
 //                                  rw data + free physical memory
 //   0xfe000000..0: mapped direct (devices such as ioapic)
 //
 // The kernel allocates physical memory for its heap and for user memory
-// between V2P(end) and the end of physical memory (PHYSTOP)
-// (directly addressable from end..P2V(PHYSTOP)).
+// between V2P(end) and the end of physical memory (phystop, found
+// by meminit()) (directly addressable from end..P2V(phystop)), and
+// in the RAM below 640K.
+//
+// The kernel mappings use 4MB superpages where they are aligned,
+// which covers almost all of KERNBASE..KERNBASE+phystop and the
+// device space.  allocuvm() also backs whole, aligned 4MB stretches
+// of user memory with superpages when it can get one.
 
 // This table defines the kernel's mappings, which are present in
-// every process's page table.
+// every process's page table.  They are marked global, so their
+// TLB entries survive the %cr3 reload on every address space switch.
 static struct kmap {
   void *virt;
   uint phys_start;
   uint phys_end;
   int perm;
 } kmap[] = {
- { (void*)KERNBASE, 0,             EXTMEM,    PTE_W}, // I/O space
- { (void*)KERNLINK, V2P(KERNLINK), V2P(data), 0},     // kern text+rodata
- { (void*)data,     V2P(data),     PHYSTOP,   PTE_W}, // kern data+memory
- { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W}, // more devices
+ { (void*)KERNBASE, 0,             EXTMEM,    PTE_W|PTE_G}, // I/O space
+ { (void*)KERNLINK, V2P(KERNLINK), V2P(data), PTE_G},       // kern text+rodata
+ { (void*)data,     V2P(data),     0,         PTE_W|PTE_G}, // kern data+memory
+ { (void*)DEVSPACE, DEVSPACE,      0,         PTE_W|PTE_G}, // more devices
 };
 
 // Set up kernel part of a page table.
+// The kernel mappings never change after kvmalloc(), so instead of
+// building them again, every page directory shares kpgdir's kernel
+// page-table pages by copying its PDEs above KERNBASE.
 pde_t*
 setupkvm(void)
 {
   pde_t *pgdir;
-  struct kmap *k;
 
   if((pgdir = (pde_t*)kalloc()) == 0)
     return 0;
-  memset(pgdir, 0, PGSIZE);
-  if (p2v(PHYSTOP) > (void*)DEVSPACE)
-    panic("PHYSTOP too high");
-  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
-    if(mappages(pgdir, k->virt, k->phys_end - k->phys_start, 
-                (uint)k->phys_start, k->perm) < 0)
-      return 0;
+  memset(pgdir, 0, PDX(KERNBASE)*sizeof(pde_t));
+  memmove(&pgdir[PDX(KERNBASE)], &kpgdir[PDX(KERNBASE)],
+          (NPDENTRIES - PDX(KERNBASE))*sizeof(pde_t));
   return pgdir;
 }
 
 // Allocate one page table for the machine for the kernel address
-// space for scheduler processes.
+// space for scheduler processes.  Its kernel page-table pages are
+// shared by every process's page table (see setupkvm).
 void
 kvmalloc(void)
 {
-  kpgdir = setupkvm();
+  struct kmap *k;
+
+  if((kpgdir = (pde_t*)kalloc()) == 0)
+    panic("kvmalloc");
+  memset(kpgdir, 0, PGSIZE);
+  if (phystop > PHYSLIMIT)
+    panic("phystop too high");
+  kmap[2].phys_end = phystop;   // kern data+memory: known only at boot
+  for(k = kmap; k < &kmap[NELEM(kmap)]; k++)
+    if(mapbigpages(kpgdir, k->virt, k->phys_end - k->phys_start, 
+                   (uint)k->phys_start, k->perm) < 0)
+      panic("kvmalloc: out of memory");
   switchkvm();
 }
 
@@ -157,10 +250,13 @@ kvmalloc(void)
 void
 switchkvm(void)
 {
-  lcr3(v2p(kpgdir));   // switch to the kernel page table
+  if(rcr3() != v2p(kpgdir))
+    lcr3(v2p(kpgdir));   // switch to the kernel page table
 }
 
 // Switch TSS and h/w page table to correspond to process p.
+// Does not reload %cr3 (and flush the TLB) if p's page table
+// is already in use; see growproc() for forcing a flush.
 void
 switchuvm(struct proc *p)
 {
@@ -169,10 +265,12 @@ switchuvm(struct proc *p)
   cpu->gdt[SEG_TSS].s = 0;
   cpu->ts.ss0 = SEG_KDATA << 3;
   cpu->ts.esp0 = (uint)proc->kstack + KSTACKSIZE;
+  cpu->sysesp = cpu->ts.esp0;
   ltr(SEG_TSS << 3);
   if(p->pgdir == 0)
     panic("switchuvm: no pgdir");
-  lcr3(v2p(p->pgdir));  // switch to new address space
+  if(rcr3() != v2p(p->pgdir))
+    lcr3(v2p(p->pgdir));  // switch to new address space
   popcli();
 }
 
@@ -204,7 +302,7 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
   for(i = 0; i < sz; i += PGSIZE){
     if((pte = walkpgdir(pgdir, addr+i, 0)) == 0)
       panic("loaduvm: address should exist");
-    pa = PTE_ADDR(*pte);
+    pa = pagepa(pte, addr+i);
     if(sz - i < PGSIZE)
       n = sz - i;
     else
@@ -217,19 +315,33 @@ loaduvm(pde_t *pgdir, char *addr, struct inode *ip, uint offset, uint sz)
 
 // Allocate page tables and physical memory to grow process from oldsz to
 // newsz, which need not be page aligned.  Returns new size or 0 on error.
+// Whole, aligned 4MB stretches are mapped with a superpage if one is
+// free and no page table is there yet.
 int
 allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
   char *mem;
   uint a;
+  pde_t *pde;
 
-  if(newsz >= KERNBASE)
+  if(newsz > VDSO)
     return 0;
   if(newsz < oldsz)
     return oldsz;
 
   a = PGROUNDUP(oldsz);
   for(; a < newsz; a += PGSIZE){
+    // A page table left here by an earlier deallocuvm() stays:
+    // other CPUs running threads of this process may still have
+    // it cached, so it cannot be freed without a TLB shootdown.
+    pde = &pgdir[PDX(a)];
+    if(a % SUPERPGSIZE == 0 && newsz - a >= SUPERPGSIZE &&
+       !(*pde & PTE_P) && (mem = ksuperalloc()) != 0){
+      memset(mem, 0, SUPERPGSIZE);
+      *pde = v2p(mem) | PTE_P | PTE_W | PTE_U | PTE_PS;
+      a += SUPERPGSIZE - PGSIZE;
+      continue;
+    }
     mem = kalloc();
     if(mem == 0){
       cprintf("allocuvm out of memory\n");
@@ -245,7 +357,8 @@ allocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 // Deallocate user pages to bring the process size from oldsz to
 // newsz.  oldsz and newsz need not be page-aligned, nor does newsz
 // need to be less than oldsz.  oldsz can be larger than the actual
-// process size.  Returns the new process size.
+// process size.  Returns the new process size, which is larger than
+// newsz if a superpage straddling newsz could not be split.
 int
 deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 {
@@ -259,8 +372,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
   for(; a  < oldsz; a += PGSIZE){
     pte = walkpgdir(pgdir, (char*)a, 0);
     if(!pte)
-      a += (NPTENTRIES - 1) * PGSIZE;
-    else if((*pte & PTE_P) != 0){
+      a = PGADDR(PDX(a) + 1, 0, 0) - PGSIZE;
+    else if(*pte & PTE_PS){
+      if(a % SUPERPGSIZE == 0){
+        ksuperfree(p2v(PTE_ADDR(*pte)));
+        *pte = 0;
+        a += SUPERPGSIZE - PGSIZE;
+      } else if(splitsuperpage(pgdir, (char*)a) < 0){
+        // Keep the whole superpage mapped.
+        a = SUPERPGROUNDUP(a);
+        newsz = a;
+        a -= PGSIZE;
+      } else
+        a -= PGSIZE;  // free the 4096-byte pages on the next pass
+    } else if((*pte & PTE_P) != 0){
       pa = PTE_ADDR(*pte);
       if(pa == 0)
         panic("kfree");
@@ -273,16 +398,20 @@ deallocuvm(pde_t *pgdir, uint oldsz, uint newsz)
 }
 
 // Free a page table and all the physical memory pages
-// in the user part.
+// in the user part.  The kernel page-table pages belong
+// to kpgdir and are left alone.
 void
 freevm(pde_t *pgdir)
 {
   uint i;
+  pte_t *pte;
 
   if(pgdir == 0)
     panic("freevm: no pgdir");
+  if((pte = walkpgdir(pgdir, (char*)VDSO, 0)) != 0)
+    *pte = 0;  // shared, not ours to free
   deallocuvm(pgdir, KERNBASE, 0);
-  for(i = 0; i < NPDENTRIES; i++){
+  for(i = 0; i < PDX(KERNBASE); i++){
     if(pgdir[i] & PTE_P){
       char * v = p2v(PTE_ADDR(pgdir[i]));
       kfree(v);
@@ -299,11 +428,59 @@ clearpteu(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if(pte == 0)
+  if(pte == 0 || (*pte & PTE_PS))
     panic("clearpteu");
   *pte &= ~PTE_U;
 }
 
+// Allocate the shared vDSO page and work out the TSC's rate.
+void
+vdsoinit(void)
+{
+  uint c, mult, rem;
+
+  if((vdso = (struct vdso*)kalloc()) == 0)
+    panic("vdsoinit");
+  memset(vdso, 0, PGSIZE);
+  c = tsccalibrate();  // cycles in 10000us
+  vdso->boottsc = rdtsc();
+  if(c > 10000){
+    // mult = (10000 << 32) / c; the quotient fits in 32 bits.
+    asm("divl %2" : "=a" (mult), "=d" (rem) : "r" (c), "0" (0), "1" (10000));
+    vdso->tscmult = mult;
+  }
+  // idtinit() sets SYSENTER up on CPUs that have it; the others
+  // are assumed to be like this one.
+  vdso->sysenter = (cpuid(1) & CPUID_SEP) != 0;
+}
+
+void
+vdsotick(uint ticks)
+{
+  vdso->ticks = ticks;
+}
+
+// Map the shared vDSO page, and a fresh page for process pid's
+// own constants, read-only into pgdir.  Returns 0, or -1 if
+// out of memory.
+int
+mapvdso(pde_t *pgdir, int pid)
+{
+  struct vdsoproc *vp;
+
+  if((vp = (struct vdsoproc*)kalloc()) == 0)
+    return -1;
+  memset(vp, 0, PGSIZE);
+  vp->pid = pid;
+  if(mappages(pgdir, (char*)VDSOPROC, PGSIZE, v2p(vp), PTE_U) < 0){
+    kfree((char*)vp);
+    return -1;
+  }
+  if(mappages(pgdir, (char*)VDSO, PGSIZE, v2p(vdso), PTE_U) < 0)
+    return -1;
+  return 0;
+}
+
 // Given a parent process's page table, create a copy
 // of it for a child.
 pde_t*
@@ -321,8 +498,16 @@ copyuvm(pde_t *pgdir, uint sz)
       panic("copyuvm: pte should exist");
     if(!(*pte & PTE_P))
       panic("copyuvm: page not present");
-    pa = PTE_ADDR(*pte);
-    flags = PTE_FLAGS(*pte);
+    // Copy a superpage whole if a free one is available,
+    // otherwise 4096 bytes at a time like any other memory.
+    if((*pte & PTE_PS) && (mem = ksuperalloc()) != 0){
+      memmove(mem, (char*)p2v(PTE_ADDR(*pte)), SUPERPGSIZE);
+      d[PDX(i)] = v2p(mem) | PTE_FLAGS(*pte);
+      i += SUPERPGSIZE - PGSIZE;
+      continue;
+    }
+    pa = pagepa(pte, (void*)i);
+    flags = PTE_FLAGS(*pte) & ~PTE_PS;
     if((mem = kalloc()) == 0)
       goto bad;
     memmove(mem, (char*)p2v(pa), PGSIZE);
@@ -344,22 +529,29 @@ uva2ka(pde_t *pgdir, char *uva)
   pte_t *pte;
 
   pte = walkpgdir(pgdir, uva, 0);
-  if((*pte & PTE_P) == 0)
+  if(pte == 0 || (*pte & PTE_P) == 0)
     return 0;
   if((*pte & PTE_U) == 0)
     return 0;
-  return (char*)p2v(PTE_ADDR(*pte));
+  return (char*)p2v(pagepa(pte, uva));
 }
 
 // Copy len bytes from p to user address va in page table pgdir.
 // Most useful when pgdir is not the current page table.
 // uva2ka ensures this only works for PTE_U pages.
+// In the current process's own memory, which is all mapped,
+// one memmove does, as for the buffers of read().
 int
 copyout(pde_t *pgdir, uint va, void *p, uint len)
 {
   char *buf, *pa0;
   uint n, va0;
 
+  if(proc && pgdir == proc->pgdir && va < proc->sz && len <= proc->sz - va){
+    memmove((void*)va, p, len);
+    return 0;
+  }
+
   buf = (char*)p;
   while(len > 0){
     va0 = (uint)PGROUNDDOWN(va);
@@ -0,0 +1,1920 @@
+
+_wc:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <wc>:
+
+char buf[512];
+
+void
+wc(int fd, char *name)
+{
+   0:	55                   	push   %ebp
+   1:	89 e5                	mov    %esp,%ebp
+   3:	83 ec 28             	sub    $0x28,%esp
+  int i, n;
+  int l, w, c, inword;
+
+  l = w = c = 0;
+   6:	c7 45 e8 00 00 00 00 	movl   $0x0,-0x18(%ebp)
+   d:	8b 45 e8             	mov    -0x18(%ebp),%eax
+  10:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  13:	8b 45 ec             	mov    -0x14(%ebp),%eax
+  16:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  inword = 0;
+  19:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  20:	eb 69                	jmp    8b <wc+0x8b>
+    for(i=0; i<n; i++){
+  22:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  29:	eb 58                	jmp    83 <wc+0x83>
+      c++;
+  2b:	83 45 e8 01          	addl   $0x1,-0x18(%ebp)
+      if(buf[i] == '\n')
+  2f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  32:	05 60 13 00 00       	add    $0x1360,%eax
+  37:	0f b6 00             	movzbl (%eax),%eax
+  3a:	3c 0a                	cmp    $0xa,%al
+  3c:	75 04                	jne    42 <wc+0x42>
+        l++;
+  3e:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+      if(strchr(" \r\t\n\v", buf[i]))
+  42:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  45:	05 60 13 00 00       	add    $0x1360,%eax
+  4a:	0f b6 00             	movzbl (%eax),%eax
+  4d:	0f be c0             	movsbl %al,%eax
+  50:	83 ec 08             	sub    $0x8,%esp
+  53:	50                   	push   %eax
+  54:	68 24 0e 00 00       	push   $0xe24
+  59:	e8 87 02 00 00       	call   2e5 <strchr>
+  5e:	83 c4 10             	add    $0x10,%esp
+  61:	85 c0                	test   %eax,%eax
+  63:	74 09                	je     6e <wc+0x6e>
+        inword = 0;
+  65:	c7 45 e4 00 00 00 00 	movl   $0x0,-0x1c(%ebp)
+  6c:	eb 11                	jmp    7f <wc+0x7f>
+      else if(!inword){
+  6e:	83 7d e4 00          	cmpl   $0x0,-0x1c(%ebp)
+  72:	75 0b                	jne    7f <wc+0x7f>
+        w++;
+  74:	83 45 ec 01          	addl   $0x1,-0x14(%ebp)
+        inword = 1;
+  78:	c7 45 e4 01 00 00 00 	movl   $0x1,-0x1c(%ebp)
+    for(i=0; i<n; i++){
+  7f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+  83:	8b 45 f4             	mov    -0xc(%ebp),%eax
+  86:	3b 45 e0             	cmp    -0x20(%ebp),%eax
+  89:	7c a0                	jl     2b <wc+0x2b>
+  while((n = read(fd, buf, sizeof(buf))) > 0){
+  8b:	83 ec 04             	sub    $0x4,%esp
+  8e:	68 00 02 00 00       	push   $0x200
+  93:	68 60 13 00 00       	push   $0x1360
+  98:	ff 75 08             	push   0x8(%ebp)
+  9b:	e8 84 07 00 00       	call   824 <read>
+  a0:	83 c4 10             	add    $0x10,%esp
+  a3:	89 45 e0             	mov    %eax,-0x20(%ebp)
+  a6:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  aa:	0f 8f 72 ff ff ff    	jg     22 <wc+0x22>
+      }
+    }
+  }
+  if(n < 0){
+  b0:	83 7d e0 00          	cmpl   $0x0,-0x20(%ebp)
+  b4:	79 17                	jns    cd <wc+0xcd>
+    printf(1, "wc: read error\n");
+  b6:	83 ec 08             	sub    $0x8,%esp
+  b9:	68 2a 0e 00 00       	push   $0xe2a
+  be:	6a 01                	push   $0x1
+  c0:	e8 20 09 00 00       	call   9e5 <printf>
+  c5:	83 c4 10             	add    $0x10,%esp
+    exit();
+  c8:	e8 42 07 00 00       	call   80f <exit>
+  }
+  printf(1, "%d %d %d %s\n", l, w, c, name);
+  cd:	83 ec 08             	sub    $0x8,%esp
+  d0:	ff 75 0c             	push   0xc(%ebp)
+  d3:	ff 75 e8             	push   -0x18(%ebp)
+  d6:	ff 75 ec             	push   -0x14(%ebp)
+  d9:	ff 75 f0             	push   -0x10(%ebp)
+  dc:	68 3a 0e 00 00       	push   $0xe3a
+  e1:	6a 01                	push   $0x1
+  e3:	e8 fd 08 00 00       	call   9e5 <printf>
+  e8:	83 c4 20             	add    $0x20,%esp
+}
+  eb:	90                   	nop
+  ec:	c9                   	leave
+  ed:	c3                   	ret
+
+000000ee <main>:
+
+int
+main(int argc, char *argv[])
+{
+  ee:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+  f2:	83 e4 f0             	and    $0xfffffff0,%esp
+  f5:	ff 71 fc             	push   -0x4(%ecx)
+  f8:	55                   	push   %ebp
+  f9:	89 e5                	mov    %esp,%ebp
+  fb:	53                   	push   %ebx
+  fc:	51                   	push   %ecx
+  fd:	83 ec 10             	sub    $0x10,%esp
+ 100:	89 cb                	mov    %ecx,%ebx
+  int fd, i;
+
+  if(argc <= 1){
+ 102:	83 3b 01             	cmpl   $0x1,(%ebx)
+ 105:	7f 17                	jg     11e <main+0x30>
+    wc(0, "");
+ 107:	83 ec 08             	sub    $0x8,%esp
+ 10a:	68 47 0e 00 00       	push   $0xe47
+ 10f:	6a 00                	push   $0x0
+ 111:	e8 ea fe ff ff       	call   0 <wc>
+ 116:	83 c4 10             	add    $0x10,%esp
+    exit();
+ 119:	e8 f1 06 00 00       	call   80f <exit>
+  }
+
+  for(i = 1; i < argc; i++){
+ 11e:	c7 45 f4 01 00 00 00 	movl   $0x1,-0xc(%ebp)
+ 125:	e9 83 00 00 00       	jmp    1ad <main+0xbf>
+    if((fd = open(argv[i], 0)) < 0){
+ 12a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 12d:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 134:	8b 43 04             	mov    0x4(%ebx),%eax
+ 137:	01 d0                	add    %edx,%eax
+ 139:	8b 00                	mov    (%eax),%eax
+ 13b:	83 ec 08             	sub    $0x8,%esp
+ 13e:	6a 00                	push   $0x0
+ 140:	50                   	push   %eax
+ 141:	e8 01 07 00 00       	call   847 <open>
+ 146:	83 c4 10             	add    $0x10,%esp
+ 149:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ 14c:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 150:	79 29                	jns    17b <main+0x8d>
+      printf(1, "wc: cannot open %s\n", argv[i]);
+ 152:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 155:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 15c:	8b 43 04             	mov    0x4(%ebx),%eax
+ 15f:	01 d0                	add    %edx,%eax
+ 161:	8b 00                	mov    (%eax),%eax
+ 163:	83 ec 04             	sub    $0x4,%esp
+ 166:	50                   	push   %eax
+ 167:	68 48 0e 00 00       	push   $0xe48
+ 16c:	6a 01                	push   $0x1
+ 16e:	e8 72 08 00 00       	call   9e5 <printf>
+ 173:	83 c4 10             	add    $0x10,%esp
+      exit();
+ 176:	e8 94 06 00 00       	call   80f <exit>
+    }
+    wc(fd, argv[i]);
+ 17b:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 17e:	8d 14 85 00 00 00 00 	lea    0x0(,%eax,4),%edx
+ 185:	8b 43 04             	mov    0x4(%ebx),%eax
+ 188:	01 d0                	add    %edx,%eax
+ 18a:	8b 00                	mov    (%eax),%eax
+ 18c:	83 ec 08             	sub    $0x8,%esp
+ 18f:	50                   	push   %eax
+ 190:	ff 75 f0             	push   -0x10(%ebp)
+ 193:	e8 68 fe ff ff       	call   0 <wc>
+ 198:	83 c4 10             	add    $0x10,%esp
+    close(fd);
+ 19b:	83 ec 0c             	sub    $0xc,%esp
+ 19e:	ff 75 f0             	push   -0x10(%ebp)
+ 1a1:	e8 8c 06 00 00       	call   832 <close>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+  for(i = 1; i < argc; i++){
+ 1a9:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+ 1ad:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b0:	3b 03                	cmp    (%ebx),%eax
+ 1b2:	0f 8c 72 ff ff ff    	jl     12a <main+0x3c>
+  }
+  exit();
+ 1b8:	e8 52 06 00 00       	call   80f <exit>
+
+000001bd <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+ 1bd:	55                   	push   %ebp
+ 1be:	89 e5                	mov    %esp,%ebp
+ 1c0:	57                   	push   %edi
+ 1c1:	53                   	push   %ebx
+char*
+ 1c2:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1c5:	8b 55 10             	mov    0x10(%ebp),%edx
+ 1c8:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1cb:	89 cb                	mov    %ecx,%ebx
+ 1cd:	89 df                	mov    %ebx,%edi
+ 1cf:	89 d1                	mov    %edx,%ecx
+ 1d1:	fc                   	cld
+ 1d2:	f3 aa                	rep stos %al,%es:(%edi)
+ 1d4:	89 ca                	mov    %ecx,%edx
+ 1d6:	89 fb                	mov    %edi,%ebx
+ 1d8:	89 5d 08             	mov    %ebx,0x8(%ebp)
+ 1db:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+ 1de:	90                   	nop
+ 1df:	5b                   	pop    %ebx
+ 1e0:	5f                   	pop    %edi
+ 1e1:	5d                   	pop    %ebp
+ 1e2:	c3                   	ret
+
+000001e3 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+ 1e3:	55                   	push   %ebp
+ 1e4:	89 e5                	mov    %esp,%ebp
+ 1e6:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+ 1e9:	8b 55 08             	mov    0x8(%ebp),%edx
+ 1ec:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 1ef:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 1f2:	f0 87 02             	lock xchg %eax,(%edx)
+ 1f5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+ 1f8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+ 1fb:	c9                   	leave
+ 1fc:	c3                   	ret
+
+000001fd <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+ 1fd:	55                   	push   %ebp
+ 1fe:	89 e5                	mov    %esp,%ebp
+ 200:	53                   	push   %ebx
+ 201:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+ 204:	8b 5d 08             	mov    0x8(%ebp),%ebx
+ 207:	8b 55 10             	mov    0x10(%ebp),%edx
+ 20a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 20d:	8b 4d 08             	mov    0x8(%ebp),%ecx
+ 210:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+ 214:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+ 217:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+ 21a:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+ 21d:	c9                   	leave
+ 21e:	c3                   	ret
+
+0000021f <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+ 21f:	55                   	push   %ebp
+ 220:	89 e5                	mov    %esp,%ebp
+ 222:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+ 225:	0f 31                	rdtsc
+ 227:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 22a:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+ 22d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ 230:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+ 233:	c9                   	leave
+ 234:	c3                   	ret
+
+00000235 <strcpy>:
+{
+ 235:	55                   	push   %ebp
+ 236:	89 e5                	mov    %esp,%ebp
+ 238:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+ 23b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 23e:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+ 241:	90                   	nop
+ 242:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 245:	8d 42 01             	lea    0x1(%edx),%eax
+ 248:	89 45 0c             	mov    %eax,0xc(%ebp)
+ 24b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 24e:	8d 48 01             	lea    0x1(%eax),%ecx
+ 251:	89 4d 08             	mov    %ecx,0x8(%ebp)
+ 254:	0f b6 12             	movzbl (%edx),%edx
+ 257:	88 10                	mov    %dl,(%eax)
+ 259:	0f b6 00             	movzbl (%eax),%eax
+ 25c:	84 c0                	test   %al,%al
+ 25e:	75 e2                	jne    242 <strcpy+0xd>
+  return os;
+ 260:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 263:	c9                   	leave
+ 264:	c3                   	ret
+
+00000265 <strcmp>:
+{
+ 265:	55                   	push   %ebp
+ 266:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+ 268:	eb 08                	jmp    272 <strcmp+0xd>
+    p++, q++;
+ 26a:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 26e:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+ 272:	8b 45 08             	mov    0x8(%ebp),%eax
+ 275:	0f b6 00             	movzbl (%eax),%eax
+ 278:	84 c0                	test   %al,%al
+ 27a:	74 10                	je     28c <strcmp+0x27>
+ 27c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27f:	0f b6 10             	movzbl (%eax),%edx
+ 282:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 285:	0f b6 00             	movzbl (%eax),%eax
+ 288:	38 c2                	cmp    %al,%dl
+ 28a:	74 de                	je     26a <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+ 28c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 28f:	0f b6 00             	movzbl (%eax),%eax
+ 292:	0f b6 d0             	movzbl %al,%edx
+ 295:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 298:	0f b6 00             	movzbl (%eax),%eax
+ 29b:	0f b6 c0             	movzbl %al,%eax
+ 29e:	29 c2                	sub    %eax,%edx
+ 2a0:	89 d0                	mov    %edx,%eax
+}
+ 2a2:	5d                   	pop    %ebp
+ 2a3:	c3                   	ret
+
+000002a4 <strlen>:
+{
+ 2a4:	55                   	push   %ebp
+ 2a5:	89 e5                	mov    %esp,%ebp
+ 2a7:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 2aa:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 2b1:	eb 04                	jmp    2b7 <strlen+0x13>
+ 2b3:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 2b7:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 2ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2bd:	01 d0                	add    %edx,%eax
+ 2bf:	0f b6 00             	movzbl (%eax),%eax
+ 2c2:	84 c0                	test   %al,%al
+ 2c4:	75 ed                	jne    2b3 <strlen+0xf>
+  return n;
+ 2c6:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 2c9:	c9                   	leave
+ 2ca:	c3                   	ret
+
+000002cb <memset>:
+{
+ 2cb:	55                   	push   %ebp
+ 2cc:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 2ce:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2d1:	50                   	push   %eax
+ 2d2:	ff 75 0c             	push   0xc(%ebp)
+ 2d5:	ff 75 08             	push   0x8(%ebp)
+ 2d8:	e8 e0 fe ff ff       	call   1bd <stosb>
+ 2dd:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 2e0:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2e3:	c9                   	leave
+ 2e4:	c3                   	ret
+
+000002e5 <strchr>:
+{
+ 2e5:	55                   	push   %ebp
+ 2e6:	89 e5                	mov    %esp,%ebp
+ 2e8:	83 ec 04             	sub    $0x4,%esp
+ 2eb:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 2ee:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 2f1:	eb 14                	jmp    307 <strchr+0x22>
+    if(*s == c)
+ 2f3:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2f6:	0f b6 00             	movzbl (%eax),%eax
+ 2f9:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 2fc:	75 05                	jne    303 <strchr+0x1e>
+      return (char*)s;
+ 2fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 301:	eb 13                	jmp    316 <strchr+0x31>
+  for(; *s; s++)
+ 303:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 307:	8b 45 08             	mov    0x8(%ebp),%eax
+ 30a:	0f b6 00             	movzbl (%eax),%eax
+ 30d:	84 c0                	test   %al,%al
+ 30f:	75 e2                	jne    2f3 <strchr+0xe>
+  return 0;
+ 311:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 316:	c9                   	leave
+ 317:	c3                   	ret
+
+00000318 <gets>:
+{
+ 318:	55                   	push   %ebp
+ 319:	89 e5                	mov    %esp,%ebp
+ 31b:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 31e:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 325:	eb 42                	jmp    369 <gets+0x51>
+    cc = read(0, &c, 1);
+ 327:	83 ec 04             	sub    $0x4,%esp
+ 32a:	6a 01                	push   $0x1
+ 32c:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 32f:	50                   	push   %eax
+ 330:	6a 00                	push   $0x0
+ 332:	e8 ed 04 00 00       	call   824 <read>
+ 337:	83 c4 10             	add    $0x10,%esp
+ 33a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 33d:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 341:	7e 33                	jle    376 <gets+0x5e>
+    buf[i++] = c;
+ 343:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 346:	8d 50 01             	lea    0x1(%eax),%edx
+ 349:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 34c:	89 c2                	mov    %eax,%edx
+ 34e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 351:	01 c2                	add    %eax,%edx
+ 353:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 357:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 359:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 35d:	3c 0a                	cmp    $0xa,%al
+ 35f:	74 16                	je     377 <gets+0x5f>
+ 361:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 365:	3c 0d                	cmp    $0xd,%al
+ 367:	74 0e                	je     377 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 369:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 36c:	83 c0 01             	add    $0x1,%eax
+ 36f:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 372:	7f b3                	jg     327 <gets+0xf>
+ 374:	eb 01                	jmp    377 <gets+0x5f>
+      break;
+ 376:	90                   	nop
+  buf[i] = '\0';
+ 377:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 37a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 37d:	01 d0                	add    %edx,%eax
+ 37f:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 382:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 385:	c9                   	leave
+ 386:	c3                   	ret
+
+00000387 <stat>:
+{
+ 387:	55                   	push   %ebp
+ 388:	89 e5                	mov    %esp,%ebp
+ 38a:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 38d:	83 ec 08             	sub    $0x8,%esp
+ 390:	6a 00                	push   $0x0
+ 392:	ff 75 08             	push   0x8(%ebp)
+ 395:	e8 ad 04 00 00       	call   847 <open>
+ 39a:	83 c4 10             	add    $0x10,%esp
+ 39d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 3a0:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 3a4:	79 07                	jns    3ad <stat+0x26>
+    return -1;
+ 3a6:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 3ab:	eb 25                	jmp    3d2 <stat+0x4b>
+  r = fstat(fd, st);
+ 3ad:	83 ec 08             	sub    $0x8,%esp
+ 3b0:	ff 75 0c             	push   0xc(%ebp)
+ 3b3:	ff 75 f4             	push   -0xc(%ebp)
+ 3b6:	e8 a1 04 00 00       	call   85c <fstat>
+ 3bb:	83 c4 10             	add    $0x10,%esp
+ 3be:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 3c1:	83 ec 0c             	sub    $0xc,%esp
+ 3c4:	ff 75 f4             	push   -0xc(%ebp)
+ 3c7:	e8 66 04 00 00       	call   832 <close>
+ 3cc:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 3cf:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 3d2:	c9                   	leave
+ 3d3:	c3                   	ret
+
+000003d4 <atoi>:
+{
+ 3d4:	55                   	push   %ebp
+ 3d5:	89 e5                	mov    %esp,%ebp
+ 3d7:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 3da:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 3e1:	eb 25                	jmp    408 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 3e3:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 3e6:	89 d0                	mov    %edx,%eax
+ 3e8:	c1 e0 02             	shl    $0x2,%eax
+ 3eb:	01 d0                	add    %edx,%eax
+ 3ed:	01 c0                	add    %eax,%eax
+ 3ef:	89 c1                	mov    %eax,%ecx
+ 3f1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f4:	8d 50 01             	lea    0x1(%eax),%edx
+ 3f7:	89 55 08             	mov    %edx,0x8(%ebp)
+ 3fa:	0f b6 00             	movzbl (%eax),%eax
+ 3fd:	0f be c0             	movsbl %al,%eax
+ 400:	01 c8                	add    %ecx,%eax
+ 402:	83 e8 30             	sub    $0x30,%eax
+ 405:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 408:	8b 45 08             	mov    0x8(%ebp),%eax
+ 40b:	0f b6 00             	movzbl (%eax),%eax
+ 40e:	3c 2f                	cmp    $0x2f,%al
+ 410:	7e 0a                	jle    41c <atoi+0x48>
+ 412:	8b 45 08             	mov    0x8(%ebp),%eax
+ 415:	0f b6 00             	movzbl (%eax),%eax
+ 418:	3c 39                	cmp    $0x39,%al
+ 41a:	7e c7                	jle    3e3 <atoi+0xf>
+  return n;
+ 41c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 41f:	c9                   	leave
+ 420:	c3                   	ret
+
+00000421 <memmove>:
+{
+ 421:	55                   	push   %ebp
+ 422:	89 e5                	mov    %esp,%ebp
+ 424:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 427:	8b 45 08             	mov    0x8(%ebp),%eax
+ 42a:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 42d:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 430:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 433:	eb 17                	jmp    44c <memmove+0x2b>
+    *dst++ = *src++;
+ 435:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 438:	8d 42 01             	lea    0x1(%edx),%eax
+ 43b:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 43e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 441:	8d 48 01             	lea    0x1(%eax),%ecx
+ 444:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 447:	0f b6 12             	movzbl (%edx),%edx
+ 44a:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 44c:	8b 45 10             	mov    0x10(%ebp),%eax
+ 44f:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 452:	89 55 10             	mov    %edx,0x10(%ebp)
+ 455:	85 c0                	test   %eax,%eax
+ 457:	7f dc                	jg     435 <memmove+0x14>
+  return vdst;
+ 459:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 45c:	c9                   	leave
+ 45d:	c3                   	ret
+
+0000045e <mutex_init>:
+{
+ 45e:	55                   	push   %ebp
+ 45f:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 461:	8b 45 08             	mov    0x8(%ebp),%eax
+ 464:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 46a:	90                   	nop
+ 46b:	5d                   	pop    %ebp
+ 46c:	c3                   	ret
+
+0000046d <mutex_lock>:
+{
+ 46d:	55                   	push   %ebp
+ 46e:	89 e5                	mov    %esp,%ebp
+ 470:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 473:	8b 45 08             	mov    0x8(%ebp),%eax
+ 476:	6a 01                	push   $0x1
+ 478:	6a 00                	push   $0x0
+ 47a:	50                   	push   %eax
+ 47b:	e8 7d fd ff ff       	call   1fd <cmpxchg>
+ 480:	83 c4 0c             	add    $0xc,%esp
+ 483:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 486:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 48a:	74 46                	je     4d2 <mutex_lock+0x65>
+  if(c != 2)
+ 48c:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 490:	74 38                	je     4ca <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 492:	8b 45 08             	mov    0x8(%ebp),%eax
+ 495:	6a 02                	push   $0x2
+ 497:	50                   	push   %eax
+ 498:	e8 46 fd ff ff       	call   1e3 <xchg>
+ 49d:	83 c4 08             	add    $0x8,%esp
+ 4a0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 4a3:	eb 25                	jmp    4ca <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 4a5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4a8:	83 ec 08             	sub    $0x8,%esp
+ 4ab:	6a 02                	push   $0x2
+ 4ad:	50                   	push   %eax
+ 4ae:	e8 22 04 00 00       	call   8d5 <futex_wait>
+ 4b3:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 4b6:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4b9:	83 ec 08             	sub    $0x8,%esp
+ 4bc:	6a 02                	push   $0x2
+ 4be:	50                   	push   %eax
+ 4bf:	e8 1f fd ff ff       	call   1e3 <xchg>
+ 4c4:	83 c4 10             	add    $0x10,%esp
+ 4c7:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 4ca:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 4ce:	75 d5                	jne    4a5 <mutex_lock+0x38>
+ 4d0:	eb 01                	jmp    4d3 <mutex_lock+0x66>
+    return;
+ 4d2:	90                   	nop
+}
+ 4d3:	c9                   	leave
+ 4d4:	c3                   	ret
+
+000004d5 <mutex_unlock>:
+{
+ 4d5:	55                   	push   %ebp
+ 4d6:	89 e5                	mov    %esp,%ebp
+ 4d8:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 4db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4de:	6a 00                	push   $0x0
+ 4e0:	50                   	push   %eax
+ 4e1:	e8 fd fc ff ff       	call   1e3 <xchg>
+ 4e6:	83 c4 08             	add    $0x8,%esp
+ 4e9:	83 f8 02             	cmp    $0x2,%eax
+ 4ec:	75 11                	jne    4ff <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 4ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 4f1:	83 ec 08             	sub    $0x8,%esp
+ 4f4:	6a 01                	push   $0x1
+ 4f6:	50                   	push   %eax
+ 4f7:	e8 e3 03 00 00       	call   8df <futex_wake>
+ 4fc:	83 c4 10             	add    $0x10,%esp
+}
+ 4ff:	90                   	nop
+ 500:	c9                   	leave
+ 501:	c3                   	ret
+
+00000502 <cond_init>:
+{
+ 502:	55                   	push   %ebp
+ 503:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 505:	8b 45 08             	mov    0x8(%ebp),%eax
+ 508:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 50e:	90                   	nop
+ 50f:	5d                   	pop    %ebp
+ 510:	c3                   	ret
+
+00000511 <cond_wait>:
+{
+ 511:	55                   	push   %ebp
+ 512:	89 e5                	mov    %esp,%ebp
+ 514:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 517:	8b 45 08             	mov    0x8(%ebp),%eax
+ 51a:	8b 00                	mov    (%eax),%eax
+ 51c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 51f:	83 ec 0c             	sub    $0xc,%esp
+ 522:	ff 75 0c             	push   0xc(%ebp)
+ 525:	e8 ab ff ff ff       	call   4d5 <mutex_unlock>
+ 52a:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 52d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 530:	83 ec 08             	sub    $0x8,%esp
+ 533:	ff 75 f4             	push   -0xc(%ebp)
+ 536:	50                   	push   %eax
+ 537:	e8 99 03 00 00       	call   8d5 <futex_wait>
+ 53c:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 53f:	eb 11                	jmp    552 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 541:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 544:	83 ec 08             	sub    $0x8,%esp
+ 547:	6a 02                	push   $0x2
+ 549:	50                   	push   %eax
+ 54a:	e8 86 03 00 00       	call   8d5 <futex_wait>
+ 54f:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 552:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 555:	83 ec 08             	sub    $0x8,%esp
+ 558:	6a 02                	push   $0x2
+ 55a:	50                   	push   %eax
+ 55b:	e8 83 fc ff ff       	call   1e3 <xchg>
+ 560:	83 c4 10             	add    $0x10,%esp
+ 563:	85 c0                	test   %eax,%eax
+ 565:	75 da                	jne    541 <cond_wait+0x30>
+}
+ 567:	90                   	nop
+ 568:	90                   	nop
+ 569:	c9                   	leave
+ 56a:	c3                   	ret
+
+0000056b <condbump>:
+{
+ 56b:	55                   	push   %ebp
+ 56c:	89 e5                	mov    %esp,%ebp
+ 56e:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 571:	8b 45 08             	mov    0x8(%ebp),%eax
+ 574:	8b 00                	mov    (%eax),%eax
+ 576:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 579:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 57c:	8d 50 01             	lea    0x1(%eax),%edx
+ 57f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 582:	52                   	push   %edx
+ 583:	ff 75 fc             	push   -0x4(%ebp)
+ 586:	50                   	push   %eax
+ 587:	e8 71 fc ff ff       	call   1fd <cmpxchg>
+ 58c:	83 c4 0c             	add    $0xc,%esp
+ 58f:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 592:	75 dd                	jne    571 <condbump+0x6>
+}
+ 594:	90                   	nop
+ 595:	90                   	nop
+ 596:	c9                   	leave
+ 597:	c3                   	ret
+
+00000598 <cond_signal>:
+{
+ 598:	55                   	push   %ebp
+ 599:	89 e5                	mov    %esp,%ebp
+ 59b:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 59e:	ff 75 08             	push   0x8(%ebp)
+ 5a1:	e8 c5 ff ff ff       	call   56b <condbump>
+ 5a6:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 5a9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5ac:	83 ec 08             	sub    $0x8,%esp
+ 5af:	6a 01                	push   $0x1
+ 5b1:	50                   	push   %eax
+ 5b2:	e8 28 03 00 00       	call   8df <futex_wake>
+ 5b7:	83 c4 10             	add    $0x10,%esp
+}
+ 5ba:	90                   	nop
+ 5bb:	c9                   	leave
+ 5bc:	c3                   	ret
+
+000005bd <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 5bd:	55                   	push   %ebp
+ 5be:	89 e5                	mov    %esp,%ebp
+ 5c0:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 5c3:	ff 75 08             	push   0x8(%ebp)
+ 5c6:	e8 a0 ff ff ff       	call   56b <condbump>
+ 5cb:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d1:	83 ec 08             	sub    $0x8,%esp
+ 5d4:	68 ff ff ff 7f       	push   $0x7fffffff
+ 5d9:	50                   	push   %eax
+ 5da:	e8 00 03 00 00       	call   8df <futex_wake>
+ 5df:	83 c4 10             	add    $0x10,%esp
+}
+ 5e2:	90                   	nop
+ 5e3:	c9                   	leave
+ 5e4:	c3                   	ret
+
+000005e5 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 5e5:	55                   	push   %ebp
+ 5e6:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 5e8:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 5ed:	8b 00                	mov    (%eax),%eax
+}
+ 5ef:	5d                   	pop    %ebp
+ 5f0:	c3                   	ret
+
+000005f1 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 5f1:	55                   	push   %ebp
+ 5f2:	89 e5                	mov    %esp,%ebp
+ 5f4:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 5f7:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 5fc:	8b 00                	mov    (%eax),%eax
+ 5fe:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 601:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 605:	74 05                	je     60c <vgetpid+0x1b>
+    return pid;
+ 607:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 60a:	eb 05                	jmp    611 <vgetpid+0x20>
+  return getpid();
+ 60c:	e8 74 02 00 00       	call   885 <getpid>
+}
+ 611:	c9                   	leave
+ 612:	c3                   	ret
+
+00000613 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 613:	55                   	push   %ebp
+ 614:	89 e5                	mov    %esp,%ebp
+ 616:	57                   	push   %edi
+ 617:	56                   	push   %esi
+ 618:	53                   	push   %ebx
+ 619:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 61c:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 623:	e8 f7 fb ff ff       	call   21f <rdtsc>
+ 628:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 62b:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 62e:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 631:	29 c8                	sub    %ecx,%eax
+ 633:	19 da                	sbb    %ebx,%edx
+ 635:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 638:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 63b:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 63e:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 641:	89 d0                	mov    %edx,%eax
+ 643:	31 d2                	xor    %edx,%edx
+ 645:	89 c1                	mov    %eax,%ecx
+ 647:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 64c:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 64f:	8b 40 04             	mov    0x4(%eax),%eax
+ 652:	ba 00 00 00 00       	mov    $0x0,%edx
+ 657:	89 df                	mov    %ebx,%edi
+ 659:	0f af f8             	imul   %eax,%edi
+ 65c:	89 d6                	mov    %edx,%esi
+ 65e:	0f af f1             	imul   %ecx,%esi
+ 661:	01 f7                	add    %esi,%edi
+ 663:	f7 e1                	mul    %ecx
+ 665:	89 c1                	mov    %eax,%ecx
+ 667:	89 d3                	mov    %edx,%ebx
+ 669:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 66c:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 66e:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 671:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 674:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 677:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 67e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 681:	8b 40 04             	mov    0x4(%eax),%eax
+ 684:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 687:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 68e:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 691:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 694:	89 d7                	mov    %edx,%edi
+ 696:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 699:	0f af fe             	imul   %esi,%edi
+ 69c:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 69f:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 6a2:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 6a5:	0f af f0             	imul   %eax,%esi
+ 6a8:	01 f7                	add    %esi,%edi
+ 6aa:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 6ad:	f7 65 d8             	mull   -0x28(%ebp)
+ 6b0:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 6b3:	89 f2                	mov    %esi,%edx
+ 6b5:	89 d0                	mov    %edx,%eax
+ 6b7:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 6b9:	01 c8                	add    %ecx,%eax
+ 6bb:	11 da                	adc    %ebx,%edx
+}
+ 6bd:	83 c4 24             	add    $0x24,%esp
+ 6c0:	5b                   	pop    %ebx
+ 6c1:	5e                   	pop    %esi
+ 6c2:	5f                   	pop    %edi
+ 6c3:	5d                   	pop    %ebp
+ 6c4:	c3                   	ret
+
+000006c5 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 6c5:	55                   	push   %ebp
+ 6c6:	89 e5                	mov    %esp,%ebp
+ 6c8:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 6cb:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ce:	8b 50 04             	mov    0x4(%eax),%edx
+ 6d1:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6d4:	8b 00                	mov    (%eax),%eax
+ 6d6:	29 c2                	sub    %eax,%edx
+ 6d8:	83 fa 1f             	cmp    $0x1f,%edx
+ 6db:	76 07                	jbe    6e4 <ring_queue+0x1f>
+    return -1;
+ 6dd:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 6e2:	eb 68                	jmp    74c <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 6e4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6e7:	8b 40 04             	mov    0x4(%eax),%eax
+ 6ea:	83 e0 1f             	and    $0x1f,%eax
+ 6ed:	89 c2                	mov    %eax,%edx
+ 6ef:	89 d0                	mov    %edx,%eax
+ 6f1:	c1 e0 02             	shl    $0x2,%eax
+ 6f4:	01 d0                	add    %edx,%eax
+ 6f6:	c1 e0 02             	shl    $0x2,%eax
+ 6f9:	8d 50 10             	lea    0x10(%eax),%edx
+ 6fc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 6ff:	01 d0                	add    %edx,%eax
+ 701:	83 c0 04             	add    $0x4,%eax
+ 704:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 707:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 70a:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 70d:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 70f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 712:	8b 55 10             	mov    0x10(%ebp),%edx
+ 715:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 718:	8b 55 14             	mov    0x14(%ebp),%edx
+ 71b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 71e:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 721:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 724:	8b 55 18             	mov    0x18(%ebp),%edx
+ 727:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 72a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 72d:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 730:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 733:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 738:	8b 45 08             	mov    0x8(%ebp),%eax
+ 73b:	8b 40 04             	mov    0x4(%eax),%eax
+ 73e:	8d 50 01             	lea    0x1(%eax),%edx
+ 741:	8b 45 08             	mov    0x8(%ebp),%eax
+ 744:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 747:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 74c:	c9                   	leave
+ 74d:	c3                   	ret
+
+0000074e <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 74e:	55                   	push   %ebp
+ 74f:	89 e5                	mov    %esp,%ebp
+ 751:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 754:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 759:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 75d:	7f 1a                	jg     779 <ring_submit+0x2b>
+ 75f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 762:	8b 40 10             	mov    0x10(%eax),%eax
+ 765:	83 e0 01             	and    $0x1,%eax
+ 768:	85 c0                	test   %eax,%eax
+ 76a:	74 0d                	je     779 <ring_submit+0x2b>
+ 76c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 76f:	8b 40 10             	mov    0x10(%eax),%eax
+ 772:	83 e0 02             	and    $0x2,%eax
+ 775:	85 c0                	test   %eax,%eax
+ 777:	74 10                	je     789 <ring_submit+0x3b>
+    return ring_enter(min);
+ 779:	83 ec 0c             	sub    $0xc,%esp
+ 77c:	ff 75 0c             	push   0xc(%ebp)
+ 77f:	e8 83 01 00 00       	call   907 <ring_enter>
+ 784:	83 c4 10             	add    $0x10,%esp
+ 787:	eb 10                	jmp    799 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 789:	8b 45 08             	mov    0x8(%ebp),%eax
+ 78c:	8b 50 0c             	mov    0xc(%eax),%edx
+ 78f:	8b 45 08             	mov    0x8(%ebp),%eax
+ 792:	8b 40 08             	mov    0x8(%eax),%eax
+ 795:	29 c2                	sub    %eax,%edx
+ 797:	89 d0                	mov    %edx,%eax
+}
+ 799:	c9                   	leave
+ 79a:	c3                   	ret
+
+0000079b <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 79b:	55                   	push   %ebp
+ 79c:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 79e:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a1:	8b 50 08             	mov    0x8(%eax),%edx
+ 7a4:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7a7:	8b 40 0c             	mov    0xc(%eax),%eax
+ 7aa:	39 c2                	cmp    %eax,%edx
+ 7ac:	75 07                	jne    7b5 <ring_reap+0x1a>
+    return -1;
+ 7ae:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 7b3:	eb 3b                	jmp    7f0 <ring_reap+0x55>
+  __sync_synchronize();
+ 7b5:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 7ba:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7bd:	8b 40 08             	mov    0x8(%eax),%eax
+ 7c0:	83 e0 1f             	and    $0x1f,%eax
+ 7c3:	89 c2                	mov    %eax,%edx
+ 7c5:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 7c8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7cb:	83 c2 52             	add    $0x52,%edx
+ 7ce:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 7d2:	8b 02                	mov    (%edx),%eax
+ 7d4:	8b 52 04             	mov    0x4(%edx),%edx
+ 7d7:	89 01                	mov    %eax,(%ecx)
+ 7d9:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 7dc:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7df:	8b 40 08             	mov    0x8(%eax),%eax
+ 7e2:	8d 50 01             	lea    0x1(%eax),%edx
+ 7e5:	8b 45 08             	mov    0x8(%ebp),%eax
+ 7e8:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 7eb:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 7f0:	5d                   	pop    %ebp
+ 7f1:	c3                   	ret
+
+000007f2 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 7f2:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 7f9:	74 0a                	je     805 <usyscall+0x13>
+  movl %esp, %ecx
+ 7fb:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 7fd:	ba 04 08 00 00       	mov    $0x804,%edx
+  sysenter
+ 802:	0f 34                	sysenter
+2:
+  ret
+ 804:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 805:	cd 40                	int    $0x40
+  ret
+ 807:	c3                   	ret
+
+00000808 <fork>:
+
+SYSCALL(fork)
+ 808:	b8 01 00 00 00       	mov    $0x1,%eax
+ 80d:	eb e3                	jmp    7f2 <usyscall>
+
+0000080f <exit>:
+SYSCALL(exit)
+ 80f:	b8 02 00 00 00       	mov    $0x2,%eax
+ 814:	eb dc                	jmp    7f2 <usyscall>
+
+00000816 <wait>:
+SYSCALL(wait)
+ 816:	b8 03 00 00 00       	mov    $0x3,%eax
+ 81b:	eb d5                	jmp    7f2 <usyscall>
+
+0000081d <pipe>:
+SYSCALL(pipe)
+ 81d:	b8 04 00 00 00       	mov    $0x4,%eax
+ 822:	eb ce                	jmp    7f2 <usyscall>
+
+00000824 <read>:
+SYSCALL(read)
+ 824:	b8 05 00 00 00       	mov    $0x5,%eax
+ 829:	eb c7                	jmp    7f2 <usyscall>
+
+0000082b <write>:
+SYSCALL(write)
+ 82b:	b8 10 00 00 00       	mov    $0x10,%eax
+ 830:	eb c0                	jmp    7f2 <usyscall>
+
+00000832 <close>:
+SYSCALL(close)
+ 832:	b8 15 00 00 00       	mov    $0x15,%eax
+ 837:	eb b9                	jmp    7f2 <usyscall>
+
+00000839 <kill>:
+SYSCALL(kill)
+ 839:	b8 06 00 00 00       	mov    $0x6,%eax
+ 83e:	eb b2                	jmp    7f2 <usyscall>
+
+00000840 <exec>:
+SYSCALL(exec)
+ 840:	b8 07 00 00 00       	mov    $0x7,%eax
+ 845:	eb ab                	jmp    7f2 <usyscall>
+
+00000847 <open>:
+SYSCALL(open)
+ 847:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 84c:	eb a4                	jmp    7f2 <usyscall>
+
+0000084e <mknod>:
+SYSCALL(mknod)
+ 84e:	b8 11 00 00 00       	mov    $0x11,%eax
+ 853:	eb 9d                	jmp    7f2 <usyscall>
+
+00000855 <unlink>:
+SYSCALL(unlink)
+ 855:	b8 12 00 00 00       	mov    $0x12,%eax
+ 85a:	eb 96                	jmp    7f2 <usyscall>
+
+0000085c <fstat>:
+SYSCALL(fstat)
+ 85c:	b8 08 00 00 00       	mov    $0x8,%eax
+ 861:	eb 8f                	jmp    7f2 <usyscall>
+
+00000863 <link>:
+SYSCALL(link)
+ 863:	b8 13 00 00 00       	mov    $0x13,%eax
+ 868:	eb 88                	jmp    7f2 <usyscall>
+
+0000086a <mkdir>:
+SYSCALL(mkdir)
+ 86a:	b8 14 00 00 00       	mov    $0x14,%eax
+ 86f:	eb 81                	jmp    7f2 <usyscall>
+
+00000871 <chdir>:
+SYSCALL(chdir)
+ 871:	b8 09 00 00 00       	mov    $0x9,%eax
+ 876:	e9 77 ff ff ff       	jmp    7f2 <usyscall>
+
+0000087b <dup>:
+SYSCALL(dup)
+ 87b:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 880:	e9 6d ff ff ff       	jmp    7f2 <usyscall>
+
+00000885 <getpid>:
+SYSCALL(getpid)
+ 885:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 88a:	e9 63 ff ff ff       	jmp    7f2 <usyscall>
+
+0000088f <sbrk>:
+SYSCALL(sbrk)
+ 88f:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 894:	e9 59 ff ff ff       	jmp    7f2 <usyscall>
+
+00000899 <sleep>:
+SYSCALL(sleep)
+ 899:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 89e:	e9 4f ff ff ff       	jmp    7f2 <usyscall>
+
+000008a3 <uptime>:
+SYSCALL(uptime)
+ 8a3:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 8a8:	e9 45 ff ff ff       	jmp    7f2 <usyscall>
+
+000008ad <kmstat>:
+SYSCALL(kmstat)
+ 8ad:	b8 16 00 00 00       	mov    $0x16,%eax
+ 8b2:	e9 3b ff ff ff       	jmp    7f2 <usyscall>
+
+000008b7 <setpriority>:
+SYSCALL(setpriority)
+ 8b7:	b8 17 00 00 00       	mov    $0x17,%eax
+ 8bc:	e9 31 ff ff ff       	jmp    7f2 <usyscall>
+
+000008c1 <clone>:
+SYSCALL(clone)
+ 8c1:	b8 18 00 00 00       	mov    $0x18,%eax
+ 8c6:	e9 27 ff ff ff       	jmp    7f2 <usyscall>
+
+000008cb <join>:
+SYSCALL(join)
+ 8cb:	b8 19 00 00 00       	mov    $0x19,%eax
+ 8d0:	e9 1d ff ff ff       	jmp    7f2 <usyscall>
+
+000008d5 <futex_wait>:
+SYSCALL(futex_wait)
+ 8d5:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 8da:	e9 13 ff ff ff       	jmp    7f2 <usyscall>
+
+000008df <futex_wake>:
+SYSCALL(futex_wake)
+ 8df:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 8e4:	e9 09 ff ff ff       	jmp    7f2 <usyscall>
+
+000008e9 <lockstat>:
+SYSCALL(lockstat)
+ 8e9:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 8ee:	e9 ff fe ff ff       	jmp    7f2 <usyscall>
+
+000008f3 <sysstat>:
+SYSCALL(sysstat)
+ 8f3:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 8f8:	e9 f5 fe ff ff       	jmp    7f2 <usyscall>
+
+000008fd <ring_setup>:
+SYSCALL(ring_setup)
+ 8fd:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 902:	e9 eb fe ff ff       	jmp    7f2 <usyscall>
+
+00000907 <ring_enter>:
+SYSCALL(ring_enter)
+ 907:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 90c:	e9 e1 fe ff ff       	jmp    7f2 <usyscall>
+
+00000911 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 911:	55                   	push   %ebp
+ 912:	89 e5                	mov    %esp,%ebp
+ 914:	83 ec 18             	sub    $0x18,%esp
+ 917:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 91a:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 91d:	83 ec 04             	sub    $0x4,%esp
+ 920:	6a 01                	push   $0x1
+ 922:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 925:	50                   	push   %eax
+ 926:	ff 75 08             	push   0x8(%ebp)
+ 929:	e8 fd fe ff ff       	call   82b <write>
+ 92e:	83 c4 10             	add    $0x10,%esp
+}
+ 931:	90                   	nop
+ 932:	c9                   	leave
+ 933:	c3                   	ret
+
+00000934 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 934:	55                   	push   %ebp
+ 935:	89 e5                	mov    %esp,%ebp
+ 937:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 93a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 941:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 945:	74 17                	je     95e <printint+0x2a>
+ 947:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 94b:	79 11                	jns    95e <printint+0x2a>
+    neg = 1;
+ 94d:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 954:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 957:	f7 d8                	neg    %eax
+ 959:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 95c:	eb 06                	jmp    964 <printint+0x30>
+  } else {
+    x = xx;
+ 95e:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 961:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 964:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 96b:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 96e:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 971:	ba 00 00 00 00       	mov    $0x0,%edx
+ 976:	f7 f1                	div    %ecx
+ 978:	89 d1                	mov    %edx,%ecx
+ 97a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 97d:	8d 50 01             	lea    0x1(%eax),%edx
+ 980:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 983:	0f b6 91 3c 13 00 00 	movzbl 0x133c(%ecx),%edx
+ 98a:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 98e:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 991:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 994:	ba 00 00 00 00       	mov    $0x0,%edx
+ 999:	f7 f1                	div    %ecx
+ 99b:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 99e:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 9a2:	75 c7                	jne    96b <printint+0x37>
+  if(neg)
+ 9a4:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 9a8:	74 2d                	je     9d7 <printint+0xa3>
+    buf[i++] = '-';
+ 9aa:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9ad:	8d 50 01             	lea    0x1(%eax),%edx
+ 9b0:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 9b3:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 9b8:	eb 1d                	jmp    9d7 <printint+0xa3>
+    putc(fd, buf[i]);
+ 9ba:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 9bd:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 9c0:	01 d0                	add    %edx,%eax
+ 9c2:	0f b6 00             	movzbl (%eax),%eax
+ 9c5:	0f be c0             	movsbl %al,%eax
+ 9c8:	83 ec 08             	sub    $0x8,%esp
+ 9cb:	50                   	push   %eax
+ 9cc:	ff 75 08             	push   0x8(%ebp)
+ 9cf:	e8 3d ff ff ff       	call   911 <putc>
+ 9d4:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 9d7:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 9db:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 9df:	79 d9                	jns    9ba <printint+0x86>
+}
+ 9e1:	90                   	nop
+ 9e2:	90                   	nop
+ 9e3:	c9                   	leave
+ 9e4:	c3                   	ret
+
+000009e5 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 9e5:	55                   	push   %ebp
+ 9e6:	89 e5                	mov    %esp,%ebp
+ 9e8:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 9eb:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 9f2:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 9f5:	83 c0 04             	add    $0x4,%eax
+ 9f8:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9fb:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ a02:	e9 59 01 00 00       	jmp    b60 <printf+0x17b>
+    c = fmt[i] & 0xff;
+ a07:	8b 55 0c             	mov    0xc(%ebp),%edx
+ a0a:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ a0d:	01 d0                	add    %edx,%eax
+ a0f:	0f b6 00             	movzbl (%eax),%eax
+ a12:	0f be c0             	movsbl %al,%eax
+ a15:	25 ff 00 00 00       	and    $0xff,%eax
+ a1a:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ a1d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ a21:	75 2c                	jne    a4f <printf+0x6a>
+      if(c == '%'){
+ a23:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ a27:	75 0c                	jne    a35 <printf+0x50>
+        state = '%';
+ a29:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ a30:	e9 27 01 00 00       	jmp    b5c <printf+0x177>
+      } else {
+        putc(fd, c);
+ a35:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ a38:	0f be c0             	movsbl %al,%eax
+ a3b:	83 ec 08             	sub    $0x8,%esp
+ a3e:	50                   	push   %eax
+ a3f:	ff 75 08             	push   0x8(%ebp)
+ a42:	e8 ca fe ff ff       	call   911 <putc>
+ a47:	83 c4 10             	add    $0x10,%esp
+ a4a:	e9 0d 01 00 00       	jmp    b5c <printf+0x177>
+      }
+    } else if(state == '%'){
+ a4f:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ a53:	0f 85 03 01 00 00    	jne    b5c <printf+0x177>
+      if(c == 'd'){
+ a59:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ a5d:	75 1e                	jne    a7d <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ a5f:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a62:	8b 00                	mov    (%eax),%eax
+ a64:	6a 01                	push   $0x1
+ a66:	6a 0a                	push   $0xa
+ a68:	50                   	push   %eax
+ a69:	ff 75 08             	push   0x8(%ebp)
+ a6c:	e8 c3 fe ff ff       	call   934 <printint>
+ a71:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a74:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ a78:	e9 d8 00 00 00       	jmp    b55 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ a7d:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ a81:	74 06                	je     a89 <printf+0xa4>
+ a83:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ a87:	75 1e                	jne    aa7 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ a89:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ a8c:	8b 00                	mov    (%eax),%eax
+ a8e:	6a 00                	push   $0x0
+ a90:	6a 10                	push   $0x10
+ a92:	50                   	push   %eax
+ a93:	ff 75 08             	push   0x8(%ebp)
+ a96:	e8 99 fe ff ff       	call   934 <printint>
+ a9b:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ a9e:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ aa2:	e9 ae 00 00 00       	jmp    b55 <printf+0x170>
+      } else if(c == 's'){
+ aa7:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ aab:	75 43                	jne    af0 <printf+0x10b>
+        s = (char*)*ap;
+ aad:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ ab0:	8b 00                	mov    (%eax),%eax
+ ab2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ ab5:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ ab9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ abd:	75 25                	jne    ae4 <printf+0xff>
+          s = "(null)";
+ abf:	c7 45 f4 5c 0e 00 00 	movl   $0xe5c,-0xc(%ebp)
+        while(*s != 0){
+ ac6:	eb 1c                	jmp    ae4 <printf+0xff>
+          putc(fd, *s);
+ ac8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ acb:	0f b6 00             	movzbl (%eax),%eax
+ ace:	0f be c0             	movsbl %al,%eax
+ ad1:	83 ec 08             	sub    $0x8,%esp
+ ad4:	50                   	push   %eax
+ ad5:	ff 75 08             	push   0x8(%ebp)
+ ad8:	e8 34 fe ff ff       	call   911 <putc>
+ add:	83 c4 10             	add    $0x10,%esp
+          s++;
+ ae0:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ ae4:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ae7:	0f b6 00             	movzbl (%eax),%eax
+ aea:	84 c0                	test   %al,%al
+ aec:	75 da                	jne    ac8 <printf+0xe3>
+ aee:	eb 65                	jmp    b55 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ af0:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ af4:	75 1d                	jne    b13 <printf+0x12e>
+        putc(fd, *ap);
+ af6:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ af9:	8b 00                	mov    (%eax),%eax
+ afb:	0f be c0             	movsbl %al,%eax
+ afe:	83 ec 08             	sub    $0x8,%esp
+ b01:	50                   	push   %eax
+ b02:	ff 75 08             	push   0x8(%ebp)
+ b05:	e8 07 fe ff ff       	call   911 <putc>
+ b0a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ b0d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ b11:	eb 42                	jmp    b55 <printf+0x170>
+      } else if(c == '%'){
+ b13:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ b17:	75 17                	jne    b30 <printf+0x14b>
+        putc(fd, c);
+ b19:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b1c:	0f be c0             	movsbl %al,%eax
+ b1f:	83 ec 08             	sub    $0x8,%esp
+ b22:	50                   	push   %eax
+ b23:	ff 75 08             	push   0x8(%ebp)
+ b26:	e8 e6 fd ff ff       	call   911 <putc>
+ b2b:	83 c4 10             	add    $0x10,%esp
+ b2e:	eb 25                	jmp    b55 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ b30:	83 ec 08             	sub    $0x8,%esp
+ b33:	6a 25                	push   $0x25
+ b35:	ff 75 08             	push   0x8(%ebp)
+ b38:	e8 d4 fd ff ff       	call   911 <putc>
+ b3d:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ b40:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ b43:	0f be c0             	movsbl %al,%eax
+ b46:	83 ec 08             	sub    $0x8,%esp
+ b49:	50                   	push   %eax
+ b4a:	ff 75 08             	push   0x8(%ebp)
+ b4d:	e8 bf fd ff ff       	call   911 <putc>
+ b52:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ b55:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ b5c:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ b60:	8b 55 0c             	mov    0xc(%ebp),%edx
+ b63:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b66:	01 d0                	add    %edx,%eax
+ b68:	0f b6 00             	movzbl (%eax),%eax
+ b6b:	84 c0                	test   %al,%al
+ b6d:	0f 85 94 fe ff ff    	jne    a07 <printf+0x22>
+    }
+  }
+}
+ b73:	90                   	nop
+ b74:	90                   	nop
+ b75:	c9                   	leave
+ b76:	c3                   	ret
+
+00000b77 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ b77:	55                   	push   %ebp
+ b78:	89 e5                	mov    %esp,%ebp
+ b7a:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ b7d:	8b 45 08             	mov    0x8(%ebp),%eax
+ b80:	83 e8 08             	sub    $0x8,%eax
+ b83:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ b86:	a1 68 15 00 00       	mov    0x1568,%eax
+ b8b:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ b8e:	eb 24                	jmp    bb4 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ b90:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ b93:	8b 00                	mov    (%eax),%eax
+ b95:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ b98:	72 12                	jb     bac <free+0x35>
+ b9a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ b9d:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ ba0:	72 24                	jb     bc6 <free+0x4f>
+ ba2:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ba5:	8b 00                	mov    (%eax),%eax
+ ba7:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ baa:	72 1a                	jb     bc6 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ bac:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ baf:	8b 00                	mov    (%eax),%eax
+ bb1:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ bb4:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bb7:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ bba:	73 d4                	jae    b90 <free+0x19>
+ bbc:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bbf:	8b 00                	mov    (%eax),%eax
+ bc1:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ bc4:	73 ca                	jae    b90 <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ bc6:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bc9:	8b 40 04             	mov    0x4(%eax),%eax
+ bcc:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ bd3:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bd6:	01 c2                	add    %eax,%edx
+ bd8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bdb:	8b 00                	mov    (%eax),%eax
+ bdd:	39 c2                	cmp    %eax,%edx
+ bdf:	75 24                	jne    c05 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ be1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ be4:	8b 50 04             	mov    0x4(%eax),%edx
+ be7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bea:	8b 00                	mov    (%eax),%eax
+ bec:	8b 40 04             	mov    0x4(%eax),%eax
+ bef:	01 c2                	add    %eax,%edx
+ bf1:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ bf4:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ bf7:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ bfa:	8b 00                	mov    (%eax),%eax
+ bfc:	8b 10                	mov    (%eax),%edx
+ bfe:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c01:	89 10                	mov    %edx,(%eax)
+ c03:	eb 0a                	jmp    c0f <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ c05:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c08:	8b 10                	mov    (%eax),%edx
+ c0a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c0d:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ c0f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c12:	8b 40 04             	mov    0x4(%eax),%eax
+ c15:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ c1c:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c1f:	01 d0                	add    %edx,%eax
+ c21:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ c24:	75 20                	jne    c46 <free+0xcf>
+    p->s.size += bp->s.size;
+ c26:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c29:	8b 50 04             	mov    0x4(%eax),%edx
+ c2c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c2f:	8b 40 04             	mov    0x4(%eax),%eax
+ c32:	01 c2                	add    %eax,%edx
+ c34:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c37:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ c3a:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ c3d:	8b 10                	mov    (%eax),%edx
+ c3f:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c42:	89 10                	mov    %edx,(%eax)
+ c44:	eb 08                	jmp    c4e <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ c46:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c49:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ c4c:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ c4e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ c51:	a3 68 15 00 00       	mov    %eax,0x1568
+}
+ c56:	90                   	nop
+ c57:	c9                   	leave
+ c58:	c3                   	ret
+
+00000c59 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ c59:	55                   	push   %ebp
+ c5a:	89 e5                	mov    %esp,%ebp
+ c5c:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ c5f:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ c66:	77 07                	ja     c6f <morecore+0x16>
+    nu = 4096;
+ c68:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ c6f:	8b 45 08             	mov    0x8(%ebp),%eax
+ c72:	c1 e0 03             	shl    $0x3,%eax
+ c75:	83 ec 0c             	sub    $0xc,%esp
+ c78:	50                   	push   %eax
+ c79:	e8 11 fc ff ff       	call   88f <sbrk>
+ c7e:	83 c4 10             	add    $0x10,%esp
+ c81:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ c84:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ c88:	75 07                	jne    c91 <morecore+0x38>
+    return 0;
+ c8a:	b8 00 00 00 00       	mov    $0x0,%eax
+ c8f:	eb 26                	jmp    cb7 <morecore+0x5e>
+  hp = (Header*)p;
+ c91:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ c94:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ c97:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c9a:	8b 55 08             	mov    0x8(%ebp),%edx
+ c9d:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ ca0:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ca3:	83 c0 08             	add    $0x8,%eax
+ ca6:	83 ec 0c             	sub    $0xc,%esp
+ ca9:	50                   	push   %eax
+ caa:	e8 c8 fe ff ff       	call   b77 <free>
+ caf:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ cb2:	a1 68 15 00 00       	mov    0x1568,%eax
+}
+ cb7:	c9                   	leave
+ cb8:	c3                   	ret
+
+00000cb9 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ cb9:	55                   	push   %ebp
+ cba:	89 e5                	mov    %esp,%ebp
+ cbc:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ cbf:	8b 45 08             	mov    0x8(%ebp),%eax
+ cc2:	83 c0 07             	add    $0x7,%eax
+ cc5:	c1 e8 03             	shr    $0x3,%eax
+ cc8:	83 c0 01             	add    $0x1,%eax
+ ccb:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ cce:	a1 68 15 00 00       	mov    0x1568,%eax
+ cd3:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ cd6:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ cda:	75 23                	jne    cff <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ cdc:	c7 45 f0 60 15 00 00 	movl   $0x1560,-0x10(%ebp)
+ ce3:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ ce6:	a3 68 15 00 00       	mov    %eax,0x1568
+ ceb:	a1 68 15 00 00       	mov    0x1568,%eax
+ cf0:	a3 60 15 00 00       	mov    %eax,0x1560
+    base.s.size = 0;
+ cf5:	c7 05 64 15 00 00 00 	movl   $0x0,0x1564
+ cfc:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ cff:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d02:	8b 00                	mov    (%eax),%eax
+ d04:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d07:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d0a:	8b 40 04             	mov    0x4(%eax),%eax
+ d0d:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ d10:	72 4d                	jb     d5f <malloc+0xa6>
+      if(p->s.size == nunits)
+ d12:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d15:	8b 40 04             	mov    0x4(%eax),%eax
+ d18:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ d1b:	75 0c                	jne    d29 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ d1d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d20:	8b 10                	mov    (%eax),%edx
+ d22:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d25:	89 10                	mov    %edx,(%eax)
+ d27:	eb 26                	jmp    d4f <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ d29:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d2c:	8b 40 04             	mov    0x4(%eax),%eax
+ d2f:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ d32:	89 c2                	mov    %eax,%edx
+ d34:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d37:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ d3a:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d3d:	8b 40 04             	mov    0x4(%eax),%eax
+ d40:	c1 e0 03             	shl    $0x3,%eax
+ d43:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ d46:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d49:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ d4c:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ d4f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ d52:	a3 68 15 00 00       	mov    %eax,0x1568
+      return (void*)(p + 1);
+ d57:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d5a:	83 c0 08             	add    $0x8,%eax
+ d5d:	eb 3b                	jmp    d9a <malloc+0xe1>
+    }
+    if(p == freep)
+ d5f:	a1 68 15 00 00       	mov    0x1568,%eax
+ d64:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ d67:	75 1e                	jne    d87 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ d69:	83 ec 0c             	sub    $0xc,%esp
+ d6c:	ff 75 ec             	push   -0x14(%ebp)
+ d6f:	e8 e5 fe ff ff       	call   c59 <morecore>
+ d74:	83 c4 10             	add    $0x10,%esp
+ d77:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ d7a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ d7e:	75 07                	jne    d87 <malloc+0xce>
+        return 0;
+ d80:	b8 00 00 00 00       	mov    $0x0,%eax
+ d85:	eb 13                	jmp    d9a <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ d87:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d8a:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ d8d:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ d90:	8b 00                	mov    (%eax),%eax
+ d92:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ d95:	e9 6d ff ff ff       	jmp    d07 <malloc+0x4e>
+  }
+}
+ d9a:	c9                   	leave
+ d9b:	c3                   	ret
+
+00000d9c <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ d9c:	55                   	push   %ebp
+ d9d:	89 e5                	mov    %esp,%ebp
+ d9f:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ da2:	83 ec 0c             	sub    $0xc,%esp
+ da5:	68 00 10 00 00       	push   $0x1000
+ daa:	e8 0a ff ff ff       	call   cb9 <malloc>
+ daf:	83 c4 10             	add    $0x10,%esp
+ db2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ db5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ db9:	75 07                	jne    dc2 <thread_create+0x26>
+    return -1;
+ dbb:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ dc0:	eb 2e                	jmp    df0 <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ dc2:	83 ec 04             	sub    $0x4,%esp
+ dc5:	ff 75 f4             	push   -0xc(%ebp)
+ dc8:	ff 75 0c             	push   0xc(%ebp)
+ dcb:	ff 75 08             	push   0x8(%ebp)
+ dce:	e8 ee fa ff ff       	call   8c1 <clone>
+ dd3:	83 c4 10             	add    $0x10,%esp
+ dd6:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ dd9:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ ddd:	79 0e                	jns    ded <thread_create+0x51>
+    free(stack);
+ ddf:	83 ec 0c             	sub    $0xc,%esp
+ de2:	ff 75 f4             	push   -0xc(%ebp)
+ de5:	e8 8d fd ff ff       	call   b77 <free>
+ dea:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ ded:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ df0:	c9                   	leave
+ df1:	c3                   	ret
+
+00000df2 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ df2:	55                   	push   %ebp
+ df3:	89 e5                	mov    %esp,%ebp
+ df5:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ df8:	83 ec 0c             	sub    $0xc,%esp
+ dfb:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ dfe:	50                   	push   %eax
+ dff:	e8 c7 fa ff ff       	call   8cb <join>
+ e04:	83 c4 10             	add    $0x10,%esp
+ e07:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ e0a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ e0e:	78 0f                	js     e1f <thread_join+0x2d>
+    free(stack);
+ e10:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ e13:	83 ec 0c             	sub    $0xc,%esp
+ e16:	50                   	push   %eax
+ e17:	e8 5b fd ff ff       	call   b77 <free>
+ e1c:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ e1f:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ e22:	c9                   	leave
+ e23:	c3                   	ret
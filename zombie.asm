@@ -0,0 +1,1757 @@
+
+_zombie:     file format elf32-i386
+
+
+Disassembly of section .text:
+
+00000000 <main>:
+#include "stat.h"
+#include "user.h"
+
+int
+main(void)
+{
+   0:	8d 4c 24 04          	lea    0x4(%esp),%ecx
+   4:	83 e4 f0             	and    $0xfffffff0,%esp
+   7:	ff 71 fc             	push   -0x4(%ecx)
+   a:	55                   	push   %ebp
+   b:	89 e5                	mov    %esp,%ebp
+   d:	51                   	push   %ecx
+   e:	83 ec 04             	sub    $0x4,%esp
+  if(fork() > 0)
+  11:	e8 61 06 00 00       	call   677 <fork>
+  16:	85 c0                	test   %eax,%eax
+  18:	7e 0d                	jle    27 <main+0x27>
+    sleep(5);  // Let child exit before parent.
+  1a:	83 ec 0c             	sub    $0xc,%esp
+  1d:	6a 05                	push   $0x5
+  1f:	e8 e4 06 00 00       	call   708 <sleep>
+  24:	83 c4 10             	add    $0x10,%esp
+  exit();
+  27:	e8 52 06 00 00       	call   67e <exit>
+
+0000002c <stosb>:
+memset(void *dst, int c, uint n)
+{
+  stosb(dst, c, n);
+  return dst;
+}
+
+  2c:	55                   	push   %ebp
+  2d:	89 e5                	mov    %esp,%ebp
+  2f:	57                   	push   %edi
+  30:	53                   	push   %ebx
+char*
+  31:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  34:	8b 55 10             	mov    0x10(%ebp),%edx
+  37:	8b 45 0c             	mov    0xc(%ebp),%eax
+  3a:	89 cb                	mov    %ecx,%ebx
+  3c:	89 df                	mov    %ebx,%edi
+  3e:	89 d1                	mov    %edx,%ecx
+  40:	fc                   	cld
+  41:	f3 aa                	rep stos %al,%es:(%edi)
+  43:	89 ca                	mov    %ecx,%edx
+  45:	89 fb                	mov    %edi,%ebx
+  47:	89 5d 08             	mov    %ebx,0x8(%ebp)
+  4a:	89 55 10             	mov    %edx,0x10(%ebp)
+strchr(const char *s, char c)
+{
+  for(; *s; s++)
+    if(*s == c)
+  4d:	90                   	nop
+  4e:	5b                   	pop    %ebx
+  4f:	5f                   	pop    %edi
+  50:	5d                   	pop    %ebp
+  51:	c3                   	ret
+
+00000052 <xchg>:
+  if(c != 2)
+    c = xchg(&m->state, 2);
+  while(c != 0){
+    futex_wait((uint*)&m->state, 2);
+    c = xchg(&m->state, 2);
+  }
+  52:	55                   	push   %ebp
+  53:	89 e5                	mov    %esp,%ebp
+  55:	83 ec 10             	sub    $0x10,%esp
+}
+
+void
+mutex_unlock(struct mutex *m)
+  58:	8b 55 08             	mov    0x8(%ebp),%edx
+  5b:	8b 45 0c             	mov    0xc(%ebp),%eax
+  5e:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  61:	f0 87 02             	lock xchg %eax,(%edx)
+  64:	89 45 fc             	mov    %eax,-0x4(%ebp)
+{
+  if(xchg(&m->state, 0) == 2)
+    futex_wake((uint*)&m->state, 1);
+}
+  67:	8b 45 fc             	mov    -0x4(%ebp),%eax
+
+  6a:	c9                   	leave
+  6b:	c3                   	ret
+
+0000006c <cmpxchg>:
+void
+cond_init(struct cond *c)
+{
+  c->seq = 0;
+}
+
+  6c:	55                   	push   %ebp
+  6d:	89 e5                	mov    %esp,%ebp
+  6f:	53                   	push   %ebx
+  70:	83 ec 10             	sub    $0x10,%esp
+// Release m, wait for a signal, and take m again.
+// Wakeups may be spurious, so check the condition in a loop.
+void
+  73:	8b 5d 08             	mov    0x8(%ebp),%ebx
+  76:	8b 55 10             	mov    0x10(%ebp),%edx
+  79:	8b 45 0c             	mov    0xc(%ebp),%eax
+  7c:	8b 4d 08             	mov    0x8(%ebp),%ecx
+  7f:	f0 0f b1 13          	lock cmpxchg %edx,(%ebx)
+  83:	89 45 f8             	mov    %eax,-0x8(%ebp)
+cond_wait(struct cond *c, struct mutex *m)
+{
+  uint seq;
+
+  86:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  seq = c->seq;
+  89:	8b 5d fc             	mov    -0x4(%ebp),%ebx
+  8c:	c9                   	leave
+  8d:	c3                   	ret
+
+0000008e <rdtsc>:
+  uint seq;
+
+  do
+    seq = c->seq;
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+}
+  8e:	55                   	push   %ebp
+  8f:	89 e5                	mov    %esp,%ebp
+  91:	83 ec 10             	sub    $0x10,%esp
+
+void
+cond_signal(struct cond *c)
+  94:	0f 31                	rdtsc
+  96:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  99:	89 55 fc             	mov    %edx,-0x4(%ebp)
+{
+  9c:	8b 45 f8             	mov    -0x8(%ebp),%eax
+  9f:	8b 55 fc             	mov    -0x4(%ebp),%edx
+  condbump(c);
+  a2:	c9                   	leave
+  a3:	c3                   	ret
+
+000000a4 <strcpy>:
+{
+  a4:	55                   	push   %ebp
+  a5:	89 e5                	mov    %esp,%ebp
+  a7:	83 ec 10             	sub    $0x10,%esp
+  os = s;
+  aa:	8b 45 08             	mov    0x8(%ebp),%eax
+  ad:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while((*s++ = *t++) != 0)
+  b0:	90                   	nop
+  b1:	8b 55 0c             	mov    0xc(%ebp),%edx
+  b4:	8d 42 01             	lea    0x1(%edx),%eax
+  b7:	89 45 0c             	mov    %eax,0xc(%ebp)
+  ba:	8b 45 08             	mov    0x8(%ebp),%eax
+  bd:	8d 48 01             	lea    0x1(%eax),%ecx
+  c0:	89 4d 08             	mov    %ecx,0x8(%ebp)
+  c3:	0f b6 12             	movzbl (%edx),%edx
+  c6:	88 10                	mov    %dl,(%eax)
+  c8:	0f b6 00             	movzbl (%eax),%eax
+  cb:	84 c0                	test   %al,%al
+  cd:	75 e2                	jne    b1 <strcpy+0xd>
+  return os;
+  cf:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+  d2:	c9                   	leave
+  d3:	c3                   	ret
+
+000000d4 <strcmp>:
+{
+  d4:	55                   	push   %ebp
+  d5:	89 e5                	mov    %esp,%ebp
+  while(*p && *p == *q)
+  d7:	eb 08                	jmp    e1 <strcmp+0xd>
+    p++, q++;
+  d9:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+  dd:	83 45 0c 01          	addl   $0x1,0xc(%ebp)
+  while(*p && *p == *q)
+  e1:	8b 45 08             	mov    0x8(%ebp),%eax
+  e4:	0f b6 00             	movzbl (%eax),%eax
+  e7:	84 c0                	test   %al,%al
+  e9:	74 10                	je     fb <strcmp+0x27>
+  eb:	8b 45 08             	mov    0x8(%ebp),%eax
+  ee:	0f b6 10             	movzbl (%eax),%edx
+  f1:	8b 45 0c             	mov    0xc(%ebp),%eax
+  f4:	0f b6 00             	movzbl (%eax),%eax
+  f7:	38 c2                	cmp    %al,%dl
+  f9:	74 de                	je     d9 <strcmp+0x5>
+  return (uchar)*p - (uchar)*q;
+  fb:	8b 45 08             	mov    0x8(%ebp),%eax
+  fe:	0f b6 00             	movzbl (%eax),%eax
+ 101:	0f b6 d0             	movzbl %al,%edx
+ 104:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 107:	0f b6 00             	movzbl (%eax),%eax
+ 10a:	0f b6 c0             	movzbl %al,%eax
+ 10d:	29 c2                	sub    %eax,%edx
+ 10f:	89 d0                	mov    %edx,%eax
+}
+ 111:	5d                   	pop    %ebp
+ 112:	c3                   	ret
+
+00000113 <strlen>:
+{
+ 113:	55                   	push   %ebp
+ 114:	89 e5                	mov    %esp,%ebp
+ 116:	83 ec 10             	sub    $0x10,%esp
+  for(n = 0; s[n]; n++)
+ 119:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+ 120:	eb 04                	jmp    126 <strlen+0x13>
+ 122:	83 45 fc 01          	addl   $0x1,-0x4(%ebp)
+ 126:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 129:	8b 45 08             	mov    0x8(%ebp),%eax
+ 12c:	01 d0                	add    %edx,%eax
+ 12e:	0f b6 00             	movzbl (%eax),%eax
+ 131:	84 c0                	test   %al,%al
+ 133:	75 ed                	jne    122 <strlen+0xf>
+  return n;
+ 135:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 138:	c9                   	leave
+ 139:	c3                   	ret
+
+0000013a <memset>:
+{
+ 13a:	55                   	push   %ebp
+ 13b:	89 e5                	mov    %esp,%ebp
+  stosb(dst, c, n);
+ 13d:	8b 45 10             	mov    0x10(%ebp),%eax
+ 140:	50                   	push   %eax
+ 141:	ff 75 0c             	push   0xc(%ebp)
+ 144:	ff 75 08             	push   0x8(%ebp)
+ 147:	e8 e0 fe ff ff       	call   2c <stosb>
+ 14c:	83 c4 0c             	add    $0xc,%esp
+  return dst;
+ 14f:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 152:	c9                   	leave
+ 153:	c3                   	ret
+
+00000154 <strchr>:
+{
+ 154:	55                   	push   %ebp
+ 155:	89 e5                	mov    %esp,%ebp
+ 157:	83 ec 04             	sub    $0x4,%esp
+ 15a:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 15d:	88 45 fc             	mov    %al,-0x4(%ebp)
+  for(; *s; s++)
+ 160:	eb 14                	jmp    176 <strchr+0x22>
+    if(*s == c)
+ 162:	8b 45 08             	mov    0x8(%ebp),%eax
+ 165:	0f b6 00             	movzbl (%eax),%eax
+ 168:	38 45 fc             	cmp    %al,-0x4(%ebp)
+ 16b:	75 05                	jne    172 <strchr+0x1e>
+      return (char*)s;
+ 16d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 170:	eb 13                	jmp    185 <strchr+0x31>
+  for(; *s; s++)
+ 172:	83 45 08 01          	addl   $0x1,0x8(%ebp)
+ 176:	8b 45 08             	mov    0x8(%ebp),%eax
+ 179:	0f b6 00             	movzbl (%eax),%eax
+ 17c:	84 c0                	test   %al,%al
+ 17e:	75 e2                	jne    162 <strchr+0xe>
+  return 0;
+ 180:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 185:	c9                   	leave
+ 186:	c3                   	ret
+
+00000187 <gets>:
+{
+ 187:	55                   	push   %ebp
+ 188:	89 e5                	mov    %esp,%ebp
+ 18a:	83 ec 18             	sub    $0x18,%esp
+  for(i=0; i+1 < max; ){
+ 18d:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+ 194:	eb 42                	jmp    1d8 <gets+0x51>
+    cc = read(0, &c, 1);
+ 196:	83 ec 04             	sub    $0x4,%esp
+ 199:	6a 01                	push   $0x1
+ 19b:	8d 45 ef             	lea    -0x11(%ebp),%eax
+ 19e:	50                   	push   %eax
+ 19f:	6a 00                	push   $0x0
+ 1a1:	e8 ed 04 00 00       	call   693 <read>
+ 1a6:	83 c4 10             	add    $0x10,%esp
+ 1a9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+    if(cc < 1)
+ 1ac:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 1b0:	7e 33                	jle    1e5 <gets+0x5e>
+    buf[i++] = c;
+ 1b2:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1b5:	8d 50 01             	lea    0x1(%eax),%edx
+ 1b8:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 1bb:	89 c2                	mov    %eax,%edx
+ 1bd:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1c0:	01 c2                	add    %eax,%edx
+ 1c2:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1c6:	88 02                	mov    %al,(%edx)
+    if(c == '\n' || c == '\r')
+ 1c8:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1cc:	3c 0a                	cmp    $0xa,%al
+ 1ce:	74 16                	je     1e6 <gets+0x5f>
+ 1d0:	0f b6 45 ef          	movzbl -0x11(%ebp),%eax
+ 1d4:	3c 0d                	cmp    $0xd,%al
+ 1d6:	74 0e                	je     1e6 <gets+0x5f>
+  for(i=0; i+1 < max; ){
+ 1d8:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 1db:	83 c0 01             	add    $0x1,%eax
+ 1de:	39 45 0c             	cmp    %eax,0xc(%ebp)
+ 1e1:	7f b3                	jg     196 <gets+0xf>
+ 1e3:	eb 01                	jmp    1e6 <gets+0x5f>
+      break;
+ 1e5:	90                   	nop
+  buf[i] = '\0';
+ 1e6:	8b 55 f4             	mov    -0xc(%ebp),%edx
+ 1e9:	8b 45 08             	mov    0x8(%ebp),%eax
+ 1ec:	01 d0                	add    %edx,%eax
+ 1ee:	c6 00 00             	movb   $0x0,(%eax)
+  return buf;
+ 1f1:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 1f4:	c9                   	leave
+ 1f5:	c3                   	ret
+
+000001f6 <stat>:
+{
+ 1f6:	55                   	push   %ebp
+ 1f7:	89 e5                	mov    %esp,%ebp
+ 1f9:	83 ec 18             	sub    $0x18,%esp
+  fd = open(n, O_RDONLY);
+ 1fc:	83 ec 08             	sub    $0x8,%esp
+ 1ff:	6a 00                	push   $0x0
+ 201:	ff 75 08             	push   0x8(%ebp)
+ 204:	e8 ad 04 00 00       	call   6b6 <open>
+ 209:	83 c4 10             	add    $0x10,%esp
+ 20c:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(fd < 0)
+ 20f:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 213:	79 07                	jns    21c <stat+0x26>
+    return -1;
+ 215:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 21a:	eb 25                	jmp    241 <stat+0x4b>
+  r = fstat(fd, st);
+ 21c:	83 ec 08             	sub    $0x8,%esp
+ 21f:	ff 75 0c             	push   0xc(%ebp)
+ 222:	ff 75 f4             	push   -0xc(%ebp)
+ 225:	e8 a1 04 00 00       	call   6cb <fstat>
+ 22a:	83 c4 10             	add    $0x10,%esp
+ 22d:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  close(fd);
+ 230:	83 ec 0c             	sub    $0xc,%esp
+ 233:	ff 75 f4             	push   -0xc(%ebp)
+ 236:	e8 66 04 00 00       	call   6a1 <close>
+ 23b:	83 c4 10             	add    $0x10,%esp
+  return r;
+ 23e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ 241:	c9                   	leave
+ 242:	c3                   	ret
+
+00000243 <atoi>:
+{
+ 243:	55                   	push   %ebp
+ 244:	89 e5                	mov    %esp,%ebp
+ 246:	83 ec 10             	sub    $0x10,%esp
+  n = 0;
+ 249:	c7 45 fc 00 00 00 00 	movl   $0x0,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 250:	eb 25                	jmp    277 <atoi+0x34>
+    n = n*10 + *s++ - '0';
+ 252:	8b 55 fc             	mov    -0x4(%ebp),%edx
+ 255:	89 d0                	mov    %edx,%eax
+ 257:	c1 e0 02             	shl    $0x2,%eax
+ 25a:	01 d0                	add    %edx,%eax
+ 25c:	01 c0                	add    %eax,%eax
+ 25e:	89 c1                	mov    %eax,%ecx
+ 260:	8b 45 08             	mov    0x8(%ebp),%eax
+ 263:	8d 50 01             	lea    0x1(%eax),%edx
+ 266:	89 55 08             	mov    %edx,0x8(%ebp)
+ 269:	0f b6 00             	movzbl (%eax),%eax
+ 26c:	0f be c0             	movsbl %al,%eax
+ 26f:	01 c8                	add    %ecx,%eax
+ 271:	83 e8 30             	sub    $0x30,%eax
+ 274:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while('0' <= *s && *s <= '9')
+ 277:	8b 45 08             	mov    0x8(%ebp),%eax
+ 27a:	0f b6 00             	movzbl (%eax),%eax
+ 27d:	3c 2f                	cmp    $0x2f,%al
+ 27f:	7e 0a                	jle    28b <atoi+0x48>
+ 281:	8b 45 08             	mov    0x8(%ebp),%eax
+ 284:	0f b6 00             	movzbl (%eax),%eax
+ 287:	3c 39                	cmp    $0x39,%al
+ 289:	7e c7                	jle    252 <atoi+0xf>
+  return n;
+ 28b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+}
+ 28e:	c9                   	leave
+ 28f:	c3                   	ret
+
+00000290 <memmove>:
+{
+ 290:	55                   	push   %ebp
+ 291:	89 e5                	mov    %esp,%ebp
+ 293:	83 ec 10             	sub    $0x10,%esp
+  dst = vdst;
+ 296:	8b 45 08             	mov    0x8(%ebp),%eax
+ 299:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  src = vsrc;
+ 29c:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 29f:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  while(n-- > 0)
+ 2a2:	eb 17                	jmp    2bb <memmove+0x2b>
+    *dst++ = *src++;
+ 2a4:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ 2a7:	8d 42 01             	lea    0x1(%edx),%eax
+ 2aa:	89 45 f8             	mov    %eax,-0x8(%ebp)
+ 2ad:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 2b0:	8d 48 01             	lea    0x1(%eax),%ecx
+ 2b3:	89 4d fc             	mov    %ecx,-0x4(%ebp)
+ 2b6:	0f b6 12             	movzbl (%edx),%edx
+ 2b9:	88 10                	mov    %dl,(%eax)
+  while(n-- > 0)
+ 2bb:	8b 45 10             	mov    0x10(%ebp),%eax
+ 2be:	8d 50 ff             	lea    -0x1(%eax),%edx
+ 2c1:	89 55 10             	mov    %edx,0x10(%ebp)
+ 2c4:	85 c0                	test   %eax,%eax
+ 2c6:	7f dc                	jg     2a4 <memmove+0x14>
+  return vdst;
+ 2c8:	8b 45 08             	mov    0x8(%ebp),%eax
+}
+ 2cb:	c9                   	leave
+ 2cc:	c3                   	ret
+
+000002cd <mutex_init>:
+{
+ 2cd:	55                   	push   %ebp
+ 2ce:	89 e5                	mov    %esp,%ebp
+  m->state = 0;
+ 2d0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2d3:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 2d9:	90                   	nop
+ 2da:	5d                   	pop    %ebp
+ 2db:	c3                   	ret
+
+000002dc <mutex_lock>:
+{
+ 2dc:	55                   	push   %ebp
+ 2dd:	89 e5                	mov    %esp,%ebp
+ 2df:	83 ec 18             	sub    $0x18,%esp
+  if((c = cmpxchg(&m->state, 0, 1)) == 0)
+ 2e2:	8b 45 08             	mov    0x8(%ebp),%eax
+ 2e5:	6a 01                	push   $0x1
+ 2e7:	6a 00                	push   $0x0
+ 2e9:	50                   	push   %eax
+ 2ea:	e8 7d fd ff ff       	call   6c <cmpxchg>
+ 2ef:	83 c4 0c             	add    $0xc,%esp
+ 2f2:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 2f5:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 2f9:	74 46                	je     341 <mutex_lock+0x65>
+  if(c != 2)
+ 2fb:	83 7d f4 02          	cmpl   $0x2,-0xc(%ebp)
+ 2ff:	74 38                	je     339 <mutex_lock+0x5d>
+    c = xchg(&m->state, 2);
+ 301:	8b 45 08             	mov    0x8(%ebp),%eax
+ 304:	6a 02                	push   $0x2
+ 306:	50                   	push   %eax
+ 307:	e8 46 fd ff ff       	call   52 <xchg>
+ 30c:	83 c4 08             	add    $0x8,%esp
+ 30f:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 312:	eb 25                	jmp    339 <mutex_lock+0x5d>
+    futex_wait((uint*)&m->state, 2);
+ 314:	8b 45 08             	mov    0x8(%ebp),%eax
+ 317:	83 ec 08             	sub    $0x8,%esp
+ 31a:	6a 02                	push   $0x2
+ 31c:	50                   	push   %eax
+ 31d:	e8 22 04 00 00       	call   744 <futex_wait>
+ 322:	83 c4 10             	add    $0x10,%esp
+    c = xchg(&m->state, 2);
+ 325:	8b 45 08             	mov    0x8(%ebp),%eax
+ 328:	83 ec 08             	sub    $0x8,%esp
+ 32b:	6a 02                	push   $0x2
+ 32d:	50                   	push   %eax
+ 32e:	e8 1f fd ff ff       	call   52 <xchg>
+ 333:	83 c4 10             	add    $0x10,%esp
+ 336:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  while(c != 0){
+ 339:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 33d:	75 d5                	jne    314 <mutex_lock+0x38>
+ 33f:	eb 01                	jmp    342 <mutex_lock+0x66>
+    return;
+ 341:	90                   	nop
+}
+ 342:	c9                   	leave
+ 343:	c3                   	ret
+
+00000344 <mutex_unlock>:
+{
+ 344:	55                   	push   %ebp
+ 345:	89 e5                	mov    %esp,%ebp
+ 347:	83 ec 08             	sub    $0x8,%esp
+  if(xchg(&m->state, 0) == 2)
+ 34a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 34d:	6a 00                	push   $0x0
+ 34f:	50                   	push   %eax
+ 350:	e8 fd fc ff ff       	call   52 <xchg>
+ 355:	83 c4 08             	add    $0x8,%esp
+ 358:	83 f8 02             	cmp    $0x2,%eax
+ 35b:	75 11                	jne    36e <mutex_unlock+0x2a>
+    futex_wake((uint*)&m->state, 1);
+ 35d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 360:	83 ec 08             	sub    $0x8,%esp
+ 363:	6a 01                	push   $0x1
+ 365:	50                   	push   %eax
+ 366:	e8 e3 03 00 00       	call   74e <futex_wake>
+ 36b:	83 c4 10             	add    $0x10,%esp
+}
+ 36e:	90                   	nop
+ 36f:	c9                   	leave
+ 370:	c3                   	ret
+
+00000371 <cond_init>:
+{
+ 371:	55                   	push   %ebp
+ 372:	89 e5                	mov    %esp,%ebp
+  c->seq = 0;
+ 374:	8b 45 08             	mov    0x8(%ebp),%eax
+ 377:	c7 00 00 00 00 00    	movl   $0x0,(%eax)
+}
+ 37d:	90                   	nop
+ 37e:	5d                   	pop    %ebp
+ 37f:	c3                   	ret
+
+00000380 <cond_wait>:
+{
+ 380:	55                   	push   %ebp
+ 381:	89 e5                	mov    %esp,%ebp
+ 383:	83 ec 18             	sub    $0x18,%esp
+  seq = c->seq;
+ 386:	8b 45 08             	mov    0x8(%ebp),%eax
+ 389:	8b 00                	mov    (%eax),%eax
+ 38b:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  mutex_unlock(m);
+ 38e:	83 ec 0c             	sub    $0xc,%esp
+ 391:	ff 75 0c             	push   0xc(%ebp)
+ 394:	e8 ab ff ff ff       	call   344 <mutex_unlock>
+ 399:	83 c4 10             	add    $0x10,%esp
+  futex_wait((uint*)&c->seq, seq);
+ 39c:	8b 45 08             	mov    0x8(%ebp),%eax
+ 39f:	83 ec 08             	sub    $0x8,%esp
+ 3a2:	ff 75 f4             	push   -0xc(%ebp)
+ 3a5:	50                   	push   %eax
+ 3a6:	e8 99 03 00 00       	call   744 <futex_wait>
+ 3ab:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3ae:	eb 11                	jmp    3c1 <cond_wait+0x41>
+    futex_wait((uint*)&m->state, 2);
+ 3b0:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3b3:	83 ec 08             	sub    $0x8,%esp
+ 3b6:	6a 02                	push   $0x2
+ 3b8:	50                   	push   %eax
+ 3b9:	e8 86 03 00 00       	call   744 <futex_wait>
+ 3be:	83 c4 10             	add    $0x10,%esp
+  while(xchg(&m->state, 2) != 0)
+ 3c1:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 3c4:	83 ec 08             	sub    $0x8,%esp
+ 3c7:	6a 02                	push   $0x2
+ 3c9:	50                   	push   %eax
+ 3ca:	e8 83 fc ff ff       	call   52 <xchg>
+ 3cf:	83 c4 10             	add    $0x10,%esp
+ 3d2:	85 c0                	test   %eax,%eax
+ 3d4:	75 da                	jne    3b0 <cond_wait+0x30>
+}
+ 3d6:	90                   	nop
+ 3d7:	90                   	nop
+ 3d8:	c9                   	leave
+ 3d9:	c3                   	ret
+
+000003da <condbump>:
+{
+ 3da:	55                   	push   %ebp
+ 3db:	89 e5                	mov    %esp,%ebp
+ 3dd:	83 ec 10             	sub    $0x10,%esp
+    seq = c->seq;
+ 3e0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3e3:	8b 00                	mov    (%eax),%eax
+ 3e5:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  while(cmpxchg(&c->seq, seq, seq + 1) != seq);
+ 3e8:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 3eb:	8d 50 01             	lea    0x1(%eax),%edx
+ 3ee:	8b 45 08             	mov    0x8(%ebp),%eax
+ 3f1:	52                   	push   %edx
+ 3f2:	ff 75 fc             	push   -0x4(%ebp)
+ 3f5:	50                   	push   %eax
+ 3f6:	e8 71 fc ff ff       	call   6c <cmpxchg>
+ 3fb:	83 c4 0c             	add    $0xc,%esp
+ 3fe:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ 401:	75 dd                	jne    3e0 <condbump+0x6>
+}
+ 403:	90                   	nop
+ 404:	90                   	nop
+ 405:	c9                   	leave
+ 406:	c3                   	ret
+
+00000407 <cond_signal>:
+{
+ 407:	55                   	push   %ebp
+ 408:	89 e5                	mov    %esp,%ebp
+ 40a:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 40d:	ff 75 08             	push   0x8(%ebp)
+ 410:	e8 c5 ff ff ff       	call   3da <condbump>
+ 415:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 1);
+ 418:	8b 45 08             	mov    0x8(%ebp),%eax
+ 41b:	83 ec 08             	sub    $0x8,%esp
+ 41e:	6a 01                	push   $0x1
+ 420:	50                   	push   %eax
+ 421:	e8 28 03 00 00       	call   74e <futex_wake>
+ 426:	83 c4 10             	add    $0x10,%esp
+}
+ 429:	90                   	nop
+ 42a:	c9                   	leave
+ 42b:	c3                   	ret
+
+0000042c <cond_broadcast>:
+
+void
+cond_broadcast(struct cond *c)
+{
+ 42c:	55                   	push   %ebp
+ 42d:	89 e5                	mov    %esp,%ebp
+ 42f:	83 ec 08             	sub    $0x8,%esp
+  condbump(c);
+ 432:	ff 75 08             	push   0x8(%ebp)
+ 435:	e8 a0 ff ff ff       	call   3da <condbump>
+ 43a:	83 c4 04             	add    $0x4,%esp
+  futex_wake((uint*)&c->seq, 0x7fffffff);
+ 43d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 440:	83 ec 08             	sub    $0x8,%esp
+ 443:	68 ff ff ff 7f       	push   $0x7fffffff
+ 448:	50                   	push   %eax
+ 449:	e8 00 03 00 00       	call   74e <futex_wake>
+ 44e:	83 c4 10             	add    $0x10,%esp
+}
+ 451:	90                   	nop
+ 452:	c9                   	leave
+ 453:	c3                   	ret
+
+00000454 <vuptime>:
+
+// uptime(), read from the kernel's vDSO page (see vdso.h)
+// without a system call.
+uint
+vuptime(void)
+{
+ 454:	55                   	push   %ebp
+ 455:	89 e5                	mov    %esp,%ebp
+  return ((volatile struct vdso*)VDSO)->ticks;
+ 457:	b8 00 e0 ff 7f       	mov    $0x7fffe000,%eax
+ 45c:	8b 00                	mov    (%eax),%eax
+}
+ 45e:	5d                   	pop    %ebp
+ 45f:	c3                   	ret
+
+00000460 <vgetpid>:
+
+// getpid(), as a load unless the process has threads.
+int
+vgetpid(void)
+{
+ 460:	55                   	push   %ebp
+ 461:	89 e5                	mov    %esp,%ebp
+ 463:	83 ec 18             	sub    $0x18,%esp
+  int pid;
+
+  if((pid = ((struct vdsoproc*)VDSOPROC)->pid) != 0)
+ 466:	b8 00 f0 ff 7f       	mov    $0x7ffff000,%eax
+ 46b:	8b 00                	mov    (%eax),%eax
+ 46d:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ 470:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 474:	74 05                	je     47b <vgetpid+0x1b>
+    return pid;
+ 476:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 479:	eb 05                	jmp    480 <vgetpid+0x20>
+  return getpid();
+ 47b:	e8 74 02 00 00       	call   6f4 <getpid>
+}
+ 480:	c9                   	leave
+ 481:	c3                   	ret
+
+00000482 <vclock>:
+
+// Microseconds since the kernel started, from the TSC.
+uint64
+vclock(void)
+{
+ 482:	55                   	push   %ebp
+ 483:	89 e5                	mov    %esp,%ebp
+ 485:	57                   	push   %edi
+ 486:	56                   	push   %esi
+ 487:	53                   	push   %ebx
+ 488:	83 ec 24             	sub    $0x24,%esp
+  struct vdso *v;
+  uint64 t;
+
+  v = (struct vdso*)VDSO;
+ 48b:	c7 45 ec 00 e0 ff 7f 	movl   $0x7fffe000,-0x14(%ebp)
+  t = rdtsc() - v->boottsc;
+ 492:	e8 f7 fb ff ff       	call   8e <rdtsc>
+ 497:	8b 4d ec             	mov    -0x14(%ebp),%ecx
+ 49a:	8b 59 0c             	mov    0xc(%ecx),%ebx
+ 49d:	8b 49 08             	mov    0x8(%ecx),%ecx
+ 4a0:	29 c8                	sub    %ecx,%eax
+ 4a2:	19 da                	sbb    %ebx,%edx
+ 4a4:	89 45 e0             	mov    %eax,-0x20(%ebp)
+ 4a7:	89 55 e4             	mov    %edx,-0x1c(%ebp)
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 4aa:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 4ad:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 4b0:	89 d0                	mov    %edx,%eax
+ 4b2:	31 d2                	xor    %edx,%edx
+ 4b4:	89 c1                	mov    %eax,%ecx
+ 4b6:	bb 00 00 00 00       	mov    $0x0,%ebx
+ 4bb:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4be:	8b 40 04             	mov    0x4(%eax),%eax
+ 4c1:	ba 00 00 00 00       	mov    $0x0,%edx
+ 4c6:	89 df                	mov    %ebx,%edi
+ 4c8:	0f af f8             	imul   %eax,%edi
+ 4cb:	89 d6                	mov    %edx,%esi
+ 4cd:	0f af f1             	imul   %ecx,%esi
+ 4d0:	01 f7                	add    %esi,%edi
+ 4d2:	f7 e1                	mul    %ecx
+ 4d4:	89 c1                	mov    %eax,%ecx
+ 4d6:	89 d3                	mov    %edx,%ebx
+ 4d8:	8d 04 1f             	lea    (%edi,%ebx,1),%eax
+ 4db:	89 c3                	mov    %eax,%ebx
+         (((t & 0xffffffff) * v->tscmult) >> 32);
+ 4dd:	8b 45 e0             	mov    -0x20(%ebp),%eax
+ 4e0:	8b 55 e4             	mov    -0x1c(%ebp),%edx
+ 4e3:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 4e6:	c7 45 dc 00 00 00 00 	movl   $0x0,-0x24(%ebp)
+ 4ed:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 4f0:	8b 40 04             	mov    0x4(%eax),%eax
+ 4f3:	89 45 d0             	mov    %eax,-0x30(%ebp)
+ 4f6:	c7 45 d4 00 00 00 00 	movl   $0x0,-0x2c(%ebp)
+ 4fd:	8b 45 d8             	mov    -0x28(%ebp),%eax
+ 500:	8b 55 dc             	mov    -0x24(%ebp),%edx
+ 503:	89 d7                	mov    %edx,%edi
+ 505:	8b 75 d0             	mov    -0x30(%ebp),%esi
+ 508:	0f af fe             	imul   %esi,%edi
+ 50b:	8b 75 d4             	mov    -0x2c(%ebp),%esi
+ 50e:	89 45 d8             	mov    %eax,-0x28(%ebp)
+ 511:	89 55 dc             	mov    %edx,-0x24(%ebp)
+ 514:	0f af f0             	imul   %eax,%esi
+ 517:	01 f7                	add    %esi,%edi
+ 519:	8b 45 d0             	mov    -0x30(%ebp),%eax
+ 51c:	f7 65 d8             	mull   -0x28(%ebp)
+ 51f:	8d 34 17             	lea    (%edi,%edx,1),%esi
+ 522:	89 f2                	mov    %esi,%edx
+ 524:	89 d0                	mov    %edx,%eax
+ 526:	31 d2                	xor    %edx,%edx
+  return (uint64)(uint)(t >> 32) * v->tscmult +
+ 528:	01 c8                	add    %ecx,%eax
+ 52a:	11 da                	adc    %ebx,%edx
+}
+ 52c:	83 c4 24             	add    $0x24,%esp
+ 52f:	5b                   	pop    %ebx
+ 530:	5e                   	pop    %esi
+ 531:	5f                   	pop    %edi
+ 532:	5d                   	pop    %ebp
+ 533:	c3                   	ret
+
+00000534 <ring_queue>:
+
+// Queue an operation on r (see ring.h).
+// Returns -1 if the submission ring is full.
+int
+ring_queue(struct ring *r, int op, int fd, void *addr, int n, uint data)
+{
+ 534:	55                   	push   %ebp
+ 535:	89 e5                	mov    %esp,%ebp
+ 537:	83 ec 10             	sub    $0x10,%esp
+  struct sqe *e;
+
+  if(r->sqtail - r->sqhead >= NRING)
+ 53a:	8b 45 08             	mov    0x8(%ebp),%eax
+ 53d:	8b 50 04             	mov    0x4(%eax),%edx
+ 540:	8b 45 08             	mov    0x8(%ebp),%eax
+ 543:	8b 00                	mov    (%eax),%eax
+ 545:	29 c2                	sub    %eax,%edx
+ 547:	83 fa 1f             	cmp    $0x1f,%edx
+ 54a:	76 07                	jbe    553 <ring_queue+0x1f>
+    return -1;
+ 54c:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 551:	eb 68                	jmp    5bb <ring_queue+0x87>
+  e = &r->sq[r->sqtail % NRING];
+ 553:	8b 45 08             	mov    0x8(%ebp),%eax
+ 556:	8b 40 04             	mov    0x4(%eax),%eax
+ 559:	83 e0 1f             	and    $0x1f,%eax
+ 55c:	89 c2                	mov    %eax,%edx
+ 55e:	89 d0                	mov    %edx,%eax
+ 560:	c1 e0 02             	shl    $0x2,%eax
+ 563:	01 d0                	add    %edx,%eax
+ 565:	c1 e0 02             	shl    $0x2,%eax
+ 568:	8d 50 10             	lea    0x10(%eax),%edx
+ 56b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 56e:	01 d0                	add    %edx,%eax
+ 570:	83 c0 04             	add    $0x4,%eax
+ 573:	89 45 fc             	mov    %eax,-0x4(%ebp)
+  e->op = op;
+ 576:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 579:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 57c:	89 10                	mov    %edx,(%eax)
+  e->fd = fd;
+ 57e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 581:	8b 55 10             	mov    0x10(%ebp),%edx
+ 584:	89 50 04             	mov    %edx,0x4(%eax)
+  e->addr = (uint)addr;
+ 587:	8b 55 14             	mov    0x14(%ebp),%edx
+ 58a:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 58d:	89 50 08             	mov    %edx,0x8(%eax)
+  e->n = n;
+ 590:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 593:	8b 55 18             	mov    0x18(%ebp),%edx
+ 596:	89 50 0c             	mov    %edx,0xc(%eax)
+  e->data = data;
+ 599:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ 59c:	8b 55 1c             	mov    0x1c(%ebp),%edx
+ 59f:	89 50 10             	mov    %edx,0x10(%eax)
+  __sync_synchronize();
+ 5a2:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  r->sqtail++;
+ 5a7:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5aa:	8b 40 04             	mov    0x4(%eax),%eax
+ 5ad:	8d 50 01             	lea    0x1(%eax),%edx
+ 5b0:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5b3:	89 50 04             	mov    %edx,0x4(%eax)
+  return 0;
+ 5b6:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 5bb:	c9                   	leave
+ 5bc:	c3                   	ret
+
+000005bd <ring_submit>:
+// for min of them to complete.  Makes no system call if a
+// RING_SQPOLL thread is awake and nothing need be waited for.
+// Returns the number of completions ready.
+int
+ring_submit(struct ring *r, int min)
+{
+ 5bd:	55                   	push   %ebp
+ 5be:	89 e5                	mov    %esp,%ebp
+ 5c0:	83 ec 08             	sub    $0x8,%esp
+  __sync_synchronize();
+ 5c3:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  if(min > 0 || !(r->flags & RING_SQPOLL) || (r->flags & RING_NEED_WAKEUP))
+ 5c8:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 5cc:	7f 1a                	jg     5e8 <ring_submit+0x2b>
+ 5ce:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5d1:	8b 40 10             	mov    0x10(%eax),%eax
+ 5d4:	83 e0 01             	and    $0x1,%eax
+ 5d7:	85 c0                	test   %eax,%eax
+ 5d9:	74 0d                	je     5e8 <ring_submit+0x2b>
+ 5db:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5de:	8b 40 10             	mov    0x10(%eax),%eax
+ 5e1:	83 e0 02             	and    $0x2,%eax
+ 5e4:	85 c0                	test   %eax,%eax
+ 5e6:	74 10                	je     5f8 <ring_submit+0x3b>
+    return ring_enter(min);
+ 5e8:	83 ec 0c             	sub    $0xc,%esp
+ 5eb:	ff 75 0c             	push   0xc(%ebp)
+ 5ee:	e8 83 01 00 00       	call   776 <ring_enter>
+ 5f3:	83 c4 10             	add    $0x10,%esp
+ 5f6:	eb 10                	jmp    608 <ring_submit+0x4b>
+  return r->cqtail - r->cqhead;
+ 5f8:	8b 45 08             	mov    0x8(%ebp),%eax
+ 5fb:	8b 50 0c             	mov    0xc(%eax),%edx
+ 5fe:	8b 45 08             	mov    0x8(%ebp),%eax
+ 601:	8b 40 08             	mov    0x8(%eax),%eax
+ 604:	29 c2                	sub    %eax,%edx
+ 606:	89 d0                	mov    %edx,%eax
+}
+ 608:	c9                   	leave
+ 609:	c3                   	ret
+
+0000060a <ring_reap>:
+
+// Take the next completion into *c.
+// Returns -1 if there is none.
+int
+ring_reap(struct ring *r, struct cqe *c)
+{
+ 60a:	55                   	push   %ebp
+ 60b:	89 e5                	mov    %esp,%ebp
+  if(r->cqhead == r->cqtail)
+ 60d:	8b 45 08             	mov    0x8(%ebp),%eax
+ 610:	8b 50 08             	mov    0x8(%eax),%edx
+ 613:	8b 45 08             	mov    0x8(%ebp),%eax
+ 616:	8b 40 0c             	mov    0xc(%eax),%eax
+ 619:	39 c2                	cmp    %eax,%edx
+ 61b:	75 07                	jne    624 <ring_reap+0x1a>
+    return -1;
+ 61d:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ 622:	eb 3b                	jmp    65f <ring_reap+0x55>
+  __sync_synchronize();
+ 624:	f0 83 0c 24 00       	lock orl $0x0,(%esp)
+  *c = r->cq[r->cqhead % NRING];
+ 629:	8b 45 08             	mov    0x8(%ebp),%eax
+ 62c:	8b 40 08             	mov    0x8(%eax),%eax
+ 62f:	83 e0 1f             	and    $0x1f,%eax
+ 632:	89 c2                	mov    %eax,%edx
+ 634:	8b 4d 0c             	mov    0xc(%ebp),%ecx
+ 637:	8b 45 08             	mov    0x8(%ebp),%eax
+ 63a:	83 c2 52             	add    $0x52,%edx
+ 63d:	8d 54 d0 04          	lea    0x4(%eax,%edx,8),%edx
+ 641:	8b 02                	mov    (%edx),%eax
+ 643:	8b 52 04             	mov    0x4(%edx),%edx
+ 646:	89 01                	mov    %eax,(%ecx)
+ 648:	89 51 04             	mov    %edx,0x4(%ecx)
+  r->cqhead++;
+ 64b:	8b 45 08             	mov    0x8(%ebp),%eax
+ 64e:	8b 40 08             	mov    0x8(%eax),%eax
+ 651:	8d 50 01             	lea    0x1(%eax),%edx
+ 654:	8b 45 08             	mov    0x8(%ebp),%eax
+ 657:	89 50 08             	mov    %edx,0x8(%eax)
+  return 0;
+ 65a:	b8 00 00 00 00       	mov    $0x0,%eax
+}
+ 65f:	5d                   	pop    %ebp
+ 660:	c3                   	ret
+
+00000661 <usyscall>:
+// Enter the kernel with SYSENTER if the kernel says the CPU has
+// it, else with int $T_SYSCALL.  For SYSENTER, the kernel returns
+// to %edx with %esp set from %ecx, and finds the arguments above
+// the return address at 4(%ecx), just as for int $T_SYSCALL.
+usyscall:
+  cmpl $0, VDSO_SYSENTER
+ 661:	83 3d 10 e0 ff 7f 00 	cmpl   $0x0,0x7fffe010
+  je 1f
+ 668:	74 0a                	je     674 <usyscall+0x13>
+  movl %esp, %ecx
+ 66a:	89 e1                	mov    %esp,%ecx
+  movl $2f, %edx
+ 66c:	ba 73 06 00 00       	mov    $0x673,%edx
+  sysenter
+ 671:	0f 34                	sysenter
+2:
+  ret
+ 673:	c3                   	ret
+1:
+  int $T_SYSCALL
+ 674:	cd 40                	int    $0x40
+  ret
+ 676:	c3                   	ret
+
+00000677 <fork>:
+
+SYSCALL(fork)
+ 677:	b8 01 00 00 00       	mov    $0x1,%eax
+ 67c:	eb e3                	jmp    661 <usyscall>
+
+0000067e <exit>:
+SYSCALL(exit)
+ 67e:	b8 02 00 00 00       	mov    $0x2,%eax
+ 683:	eb dc                	jmp    661 <usyscall>
+
+00000685 <wait>:
+SYSCALL(wait)
+ 685:	b8 03 00 00 00       	mov    $0x3,%eax
+ 68a:	eb d5                	jmp    661 <usyscall>
+
+0000068c <pipe>:
+SYSCALL(pipe)
+ 68c:	b8 04 00 00 00       	mov    $0x4,%eax
+ 691:	eb ce                	jmp    661 <usyscall>
+
+00000693 <read>:
+SYSCALL(read)
+ 693:	b8 05 00 00 00       	mov    $0x5,%eax
+ 698:	eb c7                	jmp    661 <usyscall>
+
+0000069a <write>:
+SYSCALL(write)
+ 69a:	b8 10 00 00 00       	mov    $0x10,%eax
+ 69f:	eb c0                	jmp    661 <usyscall>
+
+000006a1 <close>:
+SYSCALL(close)
+ 6a1:	b8 15 00 00 00       	mov    $0x15,%eax
+ 6a6:	eb b9                	jmp    661 <usyscall>
+
+000006a8 <kill>:
+SYSCALL(kill)
+ 6a8:	b8 06 00 00 00       	mov    $0x6,%eax
+ 6ad:	eb b2                	jmp    661 <usyscall>
+
+000006af <exec>:
+SYSCALL(exec)
+ 6af:	b8 07 00 00 00       	mov    $0x7,%eax
+ 6b4:	eb ab                	jmp    661 <usyscall>
+
+000006b6 <open>:
+SYSCALL(open)
+ 6b6:	b8 0f 00 00 00       	mov    $0xf,%eax
+ 6bb:	eb a4                	jmp    661 <usyscall>
+
+000006bd <mknod>:
+SYSCALL(mknod)
+ 6bd:	b8 11 00 00 00       	mov    $0x11,%eax
+ 6c2:	eb 9d                	jmp    661 <usyscall>
+
+000006c4 <unlink>:
+SYSCALL(unlink)
+ 6c4:	b8 12 00 00 00       	mov    $0x12,%eax
+ 6c9:	eb 96                	jmp    661 <usyscall>
+
+000006cb <fstat>:
+SYSCALL(fstat)
+ 6cb:	b8 08 00 00 00       	mov    $0x8,%eax
+ 6d0:	eb 8f                	jmp    661 <usyscall>
+
+000006d2 <link>:
+SYSCALL(link)
+ 6d2:	b8 13 00 00 00       	mov    $0x13,%eax
+ 6d7:	eb 88                	jmp    661 <usyscall>
+
+000006d9 <mkdir>:
+SYSCALL(mkdir)
+ 6d9:	b8 14 00 00 00       	mov    $0x14,%eax
+ 6de:	eb 81                	jmp    661 <usyscall>
+
+000006e0 <chdir>:
+SYSCALL(chdir)
+ 6e0:	b8 09 00 00 00       	mov    $0x9,%eax
+ 6e5:	e9 77 ff ff ff       	jmp    661 <usyscall>
+
+000006ea <dup>:
+SYSCALL(dup)
+ 6ea:	b8 0a 00 00 00       	mov    $0xa,%eax
+ 6ef:	e9 6d ff ff ff       	jmp    661 <usyscall>
+
+000006f4 <getpid>:
+SYSCALL(getpid)
+ 6f4:	b8 0b 00 00 00       	mov    $0xb,%eax
+ 6f9:	e9 63 ff ff ff       	jmp    661 <usyscall>
+
+000006fe <sbrk>:
+SYSCALL(sbrk)
+ 6fe:	b8 0c 00 00 00       	mov    $0xc,%eax
+ 703:	e9 59 ff ff ff       	jmp    661 <usyscall>
+
+00000708 <sleep>:
+SYSCALL(sleep)
+ 708:	b8 0d 00 00 00       	mov    $0xd,%eax
+ 70d:	e9 4f ff ff ff       	jmp    661 <usyscall>
+
+00000712 <uptime>:
+SYSCALL(uptime)
+ 712:	b8 0e 00 00 00       	mov    $0xe,%eax
+ 717:	e9 45 ff ff ff       	jmp    661 <usyscall>
+
+0000071c <kmstat>:
+SYSCALL(kmstat)
+ 71c:	b8 16 00 00 00       	mov    $0x16,%eax
+ 721:	e9 3b ff ff ff       	jmp    661 <usyscall>
+
+00000726 <setpriority>:
+SYSCALL(setpriority)
+ 726:	b8 17 00 00 00       	mov    $0x17,%eax
+ 72b:	e9 31 ff ff ff       	jmp    661 <usyscall>
+
+00000730 <clone>:
+SYSCALL(clone)
+ 730:	b8 18 00 00 00       	mov    $0x18,%eax
+ 735:	e9 27 ff ff ff       	jmp    661 <usyscall>
+
+0000073a <join>:
+SYSCALL(join)
+ 73a:	b8 19 00 00 00       	mov    $0x19,%eax
+ 73f:	e9 1d ff ff ff       	jmp    661 <usyscall>
+
+00000744 <futex_wait>:
+SYSCALL(futex_wait)
+ 744:	b8 1a 00 00 00       	mov    $0x1a,%eax
+ 749:	e9 13 ff ff ff       	jmp    661 <usyscall>
+
+0000074e <futex_wake>:
+SYSCALL(futex_wake)
+ 74e:	b8 1b 00 00 00       	mov    $0x1b,%eax
+ 753:	e9 09 ff ff ff       	jmp    661 <usyscall>
+
+00000758 <lockstat>:
+SYSCALL(lockstat)
+ 758:	b8 1c 00 00 00       	mov    $0x1c,%eax
+ 75d:	e9 ff fe ff ff       	jmp    661 <usyscall>
+
+00000762 <sysstat>:
+SYSCALL(sysstat)
+ 762:	b8 1d 00 00 00       	mov    $0x1d,%eax
+ 767:	e9 f5 fe ff ff       	jmp    661 <usyscall>
+
+0000076c <ring_setup>:
+SYSCALL(ring_setup)
+ 76c:	b8 1e 00 00 00       	mov    $0x1e,%eax
+ 771:	e9 eb fe ff ff       	jmp    661 <usyscall>
+
+00000776 <ring_enter>:
+SYSCALL(ring_enter)
+ 776:	b8 1f 00 00 00       	mov    $0x1f,%eax
+ 77b:	e9 e1 fe ff ff       	jmp    661 <usyscall>
+
+00000780 <putc>:
+#include "stat.h"
+#include "user.h"
+
+static void
+putc(int fd, char c)
+{
+ 780:	55                   	push   %ebp
+ 781:	89 e5                	mov    %esp,%ebp
+ 783:	83 ec 18             	sub    $0x18,%esp
+ 786:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 789:	88 45 f4             	mov    %al,-0xc(%ebp)
+  write(fd, &c, 1);
+ 78c:	83 ec 04             	sub    $0x4,%esp
+ 78f:	6a 01                	push   $0x1
+ 791:	8d 45 f4             	lea    -0xc(%ebp),%eax
+ 794:	50                   	push   %eax
+ 795:	ff 75 08             	push   0x8(%ebp)
+ 798:	e8 fd fe ff ff       	call   69a <write>
+ 79d:	83 c4 10             	add    $0x10,%esp
+}
+ 7a0:	90                   	nop
+ 7a1:	c9                   	leave
+ 7a2:	c3                   	ret
+
+000007a3 <printint>:
+
+static void
+printint(int fd, int xx, int base, int sgn)
+{
+ 7a3:	55                   	push   %ebp
+ 7a4:	89 e5                	mov    %esp,%ebp
+ 7a6:	83 ec 28             	sub    $0x28,%esp
+  static char digits[] = "0123456789ABCDEF";
+  char buf[16];
+  int i, neg;
+  uint x;
+
+  neg = 0;
+ 7a9:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+  if(sgn && xx < 0){
+ 7b0:	83 7d 14 00          	cmpl   $0x0,0x14(%ebp)
+ 7b4:	74 17                	je     7cd <printint+0x2a>
+ 7b6:	83 7d 0c 00          	cmpl   $0x0,0xc(%ebp)
+ 7ba:	79 11                	jns    7cd <printint+0x2a>
+    neg = 1;
+ 7bc:	c7 45 f0 01 00 00 00 	movl   $0x1,-0x10(%ebp)
+    x = -xx;
+ 7c3:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7c6:	f7 d8                	neg    %eax
+ 7c8:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 7cb:	eb 06                	jmp    7d3 <printint+0x30>
+  } else {
+    x = xx;
+ 7cd:	8b 45 0c             	mov    0xc(%ebp),%eax
+ 7d0:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  }
+
+  i = 0;
+ 7d3:	c7 45 f4 00 00 00 00 	movl   $0x0,-0xc(%ebp)
+  do{
+    buf[i++] = digits[x % base];
+ 7da:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 7dd:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 7e0:	ba 00 00 00 00       	mov    $0x0,%edx
+ 7e5:	f7 f1                	div    %ecx
+ 7e7:	89 d1                	mov    %edx,%ecx
+ 7e9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 7ec:	8d 50 01             	lea    0x1(%eax),%edx
+ 7ef:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 7f2:	0f b6 91 50 11 00 00 	movzbl 0x1150(%ecx),%edx
+ 7f9:	88 54 05 dc          	mov    %dl,-0x24(%ebp,%eax,1)
+  }while((x /= base) != 0);
+ 7fd:	8b 4d 10             	mov    0x10(%ebp),%ecx
+ 800:	8b 45 ec             	mov    -0x14(%ebp),%eax
+ 803:	ba 00 00 00 00       	mov    $0x0,%edx
+ 808:	f7 f1                	div    %ecx
+ 80a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+ 80d:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 811:	75 c7                	jne    7da <printint+0x37>
+  if(neg)
+ 813:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ 817:	74 2d                	je     846 <printint+0xa3>
+    buf[i++] = '-';
+ 819:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 81c:	8d 50 01             	lea    0x1(%eax),%edx
+ 81f:	89 55 f4             	mov    %edx,-0xc(%ebp)
+ 822:	c6 44 05 dc 2d       	movb   $0x2d,-0x24(%ebp,%eax,1)
+
+  while(--i >= 0)
+ 827:	eb 1d                	jmp    846 <printint+0xa3>
+    putc(fd, buf[i]);
+ 829:	8d 55 dc             	lea    -0x24(%ebp),%edx
+ 82c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 82f:	01 d0                	add    %edx,%eax
+ 831:	0f b6 00             	movzbl (%eax),%eax
+ 834:	0f be c0             	movsbl %al,%eax
+ 837:	83 ec 08             	sub    $0x8,%esp
+ 83a:	50                   	push   %eax
+ 83b:	ff 75 08             	push   0x8(%ebp)
+ 83e:	e8 3d ff ff ff       	call   780 <putc>
+ 843:	83 c4 10             	add    $0x10,%esp
+  while(--i >= 0)
+ 846:	83 6d f4 01          	subl   $0x1,-0xc(%ebp)
+ 84a:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 84e:	79 d9                	jns    829 <printint+0x86>
+}
+ 850:	90                   	nop
+ 851:	90                   	nop
+ 852:	c9                   	leave
+ 853:	c3                   	ret
+
+00000854 <printf>:
+
+// Print to the given fd. Only understands %d, %x, %p, %s.
+void
+printf(int fd, char *fmt, ...)
+{
+ 854:	55                   	push   %ebp
+ 855:	89 e5                	mov    %esp,%ebp
+ 857:	83 ec 28             	sub    $0x28,%esp
+  char *s;
+  int c, i, state;
+  uint *ap;
+
+  state = 0;
+ 85a:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  ap = (uint*)(void*)&fmt + 1;
+ 861:	8d 45 0c             	lea    0xc(%ebp),%eax
+ 864:	83 c0 04             	add    $0x4,%eax
+ 867:	89 45 e8             	mov    %eax,-0x18(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 86a:	c7 45 f0 00 00 00 00 	movl   $0x0,-0x10(%ebp)
+ 871:	e9 59 01 00 00       	jmp    9cf <printf+0x17b>
+    c = fmt[i] & 0xff;
+ 876:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 879:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 87c:	01 d0                	add    %edx,%eax
+ 87e:	0f b6 00             	movzbl (%eax),%eax
+ 881:	0f be c0             	movsbl %al,%eax
+ 884:	25 ff 00 00 00       	and    $0xff,%eax
+ 889:	89 45 e4             	mov    %eax,-0x1c(%ebp)
+    if(state == 0){
+ 88c:	83 7d ec 00          	cmpl   $0x0,-0x14(%ebp)
+ 890:	75 2c                	jne    8be <printf+0x6a>
+      if(c == '%'){
+ 892:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 896:	75 0c                	jne    8a4 <printf+0x50>
+        state = '%';
+ 898:	c7 45 ec 25 00 00 00 	movl   $0x25,-0x14(%ebp)
+ 89f:	e9 27 01 00 00       	jmp    9cb <printf+0x177>
+      } else {
+        putc(fd, c);
+ 8a4:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 8a7:	0f be c0             	movsbl %al,%eax
+ 8aa:	83 ec 08             	sub    $0x8,%esp
+ 8ad:	50                   	push   %eax
+ 8ae:	ff 75 08             	push   0x8(%ebp)
+ 8b1:	e8 ca fe ff ff       	call   780 <putc>
+ 8b6:	83 c4 10             	add    $0x10,%esp
+ 8b9:	e9 0d 01 00 00       	jmp    9cb <printf+0x177>
+      }
+    } else if(state == '%'){
+ 8be:	83 7d ec 25          	cmpl   $0x25,-0x14(%ebp)
+ 8c2:	0f 85 03 01 00 00    	jne    9cb <printf+0x177>
+      if(c == 'd'){
+ 8c8:	83 7d e4 64          	cmpl   $0x64,-0x1c(%ebp)
+ 8cc:	75 1e                	jne    8ec <printf+0x98>
+        printint(fd, *ap, 10, 1);
+ 8ce:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8d1:	8b 00                	mov    (%eax),%eax
+ 8d3:	6a 01                	push   $0x1
+ 8d5:	6a 0a                	push   $0xa
+ 8d7:	50                   	push   %eax
+ 8d8:	ff 75 08             	push   0x8(%ebp)
+ 8db:	e8 c3 fe ff ff       	call   7a3 <printint>
+ 8e0:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 8e3:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 8e7:	e9 d8 00 00 00       	jmp    9c4 <printf+0x170>
+      } else if(c == 'x' || c == 'p'){
+ 8ec:	83 7d e4 78          	cmpl   $0x78,-0x1c(%ebp)
+ 8f0:	74 06                	je     8f8 <printf+0xa4>
+ 8f2:	83 7d e4 70          	cmpl   $0x70,-0x1c(%ebp)
+ 8f6:	75 1e                	jne    916 <printf+0xc2>
+        printint(fd, *ap, 16, 0);
+ 8f8:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 8fb:	8b 00                	mov    (%eax),%eax
+ 8fd:	6a 00                	push   $0x0
+ 8ff:	6a 10                	push   $0x10
+ 901:	50                   	push   %eax
+ 902:	ff 75 08             	push   0x8(%ebp)
+ 905:	e8 99 fe ff ff       	call   7a3 <printint>
+ 90a:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 90d:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 911:	e9 ae 00 00 00       	jmp    9c4 <printf+0x170>
+      } else if(c == 's'){
+ 916:	83 7d e4 73          	cmpl   $0x73,-0x1c(%ebp)
+ 91a:	75 43                	jne    95f <printf+0x10b>
+        s = (char*)*ap;
+ 91c:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 91f:	8b 00                	mov    (%eax),%eax
+ 921:	89 45 f4             	mov    %eax,-0xc(%ebp)
+        ap++;
+ 924:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+        if(s == 0)
+ 928:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ 92c:	75 25                	jne    953 <printf+0xff>
+          s = "(null)";
+ 92e:	c7 45 f4 93 0c 00 00 	movl   $0xc93,-0xc(%ebp)
+        while(*s != 0){
+ 935:	eb 1c                	jmp    953 <printf+0xff>
+          putc(fd, *s);
+ 937:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 93a:	0f b6 00             	movzbl (%eax),%eax
+ 93d:	0f be c0             	movsbl %al,%eax
+ 940:	83 ec 08             	sub    $0x8,%esp
+ 943:	50                   	push   %eax
+ 944:	ff 75 08             	push   0x8(%ebp)
+ 947:	e8 34 fe ff ff       	call   780 <putc>
+ 94c:	83 c4 10             	add    $0x10,%esp
+          s++;
+ 94f:	83 45 f4 01          	addl   $0x1,-0xc(%ebp)
+        while(*s != 0){
+ 953:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ 956:	0f b6 00             	movzbl (%eax),%eax
+ 959:	84 c0                	test   %al,%al
+ 95b:	75 da                	jne    937 <printf+0xe3>
+ 95d:	eb 65                	jmp    9c4 <printf+0x170>
+        }
+      } else if(c == 'c'){
+ 95f:	83 7d e4 63          	cmpl   $0x63,-0x1c(%ebp)
+ 963:	75 1d                	jne    982 <printf+0x12e>
+        putc(fd, *ap);
+ 965:	8b 45 e8             	mov    -0x18(%ebp),%eax
+ 968:	8b 00                	mov    (%eax),%eax
+ 96a:	0f be c0             	movsbl %al,%eax
+ 96d:	83 ec 08             	sub    $0x8,%esp
+ 970:	50                   	push   %eax
+ 971:	ff 75 08             	push   0x8(%ebp)
+ 974:	e8 07 fe ff ff       	call   780 <putc>
+ 979:	83 c4 10             	add    $0x10,%esp
+        ap++;
+ 97c:	83 45 e8 04          	addl   $0x4,-0x18(%ebp)
+ 980:	eb 42                	jmp    9c4 <printf+0x170>
+      } else if(c == '%'){
+ 982:	83 7d e4 25          	cmpl   $0x25,-0x1c(%ebp)
+ 986:	75 17                	jne    99f <printf+0x14b>
+        putc(fd, c);
+ 988:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 98b:	0f be c0             	movsbl %al,%eax
+ 98e:	83 ec 08             	sub    $0x8,%esp
+ 991:	50                   	push   %eax
+ 992:	ff 75 08             	push   0x8(%ebp)
+ 995:	e8 e6 fd ff ff       	call   780 <putc>
+ 99a:	83 c4 10             	add    $0x10,%esp
+ 99d:	eb 25                	jmp    9c4 <printf+0x170>
+      } else {
+        // Unknown % sequence.  Print it to draw attention.
+        putc(fd, '%');
+ 99f:	83 ec 08             	sub    $0x8,%esp
+ 9a2:	6a 25                	push   $0x25
+ 9a4:	ff 75 08             	push   0x8(%ebp)
+ 9a7:	e8 d4 fd ff ff       	call   780 <putc>
+ 9ac:	83 c4 10             	add    $0x10,%esp
+        putc(fd, c);
+ 9af:	8b 45 e4             	mov    -0x1c(%ebp),%eax
+ 9b2:	0f be c0             	movsbl %al,%eax
+ 9b5:	83 ec 08             	sub    $0x8,%esp
+ 9b8:	50                   	push   %eax
+ 9b9:	ff 75 08             	push   0x8(%ebp)
+ 9bc:	e8 bf fd ff ff       	call   780 <putc>
+ 9c1:	83 c4 10             	add    $0x10,%esp
+      }
+      state = 0;
+ 9c4:	c7 45 ec 00 00 00 00 	movl   $0x0,-0x14(%ebp)
+  for(i = 0; fmt[i]; i++){
+ 9cb:	83 45 f0 01          	addl   $0x1,-0x10(%ebp)
+ 9cf:	8b 55 0c             	mov    0xc(%ebp),%edx
+ 9d2:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ 9d5:	01 d0                	add    %edx,%eax
+ 9d7:	0f b6 00             	movzbl (%eax),%eax
+ 9da:	84 c0                	test   %al,%al
+ 9dc:	0f 85 94 fe ff ff    	jne    876 <printf+0x22>
+    }
+  }
+}
+ 9e2:	90                   	nop
+ 9e3:	90                   	nop
+ 9e4:	c9                   	leave
+ 9e5:	c3                   	ret
+
+000009e6 <free>:
+static Header base;
+static Header *freep;
+
+void
+free(void *ap)
+{
+ 9e6:	55                   	push   %ebp
+ 9e7:	89 e5                	mov    %esp,%ebp
+ 9e9:	83 ec 10             	sub    $0x10,%esp
+  Header *bp, *p;
+
+  bp = (Header*)ap - 1;
+ 9ec:	8b 45 08             	mov    0x8(%ebp),%eax
+ 9ef:	83 e8 08             	sub    $0x8,%eax
+ 9f2:	89 45 f8             	mov    %eax,-0x8(%ebp)
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ 9f5:	a1 6c 11 00 00       	mov    0x116c,%eax
+ 9fa:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ 9fd:	eb 24                	jmp    a23 <free+0x3d>
+    if(p >= p->s.ptr && (bp > p || bp < p->s.ptr))
+ 9ff:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a02:	8b 00                	mov    (%eax),%eax
+ a04:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a07:	72 12                	jb     a1b <free+0x35>
+ a09:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a0c:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a0f:	72 24                	jb     a35 <free+0x4f>
+ a11:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a14:	8b 00                	mov    (%eax),%eax
+ a16:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a19:	72 1a                	jb     a35 <free+0x4f>
+  for(p = freep; !(bp > p && bp < p->s.ptr); p = p->s.ptr)
+ a1b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a1e:	8b 00                	mov    (%eax),%eax
+ a20:	89 45 fc             	mov    %eax,-0x4(%ebp)
+ a23:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a26:	39 45 fc             	cmp    %eax,-0x4(%ebp)
+ a29:	73 d4                	jae    9ff <free+0x19>
+ a2b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a2e:	8b 00                	mov    (%eax),%eax
+ a30:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a33:	73 ca                	jae    9ff <free+0x19>
+      break;
+  if(bp + bp->s.size == p->s.ptr){
+ a35:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a38:	8b 40 04             	mov    0x4(%eax),%eax
+ a3b:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a42:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a45:	01 c2                	add    %eax,%edx
+ a47:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a4a:	8b 00                	mov    (%eax),%eax
+ a4c:	39 c2                	cmp    %eax,%edx
+ a4e:	75 24                	jne    a74 <free+0x8e>
+    bp->s.size += p->s.ptr->s.size;
+ a50:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a53:	8b 50 04             	mov    0x4(%eax),%edx
+ a56:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a59:	8b 00                	mov    (%eax),%eax
+ a5b:	8b 40 04             	mov    0x4(%eax),%eax
+ a5e:	01 c2                	add    %eax,%edx
+ a60:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a63:	89 50 04             	mov    %edx,0x4(%eax)
+    bp->s.ptr = p->s.ptr->s.ptr;
+ a66:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a69:	8b 00                	mov    (%eax),%eax
+ a6b:	8b 10                	mov    (%eax),%edx
+ a6d:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a70:	89 10                	mov    %edx,(%eax)
+ a72:	eb 0a                	jmp    a7e <free+0x98>
+  } else
+    bp->s.ptr = p->s.ptr;
+ a74:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a77:	8b 10                	mov    (%eax),%edx
+ a79:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a7c:	89 10                	mov    %edx,(%eax)
+  if(p + p->s.size == bp){
+ a7e:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a81:	8b 40 04             	mov    0x4(%eax),%eax
+ a84:	8d 14 c5 00 00 00 00 	lea    0x0(,%eax,8),%edx
+ a8b:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a8e:	01 d0                	add    %edx,%eax
+ a90:	39 45 f8             	cmp    %eax,-0x8(%ebp)
+ a93:	75 20                	jne    ab5 <free+0xcf>
+    p->s.size += bp->s.size;
+ a95:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ a98:	8b 50 04             	mov    0x4(%eax),%edx
+ a9b:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ a9e:	8b 40 04             	mov    0x4(%eax),%eax
+ aa1:	01 c2                	add    %eax,%edx
+ aa3:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ aa6:	89 50 04             	mov    %edx,0x4(%eax)
+    p->s.ptr = bp->s.ptr;
+ aa9:	8b 45 f8             	mov    -0x8(%ebp),%eax
+ aac:	8b 10                	mov    (%eax),%edx
+ aae:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab1:	89 10                	mov    %edx,(%eax)
+ ab3:	eb 08                	jmp    abd <free+0xd7>
+  } else
+    p->s.ptr = bp;
+ ab5:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ab8:	8b 55 f8             	mov    -0x8(%ebp),%edx
+ abb:	89 10                	mov    %edx,(%eax)
+  freep = p;
+ abd:	8b 45 fc             	mov    -0x4(%ebp),%eax
+ ac0:	a3 6c 11 00 00       	mov    %eax,0x116c
+}
+ ac5:	90                   	nop
+ ac6:	c9                   	leave
+ ac7:	c3                   	ret
+
+00000ac8 <morecore>:
+
+static Header*
+morecore(uint nu)
+{
+ ac8:	55                   	push   %ebp
+ ac9:	89 e5                	mov    %esp,%ebp
+ acb:	83 ec 18             	sub    $0x18,%esp
+  char *p;
+  Header *hp;
+
+  if(nu < 4096)
+ ace:	81 7d 08 ff 0f 00 00 	cmpl   $0xfff,0x8(%ebp)
+ ad5:	77 07                	ja     ade <morecore+0x16>
+    nu = 4096;
+ ad7:	c7 45 08 00 10 00 00 	movl   $0x1000,0x8(%ebp)
+  p = sbrk(nu * sizeof(Header));
+ ade:	8b 45 08             	mov    0x8(%ebp),%eax
+ ae1:	c1 e0 03             	shl    $0x3,%eax
+ ae4:	83 ec 0c             	sub    $0xc,%esp
+ ae7:	50                   	push   %eax
+ ae8:	e8 11 fc ff ff       	call   6fe <sbrk>
+ aed:	83 c4 10             	add    $0x10,%esp
+ af0:	89 45 f4             	mov    %eax,-0xc(%ebp)
+  if(p == (char*)-1)
+ af3:	83 7d f4 ff          	cmpl   $0xffffffff,-0xc(%ebp)
+ af7:	75 07                	jne    b00 <morecore+0x38>
+    return 0;
+ af9:	b8 00 00 00 00       	mov    $0x0,%eax
+ afe:	eb 26                	jmp    b26 <morecore+0x5e>
+  hp = (Header*)p;
+ b00:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b03:	89 45 f0             	mov    %eax,-0x10(%ebp)
+  hp->s.size = nu;
+ b06:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b09:	8b 55 08             	mov    0x8(%ebp),%edx
+ b0c:	89 50 04             	mov    %edx,0x4(%eax)
+  free((void*)(hp + 1));
+ b0f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b12:	83 c0 08             	add    $0x8,%eax
+ b15:	83 ec 0c             	sub    $0xc,%esp
+ b18:	50                   	push   %eax
+ b19:	e8 c8 fe ff ff       	call   9e6 <free>
+ b1e:	83 c4 10             	add    $0x10,%esp
+  return freep;
+ b21:	a1 6c 11 00 00       	mov    0x116c,%eax
+}
+ b26:	c9                   	leave
+ b27:	c3                   	ret
+
+00000b28 <malloc>:
+
+void*
+malloc(uint nbytes)
+{
+ b28:	55                   	push   %ebp
+ b29:	89 e5                	mov    %esp,%ebp
+ b2b:	83 ec 18             	sub    $0x18,%esp
+  Header *p, *prevp;
+  uint nunits;
+
+  nunits = (nbytes + sizeof(Header) - 1)/sizeof(Header) + 1;
+ b2e:	8b 45 08             	mov    0x8(%ebp),%eax
+ b31:	83 c0 07             	add    $0x7,%eax
+ b34:	c1 e8 03             	shr    $0x3,%eax
+ b37:	83 c0 01             	add    $0x1,%eax
+ b3a:	89 45 ec             	mov    %eax,-0x14(%ebp)
+  if((prevp = freep) == 0){
+ b3d:	a1 6c 11 00 00       	mov    0x116c,%eax
+ b42:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ b45:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ b49:	75 23                	jne    b6e <malloc+0x46>
+    base.s.ptr = freep = prevp = &base;
+ b4b:	c7 45 f0 64 11 00 00 	movl   $0x1164,-0x10(%ebp)
+ b52:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b55:	a3 6c 11 00 00       	mov    %eax,0x116c
+ b5a:	a1 6c 11 00 00       	mov    0x116c,%eax
+ b5f:	a3 64 11 00 00       	mov    %eax,0x1164
+    base.s.size = 0;
+ b64:	c7 05 68 11 00 00 00 	movl   $0x0,0x1168
+ b6b:	00 00 00 
+  }
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ b6e:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b71:	8b 00                	mov    (%eax),%eax
+ b73:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ b76:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b79:	8b 40 04             	mov    0x4(%eax),%eax
+ b7c:	3b 45 ec             	cmp    -0x14(%ebp),%eax
+ b7f:	72 4d                	jb     bce <malloc+0xa6>
+      if(p->s.size == nunits)
+ b81:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b84:	8b 40 04             	mov    0x4(%eax),%eax
+ b87:	39 45 ec             	cmp    %eax,-0x14(%ebp)
+ b8a:	75 0c                	jne    b98 <malloc+0x70>
+        prevp->s.ptr = p->s.ptr;
+ b8c:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b8f:	8b 10                	mov    (%eax),%edx
+ b91:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ b94:	89 10                	mov    %edx,(%eax)
+ b96:	eb 26                	jmp    bbe <malloc+0x96>
+      else {
+        p->s.size -= nunits;
+ b98:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ b9b:	8b 40 04             	mov    0x4(%eax),%eax
+ b9e:	2b 45 ec             	sub    -0x14(%ebp),%eax
+ ba1:	89 c2                	mov    %eax,%edx
+ ba3:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ ba6:	89 50 04             	mov    %edx,0x4(%eax)
+        p += p->s.size;
+ ba9:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bac:	8b 40 04             	mov    0x4(%eax),%eax
+ baf:	c1 e0 03             	shl    $0x3,%eax
+ bb2:	01 45 f4             	add    %eax,-0xc(%ebp)
+        p->s.size = nunits;
+ bb5:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bb8:	8b 55 ec             	mov    -0x14(%ebp),%edx
+ bbb:	89 50 04             	mov    %edx,0x4(%eax)
+      }
+      freep = prevp;
+ bbe:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ bc1:	a3 6c 11 00 00       	mov    %eax,0x116c
+      return (void*)(p + 1);
+ bc6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bc9:	83 c0 08             	add    $0x8,%eax
+ bcc:	eb 3b                	jmp    c09 <malloc+0xe1>
+    }
+    if(p == freep)
+ bce:	a1 6c 11 00 00       	mov    0x116c,%eax
+ bd3:	39 45 f4             	cmp    %eax,-0xc(%ebp)
+ bd6:	75 1e                	jne    bf6 <malloc+0xce>
+      if((p = morecore(nunits)) == 0)
+ bd8:	83 ec 0c             	sub    $0xc,%esp
+ bdb:	ff 75 ec             	push   -0x14(%ebp)
+ bde:	e8 e5 fe ff ff       	call   ac8 <morecore>
+ be3:	83 c4 10             	add    $0x10,%esp
+ be6:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ be9:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ bed:	75 07                	jne    bf6 <malloc+0xce>
+        return 0;
+ bef:	b8 00 00 00 00       	mov    $0x0,%eax
+ bf4:	eb 13                	jmp    c09 <malloc+0xe1>
+  for(p = prevp->s.ptr; ; prevp = p, p = p->s.ptr){
+ bf6:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bf9:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ bfc:	8b 45 f4             	mov    -0xc(%ebp),%eax
+ bff:	8b 00                	mov    (%eax),%eax
+ c01:	89 45 f4             	mov    %eax,-0xc(%ebp)
+    if(p->s.size >= nunits){
+ c04:	e9 6d ff ff ff       	jmp    b76 <malloc+0x4e>
+  }
+}
+ c09:	c9                   	leave
+ c0a:	c3                   	ret
+
+00000c0b <thread_create>:
+// Start a thread running fn(arg) on a stack from malloc().
+// fn must call exit() rather than return.  malloc() is not
+// thread-safe, so only one thread should create threads.
+int
+thread_create(void (*fn)(void*), void *arg)
+{
+ c0b:	55                   	push   %ebp
+ c0c:	89 e5                	mov    %esp,%ebp
+ c0e:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((stack = malloc(TSTACK)) == 0)
+ c11:	83 ec 0c             	sub    $0xc,%esp
+ c14:	68 00 10 00 00       	push   $0x1000
+ c19:	e8 0a ff ff ff       	call   b28 <malloc>
+ c1e:	83 c4 10             	add    $0x10,%esp
+ c21:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c24:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c28:	75 07                	jne    c31 <thread_create+0x26>
+    return -1;
+ c2a:	b8 ff ff ff ff       	mov    $0xffffffff,%eax
+ c2f:	eb 2e                	jmp    c5f <thread_create+0x54>
+  if((pid = clone(fn, arg, stack)) < 0)
+ c31:	83 ec 04             	sub    $0x4,%esp
+ c34:	ff 75 f4             	push   -0xc(%ebp)
+ c37:	ff 75 0c             	push   0xc(%ebp)
+ c3a:	ff 75 08             	push   0x8(%ebp)
+ c3d:	e8 ee fa ff ff       	call   730 <clone>
+ c42:	83 c4 10             	add    $0x10,%esp
+ c45:	89 45 f0             	mov    %eax,-0x10(%ebp)
+ c48:	83 7d f0 00          	cmpl   $0x0,-0x10(%ebp)
+ c4c:	79 0e                	jns    c5c <thread_create+0x51>
+    free(stack);
+ c4e:	83 ec 0c             	sub    $0xc,%esp
+ c51:	ff 75 f4             	push   -0xc(%ebp)
+ c54:	e8 8d fd ff ff       	call   9e6 <free>
+ c59:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ c5c:	8b 45 f0             	mov    -0x10(%ebp),%eax
+}
+ c5f:	c9                   	leave
+ c60:	c3                   	ret
+
+00000c61 <thread_join>:
+
+// Wait for a thread made by thread_create() to exit,
+// free its stack, and return its pid.
+int
+thread_join(void)
+{
+ c61:	55                   	push   %ebp
+ c62:	89 e5                	mov    %esp,%ebp
+ c64:	83 ec 18             	sub    $0x18,%esp
+  void *stack;
+  int pid;
+
+  if((pid = join(&stack)) >= 0)
+ c67:	83 ec 0c             	sub    $0xc,%esp
+ c6a:	8d 45 f0             	lea    -0x10(%ebp),%eax
+ c6d:	50                   	push   %eax
+ c6e:	e8 c7 fa ff ff       	call   73a <join>
+ c73:	83 c4 10             	add    $0x10,%esp
+ c76:	89 45 f4             	mov    %eax,-0xc(%ebp)
+ c79:	83 7d f4 00          	cmpl   $0x0,-0xc(%ebp)
+ c7d:	78 0f                	js     c8e <thread_join+0x2d>
+    free(stack);
+ c7f:	8b 45 f0             	mov    -0x10(%ebp),%eax
+ c82:	83 ec 0c             	sub    $0xc,%esp
+ c85:	50                   	push   %eax
+ c86:	e8 5b fd ff ff       	call   9e6 <free>
+ c8b:	83 c4 10             	add    $0x10,%esp
+  return pid;
+ c8e:	8b 45 f4             	mov    -0xc(%ebp),%eax
+}
+ c91:	c9                   	leave
+ c92:	c3                   	ret